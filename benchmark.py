@@ -0,0 +1,84 @@
+
+# benchmark
+# interpreter hot paths, run with: time ./tinypy benchmark.py
+
+# fib (calls and returns)
+def fib(n):
+  if n < 2:
+    return n
+  return fib(n - 1) + fib(n - 2)
+
+# loops (arithmetic and branches, no calls)
+def loops(n):
+  t = 0
+  i = 0
+  while i < n:
+    if i % 3 == 0:
+      t = t + i * 2
+    else:
+      t = t - 1
+    i += 1
+  return t
+
+# lists
+def lists(n):
+  l = []
+  for i in range(n):
+    l.append(i * 0.5)
+  s = 0
+  for x in l:
+    s += x
+  return s
+
+# strings
+def strings(n):
+  s = ''
+  for i in range(n):
+    s = s + 'ab'
+  c = 0
+  for ch in s:
+    if ch == 'a':
+      c += 1
+  return c
+
+# dicts
+def dicts(n):
+  d = {}
+  for i in range(n):
+    d[i] = i
+  t = 0
+  for k in d:
+    t += d[k]
+  return t
+
+# Point
+class Point:
+
+  def __init__(self, x, y):
+    self.x = x
+    self.y = y
+
+  def dot(self, other):
+    return self.x * other.x + self.y * other.y
+
+# objects (attributes and method calls)
+def objects(n):
+  a = Point(1, 2)
+  b = Point(3, 4)
+  t = 0
+  for i in range(n):
+    t += a.dot(b) + a.x
+  return t
+
+# main
+def main():
+  print("fib", fib(24))
+  print("loops", loops(1000000))
+  print("lists", lists(200000))
+  print("strings", strings(50000))
+  print("dicts", dicts(100000))
+  print("objects", objects(200000))
+
+# entry point
+if __name__ == '__main__':
+  main()
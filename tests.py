@@ -12,12 +12,231 @@ class ExampleClass:
     self.value="abcde"
 
 
+# Counter
+class Counter:
+
+  def __init__(self, v):
+    self.v = v
+
+  def scaled(self, x):
+    return self.v * 10 + x
+
+# test_bound_method_attr (a bound method stored in a class is bound again to the instance, not called with two receivers)
+def test_bound_method_attr():
+  a = Counter(1)
+  b = Counter(2)
+  Counter.other = b.scaled
+  h = a.other
+  assert(a.other(5) == 15)
+  assert(h(5) == 15)
+  assert(b.scaled(5) == 25)
+  print("bound method attr ok")
+
+# recurse
+def recurse(n):
+  return recurse(n + 1)
+
+# test_recursion_limit (runaway recursion raises an exception that can be caught)
+def test_recursion_limit():
+  caught = False
+  try:
+    recurse(0)
+  except:
+    caught = True
+  assert(caught)
+  print("recursion limit ok")
+
+# Nested (the constructor recurses through the native call of the class)
+class Nested:
+
+  def __init__(self, n):
+    self.child = None
+    if n > 0:
+      self.child = Nested(n - 1)
+
+# test_native_recursion_limit (deep enough recursion through constructors raises instead of crashing)
+def test_native_recursion_limit():
+  Nested(100)
+  caught = False
+  try:
+    Nested(1000000)
+  except:
+    caught = True
+  assert(caught)
+  print("native recursion limit ok")
+
+# test_int64 (literals above 2^53 are exact, edge cases of shifts and modulo are defined)
+def test_int64():
+  assert(9007199254740993 - 9007199254740992 == 1)
+  assert(0x7fffffffffffffff == 9223372036854775807)
+  m = -9223372036854775807 - 1
+  assert(m % -1 == 0)
+  assert(3037000000 * 3037000000 == 9223369000000000000)
+  assert(3037000499 * 3037000499 == 9223372030926249001)
+  assert(istype(3037000500 * 3037000500, "number"))
+  assert(1 << 64 == 0)
+  assert(-1 >> 70 == -1)
+  caught = False
+  try:
+    x = 1 << -1
+  except:
+    caught = True
+  assert(caught)
+  print("int64 ok")
+
+# test_many_attribute_names (more classes than the shape transitions allow, the rest of the instances use maps)
+def test_many_attribute_names():
+  import tinypy
+  src = ""
+  for i in range(40):
+    n = str(i)
+    src = src + "class C" + n + ":\n  def __init__(self):\n    self.a" + n + " = " + n + "\n"
+    src = src + "class D" + n + ":\n  def __init__(self):\n    self.base = 1\n    self.d" + n + " = " + n + "\n"
+  src = src + "t = 0\nfor i in range(2):\n"
+  for i in range(40):
+    n = str(i)
+    src = src + "  t += C" + n + "().a" + n + " + D" + n + "().d" + n + "\n"
+  g = {}
+  exec(tinypy.compileFile(src, "many_attribute_names"), g)
+  assert(g["t"] == 3120)
+  print("many attribute names ok")
+
+# Point
+class Point:
+
+  def __init__(self, x, y, bSwap):
+    if bSwap:
+      self.y = y
+      self.x = x
+    else:
+      self.x = x
+      self.y = y
+
+# sumPoints (a single access site for every point)
+def sumPoints(points):
+  t = 0
+  for p in points:
+    t += p.x * 10 + p.y
+  return t
+
+# test_shape_transitions (instances with the same attributes in a different order, or extended later, read correctly at one site)
+def test_shape_transitions():
+  points = [Point(1, 2, False), Point(3, 4, True), Point(5, 6, False)]
+  assert(sumPoints(points) == 102)
+  points[1].z = 9
+  points[2].x = 7
+  assert(sumPoints(points) == 122)
+  assert(points[1].z == 9)
+  print("shape transitions ok")
+
+# test_slot_cap (an instance with more attributes than a shape holds keeps all of them)
+def test_slot_cap():
+  import tinypy
+  src = "class Wide:\n  def __init__(self):\n"
+  for i in range(80):
+    src = src + "    self.a" + str(i) + " = " + str(i) + "\n"
+  src = src + "t = 0\nfor k in range(3):\n  w = Wide()\n"
+  for i in range(80):
+    src = src + "  t += w.a" + str(i) + "\n"
+  src = src + "  w.a79 = 0\n  t -= w.a79\n"
+  g = {}
+  exec(tinypy.compileFile(src, "slot_cap"), g)
+  assert(g["t"] == 9480)
+  print("slot cap ok")
+
+# V0..V5 (more receiver classes than an attribute cache holds entries)
+class V0:
+  v = 0
+class V1:
+  v = 1
+class V2:
+  def __init__(self):
+    self.v = 2
+class V3:
+  def __init__(self):
+    self.v = 3
+class V4:
+  v = 4
+class V5:
+  def __init__(self):
+    self.v = 5
+
+# sumValues
+def sumValues(objects):
+  t = 0
+  for o in objects:
+    t += o.v
+  return t
+
+# test_cache_eviction (a polymorphic site evicts and refills its entries without mixing the receivers up)
+def test_cache_eviction():
+  objects = [V0(), V1(), V2(), V3(), V4(), V5()]
+  for i in range(4):
+    assert(sumValues(objects) == 15)
+  assert(sumValues([V5(), V4(), V3()]) == 12)
+  print("cache eviction ok")
+
+# Greeter
+class Greeter:
+  greeting = 1
+
+  def greet(self):
+    return 10
+
+# callGreet
+def callGreet(g):
+  return g.greet() + g.greeting
+
+# scale (read by readScale as a global)
+scale = 2
+
+# readScale
+def readScale():
+  return scale * 3
+
+# test_cache_invalidation (cached reads see class and global dicts changing)
+def test_cache_invalidation():
+  g = Greeter()
+  assert(callGreet(g) == 11)
+  assert(callGreet(g) == 11)
+  Greeter.greeting = 2
+  assert(callGreet(g) == 12)
+  def greet2(self):
+    return 20
+  Greeter.greet = greet2
+  assert(callGreet(g) == 22)
+  g.greeting = 5
+  assert(callGreet(g) == 25)
+  assert(callGreet(Greeter()) == 22)
+  global scale
+  assert(readScale() == 6)
+  scale = 4
+  assert(readScale() == 12)
+  import tinypy
+  src = "def count():\n  return len([1, 2])\n"
+  src = src + "r1 = count()\nr2 = count()\n"
+  src = src + "def len(x):\n  return 42\n"
+  src = src + "r3 = count()\nextra = 1\nr4 = count()\n"
+  env = {}
+  exec(tinypy.compileFile(src, "cache_invalidation"), env)
+  assert(env["r1"] == 2 and env["r2"] == 2)
+  assert(env["r3"] == 42 and env["r4"] == 42)
+  print("cache invalidation ok")
 
 # main
 def main():
   example=ExampleClass()
   print(ExampleClass.static_value)
   print(example.value)
+  test_bound_method_attr()
+  test_recursion_limit()
+  test_native_recursion_limit()
+  test_int64()
+  test_many_attribute_names()
+  test_shape_transitions()
+  test_slot_cap()
+  test_cache_eviction()
+  test_cache_invalidation()
 
 # entry point
 if __name__ == '__main__':
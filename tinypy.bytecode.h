@@ -1,7 +1,7 @@
 /*This file is autogenerated by generate_bytecode.py*/
 
 unsigned char py_tinypy[] = {
-44,143,0,0,30,3,0,1,105,109,112,111,114,116,32,115,
+44,146,0,0,30,3,0,1,105,109,112,111,114,116,32,115,
 121,115,0,0,12,0,0,9,116,105,110,121,112,121,46,112,
 121,0,0,0,33,0,0,0,12,0,0,1,63,0,0,0,
 34,0,0,0,12,2,0,6,105,109,112,111,114,116,0,0,
@@ -12,7 +12,7 @@ unsigned char py_tinypy[] = {
 111,110,58,0,12,2,0,3,115,121,115,0,13,1,2,0,
 12,2,0,7,118,101,114,115,105,111,110,0,9,1,1,2,
 12,2,0,6,116,105,110,121,112,121,0,0,36,1,1,2,
-47,0,1,0,21,0,0,0,18,0,2,118,30,5,0,7,
+47,0,1,0,21,0,0,0,18,0,2,232,30,5,0,7,
 9,100,101,102,32,109,101,114,103,101,40,97,44,98,41,58,
 0,0,0,0,16,0,0,87,44,10,0,0,30,5,0,7,
 9,100,101,102,32,109,101,114,103,101,40,97,44,98,41,58,
@@ -27,11 +27,11 @@ unsigned char py_tinypy[] = {
 31,3,5,2,19,3,4,3,21,3,0,0,18,0,0,18,
 30,7,0,9,9,9,9,102,111,114,32,107,32,105,110,32,
 98,58,32,97,91,107,93,32,61,32,98,91,107,93,0,0,
-11,4,0,0,0,0,0,0,0,0,0,0,42,3,2,4,
+11,4,0,1,0,0,0,0,0,0,0,0,42,3,2,4,
 18,0,0,4,9,5,2,3,10,1,3,5,18,0,255,252,
 18,0,0,27,30,9,0,11,9,9,9,102,111,114,32,107,
 32,105,110,32,98,58,32,115,101,116,97,116,116,114,40,97,
-44,107,44,98,91,107,93,41,0,0,0,0,11,4,0,0,
+44,107,44,98,91,107,93,41,0,0,0,0,11,4,0,1,
 0,0,0,0,0,0,0,0,42,3,2,4,18,0,0,11,
 12,7,0,7,115,101,116,97,116,116,114,0,13,6,7,0,
 15,7,1,0,15,8,3,0,9,9,2,3,31,5,7,3,
@@ -48,15 +48,15 @@ unsigned char py_tinypy[] = {
 61,32,39,48,120,39,58,0,12,4,0,4,116,121,112,101,
 0,0,0,0,13,3,4,0,15,4,1,0,31,2,4,1,
 19,2,3,2,12,4,0,3,115,116,114,0,13,3,4,0,
-23,2,2,3,21,2,0,0,18,0,0,12,11,4,0,0,
-0,0,0,0,0,0,0,0,11,5,0,0,0,0,0,0,
-0,0,0,64,27,3,4,2,9,2,1,3,12,3,0,2,
+23,2,2,3,21,2,0,0,18,0,0,12,11,4,0,1,
+0,0,0,0,0,0,0,0,11,5,0,1,2,0,0,0,
+0,0,0,0,27,3,4,2,9,2,1,3,12,3,0,2,
 48,120,0,0,23,2,2,3,21,2,0,0,18,0,0,24,
 30,6,0,16,9,9,9,118,32,61,32,105,110,116,40,118,
 91,50,58,93,44,49,54,41,0,0,0,0,12,4,0,3,
-105,110,116,0,13,3,4,0,11,7,0,0,0,0,0,0,
-0,0,0,64,28,8,0,0,27,6,7,2,9,4,1,6,
-11,5,0,0,0,0,0,0,0,0,48,64,31,2,4,2,
+105,110,116,0,13,3,4,0,11,7,0,1,2,0,0,0,
+0,0,0,0,28,8,0,0,27,6,7,2,9,4,1,6,
+11,5,0,1,16,0,0,0,0,0,0,0,31,2,4,2,
 19,2,3,2,15,1,2,0,18,0,0,1,30,5,0,17,
 9,9,114,101,116,117,114,110,32,102,108,111,97,116,40,118,
 41,0,0,0,12,4,0,5,102,108,111,97,116,0,0,0,
@@ -116,7 +116,7 @@ unsigned char py_tinypy[] = {
 63,0,0,0,37,3,0,0,0,0,0,0,12,3,0,6,
 105,115,116,121,112,101,0,0,14,3,2,0,30,4,0,28,
 9,100,101,102,32,102,112,97,99,107,40,118,41,58,0,0,
-16,3,0,52,44,7,0,0,30,4,0,28,9,100,101,102,
+16,3,0,51,44,9,0,0,30,4,0,28,9,100,101,102,
 32,102,112,97,99,107,40,118,41,58,0,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
 12,1,0,5,102,112,97,99,107,0,0,0,34,1,0,0,
@@ -126,1507 +126,1533 @@ unsigned char py_tinypy[] = {
 115,116,114,117,99,116,0,0,31,2,4,1,19,2,3,2,
 15,3,2,0,30,7,0,30,9,9,114,101,116,117,114,110,
 32,115,116,114,117,99,116,46,112,97,99,107,40,39,100,39,
-44,118,41,0,12,5,0,4,112,97,99,107,0,0,0,0,
-9,4,3,5,12,5,0,1,100,0,0,0,15,6,1,0,
-31,2,5,2,19,2,4,2,20,2,0,0,0,0,0,0,
-12,4,0,5,102,112,97,99,107,0,0,0,14,4,3,0,
-30,7,0,33,9,100,101,102,32,108,111,97,100,70,105,108,
-101,40,102,105,108,101,110,97,109,101,41,58,0,0,0,0,
-16,4,0,68,44,7,0,0,30,7,0,33,9,100,101,102,
+44,118,41,0,12,8,0,4,112,97,99,107,0,0,0,0,
+49,4,3,8,12,6,0,1,100,0,0,0,15,7,1,0,
+50,2,4,2,20,2,0,0,0,0,0,0,12,4,0,5,
+102,112,97,99,107,0,0,0,14,4,3,0,30,4,0,33,
+9,100,101,102,32,105,112,97,99,107,40,118,41,58,0,0,
+16,4,0,110,44,14,0,0,30,4,0,33,9,100,101,102,
+32,105,112,97,99,107,40,118,41,58,0,0,12,1,0,9,
+116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
+12,1,0,5,105,112,97,99,107,0,0,0,34,1,0,0,
+28,2,0,0,9,1,0,2,30,4,0,34,9,9,105,109,
+112,111,114,116,32,115,116,114,117,99,116,0,12,4,0,6,
+105,109,112,111,114,116,0,0,13,3,4,0,12,4,0,6,
+115,116,114,117,99,116,0,0,31,2,4,1,19,2,3,2,
+15,3,2,0,30,15,0,35,9,9,105,102,32,118,91,48,
+58,50,93,32,61,61,32,39,48,120,39,58,32,114,101,116,
+117,114,110,32,115,116,114,117,99,116,46,112,97,99,107,40,
+39,113,39,44,105,110,116,40,118,91,50,58,93,44,49,54,
+41,41,0,0,11,5,0,1,0,0,0,0,0,0,0,0,
+11,6,0,1,2,0,0,0,0,0,0,0,27,4,5,2,
+9,2,1,4,12,4,0,2,48,120,0,0,23,2,2,4,
+21,2,0,0,18,0,0,24,12,8,0,4,112,97,99,107,
+0,0,0,0,49,4,3,8,12,6,0,1,113,0,0,0,
+12,9,0,3,105,110,116,0,13,8,9,0,11,12,0,1,
+2,0,0,0,0,0,0,0,28,13,0,0,27,11,12,2,
+9,9,1,11,11,10,0,1,16,0,0,0,0,0,0,0,
+31,7,9,2,19,7,8,7,50,2,4,2,20,2,0,0,
+18,0,0,1,30,9,0,36,9,9,114,101,116,117,114,110,
+32,115,116,114,117,99,116,46,112,97,99,107,40,39,113,39,
+44,105,110,116,40,118,41,41,0,0,0,0,12,8,0,4,
+112,97,99,107,0,0,0,0,49,4,3,8,12,6,0,1,
+113,0,0,0,12,9,0,3,105,110,116,0,13,8,9,0,
+15,9,1,0,31,7,9,1,19,7,8,7,50,2,4,2,
+20,2,0,0,0,0,0,0,12,5,0,5,105,112,97,99,
+107,0,0,0,14,5,4,0,30,7,0,39,9,100,101,102,
 32,108,111,97,100,70,105,108,101,40,102,105,108,101,110,97,
-109,101,41,58,0,0,0,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,8,
-108,111,97,100,70,105,108,101,0,0,0,0,34,1,0,0,
-28,2,0,0,9,1,0,2,30,7,0,34,9,9,102,32,
-61,32,111,112,101,110,40,102,105,108,101,110,97,109,101,44,
-39,114,98,39,41,0,0,0,12,5,0,4,111,112,101,110,
-0,0,0,0,13,4,5,0,15,5,1,0,12,6,0,2,
-114,98,0,0,31,3,5,2,19,3,4,3,15,2,3,0,
-30,4,0,35,9,9,114,32,61,32,102,46,114,101,97,100,
-40,41,0,0,12,6,0,4,114,101,97,100,0,0,0,0,
-9,5,2,6,31,4,0,0,19,4,5,4,15,3,4,0,
-30,3,0,36,9,9,102,46,99,108,111,115,101,40,41,0,
-12,6,0,5,99,108,111,115,101,0,0,0,9,5,2,6,
-31,4,0,0,19,4,5,4,30,3,0,37,9,9,114,101,
+109,101,41,58,0,0,0,0,16,5,0,66,44,8,0,0,
+30,7,0,39,9,100,101,102,32,108,111,97,100,70,105,108,
+101,40,102,105,108,101,110,97,109,101,41,58,0,0,0,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,8,108,111,97,100,70,105,108,101,
+0,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
+30,7,0,40,9,9,102,32,61,32,111,112,101,110,40,102,
+105,108,101,110,97,109,101,44,39,114,98,39,41,0,0,0,
+12,5,0,4,111,112,101,110,0,0,0,0,13,4,5,0,
+15,5,1,0,12,6,0,2,114,98,0,0,31,3,5,2,
+19,3,4,3,15,2,3,0,30,4,0,41,9,9,114,32,
+61,32,102,46,114,101,97,100,40,41,0,0,12,7,0,4,
+114,101,97,100,0,0,0,0,49,5,2,7,50,4,5,0,
+15,3,4,0,30,3,0,42,9,9,102,46,99,108,111,115,
+101,40,41,0,12,7,0,5,99,108,111,115,101,0,0,0,
+49,5,2,7,50,4,5,0,30,3,0,43,9,9,114,101,
 116,117,114,110,32,114,0,0,20,3,0,0,0,0,0,0,
-12,5,0,8,108,111,97,100,70,105,108,101,0,0,0,0,
-14,5,4,0,30,7,0,40,9,100,101,102,32,115,97,118,
+12,6,0,8,108,111,97,100,70,105,108,101,0,0,0,0,
+14,6,5,0,30,7,0,46,9,100,101,102,32,115,97,118,
 101,70,105,108,101,40,102,105,108,101,110,97,109,101,44,118,
-41,58,0,0,16,5,0,65,44,8,0,0,30,7,0,40,
+41,58,0,0,16,6,0,63,44,9,0,0,30,7,0,46,
 9,100,101,102,32,115,97,118,101,70,105,108,101,40,102,105,
 108,101,110,97,109,101,44,118,41,58,0,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
 12,1,0,8,115,97,118,101,70,105,108,101,0,0,0,0,
 34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,30,7,0,41,9,9,102,32,61,32,111,112,
+9,2,0,3,30,7,0,47,9,9,102,32,61,32,111,112,
 101,110,40,102,105,108,101,110,97,109,101,44,39,119,98,39,
 41,0,0,0,12,6,0,4,111,112,101,110,0,0,0,0,
 13,5,6,0,15,6,1,0,12,7,0,2,119,98,0,0,
-31,4,6,2,19,4,5,4,15,3,4,0,30,4,0,42,
+31,4,6,2,19,4,5,4,15,3,4,0,30,4,0,48,
 9,9,102,46,119,114,105,116,101,40,118,41,0,0,0,0,
-12,6,0,5,119,114,105,116,101,0,0,0,9,5,3,6,
-15,6,2,0,31,4,6,1,19,4,5,4,30,3,0,43,
-9,9,102,46,99,108,111,115,101,40,41,0,12,6,0,5,
-99,108,111,115,101,0,0,0,9,5,3,6,31,4,0,0,
-19,4,5,4,0,0,0,0,12,6,0,8,115,97,118,101,
-70,105,108,101,0,0,0,0,14,6,5,0,18,0,0,1,
-30,3,0,46,79,80,95,69,79,70,61,48,0,0,0,0,
-12,6,0,6,79,80,95,69,79,70,0,0,11,7,0,0,
-0,0,0,0,0,0,0,0,14,6,7,0,30,3,0,47,
-79,80,95,65,68,68,61,49,0,0,0,0,12,6,0,6,
-79,80,95,65,68,68,0,0,11,7,0,0,0,0,0,0,
-0,0,240,63,14,6,7,0,30,3,0,48,79,80,95,83,
-85,66,61,50,0,0,0,0,12,6,0,6,79,80,95,83,
-85,66,0,0,11,7,0,0,0,0,0,0,0,0,0,64,
-14,6,7,0,30,3,0,49,79,80,95,77,85,76,61,51,
-0,0,0,0,12,6,0,6,79,80,95,77,85,76,0,0,
-11,7,0,0,0,0,0,0,0,0,8,64,14,6,7,0,
-30,3,0,50,79,80,95,68,73,86,61,52,0,0,0,0,
-12,6,0,6,79,80,95,68,73,86,0,0,11,7,0,0,
-0,0,0,0,0,0,16,64,14,6,7,0,30,3,0,51,
-79,80,95,80,79,87,61,53,0,0,0,0,12,6,0,6,
-79,80,95,80,79,87,0,0,11,7,0,0,0,0,0,0,
-0,0,20,64,14,6,7,0,30,3,0,52,79,80,95,66,
-73,84,65,78,68,61,54,0,12,6,0,9,79,80,95,66,
-73,84,65,78,68,0,0,0,11,7,0,0,0,0,0,0,
-0,0,24,64,14,6,7,0,30,3,0,53,79,80,95,66,
-73,84,79,82,61,55,0,0,12,6,0,8,79,80,95,66,
-73,84,79,82,0,0,0,0,11,7,0,0,0,0,0,0,
-0,0,28,64,14,6,7,0,30,3,0,54,79,80,95,67,
-77,80,61,56,0,0,0,0,12,6,0,6,79,80,95,67,
-77,80,0,0,11,7,0,0,0,0,0,0,0,0,32,64,
-14,6,7,0,30,3,0,55,79,80,95,71,69,84,61,57,
-0,0,0,0,12,6,0,6,79,80,95,71,69,84,0,0,
-11,7,0,0,0,0,0,0,0,0,34,64,14,6,7,0,
-30,3,0,56,79,80,95,83,69,84,61,49,48,0,0,0,
-12,6,0,6,79,80,95,83,69,84,0,0,11,7,0,0,
-0,0,0,0,0,0,36,64,14,6,7,0,30,4,0,57,
-79,80,95,78,85,77,66,69,82,61,49,49,0,0,0,0,
-12,6,0,9,79,80,95,78,85,77,66,69,82,0,0,0,
-11,7,0,0,0,0,0,0,0,0,38,64,14,6,7,0,
-30,4,0,58,79,80,95,83,84,82,73,78,71,61,49,50,
-0,0,0,0,12,6,0,9,79,80,95,83,84,82,73,78,
-71,0,0,0,11,7,0,0,0,0,0,0,0,0,40,64,
-14,6,7,0,30,3,0,59,79,80,95,71,71,69,84,61,
-49,51,0,0,12,6,0,7,79,80,95,71,71,69,84,0,
-11,7,0,0,0,0,0,0,0,0,42,64,14,6,7,0,
-30,3,0,60,79,80,95,71,83,69,84,61,49,52,0,0,
-12,6,0,7,79,80,95,71,83,69,84,0,11,7,0,0,
-0,0,0,0,0,0,44,64,14,6,7,0,30,3,0,61,
-79,80,95,77,79,86,69,61,49,53,0,0,12,6,0,7,
-79,80,95,77,79,86,69,0,11,7,0,0,0,0,0,0,
-0,0,46,64,14,6,7,0,30,3,0,62,79,80,95,68,
-69,70,61,49,54,0,0,0,12,6,0,6,79,80,95,68,
-69,70,0,0,11,7,0,0,0,0,0,0,0,0,48,64,
-14,6,7,0,30,3,0,63,79,80,95,80,65,83,83,61,
-49,55,0,0,12,6,0,7,79,80,95,80,65,83,83,0,
-11,7,0,0,0,0,0,0,0,0,49,64,14,6,7,0,
-30,3,0,64,79,80,95,74,85,77,80,61,49,56,0,0,
-12,6,0,7,79,80,95,74,85,77,80,0,11,7,0,0,
-0,0,0,0,0,0,50,64,14,6,7,0,30,3,0,65,
-79,80,95,67,65,76,76,61,49,57,0,0,12,6,0,7,
-79,80,95,67,65,76,76,0,11,7,0,0,0,0,0,0,
-0,0,51,64,14,6,7,0,30,4,0,66,79,80,95,82,
-69,84,85,82,78,61,50,48,0,0,0,0,12,6,0,9,
-79,80,95,82,69,84,85,82,78,0,0,0,11,7,0,0,
-0,0,0,0,0,0,52,64,14,6,7,0,30,3,0,67,
-79,80,95,73,70,61,50,49,0,0,0,0,12,6,0,5,
-79,80,95,73,70,0,0,0,11,7,0,0,0,0,0,0,
-0,0,53,64,14,6,7,0,30,3,0,68,79,80,95,68,
-69,66,85,71,61,50,50,0,12,6,0,8,79,80,95,68,
-69,66,85,71,0,0,0,0,11,7,0,0,0,0,0,0,
-0,0,54,64,14,6,7,0,30,3,0,69,79,80,95,69,
-81,61,50,51,0,0,0,0,12,6,0,5,79,80,95,69,
-81,0,0,0,11,7,0,0,0,0,0,0,0,0,55,64,
-14,6,7,0,30,3,0,70,79,80,95,76,69,61,50,52,
-0,0,0,0,12,6,0,5,79,80,95,76,69,0,0,0,
-11,7,0,0,0,0,0,0,0,0,56,64,14,6,7,0,
-30,3,0,71,79,80,95,76,84,61,50,53,0,0,0,0,
-12,6,0,5,79,80,95,76,84,0,0,0,11,7,0,0,
-0,0,0,0,0,0,57,64,14,6,7,0,30,3,0,72,
-79,80,95,68,73,67,84,61,50,54,0,0,12,6,0,7,
-79,80,95,68,73,67,84,0,11,7,0,0,0,0,0,0,
-0,0,58,64,14,6,7,0,30,3,0,73,79,80,95,76,
-73,83,84,61,50,55,0,0,12,6,0,7,79,80,95,76,
-73,83,84,0,11,7,0,0,0,0,0,0,0,0,59,64,
-14,6,7,0,30,3,0,74,79,80,95,78,79,78,69,61,
-50,56,0,0,12,6,0,7,79,80,95,78,79,78,69,0,
-11,7,0,0,0,0,0,0,0,0,60,64,14,6,7,0,
-30,3,0,75,79,80,95,76,69,78,61,50,57,0,0,0,
-12,6,0,6,79,80,95,76,69,78,0,0,11,7,0,0,
-0,0,0,0,0,0,61,64,14,6,7,0,30,3,0,76,
-79,80,95,80,79,83,61,51,48,0,0,0,12,6,0,6,
-79,80,95,80,79,83,0,0,11,7,0,0,0,0,0,0,
-0,0,62,64,14,6,7,0,30,4,0,77,79,80,95,80,
-65,82,65,77,83,61,51,49,0,0,0,0,12,6,0,9,
-79,80,95,80,65,82,65,77,83,0,0,0,11,7,0,0,
-0,0,0,0,0,0,63,64,14,6,7,0,30,3,0,78,
-79,80,95,73,71,69,84,61,51,50,0,0,12,6,0,7,
-79,80,95,73,71,69,84,0,11,7,0,0,0,0,0,0,
-0,0,64,64,14,6,7,0,30,3,0,79,79,80,95,70,
-73,76,69,61,51,51,0,0,12,6,0,7,79,80,95,70,
-73,76,69,0,11,7,0,0,0,0,0,0,0,128,64,64,
-14,6,7,0,30,3,0,80,79,80,95,78,65,77,69,61,
-51,52,0,0,12,6,0,7,79,80,95,78,65,77,69,0,
-11,7,0,0,0,0,0,0,0,0,65,64,14,6,7,0,
-30,3,0,81,79,80,95,78,69,61,51,53,0,0,0,0,
-12,6,0,5,79,80,95,78,69,0,0,0,11,7,0,0,
-0,0,0,0,0,128,65,64,14,6,7,0,30,3,0,82,
-79,80,95,72,65,83,61,51,54,0,0,0,12,6,0,6,
-79,80,95,72,65,83,0,0,11,7,0,0,0,0,0,0,
-0,0,66,64,14,6,7,0,30,3,0,83,79,80,95,82,
-65,73,83,69,61,51,55,0,12,6,0,8,79,80,95,82,
-65,73,83,69,0,0,0,0,11,7,0,0,0,0,0,0,
-0,128,66,64,14,6,7,0,30,4,0,84,79,80,95,83,
-69,84,74,77,80,61,51,56,0,0,0,0,12,6,0,9,
-79,80,95,83,69,84,74,77,80,0,0,0,11,7,0,0,
-0,0,0,0,0,0,67,64,14,6,7,0,30,3,0,85,
-79,80,95,77,79,68,61,51,57,0,0,0,12,6,0,6,
-79,80,95,77,79,68,0,0,11,7,0,0,0,0,0,0,
-0,128,67,64,14,6,7,0,30,3,0,86,79,80,95,76,
-83,72,61,52,48,0,0,0,12,6,0,6,79,80,95,76,
-83,72,0,0,11,7,0,0,0,0,0,0,0,0,68,64,
-14,6,7,0,30,3,0,87,79,80,95,82,83,72,61,52,
-49,0,0,0,12,6,0,6,79,80,95,82,83,72,0,0,
-11,7,0,0,0,0,0,0,0,128,68,64,14,6,7,0,
-30,3,0,88,79,80,95,73,84,69,82,61,52,50,0,0,
-12,6,0,7,79,80,95,73,84,69,82,0,11,7,0,0,
-0,0,0,0,0,0,69,64,14,6,7,0,30,3,0,89,
-79,80,95,68,69,76,61,52,51,0,0,0,12,6,0,6,
-79,80,95,68,69,76,0,0,11,7,0,0,0,0,0,0,
-0,128,69,64,14,6,7,0,30,3,0,90,79,80,95,82,
-69,71,83,61,52,52,0,0,12,6,0,7,79,80,95,82,
-69,71,83,0,11,7,0,0,0,0,0,0,0,0,70,64,
-14,6,7,0,30,4,0,91,79,80,95,66,73,84,88,79,
-82,61,52,53,0,0,0,0,12,6,0,9,79,80,95,66,
-73,84,88,79,82,0,0,0,11,7,0,0,0,0,0,0,
-0,128,70,64,14,6,7,0,30,3,0,92,79,80,95,73,
-70,78,61,52,54,0,0,0,12,6,0,6,79,80,95,73,
-70,78,0,0,11,7,0,0,0,0,0,0,0,0,71,64,
-14,6,7,0,30,3,0,93,79,80,95,78,79,84,61,52,
-55,0,0,0,12,6,0,6,79,80,95,78,79,84,0,0,
-11,7,0,0,0,0,0,0,0,128,71,64,14,6,7,0,
-30,4,0,94,79,80,95,66,73,84,78,79,84,32,61,32,
-52,56,0,0,12,6,0,9,79,80,95,66,73,84,78,79,
-84,0,0,0,11,7,0,0,0,0,0,0,0,0,72,64,
-14,6,7,0,30,9,0,97,100,101,102,32,114,97,105,115,
+12,8,0,5,119,114,105,116,101,0,0,0,49,5,3,8,
+15,7,2,0,50,4,5,1,30,3,0,49,9,9,102,46,
+99,108,111,115,101,40,41,0,12,7,0,5,99,108,111,115,
+101,0,0,0,49,5,3,7,50,4,5,0,0,0,0,0,
+12,7,0,8,115,97,118,101,70,105,108,101,0,0,0,0,
+14,7,6,0,18,0,0,1,30,3,0,52,79,80,95,69,
+79,70,61,48,0,0,0,0,12,7,0,6,79,80,95,69,
+79,70,0,0,11,8,0,1,0,0,0,0,0,0,0,0,
+14,7,8,0,30,3,0,53,79,80,95,65,68,68,61,49,
+0,0,0,0,12,7,0,6,79,80,95,65,68,68,0,0,
+11,8,0,1,1,0,0,0,0,0,0,0,14,7,8,0,
+30,3,0,54,79,80,95,83,85,66,61,50,0,0,0,0,
+12,7,0,6,79,80,95,83,85,66,0,0,11,8,0,1,
+2,0,0,0,0,0,0,0,14,7,8,0,30,3,0,55,
+79,80,95,77,85,76,61,51,0,0,0,0,12,7,0,6,
+79,80,95,77,85,76,0,0,11,8,0,1,3,0,0,0,
+0,0,0,0,14,7,8,0,30,3,0,56,79,80,95,68,
+73,86,61,52,0,0,0,0,12,7,0,6,79,80,95,68,
+73,86,0,0,11,8,0,1,4,0,0,0,0,0,0,0,
+14,7,8,0,30,3,0,57,79,80,95,80,79,87,61,53,
+0,0,0,0,12,7,0,6,79,80,95,80,79,87,0,0,
+11,8,0,1,5,0,0,0,0,0,0,0,14,7,8,0,
+30,3,0,58,79,80,95,66,73,84,65,78,68,61,54,0,
+12,7,0,9,79,80,95,66,73,84,65,78,68,0,0,0,
+11,8,0,1,6,0,0,0,0,0,0,0,14,7,8,0,
+30,3,0,59,79,80,95,66,73,84,79,82,61,55,0,0,
+12,7,0,8,79,80,95,66,73,84,79,82,0,0,0,0,
+11,8,0,1,7,0,0,0,0,0,0,0,14,7,8,0,
+30,3,0,60,79,80,95,67,77,80,61,56,0,0,0,0,
+12,7,0,6,79,80,95,67,77,80,0,0,11,8,0,1,
+8,0,0,0,0,0,0,0,14,7,8,0,30,3,0,61,
+79,80,95,71,69,84,61,57,0,0,0,0,12,7,0,6,
+79,80,95,71,69,84,0,0,11,8,0,1,9,0,0,0,
+0,0,0,0,14,7,8,0,30,3,0,62,79,80,95,83,
+69,84,61,49,48,0,0,0,12,7,0,6,79,80,95,83,
+69,84,0,0,11,8,0,1,10,0,0,0,0,0,0,0,
+14,7,8,0,30,4,0,63,79,80,95,78,85,77,66,69,
+82,61,49,49,0,0,0,0,12,7,0,9,79,80,95,78,
+85,77,66,69,82,0,0,0,11,8,0,1,11,0,0,0,
+0,0,0,0,14,7,8,0,30,4,0,64,79,80,95,83,
+84,82,73,78,71,61,49,50,0,0,0,0,12,7,0,9,
+79,80,95,83,84,82,73,78,71,0,0,0,11,8,0,1,
+12,0,0,0,0,0,0,0,14,7,8,0,30,3,0,65,
+79,80,95,71,71,69,84,61,49,51,0,0,12,7,0,7,
+79,80,95,71,71,69,84,0,11,8,0,1,13,0,0,0,
+0,0,0,0,14,7,8,0,30,3,0,66,79,80,95,71,
+83,69,84,61,49,52,0,0,12,7,0,7,79,80,95,71,
+83,69,84,0,11,8,0,1,14,0,0,0,0,0,0,0,
+14,7,8,0,30,3,0,67,79,80,95,77,79,86,69,61,
+49,53,0,0,12,7,0,7,79,80,95,77,79,86,69,0,
+11,8,0,1,15,0,0,0,0,0,0,0,14,7,8,0,
+30,3,0,68,79,80,95,68,69,70,61,49,54,0,0,0,
+12,7,0,6,79,80,95,68,69,70,0,0,11,8,0,1,
+16,0,0,0,0,0,0,0,14,7,8,0,30,3,0,69,
+79,80,95,80,65,83,83,61,49,55,0,0,12,7,0,7,
+79,80,95,80,65,83,83,0,11,8,0,1,17,0,0,0,
+0,0,0,0,14,7,8,0,30,3,0,70,79,80,95,74,
+85,77,80,61,49,56,0,0,12,7,0,7,79,80,95,74,
+85,77,80,0,11,8,0,1,18,0,0,0,0,0,0,0,
+14,7,8,0,30,3,0,71,79,80,95,67,65,76,76,61,
+49,57,0,0,12,7,0,7,79,80,95,67,65,76,76,0,
+11,8,0,1,19,0,0,0,0,0,0,0,14,7,8,0,
+30,4,0,72,79,80,95,82,69,84,85,82,78,61,50,48,
+0,0,0,0,12,7,0,9,79,80,95,82,69,84,85,82,
+78,0,0,0,11,8,0,1,20,0,0,0,0,0,0,0,
+14,7,8,0,30,3,0,73,79,80,95,73,70,61,50,49,
+0,0,0,0,12,7,0,5,79,80,95,73,70,0,0,0,
+11,8,0,1,21,0,0,0,0,0,0,0,14,7,8,0,
+30,3,0,74,79,80,95,68,69,66,85,71,61,50,50,0,
+12,7,0,8,79,80,95,68,69,66,85,71,0,0,0,0,
+11,8,0,1,22,0,0,0,0,0,0,0,14,7,8,0,
+30,3,0,75,79,80,95,69,81,61,50,51,0,0,0,0,
+12,7,0,5,79,80,95,69,81,0,0,0,11,8,0,1,
+23,0,0,0,0,0,0,0,14,7,8,0,30,3,0,76,
+79,80,95,76,69,61,50,52,0,0,0,0,12,7,0,5,
+79,80,95,76,69,0,0,0,11,8,0,1,24,0,0,0,
+0,0,0,0,14,7,8,0,30,3,0,77,79,80,95,76,
+84,61,50,53,0,0,0,0,12,7,0,5,79,80,95,76,
+84,0,0,0,11,8,0,1,25,0,0,0,0,0,0,0,
+14,7,8,0,30,3,0,78,79,80,95,68,73,67,84,61,
+50,54,0,0,12,7,0,7,79,80,95,68,73,67,84,0,
+11,8,0,1,26,0,0,0,0,0,0,0,14,7,8,0,
+30,3,0,79,79,80,95,76,73,83,84,61,50,55,0,0,
+12,7,0,7,79,80,95,76,73,83,84,0,11,8,0,1,
+27,0,0,0,0,0,0,0,14,7,8,0,30,3,0,80,
+79,80,95,78,79,78,69,61,50,56,0,0,12,7,0,7,
+79,80,95,78,79,78,69,0,11,8,0,1,28,0,0,0,
+0,0,0,0,14,7,8,0,30,3,0,81,79,80,95,76,
+69,78,61,50,57,0,0,0,12,7,0,6,79,80,95,76,
+69,78,0,0,11,8,0,1,29,0,0,0,0,0,0,0,
+14,7,8,0,30,3,0,82,79,80,95,80,79,83,61,51,
+48,0,0,0,12,7,0,6,79,80,95,80,79,83,0,0,
+11,8,0,1,30,0,0,0,0,0,0,0,14,7,8,0,
+30,4,0,83,79,80,95,80,65,82,65,77,83,61,51,49,
+0,0,0,0,12,7,0,9,79,80,95,80,65,82,65,77,
+83,0,0,0,11,8,0,1,31,0,0,0,0,0,0,0,
+14,7,8,0,30,3,0,84,79,80,95,73,71,69,84,61,
+51,50,0,0,12,7,0,7,79,80,95,73,71,69,84,0,
+11,8,0,1,32,0,0,0,0,0,0,0,14,7,8,0,
+30,3,0,85,79,80,95,70,73,76,69,61,51,51,0,0,
+12,7,0,7,79,80,95,70,73,76,69,0,11,8,0,1,
+33,0,0,0,0,0,0,0,14,7,8,0,30,3,0,86,
+79,80,95,78,65,77,69,61,51,52,0,0,12,7,0,7,
+79,80,95,78,65,77,69,0,11,8,0,1,34,0,0,0,
+0,0,0,0,14,7,8,0,30,3,0,87,79,80,95,78,
+69,61,51,53,0,0,0,0,12,7,0,5,79,80,95,78,
+69,0,0,0,11,8,0,1,35,0,0,0,0,0,0,0,
+14,7,8,0,30,3,0,88,79,80,95,72,65,83,61,51,
+54,0,0,0,12,7,0,6,79,80,95,72,65,83,0,0,
+11,8,0,1,36,0,0,0,0,0,0,0,14,7,8,0,
+30,3,0,89,79,80,95,82,65,73,83,69,61,51,55,0,
+12,7,0,8,79,80,95,82,65,73,83,69,0,0,0,0,
+11,8,0,1,37,0,0,0,0,0,0,0,14,7,8,0,
+30,4,0,90,79,80,95,83,69,84,74,77,80,61,51,56,
+0,0,0,0,12,7,0,9,79,80,95,83,69,84,74,77,
+80,0,0,0,11,8,0,1,38,0,0,0,0,0,0,0,
+14,7,8,0,30,3,0,91,79,80,95,77,79,68,61,51,
+57,0,0,0,12,7,0,6,79,80,95,77,79,68,0,0,
+11,8,0,1,39,0,0,0,0,0,0,0,14,7,8,0,
+30,3,0,92,79,80,95,76,83,72,61,52,48,0,0,0,
+12,7,0,6,79,80,95,76,83,72,0,0,11,8,0,1,
+40,0,0,0,0,0,0,0,14,7,8,0,30,3,0,93,
+79,80,95,82,83,72,61,52,49,0,0,0,12,7,0,6,
+79,80,95,82,83,72,0,0,11,8,0,1,41,0,0,0,
+0,0,0,0,14,7,8,0,30,3,0,94,79,80,95,73,
+84,69,82,61,52,50,0,0,12,7,0,7,79,80,95,73,
+84,69,82,0,11,8,0,1,42,0,0,0,0,0,0,0,
+14,7,8,0,30,3,0,95,79,80,95,68,69,76,61,52,
+51,0,0,0,12,7,0,6,79,80,95,68,69,76,0,0,
+11,8,0,1,43,0,0,0,0,0,0,0,14,7,8,0,
+30,3,0,96,79,80,95,82,69,71,83,61,52,52,0,0,
+12,7,0,7,79,80,95,82,69,71,83,0,11,8,0,1,
+44,0,0,0,0,0,0,0,14,7,8,0,30,4,0,97,
+79,80,95,66,73,84,88,79,82,61,52,53,0,0,0,0,
+12,7,0,9,79,80,95,66,73,84,88,79,82,0,0,0,
+11,8,0,1,45,0,0,0,0,0,0,0,14,7,8,0,
+30,3,0,98,79,80,95,73,70,78,61,52,54,0,0,0,
+12,7,0,6,79,80,95,73,70,78,0,0,11,8,0,1,
+46,0,0,0,0,0,0,0,14,7,8,0,30,3,0,99,
+79,80,95,78,79,84,61,52,55,0,0,0,12,7,0,6,
+79,80,95,78,79,84,0,0,11,8,0,1,47,0,0,0,
+0,0,0,0,14,7,8,0,30,4,0,100,79,80,95,66,
+73,84,78,79,84,32,61,32,52,56,0,0,12,7,0,9,
+79,80,95,66,73,84,78,79,84,0,0,0,11,8,0,1,
+48,0,0,0,0,0,0,0,14,7,8,0,30,5,0,101,
+79,80,95,76,79,65,68,77,69,84,72,79,68,61,52,57,
+0,0,0,0,12,7,0,13,79,80,95,76,79,65,68,77,
+69,84,72,79,68,0,0,0,11,8,0,1,49,0,0,0,
+0,0,0,0,14,7,8,0,30,5,0,102,79,80,95,67,
+65,76,76,77,69,84,72,79,68,61,53,48,0,0,0,0,
+12,7,0,13,79,80,95,67,65,76,76,77,69,84,72,79,
+68,0,0,0,11,8,0,1,50,0,0,0,0,0,0,0,
+14,7,8,0,30,9,0,105,100,101,102,32,114,97,105,115,
 101,69,114,114,111,114,40,101,120,112,108,97,110,97,116,105,
-111,110,44,115,44,105,41,58,0,0,0,0,16,6,0,180,
-44,12,0,0,30,9,0,97,100,101,102,32,114,97,105,115,
+111,110,44,115,44,105,41,58,0,0,0,0,16,7,0,179,
+44,12,0,0,30,9,0,105,100,101,102,32,114,97,105,115,
 101,69,114,114,111,114,40,101,120,112,108,97,110,97,116,105,
 111,110,44,115,44,105,41,58,0,0,0,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
 12,1,0,10,114,97,105,115,101,69,114,114,111,114,0,0,
 34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,28,4,0,0,9,3,0,4,30,3,0,98,
-9,121,44,120,32,61,32,105,0,0,0,0,11,6,0,0,
+9,2,0,3,28,4,0,0,9,3,0,4,30,3,0,106,
+9,121,44,120,32,61,32,105,0,0,0,0,11,6,0,1,
 0,0,0,0,0,0,0,0,9,5,3,6,15,4,5,0,
-11,7,0,0,0,0,0,0,0,0,240,63,9,6,3,7,
-15,5,6,0,30,7,0,99,9,108,105,110,101,32,61,32,
+11,7,0,1,1,0,0,0,0,0,0,0,9,6,3,7,
+15,5,6,0,30,7,0,107,9,108,105,110,101,32,61,32,
 115,46,115,112,108,105,116,40,39,92,110,39,41,91,121,45,
-49,93,0,0,12,8,0,5,115,112,108,105,116,0,0,0,
-9,7,2,8,12,8,0,1,10,0,0,0,31,6,8,1,
-19,6,7,6,11,8,0,0,0,0,0,0,0,0,240,63,
-2,7,4,8,9,6,6,7,15,3,6,0,30,2,0,100,
-9,112,32,61,32,39,39,0,12,7,0,0,0,0,0,0,
-15,6,7,0,30,6,0,101,9,105,102,32,121,32,60,32,
-49,48,58,32,112,32,43,61,32,39,32,39,0,0,0,0,
-11,8,0,0,0,0,0,0,0,0,36,64,25,7,4,8,
-21,7,0,0,18,0,0,6,12,8,0,1,32,0,0,0,
-1,7,6,8,15,6,7,0,18,0,0,1,30,6,0,102,
-9,105,102,32,121,32,60,32,49,48,48,58,32,112,32,43,
-61,32,39,32,32,39,0,0,11,8,0,0,0,0,0,0,
-0,0,89,64,25,7,4,8,21,7,0,0,18,0,0,6,
-12,8,0,2,32,32,0,0,1,7,6,8,15,6,7,0,
-18,0,0,1,30,10,0,103,9,114,32,61,32,112,32,43,
-32,115,116,114,40,121,41,32,43,32,34,58,32,34,32,43,
-32,108,105,110,101,32,43,32,34,92,110,34,0,0,0,0,
-12,11,0,3,115,116,114,0,13,10,11,0,15,11,4,0,
-31,9,11,1,19,9,10,9,1,8,6,9,12,9,0,2,
-58,32,0,0,1,8,8,9,1,8,8,3,12,9,0,1,
-10,0,0,0,1,8,8,9,15,7,8,0,30,8,0,104,
-9,114,32,43,61,32,34,32,32,32,32,32,34,43,34,32,
-34,42,120,43,34,94,34,32,43,39,92,110,39,0,0,0,
-12,9,0,5,32,32,32,32,32,0,0,0,12,10,0,1,
-32,0,0,0,3,10,10,5,1,9,9,10,12,10,0,1,
-94,0,0,0,1,9,9,10,12,10,0,1,10,0,0,0,
-1,9,9,10,1,8,7,9,15,7,8,0,30,11,0,105,
-9,114,97,105,115,101,32,39,101,114,114,111,114,32,114,97,
-105,115,101,100,58,32,39,43,101,120,112,108,97,110,97,116,
-105,111,110,43,39,92,110,39,43,114,0,0,12,8,0,14,
-101,114,114,111,114,32,114,97,105,115,101,100,58,32,0,0,
-1,8,8,1,12,9,0,1,10,0,0,0,1,8,8,9,
-1,8,8,7,37,8,0,0,0,0,0,0,12,7,0,10,
-114,97,105,115,101,69,114,114,111,114,0,0,14,7,6,0,
-30,4,0,108,99,108,97,115,115,32,84,111,107,101,110,58,
-0,0,0,0,26,7,0,0,12,8,0,5,84,111,107,101,
-110,0,0,0,14,8,7,0,12,10,0,7,115,101,116,109,
-101,116,97,0,13,9,10,0,15,10,7,0,12,12,0,6,
-111,98,106,101,99,116,0,0,13,11,12,0,31,8,10,2,
-19,8,9,8,16,8,0,89,44,11,0,0,30,17,0,109,
-32,32,32,32,100,101,102,32,95,95,105,110,105,116,95,95,
-40,115,101,108,102,44,112,111,115,61,40,48,44,48,41,44,
-116,121,112,101,61,39,115,121,109,98,111,108,39,44,118,97,
-108,61,78,111,110,101,44,105,116,101,109,115,61,78,111,110,
-101,41,58,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,8,95,95,105,110,
-105,116,95,95,0,0,0,0,34,1,0,0,28,2,0,0,
-9,1,0,2,11,3,0,0,0,0,0,0,0,0,0,0,
-11,4,0,0,0,0,0,0,0,0,0,0,27,2,3,2,
-28,3,0,0,32,2,0,3,12,3,0,6,115,121,109,98,
-111,108,0,0,28,4,0,0,32,3,0,4,28,4,0,0,
-28,5,0,0,32,4,0,5,28,5,0,0,28,6,0,0,
-32,5,0,6,30,17,0,110,32,32,32,32,32,32,32,32,
-115,101,108,102,46,112,111,115,44,115,101,108,102,46,116,121,
-112,101,44,115,101,108,102,46,118,97,108,44,115,101,108,102,
-46,105,116,101,109,115,61,112,111,115,44,116,121,112,101,44,
-118,97,108,44,105,116,101,109,115,0,0,0,15,6,2,0,
-15,7,3,0,15,8,4,0,15,9,5,0,12,10,0,3,
-112,111,115,0,10,1,10,6,12,6,0,4,116,121,112,101,
-0,0,0,0,10,1,6,7,12,6,0,3,118,97,108,0,
-10,1,6,8,12,6,0,5,105,116,101,109,115,0,0,0,
-10,1,6,9,0,0,0,0,12,9,0,8,95,95,105,110,
-105,116,95,95,0,0,0,0,10,7,9,8,30,5,0,113,
-99,108,97,115,115,32,84,111,107,101,110,105,122,101,114,58,
-0,0,0,0,26,7,0,0,12,9,0,9,84,111,107,101,
-110,105,122,101,114,0,0,0,14,9,7,0,12,11,0,7,
-115,101,116,109,101,116,97,0,13,10,11,0,15,11,7,0,
-12,13,0,6,111,98,106,101,99,116,0,0,13,12,13,0,
-31,9,11,2,19,9,10,9,16,9,1,56,44,66,0,0,
-30,6,0,116,9,100,101,102,32,95,95,105,110,105,116,95,
-95,40,115,101,108,102,41,58,0,0,0,0,12,1,0,9,
-116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,8,95,95,105,110,105,116,95,95,0,0,0,0,
-34,1,0,0,28,2,0,0,9,1,0,2,30,12,0,118,
-9,9,115,101,108,102,46,73,83,89,77,66,79,76,83,32,
-61,32,39,96,45,61,91,93,59,44,46,47,126,33,64,36,
-37,94,38,42,40,41,43,123,125,58,60,62,63,124,39,0,
-12,2,0,27,96,45,61,91,93,59,44,46,47,126,33,64,
-36,37,94,38,42,40,41,43,123,125,58,60,62,63,124,0,
-12,3,0,8,73,83,89,77,66,79,76,83,0,0,0,0,
-10,1,3,2,30,5,0,120,9,9,115,101,108,102,46,83,
-89,77,66,79,76,83,32,61,32,91,0,0,30,19,0,121,
-9,9,9,39,100,101,102,39,44,39,99,108,97,115,115,39,
-44,39,121,105,101,108,100,39,44,39,114,101,116,117,114,110,
-39,44,39,112,97,115,115,39,44,39,97,110,100,39,44,39,
-111,114,39,44,39,110,111,116,39,44,39,105,110,39,44,39,
-105,109,112,111,114,116,39,44,0,0,0,0,12,3,0,3,
-100,101,102,0,12,4,0,5,99,108,97,115,115,0,0,0,
-12,5,0,5,121,105,101,108,100,0,0,0,12,6,0,6,
-114,101,116,117,114,110,0,0,12,7,0,4,112,97,115,115,
-0,0,0,0,12,8,0,3,97,110,100,0,12,9,0,2,
-111,114,0,0,12,10,0,3,110,111,116,0,12,11,0,2,
-105,110,0,0,12,12,0,6,105,109,112,111,114,116,0,0,
-30,17,0,122,9,9,9,39,105,115,39,44,39,119,104,105,
-108,101,39,44,39,98,114,101,97,107,39,44,39,102,111,114,
-39,44,39,99,111,110,116,105,110,117,101,39,44,39,105,102,
-39,44,39,101,108,115,101,39,44,39,101,108,105,102,39,44,
-39,116,114,121,39,44,0,0,12,13,0,2,105,115,0,0,
-12,14,0,5,119,104,105,108,101,0,0,0,12,15,0,5,
-98,114,101,97,107,0,0,0,12,16,0,3,102,111,114,0,
-12,17,0,8,99,111,110,116,105,110,117,101,0,0,0,0,
-12,18,0,2,105,102,0,0,12,19,0,4,101,108,115,101,
-0,0,0,0,12,20,0,4,101,108,105,102,0,0,0,0,
-12,21,0,3,116,114,121,0,30,17,0,123,9,9,9,39,
-101,120,99,101,112,116,39,44,39,114,97,105,115,101,39,44,
-39,84,114,117,101,39,44,39,70,97,108,115,101,39,44,39,
-78,111,110,101,39,44,39,103,108,111,98,97,108,39,44,39,
-100,101,108,39,44,39,102,114,111,109,39,44,0,0,0,0,
-12,22,0,6,101,120,99,101,112,116,0,0,12,23,0,5,
-114,97,105,115,101,0,0,0,12,24,0,4,84,114,117,101,
-0,0,0,0,12,25,0,5,70,97,108,115,101,0,0,0,
-12,26,0,4,78,111,110,101,0,0,0,0,12,27,0,6,
-103,108,111,98,97,108,0,0,12,28,0,3,100,101,108,0,
-12,29,0,4,102,114,111,109,0,0,0,0,30,10,0,124,
-9,9,9,39,45,39,44,39,43,39,44,39,42,39,44,39,
-42,42,39,44,39,47,39,44,39,37,39,44,39,60,60,39,
-44,39,62,62,39,44,0,0,12,30,0,1,45,0,0,0,
-12,31,0,1,43,0,0,0,12,32,0,1,42,0,0,0,
-12,33,0,2,42,42,0,0,12,34,0,1,47,0,0,0,
-12,35,0,1,37,0,0,0,12,36,0,2,60,60,0,0,
-12,37,0,2,62,62,0,0,30,16,0,125,9,9,9,39,
-45,61,39,44,39,43,61,39,44,39,42,61,39,44,39,47,
-61,39,44,39,61,39,44,39,61,61,39,44,39,33,61,39,
-44,39,60,39,44,39,62,39,44,32,39,124,61,39,44,32,
-39,38,61,39,44,32,39,94,61,39,44,0,12,38,0,2,
-45,61,0,0,12,39,0,2,43,61,0,0,12,40,0,2,
-42,61,0,0,12,41,0,2,47,61,0,0,12,42,0,1,
-61,0,0,0,12,43,0,2,61,61,0,0,12,44,0,2,
-33,61,0,0,12,45,0,1,60,0,0,0,12,46,0,1,
-62,0,0,0,12,47,0,2,124,61,0,0,12,48,0,2,
-38,61,0,0,12,49,0,2,94,61,0,0,30,18,0,126,
-9,9,9,39,60,61,39,44,39,62,61,39,44,39,91,39,
-44,39,93,39,44,39,123,39,44,39,125,39,44,39,40,39,
-44,39,41,39,44,39,46,39,44,39,58,39,44,39,44,39,
-44,39,59,39,44,39,38,39,44,39,124,39,44,39,33,39,
-44,32,39,94,39,93,0,0,12,50,0,2,60,61,0,0,
-12,51,0,2,62,61,0,0,12,52,0,1,91,0,0,0,
-12,53,0,1,93,0,0,0,12,54,0,1,123,0,0,0,
-12,55,0,1,125,0,0,0,12,56,0,1,40,0,0,0,
-12,57,0,1,41,0,0,0,12,58,0,1,46,0,0,0,
-12,59,0,1,58,0,0,0,12,60,0,1,44,0,0,0,
-12,61,0,1,59,0,0,0,12,62,0,1,38,0,0,0,
-12,63,0,1,124,0,0,0,12,64,0,1,33,0,0,0,
-12,65,0,1,94,0,0,0,27,2,3,63,30,5,0,120,
-9,9,115,101,108,102,46,83,89,77,66,79,76,83,32,61,
-32,91,0,0,12,3,0,7,83,89,77,66,79,76,83,0,
-10,1,3,2,0,0,0,0,12,10,0,8,95,95,105,110,
-105,116,95,95,0,0,0,0,10,7,10,9,16,10,0,66,
-44,7,0,0,30,5,0,130,9,100,101,102,32,99,108,101,
-97,110,40,115,101,108,102,44,115,41,58,0,12,1,0,9,
-116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,5,99,108,101,97,110,0,0,0,34,1,0,0,
-28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-30,8,0,131,9,9,115,32,61,32,115,46,114,101,112,108,
-97,99,101,40,39,92,114,92,110,39,44,39,92,110,39,41,
-0,0,0,0,12,5,0,7,114,101,112,108,97,99,101,0,
-9,4,2,5,12,5,0,2,13,10,0,0,12,6,0,1,
-10,0,0,0,31,3,5,2,19,3,4,3,15,2,3,0,
-30,7,0,132,9,9,115,32,61,32,115,46,114,101,112,108,
-97,99,101,40,39,92,114,39,44,39,92,110,39,41,0,0,
-12,5,0,7,114,101,112,108,97,99,101,0,9,4,2,5,
-12,5,0,1,13,0,0,0,12,6,0,1,10,0,0,0,
-31,3,5,2,19,3,4,3,15,2,3,0,30,3,0,133,
-9,9,114,101,116,117,114,110,32,115,0,0,20,2,0,0,
-0,0,0,0,12,11,0,5,99,108,101,97,110,0,0,0,
-10,7,11,10,16,11,1,48,44,13,0,0,30,7,0,136,
-9,100,101,102,32,100,111,84,111,107,101,110,105,122,101,40,
-115,101,108,102,44,115,41,58,0,0,0,0,12,1,0,9,
-116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,10,100,111,84,111,107,101,110,105,122,101,0,0,
-34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,30,5,0,137,9,9,115,32,61,32,115,101,
-108,102,46,99,108,101,97,110,40,115,41,0,12,5,0,5,
-99,108,101,97,110,0,0,0,9,4,1,5,15,5,2,0,
-31,3,5,1,19,3,4,3,15,2,3,0,30,4,0,139,
+49,93,0,0,12,10,0,5,115,112,108,105,116,0,0,0,
+49,7,2,10,12,9,0,1,10,0,0,0,50,6,7,1,
+11,8,0,1,1,0,0,0,0,0,0,0,2,7,4,8,
+9,6,6,7,15,3,6,0,30,2,0,108,9,112,32,61,
+32,39,39,0,12,7,0,0,0,0,0,0,15,6,7,0,
+30,6,0,109,9,105,102,32,121,32,60,32,49,48,58,32,
+112,32,43,61,32,39,32,39,0,0,0,0,11,8,0,1,
+10,0,0,0,0,0,0,0,25,7,4,8,21,7,0,0,
+18,0,0,6,12,8,0,1,32,0,0,0,1,7,6,8,
+15,6,7,0,18,0,0,1,30,6,0,110,9,105,102,32,
+121,32,60,32,49,48,48,58,32,112,32,43,61,32,39,32,
+32,39,0,0,11,8,0,1,100,0,0,0,0,0,0,0,
+25,7,4,8,21,7,0,0,18,0,0,6,12,8,0,2,
+32,32,0,0,1,7,6,8,15,6,7,0,18,0,0,1,
+30,10,0,111,9,114,32,61,32,112,32,43,32,115,116,114,
+40,121,41,32,43,32,34,58,32,34,32,43,32,108,105,110,
+101,32,43,32,34,92,110,34,0,0,0,0,12,11,0,3,
+115,116,114,0,13,10,11,0,15,11,4,0,31,9,11,1,
+19,9,10,9,1,8,6,9,12,9,0,2,58,32,0,0,
+1,8,8,9,1,8,8,3,12,9,0,1,10,0,0,0,
+1,8,8,9,15,7,8,0,30,8,0,112,9,114,32,43,
+61,32,34,32,32,32,32,32,34,43,34,32,34,42,120,43,
+34,94,34,32,43,39,92,110,39,0,0,0,12,9,0,5,
+32,32,32,32,32,0,0,0,12,10,0,1,32,0,0,0,
+3,10,10,5,1,9,9,10,12,10,0,1,94,0,0,0,
+1,9,9,10,12,10,0,1,10,0,0,0,1,9,9,10,
+1,8,7,9,15,7,8,0,30,11,0,113,9,114,97,105,
+115,101,32,39,101,114,114,111,114,32,114,97,105,115,101,100,
+58,32,39,43,101,120,112,108,97,110,97,116,105,111,110,43,
+39,92,110,39,43,114,0,0,12,8,0,14,101,114,114,111,
+114,32,114,97,105,115,101,100,58,32,0,0,1,8,8,1,
+12,9,0,1,10,0,0,0,1,8,8,9,1,8,8,7,
+37,8,0,0,0,0,0,0,12,8,0,10,114,97,105,115,
+101,69,114,114,111,114,0,0,14,8,7,0,30,4,0,116,
+99,108,97,115,115,32,84,111,107,101,110,58,0,0,0,0,
+26,8,0,0,12,9,0,5,84,111,107,101,110,0,0,0,
+14,9,8,0,12,11,0,7,115,101,116,109,101,116,97,0,
+13,10,11,0,15,11,8,0,12,13,0,6,111,98,106,101,
+99,116,0,0,13,12,13,0,31,9,11,2,19,9,10,9,
+16,9,0,89,44,11,0,0,30,17,0,117,32,32,32,32,
+100,101,102,32,95,95,105,110,105,116,95,95,40,115,101,108,
+102,44,112,111,115,61,40,48,44,48,41,44,116,121,112,101,
+61,39,115,121,109,98,111,108,39,44,118,97,108,61,78,111,
+110,101,44,105,116,101,109,115,61,78,111,110,101,41,58,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,8,95,95,105,110,105,116,95,95,
+0,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
+11,3,0,1,0,0,0,0,0,0,0,0,11,4,0,1,
+0,0,0,0,0,0,0,0,27,2,3,2,28,3,0,0,
+32,2,0,3,12,3,0,6,115,121,109,98,111,108,0,0,
+28,4,0,0,32,3,0,4,28,4,0,0,28,5,0,0,
+32,4,0,5,28,5,0,0,28,6,0,0,32,5,0,6,
+30,17,0,118,32,32,32,32,32,32,32,32,115,101,108,102,
+46,112,111,115,44,115,101,108,102,46,116,121,112,101,44,115,
+101,108,102,46,118,97,108,44,115,101,108,102,46,105,116,101,
+109,115,61,112,111,115,44,116,121,112,101,44,118,97,108,44,
+105,116,101,109,115,0,0,0,15,6,2,0,15,7,3,0,
+15,8,4,0,15,9,5,0,12,10,0,3,112,111,115,0,
+10,1,10,6,12,6,0,4,116,121,112,101,0,0,0,0,
+10,1,6,7,12,6,0,3,118,97,108,0,10,1,6,8,
+12,6,0,5,105,116,101,109,115,0,0,0,10,1,6,9,
+0,0,0,0,12,10,0,8,95,95,105,110,105,116,95,95,
+0,0,0,0,10,8,10,9,30,5,0,121,99,108,97,115,
+115,32,84,111,107,101,110,105,122,101,114,58,0,0,0,0,
+26,8,0,0,12,10,0,9,84,111,107,101,110,105,122,101,
+114,0,0,0,14,10,8,0,12,12,0,7,115,101,116,109,
+101,116,97,0,13,11,12,0,15,12,8,0,12,14,0,6,
+111,98,106,101,99,116,0,0,13,13,14,0,31,10,12,2,
+19,10,11,10,16,10,1,56,44,66,0,0,30,6,0,124,
+9,100,101,102,32,95,95,105,110,105,116,95,95,40,115,101,
+108,102,41,58,0,0,0,0,12,1,0,9,116,105,110,121,
+112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,8,
+95,95,105,110,105,116,95,95,0,0,0,0,34,1,0,0,
+28,2,0,0,9,1,0,2,30,12,0,126,9,9,115,101,
+108,102,46,73,83,89,77,66,79,76,83,32,61,32,39,96,
+45,61,91,93,59,44,46,47,126,33,64,36,37,94,38,42,
+40,41,43,123,125,58,60,62,63,124,39,0,12,2,0,27,
+96,45,61,91,93,59,44,46,47,126,33,64,36,37,94,38,
+42,40,41,43,123,125,58,60,62,63,124,0,12,3,0,8,
+73,83,89,77,66,79,76,83,0,0,0,0,10,1,3,2,
+30,5,0,128,9,9,115,101,108,102,46,83,89,77,66,79,
+76,83,32,61,32,91,0,0,30,19,0,129,9,9,9,39,
+100,101,102,39,44,39,99,108,97,115,115,39,44,39,121,105,
+101,108,100,39,44,39,114,101,116,117,114,110,39,44,39,112,
+97,115,115,39,44,39,97,110,100,39,44,39,111,114,39,44,
+39,110,111,116,39,44,39,105,110,39,44,39,105,109,112,111,
+114,116,39,44,0,0,0,0,12,3,0,3,100,101,102,0,
+12,4,0,5,99,108,97,115,115,0,0,0,12,5,0,5,
+121,105,101,108,100,0,0,0,12,6,0,6,114,101,116,117,
+114,110,0,0,12,7,0,4,112,97,115,115,0,0,0,0,
+12,8,0,3,97,110,100,0,12,9,0,2,111,114,0,0,
+12,10,0,3,110,111,116,0,12,11,0,2,105,110,0,0,
+12,12,0,6,105,109,112,111,114,116,0,0,30,17,0,130,
+9,9,9,39,105,115,39,44,39,119,104,105,108,101,39,44,
+39,98,114,101,97,107,39,44,39,102,111,114,39,44,39,99,
+111,110,116,105,110,117,101,39,44,39,105,102,39,44,39,101,
+108,115,101,39,44,39,101,108,105,102,39,44,39,116,114,121,
+39,44,0,0,12,13,0,2,105,115,0,0,12,14,0,5,
+119,104,105,108,101,0,0,0,12,15,0,5,98,114,101,97,
+107,0,0,0,12,16,0,3,102,111,114,0,12,17,0,8,
+99,111,110,116,105,110,117,101,0,0,0,0,12,18,0,2,
+105,102,0,0,12,19,0,4,101,108,115,101,0,0,0,0,
+12,20,0,4,101,108,105,102,0,0,0,0,12,21,0,3,
+116,114,121,0,30,17,0,131,9,9,9,39,101,120,99,101,
+112,116,39,44,39,114,97,105,115,101,39,44,39,84,114,117,
+101,39,44,39,70,97,108,115,101,39,44,39,78,111,110,101,
+39,44,39,103,108,111,98,97,108,39,44,39,100,101,108,39,
+44,39,102,114,111,109,39,44,0,0,0,0,12,22,0,6,
+101,120,99,101,112,116,0,0,12,23,0,5,114,97,105,115,
+101,0,0,0,12,24,0,4,84,114,117,101,0,0,0,0,
+12,25,0,5,70,97,108,115,101,0,0,0,12,26,0,4,
+78,111,110,101,0,0,0,0,12,27,0,6,103,108,111,98,
+97,108,0,0,12,28,0,3,100,101,108,0,12,29,0,4,
+102,114,111,109,0,0,0,0,30,10,0,132,9,9,9,39,
+45,39,44,39,43,39,44,39,42,39,44,39,42,42,39,44,
+39,47,39,44,39,37,39,44,39,60,60,39,44,39,62,62,
+39,44,0,0,12,30,0,1,45,0,0,0,12,31,0,1,
+43,0,0,0,12,32,0,1,42,0,0,0,12,33,0,2,
+42,42,0,0,12,34,0,1,47,0,0,0,12,35,0,1,
+37,0,0,0,12,36,0,2,60,60,0,0,12,37,0,2,
+62,62,0,0,30,16,0,133,9,9,9,39,45,61,39,44,
+39,43,61,39,44,39,42,61,39,44,39,47,61,39,44,39,
+61,39,44,39,61,61,39,44,39,33,61,39,44,39,60,39,
+44,39,62,39,44,32,39,124,61,39,44,32,39,38,61,39,
+44,32,39,94,61,39,44,0,12,38,0,2,45,61,0,0,
+12,39,0,2,43,61,0,0,12,40,0,2,42,61,0,0,
+12,41,0,2,47,61,0,0,12,42,0,1,61,0,0,0,
+12,43,0,2,61,61,0,0,12,44,0,2,33,61,0,0,
+12,45,0,1,60,0,0,0,12,46,0,1,62,0,0,0,
+12,47,0,2,124,61,0,0,12,48,0,2,38,61,0,0,
+12,49,0,2,94,61,0,0,30,18,0,134,9,9,9,39,
+60,61,39,44,39,62,61,39,44,39,91,39,44,39,93,39,
+44,39,123,39,44,39,125,39,44,39,40,39,44,39,41,39,
+44,39,46,39,44,39,58,39,44,39,44,39,44,39,59,39,
+44,39,38,39,44,39,124,39,44,39,33,39,44,32,39,94,
+39,93,0,0,12,50,0,2,60,61,0,0,12,51,0,2,
+62,61,0,0,12,52,0,1,91,0,0,0,12,53,0,1,
+93,0,0,0,12,54,0,1,123,0,0,0,12,55,0,1,
+125,0,0,0,12,56,0,1,40,0,0,0,12,57,0,1,
+41,0,0,0,12,58,0,1,46,0,0,0,12,59,0,1,
+58,0,0,0,12,60,0,1,44,0,0,0,12,61,0,1,
+59,0,0,0,12,62,0,1,38,0,0,0,12,63,0,1,
+124,0,0,0,12,64,0,1,33,0,0,0,12,65,0,1,
+94,0,0,0,27,2,3,63,30,5,0,128,9,9,115,101,
+108,102,46,83,89,77,66,79,76,83,32,61,32,91,0,0,
+12,3,0,7,83,89,77,66,79,76,83,0,10,1,3,2,
+0,0,0,0,12,11,0,8,95,95,105,110,105,116,95,95,
+0,0,0,0,10,8,11,10,16,11,0,64,44,9,0,0,
+30,5,0,138,9,100,101,102,32,99,108,101,97,110,40,115,
+101,108,102,44,115,41,58,0,12,1,0,9,116,105,110,121,
+112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,5,
+99,108,101,97,110,0,0,0,34,1,0,0,28,2,0,0,
+9,1,0,2,28,3,0,0,9,2,0,3,30,8,0,139,
+9,9,115,32,61,32,115,46,114,101,112,108,97,99,101,40,
+39,92,114,92,110,39,44,39,92,110,39,41,0,0,0,0,
+12,8,0,7,114,101,112,108,97,99,101,0,49,4,2,8,
+12,6,0,2,13,10,0,0,12,7,0,1,10,0,0,0,
+50,3,4,2,15,2,3,0,30,7,0,140,9,9,115,32,
+61,32,115,46,114,101,112,108,97,99,101,40,39,92,114,39,
+44,39,92,110,39,41,0,0,12,8,0,7,114,101,112,108,
+97,99,101,0,49,4,2,8,12,6,0,1,13,0,0,0,
+12,7,0,1,10,0,0,0,50,3,4,2,15,2,3,0,
+30,3,0,141,9,9,114,101,116,117,114,110,32,115,0,0,
+20,2,0,0,0,0,0,0,12,12,0,5,99,108,101,97,
+110,0,0,0,10,8,12,11,16,12,1,45,44,14,0,0,
+30,7,0,144,9,100,101,102,32,100,111,84,111,107,101,110,
+105,122,101,40,115,101,108,102,44,115,41,58,0,0,0,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,10,100,111,84,111,107,101,110,105,
+122,101,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
+28,3,0,0,9,2,0,3,30,5,0,145,9,9,115,32,
+61,32,115,101,108,102,46,99,108,101,97,110,40,115,41,0,
+12,7,0,5,99,108,101,97,110,0,0,0,49,4,1,7,
+15,6,2,0,50,3,4,1,15,2,3,0,30,4,0,147,
 9,9,99,108,97,115,115,32,84,68,97,116,97,58,0,0,
 26,3,0,0,12,4,0,5,84,68,97,116,97,0,0,0,
 14,4,3,0,12,6,0,7,115,101,116,109,101,116,97,0,
 13,5,6,0,15,6,3,0,12,8,0,6,111,98,106,101,
 99,116,0,0,13,7,8,0,31,4,6,2,19,4,5,4,
-16,4,0,89,44,6,0,0,30,6,0,142,9,9,9,100,
+16,4,0,89,44,6,0,0,30,6,0,150,9,9,9,100,
 101,102,32,95,95,105,110,105,116,95,95,40,115,101,108,102,
 41,58,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
 121,0,0,0,33,1,0,0,12,1,0,8,95,95,105,110,
 105,116,95,95,0,0,0,0,34,1,0,0,28,2,0,0,
-9,1,0,2,30,10,0,143,9,9,9,9,115,101,108,102,
+9,1,0,2,30,10,0,151,9,9,9,9,115,101,108,102,
 46,121,44,115,101,108,102,46,121,105,44,115,101,108,102,46,
 110,108,32,61,32,49,44,48,44,84,114,117,101,0,0,0,
-11,3,0,0,0,0,0,0,0,0,240,63,15,2,3,0,
-11,4,0,0,0,0,0,0,0,0,0,0,15,3,4,0,
-11,5,0,0,0,0,0,0,0,0,240,63,15,4,5,0,
+11,3,0,1,1,0,0,0,0,0,0,0,15,2,3,0,
+11,4,0,1,0,0,0,0,0,0,0,0,15,3,4,0,
+11,5,0,1,1,0,0,0,0,0,0,0,15,4,5,0,
 12,5,0,1,121,0,0,0,10,1,5,2,12,2,0,2,
 121,105,0,0,10,1,2,3,12,2,0,2,110,108,0,0,
-10,1,2,4,30,12,0,144,9,9,9,9,115,101,108,102,
+10,1,2,4,30,12,0,152,9,9,9,9,115,101,108,102,
 46,114,101,115,44,115,101,108,102,46,105,110,100,101,110,116,
 44,115,101,108,102,46,98,114,97,99,101,115,32,61,32,91,
 93,44,91,48,93,44,48,0,27,3,0,0,15,2,3,0,
-11,5,0,0,0,0,0,0,0,0,0,0,27,4,5,1,
-15,3,4,0,11,5,0,0,0,0,0,0,0,0,0,0,
+11,5,0,1,0,0,0,0,0,0,0,0,27,4,5,1,
+15,3,4,0,11,5,0,1,0,0,0,0,0,0,0,0,
 15,4,5,0,12,5,0,3,114,101,115,0,10,1,5,2,
 12,2,0,6,105,110,100,101,110,116,0,0,10,1,2,3,
 12,2,0,6,98,114,97,99,101,115,0,0,10,1,2,4,
 0,0,0,0,12,5,0,8,95,95,105,110,105,116,95,95,
-0,0,0,0,10,3,5,4,16,5,0,53,44,12,0,0,
-30,15,0,145,9,9,9,100,101,102,32,97,100,100,40,115,
+0,0,0,0,10,3,5,4,16,5,0,52,44,13,0,0,
+30,15,0,153,9,9,9,100,101,102,32,97,100,100,40,115,
 101,108,102,44,116,44,118,41,58,32,115,101,108,102,46,114,
 101,115,46,97,112,112,101,110,100,40,84,111,107,101,110,40,
 115,101,108,102,46,102,44,116,44,118,41,41,0,0,0,0,
 12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
 33,1,0,0,12,1,0,3,97,100,100,0,34,1,0,0,
 28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-28,4,0,0,9,3,0,4,12,6,0,3,114,101,115,0,
-9,5,1,6,12,6,0,6,97,112,112,101,110,100,0,0,
-9,5,5,6,12,8,0,5,84,111,107,101,110,0,0,0,
-13,7,8,0,12,11,0,1,102,0,0,0,9,8,1,11,
-15,9,2,0,15,10,3,0,31,6,8,3,19,6,7,6,
-31,4,6,1,19,4,5,4,0,0,0,0,12,6,0,3,
-97,100,100,0,10,3,6,5,30,8,0,147,9,9,115,101,
-108,102,46,84,44,105,44,108,32,61,32,84,68,97,116,97,
-40,41,44,48,44,108,101,110,40,115,41,0,12,8,0,5,
-84,68,97,116,97,0,0,0,13,7,8,0,31,6,0,0,
-19,6,7,6,15,3,6,0,11,7,0,0,0,0,0,0,
-0,0,0,0,15,6,7,0,12,10,0,3,108,101,110,0,
-13,9,10,0,15,10,2,0,31,8,10,1,19,8,9,8,
-15,7,8,0,12,8,0,1,84,0,0,0,10,1,8,3,
-15,3,6,0,15,6,7,0,30,2,0,148,9,9,116,114,
-121,58,32,0,38,0,0,24,30,9,0,149,9,9,9,114,
-101,116,117,114,110,32,115,101,108,102,46,100,111,95,116,111,
-107,101,110,105,122,101,40,115,44,105,44,108,41,0,0,0,
-12,9,0,11,100,111,95,116,111,107,101,110,105,122,101,0,
-9,8,1,9,15,9,2,0,15,10,3,0,15,11,6,0,
-31,7,9,3,19,7,8,7,20,7,0,0,38,0,0,0,
-18,0,0,36,30,13,0,151,9,9,9,114,97,105,115,101,
-69,114,114,111,114,40,39,84,111,107,101,110,105,122,101,114,
-46,100,111,84,111,107,101,110,105,122,101,39,44,115,44,115,
-101,108,102,46,84,46,102,41,0,0,0,0,12,9,0,10,
-114,97,105,115,101,69,114,114,111,114,0,0,13,8,9,0,
-12,9,0,20,84,111,107,101,110,105,122,101,114,46,100,111,
-84,111,107,101,110,105,122,101,0,0,0,0,15,10,2,0,
-12,12,0,1,84,0,0,0,9,11,1,12,12,12,0,1,
-102,0,0,0,9,11,11,12,31,7,9,3,19,7,8,7,
-0,0,0,0,12,12,0,10,100,111,84,111,107,101,110,105,
-122,101,0,0,10,7,12,11,16,12,2,69,44,12,0,0,
-30,8,0,154,9,100,101,102,32,100,111,95,116,111,107,101,
-110,105,122,101,40,115,101,108,102,44,115,44,105,44,108,41,
-58,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,11,100,111,95,116,
-111,107,101,110,105,122,101,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,28,4,0,0,
-9,3,0,4,28,5,0,0,9,4,0,5,30,10,0,155,
-9,9,115,101,108,102,46,84,46,102,32,61,32,40,115,101,
-108,102,46,84,46,121,44,105,45,115,101,108,102,46,84,46,
-121,105,43,49,41,0,0,0,12,6,0,1,84,0,0,0,
-9,5,1,6,12,9,0,1,84,0,0,0,9,7,1,9,
-12,9,0,1,121,0,0,0,9,7,7,9,12,10,0,1,
-84,0,0,0,9,9,1,10,12,10,0,2,121,105,0,0,
-9,9,9,10,2,8,3,9,11,9,0,0,0,0,0,0,
-0,0,240,63,1,8,8,9,27,6,7,2,12,7,0,1,
-102,0,0,0,10,5,7,6,30,4,0,156,9,9,119,104,
-105,108,101,32,105,32,60,32,108,58,0,0,25,5,3,4,
-21,5,0,0,18,0,1,213,30,13,0,157,9,9,9,99,
-32,61,32,115,91,105,93,59,32,115,101,108,102,46,84,46,
-102,32,61,32,40,115,101,108,102,46,84,46,121,44,105,45,
-115,101,108,102,46,84,46,121,105,43,49,41,0,0,0,0,
-9,6,2,3,15,5,6,0,12,7,0,1,84,0,0,0,
-9,6,1,7,12,10,0,1,84,0,0,0,9,8,1,10,
-12,10,0,1,121,0,0,0,9,8,8,10,12,11,0,1,
-84,0,0,0,9,10,1,11,12,11,0,2,121,105,0,0,
-9,10,10,11,2,9,3,10,11,10,0,0,0,0,0,0,
-0,0,240,63,1,9,9,10,27,7,8,2,12,8,0,1,
-102,0,0,0,10,6,8,7,30,16,0,158,9,9,9,105,
-102,32,115,101,108,102,46,84,46,110,108,58,32,115,101,108,
-102,46,84,46,110,108,32,61,32,70,97,108,115,101,59,32,
-105,32,61,32,115,101,108,102,46,100,111,95,105,110,100,101,
-110,116,40,115,44,105,44,108,41,0,0,0,12,7,0,1,
-84,0,0,0,9,6,1,7,12,7,0,2,110,108,0,0,
-9,6,6,7,21,6,0,0,18,0,0,22,12,7,0,1,
-84,0,0,0,9,6,1,7,11,7,0,0,0,0,0,0,
-0,0,0,0,12,8,0,2,110,108,0,0,10,6,8,7,
-12,8,0,9,100,111,95,105,110,100,101,110,116,0,0,0,
-9,7,1,8,15,8,2,0,15,9,3,0,15,10,4,0,
-31,6,8,3,19,6,7,6,15,3,6,0,18,0,1,126,
-30,11,0,159,9,9,9,101,108,105,102,32,99,32,61,61,
-32,39,92,110,39,58,32,105,32,61,32,115,101,108,102,46,
-100,111,95,110,108,40,115,44,105,44,108,41,0,0,0,0,
-12,7,0,1,10,0,0,0,23,6,5,7,21,6,0,0,
-18,0,0,12,12,8,0,5,100,111,95,110,108,0,0,0,
-9,7,1,8,15,8,2,0,15,9,3,0,15,10,4,0,
-31,6,8,3,19,6,7,6,15,3,6,0,18,0,1,98,
-30,14,0,160,9,9,9,101,108,105,102,32,99,32,105,110,
+28,4,0,0,9,3,0,4,12,9,0,3,114,101,115,0,
+9,8,1,9,12,9,0,6,97,112,112,101,110,100,0,0,
+49,5,8,9,12,9,0,5,84,111,107,101,110,0,0,0,
+13,8,9,0,12,12,0,1,102,0,0,0,9,9,1,12,
+15,10,2,0,15,11,3,0,31,7,9,3,19,7,8,7,
+50,4,5,1,0,0,0,0,12,6,0,3,97,100,100,0,
+10,3,6,5,30,8,0,155,9,9,115,101,108,102,46,84,
+44,105,44,108,32,61,32,84,68,97,116,97,40,41,44,48,
+44,108,101,110,40,115,41,0,12,8,0,5,84,68,97,116,
+97,0,0,0,13,7,8,0,31,6,0,0,19,6,7,6,
+15,3,6,0,11,7,0,1,0,0,0,0,0,0,0,0,
+15,6,7,0,12,10,0,3,108,101,110,0,13,9,10,0,
+15,10,2,0,31,8,10,1,19,8,9,8,15,7,8,0,
+12,8,0,1,84,0,0,0,10,1,8,3,15,3,6,0,
+15,6,7,0,30,2,0,156,9,9,116,114,121,58,32,0,
+38,0,0,23,30,9,0,157,9,9,9,114,101,116,117,114,
+110,32,115,101,108,102,46,100,111,95,116,111,107,101,110,105,
+122,101,40,115,44,105,44,108,41,0,0,0,12,13,0,11,
+100,111,95,116,111,107,101,110,105,122,101,0,49,8,1,13,
+15,10,2,0,15,11,3,0,15,12,6,0,50,7,8,3,
+20,7,0,0,38,0,0,0,18,0,0,36,30,13,0,159,
+9,9,9,114,97,105,115,101,69,114,114,111,114,40,39,84,
+111,107,101,110,105,122,101,114,46,100,111,84,111,107,101,110,
+105,122,101,39,44,115,44,115,101,108,102,46,84,46,102,41,
+0,0,0,0,12,9,0,10,114,97,105,115,101,69,114,114,
+111,114,0,0,13,8,9,0,12,9,0,20,84,111,107,101,
+110,105,122,101,114,46,100,111,84,111,107,101,110,105,122,101,
+0,0,0,0,15,10,2,0,12,12,0,1,84,0,0,0,
+9,11,1,12,12,12,0,1,102,0,0,0,9,11,11,12,
+31,7,9,3,19,7,8,7,0,0,0,0,12,13,0,10,
+100,111,84,111,107,101,110,105,122,101,0,0,10,8,13,12,
+16,13,2,61,44,13,0,0,30,8,0,162,9,100,101,102,
+32,100,111,95,116,111,107,101,110,105,122,101,40,115,101,108,
+102,44,115,44,105,44,108,41,58,0,0,0,12,1,0,9,
+116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
+12,1,0,11,100,111,95,116,111,107,101,110,105,122,101,0,
+34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
+9,2,0,3,28,4,0,0,9,3,0,4,28,5,0,0,
+9,4,0,5,30,10,0,163,9,9,115,101,108,102,46,84,
+46,102,32,61,32,40,115,101,108,102,46,84,46,121,44,105,
+45,115,101,108,102,46,84,46,121,105,43,49,41,0,0,0,
+12,6,0,1,84,0,0,0,9,5,1,6,12,9,0,1,
+84,0,0,0,9,7,1,9,12,9,0,1,121,0,0,0,
+9,7,7,9,12,10,0,1,84,0,0,0,9,9,1,10,
+12,10,0,2,121,105,0,0,9,9,9,10,2,8,3,9,
+11,9,0,1,1,0,0,0,0,0,0,0,1,8,8,9,
+27,6,7,2,12,7,0,1,102,0,0,0,10,5,7,6,
+30,4,0,164,9,9,119,104,105,108,101,32,105,32,60,32,
+108,58,0,0,25,5,3,4,21,5,0,0,18,0,1,206,
+30,13,0,165,9,9,9,99,32,61,32,115,91,105,93,59,
+32,115,101,108,102,46,84,46,102,32,61,32,40,115,101,108,
+102,46,84,46,121,44,105,45,115,101,108,102,46,84,46,121,
+105,43,49,41,0,0,0,0,9,6,2,3,15,5,6,0,
+12,7,0,1,84,0,0,0,9,6,1,7,12,10,0,1,
+84,0,0,0,9,8,1,10,12,10,0,1,121,0,0,0,
+9,8,8,10,12,11,0,1,84,0,0,0,9,10,1,11,
+12,11,0,2,121,105,0,0,9,10,10,11,2,9,3,10,
+11,10,0,1,1,0,0,0,0,0,0,0,1,9,9,10,
+27,7,8,2,12,8,0,1,102,0,0,0,10,6,8,7,
+30,16,0,166,9,9,9,105,102,32,115,101,108,102,46,84,
+46,110,108,58,32,115,101,108,102,46,84,46,110,108,32,61,
+32,70,97,108,115,101,59,32,105,32,61,32,115,101,108,102,
+46,100,111,95,105,110,100,101,110,116,40,115,44,105,44,108,
+41,0,0,0,12,7,0,1,84,0,0,0,9,6,1,7,
+12,7,0,2,110,108,0,0,9,6,6,7,21,6,0,0,
+18,0,0,21,12,7,0,1,84,0,0,0,9,6,1,7,
+11,7,0,1,0,0,0,0,0,0,0,0,12,8,0,2,
+110,108,0,0,10,6,8,7,12,12,0,9,100,111,95,105,
+110,100,101,110,116,0,0,0,49,7,1,12,15,9,2,0,
+15,10,3,0,15,11,4,0,50,6,7,3,15,3,6,0,
+18,0,1,120,30,11,0,167,9,9,9,101,108,105,102,32,
+99,32,61,61,32,39,92,110,39,58,32,105,32,61,32,115,
+101,108,102,46,100,111,95,110,108,40,115,44,105,44,108,41,
+0,0,0,0,12,7,0,1,10,0,0,0,23,6,5,7,
+21,6,0,0,18,0,0,11,12,12,0,5,100,111,95,110,
+108,0,0,0,49,7,1,12,15,9,2,0,15,10,3,0,
+15,11,4,0,50,6,7,3,15,3,6,0,18,0,1,93,
+30,14,0,168,9,9,9,101,108,105,102,32,99,32,105,110,
 32,115,101,108,102,46,73,83,89,77,66,79,76,83,58,32,
 105,32,61,32,115,101,108,102,46,100,111,95,115,121,109,98,
 111,108,40,115,44,105,44,108,41,0,0,0,12,7,0,8,
 73,83,89,77,66,79,76,83,0,0,0,0,9,6,1,7,
-36,6,6,5,21,6,0,0,18,0,0,13,12,8,0,9,
-100,111,95,115,121,109,98,111,108,0,0,0,9,7,1,8,
-15,8,2,0,15,9,3,0,15,10,4,0,31,6,8,3,
-19,6,7,6,15,3,6,0,18,0,1,63,30,15,0,161,
-9,9,9,101,108,105,102,32,99,32,62,61,32,39,48,39,
-32,97,110,100,32,99,32,60,61,32,39,57,39,58,32,105,
-32,61,32,115,101,108,102,46,100,111,95,110,117,109,98,101,
-114,40,115,44,105,44,108,41,0,0,0,0,12,6,0,1,
-48,0,0,0,24,6,6,5,21,6,0,0,18,0,0,4,
-12,7,0,1,57,0,0,0,24,6,5,7,21,6,0,0,
-18,0,0,13,12,8,0,9,100,111,95,110,117,109,98,101,
-114,0,0,0,9,7,1,8,15,8,2,0,15,9,3,0,
-15,10,4,0,31,6,8,3,19,6,7,6,15,3,6,0,
-18,0,1,25,30,17,0,163,9,9,9,9,40,99,32,62,
-61,32,39,65,39,32,97,110,100,32,99,32,60,61,32,39,
-90,39,41,32,111,114,32,99,32,61,61,32,39,95,39,58,
-32,32,105,32,61,32,115,101,108,102,46,100,111,95,110,97,
-109,101,40,115,44,105,44,108,41,0,0,0,30,10,0,162,
-9,9,9,101,108,105,102,32,40,99,32,62,61,32,39,97,
-39,32,97,110,100,32,99,32,60,61,32,39,122,39,41,32,
-111,114,32,92,0,0,0,0,12,6,0,1,97,0,0,0,
+36,6,6,5,21,6,0,0,18,0,0,12,12,12,0,9,
+100,111,95,115,121,109,98,111,108,0,0,0,49,7,1,12,
+15,9,2,0,15,10,3,0,15,11,4,0,50,6,7,3,
+15,3,6,0,18,0,1,59,30,15,0,169,9,9,9,101,
+108,105,102,32,99,32,62,61,32,39,48,39,32,97,110,100,
+32,99,32,60,61,32,39,57,39,58,32,105,32,61,32,115,
+101,108,102,46,100,111,95,110,117,109,98,101,114,40,115,44,
+105,44,108,41,0,0,0,0,12,6,0,1,48,0,0,0,
 24,6,6,5,21,6,0,0,18,0,0,4,12,7,0,1,
-122,0,0,0,24,6,5,7,46,6,0,0,18,0,0,27,
-30,17,0,163,9,9,9,9,40,99,32,62,61,32,39,65,
-39,32,97,110,100,32,99,32,60,61,32,39,90,39,41,32,
-111,114,32,99,32,61,61,32,39,95,39,58,32,32,105,32,
-61,32,115,101,108,102,46,100,111,95,110,97,109,101,40,115,
-44,105,44,108,41,0,0,0,12,6,0,1,65,0,0,0,
-24,6,6,5,21,6,0,0,18,0,0,4,12,7,0,1,
-90,0,0,0,24,6,5,7,46,6,0,0,18,0,0,4,
-12,7,0,1,95,0,0,0,23,6,5,7,21,6,0,0,
-18,0,0,12,12,8,0,7,100,111,95,110,97,109,101,0,
-9,7,1,8,15,8,2,0,15,9,3,0,15,10,4,0,
-31,6,8,3,19,6,7,6,15,3,6,0,18,0,0,198,
-30,13,0,164,9,9,9,101,108,105,102,32,99,61,61,39,
-34,39,32,111,114,32,99,61,61,34,39,34,58,32,105,32,
-61,32,115,101,108,102,46,100,111,95,115,116,114,105,110,103,
-40,115,44,105,44,108,41,0,12,7,0,1,34,0,0,0,
-23,6,5,7,46,6,0,0,18,0,0,4,12,7,0,1,
-39,0,0,0,23,6,5,7,21,6,0,0,18,0,0,13,
-12,8,0,9,100,111,95,115,116,114,105,110,103,0,0,0,
-9,7,1,8,15,8,2,0,15,9,3,0,15,10,4,0,
-31,6,8,3,19,6,7,6,15,3,6,0,18,0,0,162,
-30,11,0,165,9,9,9,101,108,105,102,32,99,61,61,39,
+57,0,0,0,24,6,5,7,21,6,0,0,18,0,0,12,
+12,12,0,9,100,111,95,110,117,109,98,101,114,0,0,0,
+49,7,1,12,15,9,2,0,15,10,3,0,15,11,4,0,
+50,6,7,3,15,3,6,0,18,0,1,22,30,17,0,171,
+9,9,9,9,40,99,32,62,61,32,39,65,39,32,97,110,
+100,32,99,32,60,61,32,39,90,39,41,32,111,114,32,99,
+32,61,61,32,39,95,39,58,32,32,105,32,61,32,115,101,
+108,102,46,100,111,95,110,97,109,101,40,115,44,105,44,108,
+41,0,0,0,30,10,0,170,9,9,9,101,108,105,102,32,
+40,99,32,62,61,32,39,97,39,32,97,110,100,32,99,32,
+60,61,32,39,122,39,41,32,111,114,32,92,0,0,0,0,
+12,6,0,1,97,0,0,0,24,6,6,5,21,6,0,0,
+18,0,0,4,12,7,0,1,122,0,0,0,24,6,5,7,
+46,6,0,0,18,0,0,27,30,17,0,171,9,9,9,9,
+40,99,32,62,61,32,39,65,39,32,97,110,100,32,99,32,
+60,61,32,39,90,39,41,32,111,114,32,99,32,61,61,32,
+39,95,39,58,32,32,105,32,61,32,115,101,108,102,46,100,
+111,95,110,97,109,101,40,115,44,105,44,108,41,0,0,0,
+12,6,0,1,65,0,0,0,24,6,6,5,21,6,0,0,
+18,0,0,4,12,7,0,1,90,0,0,0,24,6,5,7,
+46,6,0,0,18,0,0,4,12,7,0,1,95,0,0,0,
+23,6,5,7,21,6,0,0,18,0,0,11,12,12,0,7,
+100,111,95,110,97,109,101,0,49,7,1,12,15,9,2,0,
+15,10,3,0,15,11,4,0,50,6,7,3,15,3,6,0,
+18,0,0,196,30,13,0,172,9,9,9,101,108,105,102,32,
+99,61,61,39,34,39,32,111,114,32,99,61,61,34,39,34,
+58,32,105,32,61,32,115,101,108,102,46,100,111,95,115,116,
+114,105,110,103,40,115,44,105,44,108,41,0,12,7,0,1,
+34,0,0,0,23,6,5,7,46,6,0,0,18,0,0,4,
+12,7,0,1,39,0,0,0,23,6,5,7,21,6,0,0,
+18,0,0,12,12,12,0,9,100,111,95,115,116,114,105,110,
+103,0,0,0,49,7,1,12,15,9,2,0,15,10,3,0,
+15,11,4,0,50,6,7,3,15,3,6,0,18,0,0,161,
+30,11,0,173,9,9,9,101,108,105,102,32,99,61,61,39,
 35,39,58,32,105,32,61,32,115,101,108,102,46,100,111,95,
 99,111,109,109,101,110,116,40,115,44,105,44,108,41,0,0,
 12,7,0,1,35,0,0,0,23,6,5,7,21,6,0,0,
-18,0,0,13,12,8,0,10,100,111,95,99,111,109,109,101,
-110,116,0,0,9,7,1,8,15,8,2,0,15,9,3,0,
-15,10,4,0,31,6,8,3,19,6,7,6,15,3,6,0,
-18,0,0,133,30,10,0,166,9,9,9,101,108,105,102,32,
-99,32,61,61,32,39,92,92,39,32,97,110,100,32,115,91,
-105,43,49,93,32,61,61,32,39,92,110,39,58,0,0,0,
-12,7,0,1,92,0,0,0,23,6,5,7,21,6,0,0,
-18,0,0,9,11,8,0,0,0,0,0,0,0,0,240,63,
-1,7,3,8,9,6,2,7,12,7,0,1,10,0,0,0,
-23,6,6,7,21,6,0,0,18,0,0,44,30,12,0,167,
-9,9,9,9,105,32,43,61,32,50,59,32,115,101,108,102,
-46,84,46,121,44,115,101,108,102,46,84,46,121,105,32,61,
-32,115,101,108,102,46,84,46,121,43,49,44,105,0,0,0,
-11,7,0,0,0,0,0,0,0,0,0,64,1,6,3,7,
-15,3,6,0,12,8,0,1,84,0,0,0,9,7,1,8,
-12,8,0,1,121,0,0,0,9,7,7,8,11,8,0,0,
-0,0,0,0,0,0,240,63,1,7,7,8,15,6,7,0,
-15,7,3,0,12,9,0,1,84,0,0,0,9,8,1,9,
-12,9,0,1,121,0,0,0,10,8,9,6,12,8,0,1,
-84,0,0,0,9,6,1,8,12,8,0,2,121,105,0,0,
-10,6,8,7,18,0,0,64,30,10,0,168,9,9,9,101,
-108,105,102,32,99,32,61,61,32,39,32,39,32,111,114,32,
-99,32,61,61,32,39,92,116,39,58,32,105,32,43,61,32,
-49,0,0,0,12,7,0,1,32,0,0,0,23,6,5,7,
-46,6,0,0,18,0,0,4,12,7,0,1,9,0,0,0,
-23,6,5,7,21,6,0,0,18,0,0,7,11,7,0,0,
-0,0,0,0,0,0,240,63,1,6,3,7,15,3,6,0,
-18,0,0,37,30,13,0,170,9,9,9,9,114,97,105,115,
-101,69,114,114,111,114,40,39,84,111,107,101,110,105,122,101,
-114,46,100,111,95,116,111,107,101,110,105,122,101,39,44,115,
-44,115,101,108,102,46,84,46,102,41,0,0,12,8,0,10,
-114,97,105,115,101,69,114,114,111,114,0,0,13,7,8,0,
-12,8,0,21,84,111,107,101,110,105,122,101,114,46,100,111,
-95,116,111,107,101,110,105,122,101,0,0,0,15,9,2,0,
-12,11,0,1,84,0,0,0,9,10,1,11,12,11,0,1,
-102,0,0,0,9,10,10,11,31,6,8,3,19,6,7,6,
-18,0,0,1,18,0,254,42,30,5,0,171,9,9,115,101,
-108,102,46,105,110,100,101,110,116,40,48,41,0,0,0,0,
-12,8,0,6,105,110,100,101,110,116,0,0,9,7,1,8,
-11,8,0,0,0,0,0,0,0,0,0,0,31,6,8,1,
-19,6,7,6,30,8,0,172,9,9,114,32,61,32,115,101,
-108,102,46,84,46,114,101,115,59,32,115,101,108,102,46,84,
-32,61,32,78,111,110,101,0,12,8,0,1,84,0,0,0,
-9,7,1,8,12,8,0,3,114,101,115,0,9,7,7,8,
-15,6,7,0,28,7,0,0,12,8,0,1,84,0,0,0,
-10,1,8,7,30,3,0,175,9,9,114,101,116,117,114,110,
-32,114,0,0,20,6,0,0,0,0,0,0,12,13,0,11,
-100,111,95,116,111,107,101,110,105,122,101,0,10,7,13,12,
-16,13,0,127,44,9,0,0,30,6,0,178,9,100,101,102,
-32,100,111,95,110,108,40,115,101,108,102,44,115,44,105,44,
-108,41,58,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,5,100,111,95,110,
-108,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,3,0,0,9,2,0,3,28,4,0,0,9,3,0,4,
-28,5,0,0,9,4,0,5,30,6,0,179,9,9,105,102,
-32,110,111,116,32,115,101,108,102,46,84,46,98,114,97,99,
-101,115,58,0,12,7,0,1,84,0,0,0,9,6,1,7,
-12,7,0,6,98,114,97,99,101,115,0,0,9,6,6,7,
-47,5,6,0,21,5,0,0,18,0,0,21,30,7,0,180,
-9,9,9,115,101,108,102,46,84,46,97,100,100,40,39,110,
-108,39,44,78,111,110,101,41,0,0,0,0,12,7,0,1,
-84,0,0,0,9,6,1,7,12,7,0,3,97,100,100,0,
-9,6,6,7,12,7,0,2,110,108,0,0,28,8,0,0,
-31,5,7,2,19,5,6,5,18,0,0,1,30,7,0,181,
-9,9,105,44,115,101,108,102,46,84,46,110,108,32,61,32,
-105,43,49,44,84,114,117,101,0,0,0,0,11,7,0,0,
-0,0,0,0,0,0,240,63,1,6,3,7,15,5,6,0,
-11,7,0,0,0,0,0,0,0,0,240,63,15,6,7,0,
-15,3,5,0,12,7,0,1,84,0,0,0,9,5,1,7,
-12,7,0,2,110,108,0,0,10,5,7,6,30,9,0,182,
-9,9,115,101,108,102,46,84,46,121,44,115,101,108,102,46,
-84,46,121,105,32,61,32,115,101,108,102,46,84,46,121,43,
-49,44,105,0,12,7,0,1,84,0,0,0,9,6,1,7,
-12,7,0,1,121,0,0,0,9,6,6,7,11,7,0,0,
-0,0,0,0,0,0,240,63,1,6,6,7,15,5,6,0,
-15,6,3,0,12,8,0,1,84,0,0,0,9,7,1,8,
-12,8,0,1,121,0,0,0,10,7,8,5,12,7,0,1,
-84,0,0,0,9,5,1,7,12,7,0,2,121,105,0,0,
-10,5,7,6,30,3,0,183,9,9,114,101,116,117,114,110,
-32,105,0,0,20,3,0,0,0,0,0,0,12,14,0,5,
-100,111,95,110,108,0,0,0,10,7,14,13,16,14,0,142,
-44,11,0,0,30,7,0,186,9,100,101,102,32,100,111,95,
-105,110,100,101,110,116,40,115,101,108,102,44,115,44,105,44,
-108,41,58,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,9,100,111,95,105,
-110,100,101,110,116,0,0,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,28,4,0,0,
-9,3,0,4,28,5,0,0,9,4,0,5,30,2,0,187,
-9,9,118,32,61,32,48,0,11,6,0,0,0,0,0,0,
-0,0,0,0,15,5,6,0,30,4,0,188,9,9,119,104,
-105,108,101,32,105,60,108,58,0,0,0,0,25,6,3,4,
-21,6,0,0,18,0,0,48,30,3,0,189,9,9,9,99,
-32,61,32,115,91,105,93,0,9,7,2,3,15,6,7,0,
-30,9,0,190,9,9,9,105,102,32,99,32,33,61,32,39,
-32,39,32,97,110,100,32,99,32,33,61,32,39,92,116,39,
-58,32,98,114,101,97,107,0,12,8,0,1,32,0,0,0,
-35,7,6,8,21,7,0,0,18,0,0,4,12,8,0,1,
-9,0,0,0,35,7,6,8,21,7,0,0,18,0,0,3,
-18,0,0,21,18,0,0,1,30,5,0,191,9,9,9,105,
-44,118,32,61,32,105,43,49,44,118,43,49,0,0,0,0,
-11,9,0,0,0,0,0,0,0,0,240,63,1,8,3,9,
-15,7,8,0,11,10,0,0,0,0,0,0,0,0,240,63,
-1,9,5,10,15,8,9,0,15,3,7,0,15,5,8,0,
-18,0,255,207,30,17,0,192,9,9,105,102,32,99,32,33,
-61,32,39,92,110,39,32,97,110,100,32,99,32,33,61,32,
-39,35,39,32,97,110,100,32,110,111,116,32,115,101,108,102,
-46,84,46,98,114,97,99,101,115,58,32,115,101,108,102,46,
-105,110,100,101,110,116,40,118,41,0,0,0,12,8,0,1,
-10,0,0,0,35,7,6,8,21,7,0,0,18,0,0,4,
-12,8,0,1,35,0,0,0,35,7,6,8,21,7,0,0,
-18,0,0,9,12,9,0,1,84,0,0,0,9,8,1,9,
-12,9,0,6,98,114,97,99,101,115,0,0,9,8,8,9,
-47,7,8,0,21,7,0,0,18,0,0,9,12,9,0,6,
-105,110,100,101,110,116,0,0,9,8,1,9,15,9,5,0,
-31,7,9,1,19,7,8,7,18,0,0,1,30,3,0,193,
+18,0,0,12,12,12,0,10,100,111,95,99,111,109,109,101,
+110,116,0,0,49,7,1,12,15,9,2,0,15,10,3,0,
+15,11,4,0,50,6,7,3,15,3,6,0,18,0,0,133,
+30,10,0,174,9,9,9,101,108,105,102,32,99,32,61,61,
+32,39,92,92,39,32,97,110,100,32,115,91,105,43,49,93,
+32,61,61,32,39,92,110,39,58,0,0,0,12,7,0,1,
+92,0,0,0,23,6,5,7,21,6,0,0,18,0,0,9,
+11,8,0,1,1,0,0,0,0,0,0,0,1,7,3,8,
+9,6,2,7,12,7,0,1,10,0,0,0,23,6,6,7,
+21,6,0,0,18,0,0,44,30,12,0,175,9,9,9,9,
+105,32,43,61,32,50,59,32,115,101,108,102,46,84,46,121,
+44,115,101,108,102,46,84,46,121,105,32,61,32,115,101,108,
+102,46,84,46,121,43,49,44,105,0,0,0,11,7,0,1,
+2,0,0,0,0,0,0,0,1,6,3,7,15,3,6,0,
+12,8,0,1,84,0,0,0,9,7,1,8,12,8,0,1,
+121,0,0,0,9,7,7,8,11,8,0,1,1,0,0,0,
+0,0,0,0,1,7,7,8,15,6,7,0,15,7,3,0,
+12,9,0,1,84,0,0,0,9,8,1,9,12,9,0,1,
+121,0,0,0,10,8,9,6,12,8,0,1,84,0,0,0,
+9,6,1,8,12,8,0,2,121,105,0,0,10,6,8,7,
+18,0,0,64,30,10,0,176,9,9,9,101,108,105,102,32,
+99,32,61,61,32,39,32,39,32,111,114,32,99,32,61,61,
+32,39,92,116,39,58,32,105,32,43,61,32,49,0,0,0,
+12,7,0,1,32,0,0,0,23,6,5,7,46,6,0,0,
+18,0,0,4,12,7,0,1,9,0,0,0,23,6,5,7,
+21,6,0,0,18,0,0,7,11,7,0,1,1,0,0,0,
+0,0,0,0,1,6,3,7,15,3,6,0,18,0,0,37,
+30,13,0,178,9,9,9,9,114,97,105,115,101,69,114,114,
+111,114,40,39,84,111,107,101,110,105,122,101,114,46,100,111,
+95,116,111,107,101,110,105,122,101,39,44,115,44,115,101,108,
+102,46,84,46,102,41,0,0,12,8,0,10,114,97,105,115,
+101,69,114,114,111,114,0,0,13,7,8,0,12,8,0,21,
+84,111,107,101,110,105,122,101,114,46,100,111,95,116,111,107,
+101,110,105,122,101,0,0,0,15,9,2,0,12,11,0,1,
+84,0,0,0,9,10,1,11,12,11,0,1,102,0,0,0,
+9,10,10,11,31,6,8,3,19,6,7,6,18,0,0,1,
+18,0,254,49,30,5,0,179,9,9,115,101,108,102,46,105,
+110,100,101,110,116,40,48,41,0,0,0,0,12,10,0,6,
+105,110,100,101,110,116,0,0,49,7,1,10,11,9,0,1,
+0,0,0,0,0,0,0,0,50,6,7,1,30,8,0,180,
+9,9,114,32,61,32,115,101,108,102,46,84,46,114,101,115,
+59,32,115,101,108,102,46,84,32,61,32,78,111,110,101,0,
+12,8,0,1,84,0,0,0,9,7,1,8,12,8,0,3,
+114,101,115,0,9,7,7,8,15,6,7,0,28,7,0,0,
+12,8,0,1,84,0,0,0,10,1,8,7,30,3,0,183,
+9,9,114,101,116,117,114,110,32,114,0,0,20,6,0,0,
+0,0,0,0,12,14,0,11,100,111,95,116,111,107,101,110,
+105,122,101,0,10,8,14,13,16,14,0,126,44,12,0,0,
+30,6,0,186,9,100,101,102,32,100,111,95,110,108,40,115,
+101,108,102,44,115,44,105,44,108,41,58,0,12,1,0,9,
+116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
+12,1,0,5,100,111,95,110,108,0,0,0,34,1,0,0,
+28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
+28,4,0,0,9,3,0,4,28,5,0,0,9,4,0,5,
+30,6,0,187,9,9,105,102,32,110,111,116,32,115,101,108,
+102,46,84,46,98,114,97,99,101,115,58,0,12,7,0,1,
+84,0,0,0,9,6,1,7,12,7,0,6,98,114,97,99,
+101,115,0,0,9,6,6,7,47,5,6,0,21,5,0,0,
+18,0,0,20,30,7,0,188,9,9,9,115,101,108,102,46,
+84,46,97,100,100,40,39,110,108,39,44,78,111,110,101,41,
+0,0,0,0,12,11,0,1,84,0,0,0,9,10,1,11,
+12,11,0,3,97,100,100,0,49,6,10,11,12,8,0,2,
+110,108,0,0,28,9,0,0,50,5,6,2,18,0,0,1,
+30,7,0,189,9,9,105,44,115,101,108,102,46,84,46,110,
+108,32,61,32,105,43,49,44,84,114,117,101,0,0,0,0,
+11,7,0,1,1,0,0,0,0,0,0,0,1,6,3,7,
+15,5,6,0,11,7,0,1,1,0,0,0,0,0,0,0,
+15,6,7,0,15,3,5,0,12,7,0,1,84,0,0,0,
+9,5,1,7,12,7,0,2,110,108,0,0,10,5,7,6,
+30,9,0,190,9,9,115,101,108,102,46,84,46,121,44,115,
+101,108,102,46,84,46,121,105,32,61,32,115,101,108,102,46,
+84,46,121,43,49,44,105,0,12,7,0,1,84,0,0,0,
+9,6,1,7,12,7,0,1,121,0,0,0,9,6,6,7,
+11,7,0,1,1,0,0,0,0,0,0,0,1,6,6,7,
+15,5,6,0,15,6,3,0,12,8,0,1,84,0,0,0,
+9,7,1,8,12,8,0,1,121,0,0,0,10,7,8,5,
+12,7,0,1,84,0,0,0,9,5,1,7,12,7,0,2,
+121,105,0,0,10,5,7,6,30,3,0,191,9,9,114,101,
+116,117,114,110,32,105,0,0,20,3,0,0,0,0,0,0,
+12,15,0,5,100,111,95,110,108,0,0,0,10,8,15,14,
+16,15,0,141,44,12,0,0,30,7,0,194,9,100,101,102,
+32,100,111,95,105,110,100,101,110,116,40,115,101,108,102,44,
+115,44,105,44,108,41,58,0,12,1,0,9,116,105,110,121,
+112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,9,
+100,111,95,105,110,100,101,110,116,0,0,0,34,1,0,0,
+28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
+28,4,0,0,9,3,0,4,28,5,0,0,9,4,0,5,
+30,2,0,195,9,9,118,32,61,32,48,0,11,6,0,1,
+0,0,0,0,0,0,0,0,15,5,6,0,30,4,0,196,
+9,9,119,104,105,108,101,32,105,60,108,58,0,0,0,0,
+25,6,3,4,21,6,0,0,18,0,0,48,30,3,0,197,
+9,9,9,99,32,61,32,115,91,105,93,0,9,7,2,3,
+15,6,7,0,30,9,0,198,9,9,9,105,102,32,99,32,
+33,61,32,39,32,39,32,97,110,100,32,99,32,33,61,32,
+39,92,116,39,58,32,98,114,101,97,107,0,12,8,0,1,
+32,0,0,0,35,7,6,8,21,7,0,0,18,0,0,4,
+12,8,0,1,9,0,0,0,35,7,6,8,21,7,0,0,
+18,0,0,3,18,0,0,21,18,0,0,1,30,5,0,199,
+9,9,9,105,44,118,32,61,32,105,43,49,44,118,43,49,
+0,0,0,0,11,9,0,1,1,0,0,0,0,0,0,0,
+1,8,3,9,15,7,8,0,11,10,0,1,1,0,0,0,
+0,0,0,0,1,9,5,10,15,8,9,0,15,3,7,0,
+15,5,8,0,18,0,255,207,30,17,0,200,9,9,105,102,
+32,99,32,33,61,32,39,92,110,39,32,97,110,100,32,99,
+32,33,61,32,39,35,39,32,97,110,100,32,110,111,116,32,
+115,101,108,102,46,84,46,98,114,97,99,101,115,58,32,115,
+101,108,102,46,105,110,100,101,110,116,40,118,41,0,0,0,
+12,8,0,1,10,0,0,0,35,7,6,8,21,7,0,0,
+18,0,0,4,12,8,0,1,35,0,0,0,35,7,6,8,
+21,7,0,0,18,0,0,9,12,9,0,1,84,0,0,0,
+9,8,1,9,12,9,0,6,98,114,97,99,101,115,0,0,
+9,8,8,9,47,7,8,0,21,7,0,0,18,0,0,8,
+12,11,0,6,105,110,100,101,110,116,0,0,49,8,1,11,
+15,10,5,0,50,7,8,1,18,0,0,1,30,3,0,201,
 9,9,114,101,116,117,114,110,32,105,0,0,20,3,0,0,
-0,0,0,0,12,15,0,9,100,111,95,105,110,100,101,110,
-116,0,0,0,10,7,15,14,16,15,0,234,44,9,0,0,
-30,6,0,196,9,100,101,102,32,105,110,100,101,110,116,40,
+0,0,0,0,12,16,0,9,100,111,95,105,110,100,101,110,
+116,0,0,0,10,8,16,15,16,16,0,229,44,11,0,0,
+30,6,0,204,9,100,101,102,32,105,110,100,101,110,116,40,
 115,101,108,102,44,118,41,58,0,0,0,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
 12,1,0,6,105,110,100,101,110,116,0,0,34,1,0,0,
 28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-30,9,0,197,9,9,105,102,32,118,32,61,61,32,115,101,
+30,9,0,205,9,9,105,102,32,118,32,61,61,32,115,101,
 108,102,46,84,46,105,110,100,101,110,116,91,45,49,93,58,
 32,112,97,115,115,0,0,0,12,5,0,1,84,0,0,0,
 9,4,1,5,12,5,0,6,105,110,100,101,110,116,0,0,
 9,4,4,5,11,5,0,0,0,0,0,0,0,0,240,191,
 9,4,4,5,23,3,2,4,21,3,0,0,18,0,0,3,
-17,0,0,0,18,0,0,186,30,8,0,198,9,9,101,108,
+17,0,0,0,18,0,0,181,30,8,0,206,9,9,101,108,
 105,102,32,118,32,62,32,115,101,108,102,46,84,46,105,110,
 100,101,110,116,91,45,49,93,58,0,0,0,12,4,0,1,
 84,0,0,0,9,3,1,4,12,4,0,6,105,110,100,101,
 110,116,0,0,9,3,3,4,11,4,0,0,0,0,0,0,
 0,0,240,191,9,3,3,4,25,3,3,2,21,3,0,0,
-18,0,0,44,30,7,0,199,9,9,9,115,101,108,102,46,
+18,0,0,42,30,7,0,207,9,9,9,115,101,108,102,46,
 84,46,105,110,100,101,110,116,46,97,112,112,101,110,100,40,
-118,41,0,0,12,5,0,1,84,0,0,0,9,4,1,5,
-12,5,0,6,105,110,100,101,110,116,0,0,9,4,4,5,
-12,5,0,6,97,112,112,101,110,100,0,0,9,4,4,5,
-15,5,2,0,31,3,5,1,19,3,4,3,30,7,0,200,
-9,9,9,115,101,108,102,46,84,46,97,100,100,40,39,105,
-110,100,101,110,116,39,44,118,41,0,0,0,12,5,0,1,
-84,0,0,0,9,4,1,5,12,5,0,3,97,100,100,0,
-9,4,4,5,12,5,0,6,105,110,100,101,110,116,0,0,
-15,6,2,0,31,3,5,2,19,3,4,3,18,0,0,120,
-30,8,0,201,9,9,101,108,105,102,32,118,32,60,32,115,
-101,108,102,46,84,46,105,110,100,101,110,116,91,45,49,93,
-58,0,0,0,12,5,0,1,84,0,0,0,9,4,1,5,
-12,5,0,6,105,110,100,101,110,116,0,0,9,4,4,5,
-11,5,0,0,0,0,0,0,0,0,240,191,9,4,4,5,
-25,3,2,4,21,3,0,0,18,0,0,97,30,8,0,202,
-9,9,9,110,32,61,32,115,101,108,102,46,84,46,105,110,
-100,101,110,116,46,105,110,100,101,120,40,118,41,0,0,0,
-12,6,0,1,84,0,0,0,9,5,1,6,12,6,0,6,
-105,110,100,101,110,116,0,0,9,5,5,6,12,6,0,5,
-105,110,100,101,120,0,0,0,9,5,5,6,15,6,2,0,
-31,4,6,1,19,4,5,4,15,3,4,0,30,9,0,203,
-9,9,9,119,104,105,108,101,32,108,101,110,40,115,101,108,
-102,46,84,46,105,110,100,101,110,116,41,32,62,32,110,43,
-49,58,0,0,11,5,0,0,0,0,0,0,0,0,240,63,
-1,4,3,5,12,7,0,3,108,101,110,0,13,6,7,0,
-12,8,0,1,84,0,0,0,9,7,1,8,12,8,0,6,
-105,110,100,101,110,116,0,0,9,7,7,8,31,5,7,1,
-19,5,6,5,25,4,4,5,21,4,0,0,18,0,0,43,
-30,7,0,204,9,9,9,9,118,32,61,32,115,101,108,102,
-46,84,46,105,110,100,101,110,116,46,112,111,112,40,41,0,
-12,6,0,1,84,0,0,0,9,5,1,6,12,6,0,6,
-105,110,100,101,110,116,0,0,9,5,5,6,12,6,0,3,
-112,111,112,0,9,5,5,6,31,4,0,0,19,4,5,4,
-15,2,4,0,30,7,0,205,9,9,9,9,115,101,108,102,
+118,41,0,0,12,8,0,1,84,0,0,0,9,7,1,8,
+12,8,0,6,105,110,100,101,110,116,0,0,9,7,7,8,
+12,8,0,6,97,112,112,101,110,100,0,0,49,4,7,8,
+15,6,2,0,50,3,4,1,30,7,0,208,9,9,9,115,
+101,108,102,46,84,46,97,100,100,40,39,105,110,100,101,110,
+116,39,44,118,41,0,0,0,12,9,0,1,84,0,0,0,
+9,8,1,9,12,9,0,3,97,100,100,0,49,4,8,9,
+12,6,0,6,105,110,100,101,110,116,0,0,15,7,2,0,
+50,3,4,2,18,0,0,117,30,8,0,209,9,9,101,108,
+105,102,32,118,32,60,32,115,101,108,102,46,84,46,105,110,
+100,101,110,116,91,45,49,93,58,0,0,0,12,5,0,1,
+84,0,0,0,9,4,1,5,12,5,0,6,105,110,100,101,
+110,116,0,0,9,4,4,5,11,5,0,0,0,0,0,0,
+0,0,240,191,9,4,4,5,25,3,2,4,21,3,0,0,
+18,0,0,94,30,8,0,210,9,9,9,110,32,61,32,115,
+101,108,102,46,84,46,105,110,100,101,110,116,46,105,110,100,
+101,120,40,118,41,0,0,0,12,9,0,1,84,0,0,0,
+9,8,1,9,12,9,0,6,105,110,100,101,110,116,0,0,
+9,8,8,9,12,9,0,5,105,110,100,101,120,0,0,0,
+49,5,8,9,15,7,2,0,50,4,5,1,15,3,4,0,
+30,9,0,211,9,9,9,119,104,105,108,101,32,108,101,110,
+40,115,101,108,102,46,84,46,105,110,100,101,110,116,41,32,
+62,32,110,43,49,58,0,0,11,5,0,1,1,0,0,0,
+0,0,0,0,1,4,3,5,12,7,0,3,108,101,110,0,
+13,6,7,0,12,8,0,1,84,0,0,0,9,7,1,8,
+12,8,0,6,105,110,100,101,110,116,0,0,9,7,7,8,
+31,5,7,1,19,5,6,5,25,4,4,5,21,4,0,0,
+18,0,0,41,30,7,0,212,9,9,9,9,118,32,61,32,
+115,101,108,102,46,84,46,105,110,100,101,110,116,46,112,111,
+112,40,41,0,12,8,0,1,84,0,0,0,9,7,1,8,
+12,8,0,6,105,110,100,101,110,116,0,0,9,7,7,8,
+12,8,0,3,112,111,112,0,49,5,7,8,50,4,5,0,
+15,2,4,0,30,7,0,213,9,9,9,9,115,101,108,102,
 46,84,46,97,100,100,40,39,100,101,100,101,110,116,39,44,
-118,41,0,0,12,6,0,1,84,0,0,0,9,5,1,6,
-12,6,0,3,97,100,100,0,9,5,5,6,12,6,0,6,
-100,101,100,101,110,116,0,0,15,7,2,0,31,4,6,2,
-19,4,5,4,18,0,255,196,18,0,0,1,0,0,0,0,
-12,16,0,6,105,110,100,101,110,116,0,0,10,7,16,15,
-16,16,1,37,44,14,0,0,30,7,0,208,9,100,101,102,
-32,100,111,95,115,121,109,98,111,108,40,115,101,108,102,44,
-115,44,105,44,108,41,58,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,9,
-100,111,95,115,121,109,98,111,108,0,0,0,34,1,0,0,
-28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-28,4,0,0,9,3,0,4,28,5,0,0,9,4,0,5,
-30,4,0,209,9,9,115,121,109,98,111,108,115,32,61,32,
-91,93,0,0,27,6,0,0,15,5,6,0,30,6,0,210,
-9,9,118,44,102,44,105,32,61,32,115,91,105,93,44,105,
-44,105,43,49,0,0,0,0,9,7,2,3,15,6,7,0,
-15,7,3,0,11,10,0,0,0,0,0,0,0,0,240,63,
-1,9,3,10,15,8,9,0,15,9,6,0,15,6,7,0,
-15,3,8,0,30,11,0,211,9,9,105,102,32,118,32,105,
-110,32,115,101,108,102,46,83,89,77,66,79,76,83,58,32,
-115,121,109,98,111,108,115,46,97,112,112,101,110,100,40,118,
-41,0,0,0,12,8,0,7,83,89,77,66,79,76,83,0,
-9,7,1,8,36,7,7,9,21,7,0,0,18,0,0,9,
-12,10,0,6,97,112,112,101,110,100,0,0,9,8,5,10,
-15,10,9,0,31,7,10,1,19,7,8,7,18,0,0,1,
-30,4,0,212,9,9,119,104,105,108,101,32,105,60,108,58,
-0,0,0,0,25,7,3,4,21,7,0,0,18,0,0,71,
-30,3,0,213,9,9,9,99,32,61,32,115,91,105,93,0,
-9,8,2,3,15,7,8,0,30,9,0,214,9,9,9,105,
-102,32,110,111,116,32,99,32,105,110,32,115,101,108,102,46,
-73,83,89,77,66,79,76,83,58,32,98,114,101,97,107,0,
-12,11,0,8,73,83,89,77,66,79,76,83,0,0,0,0,
-9,10,1,11,36,10,10,7,47,8,10,0,21,8,0,0,
-18,0,0,3,18,0,0,45,18,0,0,1,30,5,0,215,
-9,9,9,118,44,105,32,61,32,118,43,99,44,105,43,49,
-0,0,0,0,1,10,9,7,15,8,10,0,11,12,0,0,
-0,0,0,0,0,0,240,63,1,11,3,12,15,10,11,0,
-15,9,8,0,15,3,10,0,30,11,0,216,9,9,9,105,
-102,32,118,32,105,110,32,115,101,108,102,46,83,89,77,66,
-79,76,83,58,32,115,121,109,98,111,108,115,46,97,112,112,
-101,110,100,40,118,41,0,0,12,10,0,7,83,89,77,66,
-79,76,83,0,9,8,1,10,36,8,8,9,21,8,0,0,
-18,0,0,9,12,11,0,6,97,112,112,101,110,100,0,0,
-9,10,5,11,15,11,9,0,31,8,11,1,19,8,10,8,
-18,0,0,1,18,0,255,184,30,11,0,217,9,9,118,32,
-61,32,115,121,109,98,111,108,115,46,112,111,112,40,41,59,
-32,110,32,61,32,108,101,110,40,118,41,59,32,105,32,61,
-32,102,43,110,0,0,0,0,12,11,0,3,112,111,112,0,
-9,10,5,11,31,8,0,0,19,8,10,8,15,9,8,0,
+118,41,0,0,12,10,0,1,84,0,0,0,9,9,1,10,
+12,10,0,3,97,100,100,0,49,5,9,10,12,7,0,6,
+100,101,100,101,110,116,0,0,15,8,2,0,50,4,5,2,
+18,0,255,198,18,0,0,1,0,0,0,0,12,17,0,6,
+105,110,100,101,110,116,0,0,10,8,17,16,16,17,1,33,
+44,17,0,0,30,7,0,216,9,100,101,102,32,100,111,95,
+115,121,109,98,111,108,40,115,101,108,102,44,115,44,105,44,
+108,41,58,0,12,1,0,9,116,105,110,121,112,121,46,112,
+121,0,0,0,33,1,0,0,12,1,0,9,100,111,95,115,
+121,109,98,111,108,0,0,0,34,1,0,0,28,2,0,0,
+9,1,0,2,28,3,0,0,9,2,0,3,28,4,0,0,
+9,3,0,4,28,5,0,0,9,4,0,5,30,4,0,217,
+9,9,115,121,109,98,111,108,115,32,61,32,91,93,0,0,
+27,6,0,0,15,5,6,0,30,6,0,218,9,9,118,44,
+102,44,105,32,61,32,115,91,105,93,44,105,44,105,43,49,
+0,0,0,0,9,7,2,3,15,6,7,0,15,7,3,0,
+11,10,0,1,1,0,0,0,0,0,0,0,1,9,3,10,
+15,8,9,0,15,9,6,0,15,6,7,0,15,3,8,0,
+30,11,0,219,9,9,105,102,32,118,32,105,110,32,115,101,
+108,102,46,83,89,77,66,79,76,83,58,32,115,121,109,98,
+111,108,115,46,97,112,112,101,110,100,40,118,41,0,0,0,
+12,8,0,7,83,89,77,66,79,76,83,0,9,7,1,8,
+36,7,7,9,21,7,0,0,18,0,0,8,12,8,0,6,
+97,112,112,101,110,100,0,0,49,10,5,8,15,12,9,0,
+50,7,10,1,18,0,0,1,30,4,0,220,9,9,119,104,
+105,108,101,32,105,60,108,58,0,0,0,0,25,7,3,4,
+21,7,0,0,18,0,0,70,30,3,0,221,9,9,9,99,
+32,61,32,115,91,105,93,0,9,8,2,3,15,7,8,0,
+30,9,0,222,9,9,9,105,102,32,110,111,116,32,99,32,
+105,110,32,115,101,108,102,46,73,83,89,77,66,79,76,83,
+58,32,98,114,101,97,107,0,12,11,0,8,73,83,89,77,
+66,79,76,83,0,0,0,0,9,10,1,11,36,10,10,7,
+47,8,10,0,21,8,0,0,18,0,0,3,18,0,0,44,
+18,0,0,1,30,5,0,223,9,9,9,118,44,105,32,61,
+32,118,43,99,44,105,43,49,0,0,0,0,1,10,9,7,
+15,8,10,0,11,12,0,1,1,0,0,0,0,0,0,0,
+1,11,3,12,15,10,11,0,15,9,8,0,15,3,10,0,
+30,11,0,224,9,9,9,105,102,32,118,32,105,110,32,115,
+101,108,102,46,83,89,77,66,79,76,83,58,32,115,121,109,
+98,111,108,115,46,97,112,112,101,110,100,40,118,41,0,0,
+12,10,0,7,83,89,77,66,79,76,83,0,9,8,1,10,
+36,8,8,9,21,8,0,0,18,0,0,8,12,13,0,6,
+97,112,112,101,110,100,0,0,49,10,5,13,15,12,9,0,
+50,8,10,1,18,0,0,1,18,0,255,185,30,11,0,225,
+9,9,118,32,61,32,115,121,109,98,111,108,115,46,112,111,
+112,40,41,59,32,110,32,61,32,108,101,110,40,118,41,59,
+32,105,32,61,32,102,43,110,0,0,0,0,12,12,0,3,
+112,111,112,0,49,10,5,12,50,8,10,0,15,9,8,0,
 12,12,0,3,108,101,110,0,13,11,12,0,15,12,9,0,
 31,10,12,1,19,10,11,10,15,8,10,0,1,10,6,8,
-15,3,10,0,30,7,0,218,9,9,115,101,108,102,46,84,
+15,3,10,0,30,7,0,226,9,9,115,101,108,102,46,84,
 46,97,100,100,40,39,115,121,109,98,111,108,39,44,118,41,
-0,0,0,0,12,12,0,1,84,0,0,0,9,11,1,12,
-12,12,0,3,97,100,100,0,9,11,11,12,12,12,0,6,
-115,121,109,98,111,108,0,0,15,13,9,0,31,10,12,2,
-19,10,11,10,30,11,0,219,9,9,105,102,32,118,32,105,
-110,32,91,39,91,39,44,39,40,39,44,39,123,39,93,58,
-32,115,101,108,102,46,84,46,98,114,97,99,101,115,32,43,
-61,32,49,0,12,11,0,1,91,0,0,0,12,12,0,1,
-40,0,0,0,12,13,0,1,123,0,0,0,27,10,11,3,
+0,0,0,0,12,16,0,1,84,0,0,0,9,15,1,16,
+12,16,0,3,97,100,100,0,49,11,15,16,12,13,0,6,
+115,121,109,98,111,108,0,0,15,14,9,0,50,10,11,2,
+30,11,0,227,9,9,105,102,32,118,32,105,110,32,91,39,
+91,39,44,39,40,39,44,39,123,39,93,58,32,115,101,108,
+102,46,84,46,98,114,97,99,101,115,32,43,61,32,49,0,
+12,11,0,1,91,0,0,0,12,12,0,1,40,0,0,0,
+12,13,0,1,123,0,0,0,27,10,11,3,36,10,10,9,
+21,10,0,0,18,0,0,20,12,11,0,1,84,0,0,0,
+9,10,1,11,12,12,0,1,84,0,0,0,9,11,1,12,
+12,12,0,6,98,114,97,99,101,115,0,0,9,11,11,12,
+11,12,0,1,1,0,0,0,0,0,0,0,1,11,11,12,
+12,12,0,6,98,114,97,99,101,115,0,0,10,10,12,11,
+18,0,0,1,30,11,0,228,9,9,105,102,32,118,32,105,
+110,32,91,39,93,39,44,39,41,39,44,39,125,39,93,58,
+32,115,101,108,102,46,84,46,98,114,97,99,101,115,32,45,
+61,32,49,0,12,11,0,1,93,0,0,0,12,12,0,1,
+41,0,0,0,12,13,0,1,125,0,0,0,27,10,11,3,
 36,10,10,9,21,10,0,0,18,0,0,20,12,11,0,1,
 84,0,0,0,9,10,1,11,12,12,0,1,84,0,0,0,
 9,11,1,12,12,12,0,6,98,114,97,99,101,115,0,0,
-9,11,11,12,11,12,0,0,0,0,0,0,0,0,240,63,
-1,11,11,12,12,12,0,6,98,114,97,99,101,115,0,0,
-10,10,12,11,18,0,0,1,30,11,0,220,9,9,105,102,
-32,118,32,105,110,32,91,39,93,39,44,39,41,39,44,39,
-125,39,93,58,32,115,101,108,102,46,84,46,98,114,97,99,
-101,115,32,45,61,32,49,0,12,11,0,1,93,0,0,0,
-12,12,0,1,41,0,0,0,12,13,0,1,125,0,0,0,
-27,10,11,3,36,10,10,9,21,10,0,0,18,0,0,20,
-12,11,0,1,84,0,0,0,9,10,1,11,12,12,0,1,
-84,0,0,0,9,11,1,12,12,12,0,6,98,114,97,99,
-101,115,0,0,9,11,11,12,11,12,0,0,0,0,0,0,
-0,0,240,63,2,11,11,12,12,12,0,6,98,114,97,99,
-101,115,0,0,10,10,12,11,18,0,0,1,30,3,0,221,
-9,9,114,101,116,117,114,110,32,105,0,0,20,3,0,0,
-0,0,0,0,12,17,0,9,100,111,95,115,121,109,98,111,
-108,0,0,0,10,7,17,16,16,17,0,228,44,11,0,0,
-30,7,0,224,9,100,101,102,32,100,111,95,110,117,109,98,
-101,114,40,115,101,108,102,44,115,44,105,44,108,41,58,0,
-12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
-33,1,0,0,12,1,0,9,100,111,95,110,117,109,98,101,
-114,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,3,0,0,9,2,0,3,28,4,0,0,9,3,0,4,
-28,5,0,0,9,4,0,5,30,6,0,225,9,9,118,44,
-105,44,99,32,61,115,91,105,93,44,105,43,49,44,115,91,
-105,93,0,0,9,6,2,3,15,5,6,0,11,8,0,0,
-0,0,0,0,0,0,240,63,1,7,3,8,15,6,7,0,
-9,8,2,3,15,7,8,0,15,8,5,0,15,3,6,0,
-15,5,7,0,30,4,0,226,9,9,119,104,105,108,101,32,
-105,60,108,58,0,0,0,0,25,6,3,4,21,6,0,0,
-18,0,0,69,30,3,0,227,9,9,9,99,32,61,32,115,
-91,105,93,0,9,6,2,3,15,5,6,0,30,18,0,228,
-9,9,9,105,102,32,40,99,32,60,32,39,48,39,32,111,
-114,32,99,32,62,32,39,57,39,41,32,97,110,100,32,40,
-99,32,60,32,39,97,39,32,111,114,32,99,32,62,32,39,
-102,39,41,32,97,110,100,32,99,32,33,61,32,39,120,39,
-58,32,98,114,101,97,107,0,12,7,0,1,48,0,0,0,
+9,11,11,12,11,12,0,1,1,0,0,0,0,0,0,0,
+2,11,11,12,12,12,0,6,98,114,97,99,101,115,0,0,
+10,10,12,11,18,0,0,1,30,3,0,229,9,9,114,101,
+116,117,114,110,32,105,0,0,20,3,0,0,0,0,0,0,
+12,18,0,9,100,111,95,115,121,109,98,111,108,0,0,0,
+10,8,18,17,16,18,0,227,44,14,0,0,30,7,0,232,
+9,100,101,102,32,100,111,95,110,117,109,98,101,114,40,115,
+101,108,102,44,115,44,105,44,108,41,58,0,12,1,0,9,
+116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
+12,1,0,9,100,111,95,110,117,109,98,101,114,0,0,0,
+34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
+9,2,0,3,28,4,0,0,9,3,0,4,28,5,0,0,
+9,4,0,5,30,6,0,233,9,9,118,44,105,44,99,32,
+61,115,91,105,93,44,105,43,49,44,115,91,105,93,0,0,
+9,6,2,3,15,5,6,0,11,8,0,1,1,0,0,0,
+0,0,0,0,1,7,3,8,15,6,7,0,9,8,2,3,
+15,7,8,0,15,8,5,0,15,3,6,0,15,5,7,0,
+30,4,0,234,9,9,119,104,105,108,101,32,105,60,108,58,
+0,0,0,0,25,6,3,4,21,6,0,0,18,0,0,69,
+30,3,0,235,9,9,9,99,32,61,32,115,91,105,93,0,
+9,6,2,3,15,5,6,0,30,18,0,236,9,9,9,105,
+102,32,40,99,32,60,32,39,48,39,32,111,114,32,99,32,
+62,32,39,57,39,41,32,97,110,100,32,40,99,32,60,32,
+39,97,39,32,111,114,32,99,32,62,32,39,102,39,41,32,
+97,110,100,32,99,32,33,61,32,39,120,39,58,32,98,114,
+101,97,107,0,12,7,0,1,48,0,0,0,25,6,5,7,
+46,6,0,0,18,0,0,4,12,6,0,1,57,0,0,0,
+25,6,6,5,21,6,0,0,18,0,0,9,12,7,0,1,
+97,0,0,0,25,6,5,7,46,6,0,0,18,0,0,4,
+12,6,0,1,102,0,0,0,25,6,6,5,21,6,0,0,
+18,0,0,4,12,7,0,1,120,0,0,0,35,6,5,7,
+21,6,0,0,18,0,0,3,18,0,0,18,18,0,0,1,
+30,5,0,237,9,9,9,118,44,105,32,61,32,118,43,99,
+44,105,43,49,0,0,0,0,1,7,8,5,15,6,7,0,
+11,10,0,1,1,0,0,0,0,0,0,0,1,9,3,10,
+15,7,9,0,15,8,6,0,15,3,7,0,18,0,255,186,
+30,4,0,238,9,9,105,102,32,99,32,61,61,32,39,46,
+39,58,0,0,12,7,0,1,46,0,0,0,23,6,5,7,
+21,6,0,0,18,0,0,70,30,5,0,239,9,9,9,118,
+44,105,32,61,32,118,43,99,44,105,43,49,0,0,0,0,
+1,7,8,5,15,6,7,0,11,10,0,1,1,0,0,0,
+0,0,0,0,1,9,3,10,15,7,9,0,15,8,6,0,
+15,3,7,0,30,4,0,240,9,9,9,119,104,105,108,101,
+32,105,60,108,58,0,0,0,25,6,3,4,21,6,0,0,
+18,0,0,46,30,4,0,241,9,9,9,9,99,32,61,32,
+115,91,105,93,0,0,0,0,9,6,2,3,15,5,6,0,
+30,9,0,242,9,9,9,9,105,102,32,99,32,60,32,39,
+48,39,32,111,114,32,99,32,62,32,39,57,39,58,32,98,
+114,101,97,107,0,0,0,0,12,7,0,1,48,0,0,0,
 25,6,5,7,46,6,0,0,18,0,0,4,12,6,0,1,
-57,0,0,0,25,6,6,5,21,6,0,0,18,0,0,9,
-12,7,0,1,97,0,0,0,25,6,5,7,46,6,0,0,
-18,0,0,4,12,6,0,1,102,0,0,0,25,6,6,5,
-21,6,0,0,18,0,0,4,12,7,0,1,120,0,0,0,
-35,6,5,7,21,6,0,0,18,0,0,3,18,0,0,18,
-18,0,0,1,30,5,0,229,9,9,9,118,44,105,32,61,
-32,118,43,99,44,105,43,49,0,0,0,0,1,7,8,5,
-15,6,7,0,11,10,0,0,0,0,0,0,0,0,240,63,
-1,9,3,10,15,7,9,0,15,8,6,0,15,3,7,0,
-18,0,255,186,30,4,0,230,9,9,105,102,32,99,32,61,
-61,32,39,46,39,58,0,0,12,7,0,1,46,0,0,0,
-23,6,5,7,21,6,0,0,18,0,0,70,30,5,0,231,
-9,9,9,118,44,105,32,61,32,118,43,99,44,105,43,49,
-0,0,0,0,1,7,8,5,15,6,7,0,11,10,0,0,
-0,0,0,0,0,0,240,63,1,9,3,10,15,7,9,0,
-15,8,6,0,15,3,7,0,30,4,0,232,9,9,9,119,
-104,105,108,101,32,105,60,108,58,0,0,0,25,6,3,4,
-21,6,0,0,18,0,0,46,30,4,0,233,9,9,9,9,
-99,32,61,32,115,91,105,93,0,0,0,0,9,6,2,3,
-15,5,6,0,30,9,0,234,9,9,9,9,105,102,32,99,
-32,60,32,39,48,39,32,111,114,32,99,32,62,32,39,57,
-39,58,32,98,114,101,97,107,0,0,0,0,12,7,0,1,
-48,0,0,0,25,6,5,7,46,6,0,0,18,0,0,4,
-12,6,0,1,57,0,0,0,25,6,6,5,21,6,0,0,
-18,0,0,3,18,0,0,18,18,0,0,1,30,5,0,235,
-9,9,9,9,118,44,105,32,61,32,118,43,99,44,105,43,
-49,0,0,0,1,7,8,5,15,6,7,0,11,10,0,0,
-0,0,0,0,0,0,240,63,1,9,3,10,15,7,9,0,
-15,8,6,0,15,3,7,0,18,0,255,209,18,0,0,1,
-30,7,0,236,9,9,115,101,108,102,46,84,46,97,100,100,
-40,39,110,117,109,98,101,114,39,44,118,41,0,0,0,0,
-12,9,0,1,84,0,0,0,9,7,1,9,12,9,0,3,
-97,100,100,0,9,7,7,9,12,9,0,6,110,117,109,98,
-101,114,0,0,15,10,8,0,31,6,9,2,19,6,7,6,
-30,3,0,237,9,9,114,101,116,117,114,110,32,105,0,0,
-20,3,0,0,0,0,0,0,12,18,0,9,100,111,95,110,
-117,109,98,101,114,0,0,0,10,7,18,17,16,18,0,195,
-44,11,0,0,30,7,0,240,9,100,101,102,32,100,111,95,
-110,97,109,101,40,115,101,108,102,44,115,44,105,44,108,41,
-58,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,7,100,111,95,110,
-97,109,101,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,3,0,0,9,2,0,3,28,4,0,0,9,3,0,4,
-28,5,0,0,9,4,0,5,30,4,0,241,9,9,118,44,
-105,32,61,115,91,105,93,44,105,43,49,0,9,6,2,3,
-15,5,6,0,11,8,0,0,0,0,0,0,0,0,240,63,
-1,7,3,8,15,6,7,0,15,7,5,0,15,3,6,0,
-30,4,0,242,9,9,119,104,105,108,101,32,105,60,108,58,
-0,0,0,0,25,5,3,4,21,5,0,0,18,0,0,86,
-30,3,0,243,9,9,9,99,32,61,32,115,91,105,93,0,
-9,6,2,3,15,5,6,0,30,25,0,244,9,9,9,105,
-102,32,40,99,32,60,32,39,97,39,32,111,114,32,99,32,
-62,32,39,122,39,41,32,97,110,100,32,40,99,32,60,32,
-39,65,39,32,111,114,32,99,32,62,32,39,90,39,41,32,
-97,110,100,32,40,99,32,60,32,39,48,39,32,111,114,32,
-99,32,62,32,39,57,39,41,32,97,110,100,32,99,32,33,
-61,32,39,95,39,58,32,98,114,101,97,107,0,0,0,0,
-12,8,0,1,97,0,0,0,25,6,5,8,46,6,0,0,
-18,0,0,4,12,6,0,1,122,0,0,0,25,6,6,5,
-21,6,0,0,18,0,0,9,12,8,0,1,65,0,0,0,
+57,0,0,0,25,6,6,5,21,6,0,0,18,0,0,3,
+18,0,0,18,18,0,0,1,30,5,0,243,9,9,9,9,
+118,44,105,32,61,32,118,43,99,44,105,43,49,0,0,0,
+1,7,8,5,15,6,7,0,11,10,0,1,1,0,0,0,
+0,0,0,0,1,9,3,10,15,7,9,0,15,8,6,0,
+15,3,7,0,18,0,255,209,18,0,0,1,30,7,0,244,
+9,9,115,101,108,102,46,84,46,97,100,100,40,39,110,117,
+109,98,101,114,39,44,118,41,0,0,0,0,12,13,0,1,
+84,0,0,0,9,7,1,13,12,13,0,3,97,100,100,0,
+49,9,7,13,12,11,0,6,110,117,109,98,101,114,0,0,
+15,12,8,0,50,6,9,2,30,3,0,245,9,9,114,101,
+116,117,114,110,32,105,0,0,20,3,0,0,0,0,0,0,
+12,19,0,9,100,111,95,110,117,109,98,101,114,0,0,0,
+10,8,19,18,16,19,0,193,44,14,0,0,30,7,0,248,
+9,100,101,102,32,100,111,95,110,97,109,101,40,115,101,108,
+102,44,115,44,105,44,108,41,58,0,0,0,12,1,0,9,
+116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
+12,1,0,7,100,111,95,110,97,109,101,0,34,1,0,0,
+28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
+28,4,0,0,9,3,0,4,28,5,0,0,9,4,0,5,
+30,4,0,249,9,9,118,44,105,32,61,115,91,105,93,44,
+105,43,49,0,9,6,2,3,15,5,6,0,11,8,0,1,
+1,0,0,0,0,0,0,0,1,7,3,8,15,6,7,0,
+15,7,5,0,15,3,6,0,30,4,0,250,9,9,119,104,
+105,108,101,32,105,60,108,58,0,0,0,0,25,5,3,4,
+21,5,0,0,18,0,0,86,30,3,0,251,9,9,9,99,
+32,61,32,115,91,105,93,0,9,6,2,3,15,5,6,0,
+30,25,0,252,9,9,9,105,102,32,40,99,32,60,32,39,
+97,39,32,111,114,32,99,32,62,32,39,122,39,41,32,97,
+110,100,32,40,99,32,60,32,39,65,39,32,111,114,32,99,
+32,62,32,39,90,39,41,32,97,110,100,32,40,99,32,60,
+32,39,48,39,32,111,114,32,99,32,62,32,39,57,39,41,
+32,97,110,100,32,99,32,33,61,32,39,95,39,58,32,98,
+114,101,97,107,0,0,0,0,12,8,0,1,97,0,0,0,
+25,6,5,8,46,6,0,0,18,0,0,4,12,6,0,1,
+122,0,0,0,25,6,6,5,21,6,0,0,18,0,0,9,
+12,8,0,1,65,0,0,0,25,6,5,8,46,6,0,0,
+18,0,0,4,12,6,0,1,90,0,0,0,25,6,6,5,
+21,6,0,0,18,0,0,9,12,8,0,1,48,0,0,0,
 25,6,5,8,46,6,0,0,18,0,0,4,12,6,0,1,
-90,0,0,0,25,6,6,5,21,6,0,0,18,0,0,9,
-12,8,0,1,48,0,0,0,25,6,5,8,46,6,0,0,
-18,0,0,4,12,6,0,1,57,0,0,0,25,6,6,5,
-21,6,0,0,18,0,0,4,12,8,0,1,95,0,0,0,
-35,6,5,8,21,6,0,0,18,0,0,3,18,0,0,18,
-18,0,0,1,30,5,0,245,9,9,9,118,44,105,32,61,
-32,118,43,99,44,105,43,49,0,0,0,0,1,8,7,5,
-15,6,8,0,11,10,0,0,0,0,0,0,0,0,240,63,
-1,9,3,10,15,8,9,0,15,7,6,0,15,3,8,0,
-18,0,255,169,30,12,0,246,9,9,105,102,32,118,32,105,
-110,32,115,101,108,102,46,83,89,77,66,79,76,83,58,32,
-115,101,108,102,46,84,46,97,100,100,40,39,115,121,109,98,
-111,108,39,44,118,41,0,0,12,8,0,7,83,89,77,66,
-79,76,83,0,9,6,1,8,36,6,6,7,21,6,0,0,
-18,0,0,14,12,9,0,1,84,0,0,0,9,8,1,9,
-12,9,0,3,97,100,100,0,9,8,8,9,12,9,0,6,
-115,121,109,98,111,108,0,0,15,10,7,0,31,6,9,2,
-19,6,8,6,18,0,0,23,30,8,0,247,9,9,101,108,
-115,101,58,32,115,101,108,102,46,84,46,97,100,100,40,39,
-110,97,109,101,39,44,118,41,0,0,0,0,12,9,0,1,
-84,0,0,0,9,8,1,9,12,9,0,3,97,100,100,0,
-9,8,8,9,12,9,0,4,110,97,109,101,0,0,0,0,
-15,10,7,0,31,6,9,2,19,6,8,6,18,0,0,1,
-30,3,0,248,9,9,114,101,116,117,114,110,32,105,0,0,
-20,3,0,0,0,0,0,0,12,19,0,7,100,111,95,110,
-97,109,101,0,10,7,19,18,16,19,1,187,44,12,0,0,
-30,7,0,251,9,100,101,102,32,100,111,95,115,116,114,105,
+57,0,0,0,25,6,6,5,21,6,0,0,18,0,0,4,
+12,8,0,1,95,0,0,0,35,6,5,8,21,6,0,0,
+18,0,0,3,18,0,0,18,18,0,0,1,30,5,0,253,
+9,9,9,118,44,105,32,61,32,118,43,99,44,105,43,49,
+0,0,0,0,1,8,7,5,15,6,8,0,11,10,0,1,
+1,0,0,0,0,0,0,0,1,9,3,10,15,8,9,0,
+15,7,6,0,15,3,8,0,18,0,255,169,30,12,0,254,
+9,9,105,102,32,118,32,105,110,32,115,101,108,102,46,83,
+89,77,66,79,76,83,58,32,115,101,108,102,46,84,46,97,
+100,100,40,39,115,121,109,98,111,108,39,44,118,41,0,0,
+12,8,0,7,83,89,77,66,79,76,83,0,9,6,1,8,
+36,6,6,7,21,6,0,0,18,0,0,13,12,13,0,1,
+84,0,0,0,9,12,1,13,12,13,0,3,97,100,100,0,
+49,8,12,13,12,10,0,6,115,121,109,98,111,108,0,0,
+15,11,7,0,50,6,8,2,18,0,0,22,30,8,0,255,
+9,9,101,108,115,101,58,32,115,101,108,102,46,84,46,97,
+100,100,40,39,110,97,109,101,39,44,118,41,0,0,0,0,
+12,13,0,1,84,0,0,0,9,12,1,13,12,13,0,3,
+97,100,100,0,49,8,12,13,12,10,0,4,110,97,109,101,
+0,0,0,0,15,11,7,0,50,6,8,2,18,0,0,1,
+30,3,1,0,9,9,114,101,116,117,114,110,32,105,0,0,
+20,3,0,0,0,0,0,0,12,20,0,7,100,111,95,110,
+97,109,101,0,10,8,20,19,16,20,1,185,44,15,0,0,
+30,7,1,3,9,100,101,102,32,100,111,95,115,116,114,105,
 110,103,40,115,101,108,102,44,115,44,105,44,108,41,58,0,
 12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
 33,1,0,0,12,1,0,9,100,111,95,115,116,114,105,110,
 103,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
 28,3,0,0,9,2,0,3,28,4,0,0,9,3,0,4,
-28,5,0,0,9,4,0,5,30,6,0,252,9,9,118,44,
+28,5,0,0,9,4,0,5,30,6,1,4,9,9,118,44,
 113,44,105,32,61,32,39,39,44,115,91,105,93,44,105,43,
 49,0,0,0,12,6,0,0,0,0,0,0,15,5,6,0,
-9,7,2,3,15,6,7,0,11,9,0,0,0,0,0,0,
-0,0,240,63,1,8,3,9,15,7,8,0,15,8,5,0,
-15,5,6,0,15,3,7,0,30,14,0,253,9,9,105,102,
+9,7,2,3,15,6,7,0,11,9,0,1,1,0,0,0,
+0,0,0,0,1,8,3,9,15,7,8,0,15,8,5,0,
+15,5,6,0,15,3,7,0,30,14,1,5,9,9,105,102,
 32,40,108,45,105,41,32,62,61,32,53,32,97,110,100,32,
 115,91,105,93,32,61,61,32,113,32,97,110,100,32,115,91,
 105,43,49,93,32,61,61,32,113,58,32,35,32,34,34,34,
-0,0,0,0,11,6,0,0,0,0,0,0,0,0,20,64,
+0,0,0,0,11,6,0,1,5,0,0,0,0,0,0,0,
 2,7,4,3,24,6,6,7,21,6,0,0,18,0,0,3,
 9,6,2,3,23,6,6,5,21,6,0,0,18,0,0,7,
-11,9,0,0,0,0,0,0,0,0,240,63,1,7,3,9,
-9,6,2,7,23,6,6,5,21,6,0,0,18,0,0,163,
-30,3,0,254,9,9,9,105,32,43,61,32,50,0,0,0,
-11,7,0,0,0,0,0,0,0,0,0,64,1,6,3,7,
-15,3,6,0,30,4,0,255,9,9,9,119,104,105,108,101,
-32,105,60,108,45,50,58,0,11,9,0,0,0,0,0,0,
-0,0,0,64,2,7,4,9,25,6,3,7,21,6,0,0,
-18,0,0,141,30,4,1,0,9,9,9,9,99,32,61,32,
+11,9,0,1,1,0,0,0,0,0,0,0,1,7,3,9,
+9,6,2,7,23,6,6,5,21,6,0,0,18,0,0,162,
+30,3,1,6,9,9,9,105,32,43,61,32,50,0,0,0,
+11,7,0,1,2,0,0,0,0,0,0,0,1,6,3,7,
+15,3,6,0,30,4,1,7,9,9,9,119,104,105,108,101,
+32,105,60,108,45,50,58,0,11,9,0,1,2,0,0,0,
+0,0,0,0,2,7,4,9,25,6,3,7,21,6,0,0,
+18,0,0,140,30,4,1,8,9,9,9,9,99,32,61,32,
 115,91,105,93,0,0,0,0,9,7,2,3,15,6,7,0,
-30,12,1,1,9,9,9,9,105,102,32,99,32,61,61,32,
+30,12,1,9,9,9,9,9,105,102,32,99,32,61,61,32,
 113,32,97,110,100,32,115,91,105,43,49,93,32,61,61,32,
 113,32,97,110,100,32,115,91,105,43,50,93,32,61,61,32,
 113,58,0,0,23,7,6,5,21,7,0,0,18,0,0,7,
-11,10,0,0,0,0,0,0,0,0,240,63,1,9,3,10,
+11,10,0,1,1,0,0,0,0,0,0,0,1,9,3,10,
 9,7,2,9,23,7,7,5,21,7,0,0,18,0,0,7,
-11,10,0,0,0,0,0,0,0,0,0,64,1,9,3,10,
-9,7,2,9,23,7,7,5,21,7,0,0,18,0,0,36,
-30,3,1,2,9,9,9,9,9,105,32,43,61,32,51,0,
-11,9,0,0,0,0,0,0,0,0,8,64,1,7,3,9,
-15,3,7,0,30,7,1,3,9,9,9,9,9,115,101,108,
+11,10,0,1,2,0,0,0,0,0,0,0,1,9,3,10,
+9,7,2,9,23,7,7,5,21,7,0,0,18,0,0,35,
+30,3,1,10,9,9,9,9,9,105,32,43,61,32,51,0,
+11,9,0,1,3,0,0,0,0,0,0,0,1,7,3,9,
+15,3,7,0,30,7,1,11,9,9,9,9,9,115,101,108,
 102,46,84,46,97,100,100,40,39,115,116,114,105,110,103,39,
-44,118,41,0,12,10,0,1,84,0,0,0,9,9,1,10,
-12,10,0,3,97,100,100,0,9,9,9,10,12,10,0,6,
-115,116,114,105,110,103,0,0,15,11,8,0,31,7,10,2,
-19,7,9,7,30,3,1,4,9,9,9,9,9,98,114,101,
-97,107,0,0,18,0,0,68,18,0,0,66,30,3,1,5,
-9,9,9,9,101,108,115,101,58,0,0,0,30,5,1,6,
-9,9,9,9,9,118,44,105,32,61,32,118,43,99,44,105,
-43,49,0,0,1,9,8,6,15,7,9,0,11,11,0,0,
-0,0,0,0,0,0,240,63,1,10,3,11,15,9,10,0,
-15,8,7,0,15,3,9,0,30,14,1,7,9,9,9,9,
-9,105,102,32,99,32,61,61,32,39,92,110,39,58,32,115,
-101,108,102,46,84,46,121,44,115,101,108,102,46,84,46,121,
-105,32,61,32,115,101,108,102,46,84,46,121,43,49,44,105,
-0,0,0,0,12,9,0,1,10,0,0,0,23,7,6,9,
-21,7,0,0,18,0,0,26,12,10,0,1,84,0,0,0,
-9,9,1,10,12,10,0,1,121,0,0,0,9,9,9,10,
-11,10,0,0,0,0,0,0,0,0,240,63,1,9,9,10,
-15,7,9,0,15,9,3,0,12,11,0,1,84,0,0,0,
-9,10,1,11,12,11,0,1,121,0,0,0,10,10,11,7,
-12,10,0,1,84,0,0,0,9,7,1,10,12,10,0,2,
-121,105,0,0,10,7,10,9,18,0,0,1,18,0,0,1,
-18,0,255,110,18,0,0,194,30,4,1,9,9,9,9,119,
-104,105,108,101,32,105,60,108,58,0,0,0,25,7,3,4,
-21,7,0,0,18,0,0,185,30,4,1,10,9,9,9,9,
-99,32,61,32,115,91,105,93,0,0,0,0,9,7,2,3,
-15,6,7,0,30,5,1,11,9,9,9,9,105,102,32,99,
-32,61,61,32,34,92,92,34,58,0,0,0,12,9,0,1,
-92,0,0,0,23,7,6,9,21,7,0,0,18,0,0,106,
-30,6,1,12,9,9,9,9,9,105,32,61,32,105,43,49,
-59,32,99,32,61,32,115,91,105,93,0,0,11,9,0,0,
-0,0,0,0,0,0,240,63,1,7,3,9,15,3,7,0,
-9,7,2,3,15,6,7,0,30,7,1,13,9,9,9,9,
-9,105,102,32,99,32,61,61,32,34,110,34,58,32,99,32,
-61,32,39,92,110,39,0,0,12,9,0,1,110,0,0,0,
+44,118,41,0,12,14,0,1,84,0,0,0,9,13,1,14,
+12,14,0,3,97,100,100,0,49,9,13,14,12,11,0,6,
+115,116,114,105,110,103,0,0,15,12,8,0,50,7,9,2,
+30,3,1,12,9,9,9,9,9,98,114,101,97,107,0,0,
+18,0,0,68,18,0,0,66,30,3,1,13,9,9,9,9,
+101,108,115,101,58,0,0,0,30,5,1,14,9,9,9,9,
+9,118,44,105,32,61,32,118,43,99,44,105,43,49,0,0,
+1,9,8,6,15,7,9,0,11,11,0,1,1,0,0,0,
+0,0,0,0,1,10,3,11,15,9,10,0,15,8,7,0,
+15,3,9,0,30,14,1,15,9,9,9,9,9,105,102,32,
+99,32,61,61,32,39,92,110,39,58,32,115,101,108,102,46,
+84,46,121,44,115,101,108,102,46,84,46,121,105,32,61,32,
+115,101,108,102,46,84,46,121,43,49,44,105,0,0,0,0,
+12,9,0,1,10,0,0,0,23,7,6,9,21,7,0,0,
+18,0,0,26,12,10,0,1,84,0,0,0,9,9,1,10,
+12,10,0,1,121,0,0,0,9,9,9,10,11,10,0,1,
+1,0,0,0,0,0,0,0,1,9,9,10,15,7,9,0,
+15,9,3,0,12,11,0,1,84,0,0,0,9,10,1,11,
+12,11,0,1,121,0,0,0,10,10,11,7,12,10,0,1,
+84,0,0,0,9,7,1,10,12,10,0,2,121,105,0,0,
+10,7,10,9,18,0,0,1,18,0,0,1,18,0,255,111,
+18,0,0,193,30,4,1,17,9,9,9,119,104,105,108,101,
+32,105,60,108,58,0,0,0,25,7,3,4,21,7,0,0,
+18,0,0,184,30,4,1,18,9,9,9,9,99,32,61,32,
+115,91,105,93,0,0,0,0,9,7,2,3,15,6,7,0,
+30,5,1,19,9,9,9,9,105,102,32,99,32,61,61,32,
+34,92,92,34,58,0,0,0,12,9,0,1,92,0,0,0,
+23,7,6,9,21,7,0,0,18,0,0,106,30,6,1,20,
+9,9,9,9,9,105,32,61,32,105,43,49,59,32,99,32,
+61,32,115,91,105,93,0,0,11,9,0,1,1,0,0,0,
+0,0,0,0,1,7,3,9,15,3,7,0,9,7,2,3,
+15,6,7,0,30,7,1,21,9,9,9,9,9,105,102,32,
+99,32,61,61,32,34,110,34,58,32,99,32,61,32,39,92,
+110,39,0,0,12,9,0,1,110,0,0,0,23,7,6,9,
+21,7,0,0,18,0,0,5,12,7,0,1,10,0,0,0,
+15,6,7,0,18,0,0,1,30,8,1,22,9,9,9,9,
+9,105,102,32,99,32,61,61,32,34,114,34,58,32,99,32,
+61,32,99,104,114,40,49,51,41,0,0,0,12,9,0,1,
+114,0,0,0,23,7,6,9,21,7,0,0,18,0,0,11,
+12,10,0,3,99,104,114,0,13,9,10,0,11,10,0,1,
+13,0,0,0,0,0,0,0,31,7,10,1,19,7,9,7,
+15,6,7,0,18,0,0,1,30,7,1,23,9,9,9,9,
+9,105,102,32,99,32,61,61,32,34,116,34,58,32,99,32,
+61,32,34,92,116,34,0,0,12,9,0,1,116,0,0,0,
 23,7,6,9,21,7,0,0,18,0,0,5,12,7,0,1,
-10,0,0,0,15,6,7,0,18,0,0,1,30,8,1,14,
-9,9,9,9,9,105,102,32,99,32,61,61,32,34,114,34,
-58,32,99,32,61,32,99,104,114,40,49,51,41,0,0,0,
-12,9,0,1,114,0,0,0,23,7,6,9,21,7,0,0,
-18,0,0,11,12,10,0,3,99,104,114,0,13,9,10,0,
-11,10,0,0,0,0,0,0,0,0,42,64,31,7,10,1,
-19,7,9,7,15,6,7,0,18,0,0,1,30,7,1,15,
-9,9,9,9,9,105,102,32,99,32,61,61,32,34,116,34,
-58,32,99,32,61,32,34,92,116,34,0,0,12,9,0,1,
-116,0,0,0,23,7,6,9,21,7,0,0,18,0,0,5,
-12,7,0,1,9,0,0,0,15,6,7,0,18,0,0,1,
-30,7,1,16,9,9,9,9,9,105,102,32,99,32,61,61,
-32,34,48,34,58,32,99,32,61,32,34,92,48,34,0,0,
-12,9,0,1,48,0,0,0,23,7,6,9,21,7,0,0,
-18,0,0,5,12,7,0,1,0,0,0,0,15,6,7,0,
-18,0,0,1,30,5,1,17,9,9,9,9,9,118,44,105,
-32,61,32,118,43,99,44,105,43,49,0,0,1,9,8,6,
-15,7,9,0,11,11,0,0,0,0,0,0,0,0,240,63,
-1,10,3,11,15,9,10,0,15,8,7,0,15,3,9,0,
-18,0,0,61,30,5,1,18,9,9,9,9,101,108,105,102,
-32,99,32,61,61,32,113,58,0,0,0,0,23,7,6,5,
-21,7,0,0,18,0,0,36,30,3,1,19,9,9,9,9,
-9,105,32,43,61,32,49,0,11,9,0,0,0,0,0,0,
-0,0,240,63,1,7,3,9,15,3,7,0,30,7,1,20,
-9,9,9,9,9,115,101,108,102,46,84,46,97,100,100,40,
-39,115,116,114,105,110,103,39,44,118,41,0,12,10,0,1,
-84,0,0,0,9,9,1,10,12,10,0,3,97,100,100,0,
-9,9,9,10,12,10,0,6,115,116,114,105,110,103,0,0,
-15,11,8,0,31,7,10,2,19,7,9,7,30,3,1,21,
-9,9,9,9,9,98,114,101,97,107,0,0,18,0,0,19,
-18,0,0,17,30,5,1,23,9,9,9,9,9,118,44,105,
-32,61,32,118,43,99,44,105,43,49,0,0,1,9,8,6,
-15,7,9,0,11,11,0,0,0,0,0,0,0,0,240,63,
-1,10,3,11,15,9,10,0,15,8,7,0,15,3,9,0,
-18,0,0,1,18,0,255,70,18,0,0,1,30,3,1,24,
-9,9,114,101,116,117,114,110,32,105,0,0,20,3,0,0,
-0,0,0,0,12,20,0,9,100,111,95,115,116,114,105,110,
-103,0,0,0,10,7,20,19,16,20,0,82,44,8,0,0,
-30,8,1,27,9,100,101,102,32,100,111,95,99,111,109,109,
-101,110,116,40,115,101,108,102,44,115,44,105,44,108,41,58,
-0,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,10,100,111,95,99,
-111,109,109,101,110,116,0,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,28,4,0,0,
-9,3,0,4,28,5,0,0,9,4,0,5,30,3,1,28,
-9,9,105,32,43,61,32,49,0,0,0,0,11,6,0,0,
-0,0,0,0,0,0,240,63,1,5,3,6,15,3,5,0,
-30,4,1,29,9,9,119,104,105,108,101,32,105,60,108,58,
-0,0,0,0,25,5,3,4,21,5,0,0,18,0,0,31,
-30,3,1,30,9,9,9,99,32,61,32,115,91,105,93,0,
-9,6,2,3,15,5,6,0,30,6,1,31,9,9,9,105,
-102,32,99,32,61,61,32,39,92,110,39,58,32,98,114,101,
-97,107,0,0,12,7,0,1,10,0,0,0,23,6,5,7,
-21,6,0,0,18,0,0,3,18,0,0,12,18,0,0,1,
-30,3,1,32,9,9,9,105,32,43,61,32,49,0,0,0,
-11,7,0,0,0,0,0,0,0,0,240,63,1,6,3,7,
-15,3,6,0,18,0,255,224,30,3,1,33,9,9,114,101,
-116,117,114,110,32,105,0,0,20,3,0,0,0,0,0,0,
-12,21,0,10,100,111,95,99,111,109,109,101,110,116,0,0,
-10,7,21,20,30,4,1,36,99,108,97,115,115,32,80,97,
-114,115,101,114,58,0,0,0,26,7,0,0,12,21,0,6,
-80,97,114,115,101,114,0,0,14,21,7,0,12,23,0,7,
-115,101,116,109,101,116,97,0,13,22,23,0,15,23,7,0,
-12,25,0,6,111,98,106,101,99,116,0,0,13,24,25,0,
-31,21,23,2,19,21,22,21,16,21,5,246,44,72,0,0,
-30,6,1,39,9,100,101,102,32,95,95,105,110,105,116,95,
-95,40,115,101,108,102,41,58,0,0,0,0,12,1,0,9,
+9,0,0,0,15,6,7,0,18,0,0,1,30,7,1,24,
+9,9,9,9,9,105,102,32,99,32,61,61,32,34,48,34,
+58,32,99,32,61,32,34,92,48,34,0,0,12,9,0,1,
+48,0,0,0,23,7,6,9,21,7,0,0,18,0,0,5,
+12,7,0,1,0,0,0,0,15,6,7,0,18,0,0,1,
+30,5,1,25,9,9,9,9,9,118,44,105,32,61,32,118,
+43,99,44,105,43,49,0,0,1,9,8,6,15,7,9,0,
+11,11,0,1,1,0,0,0,0,0,0,0,1,10,3,11,
+15,9,10,0,15,8,7,0,15,3,9,0,18,0,0,60,
+30,5,1,26,9,9,9,9,101,108,105,102,32,99,32,61,
+61,32,113,58,0,0,0,0,23,7,6,5,21,7,0,0,
+18,0,0,35,30,3,1,27,9,9,9,9,9,105,32,43,
+61,32,49,0,11,9,0,1,1,0,0,0,0,0,0,0,
+1,7,3,9,15,3,7,0,30,7,1,28,9,9,9,9,
+9,115,101,108,102,46,84,46,97,100,100,40,39,115,116,114,
+105,110,103,39,44,118,41,0,12,14,0,1,84,0,0,0,
+9,13,1,14,12,14,0,3,97,100,100,0,49,9,13,14,
+12,11,0,6,115,116,114,105,110,103,0,0,15,12,8,0,
+50,7,9,2,30,3,1,29,9,9,9,9,9,98,114,101,
+97,107,0,0,18,0,0,19,18,0,0,17,30,5,1,31,
+9,9,9,9,9,118,44,105,32,61,32,118,43,99,44,105,
+43,49,0,0,1,9,8,6,15,7,9,0,11,11,0,1,
+1,0,0,0,0,0,0,0,1,10,3,11,15,9,10,0,
+15,8,7,0,15,3,9,0,18,0,0,1,18,0,255,71,
+18,0,0,1,30,3,1,32,9,9,114,101,116,117,114,110,
+32,105,0,0,20,3,0,0,0,0,0,0,12,21,0,9,
+100,111,95,115,116,114,105,110,103,0,0,0,10,8,21,20,
+16,21,0,82,44,8,0,0,30,8,1,35,9,100,101,102,
+32,100,111,95,99,111,109,109,101,110,116,40,115,101,108,102,
+44,115,44,105,44,108,41,58,0,0,0,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,8,95,95,105,110,105,116,95,95,0,0,0,0,
-34,1,0,0,28,2,0,0,9,1,0,2,30,6,1,41,
-9,9,115,101,108,102,46,98,97,115,101,95,100,109,97,112,
-32,61,32,123,0,0,0,0,30,13,1,42,9,9,9,39,
-44,39,58,123,39,108,98,112,39,58,50,48,44,39,98,112,
-39,58,50,48,44,39,108,101,100,39,58,115,101,108,102,46,
-105,110,102,105,120,95,116,117,112,108,101,125,44,0,0,0,
-12,3,0,1,44,0,0,0,12,61,0,3,108,98,112,0,
-11,62,0,0,0,0,0,0,0,0,52,64,12,63,0,2,
-98,112,0,0,11,64,0,0,0,0,0,0,0,0,52,64,
-12,65,0,3,108,101,100,0,12,67,0,11,105,110,102,105,
-120,95,116,117,112,108,101,0,9,66,1,67,26,4,61,6,
-30,12,1,43,9,9,9,39,43,39,58,123,39,108,98,112,
-39,58,53,48,44,39,98,112,39,58,53,48,44,39,108,101,
-100,39,58,115,101,108,102,46,105,110,102,105,120,95,108,101,
-100,125,44,0,12,5,0,1,43,0,0,0,12,61,0,3,
-108,98,112,0,11,62,0,0,0,0,0,0,0,0,73,64,
-12,63,0,2,98,112,0,0,11,64,0,0,0,0,0,0,
-0,0,73,64,12,65,0,3,108,101,100,0,12,67,0,9,
-105,110,102,105,120,95,108,101,100,0,0,0,9,66,1,67,
-26,6,61,6,30,18,1,44,9,9,9,39,45,39,58,123,
-39,108,98,112,39,58,53,48,44,39,110,117,100,39,58,115,
-101,108,102,46,112,114,101,102,105,120,95,110,101,103,44,39,
-98,112,39,58,53,48,44,39,108,101,100,39,58,115,101,108,
-102,46,105,110,102,105,120,95,108,101,100,125,44,0,0,0,
-12,7,0,1,45,0,0,0,12,61,0,3,108,98,112,0,
-11,62,0,0,0,0,0,0,0,0,73,64,12,63,0,3,
-110,117,100,0,12,69,0,10,112,114,101,102,105,120,95,110,
-101,103,0,0,9,64,1,69,12,65,0,2,98,112,0,0,
-11,66,0,0,0,0,0,0,0,0,73,64,12,67,0,3,
-108,101,100,0,12,69,0,9,105,110,102,105,120,95,108,101,
-100,0,0,0,9,68,1,69,26,8,61,8,30,21,1,45,
-9,9,9,39,110,111,116,39,58,123,39,108,98,112,39,58,
-51,53,44,39,110,117,100,39,58,115,101,108,102,46,112,114,
-101,102,105,120,95,110,117,100,44,39,98,112,39,58,51,53,
-44,39,98,112,39,58,51,53,44,39,108,101,100,39,58,115,
-101,108,102,46,105,110,102,105,120,95,110,111,116,32,125,44,
-0,0,0,0,12,9,0,3,110,111,116,0,12,61,0,3,
-108,98,112,0,11,62,0,0,0,0,0,0,0,128,65,64,
-12,63,0,3,110,117,100,0,12,71,0,10,112,114,101,102,
-105,120,95,110,117,100,0,0,9,64,1,71,12,65,0,2,
-98,112,0,0,11,66,0,0,0,0,0,0,0,128,65,64,
-12,67,0,2,98,112,0,0,11,68,0,0,0,0,0,0,
-0,128,65,64,12,69,0,3,108,101,100,0,12,71,0,9,
-105,110,102,105,120,95,110,111,116,0,0,0,9,70,1,71,
-26,10,61,10,30,12,1,46,9,9,9,39,37,39,58,123,
-39,108,98,112,39,58,54,48,44,39,98,112,39,58,54,48,
+12,1,0,10,100,111,95,99,111,109,109,101,110,116,0,0,
+34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
+9,2,0,3,28,4,0,0,9,3,0,4,28,5,0,0,
+9,4,0,5,30,3,1,36,9,9,105,32,43,61,32,49,
+0,0,0,0,11,6,0,1,1,0,0,0,0,0,0,0,
+1,5,3,6,15,3,5,0,30,4,1,37,9,9,119,104,
+105,108,101,32,105,60,108,58,0,0,0,0,25,5,3,4,
+21,5,0,0,18,0,0,31,30,3,1,38,9,9,9,99,
+32,61,32,115,91,105,93,0,9,6,2,3,15,5,6,0,
+30,6,1,39,9,9,9,105,102,32,99,32,61,61,32,39,
+92,110,39,58,32,98,114,101,97,107,0,0,12,7,0,1,
+10,0,0,0,23,6,5,7,21,6,0,0,18,0,0,3,
+18,0,0,12,18,0,0,1,30,3,1,40,9,9,9,105,
+32,43,61,32,49,0,0,0,11,7,0,1,1,0,0,0,
+0,0,0,0,1,6,3,7,15,3,6,0,18,0,255,224,
+30,3,1,41,9,9,114,101,116,117,114,110,32,105,0,0,
+20,3,0,0,0,0,0,0,12,22,0,10,100,111,95,99,
+111,109,109,101,110,116,0,0,10,8,22,21,30,4,1,44,
+99,108,97,115,115,32,80,97,114,115,101,114,58,0,0,0,
+26,8,0,0,12,22,0,6,80,97,114,115,101,114,0,0,
+14,22,8,0,12,24,0,7,115,101,116,109,101,116,97,0,
+13,23,24,0,15,24,8,0,12,26,0,6,111,98,106,101,
+99,116,0,0,13,25,26,0,31,22,24,2,19,22,23,22,
+16,22,5,238,44,72,0,0,30,6,1,47,9,100,101,102,
+32,95,95,105,110,105,116,95,95,40,115,101,108,102,41,58,
+0,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
+121,0,0,0,33,1,0,0,12,1,0,8,95,95,105,110,
+105,116,95,95,0,0,0,0,34,1,0,0,28,2,0,0,
+9,1,0,2,30,6,1,49,9,9,115,101,108,102,46,98,
+97,115,101,95,100,109,97,112,32,61,32,123,0,0,0,0,
+30,13,1,50,9,9,9,39,44,39,58,123,39,108,98,112,
+39,58,50,48,44,39,98,112,39,58,50,48,44,39,108,101,
+100,39,58,115,101,108,102,46,105,110,102,105,120,95,116,117,
+112,108,101,125,44,0,0,0,12,3,0,1,44,0,0,0,
+12,61,0,3,108,98,112,0,11,62,0,1,20,0,0,0,
+0,0,0,0,12,63,0,2,98,112,0,0,11,64,0,1,
+20,0,0,0,0,0,0,0,12,65,0,3,108,101,100,0,
+12,67,0,11,105,110,102,105,120,95,116,117,112,108,101,0,
+9,66,1,67,26,4,61,6,30,12,1,51,9,9,9,39,
+43,39,58,123,39,108,98,112,39,58,53,48,44,39,98,112,
+39,58,53,48,44,39,108,101,100,39,58,115,101,108,102,46,
+105,110,102,105,120,95,108,101,100,125,44,0,12,5,0,1,
+43,0,0,0,12,61,0,3,108,98,112,0,11,62,0,1,
+50,0,0,0,0,0,0,0,12,63,0,2,98,112,0,0,
+11,64,0,1,50,0,0,0,0,0,0,0,12,65,0,3,
+108,101,100,0,12,67,0,9,105,110,102,105,120,95,108,101,
+100,0,0,0,9,66,1,67,26,6,61,6,30,18,1,52,
+9,9,9,39,45,39,58,123,39,108,98,112,39,58,53,48,
+44,39,110,117,100,39,58,115,101,108,102,46,112,114,101,102,
+105,120,95,110,101,103,44,39,98,112,39,58,53,48,44,39,
+108,101,100,39,58,115,101,108,102,46,105,110,102,105,120,95,
+108,101,100,125,44,0,0,0,12,7,0,1,45,0,0,0,
+12,61,0,3,108,98,112,0,11,62,0,1,50,0,0,0,
+0,0,0,0,12,63,0,3,110,117,100,0,12,69,0,10,
+112,114,101,102,105,120,95,110,101,103,0,0,9,64,1,69,
+12,65,0,2,98,112,0,0,11,66,0,1,50,0,0,0,
+0,0,0,0,12,67,0,3,108,101,100,0,12,69,0,9,
+105,110,102,105,120,95,108,101,100,0,0,0,9,68,1,69,
+26,8,61,8,30,21,1,53,9,9,9,39,110,111,116,39,
+58,123,39,108,98,112,39,58,51,53,44,39,110,117,100,39,
+58,115,101,108,102,46,112,114,101,102,105,120,95,110,117,100,
+44,39,98,112,39,58,51,53,44,39,98,112,39,58,51,53,
 44,39,108,101,100,39,58,115,101,108,102,46,105,110,102,105,
-120,95,108,101,100,125,44,0,12,11,0,1,37,0,0,0,
-12,61,0,3,108,98,112,0,11,62,0,0,0,0,0,0,
-0,0,78,64,12,63,0,2,98,112,0,0,11,64,0,0,
-0,0,0,0,0,0,78,64,12,65,0,3,108,101,100,0,
-12,67,0,9,105,110,102,105,120,95,108,101,100,0,0,0,
-9,66,1,67,26,12,61,6,30,18,1,47,9,9,9,39,
-42,39,58,123,39,108,98,112,39,58,54,48,44,39,110,117,
-100,39,58,115,101,108,102,46,118,97,114,103,115,95,110,117,
-100,44,39,98,112,39,58,54,48,44,39,108,101,100,39,58,
-115,101,108,102,46,105,110,102,105,120,95,108,101,100,44,125,
-44,0,0,0,12,13,0,1,42,0,0,0,12,61,0,3,
-108,98,112,0,11,62,0,0,0,0,0,0,0,0,78,64,
-12,63,0,3,110,117,100,0,12,69,0,9,118,97,114,103,
+120,95,110,111,116,32,125,44,0,0,0,0,12,9,0,3,
+110,111,116,0,12,61,0,3,108,98,112,0,11,62,0,1,
+35,0,0,0,0,0,0,0,12,63,0,3,110,117,100,0,
+12,71,0,10,112,114,101,102,105,120,95,110,117,100,0,0,
+9,64,1,71,12,65,0,2,98,112,0,0,11,66,0,1,
+35,0,0,0,0,0,0,0,12,67,0,2,98,112,0,0,
+11,68,0,1,35,0,0,0,0,0,0,0,12,69,0,3,
+108,101,100,0,12,71,0,9,105,110,102,105,120,95,110,111,
+116,0,0,0,9,70,1,71,26,10,61,10,30,12,1,54,
+9,9,9,39,37,39,58,123,39,108,98,112,39,58,54,48,
+44,39,98,112,39,58,54,48,44,39,108,101,100,39,58,115,
+101,108,102,46,105,110,102,105,120,95,108,101,100,125,44,0,
+12,11,0,1,37,0,0,0,12,61,0,3,108,98,112,0,
+11,62,0,1,60,0,0,0,0,0,0,0,12,63,0,2,
+98,112,0,0,11,64,0,1,60,0,0,0,0,0,0,0,
+12,65,0,3,108,101,100,0,12,67,0,9,105,110,102,105,
+120,95,108,101,100,0,0,0,9,66,1,67,26,12,61,6,
+30,18,1,55,9,9,9,39,42,39,58,123,39,108,98,112,
+39,58,54,48,44,39,110,117,100,39,58,115,101,108,102,46,
+118,97,114,103,115,95,110,117,100,44,39,98,112,39,58,54,
+48,44,39,108,101,100,39,58,115,101,108,102,46,105,110,102,
+105,120,95,108,101,100,44,125,44,0,0,0,12,13,0,1,
+42,0,0,0,12,61,0,3,108,98,112,0,11,62,0,1,
+60,0,0,0,0,0,0,0,12,63,0,3,110,117,100,0,
+12,69,0,9,118,97,114,103,115,95,110,117,100,0,0,0,
+9,64,1,69,12,65,0,2,98,112,0,0,11,66,0,1,
+60,0,0,0,0,0,0,0,12,67,0,3,108,101,100,0,
+12,69,0,9,105,110,102,105,120,95,108,101,100,0,0,0,
+9,68,1,69,26,14,61,8,30,18,1,56,9,9,9,39,
+42,42,39,58,32,123,39,108,98,112,39,58,54,53,44,39,
+110,117,100,39,58,115,101,108,102,46,110,97,114,103,115,95,
+110,117,100,44,39,98,112,39,58,54,53,44,39,108,101,100,
+39,58,115,101,108,102,46,105,110,102,105,120,95,108,101,100,
+44,125,44,0,12,15,0,2,42,42,0,0,12,61,0,3,
+108,98,112,0,11,62,0,1,65,0,0,0,0,0,0,0,
+12,63,0,3,110,117,100,0,12,69,0,9,110,97,114,103,
 115,95,110,117,100,0,0,0,9,64,1,69,12,65,0,2,
-98,112,0,0,11,66,0,0,0,0,0,0,0,0,78,64,
+98,112,0,0,11,66,0,1,65,0,0,0,0,0,0,0,
 12,67,0,3,108,101,100,0,12,69,0,9,105,110,102,105,
-120,95,108,101,100,0,0,0,9,68,1,69,26,14,61,8,
-30,18,1,48,9,9,9,39,42,42,39,58,32,123,39,108,
-98,112,39,58,54,53,44,39,110,117,100,39,58,115,101,108,
-102,46,110,97,114,103,115,95,110,117,100,44,39,98,112,39,
-58,54,53,44,39,108,101,100,39,58,115,101,108,102,46,105,
-110,102,105,120,95,108,101,100,44,125,44,0,12,15,0,2,
-42,42,0,0,12,61,0,3,108,98,112,0,11,62,0,0,
-0,0,0,0,0,64,80,64,12,63,0,3,110,117,100,0,
-12,69,0,9,110,97,114,103,115,95,110,117,100,0,0,0,
-9,64,1,69,12,65,0,2,98,112,0,0,11,66,0,0,
-0,0,0,0,0,64,80,64,12,67,0,3,108,101,100,0,
-12,69,0,9,105,110,102,105,120,95,108,101,100,0,0,0,
-9,68,1,69,26,16,61,8,30,12,1,49,9,9,9,39,
-47,39,58,123,39,108,98,112,39,58,54,48,44,39,98,112,
-39,58,54,48,44,39,108,101,100,39,58,115,101,108,102,46,
-105,110,102,105,120,95,108,101,100,125,44,0,12,17,0,1,
-47,0,0,0,12,61,0,3,108,98,112,0,11,62,0,0,
-0,0,0,0,0,0,78,64,12,63,0,2,98,112,0,0,
-11,64,0,0,0,0,0,0,0,0,78,64,12,65,0,3,
-108,101,100,0,12,67,0,9,105,110,102,105,120,95,108,101,
-100,0,0,0,9,66,1,67,26,18,61,6,30,18,1,50,
-9,9,9,39,40,39,58,123,39,108,98,112,39,58,55,48,
-44,39,110,117,100,39,58,115,101,108,102,46,112,97,114,101,
-110,95,110,117,100,44,39,98,112,39,58,56,48,44,39,108,
-101,100,39,58,115,101,108,102,46,99,97,108,108,95,108,101,
-100,44,125,44,0,0,0,0,12,19,0,1,40,0,0,0,
-12,61,0,3,108,98,112,0,11,62,0,0,0,0,0,0,
-0,128,81,64,12,63,0,3,110,117,100,0,12,69,0,9,
-112,97,114,101,110,95,110,117,100,0,0,0,9,64,1,69,
-12,65,0,2,98,112,0,0,11,66,0,0,0,0,0,0,
-0,0,84,64,12,67,0,3,108,101,100,0,12,69,0,8,
-99,97,108,108,95,108,101,100,0,0,0,0,9,68,1,69,
-26,20,61,8,30,17,1,51,9,9,9,39,91,39,58,123,
+120,95,108,101,100,0,0,0,9,68,1,69,26,16,61,8,
+30,12,1,57,9,9,9,39,47,39,58,123,39,108,98,112,
+39,58,54,48,44,39,98,112,39,58,54,48,44,39,108,101,
+100,39,58,115,101,108,102,46,105,110,102,105,120,95,108,101,
+100,125,44,0,12,17,0,1,47,0,0,0,12,61,0,3,
+108,98,112,0,11,62,0,1,60,0,0,0,0,0,0,0,
+12,63,0,2,98,112,0,0,11,64,0,1,60,0,0,0,
+0,0,0,0,12,65,0,3,108,101,100,0,12,67,0,9,
+105,110,102,105,120,95,108,101,100,0,0,0,9,66,1,67,
+26,18,61,6,30,18,1,58,9,9,9,39,40,39,58,123,
 39,108,98,112,39,58,55,48,44,39,110,117,100,39,58,115,
-101,108,102,46,108,105,115,116,95,110,117,100,44,39,98,112,
-39,58,56,48,44,39,108,101,100,39,58,115,101,108,102,46,
-103,101,116,95,108,101,100,44,125,44,0,0,12,21,0,1,
-91,0,0,0,12,61,0,3,108,98,112,0,11,62,0,0,
-0,0,0,0,0,128,81,64,12,63,0,3,110,117,100,0,
-12,69,0,8,108,105,115,116,95,110,117,100,0,0,0,0,
-9,64,1,69,12,65,0,2,98,112,0,0,11,66,0,0,
-0,0,0,0,0,0,84,64,12,67,0,3,108,101,100,0,
-12,69,0,7,103,101,116,95,108,101,100,0,9,68,1,69,
-26,22,61,8,30,10,1,52,9,9,9,39,123,39,58,123,
-39,108,98,112,39,58,48,44,39,110,117,100,39,58,115,101,
-108,102,46,100,105,99,116,95,110,117,100,44,125,44,0,0,
-12,23,0,1,123,0,0,0,12,61,0,3,108,98,112,0,
-11,62,0,0,0,0,0,0,0,0,0,0,12,63,0,3,
-110,117,100,0,12,65,0,8,100,105,99,116,95,110,117,100,
-0,0,0,0,9,64,1,65,26,24,61,4,30,15,1,53,
-9,9,9,39,46,39,58,123,39,108,98,112,39,58,56,48,
-44,39,98,112,39,58,56,48,44,39,108,101,100,39,58,115,
-101,108,102,46,100,111,116,95,108,101,100,44,39,116,121,112,
-101,39,58,39,103,101,116,39,44,125,44,0,12,25,0,1,
-46,0,0,0,12,61,0,3,108,98,112,0,11,62,0,0,
-0,0,0,0,0,0,84,64,12,63,0,2,98,112,0,0,
-11,64,0,0,0,0,0,0,0,0,84,64,12,65,0,3,
-108,101,100,0,12,69,0,7,100,111,116,95,108,101,100,0,
-9,66,1,69,12,67,0,4,116,121,112,101,0,0,0,0,
-12,68,0,3,103,101,116,0,26,26,61,8,30,14,1,54,
-9,9,9,39,98,114,101,97,107,39,58,123,39,108,98,112,
-39,58,48,44,39,110,117,100,39,58,115,101,108,102,46,105,
-116,115,101,108,102,44,39,116,121,112,101,39,58,39,98,114,
-101,97,107,39,125,44,0,0,12,27,0,5,98,114,101,97,
-107,0,0,0,12,61,0,3,108,98,112,0,11,62,0,0,
-0,0,0,0,0,0,0,0,12,63,0,3,110,117,100,0,
-12,67,0,6,105,116,115,101,108,102,0,0,9,64,1,67,
-12,65,0,4,116,121,112,101,0,0,0,0,12,66,0,5,
-98,114,101,97,107,0,0,0,26,28,61,6,30,14,1,55,
-9,9,9,39,112,97,115,115,39,58,123,39,108,98,112,39,
-58,48,44,39,110,117,100,39,58,115,101,108,102,46,105,116,
-115,101,108,102,44,39,116,121,112,101,39,58,39,112,97,115,
-115,39,125,44,0,0,0,0,12,29,0,4,112,97,115,115,
-0,0,0,0,12,61,0,3,108,98,112,0,11,62,0,0,
-0,0,0,0,0,0,0,0,12,63,0,3,110,117,100,0,
-12,67,0,6,105,116,115,101,108,102,0,0,9,64,1,67,
-12,65,0,4,116,121,112,101,0,0,0,0,12,66,0,4,
-112,97,115,115,0,0,0,0,26,30,61,6,30,16,1,56,
-9,9,9,39,99,111,110,116,105,110,117,101,39,58,123,39,
-108,98,112,39,58,48,44,39,110,117,100,39,58,115,101,108,
-102,46,105,116,115,101,108,102,44,39,116,121,112,101,39,58,
-39,99,111,110,116,105,110,117,101,39,125,44,0,0,0,0,
-12,31,0,8,99,111,110,116,105,110,117,101,0,0,0,0,
-12,61,0,3,108,98,112,0,11,62,0,0,0,0,0,0,
-0,0,0,0,12,63,0,3,110,117,100,0,12,67,0,6,
-105,116,115,101,108,102,0,0,9,64,1,67,12,65,0,4,
-116,121,112,101,0,0,0,0,12,66,0,8,99,111,110,116,
-105,110,117,101,0,0,0,0,26,32,61,6,30,12,1,57,
-9,9,9,39,101,111,102,39,58,123,39,108,98,112,39,58,
-48,44,39,116,121,112,101,39,58,39,101,111,102,39,44,39,
-118,97,108,39,58,39,101,111,102,39,125,44,0,0,0,0,
-12,33,0,3,101,111,102,0,12,61,0,3,108,98,112,0,
-11,62,0,0,0,0,0,0,0,0,0,0,12,63,0,4,
-116,121,112,101,0,0,0,0,12,64,0,3,101,111,102,0,
-12,65,0,3,118,97,108,0,12,66,0,3,101,111,102,0,
-26,34,61,6,30,14,1,58,9,9,9,39,100,101,102,39,
-58,123,39,108,98,112,39,58,48,44,39,110,117,100,39,58,
-115,101,108,102,46,100,101,102,95,110,117,100,44,39,116,121,
-112,101,39,58,39,100,101,102,39,44,125,44,0,0,0,0,
-12,35,0,3,100,101,102,0,12,61,0,3,108,98,112,0,
-11,62,0,0,0,0,0,0,0,0,0,0,12,63,0,3,
-110,117,100,0,12,67,0,7,100,101,102,95,110,117,100,0,
-9,64,1,67,12,65,0,4,116,121,112,101,0,0,0,0,
-12,66,0,3,100,101,102,0,26,36,61,6,30,15,1,59,
-9,9,9,39,119,104,105,108,101,39,58,123,39,108,98,112,
-39,58,48,44,39,110,117,100,39,58,115,101,108,102,46,119,
-104,105,108,101,95,110,117,100,44,39,116,121,112,101,39,58,
-39,119,104,105,108,101,39,44,125,44,0,0,12,37,0,5,
-119,104,105,108,101,0,0,0,12,61,0,3,108,98,112,0,
-11,62,0,0,0,0,0,0,0,0,0,0,12,63,0,3,
-110,117,100,0,12,67,0,9,119,104,105,108,101,95,110,117,
-100,0,0,0,9,64,1,67,12,65,0,4,116,121,112,101,
-0,0,0,0,12,66,0,5,119,104,105,108,101,0,0,0,
-26,38,61,6,30,14,1,60,9,9,9,39,102,111,114,39,
-58,123,39,108,98,112,39,58,48,44,39,110,117,100,39,58,
-115,101,108,102,46,102,111,114,95,110,117,100,44,39,116,121,
-112,101,39,58,39,102,111,114,39,44,125,44,0,0,0,0,
-12,39,0,3,102,111,114,0,12,61,0,3,108,98,112,0,
-11,62,0,0,0,0,0,0,0,0,0,0,12,63,0,3,
-110,117,100,0,12,67,0,7,102,111,114,95,110,117,100,0,
+101,108,102,46,112,97,114,101,110,95,110,117,100,44,39,98,
+112,39,58,56,48,44,39,108,101,100,39,58,115,101,108,102,
+46,99,97,108,108,95,108,101,100,44,125,44,0,0,0,0,
+12,19,0,1,40,0,0,0,12,61,0,3,108,98,112,0,
+11,62,0,1,70,0,0,0,0,0,0,0,12,63,0,3,
+110,117,100,0,12,69,0,9,112,97,114,101,110,95,110,117,
+100,0,0,0,9,64,1,69,12,65,0,2,98,112,0,0,
+11,66,0,1,80,0,0,0,0,0,0,0,12,67,0,3,
+108,101,100,0,12,69,0,8,99,97,108,108,95,108,101,100,
+0,0,0,0,9,68,1,69,26,20,61,8,30,17,1,59,
+9,9,9,39,91,39,58,123,39,108,98,112,39,58,55,48,
+44,39,110,117,100,39,58,115,101,108,102,46,108,105,115,116,
+95,110,117,100,44,39,98,112,39,58,56,48,44,39,108,101,
+100,39,58,115,101,108,102,46,103,101,116,95,108,101,100,44,
+125,44,0,0,12,21,0,1,91,0,0,0,12,61,0,3,
+108,98,112,0,11,62,0,1,70,0,0,0,0,0,0,0,
+12,63,0,3,110,117,100,0,12,69,0,8,108,105,115,116,
+95,110,117,100,0,0,0,0,9,64,1,69,12,65,0,2,
+98,112,0,0,11,66,0,1,80,0,0,0,0,0,0,0,
+12,67,0,3,108,101,100,0,12,69,0,7,103,101,116,95,
+108,101,100,0,9,68,1,69,26,22,61,8,30,10,1,60,
+9,9,9,39,123,39,58,123,39,108,98,112,39,58,48,44,
+39,110,117,100,39,58,115,101,108,102,46,100,105,99,116,95,
+110,117,100,44,125,44,0,0,12,23,0,1,123,0,0,0,
+12,61,0,3,108,98,112,0,11,62,0,1,0,0,0,0,
+0,0,0,0,12,63,0,3,110,117,100,0,12,65,0,8,
+100,105,99,116,95,110,117,100,0,0,0,0,9,64,1,65,
+26,24,61,4,30,15,1,61,9,9,9,39,46,39,58,123,
+39,108,98,112,39,58,56,48,44,39,98,112,39,58,56,48,
+44,39,108,101,100,39,58,115,101,108,102,46,100,111,116,95,
+108,101,100,44,39,116,121,112,101,39,58,39,103,101,116,39,
+44,125,44,0,12,25,0,1,46,0,0,0,12,61,0,3,
+108,98,112,0,11,62,0,1,80,0,0,0,0,0,0,0,
+12,63,0,2,98,112,0,0,11,64,0,1,80,0,0,0,
+0,0,0,0,12,65,0,3,108,101,100,0,12,69,0,7,
+100,111,116,95,108,101,100,0,9,66,1,69,12,67,0,4,
+116,121,112,101,0,0,0,0,12,68,0,3,103,101,116,0,
+26,26,61,8,30,14,1,62,9,9,9,39,98,114,101,97,
+107,39,58,123,39,108,98,112,39,58,48,44,39,110,117,100,
+39,58,115,101,108,102,46,105,116,115,101,108,102,44,39,116,
+121,112,101,39,58,39,98,114,101,97,107,39,125,44,0,0,
+12,27,0,5,98,114,101,97,107,0,0,0,12,61,0,3,
+108,98,112,0,11,62,0,1,0,0,0,0,0,0,0,0,
+12,63,0,3,110,117,100,0,12,67,0,6,105,116,115,101,
+108,102,0,0,9,64,1,67,12,65,0,4,116,121,112,101,
+0,0,0,0,12,66,0,5,98,114,101,97,107,0,0,0,
+26,28,61,6,30,14,1,63,9,9,9,39,112,97,115,115,
+39,58,123,39,108,98,112,39,58,48,44,39,110,117,100,39,
+58,115,101,108,102,46,105,116,115,101,108,102,44,39,116,121,
+112,101,39,58,39,112,97,115,115,39,125,44,0,0,0,0,
+12,29,0,4,112,97,115,115,0,0,0,0,12,61,0,3,
+108,98,112,0,11,62,0,1,0,0,0,0,0,0,0,0,
+12,63,0,3,110,117,100,0,12,67,0,6,105,116,115,101,
+108,102,0,0,9,64,1,67,12,65,0,4,116,121,112,101,
+0,0,0,0,12,66,0,4,112,97,115,115,0,0,0,0,
+26,30,61,6,30,16,1,64,9,9,9,39,99,111,110,116,
+105,110,117,101,39,58,123,39,108,98,112,39,58,48,44,39,
+110,117,100,39,58,115,101,108,102,46,105,116,115,101,108,102,
+44,39,116,121,112,101,39,58,39,99,111,110,116,105,110,117,
+101,39,125,44,0,0,0,0,12,31,0,8,99,111,110,116,
+105,110,117,101,0,0,0,0,12,61,0,3,108,98,112,0,
+11,62,0,1,0,0,0,0,0,0,0,0,12,63,0,3,
+110,117,100,0,12,67,0,6,105,116,115,101,108,102,0,0,
 9,64,1,67,12,65,0,4,116,121,112,101,0,0,0,0,
-12,66,0,3,102,111,114,0,26,40,61,6,30,14,1,61,
-9,9,9,39,116,114,121,39,58,123,39,108,98,112,39,58,
-48,44,39,110,117,100,39,58,115,101,108,102,46,116,114,121,
-95,110,117,100,44,39,116,121,112,101,39,58,39,116,114,121,
-39,44,125,44,0,0,0,0,12,41,0,3,116,114,121,0,
-12,61,0,3,108,98,112,0,11,62,0,0,0,0,0,0,
+12,66,0,8,99,111,110,116,105,110,117,101,0,0,0,0,
+26,32,61,6,30,12,1,65,9,9,9,39,101,111,102,39,
+58,123,39,108,98,112,39,58,48,44,39,116,121,112,101,39,
+58,39,101,111,102,39,44,39,118,97,108,39,58,39,101,111,
+102,39,125,44,0,0,0,0,12,33,0,3,101,111,102,0,
+12,61,0,3,108,98,112,0,11,62,0,1,0,0,0,0,
+0,0,0,0,12,63,0,4,116,121,112,101,0,0,0,0,
+12,64,0,3,101,111,102,0,12,65,0,3,118,97,108,0,
+12,66,0,3,101,111,102,0,26,34,61,6,30,14,1,66,
+9,9,9,39,100,101,102,39,58,123,39,108,98,112,39,58,
+48,44,39,110,117,100,39,58,115,101,108,102,46,100,101,102,
+95,110,117,100,44,39,116,121,112,101,39,58,39,100,101,102,
+39,44,125,44,0,0,0,0,12,35,0,3,100,101,102,0,
+12,61,0,3,108,98,112,0,11,62,0,1,0,0,0,0,
 0,0,0,0,12,63,0,3,110,117,100,0,12,67,0,7,
-116,114,121,95,110,117,100,0,9,64,1,67,12,65,0,4,
-116,121,112,101,0,0,0,0,12,66,0,3,116,114,121,0,
-26,42,61,6,30,13,1,62,9,9,9,39,105,102,39,58,
-123,39,108,98,112,39,58,48,44,39,110,117,100,39,58,115,
-101,108,102,46,105,102,95,110,117,100,44,39,116,121,112,101,
-39,58,39,105,102,39,44,125,44,0,0,0,12,43,0,2,
-105,102,0,0,12,61,0,3,108,98,112,0,11,62,0,0,
-0,0,0,0,0,0,0,0,12,63,0,3,110,117,100,0,
-12,67,0,6,105,102,95,110,117,100,0,0,9,64,1,67,
-12,65,0,4,116,121,112,101,0,0,0,0,12,66,0,2,
-105,102,0,0,26,44,61,6,30,15,1,63,9,9,9,39,
-99,108,97,115,115,39,58,123,39,108,98,112,39,58,48,44,
-39,110,117,100,39,58,115,101,108,102,46,99,108,97,115,115,
-95,110,117,100,44,39,116,121,112,101,39,58,39,99,108,97,
-115,115,39,44,125,44,0,0,12,45,0,5,99,108,97,115,
-115,0,0,0,12,61,0,3,108,98,112,0,11,62,0,0,
-0,0,0,0,0,0,0,0,12,63,0,3,110,117,100,0,
-12,67,0,9,99,108,97,115,115,95,110,117,100,0,0,0,
+100,101,102,95,110,117,100,0,9,64,1,67,12,65,0,4,
+116,121,112,101,0,0,0,0,12,66,0,3,100,101,102,0,
+26,36,61,6,30,15,1,67,9,9,9,39,119,104,105,108,
+101,39,58,123,39,108,98,112,39,58,48,44,39,110,117,100,
+39,58,115,101,108,102,46,119,104,105,108,101,95,110,117,100,
+44,39,116,121,112,101,39,58,39,119,104,105,108,101,39,44,
+125,44,0,0,12,37,0,5,119,104,105,108,101,0,0,0,
+12,61,0,3,108,98,112,0,11,62,0,1,0,0,0,0,
+0,0,0,0,12,63,0,3,110,117,100,0,12,67,0,9,
+119,104,105,108,101,95,110,117,100,0,0,0,9,64,1,67,
+12,65,0,4,116,121,112,101,0,0,0,0,12,66,0,5,
+119,104,105,108,101,0,0,0,26,38,61,6,30,14,1,68,
+9,9,9,39,102,111,114,39,58,123,39,108,98,112,39,58,
+48,44,39,110,117,100,39,58,115,101,108,102,46,102,111,114,
+95,110,117,100,44,39,116,121,112,101,39,58,39,102,111,114,
+39,44,125,44,0,0,0,0,12,39,0,3,102,111,114,0,
+12,61,0,3,108,98,112,0,11,62,0,1,0,0,0,0,
+0,0,0,0,12,63,0,3,110,117,100,0,12,67,0,7,
+102,111,114,95,110,117,100,0,9,64,1,67,12,65,0,4,
+116,121,112,101,0,0,0,0,12,66,0,3,102,111,114,0,
+26,40,61,6,30,14,1,69,9,9,9,39,116,114,121,39,
+58,123,39,108,98,112,39,58,48,44,39,110,117,100,39,58,
+115,101,108,102,46,116,114,121,95,110,117,100,44,39,116,121,
+112,101,39,58,39,116,114,121,39,44,125,44,0,0,0,0,
+12,41,0,3,116,114,121,0,12,61,0,3,108,98,112,0,
+11,62,0,1,0,0,0,0,0,0,0,0,12,63,0,3,
+110,117,100,0,12,67,0,7,116,114,121,95,110,117,100,0,
 9,64,1,67,12,65,0,4,116,121,112,101,0,0,0,0,
-12,66,0,5,99,108,97,115,115,0,0,0,26,46,61,6,
-30,18,1,64,9,9,9,39,114,97,105,115,101,39,58,123,
+12,66,0,3,116,114,121,0,26,42,61,6,30,13,1,70,
+9,9,9,39,105,102,39,58,123,39,108,98,112,39,58,48,
+44,39,110,117,100,39,58,115,101,108,102,46,105,102,95,110,
+117,100,44,39,116,121,112,101,39,58,39,105,102,39,44,125,
+44,0,0,0,12,43,0,2,105,102,0,0,12,61,0,3,
+108,98,112,0,11,62,0,1,0,0,0,0,0,0,0,0,
+12,63,0,3,110,117,100,0,12,67,0,6,105,102,95,110,
+117,100,0,0,9,64,1,67,12,65,0,4,116,121,112,101,
+0,0,0,0,12,66,0,2,105,102,0,0,26,44,61,6,
+30,15,1,71,9,9,9,39,99,108,97,115,115,39,58,123,
 39,108,98,112,39,58,48,44,39,110,117,100,39,58,115,101,
-108,102,46,112,114,101,102,105,120,95,110,117,100,48,44,39,
-116,121,112,101,39,58,39,114,97,105,115,101,39,44,39,98,
-112,39,58,50,48,44,125,44,0,0,0,0,12,47,0,5,
-114,97,105,115,101,0,0,0,12,61,0,3,108,98,112,0,
-11,62,0,0,0,0,0,0,0,0,0,0,12,63,0,3,
+108,102,46,99,108,97,115,115,95,110,117,100,44,39,116,121,
+112,101,39,58,39,99,108,97,115,115,39,44,125,44,0,0,
+12,45,0,5,99,108,97,115,115,0,0,0,12,61,0,3,
+108,98,112,0,11,62,0,1,0,0,0,0,0,0,0,0,
+12,63,0,3,110,117,100,0,12,67,0,9,99,108,97,115,
+115,95,110,117,100,0,0,0,9,64,1,67,12,65,0,4,
+116,121,112,101,0,0,0,0,12,66,0,5,99,108,97,115,
+115,0,0,0,26,46,61,6,30,18,1,72,9,9,9,39,
+114,97,105,115,101,39,58,123,39,108,98,112,39,58,48,44,
+39,110,117,100,39,58,115,101,108,102,46,112,114,101,102,105,
+120,95,110,117,100,48,44,39,116,121,112,101,39,58,39,114,
+97,105,115,101,39,44,39,98,112,39,58,50,48,44,125,44,
+0,0,0,0,12,47,0,5,114,97,105,115,101,0,0,0,
+12,61,0,3,108,98,112,0,11,62,0,1,0,0,0,0,
+0,0,0,0,12,63,0,3,110,117,100,0,12,69,0,11,
+112,114,101,102,105,120,95,110,117,100,48,0,9,64,1,69,
+12,65,0,4,116,121,112,101,0,0,0,0,12,66,0,5,
+114,97,105,115,101,0,0,0,12,67,0,2,98,112,0,0,
+11,68,0,1,20,0,0,0,0,0,0,0,26,48,61,8,
+30,18,1,73,9,9,9,39,114,101,116,117,114,110,39,58,
+123,39,108,98,112,39,58,48,44,39,110,117,100,39,58,115,
+101,108,102,46,112,114,101,102,105,120,95,110,117,100,48,44,
+39,116,121,112,101,39,58,39,114,101,116,117,114,110,39,44,
+39,98,112,39,58,49,48,44,125,44,0,0,12,49,0,6,
+114,101,116,117,114,110,0,0,12,61,0,3,108,98,112,0,
+11,62,0,1,0,0,0,0,0,0,0,0,12,63,0,3,
 110,117,100,0,12,69,0,11,112,114,101,102,105,120,95,110,
 117,100,48,0,9,64,1,69,12,65,0,4,116,121,112,101,
-0,0,0,0,12,66,0,5,114,97,105,115,101,0,0,0,
-12,67,0,2,98,112,0,0,11,68,0,0,0,0,0,0,
-0,0,52,64,26,48,61,8,30,18,1,65,9,9,9,39,
-114,101,116,117,114,110,39,58,123,39,108,98,112,39,58,48,
+0,0,0,0,12,66,0,6,114,101,116,117,114,110,0,0,
+12,67,0,2,98,112,0,0,11,68,0,1,10,0,0,0,
+0,0,0,0,26,50,61,8,30,18,1,74,9,9,9,39,
+105,109,112,111,114,116,39,58,123,39,108,98,112,39,58,48,
 44,39,110,117,100,39,58,115,101,108,102,46,112,114,101,102,
-105,120,95,110,117,100,48,44,39,116,121,112,101,39,58,39,
-114,101,116,117,114,110,39,44,39,98,112,39,58,49,48,44,
-125,44,0,0,12,49,0,6,114,101,116,117,114,110,0,0,
-12,61,0,3,108,98,112,0,11,62,0,0,0,0,0,0,
+105,120,95,110,117,100,115,44,39,116,121,112,101,39,58,39,
+105,109,112,111,114,116,39,44,39,98,112,39,58,50,48,44,
+125,44,0,0,12,51,0,6,105,109,112,111,114,116,0,0,
+12,61,0,3,108,98,112,0,11,62,0,1,0,0,0,0,
 0,0,0,0,12,63,0,3,110,117,100,0,12,69,0,11,
-112,114,101,102,105,120,95,110,117,100,48,0,9,64,1,69,
+112,114,101,102,105,120,95,110,117,100,115,0,9,64,1,69,
 12,65,0,4,116,121,112,101,0,0,0,0,12,66,0,6,
-114,101,116,117,114,110,0,0,12,67,0,2,98,112,0,0,
-11,68,0,0,0,0,0,0,0,0,36,64,26,50,61,8,
-30,18,1,66,9,9,9,39,105,109,112,111,114,116,39,58,
-123,39,108,98,112,39,58,48,44,39,110,117,100,39,58,115,
-101,108,102,46,112,114,101,102,105,120,95,110,117,100,115,44,
-39,116,121,112,101,39,58,39,105,109,112,111,114,116,39,44,
-39,98,112,39,58,50,48,44,125,44,0,0,12,51,0,6,
-105,109,112,111,114,116,0,0,12,61,0,3,108,98,112,0,
-11,62,0,0,0,0,0,0,0,0,0,0,12,63,0,3,
-110,117,100,0,12,69,0,11,112,114,101,102,105,120,95,110,
-117,100,115,0,9,64,1,69,12,65,0,4,116,121,112,101,
-0,0,0,0,12,66,0,6,105,109,112,111,114,116,0,0,
-12,67,0,2,98,112,0,0,11,68,0,0,0,0,0,0,
-0,0,52,64,26,52,61,8,30,16,1,67,9,9,9,39,
-102,114,111,109,39,58,123,39,108,98,112,39,58,48,44,39,
-110,117,100,39,58,115,101,108,102,46,102,114,111,109,95,110,
-117,100,44,39,116,121,112,101,39,58,39,102,114,111,109,39,
-44,39,98,112,39,58,50,48,44,125,44,0,12,53,0,4,
-102,114,111,109,0,0,0,0,12,61,0,3,108,98,112,0,
-11,62,0,0,0,0,0,0,0,0,0,0,12,63,0,3,
-110,117,100,0,12,69,0,8,102,114,111,109,95,110,117,100,
-0,0,0,0,9,64,1,69,12,65,0,4,116,121,112,101,
-0,0,0,0,12,66,0,4,102,114,111,109,0,0,0,0,
-12,67,0,2,98,112,0,0,11,68,0,0,0,0,0,0,
-0,0,52,64,26,54,61,8,30,17,1,68,9,9,9,39,
-100,101,108,39,58,123,39,108,98,112,39,58,48,44,39,110,
-117,100,39,58,115,101,108,102,46,112,114,101,102,105,120,95,
-110,117,100,115,44,39,116,121,112,101,39,58,39,100,101,108,
-39,44,39,98,112,39,58,49,48,44,125,44,0,0,0,0,
-12,55,0,3,100,101,108,0,12,61,0,3,108,98,112,0,
-11,62,0,0,0,0,0,0,0,0,0,0,12,63,0,3,
-110,117,100,0,12,69,0,11,112,114,101,102,105,120,95,110,
-117,100,115,0,9,64,1,69,12,65,0,4,116,121,112,101,
-0,0,0,0,12,66,0,3,100,101,108,0,12,67,0,2,
-98,112,0,0,11,68,0,0,0,0,0,0,0,0,36,64,
-26,56,61,8,30,18,1,69,9,9,9,39,103,108,111,98,
-97,108,39,58,123,39,108,98,112,39,58,48,44,39,110,117,
-100,39,58,115,101,108,102,46,112,114,101,102,105,120,95,110,
-117,100,115,44,39,116,121,112,101,39,58,39,103,108,111,98,
-97,108,115,39,44,39,98,112,39,58,50,48,44,125,44,0,
-12,57,0,6,103,108,111,98,97,108,0,0,12,61,0,3,
-108,98,112,0,11,62,0,0,0,0,0,0,0,0,0,0,
-12,63,0,3,110,117,100,0,12,69,0,11,112,114,101,102,
-105,120,95,110,117,100,115,0,9,64,1,69,12,65,0,4,
-116,121,112,101,0,0,0,0,12,66,0,7,103,108,111,98,
-97,108,115,0,12,67,0,2,98,112,0,0,11,68,0,0,
-0,0,0,0,0,0,52,64,26,58,61,8,30,12,1,70,
-9,9,9,39,61,39,58,123,39,108,98,112,39,58,49,48,
-44,39,98,112,39,58,57,44,39,108,101,100,39,58,115,101,
-108,102,46,105,110,102,105,120,95,108,101,100,44,125,44,0,
-12,59,0,1,61,0,0,0,12,61,0,3,108,98,112,0,
-11,62,0,0,0,0,0,0,0,0,36,64,12,63,0,2,
-98,112,0,0,11,64,0,0,0,0,0,0,0,0,34,64,
-12,65,0,3,108,101,100,0,12,67,0,9,105,110,102,105,
-120,95,108,101,100,0,0,0,9,66,1,67,26,60,61,6,
-26,2,3,58,30,6,1,41,9,9,115,101,108,102,46,98,
-97,115,101,95,100,109,97,112,32,61,32,123,0,0,0,0,
-12,3,0,9,98,97,115,101,95,100,109,97,112,0,0,0,
-10,1,3,2,30,16,1,73,9,9,115,101,108,102,46,105,
+105,109,112,111,114,116,0,0,12,67,0,2,98,112,0,0,
+11,68,0,1,20,0,0,0,0,0,0,0,26,52,61,8,
+30,16,1,75,9,9,9,39,102,114,111,109,39,58,123,39,
+108,98,112,39,58,48,44,39,110,117,100,39,58,115,101,108,
+102,46,102,114,111,109,95,110,117,100,44,39,116,121,112,101,
+39,58,39,102,114,111,109,39,44,39,98,112,39,58,50,48,
+44,125,44,0,12,53,0,4,102,114,111,109,0,0,0,0,
+12,61,0,3,108,98,112,0,11,62,0,1,0,0,0,0,
+0,0,0,0,12,63,0,3,110,117,100,0,12,69,0,8,
+102,114,111,109,95,110,117,100,0,0,0,0,9,64,1,69,
+12,65,0,4,116,121,112,101,0,0,0,0,12,66,0,4,
+102,114,111,109,0,0,0,0,12,67,0,2,98,112,0,0,
+11,68,0,1,20,0,0,0,0,0,0,0,26,54,61,8,
+30,17,1,76,9,9,9,39,100,101,108,39,58,123,39,108,
+98,112,39,58,48,44,39,110,117,100,39,58,115,101,108,102,
+46,112,114,101,102,105,120,95,110,117,100,115,44,39,116,121,
+112,101,39,58,39,100,101,108,39,44,39,98,112,39,58,49,
+48,44,125,44,0,0,0,0,12,55,0,3,100,101,108,0,
+12,61,0,3,108,98,112,0,11,62,0,1,0,0,0,0,
+0,0,0,0,12,63,0,3,110,117,100,0,12,69,0,11,
+112,114,101,102,105,120,95,110,117,100,115,0,9,64,1,69,
+12,65,0,4,116,121,112,101,0,0,0,0,12,66,0,3,
+100,101,108,0,12,67,0,2,98,112,0,0,11,68,0,1,
+10,0,0,0,0,0,0,0,26,56,61,8,30,18,1,77,
+9,9,9,39,103,108,111,98,97,108,39,58,123,39,108,98,
+112,39,58,48,44,39,110,117,100,39,58,115,101,108,102,46,
+112,114,101,102,105,120,95,110,117,100,115,44,39,116,121,112,
+101,39,58,39,103,108,111,98,97,108,115,39,44,39,98,112,
+39,58,50,48,44,125,44,0,12,57,0,6,103,108,111,98,
+97,108,0,0,12,61,0,3,108,98,112,0,11,62,0,1,
+0,0,0,0,0,0,0,0,12,63,0,3,110,117,100,0,
+12,69,0,11,112,114,101,102,105,120,95,110,117,100,115,0,
+9,64,1,69,12,65,0,4,116,121,112,101,0,0,0,0,
+12,66,0,7,103,108,111,98,97,108,115,0,12,67,0,2,
+98,112,0,0,11,68,0,1,20,0,0,0,0,0,0,0,
+26,58,61,8,30,12,1,78,9,9,9,39,61,39,58,123,
+39,108,98,112,39,58,49,48,44,39,98,112,39,58,57,44,
+39,108,101,100,39,58,115,101,108,102,46,105,110,102,105,120,
+95,108,101,100,44,125,44,0,12,59,0,1,61,0,0,0,
+12,61,0,3,108,98,112,0,11,62,0,1,10,0,0,0,
+0,0,0,0,12,63,0,2,98,112,0,0,11,64,0,1,
+9,0,0,0,0,0,0,0,12,65,0,3,108,101,100,0,
+12,67,0,9,105,110,102,105,120,95,108,101,100,0,0,0,
+9,66,1,67,26,60,61,6,26,2,3,58,30,6,1,49,
+9,9,115,101,108,102,46,98,97,115,101,95,100,109,97,112,
+32,61,32,123,0,0,0,0,12,3,0,9,98,97,115,101,
+95,100,109,97,112,0,0,0,10,1,3,2,30,16,1,81,
+9,9,115,101,108,102,46,105,95,105,110,102,105,120,40,52,
+48,44,115,101,108,102,46,105,110,102,105,120,95,108,101,100,
+44,39,60,39,44,39,62,39,44,39,60,61,39,44,39,62,
+61,39,44,39,33,61,39,44,39,61,61,39,41,0,0,0,
+12,13,0,7,105,95,105,110,102,105,120,0,49,3,1,13,
+11,5,0,1,40,0,0,0,0,0,0,0,12,13,0,9,
+105,110,102,105,120,95,108,101,100,0,0,0,9,6,1,13,
+12,7,0,1,60,0,0,0,12,8,0,1,62,0,0,0,
+12,9,0,2,60,61,0,0,12,10,0,2,62,61,0,0,
+12,11,0,2,33,61,0,0,12,12,0,2,61,61,0,0,
+50,2,3,8,30,11,1,82,9,9,115,101,108,102,46,105,
 95,105,110,102,105,120,40,52,48,44,115,101,108,102,46,105,
-110,102,105,120,95,108,101,100,44,39,60,39,44,39,62,39,
-44,39,60,61,39,44,39,62,61,39,44,39,33,61,39,44,
-39,61,61,39,41,0,0,0,12,4,0,7,105,95,105,110,
-102,105,120,0,9,3,1,4,11,4,0,0,0,0,0,0,
-0,0,68,64,12,12,0,9,105,110,102,105,120,95,108,101,
-100,0,0,0,9,5,1,12,12,6,0,1,60,0,0,0,
-12,7,0,1,62,0,0,0,12,8,0,2,60,61,0,0,
-12,9,0,2,62,61,0,0,12,10,0,2,33,61,0,0,
-12,11,0,2,61,61,0,0,31,2,4,8,19,2,3,2,
-30,11,1,74,9,9,115,101,108,102,46,105,95,105,110,102,
-105,120,40,52,48,44,115,101,108,102,46,105,110,102,105,120,
-95,105,115,44,39,105,115,39,44,39,105,110,39,41,0,0,
-12,4,0,7,105,95,105,110,102,105,120,0,9,3,1,4,
-11,4,0,0,0,0,0,0,0,0,68,64,12,8,0,8,
-105,110,102,105,120,95,105,115,0,0,0,0,9,5,1,8,
-12,6,0,2,105,115,0,0,12,7,0,2,105,110,0,0,
-31,2,4,4,19,2,3,2,30,18,1,75,9,9,115,101,
+110,102,105,120,95,105,115,44,39,105,115,39,44,39,105,110,
+39,41,0,0,12,9,0,7,105,95,105,110,102,105,120,0,
+49,3,1,9,11,5,0,1,40,0,0,0,0,0,0,0,
+12,9,0,8,105,110,102,105,120,95,105,115,0,0,0,0,
+9,6,1,9,12,7,0,2,105,115,0,0,12,8,0,2,
+105,110,0,0,50,2,3,4,30,18,1,83,9,9,115,101,
 108,102,46,105,95,105,110,102,105,120,40,49,48,44,115,101,
 108,102,46,105,110,102,105,120,95,108,101,100,44,39,43,61,
 39,44,39,45,61,39,44,39,42,61,39,44,39,47,61,39,
 44,32,39,38,61,39,44,32,39,124,61,39,44,32,39,94,
-61,39,41,0,12,4,0,7,105,95,105,110,102,105,120,0,
-9,3,1,4,11,4,0,0,0,0,0,0,0,0,36,64,
-12,13,0,9,105,110,102,105,120,95,108,101,100,0,0,0,
-9,5,1,13,12,6,0,2,43,61,0,0,12,7,0,2,
-45,61,0,0,12,8,0,2,42,61,0,0,12,9,0,2,
-47,61,0,0,12,10,0,2,38,61,0,0,12,11,0,2,
-124,61,0,0,12,12,0,2,94,61,0,0,31,2,4,9,
-19,2,3,2,30,11,1,76,9,9,115,101,108,102,46,105,
-95,105,110,102,105,120,40,51,50,44,115,101,108,102,46,105,
-110,102,105,120,95,108,101,100,44,39,97,110,100,39,44,39,
-38,39,41,0,12,4,0,7,105,95,105,110,102,105,120,0,
-9,3,1,4,11,4,0,0,0,0,0,0,0,0,64,64,
-12,8,0,9,105,110,102,105,120,95,108,101,100,0,0,0,
-9,5,1,8,12,6,0,3,97,110,100,0,12,7,0,1,
-38,0,0,0,31,2,4,4,19,2,3,2,30,10,1,77,
+61,39,41,0,12,14,0,7,105,95,105,110,102,105,120,0,
+49,3,1,14,11,5,0,1,10,0,0,0,0,0,0,0,
+12,14,0,9,105,110,102,105,120,95,108,101,100,0,0,0,
+9,6,1,14,12,7,0,2,43,61,0,0,12,8,0,2,
+45,61,0,0,12,9,0,2,42,61,0,0,12,10,0,2,
+47,61,0,0,12,11,0,2,38,61,0,0,12,12,0,2,
+124,61,0,0,12,13,0,2,94,61,0,0,50,2,3,9,
+30,11,1,84,9,9,115,101,108,102,46,105,95,105,110,102,
+105,120,40,51,50,44,115,101,108,102,46,105,110,102,105,120,
+95,108,101,100,44,39,97,110,100,39,44,39,38,39,41,0,
+12,9,0,7,105,95,105,110,102,105,120,0,49,3,1,9,
+11,5,0,1,32,0,0,0,0,0,0,0,12,9,0,9,
+105,110,102,105,120,95,108,101,100,0,0,0,9,6,1,9,
+12,7,0,3,97,110,100,0,12,8,0,1,38,0,0,0,
+50,2,3,4,30,10,1,85,9,9,115,101,108,102,46,105,
+95,105,110,102,105,120,40,51,49,44,115,101,108,102,46,105,
+110,102,105,120,95,108,101,100,44,39,94,39,41,0,0,0,
+12,8,0,7,105,95,105,110,102,105,120,0,49,3,1,8,
+11,5,0,1,31,0,0,0,0,0,0,0,12,8,0,9,
+105,110,102,105,120,95,108,101,100,0,0,0,9,6,1,8,
+12,7,0,1,94,0,0,0,50,2,3,3,30,11,1,86,
 9,9,115,101,108,102,46,105,95,105,110,102,105,120,40,51,
-49,44,115,101,108,102,46,105,110,102,105,120,95,108,101,100,
-44,39,94,39,41,0,0,0,12,4,0,7,105,95,105,110,
-102,105,120,0,9,3,1,4,11,4,0,0,0,0,0,0,
-0,0,63,64,12,7,0,9,105,110,102,105,120,95,108,101,
-100,0,0,0,9,5,1,7,12,6,0,1,94,0,0,0,
-31,2,4,3,19,2,3,2,30,11,1,78,9,9,115,101,
-108,102,46,105,95,105,110,102,105,120,40,51,48,44,115,101,
-108,102,46,105,110,102,105,120,95,108,101,100,44,39,111,114,
-39,44,39,124,39,41,0,0,12,4,0,7,105,95,105,110,
-102,105,120,0,9,3,1,4,11,4,0,0,0,0,0,0,
-0,0,62,64,12,8,0,9,105,110,102,105,120,95,108,101,
-100,0,0,0,9,5,1,8,12,6,0,2,111,114,0,0,
-12,7,0,1,124,0,0,0,31,2,4,4,19,2,3,2,
-30,11,1,79,9,9,115,101,108,102,46,105,95,105,110,102,
+48,44,115,101,108,102,46,105,110,102,105,120,95,108,101,100,
+44,39,111,114,39,44,39,124,39,41,0,0,12,9,0,7,
+105,95,105,110,102,105,120,0,49,3,1,9,11,5,0,1,
+30,0,0,0,0,0,0,0,12,9,0,9,105,110,102,105,
+120,95,108,101,100,0,0,0,9,6,1,9,12,7,0,2,
+111,114,0,0,12,8,0,1,124,0,0,0,50,2,3,4,
+30,11,1,87,9,9,115,101,108,102,46,105,95,105,110,102,
 105,120,40,51,54,44,115,101,108,102,46,105,110,102,105,120,
 95,108,101,100,44,39,60,60,39,44,39,62,62,39,41,0,
-12,4,0,7,105,95,105,110,102,105,120,0,9,3,1,4,
-11,4,0,0,0,0,0,0,0,0,66,64,12,8,0,9,
-105,110,102,105,120,95,108,101,100,0,0,0,9,5,1,8,
-12,6,0,2,60,60,0,0,12,7,0,2,62,62,0,0,
-31,2,4,4,19,2,3,2,30,33,1,81,9,9,115,101,
-108,102,46,105,95,116,101,114,109,115,40,39,41,39,44,39,
-125,39,44,39,93,39,44,39,59,39,44,39,58,39,44,39,
-110,108,39,44,39,101,108,105,102,39,44,39,101,108,115,101,
-39,44,39,84,114,117,101,39,44,39,70,97,108,115,101,39,
-44,39,78,111,110,101,39,44,39,110,97,109,101,39,44,39,
-115,116,114,105,110,103,39,44,39,110,117,109,98,101,114,39,
-44,39,105,110,100,101,110,116,39,44,39,100,101,100,101,110,
-116,39,44,39,101,120,99,101,112,116,39,41,0,0,0,0,
-12,4,0,7,105,95,116,101,114,109,115,0,9,3,1,4,
-12,4,0,1,41,0,0,0,12,5,0,1,125,0,0,0,
-12,6,0,1,93,0,0,0,12,7,0,1,59,0,0,0,
-12,8,0,1,58,0,0,0,12,9,0,2,110,108,0,0,
-12,10,0,4,101,108,105,102,0,0,0,0,12,11,0,4,
-101,108,115,101,0,0,0,0,12,12,0,4,84,114,117,101,
-0,0,0,0,12,13,0,5,70,97,108,115,101,0,0,0,
-12,14,0,4,78,111,110,101,0,0,0,0,12,15,0,4,
-110,97,109,101,0,0,0,0,12,16,0,6,115,116,114,105,
-110,103,0,0,12,17,0,6,110,117,109,98,101,114,0,0,
-12,18,0,6,105,110,100,101,110,116,0,0,12,19,0,6,
-100,101,100,101,110,116,0,0,12,20,0,6,101,120,99,101,
-112,116,0,0,31,2,4,17,19,2,3,2,30,10,1,82,
-9,9,115,101,108,102,46,98,97,115,101,95,100,109,97,112,
-91,39,110,108,39,93,91,39,118,97,108,39,93,32,61,32,
-39,110,108,39,0,0,0,0,12,3,0,9,98,97,115,101,
-95,100,109,97,112,0,0,0,9,2,1,3,12,3,0,2,
-110,108,0,0,9,2,2,3,12,3,0,2,110,108,0,0,
-12,4,0,3,118,97,108,0,10,2,4,3,0,0,0,0,
-12,22,0,8,95,95,105,110,105,116,95,95,0,0,0,0,
-10,7,22,21,16,22,0,114,44,7,0,0,30,6,1,85,
-9,100,101,102,32,99,104,101,99,107,40,115,101,108,102,44,
-116,44,42,118,115,41,58,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,5,
-99,104,101,99,107,0,0,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,12,4,0,1,
-42,0,0,0,9,3,0,4,30,8,1,86,9,9,105,102,
-32,118,115,91,48,93,32,61,61,32,78,111,110,101,58,32,
-114,101,116,117,114,110,32,84,114,117,101,0,11,5,0,0,
-0,0,0,0,0,0,0,0,9,4,3,5,28,5,0,0,
-23,4,4,5,21,4,0,0,18,0,0,6,11,4,0,0,
-0,0,0,0,0,0,240,63,20,4,0,0,18,0,0,1,
-30,8,1,87,9,9,105,102,32,116,46,116,121,112,101,32,
-105,110,32,118,115,58,32,114,101,116,117,114,110,32,84,114,
-117,101,0,0,12,6,0,4,116,121,112,101,0,0,0,0,
-9,5,2,6,36,4,3,5,21,4,0,0,18,0,0,6,
-11,4,0,0,0,0,0,0,0,0,240,63,20,4,0,0,
-18,0,0,1,30,14,1,88,9,9,105,102,32,116,46,116,
-121,112,101,32,61,61,32,39,115,121,109,98,111,108,39,32,
-97,110,100,32,116,46,118,97,108,32,105,110,32,118,115,58,
-32,114,101,116,117,114,110,32,84,114,117,101,0,0,0,0,
-12,5,0,4,116,121,112,101,0,0,0,0,9,4,2,5,
-12,5,0,6,115,121,109,98,111,108,0,0,23,4,4,5,
-21,4,0,0,18,0,0,5,12,6,0,3,118,97,108,0,
-9,5,2,6,36,4,3,5,21,4,0,0,18,0,0,6,
-11,4,0,0,0,0,0,0,0,0,240,63,20,4,0,0,
-18,0,0,1,30,4,1,89,9,9,114,101,116,117,114,110,
-32,70,97,108,115,101,0,0,11,4,0,0,0,0,0,0,
-0,0,0,0,20,4,0,0,0,0,0,0,12,23,0,5,
-99,104,101,99,107,0,0,0,10,7,23,22,16,23,0,110,
-44,11,0,0,30,6,1,92,9,100,101,102,32,116,119,101,
-97,107,40,115,101,108,102,44,107,44,118,41,58,0,0,0,
+12,9,0,7,105,95,105,110,102,105,120,0,49,3,1,9,
+11,5,0,1,36,0,0,0,0,0,0,0,12,9,0,9,
+105,110,102,105,120,95,108,101,100,0,0,0,9,6,1,9,
+12,7,0,2,60,60,0,0,12,8,0,2,62,62,0,0,
+50,2,3,4,30,33,1,89,9,9,115,101,108,102,46,105,
+95,116,101,114,109,115,40,39,41,39,44,39,125,39,44,39,
+93,39,44,39,59,39,44,39,58,39,44,39,110,108,39,44,
+39,101,108,105,102,39,44,39,101,108,115,101,39,44,39,84,
+114,117,101,39,44,39,70,97,108,115,101,39,44,39,78,111,
+110,101,39,44,39,110,97,109,101,39,44,39,115,116,114,105,
+110,103,39,44,39,110,117,109,98,101,114,39,44,39,105,110,
+100,101,110,116,39,44,39,100,101,100,101,110,116,39,44,39,
+101,120,99,101,112,116,39,41,0,0,0,0,12,22,0,7,
+105,95,116,101,114,109,115,0,49,3,1,22,12,5,0,1,
+41,0,0,0,12,6,0,1,125,0,0,0,12,7,0,1,
+93,0,0,0,12,8,0,1,59,0,0,0,12,9,0,1,
+58,0,0,0,12,10,0,2,110,108,0,0,12,11,0,4,
+101,108,105,102,0,0,0,0,12,12,0,4,101,108,115,101,
+0,0,0,0,12,13,0,4,84,114,117,101,0,0,0,0,
+12,14,0,5,70,97,108,115,101,0,0,0,12,15,0,4,
+78,111,110,101,0,0,0,0,12,16,0,4,110,97,109,101,
+0,0,0,0,12,17,0,6,115,116,114,105,110,103,0,0,
+12,18,0,6,110,117,109,98,101,114,0,0,12,19,0,6,
+105,110,100,101,110,116,0,0,12,20,0,6,100,101,100,101,
+110,116,0,0,12,21,0,6,101,120,99,101,112,116,0,0,
+50,2,3,17,30,10,1,90,9,9,115,101,108,102,46,98,
+97,115,101,95,100,109,97,112,91,39,110,108,39,93,91,39,
+118,97,108,39,93,32,61,32,39,110,108,39,0,0,0,0,
+12,3,0,9,98,97,115,101,95,100,109,97,112,0,0,0,
+9,2,1,3,12,3,0,2,110,108,0,0,9,2,2,3,
+12,3,0,2,110,108,0,0,12,4,0,3,118,97,108,0,
+10,2,4,3,0,0,0,0,12,23,0,8,95,95,105,110,
+105,116,95,95,0,0,0,0,10,8,23,22,16,23,0,114,
+44,7,0,0,30,6,1,93,9,100,101,102,32,99,104,101,
+99,107,40,115,101,108,102,44,116,44,42,118,115,41,58,0,
 12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
-33,1,0,0,12,1,0,5,116,119,101,97,107,0,0,0,
+33,1,0,0,12,1,0,5,99,104,101,99,107,0,0,0,
 34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,28,4,0,0,9,3,0,4,30,10,1,93,
-9,9,115,101,108,102,46,115,116,97,99,107,46,97,112,112,
-101,110,100,40,40,107,44,115,101,108,102,46,100,109,97,112,
-91,107,93,41,41,0,0,0,12,6,0,5,115,116,97,99,
-107,0,0,0,9,5,1,6,12,6,0,6,97,112,112,101,
-110,100,0,0,9,5,5,6,15,7,2,0,12,9,0,4,
-100,109,97,112,0,0,0,0,9,8,1,9,9,8,8,2,
-27,6,7,2,31,4,6,1,19,4,5,4,30,3,1,94,
-9,9,105,102,32,118,58,32,0,0,0,0,21,3,0,0,
-18,0,0,21,30,8,1,95,9,9,9,115,101,108,102,46,
-100,109,97,112,91,107,93,32,61,32,115,101,108,102,46,111,
-109,97,112,91,107,93,0,0,12,5,0,4,100,109,97,112,
-0,0,0,0,9,4,1,5,12,6,0,4,111,109,97,112,
-0,0,0,0,9,5,1,6,9,5,5,2,10,4,2,5,
-18,0,0,32,30,12,1,97,9,9,9,115,101,108,102,46,
-100,109,97,112,91,107,93,32,61,32,123,39,108,98,112,39,
-58,48,44,39,110,117,100,39,58,115,101,108,102,46,105,116,
-115,101,108,102,125,0,0,0,12,5,0,4,100,109,97,112,
-0,0,0,0,9,4,1,5,12,6,0,3,108,98,112,0,
-11,7,0,0,0,0,0,0,0,0,0,0,12,8,0,3,
-110,117,100,0,12,10,0,6,105,116,115,101,108,102,0,0,
-9,9,1,10,26,5,6,4,10,4,2,5,18,0,0,1,
-0,0,0,0,12,24,0,5,116,119,101,97,107,0,0,0,
-10,7,24,23,16,24,0,58,44,7,0,0,30,5,1,100,
-9,100,101,102,32,114,101,115,116,111,114,101,40,115,101,108,
-102,41,58,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,7,114,101,115,116,
-111,114,101,0,34,1,0,0,28,2,0,0,9,1,0,2,
-30,7,1,101,9,9,107,44,118,32,61,32,115,101,108,102,
-46,115,116,97,99,107,46,112,111,112,40,41,0,0,0,0,
-12,4,0,5,115,116,97,99,107,0,0,0,9,3,1,4,
-12,4,0,3,112,111,112,0,9,3,3,4,31,2,0,0,
-19,2,3,2,11,5,0,0,0,0,0,0,0,0,0,0,
-9,4,2,5,15,3,4,0,11,6,0,0,0,0,0,0,
-0,0,240,63,9,5,2,6,15,4,5,0,30,5,1,102,
+9,2,0,3,12,4,0,1,42,0,0,0,9,3,0,4,
+30,8,1,94,9,9,105,102,32,118,115,91,48,93,32,61,
+61,32,78,111,110,101,58,32,114,101,116,117,114,110,32,84,
+114,117,101,0,11,5,0,1,0,0,0,0,0,0,0,0,
+9,4,3,5,28,5,0,0,23,4,4,5,21,4,0,0,
+18,0,0,6,11,4,0,1,1,0,0,0,0,0,0,0,
+20,4,0,0,18,0,0,1,30,8,1,95,9,9,105,102,
+32,116,46,116,121,112,101,32,105,110,32,118,115,58,32,114,
+101,116,117,114,110,32,84,114,117,101,0,0,12,6,0,4,
+116,121,112,101,0,0,0,0,9,5,2,6,36,4,3,5,
+21,4,0,0,18,0,0,6,11,4,0,1,1,0,0,0,
+0,0,0,0,20,4,0,0,18,0,0,1,30,14,1,96,
+9,9,105,102,32,116,46,116,121,112,101,32,61,61,32,39,
+115,121,109,98,111,108,39,32,97,110,100,32,116,46,118,97,
+108,32,105,110,32,118,115,58,32,114,101,116,117,114,110,32,
+84,114,117,101,0,0,0,0,12,5,0,4,116,121,112,101,
+0,0,0,0,9,4,2,5,12,5,0,6,115,121,109,98,
+111,108,0,0,23,4,4,5,21,4,0,0,18,0,0,5,
+12,6,0,3,118,97,108,0,9,5,2,6,36,4,3,5,
+21,4,0,0,18,0,0,6,11,4,0,1,1,0,0,0,
+0,0,0,0,20,4,0,0,18,0,0,1,30,4,1,97,
+9,9,114,101,116,117,114,110,32,70,97,108,115,101,0,0,
+11,4,0,1,0,0,0,0,0,0,0,0,20,4,0,0,
+0,0,0,0,12,24,0,5,99,104,101,99,107,0,0,0,
+10,8,24,23,16,24,0,109,44,11,0,0,30,6,1,100,
+9,100,101,102,32,116,119,101,97,107,40,115,101,108,102,44,
+107,44,118,41,58,0,0,0,12,1,0,9,116,105,110,121,
+112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,5,
+116,119,101,97,107,0,0,0,34,1,0,0,28,2,0,0,
+9,1,0,2,28,3,0,0,9,2,0,3,28,4,0,0,
+9,3,0,4,30,10,1,101,9,9,115,101,108,102,46,115,
+116,97,99,107,46,97,112,112,101,110,100,40,40,107,44,115,
+101,108,102,46,100,109,97,112,91,107,93,41,41,0,0,0,
+12,9,0,5,115,116,97,99,107,0,0,0,9,8,1,9,
+12,9,0,6,97,112,112,101,110,100,0,0,49,5,8,9,
+15,8,2,0,12,10,0,4,100,109,97,112,0,0,0,0,
+9,9,1,10,9,9,9,2,27,7,8,2,50,4,5,1,
+30,3,1,102,9,9,105,102,32,118,58,32,0,0,0,0,
+21,3,0,0,18,0,0,21,30,8,1,103,9,9,9,115,
+101,108,102,46,100,109,97,112,91,107,93,32,61,32,115,101,
+108,102,46,111,109,97,112,91,107,93,0,0,12,5,0,4,
+100,109,97,112,0,0,0,0,9,4,1,5,12,6,0,4,
+111,109,97,112,0,0,0,0,9,5,1,6,9,5,5,2,
+10,4,2,5,18,0,0,32,30,12,1,105,9,9,9,115,
+101,108,102,46,100,109,97,112,91,107,93,32,61,32,123,39,
+108,98,112,39,58,48,44,39,110,117,100,39,58,115,101,108,
+102,46,105,116,115,101,108,102,125,0,0,0,12,5,0,4,
+100,109,97,112,0,0,0,0,9,4,1,5,12,6,0,3,
+108,98,112,0,11,7,0,1,0,0,0,0,0,0,0,0,
+12,8,0,3,110,117,100,0,12,10,0,6,105,116,115,101,
+108,102,0,0,9,9,1,10,26,5,6,4,10,4,2,5,
+18,0,0,1,0,0,0,0,12,25,0,5,116,119,101,97,
+107,0,0,0,10,8,25,24,16,25,0,57,44,7,0,0,
+30,5,1,108,9,100,101,102,32,114,101,115,116,111,114,101,
+40,115,101,108,102,41,58,0,12,1,0,9,116,105,110,121,
+112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,7,
+114,101,115,116,111,114,101,0,34,1,0,0,28,2,0,0,
+9,1,0,2,30,7,1,109,9,9,107,44,118,32,61,32,
+115,101,108,102,46,115,116,97,99,107,46,112,111,112,40,41,
+0,0,0,0,12,6,0,5,115,116,97,99,107,0,0,0,
+9,5,1,6,12,6,0,3,112,111,112,0,49,3,5,6,
+50,2,3,0,11,5,0,1,0,0,0,0,0,0,0,0,
+9,4,2,5,15,3,4,0,11,6,0,1,1,0,0,0,
+0,0,0,0,9,5,2,6,15,4,5,0,30,5,1,110,
 9,9,115,101,108,102,46,100,109,97,112,91,107,93,32,61,
 32,118,0,0,12,5,0,4,100,109,97,112,0,0,0,0,
-9,2,1,5,10,2,3,4,0,0,0,0,12,25,0,7,
-114,101,115,116,111,114,101,0,10,7,25,24,16,25,0,63,
-44,10,0,0,30,8,1,105,9,100,101,102,32,114,97,105,
+9,2,1,5,10,2,3,4,0,0,0,0,12,26,0,7,
+114,101,115,116,111,114,101,0,10,8,26,25,16,26,0,63,
+44,10,0,0,30,8,1,113,9,100,101,102,32,114,97,105,
 115,101,69,114,114,111,114,40,115,101,108,102,44,99,116,120,
 44,116,41,58,0,0,0,0,12,1,0,9,116,105,110,121,
 112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,10,
 114,97,105,115,101,69,114,114,111,114,0,0,34,1,0,0,
 28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-28,4,0,0,9,3,0,4,30,14,1,106,9,9,114,97,
+28,4,0,0,9,3,0,4,30,14,1,114,9,9,114,97,
 105,115,101,69,114,114,111,114,40,34,80,97,114,115,101,46,
 114,97,105,115,101,69,114,114,111,114,32,34,32,43,32,99,
 116,120,44,115,101,108,102,46,115,44,116,46,112,111,115,41,
@@ -1635,1243 +1661,1202 @@ unsigned char py_tinypy[] = {
 101,46,114,97,105,115,101,69,114,114,111,114,32,0,0,0,
 1,6,6,2,12,9,0,1,115,0,0,0,9,7,1,9,
 12,9,0,3,112,111,115,0,9,8,3,9,31,4,6,3,
-19,4,5,4,0,0,0,0,12,26,0,10,114,97,105,115,
-101,69,114,114,111,114,0,0,10,7,26,25,16,26,0,34,
-44,6,0,0,30,5,1,109,9,100,101,102,32,110,117,100,
+19,4,5,4,0,0,0,0,12,27,0,10,114,97,105,115,
+101,69,114,114,111,114,0,0,10,8,27,26,16,27,0,33,
+44,8,0,0,30,5,1,117,9,100,101,102,32,110,117,100,
 40,115,101,108,102,44,116,41,58,0,0,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
 12,1,0,3,110,117,100,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,30,5,1,110,
+9,1,0,2,28,3,0,0,9,2,0,3,30,5,1,118,
 9,9,114,101,116,117,114,110,32,116,46,110,117,100,40,116,
-41,0,0,0,12,5,0,3,110,117,100,0,9,4,2,5,
-15,5,2,0,31,3,5,1,19,3,4,3,20,3,0,0,
-0,0,0,0,12,27,0,3,110,117,100,0,10,7,27,26,
-16,27,0,39,44,8,0,0,30,6,1,113,9,100,101,102,
-32,108,101,100,40,115,101,108,102,44,116,44,108,101,102,116,
-41,58,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,3,108,101,100,0,
-34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,28,4,0,0,9,3,0,4,30,6,1,114,
-9,9,114,101,116,117,114,110,32,116,46,108,101,100,40,116,
-44,108,101,102,116,41,0,0,12,6,0,3,108,101,100,0,
-9,5,2,6,15,6,2,0,15,7,3,0,31,4,6,2,
-19,4,5,4,20,4,0,0,0,0,0,0,12,28,0,3,
-108,101,100,0,10,7,28,27,16,28,0,32,44,5,0,0,
-30,6,1,117,9,100,101,102,32,103,101,116,95,108,98,112,
-40,115,101,108,102,44,116,41,58,0,0,0,12,1,0,9,
-116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,7,103,101,116,95,108,98,112,0,34,1,0,0,
+41,0,0,0,12,7,0,3,110,117,100,0,49,4,2,7,
+15,6,2,0,50,3,4,1,20,3,0,0,0,0,0,0,
+12,28,0,3,110,117,100,0,10,8,28,27,16,28,0,38,
+44,10,0,0,30,6,1,121,9,100,101,102,32,108,101,100,
+40,115,101,108,102,44,116,44,108,101,102,116,41,58,0,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,3,108,101,100,0,34,1,0,0,
 28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-30,4,1,118,9,9,114,101,116,117,114,110,32,116,46,108,
-98,112,0,0,12,4,0,3,108,98,112,0,9,3,2,4,
-20,3,0,0,0,0,0,0,12,29,0,7,103,101,116,95,
-108,98,112,0,10,7,29,28,16,29,0,35,44,5,0,0,
-30,6,1,121,9,100,101,102,32,103,101,116,95,105,116,101,
-109,115,40,115,101,108,102,44,116,41,58,0,12,1,0,9,
+28,4,0,0,9,3,0,4,30,6,1,122,9,9,114,101,
+116,117,114,110,32,116,46,108,101,100,40,116,44,108,101,102,
+116,41,0,0,12,9,0,3,108,101,100,0,49,5,2,9,
+15,7,2,0,15,8,3,0,50,4,5,2,20,4,0,0,
+0,0,0,0,12,29,0,3,108,101,100,0,10,8,29,28,
+16,29,0,32,44,5,0,0,30,6,1,125,9,100,101,102,
+32,103,101,116,95,108,98,112,40,115,101,108,102,44,116,41,
+58,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
+121,0,0,0,33,1,0,0,12,1,0,7,103,101,116,95,
+108,98,112,0,34,1,0,0,28,2,0,0,9,1,0,2,
+28,3,0,0,9,2,0,3,30,4,1,126,9,9,114,101,
+116,117,114,110,32,116,46,108,98,112,0,0,12,4,0,3,
+108,98,112,0,9,3,2,4,20,3,0,0,0,0,0,0,
+12,30,0,7,103,101,116,95,108,98,112,0,10,8,30,29,
+16,30,0,35,44,5,0,0,30,6,1,129,9,100,101,102,
+32,103,101,116,95,105,116,101,109,115,40,115,101,108,102,44,
+116,41,58,0,12,1,0,9,116,105,110,121,112,121,46,112,
+121,0,0,0,33,1,0,0,12,1,0,9,103,101,116,95,
+105,116,101,109,115,0,0,0,34,1,0,0,28,2,0,0,
+9,1,0,2,28,3,0,0,9,2,0,3,30,5,1,130,
+9,9,114,101,116,117,114,110,32,116,46,105,116,101,109,115,
+0,0,0,0,12,4,0,5,105,116,101,109,115,0,0,0,
+9,3,2,4,20,3,0,0,0,0,0,0,12,31,0,9,
+103,101,116,95,105,116,101,109,115,0,0,0,10,8,31,30,
+16,31,0,72,44,8,0,0,30,6,1,133,9,100,101,102,
+32,116,101,114,109,105,110,97,108,40,115,101,108,102,41,58,
+0,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
+121,0,0,0,33,1,0,0,12,1,0,8,116,101,114,109,
+105,110,97,108,0,0,0,0,34,1,0,0,28,2,0,0,
+9,1,0,2,30,7,1,134,9,9,105,102,32,115,101,108,
+102,46,95,116,101,114,109,105,110,97,108,32,62,32,49,58,
+0,0,0,0,11,2,0,1,1,0,0,0,0,0,0,0,
+12,4,0,9,95,116,101,114,109,105,110,97,108,0,0,0,
+9,3,1,4,25,2,2,3,21,2,0,0,18,0,0,32,
+30,13,1,135,9,9,9,115,101,108,102,46,114,97,105,115,
+101,69,114,114,111,114,40,39,105,110,118,97,108,105,100,32,
+115,116,97,116,101,109,101,110,116,39,44,115,101,108,102,46,
+116,111,107,101,110,41,0,0,12,7,0,10,114,97,105,115,
+101,69,114,114,111,114,0,0,49,3,1,7,12,5,0,17,
+105,110,118,97,108,105,100,32,115,116,97,116,101,109,101,110,
+116,0,0,0,12,7,0,5,116,111,107,101,110,0,0,0,
+9,6,1,7,50,2,3,2,18,0,0,1,0,0,0,0,
+12,32,0,8,116,101,114,109,105,110,97,108,0,0,0,0,
+10,8,32,31,16,32,0,127,44,11,0,0,30,7,1,138,
+9,100,101,102,32,101,120,112,114,101,115,115,105,111,110,40,
+115,101,108,102,44,114,98,112,41,58,0,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,9,103,101,116,95,105,116,101,109,115,0,0,0,
+12,1,0,10,101,120,112,114,101,115,115,105,111,110,0,0,
 34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,30,5,1,122,9,9,114,101,116,117,114,110,
-32,116,46,105,116,101,109,115,0,0,0,0,12,4,0,5,
-105,116,101,109,115,0,0,0,9,3,2,4,20,3,0,0,
-0,0,0,0,12,30,0,9,103,101,116,95,105,116,101,109,
-115,0,0,0,10,7,30,29,16,30,0,73,44,7,0,0,
-30,6,1,125,9,100,101,102,32,116,101,114,109,105,110,97,
-108,40,115,101,108,102,41,58,0,0,0,0,12,1,0,9,
-116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,8,116,101,114,109,105,110,97,108,0,0,0,0,
-34,1,0,0,28,2,0,0,9,1,0,2,30,7,1,126,
-9,9,105,102,32,115,101,108,102,46,95,116,101,114,109,105,
-110,97,108,32,62,32,49,58,0,0,0,0,11,2,0,0,
-0,0,0,0,0,0,240,63,12,4,0,9,95,116,101,114,
-109,105,110,97,108,0,0,0,9,3,1,4,25,2,2,3,
-21,2,0,0,18,0,0,33,30,13,1,127,9,9,9,115,
-101,108,102,46,114,97,105,115,101,69,114,114,111,114,40,39,
-105,110,118,97,108,105,100,32,115,116,97,116,101,109,101,110,
-116,39,44,115,101,108,102,46,116,111,107,101,110,41,0,0,
-12,4,0,10,114,97,105,115,101,69,114,114,111,114,0,0,
-9,3,1,4,12,4,0,17,105,110,118,97,108,105,100,32,
-115,116,97,116,101,109,101,110,116,0,0,0,12,6,0,5,
-116,111,107,101,110,0,0,0,9,5,1,6,31,2,4,2,
-19,2,3,2,18,0,0,1,0,0,0,0,12,31,0,8,
-116,101,114,109,105,110,97,108,0,0,0,0,10,7,31,30,
-16,31,0,132,44,10,0,0,30,7,1,130,9,100,101,102,
-32,101,120,112,114,101,115,115,105,111,110,40,115,101,108,102,
-44,114,98,112,41,58,0,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,10,
-101,120,112,114,101,115,115,105,111,110,0,0,34,1,0,0,
-28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-30,5,1,131,9,9,116,32,61,32,115,101,108,102,46,116,
-111,107,101,110,0,0,0,0,12,5,0,5,116,111,107,101,
-110,0,0,0,9,4,1,5,15,3,4,0,30,5,1,132,
-9,9,115,101,108,102,46,97,100,118,97,110,99,101,40,41,
-0,0,0,0,12,6,0,7,97,100,118,97,110,99,101,0,
-9,5,1,6,31,4,0,0,19,4,5,4,30,6,1,133,
+9,2,0,3,30,5,1,139,9,9,116,32,61,32,115,101,
+108,102,46,116,111,107,101,110,0,0,0,0,12,5,0,5,
+116,111,107,101,110,0,0,0,9,4,1,5,15,3,4,0,
+30,5,1,140,9,9,115,101,108,102,46,97,100,118,97,110,
+99,101,40,41,0,0,0,0,12,7,0,7,97,100,118,97,
+110,99,101,0,49,5,1,7,50,4,5,0,30,6,1,141,
 9,9,108,101,102,116,32,61,32,115,101,108,102,46,110,117,
-100,40,116,41,0,0,0,0,12,7,0,3,110,117,100,0,
-9,6,1,7,15,7,3,0,31,5,7,1,19,5,6,5,
-15,4,5,0,30,10,1,134,9,9,119,104,105,108,101,32,
-114,98,112,32,60,32,115,101,108,102,46,103,101,116,95,108,
-98,112,40,115,101,108,102,46,116,111,107,101,110,41,58,0,
-12,8,0,7,103,101,116,95,108,98,112,0,9,7,1,8,
-12,9,0,5,116,111,107,101,110,0,0,0,9,8,1,9,
-31,6,8,1,19,6,7,6,25,5,2,6,21,5,0,0,
-18,0,0,41,30,5,1,135,9,9,9,116,32,61,32,115,
-101,108,102,46,116,111,107,101,110,0,0,0,12,6,0,5,
-116,111,107,101,110,0,0,0,9,5,1,6,15,3,5,0,
-30,5,1,136,9,9,9,115,101,108,102,46,97,100,118,97,
-110,99,101,40,41,0,0,0,12,7,0,7,97,100,118,97,
-110,99,101,0,9,6,1,7,31,5,0,0,19,5,6,5,
-30,7,1,137,9,9,9,108,101,102,116,32,61,32,115,101,
-108,102,46,108,101,100,40,116,44,108,101,102,116,41,0,0,
-12,7,0,3,108,101,100,0,9,6,1,7,15,7,3,0,
-15,8,4,0,31,5,7,2,19,5,6,5,15,4,5,0,
-18,0,255,204,30,4,1,138,9,9,114,101,116,117,114,110,
+100,40,116,41,0,0,0,0,12,9,0,3,110,117,100,0,
+49,6,1,9,15,8,3,0,50,5,6,1,15,4,5,0,
+30,10,1,142,9,9,119,104,105,108,101,32,114,98,112,32,
+60,32,115,101,108,102,46,103,101,116,95,108,98,112,40,115,
+101,108,102,46,116,111,107,101,110,41,58,0,12,10,0,7,
+103,101,116,95,108,98,112,0,49,7,1,10,12,10,0,5,
+116,111,107,101,110,0,0,0,9,9,1,10,50,6,7,1,
+25,5,2,6,21,5,0,0,18,0,0,39,30,5,1,143,
+9,9,9,116,32,61,32,115,101,108,102,46,116,111,107,101,
+110,0,0,0,12,6,0,5,116,111,107,101,110,0,0,0,
+9,5,1,6,15,3,5,0,30,5,1,144,9,9,9,115,
+101,108,102,46,97,100,118,97,110,99,101,40,41,0,0,0,
+12,8,0,7,97,100,118,97,110,99,101,0,49,6,1,8,
+50,5,6,0,30,7,1,145,9,9,9,108,101,102,116,32,
+61,32,115,101,108,102,46,108,101,100,40,116,44,108,101,102,
+116,41,0,0,12,10,0,3,108,101,100,0,49,6,1,10,
+15,8,3,0,15,9,4,0,50,5,6,2,15,4,5,0,
+18,0,255,207,30,4,1,146,9,9,114,101,116,117,114,110,
 32,108,101,102,116,0,0,0,20,4,0,0,0,0,0,0,
-12,32,0,10,101,120,112,114,101,115,115,105,111,110,0,0,
-10,7,32,31,16,32,0,61,44,10,0,0,30,8,1,141,
+12,33,0,10,101,120,112,114,101,115,115,105,111,110,0,0,
+10,8,33,32,16,33,0,60,44,11,0,0,30,8,1,149,
 9,100,101,102,32,105,110,102,105,120,95,108,101,100,40,115,
 101,108,102,44,116,44,108,101,102,116,41,58,0,0,0,0,
 12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
 33,1,0,0,12,1,0,9,105,110,102,105,120,95,108,101,
 100,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
 28,3,0,0,9,2,0,3,28,4,0,0,9,3,0,4,
-30,11,1,142,9,9,116,46,105,116,101,109,115,32,61,32,
+30,11,1,150,9,9,116,46,105,116,101,109,115,32,61,32,
 91,108,101,102,116,44,115,101,108,102,46,101,120,112,114,101,
 115,115,105,111,110,40,116,46,98,112,41,93,0,0,0,0,
-15,5,3,0,12,8,0,10,101,120,112,114,101,115,115,105,
-111,110,0,0,9,7,1,8,12,9,0,2,98,112,0,0,
-9,8,2,9,31,6,8,1,19,6,7,6,27,4,5,2,
-12,5,0,5,105,116,101,109,115,0,0,0,10,2,5,4,
-30,3,1,143,9,9,114,101,116,117,114,110,32,116,0,0,
-20,2,0,0,0,0,0,0,12,33,0,9,105,110,102,105,
-120,95,108,101,100,0,0,0,10,7,33,32,16,33,0,112,
-44,10,0,0,30,7,1,146,9,100,101,102,32,105,110,102,
-105,120,95,105,115,40,115,101,108,102,44,116,44,108,101,102,
-116,41,58,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,8,105,110,102,105,
-120,95,105,115,0,0,0,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,28,4,0,0,
-9,3,0,4,30,9,1,147,9,9,105,102,32,115,101,108,
-102,46,99,104,101,99,107,40,115,101,108,102,46,116,111,107,
-101,110,44,39,110,111,116,39,41,58,0,0,12,6,0,5,
-99,104,101,99,107,0,0,0,9,5,1,6,12,8,0,5,
-116,111,107,101,110,0,0,0,9,6,1,8,12,7,0,3,
-110,111,116,0,31,4,6,2,19,4,5,4,21,4,0,0,
-18,0,0,29,30,5,1,148,9,9,9,116,46,118,97,108,
-32,61,32,39,105,115,110,111,116,39,0,0,12,4,0,5,
-105,115,110,111,116,0,0,0,12,5,0,3,118,97,108,0,
-10,2,5,4,30,6,1,149,9,9,9,115,101,108,102,46,
-97,100,118,97,110,99,101,40,39,110,111,116,39,41,0,0,
-12,6,0,7,97,100,118,97,110,99,101,0,9,5,1,6,
-12,6,0,3,110,111,116,0,31,4,6,1,19,4,5,4,
-18,0,0,1,30,11,1,150,9,9,116,46,105,116,101,109,
-115,32,61,32,91,108,101,102,116,44,115,101,108,102,46,101,
-120,112,114,101,115,115,105,111,110,40,116,46,98,112,41,93,
-0,0,0,0,15,5,3,0,12,8,0,10,101,120,112,114,
-101,115,115,105,111,110,0,0,9,7,1,8,12,9,0,2,
-98,112,0,0,9,8,2,9,31,6,8,1,19,6,7,6,
+15,5,3,0,12,10,0,10,101,120,112,114,101,115,115,105,
+111,110,0,0,49,7,1,10,12,10,0,2,98,112,0,0,
+9,9,2,10,50,6,7,1,27,4,5,2,12,5,0,5,
+105,116,101,109,115,0,0,0,10,2,5,4,30,3,1,151,
+9,9,114,101,116,117,114,110,32,116,0,0,20,2,0,0,
+0,0,0,0,12,34,0,9,105,110,102,105,120,95,108,101,
+100,0,0,0,10,8,34,33,16,34,0,109,44,11,0,0,
+30,7,1,154,9,100,101,102,32,105,110,102,105,120,95,105,
+115,40,115,101,108,102,44,116,44,108,101,102,116,41,58,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,8,105,110,102,105,120,95,105,115,
+0,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
+28,3,0,0,9,2,0,3,28,4,0,0,9,3,0,4,
+30,9,1,155,9,9,105,102,32,115,101,108,102,46,99,104,
+101,99,107,40,115,101,108,102,46,116,111,107,101,110,44,39,
+110,111,116,39,41,58,0,0,12,9,0,5,99,104,101,99,
+107,0,0,0,49,5,1,9,12,9,0,5,116,111,107,101,
+110,0,0,0,9,7,1,9,12,8,0,3,110,111,116,0,
+50,4,5,2,21,4,0,0,18,0,0,28,30,5,1,156,
+9,9,9,116,46,118,97,108,32,61,32,39,105,115,110,111,
+116,39,0,0,12,4,0,5,105,115,110,111,116,0,0,0,
+12,5,0,3,118,97,108,0,10,2,5,4,30,6,1,157,
+9,9,9,115,101,108,102,46,97,100,118,97,110,99,101,40,
+39,110,111,116,39,41,0,0,12,8,0,7,97,100,118,97,
+110,99,101,0,49,5,1,8,12,7,0,3,110,111,116,0,
+50,4,5,1,18,0,0,1,30,11,1,158,9,9,116,46,
+105,116,101,109,115,32,61,32,91,108,101,102,116,44,115,101,
+108,102,46,101,120,112,114,101,115,115,105,111,110,40,116,46,
+98,112,41,93,0,0,0,0,15,5,3,0,12,10,0,10,
+101,120,112,114,101,115,115,105,111,110,0,0,49,7,1,10,
+12,10,0,2,98,112,0,0,9,9,2,10,50,6,7,1,
 27,4,5,2,12,5,0,5,105,116,101,109,115,0,0,0,
-10,2,5,4,30,3,1,151,9,9,114,101,116,117,114,110,
-32,116,0,0,20,2,0,0,0,0,0,0,12,34,0,8,
-105,110,102,105,120,95,105,115,0,0,0,0,10,7,34,33,
-16,34,0,88,44,10,0,0,30,8,1,154,9,100,101,102,
+10,2,5,4,30,3,1,159,9,9,114,101,116,117,114,110,
+32,116,0,0,20,2,0,0,0,0,0,0,12,35,0,8,
+105,110,102,105,120,95,105,115,0,0,0,0,10,8,35,34,
+16,35,0,86,44,11,0,0,30,8,1,162,9,100,101,102,
 32,105,110,102,105,120,95,110,111,116,40,115,101,108,102,44,
 116,44,108,101,102,116,41,58,0,0,0,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
 12,1,0,9,105,110,102,105,120,95,110,111,116,0,0,0,
 34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,28,4,0,0,9,3,0,4,30,6,1,155,
+9,2,0,3,28,4,0,0,9,3,0,4,30,6,1,163,
 9,9,115,101,108,102,46,97,100,118,97,110,99,101,40,39,
-105,110,39,41,0,0,0,0,12,6,0,7,97,100,118,97,
-110,99,101,0,9,5,1,6,12,6,0,2,105,110,0,0,
-31,4,6,1,19,4,5,4,30,5,1,156,9,9,116,46,
-118,97,108,32,61,32,39,110,111,116,105,110,39,0,0,0,
-12,4,0,5,110,111,116,105,110,0,0,0,12,5,0,3,
-118,97,108,0,10,2,5,4,30,11,1,157,9,9,116,46,
-105,116,101,109,115,32,61,32,91,108,101,102,116,44,115,101,
-108,102,46,101,120,112,114,101,115,115,105,111,110,40,116,46,
-98,112,41,93,0,0,0,0,15,5,3,0,12,8,0,10,
-101,120,112,114,101,115,115,105,111,110,0,0,9,7,1,8,
-12,9,0,2,98,112,0,0,9,8,2,9,31,6,8,1,
-19,6,7,6,27,4,5,2,12,5,0,5,105,116,101,109,
-115,0,0,0,10,2,5,4,30,3,1,158,9,9,114,101,
-116,117,114,110,32,116,0,0,20,2,0,0,0,0,0,0,
-12,35,0,9,105,110,102,105,120,95,110,111,116,0,0,0,
-10,7,35,34,16,35,0,119,44,9,0,0,30,8,1,161,
-9,100,101,102,32,105,110,102,105,120,95,116,117,112,108,101,
-40,115,101,108,102,44,116,44,108,101,102,116,41,58,0,0,
-12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
-33,1,0,0,12,1,0,11,105,110,102,105,120,95,116,117,
-112,108,101,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,3,0,0,9,2,0,3,28,4,0,0,9,3,0,4,
-30,7,1,162,9,9,114,32,61,32,115,101,108,102,46,101,
-120,112,114,101,115,115,105,111,110,40,116,46,98,112,41,0,
-12,7,0,10,101,120,112,114,101,115,115,105,111,110,0,0,
-9,6,1,7,12,8,0,2,98,112,0,0,9,7,2,8,
-31,5,7,1,19,5,6,5,15,4,5,0,30,6,1,163,
-9,9,105,102,32,108,101,102,116,46,118,97,108,32,61,61,
-32,39,44,39,58,0,0,0,12,6,0,3,118,97,108,0,
-9,5,3,6,12,6,0,1,44,0,0,0,23,5,5,6,
-21,5,0,0,18,0,0,26,30,6,1,164,9,9,9,108,
-101,102,116,46,105,116,101,109,115,46,97,112,112,101,110,100,
-40,114,41,0,12,7,0,5,105,116,101,109,115,0,0,0,
-9,6,3,7,12,7,0,6,97,112,112,101,110,100,0,0,
-9,6,6,7,15,7,4,0,31,5,7,1,19,5,6,5,
-30,4,1,165,9,9,9,114,101,116,117,114,110,32,108,101,
-102,116,0,0,20,3,0,0,18,0,0,1,30,6,1,166,
+105,110,39,41,0,0,0,0,12,8,0,7,97,100,118,97,
+110,99,101,0,49,5,1,8,12,7,0,2,105,110,0,0,
+50,4,5,1,30,5,1,164,9,9,116,46,118,97,108,32,
+61,32,39,110,111,116,105,110,39,0,0,0,12,4,0,5,
+110,111,116,105,110,0,0,0,12,5,0,3,118,97,108,0,
+10,2,5,4,30,11,1,165,9,9,116,46,105,116,101,109,
+115,32,61,32,91,108,101,102,116,44,115,101,108,102,46,101,
+120,112,114,101,115,115,105,111,110,40,116,46,98,112,41,93,
+0,0,0,0,15,5,3,0,12,10,0,10,101,120,112,114,
+101,115,115,105,111,110,0,0,49,7,1,10,12,10,0,2,
+98,112,0,0,9,9,2,10,50,6,7,1,27,4,5,2,
+12,5,0,5,105,116,101,109,115,0,0,0,10,2,5,4,
+30,3,1,166,9,9,114,101,116,117,114,110,32,116,0,0,
+20,2,0,0,0,0,0,0,12,36,0,9,105,110,102,105,
+120,95,110,111,116,0,0,0,10,8,36,35,16,36,0,117,
+44,11,0,0,30,8,1,169,9,100,101,102,32,105,110,102,
+105,120,95,116,117,112,108,101,40,115,101,108,102,44,116,44,
+108,101,102,116,41,58,0,0,12,1,0,9,116,105,110,121,
+112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,11,
+105,110,102,105,120,95,116,117,112,108,101,0,34,1,0,0,
+28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
+28,4,0,0,9,3,0,4,30,7,1,170,9,9,114,32,
+61,32,115,101,108,102,46,101,120,112,114,101,115,115,105,111,
+110,40,116,46,98,112,41,0,12,9,0,10,101,120,112,114,
+101,115,115,105,111,110,0,0,49,6,1,9,12,9,0,2,
+98,112,0,0,9,8,2,9,50,5,6,1,15,4,5,0,
+30,6,1,171,9,9,105,102,32,108,101,102,116,46,118,97,
+108,32,61,61,32,39,44,39,58,0,0,0,12,6,0,3,
+118,97,108,0,9,5,3,6,12,6,0,1,44,0,0,0,
+23,5,5,6,21,5,0,0,18,0,0,25,30,6,1,172,
+9,9,9,108,101,102,116,46,105,116,101,109,115,46,97,112,
+112,101,110,100,40,114,41,0,12,10,0,5,105,116,101,109,
+115,0,0,0,9,9,3,10,12,10,0,6,97,112,112,101,
+110,100,0,0,49,6,9,10,15,8,4,0,50,5,6,1,
+30,4,1,173,9,9,9,114,101,116,117,114,110,32,108,101,
+102,116,0,0,20,3,0,0,18,0,0,1,30,6,1,174,
 9,9,116,46,105,116,101,109,115,32,61,32,91,108,101,102,
 116,44,114,93,0,0,0,0,15,6,3,0,15,7,4,0,
 27,5,6,2,12,6,0,5,105,116,101,109,115,0,0,0,
-10,2,6,5,30,5,1,167,9,9,116,46,116,121,112,101,
+10,2,6,5,30,5,1,175,9,9,116,46,116,121,112,101,
 32,61,32,39,116,117,112,108,101,39,0,0,12,5,0,5,
 116,117,112,108,101,0,0,0,12,6,0,4,116,121,112,101,
-0,0,0,0,10,2,6,5,30,3,1,168,9,9,114,101,
+0,0,0,0,10,2,6,5,30,3,1,176,9,9,114,101,
 116,117,114,110,32,116,0,0,20,2,0,0,0,0,0,0,
-12,36,0,11,105,110,102,105,120,95,116,117,112,108,101,0,
-10,7,36,35,16,36,0,93,44,9,0,0,30,5,1,171,
+12,37,0,11,105,110,102,105,120,95,116,117,112,108,101,0,
+10,8,37,36,16,37,0,91,44,11,0,0,30,5,1,179,
 9,100,101,102,32,108,115,116,40,115,101,108,102,44,116,41,
 58,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
 121,0,0,0,33,1,0,0,12,1,0,3,108,115,116,0,
 34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,30,7,1,172,9,9,105,102,32,116,32,61,
+9,2,0,3,30,7,1,180,9,9,105,102,32,116,32,61,
 61,32,78,111,110,101,58,32,114,101,116,117,114,110,32,91,
 93,0,0,0,28,4,0,0,23,3,2,4,21,3,0,0,
 18,0,0,4,27,3,0,0,20,3,0,0,18,0,0,1,
-30,12,1,173,9,9,105,102,32,115,101,108,102,46,99,104,
+30,12,1,181,9,9,105,102,32,115,101,108,102,46,99,104,
 101,99,107,40,116,44,39,44,39,44,39,116,117,112,108,101,
 39,44,39,115,116,97,116,101,109,101,110,116,115,39,41,58,
-0,0,0,0,12,5,0,5,99,104,101,99,107,0,0,0,
-9,4,1,5,15,5,2,0,12,6,0,1,44,0,0,0,
-12,7,0,5,116,117,112,108,101,0,0,0,12,8,0,10,
-115,116,97,116,101,109,101,110,116,115,0,0,31,3,5,4,
-19,3,4,3,21,3,0,0,18,0,0,19,30,7,1,174,
-9,9,9,114,101,116,117,114,110,32,115,101,108,102,46,103,
-101,116,95,105,116,101,109,115,40,116,41,0,12,5,0,9,
-103,101,116,95,105,116,101,109,115,0,0,0,9,4,1,5,
-15,5,2,0,31,3,5,1,19,3,4,3,20,3,0,0,
-18,0,0,1,30,4,1,175,9,9,114,101,116,117,114,110,
-32,91,116,93,0,0,0,0,15,4,2,0,27,3,4,1,
-20,3,0,0,0,0,0,0,12,37,0,3,108,115,116,0,
-10,7,37,36,16,37,0,55,44,12,0,0,30,6,1,178,
-9,100,101,102,32,105,108,115,116,40,115,101,108,102,44,116,
-121,112,44,116,41,58,0,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,4,
-105,108,115,116,0,0,0,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,28,4,0,0,
-9,3,0,4,30,11,1,179,9,9,114,101,116,117,114,110,
-32,84,111,107,101,110,40,116,46,112,111,115,44,116,121,112,
-44,116,121,112,44,115,101,108,102,46,108,115,116,40,116,41,
-41,0,0,0,12,6,0,5,84,111,107,101,110,0,0,0,
-13,5,6,0,12,10,0,3,112,111,115,0,9,6,3,10,
-15,7,2,0,15,8,2,0,12,11,0,3,108,115,116,0,
-9,10,1,11,15,11,3,0,31,9,11,1,19,9,10,9,
-31,4,6,4,19,4,5,4,20,4,0,0,0,0,0,0,
-12,38,0,4,105,108,115,116,0,0,0,0,10,7,38,37,
-16,38,0,196,44,12,0,0,30,7,1,182,9,100,101,102,
-32,99,97,108,108,95,108,101,100,40,115,101,108,102,44,116,
-44,108,101,102,116,41,58,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,8,
-99,97,108,108,95,108,101,100,0,0,0,0,34,1,0,0,
-28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-28,4,0,0,9,3,0,4,30,10,1,183,9,9,114,32,
-61,32,84,111,107,101,110,40,116,46,112,111,115,44,39,99,
-97,108,108,39,44,39,36,39,44,91,108,101,102,116,93,41,
-0,0,0,0,12,7,0,5,84,111,107,101,110,0,0,0,
-13,6,7,0,12,11,0,3,112,111,115,0,9,7,2,11,
-12,8,0,4,99,97,108,108,0,0,0,0,12,9,0,1,
-36,0,0,0,15,11,3,0,27,10,11,1,31,5,7,4,
-19,5,6,5,15,4,5,0,30,10,1,184,9,9,119,104,
-105,108,101,32,110,111,116,32,115,101,108,102,46,99,104,101,
-99,107,40,115,101,108,102,46,116,111,107,101,110,44,39,41,
-39,41,58,0,12,8,0,5,99,104,101,99,107,0,0,0,
-9,7,1,8,12,10,0,5,116,111,107,101,110,0,0,0,
-9,8,1,10,12,9,0,1,41,0,0,0,31,6,8,2,
-19,6,7,6,47,5,6,0,21,5,0,0,18,0,0,97,
-30,6,1,185,9,9,9,115,101,108,102,46,116,119,101,97,
-107,40,39,44,39,44,48,41,0,0,0,0,12,7,0,5,
-116,119,101,97,107,0,0,0,9,6,1,7,12,7,0,1,
-44,0,0,0,11,8,0,0,0,0,0,0,0,0,0,0,
-31,5,7,2,19,5,6,5,30,10,1,186,9,9,9,114,
-46,105,116,101,109,115,46,97,112,112,101,110,100,40,115,101,
-108,102,46,101,120,112,114,101,115,115,105,111,110,40,48,41,
-41,0,0,0,12,7,0,5,105,116,101,109,115,0,0,0,
-9,6,4,7,12,7,0,6,97,112,112,101,110,100,0,0,
-9,6,6,7,12,9,0,10,101,120,112,114,101,115,115,105,
-111,110,0,0,9,8,1,9,11,9,0,0,0,0,0,0,
-0,0,0,0,31,7,9,1,19,7,8,7,31,5,7,1,
-19,5,6,5,30,12,1,187,9,9,9,105,102,32,115,101,
-108,102,46,116,111,107,101,110,46,118,97,108,32,61,61,32,
-39,44,39,58,32,115,101,108,102,46,97,100,118,97,110,99,
-101,40,39,44,39,41,0,0,12,6,0,5,116,111,107,101,
-110,0,0,0,9,5,1,6,12,6,0,3,118,97,108,0,
-9,5,5,6,12,6,0,1,44,0,0,0,23,5,5,6,
-21,5,0,0,18,0,0,10,12,7,0,7,97,100,118,97,
-110,99,101,0,9,6,1,7,12,7,0,1,44,0,0,0,
-31,5,7,1,19,5,6,5,18,0,0,1,30,5,1,188,
-9,9,9,115,101,108,102,46,114,101,115,116,111,114,101,40,
-41,0,0,0,12,7,0,7,114,101,115,116,111,114,101,0,
-9,6,1,7,31,5,0,0,19,5,6,5,18,0,255,146,
-30,5,1,189,9,9,115,101,108,102,46,97,100,118,97,110,
-99,101,40,34,41,34,41,0,12,7,0,7,97,100,118,97,
-110,99,101,0,9,6,1,7,12,7,0,1,41,0,0,0,
-31,5,7,1,19,5,6,5,30,3,1,190,9,9,114,101,
-116,117,114,110,32,114,0,0,20,4,0,0,0,0,0,0,
-12,39,0,8,99,97,108,108,95,108,101,100,0,0,0,0,
-10,7,39,38,16,39,1,126,44,18,0,0,30,7,1,193,
-9,100,101,102,32,103,101,116,95,108,101,100,40,115,101,108,
-102,44,116,44,108,101,102,116,41,58,0,0,12,1,0,9,
+0,0,0,0,12,10,0,5,99,104,101,99,107,0,0,0,
+49,4,1,10,15,6,2,0,12,7,0,1,44,0,0,0,
+12,8,0,5,116,117,112,108,101,0,0,0,12,9,0,10,
+115,116,97,116,101,109,101,110,116,115,0,0,50,3,4,4,
+21,3,0,0,18,0,0,18,30,7,1,182,9,9,9,114,
+101,116,117,114,110,32,115,101,108,102,46,103,101,116,95,105,
+116,101,109,115,40,116,41,0,12,7,0,9,103,101,116,95,
+105,116,101,109,115,0,0,0,49,4,1,7,15,6,2,0,
+50,3,4,1,20,3,0,0,18,0,0,1,30,4,1,183,
+9,9,114,101,116,117,114,110,32,91,116,93,0,0,0,0,
+15,4,2,0,27,3,4,1,20,3,0,0,0,0,0,0,
+12,38,0,3,108,115,116,0,10,8,38,37,16,38,0,54,
+44,14,0,0,30,6,1,186,9,100,101,102,32,105,108,115,
+116,40,115,101,108,102,44,116,121,112,44,116,41,58,0,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,4,105,108,115,116,0,0,0,0,
+34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
+9,2,0,3,28,4,0,0,9,3,0,4,30,11,1,187,
+9,9,114,101,116,117,114,110,32,84,111,107,101,110,40,116,
+46,112,111,115,44,116,121,112,44,116,121,112,44,115,101,108,
+102,46,108,115,116,40,116,41,41,0,0,0,12,6,0,5,
+84,111,107,101,110,0,0,0,13,5,6,0,12,10,0,3,
+112,111,115,0,9,6,3,10,15,7,2,0,15,8,2,0,
+12,13,0,3,108,115,116,0,49,10,1,13,15,12,3,0,
+50,9,10,1,31,4,6,4,19,4,5,4,20,4,0,0,
+0,0,0,0,12,39,0,4,105,108,115,116,0,0,0,0,
+10,8,39,38,16,39,0,189,44,13,0,0,30,7,1,190,
+9,100,101,102,32,99,97,108,108,95,108,101,100,40,115,101,
+108,102,44,116,44,108,101,102,116,41,58,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,7,103,101,116,95,108,101,100,0,34,1,0,0,
-28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-28,4,0,0,9,3,0,4,30,9,1,194,9,9,114,32,
-61,32,84,111,107,101,110,40,116,46,112,111,115,44,39,103,
-101,116,39,44,39,46,39,44,91,108,101,102,116,93,41,0,
-12,7,0,5,84,111,107,101,110,0,0,0,13,6,7,0,
-12,11,0,3,112,111,115,0,9,7,2,11,12,8,0,3,
-103,101,116,0,12,9,0,1,46,0,0,0,15,11,3,0,
-27,10,11,1,31,5,7,4,19,5,6,5,15,4,5,0,
-30,5,1,195,9,9,105,116,101,109,115,32,61,32,32,91,
-108,101,102,116,93,0,0,0,15,7,3,0,27,6,7,1,
-15,5,6,0,30,4,1,196,9,9,109,111,114,101,32,61,
-32,70,97,108,115,101,0,0,11,7,0,0,0,0,0,0,
-0,0,0,0,15,6,7,0,30,10,1,197,9,9,119,104,
-105,108,101,32,110,111,116,32,115,101,108,102,46,99,104,101,
-99,107,40,115,101,108,102,46,116,111,107,101,110,44,39,93,
-39,41,58,0,12,10,0,5,99,104,101,99,107,0,0,0,
-9,9,1,10,12,12,0,5,116,111,107,101,110,0,0,0,
-9,10,1,12,12,11,0,1,93,0,0,0,31,8,10,2,
-19,8,9,8,47,7,8,0,21,7,0,0,18,0,0,153,
-30,4,1,198,9,9,9,109,111,114,101,32,61,32,70,97,
-108,115,101,0,11,7,0,0,0,0,0,0,0,0,0,0,
-15,6,7,0,30,9,1,199,9,9,9,105,102,32,115,101,
-108,102,46,99,104,101,99,107,40,115,101,108,102,46,116,111,
-107,101,110,44,39,58,39,41,58,0,0,0,12,9,0,5,
-99,104,101,99,107,0,0,0,9,8,1,9,12,11,0,5,
-116,111,107,101,110,0,0,0,9,9,1,11,12,10,0,1,
-58,0,0,0,31,7,9,2,19,7,8,7,21,7,0,0,
-18,0,0,42,30,14,1,200,9,9,9,9,105,116,101,109,
-115,46,97,112,112,101,110,100,40,84,111,107,101,110,40,115,
-101,108,102,46,116,111,107,101,110,46,112,111,115,44,39,115,
-121,109,98,111,108,39,44,39,78,111,110,101,39,41,41,0,
-12,9,0,6,97,112,112,101,110,100,0,0,9,8,5,9,
-12,11,0,5,84,111,107,101,110,0,0,0,13,10,11,0,
-12,14,0,5,116,111,107,101,110,0,0,0,9,11,1,14,
-12,14,0,3,112,111,115,0,9,11,11,14,12,12,0,6,
-115,121,109,98,111,108,0,0,12,13,0,4,78,111,110,101,
-0,0,0,0,31,9,11,3,19,9,10,9,31,7,9,1,
-19,7,8,7,18,0,0,29,30,10,1,202,9,9,9,9,
-105,116,101,109,115,46,97,112,112,101,110,100,40,115,101,108,
-102,46,101,120,112,114,101,115,115,105,111,110,40,48,41,41,
-0,0,0,0,12,9,0,6,97,112,112,101,110,100,0,0,
-9,8,5,9,12,11,0,10,101,120,112,114,101,115,115,105,
-111,110,0,0,9,10,1,11,11,11,0,0,0,0,0,0,
-0,0,0,0,31,9,11,1,19,9,10,9,31,7,9,1,
-19,7,8,7,18,0,0,1,30,9,1,203,9,9,9,105,
-102,32,115,101,108,102,46,99,104,101,99,107,40,115,101,108,
-102,46,116,111,107,101,110,44,39,58,39,41,58,0,0,0,
-12,9,0,5,99,104,101,99,107,0,0,0,9,8,1,9,
-12,11,0,5,116,111,107,101,110,0,0,0,9,9,1,11,
-12,10,0,1,58,0,0,0,31,7,9,2,19,7,8,7,
-21,7,0,0,18,0,0,26,30,6,1,204,9,9,9,9,
-115,101,108,102,46,97,100,118,97,110,99,101,40,39,58,39,
-41,0,0,0,12,9,0,7,97,100,118,97,110,99,101,0,
-9,8,1,9,12,9,0,1,58,0,0,0,31,7,9,1,
-19,7,8,7,30,4,1,205,9,9,9,9,109,111,114,101,
-32,61,32,84,114,117,101,0,11,7,0,0,0,0,0,0,
-0,0,240,63,15,6,7,0,18,0,0,1,18,0,255,90,
-30,3,1,206,9,9,105,102,32,109,111,114,101,58,0,0,
-21,6,0,0,18,0,0,42,30,14,1,207,9,9,9,105,
-116,101,109,115,46,97,112,112,101,110,100,40,84,111,107,101,
-110,40,115,101,108,102,46,116,111,107,101,110,46,112,111,115,
-44,39,115,121,109,98,111,108,39,44,39,78,111,110,101,39,
-41,41,0,0,12,9,0,6,97,112,112,101,110,100,0,0,
-9,8,5,9,12,11,0,5,84,111,107,101,110,0,0,0,
-13,10,11,0,12,14,0,5,116,111,107,101,110,0,0,0,
-9,11,1,14,12,14,0,3,112,111,115,0,9,11,11,14,
-12,12,0,6,115,121,109,98,111,108,0,0,12,13,0,4,
-78,111,110,101,0,0,0,0,31,9,11,3,19,9,10,9,
-31,7,9,1,19,7,8,7,18,0,0,1,30,6,1,208,
-9,9,105,102,32,108,101,110,40,105,116,101,109,115,41,32,
-62,32,50,58,0,0,0,0,11,7,0,0,0,0,0,0,
-0,0,0,64,12,10,0,3,108,101,110,0,13,9,10,0,
-15,10,5,0,31,8,10,1,19,8,9,8,25,7,7,8,
-21,7,0,0,18,0,0,40,30,14,1,209,9,9,9,105,
-116,101,109,115,32,61,32,91,108,101,102,116,44,84,111,107,
-101,110,40,116,46,112,111,115,44,39,115,108,105,99,101,39,
-44,39,58,39,44,105,116,101,109,115,91,49,58,93,41,93,
-0,0,0,0,15,8,3,0,12,11,0,5,84,111,107,101,
-110,0,0,0,13,10,11,0,12,15,0,3,112,111,115,0,
-9,11,2,15,12,12,0,5,115,108,105,99,101,0,0,0,
-12,13,0,1,58,0,0,0,11,16,0,0,0,0,0,0,
-0,0,240,63,28,17,0,0,27,15,16,2,9,14,5,15,
-31,9,11,4,19,9,10,9,27,7,8,2,15,5,7,0,
-18,0,0,1,30,5,1,210,9,9,114,46,105,116,101,109,
-115,32,61,32,105,116,101,109,115,0,0,0,12,7,0,5,
-105,116,101,109,115,0,0,0,10,4,7,5,30,5,1,211,
+12,1,0,8,99,97,108,108,95,108,101,100,0,0,0,0,
+34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
+9,2,0,3,28,4,0,0,9,3,0,4,30,10,1,191,
+9,9,114,32,61,32,84,111,107,101,110,40,116,46,112,111,
+115,44,39,99,97,108,108,39,44,39,36,39,44,91,108,101,
+102,116,93,41,0,0,0,0,12,7,0,5,84,111,107,101,
+110,0,0,0,13,6,7,0,12,11,0,3,112,111,115,0,
+9,7,2,11,12,8,0,4,99,97,108,108,0,0,0,0,
+12,9,0,1,36,0,0,0,15,11,3,0,27,10,11,1,
+31,5,7,4,19,5,6,5,15,4,5,0,30,10,1,192,
+9,9,119,104,105,108,101,32,110,111,116,32,115,101,108,102,
+46,99,104,101,99,107,40,115,101,108,102,46,116,111,107,101,
+110,44,39,41,39,41,58,0,12,11,0,5,99,104,101,99,
+107,0,0,0,49,7,1,11,12,11,0,5,116,111,107,101,
+110,0,0,0,9,9,1,11,12,10,0,1,41,0,0,0,
+50,6,7,2,47,5,6,0,21,5,0,0,18,0,0,92,
+30,6,1,193,9,9,9,115,101,108,102,46,116,119,101,97,
+107,40,39,44,39,44,48,41,0,0,0,0,12,10,0,5,
+116,119,101,97,107,0,0,0,49,6,1,10,12,8,0,1,
+44,0,0,0,11,9,0,1,0,0,0,0,0,0,0,0,
+50,5,6,2,30,10,1,194,9,9,9,114,46,105,116,101,
+109,115,46,97,112,112,101,110,100,40,115,101,108,102,46,101,
+120,112,114,101,115,115,105,111,110,40,48,41,41,0,0,0,
+12,10,0,5,105,116,101,109,115,0,0,0,9,9,4,10,
+12,10,0,6,97,112,112,101,110,100,0,0,49,6,9,10,
+12,12,0,10,101,120,112,114,101,115,115,105,111,110,0,0,
+49,9,1,12,11,11,0,1,0,0,0,0,0,0,0,0,
+50,8,9,1,50,5,6,1,30,12,1,195,9,9,9,105,
+102,32,115,101,108,102,46,116,111,107,101,110,46,118,97,108,
+32,61,61,32,39,44,39,58,32,115,101,108,102,46,97,100,
+118,97,110,99,101,40,39,44,39,41,0,0,12,6,0,5,
+116,111,107,101,110,0,0,0,9,5,1,6,12,6,0,3,
+118,97,108,0,9,5,5,6,12,6,0,1,44,0,0,0,
+23,5,5,6,21,5,0,0,18,0,0,9,12,9,0,7,
+97,100,118,97,110,99,101,0,49,6,1,9,12,8,0,1,
+44,0,0,0,50,5,6,1,18,0,0,1,30,5,1,196,
+9,9,9,115,101,108,102,46,114,101,115,116,111,114,101,40,
+41,0,0,0,12,8,0,7,114,101,115,116,111,114,101,0,
+49,6,1,8,50,5,6,0,18,0,255,152,30,5,1,197,
 9,9,115,101,108,102,46,97,100,118,97,110,99,101,40,34,
-93,34,41,0,12,9,0,7,97,100,118,97,110,99,101,0,
-9,8,1,9,12,9,0,1,93,0,0,0,31,7,9,1,
-19,7,8,7,30,3,1,212,9,9,114,101,116,117,114,110,
-32,114,0,0,20,4,0,0,0,0,0,0,12,40,0,7,
-103,101,116,95,108,101,100,0,10,7,40,39,16,40,0,77,
-44,9,0,0,30,7,1,215,9,100,101,102,32,100,111,116,
+41,34,41,0,12,9,0,7,97,100,118,97,110,99,101,0,
+49,6,1,9,12,8,0,1,41,0,0,0,50,5,6,1,
+30,3,1,198,9,9,114,101,116,117,114,110,32,114,0,0,
+20,4,0,0,0,0,0,0,12,40,0,8,99,97,108,108,
+95,108,101,100,0,0,0,0,10,8,40,39,16,40,1,117,
+44,18,0,0,30,7,1,201,9,100,101,102,32,103,101,116,
 95,108,101,100,40,115,101,108,102,44,116,44,108,101,102,116,
 41,58,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,7,100,111,116,95,
+121,0,0,0,33,1,0,0,12,1,0,7,103,101,116,95,
 108,101,100,0,34,1,0,0,28,2,0,0,9,1,0,2,
 28,3,0,0,9,2,0,3,28,4,0,0,9,3,0,4,
-30,7,1,216,9,9,114,32,61,32,115,101,108,102,46,101,
-120,112,114,101,115,115,105,111,110,40,116,46,98,112,41,0,
-12,7,0,10,101,120,112,114,101,115,115,105,111,110,0,0,
-9,6,1,7,12,8,0,2,98,112,0,0,9,7,2,8,
-31,5,7,1,19,5,6,5,15,4,5,0,30,5,1,217,
+30,9,1,202,9,9,114,32,61,32,84,111,107,101,110,40,
+116,46,112,111,115,44,39,103,101,116,39,44,39,46,39,44,
+91,108,101,102,116,93,41,0,12,7,0,5,84,111,107,101,
+110,0,0,0,13,6,7,0,12,11,0,3,112,111,115,0,
+9,7,2,11,12,8,0,3,103,101,116,0,12,9,0,1,
+46,0,0,0,15,11,3,0,27,10,11,1,31,5,7,4,
+19,5,6,5,15,4,5,0,30,5,1,203,9,9,105,116,
+101,109,115,32,61,32,32,91,108,101,102,116,93,0,0,0,
+15,7,3,0,27,6,7,1,15,5,6,0,30,4,1,204,
+9,9,109,111,114,101,32,61,32,70,97,108,115,101,0,0,
+11,7,0,1,0,0,0,0,0,0,0,0,15,6,7,0,
+30,10,1,205,9,9,119,104,105,108,101,32,110,111,116,32,
+115,101,108,102,46,99,104,101,99,107,40,115,101,108,102,46,
+116,111,107,101,110,44,39,93,39,41,58,0,12,13,0,5,
+99,104,101,99,107,0,0,0,49,9,1,13,12,13,0,5,
+116,111,107,101,110,0,0,0,9,11,1,13,12,12,0,1,
+93,0,0,0,50,8,9,2,47,7,8,0,21,7,0,0,
+18,0,0,147,30,4,1,206,9,9,9,109,111,114,101,32,
+61,32,70,97,108,115,101,0,11,7,0,1,0,0,0,0,
+0,0,0,0,15,6,7,0,30,9,1,207,9,9,9,105,
+102,32,115,101,108,102,46,99,104,101,99,107,40,115,101,108,
+102,46,116,111,107,101,110,44,39,58,39,41,58,0,0,0,
+12,12,0,5,99,104,101,99,107,0,0,0,49,8,1,12,
+12,12,0,5,116,111,107,101,110,0,0,0,9,10,1,12,
+12,11,0,1,58,0,0,0,50,7,8,2,21,7,0,0,
+18,0,0,41,30,14,1,208,9,9,9,9,105,116,101,109,
+115,46,97,112,112,101,110,100,40,84,111,107,101,110,40,115,
+101,108,102,46,116,111,107,101,110,46,112,111,115,44,39,115,
+121,109,98,111,108,39,44,39,78,111,110,101,39,41,41,0,
+12,11,0,6,97,112,112,101,110,100,0,0,49,8,5,11,
+12,12,0,5,84,111,107,101,110,0,0,0,13,11,12,0,
+12,15,0,5,116,111,107,101,110,0,0,0,9,12,1,15,
+12,15,0,3,112,111,115,0,9,12,12,15,12,13,0,6,
+115,121,109,98,111,108,0,0,12,14,0,4,78,111,110,101,
+0,0,0,0,31,10,12,3,19,10,11,10,50,7,8,1,
+18,0,0,27,30,10,1,210,9,9,9,9,105,116,101,109,
+115,46,97,112,112,101,110,100,40,115,101,108,102,46,101,120,
+112,114,101,115,115,105,111,110,40,48,41,41,0,0,0,0,
+12,11,0,6,97,112,112,101,110,100,0,0,49,8,5,11,
+12,14,0,10,101,120,112,114,101,115,115,105,111,110,0,0,
+49,11,1,14,11,13,0,1,0,0,0,0,0,0,0,0,
+50,10,11,1,50,7,8,1,18,0,0,1,30,9,1,211,
+9,9,9,105,102,32,115,101,108,102,46,99,104,101,99,107,
+40,115,101,108,102,46,116,111,107,101,110,44,39,58,39,41,
+58,0,0,0,12,12,0,5,99,104,101,99,107,0,0,0,
+49,8,1,12,12,12,0,5,116,111,107,101,110,0,0,0,
+9,10,1,12,12,11,0,1,58,0,0,0,50,7,8,2,
+21,7,0,0,18,0,0,25,30,6,1,212,9,9,9,9,
+115,101,108,102,46,97,100,118,97,110,99,101,40,39,58,39,
+41,0,0,0,12,11,0,7,97,100,118,97,110,99,101,0,
+49,8,1,11,12,10,0,1,58,0,0,0,50,7,8,1,
+30,4,1,213,9,9,9,9,109,111,114,101,32,61,32,84,
+114,117,101,0,11,7,0,1,1,0,0,0,0,0,0,0,
+15,6,7,0,18,0,0,1,18,0,255,97,30,3,1,214,
+9,9,105,102,32,109,111,114,101,58,0,0,21,6,0,0,
+18,0,0,41,30,14,1,215,9,9,9,105,116,101,109,115,
+46,97,112,112,101,110,100,40,84,111,107,101,110,40,115,101,
+108,102,46,116,111,107,101,110,46,112,111,115,44,39,115,121,
+109,98,111,108,39,44,39,78,111,110,101,39,41,41,0,0,
+12,11,0,6,97,112,112,101,110,100,0,0,49,8,5,11,
+12,12,0,5,84,111,107,101,110,0,0,0,13,11,12,0,
+12,15,0,5,116,111,107,101,110,0,0,0,9,12,1,15,
+12,15,0,3,112,111,115,0,9,12,12,15,12,13,0,6,
+115,121,109,98,111,108,0,0,12,14,0,4,78,111,110,101,
+0,0,0,0,31,10,12,3,19,10,11,10,50,7,8,1,
+18,0,0,1,30,6,1,216,9,9,105,102,32,108,101,110,
+40,105,116,101,109,115,41,32,62,32,50,58,0,0,0,0,
+11,7,0,1,2,0,0,0,0,0,0,0,12,10,0,3,
+108,101,110,0,13,9,10,0,15,10,5,0,31,8,10,1,
+19,8,9,8,25,7,7,8,21,7,0,0,18,0,0,40,
+30,14,1,217,9,9,9,105,116,101,109,115,32,61,32,91,
+108,101,102,116,44,84,111,107,101,110,40,116,46,112,111,115,
+44,39,115,108,105,99,101,39,44,39,58,39,44,105,116,101,
+109,115,91,49,58,93,41,93,0,0,0,0,15,8,3,0,
+12,11,0,5,84,111,107,101,110,0,0,0,13,10,11,0,
+12,15,0,3,112,111,115,0,9,11,2,15,12,12,0,5,
+115,108,105,99,101,0,0,0,12,13,0,1,58,0,0,0,
+11,16,0,1,1,0,0,0,0,0,0,0,28,17,0,0,
+27,15,16,2,9,14,5,15,31,9,11,4,19,9,10,9,
+27,7,8,2,15,5,7,0,18,0,0,1,30,5,1,218,
+9,9,114,46,105,116,101,109,115,32,61,32,105,116,101,109,
+115,0,0,0,12,7,0,5,105,116,101,109,115,0,0,0,
+10,4,7,5,30,5,1,219,9,9,115,101,108,102,46,97,
+100,118,97,110,99,101,40,34,93,34,41,0,12,11,0,7,
+97,100,118,97,110,99,101,0,49,8,1,11,12,10,0,1,
+93,0,0,0,50,7,8,1,30,3,1,220,9,9,114,101,
+116,117,114,110,32,114,0,0,20,4,0,0,0,0,0,0,
+12,41,0,7,103,101,116,95,108,101,100,0,10,8,41,40,
+16,41,0,76,44,10,0,0,30,7,1,223,9,100,101,102,
+32,100,111,116,95,108,101,100,40,115,101,108,102,44,116,44,
+108,101,102,116,41,58,0,0,12,1,0,9,116,105,110,121,
+112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,7,
+100,111,116,95,108,101,100,0,34,1,0,0,28,2,0,0,
+9,1,0,2,28,3,0,0,9,2,0,3,28,4,0,0,
+9,3,0,4,30,7,1,224,9,9,114,32,61,32,115,101,
+108,102,46,101,120,112,114,101,115,115,105,111,110,40,116,46,
+98,112,41,0,12,9,0,10,101,120,112,114,101,115,115,105,
+111,110,0,0,49,6,1,9,12,9,0,2,98,112,0,0,
+9,8,2,9,50,5,6,1,15,4,5,0,30,5,1,225,
 9,9,114,46,116,121,112,101,32,61,32,39,115,116,114,105,
 110,103,39,0,12,5,0,6,115,116,114,105,110,103,0,0,
 12,6,0,4,116,121,112,101,0,0,0,0,10,4,6,5,
-30,6,1,218,9,9,116,46,105,116,101,109,115,32,61,32,
+30,6,1,226,9,9,116,46,105,116,101,109,115,32,61,32,
 91,108,101,102,116,44,114,93,0,0,0,0,15,6,3,0,
 15,7,4,0,27,5,6,2,12,6,0,5,105,116,101,109,
-115,0,0,0,10,2,6,5,30,3,1,219,9,9,114,101,
+115,0,0,0,10,2,6,5,30,3,1,227,9,9,114,101,
 116,117,114,110,32,116,0,0,20,2,0,0,0,0,0,0,
-12,41,0,7,100,111,116,95,108,101,100,0,10,7,41,40,
-16,41,0,28,44,4,0,0,30,6,1,222,9,100,101,102,
+12,42,0,7,100,111,116,95,108,101,100,0,10,8,42,41,
+16,42,0,28,44,4,0,0,30,6,1,230,9,100,101,102,
 32,105,116,115,101,108,102,40,115,101,108,102,44,116,41,58,
 0,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
 121,0,0,0,33,1,0,0,12,1,0,6,105,116,115,101,
 108,102,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,3,0,0,9,2,0,3,30,3,1,223,9,9,114,101,
+28,3,0,0,9,2,0,3,30,3,1,231,9,9,114,101,
 116,117,114,110,32,116,0,0,20,2,0,0,0,0,0,0,
-12,42,0,6,105,116,115,101,108,102,0,0,10,7,42,41,
-16,42,0,91,44,7,0,0,30,6,1,226,9,100,101,102,
+12,43,0,6,105,116,115,101,108,102,0,0,10,8,43,42,
+16,43,0,87,44,9,0,0,30,6,1,234,9,100,101,102,
 32,112,97,114,101,110,95,110,117,100,40,115,101,108,102,44,
 116,41,58,0,12,1,0,9,116,105,110,121,112,121,46,112,
 121,0,0,0,33,1,0,0,12,1,0,9,112,97,114,101,
 110,95,110,117,100,0,0,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,30,5,1,227,
+9,1,0,2,28,3,0,0,9,2,0,3,30,5,1,235,
 9,9,115,101,108,102,46,116,119,101,97,107,40,39,44,39,
-44,49,41,0,12,5,0,5,116,119,101,97,107,0,0,0,
-9,4,1,5,12,5,0,1,44,0,0,0,11,6,0,0,
-0,0,0,0,0,0,240,63,31,3,5,2,19,3,4,3,
-30,7,1,228,9,9,114,32,61,32,115,101,108,102,46,101,
-120,112,114,101,115,115,105,111,110,40,48,41,0,0,0,0,
-12,6,0,10,101,120,112,114,101,115,115,105,111,110,0,0,
-9,5,1,6,11,6,0,0,0,0,0,0,0,0,0,0,
-31,4,6,1,19,4,5,4,15,3,4,0,30,5,1,229,
-9,9,115,101,108,102,46,114,101,115,116,111,114,101,40,41,
-0,0,0,0,12,6,0,7,114,101,115,116,111,114,101,0,
-9,5,1,6,31,4,0,0,19,4,5,4,30,5,1,230,
-9,9,115,101,108,102,46,97,100,118,97,110,99,101,40,39,
-41,39,41,0,12,6,0,7,97,100,118,97,110,99,101,0,
-9,5,1,6,12,6,0,1,41,0,0,0,31,4,6,1,
-19,4,5,4,30,3,1,231,9,9,114,101,116,117,114,110,
-32,114,0,0,20,3,0,0,0,0,0,0,12,43,0,9,
-112,97,114,101,110,95,110,117,100,0,0,0,10,7,43,42,
-16,43,1,122,44,11,0,0,30,6,1,234,9,100,101,102,
+44,49,41,0,12,8,0,5,116,119,101,97,107,0,0,0,
+49,4,1,8,12,6,0,1,44,0,0,0,11,7,0,1,
+1,0,0,0,0,0,0,0,50,3,4,2,30,7,1,236,
+9,9,114,32,61,32,115,101,108,102,46,101,120,112,114,101,
+115,115,105,111,110,40,48,41,0,0,0,0,12,8,0,10,
+101,120,112,114,101,115,115,105,111,110,0,0,49,5,1,8,
+11,7,0,1,0,0,0,0,0,0,0,0,50,4,5,1,
+15,3,4,0,30,5,1,237,9,9,115,101,108,102,46,114,
+101,115,116,111,114,101,40,41,0,0,0,0,12,7,0,7,
+114,101,115,116,111,114,101,0,49,5,1,7,50,4,5,0,
+30,5,1,238,9,9,115,101,108,102,46,97,100,118,97,110,
+99,101,40,39,41,39,41,0,12,8,0,7,97,100,118,97,
+110,99,101,0,49,5,1,8,12,7,0,1,41,0,0,0,
+50,4,5,1,30,3,1,239,9,9,114,101,116,117,114,110,
+32,114,0,0,20,3,0,0,0,0,0,0,12,44,0,9,
+112,97,114,101,110,95,110,117,100,0,0,0,10,8,44,43,
+16,44,1,106,44,13,0,0,30,6,1,242,9,100,101,102,
 32,108,105,115,116,95,110,117,100,40,115,101,108,102,44,116,
 41,58,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
 121,0,0,0,33,1,0,0,12,1,0,8,108,105,115,116,
 95,110,117,100,0,0,0,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,30,5,1,235,
+9,1,0,2,28,3,0,0,9,2,0,3,30,5,1,243,
 9,9,116,46,116,121,112,101,32,61,32,39,108,105,115,116,
 39,0,0,0,12,3,0,4,108,105,115,116,0,0,0,0,
 12,4,0,4,116,121,112,101,0,0,0,0,10,2,4,3,
-30,4,1,236,9,9,116,46,118,97,108,32,61,32,39,91,
+30,4,1,244,9,9,116,46,118,97,108,32,61,32,39,91,
 93,39,0,0,12,3,0,2,91,93,0,0,12,4,0,3,
-118,97,108,0,10,2,4,3,30,4,1,237,9,9,116,46,
+118,97,108,0,10,2,4,3,30,4,1,245,9,9,116,46,
 105,116,101,109,115,32,61,32,91,93,0,0,27,3,0,0,
 12,4,0,5,105,116,101,109,115,0,0,0,10,2,4,3,
-30,5,1,238,9,9,110,101,120,116,32,61,32,115,101,108,
+30,5,1,246,9,9,110,101,120,116,32,61,32,115,101,108,
 102,46,116,111,107,101,110,0,12,5,0,5,116,111,107,101,
-110,0,0,0,9,4,1,5,15,3,4,0,30,5,1,239,
+110,0,0,0,9,4,1,5,15,3,4,0,30,5,1,247,
 9,9,115,101,108,102,46,116,119,101,97,107,40,39,44,39,
-44,48,41,0,12,6,0,5,116,119,101,97,107,0,0,0,
-9,5,1,6,12,6,0,1,44,0,0,0,11,7,0,0,
-0,0,0,0,0,0,0,0,31,4,6,2,19,4,5,4,
-30,12,1,240,9,9,119,104,105,108,101,32,110,111,116,32,
-115,101,108,102,46,99,104,101,99,107,40,115,101,108,102,46,
-116,111,107,101,110,44,39,102,111,114,39,44,39,93,39,41,
-58,0,0,0,12,7,0,5,99,104,101,99,107,0,0,0,
-9,6,1,7,12,10,0,5,116,111,107,101,110,0,0,0,
-9,7,1,10,12,8,0,3,102,111,114,0,12,9,0,1,
-93,0,0,0,31,5,7,3,19,5,6,5,47,4,5,0,
-21,4,0,0,18,0,0,73,30,7,1,241,9,9,9,114,
-32,61,32,115,101,108,102,46,101,120,112,114,101,115,115,105,
-111,110,40,48,41,0,0,0,12,7,0,10,101,120,112,114,
-101,115,115,105,111,110,0,0,9,6,1,7,11,7,0,0,
-0,0,0,0,0,0,0,0,31,5,7,1,19,5,6,5,
-15,4,5,0,30,6,1,242,9,9,9,116,46,105,116,101,
-109,115,46,97,112,112,101,110,100,40,114,41,0,0,0,0,
-12,7,0,5,105,116,101,109,115,0,0,0,9,6,2,7,
-12,7,0,6,97,112,112,101,110,100,0,0,9,6,6,7,
-15,7,4,0,31,5,7,1,19,5,6,5,30,12,1,243,
+44,48,41,0,12,9,0,5,116,119,101,97,107,0,0,0,
+49,5,1,9,12,7,0,1,44,0,0,0,11,8,0,1,
+0,0,0,0,0,0,0,0,50,4,5,2,30,12,1,248,
+9,9,119,104,105,108,101,32,110,111,116,32,115,101,108,102,
+46,99,104,101,99,107,40,115,101,108,102,46,116,111,107,101,
+110,44,39,102,111,114,39,44,39,93,39,41,58,0,0,0,
+12,11,0,5,99,104,101,99,107,0,0,0,49,6,1,11,
+12,11,0,5,116,111,107,101,110,0,0,0,9,8,1,11,
+12,9,0,3,102,111,114,0,12,10,0,1,93,0,0,0,
+50,5,6,3,47,4,5,0,21,4,0,0,18,0,0,70,
+30,7,1,249,9,9,9,114,32,61,32,115,101,108,102,46,
+101,120,112,114,101,115,115,105,111,110,40,48,41,0,0,0,
+12,9,0,10,101,120,112,114,101,115,115,105,111,110,0,0,
+49,6,1,9,11,8,0,1,0,0,0,0,0,0,0,0,
+50,5,6,1,15,4,5,0,30,6,1,250,9,9,9,116,
+46,105,116,101,109,115,46,97,112,112,101,110,100,40,114,41,
+0,0,0,0,12,10,0,5,105,116,101,109,115,0,0,0,
+9,9,2,10,12,10,0,6,97,112,112,101,110,100,0,0,
+49,6,9,10,15,8,4,0,50,5,6,1,30,12,1,251,
 9,9,9,105,102,32,115,101,108,102,46,116,111,107,101,110,
 46,118,97,108,32,61,61,32,39,44,39,58,32,115,101,108,
 102,46,97,100,118,97,110,99,101,40,39,44,39,41,0,0,
 12,6,0,5,116,111,107,101,110,0,0,0,9,5,1,6,
 12,6,0,3,118,97,108,0,9,5,5,6,12,6,0,1,
-44,0,0,0,23,5,5,6,21,5,0,0,18,0,0,10,
-12,7,0,7,97,100,118,97,110,99,101,0,9,6,1,7,
-12,7,0,1,44,0,0,0,31,5,7,1,19,5,6,5,
-18,0,0,1,18,0,255,168,30,9,1,244,9,9,105,102,
-32,115,101,108,102,46,99,104,101,99,107,40,115,101,108,102,
-46,116,111,107,101,110,44,39,102,111,114,39,41,58,0,0,
-12,7,0,5,99,104,101,99,107,0,0,0,9,6,1,7,
-12,9,0,5,116,111,107,101,110,0,0,0,9,7,1,9,
-12,8,0,3,102,111,114,0,31,5,7,2,19,5,6,5,
-21,5,0,0,18,0,0,137,30,5,1,245,9,9,9,116,
-46,116,121,112,101,32,61,32,39,99,111,109,112,39,0,0,
-12,5,0,4,99,111,109,112,0,0,0,0,12,6,0,4,
-116,121,112,101,0,0,0,0,10,2,6,5,30,6,1,246,
-9,9,9,115,101,108,102,46,97,100,118,97,110,99,101,40,
-39,102,111,114,39,41,0,0,12,7,0,7,97,100,118,97,
-110,99,101,0,9,6,1,7,12,7,0,3,102,111,114,0,
-31,5,7,1,19,5,6,5,30,6,1,247,9,9,9,115,
-101,108,102,46,116,119,101,97,107,40,39,105,110,39,44,48,
-41,0,0,0,12,7,0,5,116,119,101,97,107,0,0,0,
-9,6,1,7,12,7,0,2,105,110,0,0,11,8,0,0,
-0,0,0,0,0,0,0,0,31,5,7,2,19,5,6,5,
-30,10,1,248,9,9,9,116,46,105,116,101,109,115,46,97,
+44,0,0,0,23,5,5,6,21,5,0,0,18,0,0,9,
+12,9,0,7,97,100,118,97,110,99,101,0,49,6,1,9,
+12,8,0,1,44,0,0,0,50,5,6,1,18,0,0,1,
+18,0,255,172,30,9,1,252,9,9,105,102,32,115,101,108,
+102,46,99,104,101,99,107,40,115,101,108,102,46,116,111,107,
+101,110,44,39,102,111,114,39,41,58,0,0,12,10,0,5,
+99,104,101,99,107,0,0,0,49,6,1,10,12,10,0,5,
+116,111,107,101,110,0,0,0,9,8,1,10,12,9,0,3,
+102,111,114,0,50,5,6,2,21,5,0,0,18,0,0,129,
+30,5,1,253,9,9,9,116,46,116,121,112,101,32,61,32,
+39,99,111,109,112,39,0,0,12,5,0,4,99,111,109,112,
+0,0,0,0,12,6,0,4,116,121,112,101,0,0,0,0,
+10,2,6,5,30,6,1,254,9,9,9,115,101,108,102,46,
+97,100,118,97,110,99,101,40,39,102,111,114,39,41,0,0,
+12,9,0,7,97,100,118,97,110,99,101,0,49,6,1,9,
+12,8,0,3,102,111,114,0,50,5,6,1,30,6,1,255,
+9,9,9,115,101,108,102,46,116,119,101,97,107,40,39,105,
+110,39,44,48,41,0,0,0,12,10,0,5,116,119,101,97,
+107,0,0,0,49,6,1,10,12,8,0,2,105,110,0,0,
+11,9,0,1,0,0,0,0,0,0,0,0,50,5,6,2,
+30,10,2,0,9,9,9,116,46,105,116,101,109,115,46,97,
 112,112,101,110,100,40,115,101,108,102,46,101,120,112,114,101,
-115,115,105,111,110,40,48,41,41,0,0,0,12,7,0,5,
-105,116,101,109,115,0,0,0,9,6,2,7,12,7,0,6,
-97,112,112,101,110,100,0,0,9,6,6,7,12,9,0,10,
-101,120,112,114,101,115,115,105,111,110,0,0,9,8,1,9,
-11,9,0,0,0,0,0,0,0,0,0,0,31,7,9,1,
-19,7,8,7,31,5,7,1,19,5,6,5,30,6,1,249,
-9,9,9,115,101,108,102,46,97,100,118,97,110,99,101,40,
-39,105,110,39,41,0,0,0,12,7,0,7,97,100,118,97,
-110,99,101,0,9,6,1,7,12,7,0,2,105,110,0,0,
-31,5,7,1,19,5,6,5,30,10,1,250,9,9,9,116,
-46,105,116,101,109,115,46,97,112,112,101,110,100,40,115,101,
-108,102,46,101,120,112,114,101,115,115,105,111,110,40,48,41,
-41,0,0,0,12,7,0,5,105,116,101,109,115,0,0,0,
-9,6,2,7,12,7,0,6,97,112,112,101,110,100,0,0,
-9,6,6,7,12,9,0,10,101,120,112,114,101,115,115,105,
-111,110,0,0,9,8,1,9,11,9,0,0,0,0,0,0,
-0,0,0,0,31,7,9,1,19,7,8,7,31,5,7,1,
-19,5,6,5,30,5,1,251,9,9,9,115,101,108,102,46,
-114,101,115,116,111,114,101,40,41,0,0,0,12,7,0,7,
-114,101,115,116,111,114,101,0,9,6,1,7,31,5,0,0,
-19,5,6,5,18,0,0,1,30,5,1,252,9,9,115,101,
-108,102,46,114,101,115,116,111,114,101,40,41,0,0,0,0,
-12,7,0,7,114,101,115,116,111,114,101,0,9,6,1,7,
-31,5,0,0,19,5,6,5,30,5,1,253,9,9,115,101,
-108,102,46,97,100,118,97,110,99,101,40,39,93,39,41,0,
-12,7,0,7,97,100,118,97,110,99,101,0,9,6,1,7,
-12,7,0,1,93,0,0,0,31,5,7,1,19,5,6,5,
-30,3,1,254,9,9,114,101,116,117,114,110,32,116,0,0,
-20,2,0,0,0,0,0,0,12,44,0,8,108,105,115,116,
-95,110,117,100,0,0,0,0,10,7,44,43,16,44,0,200,
-44,9,0,0,30,6,2,1,9,100,101,102,32,100,105,99,
+115,115,105,111,110,40,48,41,41,0,0,0,12,10,0,5,
+105,116,101,109,115,0,0,0,9,9,2,10,12,10,0,6,
+97,112,112,101,110,100,0,0,49,6,9,10,12,12,0,10,
+101,120,112,114,101,115,115,105,111,110,0,0,49,9,1,12,
+11,11,0,1,0,0,0,0,0,0,0,0,50,8,9,1,
+50,5,6,1,30,6,2,1,9,9,9,115,101,108,102,46,
+97,100,118,97,110,99,101,40,39,105,110,39,41,0,0,0,
+12,9,0,7,97,100,118,97,110,99,101,0,49,6,1,9,
+12,8,0,2,105,110,0,0,50,5,6,1,30,10,2,2,
+9,9,9,116,46,105,116,101,109,115,46,97,112,112,101,110,
+100,40,115,101,108,102,46,101,120,112,114,101,115,115,105,111,
+110,40,48,41,41,0,0,0,12,10,0,5,105,116,101,109,
+115,0,0,0,9,9,2,10,12,10,0,6,97,112,112,101,
+110,100,0,0,49,6,9,10,12,12,0,10,101,120,112,114,
+101,115,115,105,111,110,0,0,49,9,1,12,11,11,0,1,
+0,0,0,0,0,0,0,0,50,8,9,1,50,5,6,1,
+30,5,2,3,9,9,9,115,101,108,102,46,114,101,115,116,
+111,114,101,40,41,0,0,0,12,8,0,7,114,101,115,116,
+111,114,101,0,49,6,1,8,50,5,6,0,18,0,0,1,
+30,5,2,4,9,9,115,101,108,102,46,114,101,115,116,111,
+114,101,40,41,0,0,0,0,12,8,0,7,114,101,115,116,
+111,114,101,0,49,6,1,8,50,5,6,0,30,5,2,5,
+9,9,115,101,108,102,46,97,100,118,97,110,99,101,40,39,
+93,39,41,0,12,9,0,7,97,100,118,97,110,99,101,0,
+49,6,1,9,12,8,0,1,93,0,0,0,50,5,6,1,
+30,3,2,6,9,9,114,101,116,117,114,110,32,116,0,0,
+20,2,0,0,0,0,0,0,12,45,0,8,108,105,115,116,
+95,110,117,100,0,0,0,0,10,8,45,44,16,45,0,192,
+44,11,0,0,30,6,2,9,9,100,101,102,32,100,105,99,
 116,95,110,117,100,40,115,101,108,102,44,116,41,58,0,0,
 12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
 33,1,0,0,12,1,0,8,100,105,99,116,95,110,117,100,
 0,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,3,0,0,9,2,0,3,30,4,2,2,9,9,116,46,
+28,3,0,0,9,2,0,3,30,4,2,10,9,9,116,46,
 116,121,112,101,61,39,100,105,99,116,39,0,12,3,0,4,
 100,105,99,116,0,0,0,0,12,4,0,4,116,121,112,101,
-0,0,0,0,10,2,4,3,30,4,2,3,9,9,116,46,
+0,0,0,0,10,2,4,3,30,4,2,11,9,9,116,46,
 118,97,108,32,61,32,39,123,125,39,0,0,12,3,0,2,
 123,125,0,0,12,4,0,3,118,97,108,0,10,2,4,3,
-30,4,2,4,9,9,116,46,105,116,101,109,115,32,61,32,
+30,4,2,12,9,9,116,46,105,116,101,109,115,32,61,32,
 91,93,0,0,27,3,0,0,12,4,0,5,105,116,101,109,
-115,0,0,0,10,2,4,3,30,5,2,5,9,9,115,101,
+115,0,0,0,10,2,4,3,30,5,2,13,9,9,115,101,
 108,102,46,116,119,101,97,107,40,39,44,39,44,48,41,0,
-12,5,0,5,116,119,101,97,107,0,0,0,9,4,1,5,
-12,5,0,1,44,0,0,0,11,6,0,0,0,0,0,0,
-0,0,0,0,31,3,5,2,19,3,4,3,30,10,2,6,
-9,9,119,104,105,108,101,32,110,111,116,32,115,101,108,102,
-46,99,104,101,99,107,40,115,101,108,102,46,116,111,107,101,
-110,44,39,125,39,41,58,0,12,6,0,5,99,104,101,99,
-107,0,0,0,9,5,1,6,12,8,0,5,116,111,107,101,
-110,0,0,0,9,6,1,8,12,7,0,1,125,0,0,0,
-31,4,6,2,19,4,5,4,47,3,4,0,21,3,0,0,
-18,0,0,71,30,10,2,7,9,9,9,116,46,105,116,101,
-109,115,46,97,112,112,101,110,100,40,115,101,108,102,46,101,
-120,112,114,101,115,115,105,111,110,40,48,41,41,0,0,0,
-12,5,0,5,105,116,101,109,115,0,0,0,9,4,2,5,
-12,5,0,6,97,112,112,101,110,100,0,0,9,4,4,5,
-12,7,0,10,101,120,112,114,101,115,115,105,111,110,0,0,
-9,6,1,7,11,7,0,0,0,0,0,0,0,0,0,0,
-31,5,7,1,19,5,6,5,31,3,5,1,19,3,4,3,
-30,14,2,8,9,9,9,105,102,32,115,101,108,102,46,99,
+12,8,0,5,116,119,101,97,107,0,0,0,49,4,1,8,
+12,6,0,1,44,0,0,0,11,7,0,1,0,0,0,0,
+0,0,0,0,50,3,4,2,30,10,2,14,9,9,119,104,
+105,108,101,32,110,111,116,32,115,101,108,102,46,99,104,101,
+99,107,40,115,101,108,102,46,116,111,107,101,110,44,39,125,
+39,41,58,0,12,9,0,5,99,104,101,99,107,0,0,0,
+49,5,1,9,12,9,0,5,116,111,107,101,110,0,0,0,
+9,7,1,9,12,8,0,1,125,0,0,0,50,4,5,2,
+47,3,4,0,21,3,0,0,18,0,0,67,30,10,2,15,
+9,9,9,116,46,105,116,101,109,115,46,97,112,112,101,110,
+100,40,115,101,108,102,46,101,120,112,114,101,115,115,105,111,
+110,40,48,41,41,0,0,0,12,8,0,5,105,116,101,109,
+115,0,0,0,9,7,2,8,12,8,0,6,97,112,112,101,
+110,100,0,0,49,4,7,8,12,10,0,10,101,120,112,114,
+101,115,115,105,111,110,0,0,49,7,1,10,11,9,0,1,
+0,0,0,0,0,0,0,0,50,6,7,1,50,3,4,1,
+30,14,2,16,9,9,9,105,102,32,115,101,108,102,46,99,
 104,101,99,107,40,115,101,108,102,46,116,111,107,101,110,44,
 39,58,39,44,39,44,39,41,58,32,115,101,108,102,46,97,
-100,118,97,110,99,101,40,41,0,0,0,0,12,5,0,5,
-99,104,101,99,107,0,0,0,9,4,1,5,12,8,0,5,
-116,111,107,101,110,0,0,0,9,5,1,8,12,6,0,1,
-58,0,0,0,12,7,0,1,44,0,0,0,31,3,5,3,
-19,3,4,3,21,3,0,0,18,0,0,8,12,5,0,7,
-97,100,118,97,110,99,101,0,9,4,1,5,31,3,0,0,
-19,3,4,3,18,0,0,1,18,0,255,172,30,5,2,9,
-9,9,115,101,108,102,46,114,101,115,116,111,114,101,40,41,
-0,0,0,0,12,5,0,7,114,101,115,116,111,114,101,0,
-9,4,1,5,31,3,0,0,19,3,4,3,30,5,2,10,
-9,9,115,101,108,102,46,97,100,118,97,110,99,101,40,39,
-125,39,41,0,12,5,0,7,97,100,118,97,110,99,101,0,
-9,4,1,5,12,5,0,1,125,0,0,0,31,3,5,1,
-19,3,4,3,30,3,2,11,9,9,114,101,116,117,114,110,
-32,116,0,0,20,2,0,0,0,0,0,0,12,45,0,8,
-100,105,99,116,95,110,117,100,0,0,0,0,10,7,45,44,
-16,45,1,9,44,12,0,0,30,8,2,14,9,100,101,102,
+100,118,97,110,99,101,40,41,0,0,0,0,12,9,0,5,
+99,104,101,99,107,0,0,0,49,4,1,9,12,9,0,5,
+116,111,107,101,110,0,0,0,9,6,1,9,12,7,0,1,
+58,0,0,0,12,8,0,1,44,0,0,0,50,3,4,3,
+21,3,0,0,18,0,0,7,12,6,0,7,97,100,118,97,
+110,99,101,0,49,4,1,6,50,3,4,0,18,0,0,1,
+18,0,255,177,30,5,2,17,9,9,115,101,108,102,46,114,
+101,115,116,111,114,101,40,41,0,0,0,0,12,6,0,7,
+114,101,115,116,111,114,101,0,49,4,1,6,50,3,4,0,
+30,5,2,18,9,9,115,101,108,102,46,97,100,118,97,110,
+99,101,40,39,125,39,41,0,12,7,0,7,97,100,118,97,
+110,99,101,0,49,4,1,7,12,6,0,1,125,0,0,0,
+50,3,4,1,30,3,2,19,9,9,114,101,116,117,114,110,
+32,116,0,0,20,2,0,0,0,0,0,0,12,46,0,8,
+100,105,99,116,95,110,117,100,0,0,0,0,10,8,46,45,
+16,46,1,5,44,13,0,0,30,8,2,22,9,100,101,102,
 32,97,100,118,97,110,99,101,40,115,101,108,102,44,118,97,
 108,61,78,111,110,101,41,58,0,0,0,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
 12,1,0,7,97,100,118,97,110,99,101,0,34,1,0,0,
 28,2,0,0,9,1,0,2,28,2,0,0,28,3,0,0,
-32,2,0,3,30,10,2,15,9,9,105,102,32,110,111,116,
+32,2,0,3,30,10,2,23,9,9,105,102,32,110,111,116,
 32,115,101,108,102,46,99,104,101,99,107,40,115,101,108,102,
 46,116,111,107,101,110,44,118,97,108,41,58,0,0,0,0,
-12,6,0,5,99,104,101,99,107,0,0,0,9,5,1,6,
-12,8,0,5,116,111,107,101,110,0,0,0,9,6,1,8,
-15,7,2,0,31,4,6,2,19,4,5,4,47,3,4,0,
-21,3,0,0,18,0,0,31,30,12,2,16,9,9,9,115,
-101,108,102,46,114,97,105,115,101,69,114,114,111,114,40,39,
-101,120,112,101,99,116,101,100,32,39,43,118,97,108,44,115,
-101,108,102,46,116,111,107,101,110,41,0,0,12,5,0,10,
-114,97,105,115,101,69,114,114,111,114,0,0,9,4,1,5,
-12,5,0,9,101,120,112,101,99,116,101,100,32,0,0,0,
-1,5,5,2,12,7,0,5,116,111,107,101,110,0,0,0,
-9,6,1,7,31,3,5,2,19,3,4,3,18,0,0,1,
-30,9,2,17,9,9,105,102,32,115,101,108,102,46,112,111,
-115,32,60,32,108,101,110,40,115,101,108,102,46,116,111,107,
-101,110,115,41,58,0,0,0,12,4,0,3,112,111,115,0,
-9,3,1,4,12,6,0,3,108,101,110,0,13,5,6,0,
-12,7,0,6,116,111,107,101,110,115,0,0,9,6,1,7,
-31,4,6,1,19,4,5,4,25,3,3,4,21,3,0,0,
-18,0,0,36,30,8,2,18,9,9,9,116,32,61,32,115,
-101,108,102,46,116,111,107,101,110,115,91,115,101,108,102,46,
-112,111,115,93,0,0,0,0,12,5,0,6,116,111,107,101,
-110,115,0,0,9,4,1,5,12,6,0,3,112,111,115,0,
-9,5,1,6,9,4,4,5,15,3,4,0,30,5,2,19,
-9,9,9,115,101,108,102,46,112,111,115,32,43,61,32,49,
-0,0,0,0,12,5,0,3,112,111,115,0,9,4,1,5,
-11,5,0,0,0,0,0,0,0,0,240,63,1,4,4,5,
-12,5,0,3,112,111,115,0,10,1,5,4,18,0,0,29,
-30,8,2,21,9,9,9,116,32,61,32,84,111,107,101,110,
-40,40,48,44,48,41,44,39,101,111,102,39,44,39,101,111,
-102,39,41,0,12,6,0,5,84,111,107,101,110,0,0,0,
-13,5,6,0,11,9,0,0,0,0,0,0,0,0,0,0,
-11,10,0,0,0,0,0,0,0,0,0,0,27,6,9,2,
-12,7,0,3,101,111,102,0,12,8,0,3,101,111,102,0,
-31,4,6,3,19,4,5,4,15,3,4,0,18,0,0,1,
-30,7,2,22,9,9,115,101,108,102,46,116,111,107,101,110,
-32,61,32,115,101,108,102,46,100,111,40,116,41,0,0,0,
-12,6,0,2,100,111,0,0,9,5,1,6,15,6,3,0,
-31,4,6,1,19,4,5,4,12,5,0,5,116,111,107,101,
-110,0,0,0,10,1,5,4,30,6,2,24,9,9,115,101,
-108,102,46,95,116,101,114,109,105,110,97,108,32,43,61,32,
-49,0,0,0,12,5,0,9,95,116,101,114,109,105,110,97,
-108,0,0,0,9,4,1,5,11,5,0,0,0,0,0,0,
-0,0,240,63,1,4,4,5,12,5,0,9,95,116,101,114,
-109,105,110,97,108,0,0,0,10,1,5,4,30,14,2,25,
-9,9,105,102,32,115,101,108,102,46,99,104,101,99,107,40,
-115,101,108,102,46,116,111,107,101,110,44,39,110,108,39,44,
-39,101,111,102,39,44,39,59,39,44,39,100,101,100,101,110,
-116,39,41,58,0,0,0,0,12,6,0,5,99,104,101,99,
-107,0,0,0,9,5,1,6,12,11,0,5,116,111,107,101,
-110,0,0,0,9,6,1,11,12,7,0,2,110,108,0,0,
-12,8,0,3,101,111,102,0,12,9,0,1,59,0,0,0,
-12,10,0,6,100,101,100,101,110,116,0,0,31,4,6,5,
-19,4,5,4,21,4,0,0,18,0,0,17,30,6,2,26,
-9,9,9,115,101,108,102,46,95,116,101,114,109,105,110,97,
-108,32,61,32,48,0,0,0,11,4,0,0,0,0,0,0,
+12,9,0,5,99,104,101,99,107,0,0,0,49,5,1,9,
+12,9,0,5,116,111,107,101,110,0,0,0,9,7,1,9,
+15,8,2,0,50,4,5,2,47,3,4,0,21,3,0,0,
+18,0,0,30,30,12,2,24,9,9,9,115,101,108,102,46,
+114,97,105,115,101,69,114,114,111,114,40,39,101,120,112,101,
+99,116,101,100,32,39,43,118,97,108,44,115,101,108,102,46,
+116,111,107,101,110,41,0,0,12,8,0,10,114,97,105,115,
+101,69,114,114,111,114,0,0,49,4,1,8,12,6,0,9,
+101,120,112,101,99,116,101,100,32,0,0,0,1,6,6,2,
+12,8,0,5,116,111,107,101,110,0,0,0,9,7,1,8,
+50,3,4,2,18,0,0,1,30,9,2,25,9,9,105,102,
+32,115,101,108,102,46,112,111,115,32,60,32,108,101,110,40,
+115,101,108,102,46,116,111,107,101,110,115,41,58,0,0,0,
+12,4,0,3,112,111,115,0,9,3,1,4,12,6,0,3,
+108,101,110,0,13,5,6,0,12,7,0,6,116,111,107,101,
+110,115,0,0,9,6,1,7,31,4,6,1,19,4,5,4,
+25,3,3,4,21,3,0,0,18,0,0,36,30,8,2,26,
+9,9,9,116,32,61,32,115,101,108,102,46,116,111,107,101,
+110,115,91,115,101,108,102,46,112,111,115,93,0,0,0,0,
+12,5,0,6,116,111,107,101,110,115,0,0,9,4,1,5,
+12,6,0,3,112,111,115,0,9,5,1,6,9,4,4,5,
+15,3,4,0,30,5,2,27,9,9,9,115,101,108,102,46,
+112,111,115,32,43,61,32,49,0,0,0,0,12,5,0,3,
+112,111,115,0,9,4,1,5,11,5,0,1,1,0,0,0,
+0,0,0,0,1,4,4,5,12,5,0,3,112,111,115,0,
+10,1,5,4,18,0,0,29,30,8,2,29,9,9,9,116,
+32,61,32,84,111,107,101,110,40,40,48,44,48,41,44,39,
+101,111,102,39,44,39,101,111,102,39,41,0,12,6,0,5,
+84,111,107,101,110,0,0,0,13,5,6,0,11,9,0,1,
+0,0,0,0,0,0,0,0,11,10,0,1,0,0,0,0,
+0,0,0,0,27,6,9,2,12,7,0,3,101,111,102,0,
+12,8,0,3,101,111,102,0,31,4,6,3,19,4,5,4,
+15,3,4,0,18,0,0,1,30,7,2,30,9,9,115,101,
+108,102,46,116,111,107,101,110,32,61,32,115,101,108,102,46,
+100,111,40,116,41,0,0,0,12,8,0,2,100,111,0,0,
+49,5,1,8,15,7,3,0,50,4,5,1,12,5,0,5,
+116,111,107,101,110,0,0,0,10,1,5,4,30,6,2,32,
+9,9,115,101,108,102,46,95,116,101,114,109,105,110,97,108,
+32,43,61,32,49,0,0,0,12,5,0,9,95,116,101,114,
+109,105,110,97,108,0,0,0,9,4,1,5,11,5,0,1,
+1,0,0,0,0,0,0,0,1,4,4,5,12,5,0,9,
+95,116,101,114,109,105,110,97,108,0,0,0,10,1,5,4,
+30,14,2,33,9,9,105,102,32,115,101,108,102,46,99,104,
+101,99,107,40,115,101,108,102,46,116,111,107,101,110,44,39,
+110,108,39,44,39,101,111,102,39,44,39,59,39,44,39,100,
+101,100,101,110,116,39,41,58,0,0,0,0,12,12,0,5,
+99,104,101,99,107,0,0,0,49,5,1,12,12,12,0,5,
+116,111,107,101,110,0,0,0,9,7,1,12,12,8,0,2,
+110,108,0,0,12,9,0,3,101,111,102,0,12,10,0,1,
+59,0,0,0,12,11,0,6,100,101,100,101,110,116,0,0,
+50,4,5,5,21,4,0,0,18,0,0,17,30,6,2,34,
+9,9,9,115,101,108,102,46,95,116,101,114,109,105,110,97,
+108,32,61,32,48,0,0,0,11,4,0,1,0,0,0,0,
 0,0,0,0,12,5,0,9,95,116,101,114,109,105,110,97,
-108,0,0,0,10,1,5,4,18,0,0,1,30,3,2,27,
+108,0,0,0,10,1,5,4,18,0,0,1,30,3,2,35,
 9,9,114,101,116,117,114,110,32,116,0,0,20,3,0,0,
-0,0,0,0,12,46,0,7,97,100,118,97,110,99,101,0,
-10,7,46,45,16,46,0,184,44,9,0,0,30,7,2,31,
+0,0,0,0,12,47,0,7,97,100,118,97,110,99,101,0,
+10,8,47,46,16,47,0,176,44,11,0,0,30,7,2,39,
 9,100,101,102,32,105,98,108,111,99,107,40,115,101,108,102,
 44,105,116,101,109,115,41,58,0,0,0,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
 12,1,0,6,105,98,108,111,99,107,0,0,34,1,0,0,
 28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-30,14,2,32,9,9,119,104,105,108,101,32,115,101,108,102,
+30,14,2,40,9,9,119,104,105,108,101,32,115,101,108,102,
 46,99,104,101,99,107,40,115,101,108,102,46,116,111,107,101,
 110,44,39,110,108,39,44,39,59,39,41,58,32,115,101,108,
-102,46,97,100,118,97,110,99,101,40,41,0,12,5,0,5,
-99,104,101,99,107,0,0,0,9,4,1,5,12,8,0,5,
-116,111,107,101,110,0,0,0,9,5,1,8,12,6,0,2,
-110,108,0,0,12,7,0,1,59,0,0,0,31,3,5,3,
-19,3,4,3,21,3,0,0,18,0,0,8,12,5,0,7,
-97,100,118,97,110,99,101,0,9,4,1,5,31,3,0,0,
-19,3,4,3,18,0,255,234,30,4,2,33,9,9,119,104,
-105,108,101,32,84,114,117,101,58,0,0,0,11,3,0,0,
-0,0,0,0,0,0,240,63,21,3,0,0,18,0,0,113,
-30,9,2,34,9,9,9,105,116,101,109,115,46,97,112,112,
-101,110,100,40,115,101,108,102,46,101,120,112,114,101,115,115,
-105,111,110,40,48,41,41,0,12,5,0,6,97,112,112,101,
-110,100,0,0,9,4,2,5,12,7,0,10,101,120,112,114,
-101,115,115,105,111,110,0,0,9,6,1,7,11,7,0,0,
-0,0,0,0,0,0,0,0,31,5,7,1,19,5,6,5,
-31,3,5,1,19,3,4,3,30,5,2,35,9,9,9,115,
+102,46,97,100,118,97,110,99,101,40,41,0,12,9,0,5,
+99,104,101,99,107,0,0,0,49,4,1,9,12,9,0,5,
+116,111,107,101,110,0,0,0,9,6,1,9,12,7,0,2,
+110,108,0,0,12,8,0,1,59,0,0,0,50,3,4,3,
+21,3,0,0,18,0,0,7,12,6,0,7,97,100,118,97,
+110,99,101,0,49,4,1,6,50,3,4,0,18,0,255,236,
+30,4,2,41,9,9,119,104,105,108,101,32,84,114,117,101,
+58,0,0,0,11,3,0,1,1,0,0,0,0,0,0,0,
+21,3,0,0,18,0,0,107,30,9,2,42,9,9,9,105,
+116,101,109,115,46,97,112,112,101,110,100,40,115,101,108,102,
+46,101,120,112,114,101,115,115,105,111,110,40,48,41,41,0,
+12,7,0,6,97,112,112,101,110,100,0,0,49,4,2,7,
+12,10,0,10,101,120,112,114,101,115,115,105,111,110,0,0,
+49,7,1,10,11,9,0,1,0,0,0,0,0,0,0,0,
+50,6,7,1,50,3,4,1,30,5,2,43,9,9,9,115,
 101,108,102,46,116,101,114,109,105,110,97,108,40,41,0,0,
-12,5,0,8,116,101,114,109,105,110,97,108,0,0,0,0,
-9,4,1,5,31,3,0,0,19,3,4,3,30,15,2,36,
-9,9,9,119,104,105,108,101,32,115,101,108,102,46,99,104,
-101,99,107,40,115,101,108,102,46,116,111,107,101,110,44,39,
-110,108,39,44,39,59,39,41,58,32,115,101,108,102,46,97,
-100,118,97,110,99,101,40,41,0,0,0,0,12,5,0,5,
-99,104,101,99,107,0,0,0,9,4,1,5,12,8,0,5,
-116,111,107,101,110,0,0,0,9,5,1,8,12,6,0,2,
-110,108,0,0,12,7,0,1,59,0,0,0,31,3,5,3,
-19,3,4,3,21,3,0,0,18,0,0,8,12,5,0,7,
-97,100,118,97,110,99,101,0,9,4,1,5,31,3,0,0,
-19,3,4,3,18,0,255,234,30,13,2,37,9,9,9,105,
-102,32,115,101,108,102,46,99,104,101,99,107,40,115,101,108,
-102,46,116,111,107,101,110,44,39,100,101,100,101,110,116,39,
-44,39,101,111,102,39,41,58,32,98,114,101,97,107,0,0,
-12,5,0,5,99,104,101,99,107,0,0,0,9,4,1,5,
-12,8,0,5,116,111,107,101,110,0,0,0,9,5,1,8,
-12,6,0,6,100,101,100,101,110,116,0,0,12,7,0,3,
-101,111,102,0,31,3,5,3,19,3,4,3,21,3,0,0,
-18,0,0,3,18,0,0,3,18,0,0,1,18,0,255,140,
-0,0,0,0,12,47,0,6,105,98,108,111,99,107,0,0,
-10,7,47,46,16,47,1,100,44,11,0,0,30,5,2,40,
+12,6,0,8,116,101,114,109,105,110,97,108,0,0,0,0,
+49,4,1,6,50,3,4,0,30,15,2,44,9,9,9,119,
+104,105,108,101,32,115,101,108,102,46,99,104,101,99,107,40,
+115,101,108,102,46,116,111,107,101,110,44,39,110,108,39,44,
+39,59,39,41,58,32,115,101,108,102,46,97,100,118,97,110,
+99,101,40,41,0,0,0,0,12,9,0,5,99,104,101,99,
+107,0,0,0,49,4,1,9,12,9,0,5,116,111,107,101,
+110,0,0,0,9,6,1,9,12,7,0,2,110,108,0,0,
+12,8,0,1,59,0,0,0,50,3,4,3,21,3,0,0,
+18,0,0,7,12,6,0,7,97,100,118,97,110,99,101,0,
+49,4,1,6,50,3,4,0,18,0,255,236,30,13,2,45,
+9,9,9,105,102,32,115,101,108,102,46,99,104,101,99,107,
+40,115,101,108,102,46,116,111,107,101,110,44,39,100,101,100,
+101,110,116,39,44,39,101,111,102,39,41,58,32,98,114,101,
+97,107,0,0,12,9,0,5,99,104,101,99,107,0,0,0,
+49,4,1,9,12,9,0,5,116,111,107,101,110,0,0,0,
+9,6,1,9,12,7,0,6,100,101,100,101,110,116,0,0,
+12,8,0,3,101,111,102,0,50,3,4,3,21,3,0,0,
+18,0,0,3,18,0,0,3,18,0,0,1,18,0,255,146,
+0,0,0,0,12,48,0,6,105,98,108,111,99,107,0,0,
+10,8,48,47,16,48,1,84,44,12,0,0,30,5,2,48,
 9,100,101,102,32,98,108,111,99,107,40,115,101,108,102,41,
 58,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
 121,0,0,0,33,1,0,0,12,1,0,5,98,108,111,99,
 107,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
-30,4,2,41,9,9,105,116,101,109,115,32,61,32,91,93,
-0,0,0,0,27,3,0,0,15,2,3,0,30,5,2,42,
+30,4,2,49,9,9,105,116,101,109,115,32,61,32,91,93,
+0,0,0,0,27,3,0,0,15,2,3,0,30,5,2,50,
 9,9,116,111,107,32,61,32,115,101,108,102,46,116,111,107,
 101,110,0,0,12,5,0,5,116,111,107,101,110,0,0,0,
-9,4,1,5,15,3,4,0,30,9,2,44,9,9,105,102,
+9,4,1,5,15,3,4,0,30,9,2,52,9,9,105,102,
 32,115,101,108,102,46,99,104,101,99,107,40,115,101,108,102,
 46,116,111,107,101,110,44,39,110,108,39,41,58,0,0,0,
-12,6,0,5,99,104,101,99,107,0,0,0,9,5,1,6,
-12,8,0,5,116,111,107,101,110,0,0,0,9,6,1,8,
-12,7,0,2,110,108,0,0,31,4,6,2,19,4,5,4,
-21,4,0,0,18,0,0,86,30,14,2,45,9,9,9,119,
-104,105,108,101,32,115,101,108,102,46,99,104,101,99,107,40,
-115,101,108,102,46,116,111,107,101,110,44,39,110,108,39,41,
-58,32,115,101,108,102,46,97,100,118,97,110,99,101,40,41,
-0,0,0,0,12,6,0,5,99,104,101,99,107,0,0,0,
-9,5,1,6,12,8,0,5,116,111,107,101,110,0,0,0,
-9,6,1,8,12,7,0,2,110,108,0,0,31,4,6,2,
-19,4,5,4,21,4,0,0,18,0,0,8,12,6,0,7,
-97,100,118,97,110,99,101,0,9,5,1,6,31,4,0,0,
-19,4,5,4,18,0,255,236,30,7,2,46,9,9,9,115,
-101,108,102,46,97,100,118,97,110,99,101,40,39,105,110,100,
-101,110,116,39,41,0,0,0,12,6,0,7,97,100,118,97,
-110,99,101,0,9,5,1,6,12,6,0,6,105,110,100,101,
-110,116,0,0,31,4,6,1,19,4,5,4,30,6,2,47,
+12,9,0,5,99,104,101,99,107,0,0,0,49,5,1,9,
+12,9,0,5,116,111,107,101,110,0,0,0,9,7,1,9,
+12,8,0,2,110,108,0,0,50,4,5,2,21,4,0,0,
+18,0,0,81,30,14,2,53,9,9,9,119,104,105,108,101,
+32,115,101,108,102,46,99,104,101,99,107,40,115,101,108,102,
+46,116,111,107,101,110,44,39,110,108,39,41,58,32,115,101,
+108,102,46,97,100,118,97,110,99,101,40,41,0,0,0,0,
+12,9,0,5,99,104,101,99,107,0,0,0,49,5,1,9,
+12,9,0,5,116,111,107,101,110,0,0,0,9,7,1,9,
+12,8,0,2,110,108,0,0,50,4,5,2,21,4,0,0,
+18,0,0,7,12,7,0,7,97,100,118,97,110,99,101,0,
+49,5,1,7,50,4,5,0,18,0,255,238,30,7,2,54,
+9,9,9,115,101,108,102,46,97,100,118,97,110,99,101,40,
+39,105,110,100,101,110,116,39,41,0,0,0,12,8,0,7,
+97,100,118,97,110,99,101,0,49,5,1,8,12,7,0,6,
+105,110,100,101,110,116,0,0,50,4,5,1,30,6,2,55,
 9,9,9,115,101,108,102,46,105,98,108,111,99,107,40,105,
-116,101,109,115,41,0,0,0,12,6,0,6,105,98,108,111,
-99,107,0,0,9,5,1,6,15,6,2,0,31,4,6,1,
-19,4,5,4,30,7,2,48,9,9,9,115,101,108,102,46,
-97,100,118,97,110,99,101,40,39,100,101,100,101,110,116,39,
-41,0,0,0,12,6,0,7,97,100,118,97,110,99,101,0,
-9,5,1,6,12,6,0,6,100,101,100,101,110,116,0,0,
-31,4,6,1,19,4,5,4,18,0,0,112,30,2,2,49,
-9,9,101,108,115,101,58,0,30,9,2,50,9,9,9,105,
-116,101,109,115,46,97,112,112,101,110,100,40,115,101,108,102,
-46,101,120,112,114,101,115,115,105,111,110,40,48,41,41,0,
-12,6,0,6,97,112,112,101,110,100,0,0,9,5,2,6,
-12,8,0,10,101,120,112,114,101,115,115,105,111,110,0,0,
-9,7,1,8,11,8,0,0,0,0,0,0,0,0,0,0,
-31,6,8,1,19,6,7,6,31,4,6,1,19,4,5,4,
-30,10,2,51,9,9,9,119,104,105,108,101,32,115,101,108,
+116,101,109,115,41,0,0,0,12,8,0,6,105,98,108,111,
+99,107,0,0,49,5,1,8,15,7,2,0,50,4,5,1,
+30,7,2,56,9,9,9,115,101,108,102,46,97,100,118,97,
+110,99,101,40,39,100,101,100,101,110,116,39,41,0,0,0,
+12,8,0,7,97,100,118,97,110,99,101,0,49,5,1,8,
+12,7,0,6,100,101,100,101,110,116,0,0,50,4,5,1,
+18,0,0,105,30,2,2,57,9,9,101,108,115,101,58,0,
+30,9,2,58,9,9,9,105,116,101,109,115,46,97,112,112,
+101,110,100,40,115,101,108,102,46,101,120,112,114,101,115,115,
+105,111,110,40,48,41,41,0,12,8,0,6,97,112,112,101,
+110,100,0,0,49,5,2,8,12,11,0,10,101,120,112,114,
+101,115,115,105,111,110,0,0,49,8,1,11,11,10,0,1,
+0,0,0,0,0,0,0,0,50,7,8,1,50,4,5,1,
+30,10,2,59,9,9,9,119,104,105,108,101,32,115,101,108,
 102,46,99,104,101,99,107,40,115,101,108,102,46,116,111,107,
-101,110,44,39,59,39,41,58,0,0,0,0,12,6,0,5,
-99,104,101,99,107,0,0,0,9,5,1,6,12,8,0,5,
-116,111,107,101,110,0,0,0,9,6,1,8,12,7,0,1,
-59,0,0,0,31,4,6,2,19,4,5,4,21,4,0,0,
-18,0,0,44,30,6,2,52,9,9,9,9,115,101,108,102,
-46,97,100,118,97,110,99,101,40,39,59,39,41,0,0,0,
-12,6,0,7,97,100,118,97,110,99,101,0,9,5,1,6,
-12,6,0,1,59,0,0,0,31,4,6,1,19,4,5,4,
-30,10,2,53,9,9,9,9,105,116,101,109,115,46,97,112,
-112,101,110,100,40,115,101,108,102,46,101,120,112,114,101,115,
-115,105,111,110,40,48,41,41,0,0,0,0,12,6,0,6,
-97,112,112,101,110,100,0,0,9,5,2,6,12,8,0,10,
-101,120,112,114,101,115,115,105,111,110,0,0,9,7,1,8,
-11,8,0,0,0,0,0,0,0,0,0,0,31,6,8,1,
-19,6,7,6,31,4,6,1,19,4,5,4,18,0,255,200,
-30,5,2,54,9,9,9,115,101,108,102,46,116,101,114,109,
-105,110,97,108,40,41,0,0,12,6,0,8,116,101,114,109,
-105,110,97,108,0,0,0,0,9,5,1,6,31,4,0,0,
-19,4,5,4,18,0,0,1,30,13,2,55,9,9,119,104,
-105,108,101,32,115,101,108,102,46,99,104,101,99,107,40,115,
-101,108,102,46,116,111,107,101,110,44,39,110,108,39,41,58,
-32,115,101,108,102,46,97,100,118,97,110,99,101,40,41,0,
-12,6,0,5,99,104,101,99,107,0,0,0,9,5,1,6,
-12,8,0,5,116,111,107,101,110,0,0,0,9,6,1,8,
-12,7,0,2,110,108,0,0,31,4,6,2,19,4,5,4,
-21,4,0,0,18,0,0,8,12,6,0,7,97,100,118,97,
-110,99,101,0,9,5,1,6,31,4,0,0,19,4,5,4,
-18,0,255,236,30,6,2,57,9,9,105,102,32,108,101,110,
-40,105,116,101,109,115,41,32,62,32,49,58,0,0,0,0,
-11,4,0,0,0,0,0,0,0,0,240,63,12,7,0,3,
-108,101,110,0,13,6,7,0,15,7,2,0,31,5,7,1,
-19,5,6,5,25,4,4,5,21,4,0,0,18,0,0,32,
-30,12,2,58,9,9,9,114,101,116,117,114,110,32,84,111,
-107,101,110,40,116,111,107,46,112,111,115,44,39,115,116,97,
-116,101,109,101,110,116,115,39,44,39,59,39,44,105,116,101,
-109,115,41,0,12,6,0,5,84,111,107,101,110,0,0,0,
-13,5,6,0,12,10,0,3,112,111,115,0,9,6,3,10,
-12,7,0,10,115,116,97,116,101,109,101,110,116,115,0,0,
-12,8,0,1,59,0,0,0,15,9,2,0,31,4,6,4,
-19,4,5,4,20,4,0,0,18,0,0,1,30,6,2,59,
-9,9,114,101,116,117,114,110,32,105,116,101,109,115,46,112,
-111,112,40,41,0,0,0,0,12,6,0,3,112,111,112,0,
-9,5,2,6,31,4,0,0,19,4,5,4,20,4,0,0,
-0,0,0,0,12,48,0,5,98,108,111,99,107,0,0,0,
-10,7,48,47,16,48,1,41,44,12,0,0,30,6,2,62,
+101,110,44,39,59,39,41,58,0,0,0,0,12,9,0,5,
+99,104,101,99,107,0,0,0,49,5,1,9,12,9,0,5,
+116,111,107,101,110,0,0,0,9,7,1,9,12,8,0,1,
+59,0,0,0,50,4,5,2,21,4,0,0,18,0,0,41,
+30,6,2,60,9,9,9,9,115,101,108,102,46,97,100,118,
+97,110,99,101,40,39,59,39,41,0,0,0,12,8,0,7,
+97,100,118,97,110,99,101,0,49,5,1,8,12,7,0,1,
+59,0,0,0,50,4,5,1,30,10,2,61,9,9,9,9,
+105,116,101,109,115,46,97,112,112,101,110,100,40,115,101,108,
+102,46,101,120,112,114,101,115,115,105,111,110,40,48,41,41,
+0,0,0,0,12,8,0,6,97,112,112,101,110,100,0,0,
+49,5,2,8,12,11,0,10,101,120,112,114,101,115,115,105,
+111,110,0,0,49,8,1,11,11,10,0,1,0,0,0,0,
+0,0,0,0,50,7,8,1,50,4,5,1,18,0,255,204,
+30,5,2,62,9,9,9,115,101,108,102,46,116,101,114,109,
+105,110,97,108,40,41,0,0,12,7,0,8,116,101,114,109,
+105,110,97,108,0,0,0,0,49,5,1,7,50,4,5,0,
+18,0,0,1,30,13,2,63,9,9,119,104,105,108,101,32,
+115,101,108,102,46,99,104,101,99,107,40,115,101,108,102,46,
+116,111,107,101,110,44,39,110,108,39,41,58,32,115,101,108,
+102,46,97,100,118,97,110,99,101,40,41,0,12,9,0,5,
+99,104,101,99,107,0,0,0,49,5,1,9,12,9,0,5,
+116,111,107,101,110,0,0,0,9,7,1,9,12,8,0,2,
+110,108,0,0,50,4,5,2,21,4,0,0,18,0,0,7,
+12,7,0,7,97,100,118,97,110,99,101,0,49,5,1,7,
+50,4,5,0,18,0,255,238,30,6,2,65,9,9,105,102,
+32,108,101,110,40,105,116,101,109,115,41,32,62,32,49,58,
+0,0,0,0,11,4,0,1,1,0,0,0,0,0,0,0,
+12,7,0,3,108,101,110,0,13,6,7,0,15,7,2,0,
+31,5,7,1,19,5,6,5,25,4,4,5,21,4,0,0,
+18,0,0,32,30,12,2,66,9,9,9,114,101,116,117,114,
+110,32,84,111,107,101,110,40,116,111,107,46,112,111,115,44,
+39,115,116,97,116,101,109,101,110,116,115,39,44,39,59,39,
+44,105,116,101,109,115,41,0,12,6,0,5,84,111,107,101,
+110,0,0,0,13,5,6,0,12,10,0,3,112,111,115,0,
+9,6,3,10,12,7,0,10,115,116,97,116,101,109,101,110,
+116,115,0,0,12,8,0,1,59,0,0,0,15,9,2,0,
+31,4,6,4,19,4,5,4,20,4,0,0,18,0,0,1,
+30,6,2,67,9,9,114,101,116,117,114,110,32,105,116,101,
+109,115,46,112,111,112,40,41,0,0,0,0,12,7,0,3,
+112,111,112,0,49,5,2,7,50,4,5,0,20,4,0,0,
+0,0,0,0,12,49,0,5,98,108,111,99,107,0,0,0,
+10,8,49,48,16,49,1,26,44,13,0,0,30,6,2,70,
 9,100,101,102,32,100,101,102,95,110,117,100,40,115,101,108,
 102,44,116,41,58,0,0,0,12,1,0,9,116,105,110,121,
 112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,7,
 100,101,102,95,110,117,100,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,30,6,2,63,
+9,1,0,2,28,3,0,0,9,2,0,3,30,6,2,71,
 9,9,105,116,101,109,115,32,61,32,116,46,105,116,101,109,
 115,32,61,32,91,93,0,0,27,4,0,0,12,5,0,5,
 105,116,101,109,115,0,0,0,10,2,5,4,15,3,4,0,
-30,11,2,64,9,9,105,116,101,109,115,46,97,112,112,101,
+30,11,2,72,9,9,105,116,101,109,115,46,97,112,112,101,
 110,100,40,115,101,108,102,46,116,111,107,101,110,41,59,32,
 115,101,108,102,46,97,100,118,97,110,99,101,40,41,0,0,
-12,6,0,6,97,112,112,101,110,100,0,0,9,5,3,6,
-12,7,0,5,116,111,107,101,110,0,0,0,9,6,1,7,
-31,4,6,1,19,4,5,4,12,6,0,7,97,100,118,97,
-110,99,101,0,9,5,1,6,31,4,0,0,19,4,5,4,
-30,5,2,65,9,9,115,101,108,102,46,97,100,118,97,110,
-99,101,40,39,40,39,41,0,12,6,0,7,97,100,118,97,
-110,99,101,0,9,5,1,6,12,6,0,1,40,0,0,0,
-31,4,6,1,19,4,5,4,30,10,2,66,9,9,114,32,
-61,32,84,111,107,101,110,40,116,46,112,111,115,44,39,115,
-121,109,98,111,108,39,44,39,40,41,58,39,44,91,93,41,
-0,0,0,0,12,7,0,5,84,111,107,101,110,0,0,0,
-13,6,7,0,12,11,0,3,112,111,115,0,9,7,2,11,
-12,8,0,6,115,121,109,98,111,108,0,0,12,9,0,3,
-40,41,58,0,27,10,0,0,31,5,7,4,19,5,6,5,
-15,4,5,0,30,5,2,67,9,9,105,116,101,109,115,46,
-97,112,112,101,110,100,40,114,41,0,0,0,12,7,0,6,
-97,112,112,101,110,100,0,0,9,6,3,7,15,7,4,0,
-31,5,7,1,19,5,6,5,30,10,2,68,9,9,119,104,
+12,8,0,6,97,112,112,101,110,100,0,0,49,5,3,8,
+12,8,0,5,116,111,107,101,110,0,0,0,9,7,1,8,
+50,4,5,1,12,7,0,7,97,100,118,97,110,99,101,0,
+49,5,1,7,50,4,5,0,30,5,2,73,9,9,115,101,
+108,102,46,97,100,118,97,110,99,101,40,39,40,39,41,0,
+12,8,0,7,97,100,118,97,110,99,101,0,49,5,1,8,
+12,7,0,1,40,0,0,0,50,4,5,1,30,10,2,74,
+9,9,114,32,61,32,84,111,107,101,110,40,116,46,112,111,
+115,44,39,115,121,109,98,111,108,39,44,39,40,41,58,39,
+44,91,93,41,0,0,0,0,12,7,0,5,84,111,107,101,
+110,0,0,0,13,6,7,0,12,11,0,3,112,111,115,0,
+9,7,2,11,12,8,0,6,115,121,109,98,111,108,0,0,
+12,9,0,3,40,41,58,0,27,10,0,0,31,5,7,4,
+19,5,6,5,15,4,5,0,30,5,2,75,9,9,105,116,
+101,109,115,46,97,112,112,101,110,100,40,114,41,0,0,0,
+12,9,0,6,97,112,112,101,110,100,0,0,49,6,3,9,
+15,8,4,0,50,5,6,1,30,10,2,76,9,9,119,104,
 105,108,101,32,110,111,116,32,115,101,108,102,46,99,104,101,
 99,107,40,115,101,108,102,46,116,111,107,101,110,44,39,41,
-39,41,58,0,12,8,0,5,99,104,101,99,107,0,0,0,
-9,7,1,8,12,10,0,5,116,111,107,101,110,0,0,0,
-9,8,1,10,12,9,0,1,41,0,0,0,31,6,8,2,
-19,6,7,6,47,5,6,0,21,5,0,0,18,0,0,100,
-30,6,2,69,9,9,9,115,101,108,102,46,116,119,101,97,
-107,40,39,44,39,44,48,41,0,0,0,0,12,7,0,5,
-116,119,101,97,107,0,0,0,9,6,1,7,12,7,0,1,
-44,0,0,0,11,8,0,0,0,0,0,0,0,0,0,0,
-31,5,7,2,19,5,6,5,30,10,2,70,9,9,9,114,
-46,105,116,101,109,115,46,97,112,112,101,110,100,40,115,101,
-108,102,46,101,120,112,114,101,115,115,105,111,110,40,48,41,
-41,0,0,0,12,7,0,5,105,116,101,109,115,0,0,0,
-9,6,4,7,12,7,0,6,97,112,112,101,110,100,0,0,
-9,6,6,7,12,9,0,10,101,120,112,114,101,115,115,105,
-111,110,0,0,9,8,1,9,11,9,0,0,0,0,0,0,
-0,0,0,0,31,7,9,1,19,7,8,7,31,5,7,1,
-19,5,6,5,30,13,2,71,9,9,9,105,102,32,115,101,
+39,41,58,0,12,11,0,5,99,104,101,99,107,0,0,0,
+49,7,1,11,12,11,0,5,116,111,107,101,110,0,0,0,
+9,9,1,11,12,10,0,1,41,0,0,0,50,6,7,2,
+47,5,6,0,21,5,0,0,18,0,0,94,30,6,2,77,
+9,9,9,115,101,108,102,46,116,119,101,97,107,40,39,44,
+39,44,48,41,0,0,0,0,12,10,0,5,116,119,101,97,
+107,0,0,0,49,6,1,10,12,8,0,1,44,0,0,0,
+11,9,0,1,0,0,0,0,0,0,0,0,50,5,6,2,
+30,10,2,78,9,9,9,114,46,105,116,101,109,115,46,97,
+112,112,101,110,100,40,115,101,108,102,46,101,120,112,114,101,
+115,115,105,111,110,40,48,41,41,0,0,0,12,10,0,5,
+105,116,101,109,115,0,0,0,9,9,4,10,12,10,0,6,
+97,112,112,101,110,100,0,0,49,6,9,10,12,12,0,10,
+101,120,112,114,101,115,115,105,111,110,0,0,49,9,1,12,
+11,11,0,1,0,0,0,0,0,0,0,0,50,8,9,1,
+50,5,6,1,30,13,2,79,9,9,9,105,102,32,115,101,
 108,102,46,99,104,101,99,107,40,115,101,108,102,46,116,111,
 107,101,110,44,39,44,39,41,58,32,115,101,108,102,46,97,
-100,118,97,110,99,101,40,39,44,39,41,0,12,7,0,5,
-99,104,101,99,107,0,0,0,9,6,1,7,12,9,0,5,
-116,111,107,101,110,0,0,0,9,7,1,9,12,8,0,1,
-44,0,0,0,31,5,7,2,19,5,6,5,21,5,0,0,
-18,0,0,10,12,7,0,7,97,100,118,97,110,99,101,0,
-9,6,1,7,12,7,0,1,44,0,0,0,31,5,7,1,
-19,5,6,5,18,0,0,1,30,5,2,72,9,9,9,115,
-101,108,102,46,114,101,115,116,111,114,101,40,41,0,0,0,
-12,7,0,7,114,101,115,116,111,114,101,0,9,6,1,7,
-31,5,0,0,19,5,6,5,18,0,255,143,30,5,2,73,
-9,9,115,101,108,102,46,97,100,118,97,110,99,101,40,39,
-41,39,41,0,12,7,0,7,97,100,118,97,110,99,101,0,
-9,6,1,7,12,7,0,1,41,0,0,0,31,5,7,1,
-19,5,6,5,30,5,2,74,9,9,115,101,108,102,46,97,
-100,118,97,110,99,101,40,39,58,39,41,0,12,7,0,7,
-97,100,118,97,110,99,101,0,9,6,1,7,12,7,0,1,
-58,0,0,0,31,5,7,1,19,5,6,5,30,8,2,75,
+100,118,97,110,99,101,40,39,44,39,41,0,12,10,0,5,
+99,104,101,99,107,0,0,0,49,6,1,10,12,10,0,5,
+116,111,107,101,110,0,0,0,9,8,1,10,12,9,0,1,
+44,0,0,0,50,5,6,2,21,5,0,0,18,0,0,9,
+12,9,0,7,97,100,118,97,110,99,101,0,49,6,1,9,
+12,8,0,1,44,0,0,0,50,5,6,1,18,0,0,1,
+30,5,2,80,9,9,9,115,101,108,102,46,114,101,115,116,
+111,114,101,40,41,0,0,0,12,8,0,7,114,101,115,116,
+111,114,101,0,49,6,1,8,50,5,6,0,18,0,255,150,
+30,5,2,81,9,9,115,101,108,102,46,97,100,118,97,110,
+99,101,40,39,41,39,41,0,12,9,0,7,97,100,118,97,
+110,99,101,0,49,6,1,9,12,8,0,1,41,0,0,0,
+50,5,6,1,30,5,2,82,9,9,115,101,108,102,46,97,
+100,118,97,110,99,101,40,39,58,39,41,0,12,9,0,7,
+97,100,118,97,110,99,101,0,49,6,1,9,12,8,0,1,
+58,0,0,0,50,5,6,1,30,8,2,83,9,9,105,116,
+101,109,115,46,97,112,112,101,110,100,40,115,101,108,102,46,
+98,108,111,99,107,40,41,41,0,0,0,0,12,9,0,6,
+97,112,112,101,110,100,0,0,49,6,3,9,12,11,0,5,
+98,108,111,99,107,0,0,0,49,9,1,11,50,8,9,0,
+50,5,6,1,30,3,2,84,9,9,114,101,116,117,114,110,
+32,116,0,0,20,2,0,0,0,0,0,0,12,50,0,7,
+100,101,102,95,110,117,100,0,10,8,50,49,16,50,0,98,
+44,12,0,0,30,6,2,87,9,100,101,102,32,119,104,105,
+108,101,95,110,117,100,40,115,101,108,102,44,116,41,58,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,9,119,104,105,108,101,95,110,117,
+100,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
+28,3,0,0,9,2,0,3,30,6,2,88,9,9,105,116,
+101,109,115,32,61,32,116,46,105,116,101,109,115,32,61,32,
+91,93,0,0,27,4,0,0,12,5,0,5,105,116,101,109,
+115,0,0,0,10,2,5,4,15,3,4,0,30,9,2,89,
 9,9,105,116,101,109,115,46,97,112,112,101,110,100,40,115,
-101,108,102,46,98,108,111,99,107,40,41,41,0,0,0,0,
-12,7,0,6,97,112,112,101,110,100,0,0,9,6,3,7,
-12,9,0,5,98,108,111,99,107,0,0,0,9,8,1,9,
-31,7,0,0,19,7,8,7,31,5,7,1,19,5,6,5,
-30,3,2,76,9,9,114,101,116,117,114,110,32,116,0,0,
-20,2,0,0,0,0,0,0,12,49,0,7,100,101,102,95,
-110,117,100,0,10,7,49,48,16,49,0,103,44,9,0,0,
-30,6,2,79,9,100,101,102,32,119,104,105,108,101,95,110,
+101,108,102,46,101,120,112,114,101,115,115,105,111,110,40,48,
+41,41,0,0,12,8,0,6,97,112,112,101,110,100,0,0,
+49,5,3,8,12,11,0,10,101,120,112,114,101,115,115,105,
+111,110,0,0,49,8,1,11,11,10,0,1,0,0,0,0,
+0,0,0,0,50,7,8,1,50,4,5,1,30,5,2,90,
+9,9,115,101,108,102,46,97,100,118,97,110,99,101,40,39,
+58,39,41,0,12,8,0,7,97,100,118,97,110,99,101,0,
+49,5,1,8,12,7,0,1,58,0,0,0,50,4,5,1,
+30,8,2,91,9,9,105,116,101,109,115,46,97,112,112,101,
+110,100,40,115,101,108,102,46,98,108,111,99,107,40,41,41,
+0,0,0,0,12,8,0,6,97,112,112,101,110,100,0,0,
+49,5,3,8,12,10,0,5,98,108,111,99,107,0,0,0,
+49,8,1,10,50,7,8,0,50,4,5,1,30,3,2,92,
+9,9,114,101,116,117,114,110,32,116,0,0,20,2,0,0,
+0,0,0,0,12,51,0,9,119,104,105,108,101,95,110,117,
+100,0,0,0,10,8,51,50,16,51,0,111,44,15,0,0,
+30,6,2,95,9,100,101,102,32,99,108,97,115,115,95,110,
 117,100,40,115,101,108,102,44,116,41,58,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,9,119,104,105,108,101,95,110,117,100,0,0,0,
+12,1,0,9,99,108,97,115,115,95,110,117,100,0,0,0,
 34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,30,6,2,80,9,9,105,116,101,109,115,32,
+9,2,0,3,30,6,2,96,9,9,105,116,101,109,115,32,
 61,32,116,46,105,116,101,109,115,32,61,32,91,93,0,0,
 27,4,0,0,12,5,0,5,105,116,101,109,115,0,0,0,
-10,2,5,4,15,3,4,0,30,9,2,81,9,9,105,116,
+10,2,5,4,15,3,4,0,30,9,2,97,9,9,105,116,
 101,109,115,46,97,112,112,101,110,100,40,115,101,108,102,46,
 101,120,112,114,101,115,115,105,111,110,40,48,41,41,0,0,
-12,6,0,6,97,112,112,101,110,100,0,0,9,5,3,6,
-12,8,0,10,101,120,112,114,101,115,115,105,111,110,0,0,
-9,7,1,8,11,8,0,0,0,0,0,0,0,0,0,0,
-31,6,8,1,19,6,7,6,31,4,6,1,19,4,5,4,
-30,5,2,82,9,9,115,101,108,102,46,97,100,118,97,110,
-99,101,40,39,58,39,41,0,12,6,0,7,97,100,118,97,
-110,99,101,0,9,5,1,6,12,6,0,1,58,0,0,0,
-31,4,6,1,19,4,5,4,30,8,2,83,9,9,105,116,
-101,109,115,46,97,112,112,101,110,100,40,115,101,108,102,46,
-98,108,111,99,107,40,41,41,0,0,0,0,12,6,0,6,
-97,112,112,101,110,100,0,0,9,5,3,6,12,8,0,5,
-98,108,111,99,107,0,0,0,9,7,1,8,31,6,0,0,
-19,6,7,6,31,4,6,1,19,4,5,4,30,3,2,84,
+12,8,0,6,97,112,112,101,110,100,0,0,49,5,3,8,
+12,11,0,10,101,120,112,114,101,115,115,105,111,110,0,0,
+49,8,1,11,11,10,0,1,0,0,0,0,0,0,0,0,
+50,7,8,1,50,4,5,1,30,5,2,98,9,9,115,101,
+108,102,46,97,100,118,97,110,99,101,40,39,58,39,41,0,
+12,8,0,7,97,100,118,97,110,99,101,0,49,5,1,8,
+12,7,0,1,58,0,0,0,50,4,5,1,30,13,2,99,
+9,9,105,116,101,109,115,46,97,112,112,101,110,100,40,115,
+101,108,102,46,105,108,115,116,40,39,109,101,116,104,111,100,
+115,39,44,115,101,108,102,46,98,108,111,99,107,40,41,41,
+41,0,0,0,12,8,0,6,97,112,112,101,110,100,0,0,
+49,5,3,8,12,12,0,4,105,108,115,116,0,0,0,0,
+49,8,1,12,12,10,0,7,109,101,116,104,111,100,115,0,
+12,14,0,5,98,108,111,99,107,0,0,0,49,12,1,14,
+50,11,12,0,50,7,8,2,50,4,5,1,30,3,2,100,
 9,9,114,101,116,117,114,110,32,116,0,0,20,2,0,0,
-0,0,0,0,12,50,0,9,119,104,105,108,101,95,110,117,
-100,0,0,0,10,7,50,49,16,50,0,117,44,12,0,0,
-30,6,2,87,9,100,101,102,32,99,108,97,115,115,95,110,
-117,100,40,115,101,108,102,44,116,41,58,0,12,1,0,9,
+0,0,0,0,12,52,0,9,99,108,97,115,115,95,110,117,
+100,0,0,0,10,8,52,51,16,52,0,106,44,12,0,0,
+30,6,2,103,9,100,101,102,32,102,114,111,109,95,110,117,
+100,40,115,101,108,102,44,116,41,58,0,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,9,99,108,97,115,115,95,110,117,100,0,0,0,
+12,1,0,8,102,114,111,109,95,110,117,100,0,0,0,0,
 34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,30,6,2,88,9,9,105,116,101,109,115,32,
+9,2,0,3,30,6,2,104,9,9,105,116,101,109,115,32,
 61,32,116,46,105,116,101,109,115,32,61,32,91,93,0,0,
 27,4,0,0,12,5,0,5,105,116,101,109,115,0,0,0,
-10,2,5,4,15,3,4,0,30,9,2,89,9,9,105,116,
+10,2,5,4,15,3,4,0,30,9,2,105,9,9,105,116,
 101,109,115,46,97,112,112,101,110,100,40,115,101,108,102,46,
 101,120,112,114,101,115,115,105,111,110,40,48,41,41,0,0,
-12,6,0,6,97,112,112,101,110,100,0,0,9,5,3,6,
-12,8,0,10,101,120,112,114,101,115,115,105,111,110,0,0,
-9,7,1,8,11,8,0,0,0,0,0,0,0,0,0,0,
-31,6,8,1,19,6,7,6,31,4,6,1,19,4,5,4,
-30,5,2,90,9,9,115,101,108,102,46,97,100,118,97,110,
-99,101,40,39,58,39,41,0,12,6,0,7,97,100,118,97,
-110,99,101,0,9,5,1,6,12,6,0,1,58,0,0,0,
-31,4,6,1,19,4,5,4,30,13,2,91,9,9,105,116,
+12,8,0,6,97,112,112,101,110,100,0,0,49,5,3,8,
+12,11,0,10,101,120,112,114,101,115,115,105,111,110,0,0,
+49,8,1,11,11,10,0,1,0,0,0,0,0,0,0,0,
+50,7,8,1,50,4,5,1,30,7,2,106,9,9,115,101,
+108,102,46,97,100,118,97,110,99,101,40,39,105,109,112,111,
+114,116,39,41,0,0,0,0,12,8,0,7,97,100,118,97,
+110,99,101,0,49,5,1,8,12,7,0,6,105,109,112,111,
+114,116,0,0,50,4,5,1,30,9,2,107,9,9,105,116,
 101,109,115,46,97,112,112,101,110,100,40,115,101,108,102,46,
-105,108,115,116,40,39,109,101,116,104,111,100,115,39,44,115,
-101,108,102,46,98,108,111,99,107,40,41,41,41,0,0,0,
-12,6,0,6,97,112,112,101,110,100,0,0,9,5,3,6,
-12,8,0,4,105,108,115,116,0,0,0,0,9,7,1,8,
-12,8,0,7,109,101,116,104,111,100,115,0,12,11,0,5,
-98,108,111,99,107,0,0,0,9,10,1,11,31,9,0,0,
-19,9,10,9,31,6,8,2,19,6,7,6,31,4,6,1,
-19,4,5,4,30,3,2,92,9,9,114,101,116,117,114,110,
-32,116,0,0,20,2,0,0,0,0,0,0,12,51,0,9,
-99,108,97,115,115,95,110,117,100,0,0,0,10,7,51,50,
-16,51,0,111,44,9,0,0,30,6,2,95,9,100,101,102,
-32,102,114,111,109,95,110,117,100,40,115,101,108,102,44,116,
-41,58,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,8,102,114,111,109,
-95,110,117,100,0,0,0,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,30,6,2,96,
+101,120,112,114,101,115,115,105,111,110,40,48,41,41,0,0,
+12,8,0,6,97,112,112,101,110,100,0,0,49,5,3,8,
+12,11,0,10,101,120,112,114,101,115,115,105,111,110,0,0,
+49,8,1,11,11,10,0,1,0,0,0,0,0,0,0,0,
+50,7,8,1,50,4,5,1,30,3,2,108,9,9,114,101,
+116,117,114,110,32,116,0,0,20,2,0,0,0,0,0,0,
+12,53,0,8,102,114,111,109,95,110,117,100,0,0,0,0,
+10,8,53,52,16,53,0,163,44,12,0,0,30,6,2,111,
+9,100,101,102,32,102,111,114,95,110,117,100,40,115,101,108,
+102,44,116,41,58,0,0,0,12,1,0,9,116,105,110,121,
+112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,7,
+102,111,114,95,110,117,100,0,34,1,0,0,28,2,0,0,
+9,1,0,2,28,3,0,0,9,2,0,3,30,6,2,112,
 9,9,105,116,101,109,115,32,61,32,116,46,105,116,101,109,
 115,32,61,32,91,93,0,0,27,4,0,0,12,5,0,5,
 105,116,101,109,115,0,0,0,10,2,5,4,15,3,4,0,
-30,9,2,97,9,9,105,116,101,109,115,46,97,112,112,101,
-110,100,40,115,101,108,102,46,101,120,112,114,101,115,115,105,
-111,110,40,48,41,41,0,0,12,6,0,6,97,112,112,101,
-110,100,0,0,9,5,3,6,12,8,0,10,101,120,112,114,
-101,115,115,105,111,110,0,0,9,7,1,8,11,8,0,0,
-0,0,0,0,0,0,0,0,31,6,8,1,19,6,7,6,
-31,4,6,1,19,4,5,4,30,7,2,98,9,9,115,101,
-108,102,46,97,100,118,97,110,99,101,40,39,105,109,112,111,
-114,116,39,41,0,0,0,0,12,6,0,7,97,100,118,97,
-110,99,101,0,9,5,1,6,12,6,0,6,105,109,112,111,
-114,116,0,0,31,4,6,1,19,4,5,4,30,9,2,99,
+30,6,2,113,9,9,115,101,108,102,46,116,119,101,97,107,
+40,39,105,110,39,44,48,41,0,0,0,0,12,9,0,5,
+116,119,101,97,107,0,0,0,49,5,1,9,12,7,0,2,
+105,110,0,0,11,8,0,1,0,0,0,0,0,0,0,0,
+50,4,5,2,30,9,2,114,9,9,105,116,101,109,115,46,
+97,112,112,101,110,100,40,115,101,108,102,46,101,120,112,114,
+101,115,115,105,111,110,40,48,41,41,0,0,12,8,0,6,
+97,112,112,101,110,100,0,0,49,5,3,8,12,11,0,10,
+101,120,112,114,101,115,115,105,111,110,0,0,49,8,1,11,
+11,10,0,1,0,0,0,0,0,0,0,0,50,7,8,1,
+50,4,5,1,30,6,2,115,9,9,115,101,108,102,46,97,
+100,118,97,110,99,101,40,39,105,110,39,41,0,0,0,0,
+12,8,0,7,97,100,118,97,110,99,101,0,49,5,1,8,
+12,7,0,2,105,110,0,0,50,4,5,1,30,9,2,116,
 9,9,105,116,101,109,115,46,97,112,112,101,110,100,40,115,
 101,108,102,46,101,120,112,114,101,115,115,105,111,110,40,48,
-41,41,0,0,12,6,0,6,97,112,112,101,110,100,0,0,
-9,5,3,6,12,8,0,10,101,120,112,114,101,115,115,105,
-111,110,0,0,9,7,1,8,11,8,0,0,0,0,0,0,
-0,0,0,0,31,6,8,1,19,6,7,6,31,4,6,1,
-19,4,5,4,30,3,2,100,9,9,114,101,116,117,114,110,
-32,116,0,0,20,2,0,0,0,0,0,0,12,52,0,8,
-102,114,111,109,95,110,117,100,0,0,0,0,10,7,52,51,
-16,52,0,173,44,9,0,0,30,6,2,103,9,100,101,102,
-32,102,111,114,95,110,117,100,40,115,101,108,102,44,116,41,
-58,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,7,102,111,114,95,
-110,117,100,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,3,0,0,9,2,0,3,30,6,2,104,9,9,105,116,
+41,41,0,0,12,8,0,6,97,112,112,101,110,100,0,0,
+49,5,3,8,12,11,0,10,101,120,112,114,101,115,115,105,
+111,110,0,0,49,8,1,11,11,10,0,1,0,0,0,0,
+0,0,0,0,50,7,8,1,50,4,5,1,30,5,2,117,
+9,9,115,101,108,102,46,114,101,115,116,111,114,101,40,41,
+0,0,0,0,12,7,0,7,114,101,115,116,111,114,101,0,
+49,5,1,7,50,4,5,0,30,5,2,118,9,9,115,101,
+108,102,46,97,100,118,97,110,99,101,40,39,58,39,41,0,
+12,8,0,7,97,100,118,97,110,99,101,0,49,5,1,8,
+12,7,0,1,58,0,0,0,50,4,5,1,30,8,2,119,
+9,9,105,116,101,109,115,46,97,112,112,101,110,100,40,115,
+101,108,102,46,98,108,111,99,107,40,41,41,0,0,0,0,
+12,8,0,6,97,112,112,101,110,100,0,0,49,5,3,8,
+12,10,0,5,98,108,111,99,107,0,0,0,49,8,1,10,
+50,7,8,0,50,4,5,1,30,3,2,120,9,9,114,101,
+116,117,114,110,32,116,0,0,20,2,0,0,0,0,0,0,
+12,54,0,7,102,111,114,95,110,117,100,0,10,8,54,53,
+16,54,1,111,44,18,0,0,30,6,2,123,9,100,101,102,
+32,105,102,95,110,117,100,40,115,101,108,102,44,116,41,58,
+0,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
+121,0,0,0,33,1,0,0,12,1,0,6,105,102,95,110,
+117,100,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
+28,3,0,0,9,2,0,3,30,6,2,124,9,9,105,116,
 101,109,115,32,61,32,116,46,105,116,101,109,115,32,61,32,
 91,93,0,0,27,4,0,0,12,5,0,5,105,116,101,109,
-115,0,0,0,10,2,5,4,15,3,4,0,30,6,2,105,
-9,9,115,101,108,102,46,116,119,101,97,107,40,39,105,110,
-39,44,48,41,0,0,0,0,12,6,0,5,116,119,101,97,
-107,0,0,0,9,5,1,6,12,6,0,2,105,110,0,0,
-11,7,0,0,0,0,0,0,0,0,0,0,31,4,6,2,
-19,4,5,4,30,9,2,106,9,9,105,116,101,109,115,46,
-97,112,112,101,110,100,40,115,101,108,102,46,101,120,112,114,
-101,115,115,105,111,110,40,48,41,41,0,0,12,6,0,6,
-97,112,112,101,110,100,0,0,9,5,3,6,12,8,0,10,
-101,120,112,114,101,115,115,105,111,110,0,0,9,7,1,8,
-11,8,0,0,0,0,0,0,0,0,0,0,31,6,8,1,
-19,6,7,6,31,4,6,1,19,4,5,4,30,6,2,107,
-9,9,115,101,108,102,46,97,100,118,97,110,99,101,40,39,
-105,110,39,41,0,0,0,0,12,6,0,7,97,100,118,97,
-110,99,101,0,9,5,1,6,12,6,0,2,105,110,0,0,
-31,4,6,1,19,4,5,4,30,9,2,108,9,9,105,116,
-101,109,115,46,97,112,112,101,110,100,40,115,101,108,102,46,
-101,120,112,114,101,115,115,105,111,110,40,48,41,41,0,0,
-12,6,0,6,97,112,112,101,110,100,0,0,9,5,3,6,
-12,8,0,10,101,120,112,114,101,115,115,105,111,110,0,0,
-9,7,1,8,11,8,0,0,0,0,0,0,0,0,0,0,
-31,6,8,1,19,6,7,6,31,4,6,1,19,4,5,4,
-30,5,2,109,9,9,115,101,108,102,46,114,101,115,116,111,
-114,101,40,41,0,0,0,0,12,6,0,7,114,101,115,116,
-111,114,101,0,9,5,1,6,31,4,0,0,19,4,5,4,
-30,5,2,110,9,9,115,101,108,102,46,97,100,118,97,110,
-99,101,40,39,58,39,41,0,12,6,0,7,97,100,118,97,
-110,99,101,0,9,5,1,6,12,6,0,1,58,0,0,0,
-31,4,6,1,19,4,5,4,30,8,2,111,9,9,105,116,
-101,109,115,46,97,112,112,101,110,100,40,115,101,108,102,46,
-98,108,111,99,107,40,41,41,0,0,0,0,12,6,0,6,
-97,112,112,101,110,100,0,0,9,5,3,6,12,8,0,5,
-98,108,111,99,107,0,0,0,9,7,1,8,31,6,0,0,
-19,6,7,6,31,4,6,1,19,4,5,4,30,3,2,112,
-9,9,114,101,116,117,114,110,32,116,0,0,20,2,0,0,
-0,0,0,0,12,53,0,7,102,111,114,95,110,117,100,0,
-10,7,53,52,16,53,1,126,44,17,0,0,30,6,2,115,
-9,100,101,102,32,105,102,95,110,117,100,40,115,101,108,102,
-44,116,41,58,0,0,0,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,6,
-105,102,95,110,117,100,0,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,30,6,2,116,
-9,9,105,116,101,109,115,32,61,32,116,46,105,116,101,109,
-115,32,61,32,91,93,0,0,27,4,0,0,12,5,0,5,
-105,116,101,109,115,0,0,0,10,2,5,4,15,3,4,0,
-30,7,2,117,9,9,97,32,61,32,115,101,108,102,46,101,
-120,112,114,101,115,115,105,111,110,40,48,41,0,0,0,0,
-12,7,0,10,101,120,112,114,101,115,115,105,111,110,0,0,
-9,6,1,7,11,7,0,0,0,0,0,0,0,0,0,0,
-31,5,7,1,19,5,6,5,15,4,5,0,30,5,2,118,
-9,9,115,101,108,102,46,97,100,118,97,110,99,101,40,39,
-58,39,41,0,12,7,0,7,97,100,118,97,110,99,101,0,
-9,6,1,7,12,7,0,1,58,0,0,0,31,5,7,1,
-19,5,6,5,30,5,2,119,9,9,98,32,61,32,115,101,
-108,102,46,98,108,111,99,107,40,41,0,0,12,8,0,5,
-98,108,111,99,107,0,0,0,9,7,1,8,31,6,0,0,
-19,6,7,6,15,5,6,0,30,13,2,120,9,9,105,116,
+115,0,0,0,10,2,5,4,15,3,4,0,30,7,2,125,
+9,9,97,32,61,32,115,101,108,102,46,101,120,112,114,101,
+115,115,105,111,110,40,48,41,0,0,0,0,12,9,0,10,
+101,120,112,114,101,115,115,105,111,110,0,0,49,6,1,9,
+11,8,0,1,0,0,0,0,0,0,0,0,50,5,6,1,
+15,4,5,0,30,5,2,126,9,9,115,101,108,102,46,97,
+100,118,97,110,99,101,40,39,58,39,41,0,12,9,0,7,
+97,100,118,97,110,99,101,0,49,6,1,9,12,8,0,1,
+58,0,0,0,50,5,6,1,30,5,2,127,9,9,98,32,
+61,32,115,101,108,102,46,98,108,111,99,107,40,41,0,0,
+12,9,0,5,98,108,111,99,107,0,0,0,49,7,1,9,
+50,6,7,0,15,5,6,0,30,13,2,128,9,9,105,116,
 101,109,115,46,97,112,112,101,110,100,40,84,111,107,101,110,
 40,116,46,112,111,115,44,39,101,108,105,102,39,44,39,101,
 108,105,102,39,44,91,97,44,98,93,41,41,0,0,0,0,
-12,8,0,6,97,112,112,101,110,100,0,0,9,7,3,8,
-12,10,0,5,84,111,107,101,110,0,0,0,13,9,10,0,
-12,14,0,3,112,111,115,0,9,10,2,14,12,11,0,4,
-101,108,105,102,0,0,0,0,12,12,0,4,101,108,105,102,
-0,0,0,0,15,14,4,0,15,15,5,0,27,13,14,2,
-31,8,10,4,19,8,9,8,31,6,8,1,19,6,7,6,
-30,10,2,121,9,9,119,104,105,108,101,32,115,101,108,102,
-46,99,104,101,99,107,40,115,101,108,102,46,116,111,107,101,
-110,44,39,101,108,105,102,39,41,58,0,0,12,8,0,5,
-99,104,101,99,107,0,0,0,9,7,1,8,12,10,0,5,
-116,111,107,101,110,0,0,0,9,8,1,10,12,9,0,4,
-101,108,105,102,0,0,0,0,31,6,8,2,19,6,7,6,
-21,6,0,0,18,0,0,114,30,5,2,122,9,9,9,116,
-111,107,32,61,32,115,101,108,102,46,116,111,107,101,110,0,
-12,8,0,5,116,111,107,101,110,0,0,0,9,7,1,8,
-15,6,7,0,30,6,2,123,9,9,9,115,101,108,102,46,
-97,100,118,97,110,99,101,40,39,101,108,105,102,39,41,0,
-12,9,0,7,97,100,118,97,110,99,101,0,9,8,1,9,
-12,9,0,4,101,108,105,102,0,0,0,0,31,7,9,1,
-19,7,8,7,30,7,2,124,9,9,9,97,32,61,32,115,
-101,108,102,46,101,120,112,114,101,115,115,105,111,110,40,48,
-41,0,0,0,12,9,0,10,101,120,112,114,101,115,115,105,
-111,110,0,0,9,8,1,9,11,9,0,0,0,0,0,0,
-0,0,0,0,31,7,9,1,19,7,8,7,15,4,7,0,
-30,6,2,125,9,9,9,115,101,108,102,46,97,100,118,97,
-110,99,101,40,39,58,39,41,0,0,0,0,12,9,0,7,
-97,100,118,97,110,99,101,0,9,8,1,9,12,9,0,1,
-58,0,0,0,31,7,9,1,19,7,8,7,30,5,2,126,
-9,9,9,98,32,61,32,115,101,108,102,46,98,108,111,99,
-107,40,41,0,12,9,0,5,98,108,111,99,107,0,0,0,
-9,8,1,9,31,7,0,0,19,7,8,7,15,5,7,0,
-30,13,2,127,9,9,9,105,116,101,109,115,46,97,112,112,
-101,110,100,40,84,111,107,101,110,40,116,111,107,46,112,111,
-115,44,39,101,108,105,102,39,44,39,101,108,105,102,39,44,
-91,97,44,98,93,41,41,0,12,9,0,6,97,112,112,101,
-110,100,0,0,9,8,3,9,12,11,0,5,84,111,107,101,
-110,0,0,0,13,10,11,0,12,15,0,3,112,111,115,0,
-9,11,6,15,12,12,0,4,101,108,105,102,0,0,0,0,
-12,13,0,4,101,108,105,102,0,0,0,0,15,15,4,0,
-15,16,5,0,27,14,15,2,31,9,11,4,19,9,10,9,
-31,7,9,1,19,7,8,7,18,0,255,129,30,9,2,128,
-9,9,105,102,32,115,101,108,102,46,99,104,101,99,107,40,
-115,101,108,102,46,116,111,107,101,110,44,39,101,108,115,101,
-39,41,58,0,12,9,0,5,99,104,101,99,107,0,0,0,
-9,8,1,9,12,11,0,5,116,111,107,101,110,0,0,0,
-9,9,1,11,12,10,0,4,101,108,115,101,0,0,0,0,
-31,7,9,2,19,7,8,7,21,7,0,0,18,0,0,94,
-30,5,2,129,9,9,9,116,111,107,32,61,32,115,101,108,
+12,10,0,6,97,112,112,101,110,100,0,0,49,7,3,10,
+12,11,0,5,84,111,107,101,110,0,0,0,13,10,11,0,
+12,15,0,3,112,111,115,0,9,11,2,15,12,12,0,4,
+101,108,105,102,0,0,0,0,12,13,0,4,101,108,105,102,
+0,0,0,0,15,15,4,0,15,16,5,0,27,14,15,2,
+31,9,11,4,19,9,10,9,50,6,7,1,30,10,2,129,
+9,9,119,104,105,108,101,32,115,101,108,102,46,99,104,101,
+99,107,40,115,101,108,102,46,116,111,107,101,110,44,39,101,
+108,105,102,39,41,58,0,0,12,11,0,5,99,104,101,99,
+107,0,0,0,49,7,1,11,12,11,0,5,116,111,107,101,
+110,0,0,0,9,9,1,11,12,10,0,4,101,108,105,102,
+0,0,0,0,50,6,7,2,21,6,0,0,18,0,0,109,
+30,5,2,130,9,9,9,116,111,107,32,61,32,115,101,108,
 102,46,116,111,107,101,110,0,12,8,0,5,116,111,107,101,
-110,0,0,0,9,7,1,8,15,6,7,0,30,6,2,130,
+110,0,0,0,9,7,1,8,15,6,7,0,30,6,2,131,
 9,9,9,115,101,108,102,46,97,100,118,97,110,99,101,40,
-39,101,108,115,101,39,41,0,12,9,0,7,97,100,118,97,
-110,99,101,0,9,8,1,9,12,9,0,4,101,108,115,101,
-0,0,0,0,31,7,9,1,19,7,8,7,30,6,2,131,
-9,9,9,115,101,108,102,46,97,100,118,97,110,99,101,40,
-39,58,39,41,0,0,0,0,12,9,0,7,97,100,118,97,
-110,99,101,0,9,8,1,9,12,9,0,1,58,0,0,0,
-31,7,9,1,19,7,8,7,30,5,2,132,9,9,9,98,
+39,101,108,105,102,39,41,0,12,11,0,7,97,100,118,97,
+110,99,101,0,49,8,1,11,12,10,0,4,101,108,105,102,
+0,0,0,0,50,7,8,1,30,7,2,132,9,9,9,97,
+32,61,32,115,101,108,102,46,101,120,112,114,101,115,115,105,
+111,110,40,48,41,0,0,0,12,11,0,10,101,120,112,114,
+101,115,115,105,111,110,0,0,49,8,1,11,11,10,0,1,
+0,0,0,0,0,0,0,0,50,7,8,1,15,4,7,0,
+30,6,2,133,9,9,9,115,101,108,102,46,97,100,118,97,
+110,99,101,40,39,58,39,41,0,0,0,0,12,11,0,7,
+97,100,118,97,110,99,101,0,49,8,1,11,12,10,0,1,
+58,0,0,0,50,7,8,1,30,5,2,134,9,9,9,98,
 32,61,32,115,101,108,102,46,98,108,111,99,107,40,41,0,
-12,9,0,5,98,108,111,99,107,0,0,0,9,8,1,9,
-31,7,0,0,19,7,8,7,15,5,7,0,30,13,2,133,
-9,9,9,105,116,101,109,115,46,97,112,112,101,110,100,40,
-84,111,107,101,110,40,116,111,107,46,112,111,115,44,39,101,
-108,115,101,39,44,39,101,108,115,101,39,44,91,98,93,41,
-41,0,0,0,12,9,0,6,97,112,112,101,110,100,0,0,
-9,8,3,9,12,11,0,5,84,111,107,101,110,0,0,0,
-13,10,11,0,12,15,0,3,112,111,115,0,9,11,6,15,
-12,12,0,4,101,108,115,101,0,0,0,0,12,13,0,4,
-101,108,115,101,0,0,0,0,15,15,5,0,27,14,15,1,
-31,9,11,4,19,9,10,9,31,7,9,1,19,7,8,7,
-18,0,0,1,30,3,2,134,9,9,114,101,116,117,114,110,
-32,116,0,0,20,2,0,0,0,0,0,0,12,54,0,6,
-105,102,95,110,117,100,0,0,10,7,54,53,16,54,1,21,
-44,17,0,0,30,6,2,137,9,100,101,102,32,116,114,121,
+12,10,0,5,98,108,111,99,107,0,0,0,49,8,1,10,
+50,7,8,0,15,5,7,0,30,13,2,135,9,9,9,105,
+116,101,109,115,46,97,112,112,101,110,100,40,84,111,107,101,
+110,40,116,111,107,46,112,111,115,44,39,101,108,105,102,39,
+44,39,101,108,105,102,39,44,91,97,44,98,93,41,41,0,
+12,11,0,6,97,112,112,101,110,100,0,0,49,8,3,11,
+12,12,0,5,84,111,107,101,110,0,0,0,13,11,12,0,
+12,16,0,3,112,111,115,0,9,12,6,16,12,13,0,4,
+101,108,105,102,0,0,0,0,12,14,0,4,101,108,105,102,
+0,0,0,0,15,16,4,0,15,17,5,0,27,15,16,2,
+31,10,12,4,19,10,11,10,50,7,8,1,18,0,255,135,
+30,9,2,136,9,9,105,102,32,115,101,108,102,46,99,104,
+101,99,107,40,115,101,108,102,46,116,111,107,101,110,44,39,
+101,108,115,101,39,41,58,0,12,12,0,5,99,104,101,99,
+107,0,0,0,49,8,1,12,12,12,0,5,116,111,107,101,
+110,0,0,0,9,10,1,12,12,11,0,4,101,108,115,101,
+0,0,0,0,50,7,8,2,21,7,0,0,18,0,0,90,
+30,5,2,137,9,9,9,116,111,107,32,61,32,115,101,108,
+102,46,116,111,107,101,110,0,12,8,0,5,116,111,107,101,
+110,0,0,0,9,7,1,8,15,6,7,0,30,6,2,138,
+9,9,9,115,101,108,102,46,97,100,118,97,110,99,101,40,
+39,101,108,115,101,39,41,0,12,11,0,7,97,100,118,97,
+110,99,101,0,49,8,1,11,12,10,0,4,101,108,115,101,
+0,0,0,0,50,7,8,1,30,6,2,139,9,9,9,115,
+101,108,102,46,97,100,118,97,110,99,101,40,39,58,39,41,
+0,0,0,0,12,11,0,7,97,100,118,97,110,99,101,0,
+49,8,1,11,12,10,0,1,58,0,0,0,50,7,8,1,
+30,5,2,140,9,9,9,98,32,61,32,115,101,108,102,46,
+98,108,111,99,107,40,41,0,12,10,0,5,98,108,111,99,
+107,0,0,0,49,8,1,10,50,7,8,0,15,5,7,0,
+30,13,2,141,9,9,9,105,116,101,109,115,46,97,112,112,
+101,110,100,40,84,111,107,101,110,40,116,111,107,46,112,111,
+115,44,39,101,108,115,101,39,44,39,101,108,115,101,39,44,
+91,98,93,41,41,0,0,0,12,11,0,6,97,112,112,101,
+110,100,0,0,49,8,3,11,12,12,0,5,84,111,107,101,
+110,0,0,0,13,11,12,0,12,16,0,3,112,111,115,0,
+9,12,6,16,12,13,0,4,101,108,115,101,0,0,0,0,
+12,14,0,4,101,108,115,101,0,0,0,0,15,16,5,0,
+27,15,16,1,31,10,12,4,19,10,11,10,50,7,8,1,
+18,0,0,1,30,3,2,142,9,9,114,101,116,117,114,110,
+32,116,0,0,20,2,0,0,0,0,0,0,12,55,0,6,
+105,102,95,110,117,100,0,0,10,8,55,54,16,55,1,11,
+44,18,0,0,30,6,2,145,9,100,101,102,32,116,114,121,
 95,110,117,100,40,115,101,108,102,44,116,41,58,0,0,0,
 12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
 33,1,0,0,12,1,0,7,116,114,121,95,110,117,100,0,
 34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,30,6,2,138,9,9,105,116,101,109,115,32,
+9,2,0,3,30,6,2,146,9,9,105,116,101,109,115,32,
 61,32,116,46,105,116,101,109,115,32,61,32,91,93,0,0,
 27,4,0,0,12,5,0,5,105,116,101,109,115,0,0,0,
-10,2,5,4,15,3,4,0,30,5,2,139,9,9,115,101,
+10,2,5,4,15,3,4,0,30,5,2,147,9,9,115,101,
 108,102,46,97,100,118,97,110,99,101,40,39,58,39,41,0,
-12,6,0,7,97,100,118,97,110,99,101,0,9,5,1,6,
-12,6,0,1,58,0,0,0,31,4,6,1,19,4,5,4,
-30,5,2,140,9,9,98,32,61,32,115,101,108,102,46,98,
-108,111,99,107,40,41,0,0,12,7,0,5,98,108,111,99,
-107,0,0,0,9,6,1,7,31,5,0,0,19,5,6,5,
-15,4,5,0,30,5,2,141,9,9,105,116,101,109,115,46,
-97,112,112,101,110,100,40,98,41,0,0,0,12,7,0,6,
-97,112,112,101,110,100,0,0,9,6,3,7,15,7,4,0,
-31,5,7,1,19,5,6,5,30,11,2,142,9,9,119,104,
-105,108,101,32,115,101,108,102,46,99,104,101,99,107,40,115,
-101,108,102,46,116,111,107,101,110,44,39,101,120,99,101,112,
-116,39,41,58,0,0,0,0,12,7,0,5,99,104,101,99,
-107,0,0,0,9,6,1,7,12,9,0,5,116,111,107,101,
-110,0,0,0,9,7,1,9,12,8,0,6,101,120,99,101,
-112,116,0,0,31,5,7,2,19,5,6,5,21,5,0,0,
-18,0,0,170,30,5,2,143,9,9,9,116,111,107,32,61,
+12,8,0,7,97,100,118,97,110,99,101,0,49,5,1,8,
+12,7,0,1,58,0,0,0,50,4,5,1,30,5,2,148,
+9,9,98,32,61,32,115,101,108,102,46,98,108,111,99,107,
+40,41,0,0,12,8,0,5,98,108,111,99,107,0,0,0,
+49,6,1,8,50,5,6,0,15,4,5,0,30,5,2,149,
+9,9,105,116,101,109,115,46,97,112,112,101,110,100,40,98,
+41,0,0,0,12,9,0,6,97,112,112,101,110,100,0,0,
+49,6,3,9,15,8,4,0,50,5,6,1,30,11,2,150,
+9,9,119,104,105,108,101,32,115,101,108,102,46,99,104,101,
+99,107,40,115,101,108,102,46,116,111,107,101,110,44,39,101,
+120,99,101,112,116,39,41,58,0,0,0,0,12,10,0,5,
+99,104,101,99,107,0,0,0,49,6,1,10,12,10,0,5,
+116,111,107,101,110,0,0,0,9,8,1,10,12,9,0,6,
+101,120,99,101,112,116,0,0,50,5,6,2,21,5,0,0,
+18,0,0,164,30,5,2,151,9,9,9,116,111,107,32,61,
 32,115,101,108,102,46,116,111,107,101,110,0,12,7,0,5,
 116,111,107,101,110,0,0,0,9,6,1,7,15,5,6,0,
-30,7,2,144,9,9,9,115,101,108,102,46,97,100,118,97,
+30,7,2,152,9,9,9,115,101,108,102,46,97,100,118,97,
 110,99,101,40,39,101,120,99,101,112,116,39,41,0,0,0,
-12,8,0,7,97,100,118,97,110,99,101,0,9,7,1,8,
-12,8,0,6,101,120,99,101,112,116,0,0,31,6,8,1,
-19,6,7,6,30,16,2,145,9,9,9,105,102,32,110,111,
-116,32,115,101,108,102,46,99,104,101,99,107,40,115,101,108,
-102,46,116,111,107,101,110,44,39,58,39,41,58,32,97,32,
-61,32,115,101,108,102,46,101,120,112,114,101,115,115,105,111,
-110,40,48,41,0,0,0,0,12,9,0,5,99,104,101,99,
-107,0,0,0,9,8,1,9,12,11,0,5,116,111,107,101,
-110,0,0,0,9,9,1,11,12,10,0,1,58,0,0,0,
-31,7,9,2,19,7,8,7,47,6,7,0,21,6,0,0,
-18,0,0,13,12,9,0,10,101,120,112,114,101,115,115,105,
-111,110,0,0,9,8,1,9,11,9,0,0,0,0,0,0,
-0,0,0,0,31,7,9,1,19,7,8,7,15,6,7,0,
-18,0,0,30,30,11,2,146,9,9,9,101,108,115,101,58,
-32,97,32,61,32,84,111,107,101,110,40,116,111,107,46,112,
-111,115,44,39,115,121,109,98,111,108,39,44,39,78,111,110,
-101,39,41,0,12,9,0,5,84,111,107,101,110,0,0,0,
-13,8,9,0,12,12,0,3,112,111,115,0,9,9,5,12,
-12,10,0,6,115,121,109,98,111,108,0,0,12,11,0,4,
-78,111,110,101,0,0,0,0,31,7,9,3,19,7,8,7,
-15,6,7,0,18,0,0,1,30,6,2,147,9,9,9,115,
-101,108,102,46,97,100,118,97,110,99,101,40,39,58,39,41,
-0,0,0,0,12,9,0,7,97,100,118,97,110,99,101,0,
-9,8,1,9,12,9,0,1,58,0,0,0,31,7,9,1,
-19,7,8,7,30,5,2,148,9,9,9,98,32,61,32,115,
-101,108,102,46,98,108,111,99,107,40,41,0,12,9,0,5,
-98,108,111,99,107,0,0,0,9,8,1,9,31,7,0,0,
-19,7,8,7,15,4,7,0,30,14,2,149,9,9,9,105,
-116,101,109,115,46,97,112,112,101,110,100,40,84,111,107,101,
-110,40,116,111,107,46,112,111,115,44,39,101,120,99,101,112,
-116,39,44,39,101,120,99,101,112,116,39,44,91,97,44,98,
-93,41,41,0,12,9,0,6,97,112,112,101,110,100,0,0,
-9,8,3,9,12,11,0,5,84,111,107,101,110,0,0,0,
-13,10,11,0,12,15,0,3,112,111,115,0,9,11,5,15,
-12,12,0,6,101,120,99,101,112,116,0,0,12,13,0,6,
-101,120,99,101,112,116,0,0,15,15,6,0,15,16,4,0,
-27,14,15,2,31,9,11,4,19,9,10,9,31,7,9,1,
-19,7,8,7,18,0,255,73,30,3,2,150,9,9,114,101,
-116,117,114,110,32,116,0,0,20,2,0,0,0,0,0,0,
-12,55,0,7,116,114,121,95,110,117,100,0,10,7,55,54,
-16,55,0,61,44,8,0,0,30,7,2,153,9,100,101,102,
-32,112,114,101,102,105,120,95,110,117,100,40,115,101,108,102,
+12,10,0,7,97,100,118,97,110,99,101,0,49,7,1,10,
+12,9,0,6,101,120,99,101,112,116,0,0,50,6,7,1,
+30,16,2,153,9,9,9,105,102,32,110,111,116,32,115,101,
+108,102,46,99,104,101,99,107,40,115,101,108,102,46,116,111,
+107,101,110,44,39,58,39,41,58,32,97,32,61,32,115,101,
+108,102,46,101,120,112,114,101,115,115,105,111,110,40,48,41,
+0,0,0,0,12,12,0,5,99,104,101,99,107,0,0,0,
+49,8,1,12,12,12,0,5,116,111,107,101,110,0,0,0,
+9,10,1,12,12,11,0,1,58,0,0,0,50,7,8,2,
+47,6,7,0,21,6,0,0,18,0,0,12,12,11,0,10,
+101,120,112,114,101,115,115,105,111,110,0,0,49,8,1,11,
+11,10,0,1,0,0,0,0,0,0,0,0,50,7,8,1,
+15,6,7,0,18,0,0,30,30,11,2,154,9,9,9,101,
+108,115,101,58,32,97,32,61,32,84,111,107,101,110,40,116,
+111,107,46,112,111,115,44,39,115,121,109,98,111,108,39,44,
+39,78,111,110,101,39,41,0,12,9,0,5,84,111,107,101,
+110,0,0,0,13,8,9,0,12,12,0,3,112,111,115,0,
+9,9,5,12,12,10,0,6,115,121,109,98,111,108,0,0,
+12,11,0,4,78,111,110,101,0,0,0,0,31,7,9,3,
+19,7,8,7,15,6,7,0,18,0,0,1,30,6,2,155,
+9,9,9,115,101,108,102,46,97,100,118,97,110,99,101,40,
+39,58,39,41,0,0,0,0,12,11,0,7,97,100,118,97,
+110,99,101,0,49,8,1,11,12,10,0,1,58,0,0,0,
+50,7,8,1,30,5,2,156,9,9,9,98,32,61,32,115,
+101,108,102,46,98,108,111,99,107,40,41,0,12,10,0,5,
+98,108,111,99,107,0,0,0,49,8,1,10,50,7,8,0,
+15,4,7,0,30,14,2,157,9,9,9,105,116,101,109,115,
+46,97,112,112,101,110,100,40,84,111,107,101,110,40,116,111,
+107,46,112,111,115,44,39,101,120,99,101,112,116,39,44,39,
+101,120,99,101,112,116,39,44,91,97,44,98,93,41,41,0,
+12,11,0,6,97,112,112,101,110,100,0,0,49,8,3,11,
+12,12,0,5,84,111,107,101,110,0,0,0,13,11,12,0,
+12,16,0,3,112,111,115,0,9,12,5,16,12,13,0,6,
+101,120,99,101,112,116,0,0,12,14,0,6,101,120,99,101,
+112,116,0,0,15,16,6,0,15,17,4,0,27,15,16,2,
+31,10,12,4,19,10,11,10,50,7,8,1,18,0,255,80,
+30,3,2,158,9,9,114,101,116,117,114,110,32,116,0,0,
+20,2,0,0,0,0,0,0,12,56,0,7,116,114,121,95,
+110,117,100,0,10,8,56,55,16,56,0,60,44,10,0,0,
+30,7,2,161,9,100,101,102,32,112,114,101,102,105,120,95,
+110,117,100,40,115,101,108,102,44,116,41,58,0,0,0,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,10,112,114,101,102,105,120,95,110,
+117,100,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
+28,3,0,0,9,2,0,3,30,3,2,162,9,9,98,112,
+32,61,32,116,46,98,112,0,12,5,0,2,98,112,0,0,
+9,4,2,5,15,3,4,0,30,9,2,163,9,9,116,46,
+105,116,101,109,115,32,61,32,91,115,101,108,102,46,101,120,
+112,114,101,115,115,105,111,110,40,98,112,41,93,0,0,0,
+12,9,0,10,101,120,112,114,101,115,115,105,111,110,0,0,
+49,6,1,9,15,8,3,0,50,5,6,1,27,4,5,1,
+12,5,0,5,105,116,101,109,115,0,0,0,10,2,5,4,
+30,3,2,164,9,9,114,101,116,117,114,110,32,116,0,0,
+20,2,0,0,0,0,0,0,12,57,0,10,112,114,101,102,
+105,120,95,110,117,100,0,0,10,8,57,56,16,57,0,80,
+44,12,0,0,30,7,2,167,9,100,101,102,32,112,114,101,
+102,105,120,95,110,117,100,48,40,115,101,108,102,44,116,41,
+58,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
+121,0,0,0,33,1,0,0,12,1,0,11,112,114,101,102,
+105,120,95,110,117,100,48,0,34,1,0,0,28,2,0,0,
+9,1,0,2,28,3,0,0,9,2,0,3,30,16,2,168,
+9,9,105,102,32,115,101,108,102,46,99,104,101,99,107,40,
+115,101,108,102,46,116,111,107,101,110,44,39,110,108,39,44,
+39,59,39,44,39,101,111,102,39,44,39,100,101,100,101,110,
+116,39,41,58,32,114,101,116,117,114,110,32,116,0,0,0,
+12,11,0,5,99,104,101,99,107,0,0,0,49,4,1,11,
+12,11,0,5,116,111,107,101,110,0,0,0,9,6,1,11,
+12,7,0,2,110,108,0,0,12,8,0,1,59,0,0,0,
+12,9,0,3,101,111,102,0,12,10,0,6,100,101,100,101,
+110,116,0,0,50,3,4,5,21,3,0,0,18,0,0,3,
+20,2,0,0,18,0,0,1,30,7,2,169,9,9,114,101,
+116,117,114,110,32,115,101,108,102,46,112,114,101,102,105,120,
+95,110,117,100,40,116,41,0,12,7,0,10,112,114,101,102,
+105,120,95,110,117,100,0,0,49,4,1,7,15,6,2,0,
+50,3,4,1,20,3,0,0,0,0,0,0,12,58,0,11,
+112,114,101,102,105,120,95,110,117,100,48,0,10,8,58,57,
+16,58,0,63,44,10,0,0,30,7,2,172,9,100,101,102,
+32,112,114,101,102,105,120,95,110,117,100,115,40,115,101,108,
+102,44,116,41,58,0,0,0,12,1,0,9,116,105,110,121,
+112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,11,
+112,114,101,102,105,120,95,110,117,100,115,0,34,1,0,0,
+28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
+30,7,2,173,9,9,114,32,61,32,115,101,108,102,46,101,
+120,112,114,101,115,115,105,111,110,40,48,41,0,0,0,0,
+12,8,0,10,101,120,112,114,101,115,115,105,111,110,0,0,
+49,5,1,8,11,7,0,1,0,0,0,0,0,0,0,0,
+50,4,5,1,15,3,4,0,30,8,2,174,9,9,114,101,
+116,117,114,110,32,115,101,108,102,46,105,108,115,116,40,116,
+46,116,121,112,101,44,114,41,0,0,0,0,12,9,0,4,
+105,108,115,116,0,0,0,0,49,5,1,9,12,9,0,4,
+116,121,112,101,0,0,0,0,9,7,2,9,15,8,3,0,
+50,4,5,2,20,4,0,0,0,0,0,0,12,59,0,11,
+112,114,101,102,105,120,95,110,117,100,115,0,10,8,59,58,
+16,59,0,134,44,12,0,0,30,7,2,177,9,100,101,102,
+32,112,114,101,102,105,120,95,110,101,103,40,115,101,108,102,
 44,116,41,58,0,0,0,0,12,1,0,9,116,105,110,121,
 112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,10,
-112,114,101,102,105,120,95,110,117,100,0,0,34,1,0,0,
+112,114,101,102,105,120,95,110,101,103,0,0,34,1,0,0,
 28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-30,3,2,154,9,9,98,112,32,61,32,116,46,98,112,0,
-12,5,0,2,98,112,0,0,9,4,2,5,15,3,4,0,
-30,9,2,155,9,9,116,46,105,116,101,109,115,32,61,32,
-91,115,101,108,102,46,101,120,112,114,101,115,115,105,111,110,
-40,98,112,41,93,0,0,0,12,7,0,10,101,120,112,114,
-101,115,115,105,111,110,0,0,9,6,1,7,15,7,3,0,
-31,5,7,1,19,5,6,5,27,4,5,1,12,5,0,5,
-105,116,101,109,115,0,0,0,10,2,5,4,30,3,2,156,
-9,9,114,101,116,117,114,110,32,116,0,0,20,2,0,0,
-0,0,0,0,12,56,0,10,112,114,101,102,105,120,95,110,
-117,100,0,0,10,7,56,55,16,56,0,82,44,11,0,0,
-30,7,2,159,9,100,101,102,32,112,114,101,102,105,120,95,
-110,117,100,48,40,115,101,108,102,44,116,41,58,0,0,0,
-12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
-33,1,0,0,12,1,0,11,112,114,101,102,105,120,95,110,
-117,100,48,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,3,0,0,9,2,0,3,30,16,2,160,9,9,105,102,
-32,115,101,108,102,46,99,104,101,99,107,40,115,101,108,102,
-46,116,111,107,101,110,44,39,110,108,39,44,39,59,39,44,
-39,101,111,102,39,44,39,100,101,100,101,110,116,39,41,58,
-32,114,101,116,117,114,110,32,116,0,0,0,12,5,0,5,
-99,104,101,99,107,0,0,0,9,4,1,5,12,10,0,5,
-116,111,107,101,110,0,0,0,9,5,1,10,12,6,0,2,
-110,108,0,0,12,7,0,1,59,0,0,0,12,8,0,3,
-101,111,102,0,12,9,0,6,100,101,100,101,110,116,0,0,
-31,3,5,5,19,3,4,3,21,3,0,0,18,0,0,3,
-20,2,0,0,18,0,0,1,30,7,2,161,9,9,114,101,
-116,117,114,110,32,115,101,108,102,46,112,114,101,102,105,120,
-95,110,117,100,40,116,41,0,12,5,0,10,112,114,101,102,
-105,120,95,110,117,100,0,0,9,4,1,5,15,5,2,0,
-31,3,5,1,19,3,4,3,20,3,0,0,0,0,0,0,
-12,57,0,11,112,114,101,102,105,120,95,110,117,100,48,0,
-10,7,57,56,16,57,0,65,44,9,0,0,30,7,2,164,
-9,100,101,102,32,112,114,101,102,105,120,95,110,117,100,115,
-40,115,101,108,102,44,116,41,58,0,0,0,12,1,0,9,
-116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,11,112,114,101,102,105,120,95,110,117,100,115,0,
-34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,30,7,2,165,9,9,114,32,61,32,115,101,
-108,102,46,101,120,112,114,101,115,115,105,111,110,40,48,41,
-0,0,0,0,12,6,0,10,101,120,112,114,101,115,115,105,
-111,110,0,0,9,5,1,6,11,6,0,0,0,0,0,0,
-0,0,0,0,31,4,6,1,19,4,5,4,15,3,4,0,
-30,8,2,166,9,9,114,101,116,117,114,110,32,115,101,108,
-102,46,105,108,115,116,40,116,46,116,121,112,101,44,114,41,
-0,0,0,0,12,6,0,4,105,108,115,116,0,0,0,0,
-9,5,1,6,12,8,0,4,116,121,112,101,0,0,0,0,
-9,6,2,8,15,7,3,0,31,4,6,2,19,4,5,4,
-20,4,0,0,0,0,0,0,12,58,0,11,112,114,101,102,
-105,120,95,110,117,100,115,0,10,7,58,57,16,58,0,135,
-44,12,0,0,30,7,2,169,9,100,101,102,32,112,114,101,
-102,105,120,95,110,101,103,40,115,101,108,102,44,116,41,58,
-0,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,10,112,114,101,102,
-105,120,95,110,101,103,0,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,30,7,2,170,
-9,9,114,32,61,32,115,101,108,102,46,101,120,112,114,101,
-115,115,105,111,110,40,53,48,41,0,0,0,12,6,0,10,
-101,120,112,114,101,115,115,105,111,110,0,0,9,5,1,6,
-11,6,0,0,0,0,0,0,0,0,73,64,31,4,6,1,
-19,4,5,4,15,3,4,0,30,7,2,171,9,9,105,102,
+30,7,2,178,9,9,114,32,61,32,115,101,108,102,46,101,
+120,112,114,101,115,115,105,111,110,40,53,48,41,0,0,0,
+12,8,0,10,101,120,112,114,101,115,115,105,111,110,0,0,
+49,5,1,8,11,7,0,1,50,0,0,0,0,0,0,0,
+50,4,5,1,15,3,4,0,30,7,2,179,9,9,105,102,
 32,114,46,116,121,112,101,32,61,61,32,39,110,117,109,98,
 101,114,39,58,0,0,0,0,12,5,0,4,116,121,112,101,
 0,0,0,0,9,4,3,5,12,5,0,6,110,117,109,98,
 101,114,0,0,23,4,4,5,21,4,0,0,18,0,0,37,
-30,8,2,172,9,9,9,114,46,118,97,108,32,61,32,115,
+30,8,2,180,9,9,9,114,46,118,97,108,32,61,32,115,
 116,114,40,45,102,108,111,97,116,40,114,46,118,97,108,41,
 41,0,0,0,12,6,0,3,115,116,114,0,13,5,6,0,
-11,6,0,0,0,0,0,0,0,0,0,0,12,9,0,5,
+11,6,0,1,0,0,0,0,0,0,0,0,12,9,0,5,
 102,108,111,97,116,0,0,0,13,8,9,0,12,10,0,3,
 118,97,108,0,9,9,3,10,31,7,9,1,19,7,8,7,
 2,6,6,7,31,4,6,1,19,4,5,4,12,5,0,3,
-118,97,108,0,10,3,5,4,30,3,2,173,9,9,9,114,
+118,97,108,0,10,3,5,4,30,3,2,181,9,9,9,114,
 101,116,117,114,110,32,114,0,20,3,0,0,18,0,0,1,
-30,11,2,174,9,9,116,46,105,116,101,109,115,32,61,32,
+30,11,2,182,9,9,116,46,105,116,101,109,115,32,61,32,
 91,84,111,107,101,110,40,116,46,112,111,115,44,39,110,117,
 109,98,101,114,39,44,39,48,39,41,44,114,93,0,0,0,
 12,8,0,5,84,111,107,101,110,0,0,0,13,7,8,0,
@@ -2879,1178 +2864,1256 @@ unsigned char py_tinypy[] = {
 110,117,109,98,101,114,0,0,12,10,0,1,48,0,0,0,
 31,5,8,3,19,5,7,5,15,6,3,0,27,4,5,2,
 12,5,0,5,105,116,101,109,115,0,0,0,10,2,5,4,
-30,3,2,175,9,9,114,101,116,117,114,110,32,116,0,0,
-20,2,0,0,0,0,0,0,12,59,0,10,112,114,101,102,
-105,120,95,110,101,103,0,0,10,7,59,58,16,59,0,69,
-44,7,0,0,30,6,2,178,9,100,101,102,32,118,97,114,
+30,3,2,183,9,9,114,101,116,117,114,110,32,116,0,0,
+20,2,0,0,0,0,0,0,12,60,0,10,112,114,101,102,
+105,120,95,110,101,103,0,0,10,8,60,59,16,60,0,68,
+44,9,0,0,30,6,2,186,9,100,101,102,32,118,97,114,
 103,115,95,110,117,100,40,115,101,108,102,44,116,41,58,0,
 12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
 33,1,0,0,12,1,0,9,118,97,114,103,115,95,110,117,
 100,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,3,0,0,9,2,0,3,30,7,2,179,9,9,114,32,
+28,3,0,0,9,2,0,3,30,7,2,187,9,9,114,32,
 61,32,115,101,108,102,46,112,114,101,102,105,120,95,110,117,
-100,40,116,41,0,0,0,0,12,6,0,10,112,114,101,102,
-105,120,95,110,117,100,0,0,9,5,1,6,15,6,2,0,
-31,4,6,1,19,4,5,4,15,3,4,0,30,5,2,180,
-9,9,116,46,116,121,112,101,32,61,32,39,97,114,103,115,
-39,0,0,0,12,4,0,4,97,114,103,115,0,0,0,0,
+100,40,116,41,0,0,0,0,12,8,0,10,112,114,101,102,
+105,120,95,110,117,100,0,0,49,5,1,8,15,7,2,0,
+50,4,5,1,15,3,4,0,30,5,2,188,9,9,116,46,
+116,121,112,101,32,61,32,39,97,114,103,115,39,0,0,0,
+12,4,0,4,97,114,103,115,0,0,0,0,12,5,0,4,
+116,121,112,101,0,0,0,0,10,2,5,4,30,4,2,189,
+9,9,116,46,118,97,108,32,61,32,39,42,39,0,0,0,
+12,4,0,1,42,0,0,0,12,5,0,3,118,97,108,0,
+10,2,5,4,30,3,2,190,9,9,114,101,116,117,114,110,
+32,116,0,0,20,2,0,0,0,0,0,0,12,61,0,9,
+118,97,114,103,115,95,110,117,100,0,0,0,10,8,61,60,
+16,61,0,68,44,9,0,0,30,6,2,193,9,100,101,102,
+32,110,97,114,103,115,95,110,117,100,40,115,101,108,102,44,
+116,41,58,0,12,1,0,9,116,105,110,121,112,121,46,112,
+121,0,0,0,33,1,0,0,12,1,0,9,110,97,114,103,
+115,95,110,117,100,0,0,0,34,1,0,0,28,2,0,0,
+9,1,0,2,28,3,0,0,9,2,0,3,30,7,2,194,
+9,9,114,32,61,32,115,101,108,102,46,112,114,101,102,105,
+120,95,110,117,100,40,116,41,0,0,0,0,12,8,0,10,
+112,114,101,102,105,120,95,110,117,100,0,0,49,5,1,8,
+15,7,2,0,50,4,5,1,15,3,4,0,30,5,2,195,
+9,9,116,46,116,121,112,101,32,61,32,39,110,97,114,103,
+115,39,0,0,12,4,0,5,110,97,114,103,115,0,0,0,
 12,5,0,4,116,121,112,101,0,0,0,0,10,2,5,4,
-30,4,2,181,9,9,116,46,118,97,108,32,61,32,39,42,
-39,0,0,0,12,4,0,1,42,0,0,0,12,5,0,3,
-118,97,108,0,10,2,5,4,30,3,2,182,9,9,114,101,
+30,4,2,196,9,9,116,46,118,97,108,32,61,32,39,42,
+42,39,0,0,12,4,0,2,42,42,0,0,12,5,0,3,
+118,97,108,0,10,2,5,4,30,3,2,197,9,9,114,101,
 116,117,114,110,32,116,0,0,20,2,0,0,0,0,0,0,
-12,60,0,9,118,97,114,103,115,95,110,117,100,0,0,0,
-10,7,60,59,16,60,0,69,44,7,0,0,30,6,2,185,
-9,100,101,102,32,110,97,114,103,115,95,110,117,100,40,115,
-101,108,102,44,116,41,58,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,9,
-110,97,114,103,115,95,110,117,100,0,0,0,34,1,0,0,
-28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-30,7,2,186,9,9,114,32,61,32,115,101,108,102,46,112,
-114,101,102,105,120,95,110,117,100,40,116,41,0,0,0,0,
-12,6,0,10,112,114,101,102,105,120,95,110,117,100,0,0,
-9,5,1,6,15,6,2,0,31,4,6,1,19,4,5,4,
-15,3,4,0,30,5,2,187,9,9,116,46,116,121,112,101,
-32,61,32,39,110,97,114,103,115,39,0,0,12,4,0,5,
-110,97,114,103,115,0,0,0,12,5,0,4,116,121,112,101,
-0,0,0,0,10,2,5,4,30,4,2,188,9,9,116,46,
-118,97,108,32,61,32,39,42,42,39,0,0,12,4,0,2,
-42,42,0,0,12,5,0,3,118,97,108,0,10,2,5,4,
-30,3,2,189,9,9,114,101,116,117,114,110,32,116,0,0,
-20,2,0,0,0,0,0,0,12,61,0,9,110,97,114,103,
-115,95,110,117,100,0,0,0,10,7,61,60,16,61,0,71,
-44,15,0,0,30,8,2,192,9,100,101,102,32,105,95,105,
-110,102,105,120,40,115,101,108,102,44,98,112,44,108,101,100,
-44,42,118,115,41,58,0,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,7,
-105,95,105,110,102,105,120,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,28,4,0,0,
-9,3,0,4,12,5,0,1,42,0,0,0,9,4,0,5,
-30,4,2,193,9,9,102,111,114,32,118,32,105,110,32,118,
-115,58,32,0,11,6,0,0,0,0,0,0,0,0,0,0,
-42,5,4,6,18,0,0,32,30,13,2,194,9,9,9,115,
-101,108,102,46,98,97,115,101,95,100,109,97,112,91,118,93,
-32,61,32,123,39,108,98,112,39,58,98,112,44,39,98,112,
-39,58,98,112,44,39,108,101,100,39,58,108,101,100,125,0,
-12,8,0,9,98,97,115,101,95,100,109,97,112,0,0,0,
-9,7,1,8,12,9,0,3,108,98,112,0,15,10,2,0,
-12,11,0,2,98,112,0,0,15,12,2,0,12,13,0,3,
-108,101,100,0,15,14,3,0,26,8,9,6,10,7,5,8,
-18,0,255,224,0,0,0,0,12,62,0,7,105,95,105,110,
-102,105,120,0,10,7,62,61,16,62,0,67,44,12,0,0,
-30,6,2,197,9,100,101,102,32,105,95,116,101,114,109,115,
-40,115,101,108,102,44,42,118,115,41,58,0,12,1,0,9,
-116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,7,105,95,116,101,114,109,115,0,34,1,0,0,
-28,2,0,0,9,1,0,2,12,3,0,1,42,0,0,0,
-9,2,0,3,30,4,2,198,9,9,102,111,114,32,118,32,
-105,110,32,118,115,58,32,0,11,4,0,0,0,0,0,0,
-0,0,0,0,42,3,2,4,18,0,0,34,30,13,2,199,
-9,9,9,115,101,108,102,46,98,97,115,101,95,100,109,97,
-112,91,118,93,32,61,32,123,39,108,98,112,39,58,48,44,
-39,110,117,100,39,58,115,101,108,102,46,105,116,115,101,108,
-102,125,0,0,12,6,0,9,98,97,115,101,95,100,109,97,
-112,0,0,0,9,5,1,6,12,7,0,3,108,98,112,0,
-11,8,0,0,0,0,0,0,0,0,0,0,12,9,0,3,
-110,117,100,0,12,11,0,6,105,116,115,101,108,102,0,0,
-9,10,1,11,26,6,7,4,10,5,3,6,18,0,255,222,
-0,0,0,0,12,63,0,7,105,95,116,101,114,109,115,0,
-10,7,63,62,16,63,0,83,44,8,0,0,30,6,2,202,
-9,100,101,102,32,103,109,97,112,40,115,101,108,102,44,116,
-44,118,41,58,0,0,0,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,4,
-103,109,97,112,0,0,0,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,28,4,0,0,
-9,3,0,4,30,7,2,203,9,9,105,102,32,118,32,110,
-111,116,32,105,110,32,115,101,108,102,46,100,109,97,112,58,
-0,0,0,0,12,5,0,4,100,109,97,112,0,0,0,0,
-9,4,1,5,36,4,4,3,11,5,0,0,0,0,0,0,
-0,0,0,0,23,4,4,5,21,4,0,0,18,0,0,27,
-30,10,2,204,9,9,9,115,101,108,102,46,114,97,105,115,
-101,69,114,114,111,114,40,39,117,110,107,110,111,119,110,32,
-34,37,115,34,39,37,118,44,116,41,0,0,12,6,0,10,
-114,97,105,115,101,69,114,114,111,114,0,0,9,5,1,6,
-12,6,0,12,117,110,107,110,111,119,110,32,34,37,115,34,
-0,0,0,0,39,6,6,3,15,7,2,0,31,4,6,2,
-19,4,5,4,18,0,0,1,30,6,2,205,9,9,114,101,
-116,117,114,110,32,115,101,108,102,46,100,109,97,112,91,118,
-93,0,0,0,12,5,0,4,100,109,97,112,0,0,0,0,
-9,4,1,5,9,4,4,3,20,4,0,0,0,0,0,0,
-12,64,0,4,103,109,97,112,0,0,0,0,10,7,64,63,
-16,64,0,96,44,9,0,0,30,5,2,208,9,100,101,102,
-32,100,111,40,115,101,108,102,44,116,41,58,0,0,0,0,
+12,62,0,9,110,97,114,103,115,95,110,117,100,0,0,0,
+10,8,62,61,16,62,0,71,44,15,0,0,30,8,2,200,
+9,100,101,102,32,105,95,105,110,102,105,120,40,115,101,108,
+102,44,98,112,44,108,101,100,44,42,118,115,41,58,0,0,
 12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
-33,1,0,0,12,1,0,2,100,111,0,0,34,1,0,0,
-28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-30,12,2,209,9,9,105,102,32,116,46,116,121,112,101,32,
-61,61,32,39,115,121,109,98,111,108,39,58,32,114,32,61,
-32,115,101,108,102,46,103,109,97,112,40,116,44,116,46,118,
-97,108,41,0,12,4,0,4,116,121,112,101,0,0,0,0,
-9,3,2,4,12,4,0,6,115,121,109,98,111,108,0,0,
-23,3,3,4,21,3,0,0,18,0,0,13,12,6,0,4,
-103,109,97,112,0,0,0,0,9,5,1,6,15,6,2,0,
-12,8,0,3,118,97,108,0,9,7,2,8,31,4,6,2,
-19,4,5,4,15,3,4,0,18,0,0,23,30,8,2,210,
+33,1,0,0,12,1,0,7,105,95,105,110,102,105,120,0,
+34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
+9,2,0,3,28,4,0,0,9,3,0,4,12,5,0,1,
+42,0,0,0,9,4,0,5,30,4,2,201,9,9,102,111,
+114,32,118,32,105,110,32,118,115,58,32,0,11,6,0,1,
+0,0,0,0,0,0,0,0,42,5,4,6,18,0,0,32,
+30,13,2,202,9,9,9,115,101,108,102,46,98,97,115,101,
+95,100,109,97,112,91,118,93,32,61,32,123,39,108,98,112,
+39,58,98,112,44,39,98,112,39,58,98,112,44,39,108,101,
+100,39,58,108,101,100,125,0,12,8,0,9,98,97,115,101,
+95,100,109,97,112,0,0,0,9,7,1,8,12,9,0,3,
+108,98,112,0,15,10,2,0,12,11,0,2,98,112,0,0,
+15,12,2,0,12,13,0,3,108,101,100,0,15,14,3,0,
+26,8,9,6,10,7,5,8,18,0,255,224,0,0,0,0,
+12,63,0,7,105,95,105,110,102,105,120,0,10,8,63,62,
+16,63,0,67,44,12,0,0,30,6,2,205,9,100,101,102,
+32,105,95,116,101,114,109,115,40,115,101,108,102,44,42,118,
+115,41,58,0,12,1,0,9,116,105,110,121,112,121,46,112,
+121,0,0,0,33,1,0,0,12,1,0,7,105,95,116,101,
+114,109,115,0,34,1,0,0,28,2,0,0,9,1,0,2,
+12,3,0,1,42,0,0,0,9,2,0,3,30,4,2,206,
+9,9,102,111,114,32,118,32,105,110,32,118,115,58,32,0,
+11,4,0,1,0,0,0,0,0,0,0,0,42,3,2,4,
+18,0,0,34,30,13,2,207,9,9,9,115,101,108,102,46,
+98,97,115,101,95,100,109,97,112,91,118,93,32,61,32,123,
+39,108,98,112,39,58,48,44,39,110,117,100,39,58,115,101,
+108,102,46,105,116,115,101,108,102,125,0,0,12,6,0,9,
+98,97,115,101,95,100,109,97,112,0,0,0,9,5,1,6,
+12,7,0,3,108,98,112,0,11,8,0,1,0,0,0,0,
+0,0,0,0,12,9,0,3,110,117,100,0,12,11,0,6,
+105,116,115,101,108,102,0,0,9,10,1,11,26,6,7,4,
+10,5,3,6,18,0,255,222,0,0,0,0,12,64,0,7,
+105,95,116,101,114,109,115,0,10,8,64,63,16,64,0,82,
+44,10,0,0,30,6,2,210,9,100,101,102,32,103,109,97,
+112,40,115,101,108,102,44,116,44,118,41,58,0,0,0,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,4,103,109,97,112,0,0,0,0,
+34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
+9,2,0,3,28,4,0,0,9,3,0,4,30,7,2,211,
+9,9,105,102,32,118,32,110,111,116,32,105,110,32,115,101,
+108,102,46,100,109,97,112,58,0,0,0,0,12,5,0,4,
+100,109,97,112,0,0,0,0,9,4,1,5,36,4,4,3,
+11,5,0,1,0,0,0,0,0,0,0,0,23,4,4,5,
+21,4,0,0,18,0,0,26,30,10,2,212,9,9,9,115,
+101,108,102,46,114,97,105,115,101,69,114,114,111,114,40,39,
+117,110,107,110,111,119,110,32,34,37,115,34,39,37,118,44,
+116,41,0,0,12,9,0,10,114,97,105,115,101,69,114,114,
+111,114,0,0,49,5,1,9,12,7,0,12,117,110,107,110,
+111,119,110,32,34,37,115,34,0,0,0,0,39,7,7,3,
+15,8,2,0,50,4,5,2,18,0,0,1,30,6,2,213,
+9,9,114,101,116,117,114,110,32,115,101,108,102,46,100,109,
+97,112,91,118,93,0,0,0,12,5,0,4,100,109,97,112,
+0,0,0,0,9,4,1,5,9,4,4,3,20,4,0,0,
+0,0,0,0,12,65,0,4,103,109,97,112,0,0,0,0,
+10,8,65,64,16,65,0,94,44,10,0,0,30,5,2,216,
+9,100,101,102,32,100,111,40,115,101,108,102,44,116,41,58,
+0,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
+121,0,0,0,33,1,0,0,12,1,0,2,100,111,0,0,
+34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
+9,2,0,3,30,12,2,217,9,9,105,102,32,116,46,116,
+121,112,101,32,61,61,32,39,115,121,109,98,111,108,39,58,
+32,114,32,61,32,115,101,108,102,46,103,109,97,112,40,116,
+44,116,46,118,97,108,41,0,12,4,0,4,116,121,112,101,
+0,0,0,0,9,3,2,4,12,4,0,6,115,121,109,98,
+111,108,0,0,23,3,3,4,21,3,0,0,18,0,0,12,
+12,9,0,4,103,109,97,112,0,0,0,0,49,5,1,9,
+15,7,2,0,12,9,0,3,118,97,108,0,9,8,2,9,
+50,4,5,2,15,3,4,0,18,0,0,22,30,8,2,218,
 9,9,101,108,115,101,58,32,114,32,61,32,115,101,108,102,
 46,103,109,97,112,40,116,44,116,46,116,121,112,101,41,0,
-12,6,0,4,103,109,97,112,0,0,0,0,9,5,1,6,
-15,6,2,0,12,8,0,4,116,121,112,101,0,0,0,0,
-9,7,2,8,31,4,6,2,19,4,5,4,15,3,4,0,
-18,0,0,1,30,4,2,211,9,9,109,101,114,103,101,40,
-116,44,114,41,0,0,0,0,12,6,0,5,109,101,114,103,
-101,0,0,0,13,5,6,0,15,6,2,0,15,7,3,0,
-31,4,6,2,19,4,5,4,30,3,2,212,9,9,114,101,
-116,117,114,110,32,116,0,0,20,2,0,0,0,0,0,0,
-12,65,0,2,100,111,0,0,10,7,65,64,16,65,0,132,
-44,11,0,0,30,6,2,215,9,100,101,102,32,100,111,95,
-109,111,100,117,108,101,40,115,101,108,102,41,58,0,0,0,
-12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
-33,1,0,0,12,1,0,9,100,111,95,109,111,100,117,108,
-101,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
-30,5,2,216,9,9,116,111,107,32,61,32,115,101,108,102,
-46,116,111,107,101,110,0,0,12,4,0,5,116,111,107,101,
-110,0,0,0,9,3,1,4,15,2,3,0,30,4,2,217,
-9,9,105,116,101,109,115,32,61,32,91,93,0,0,0,0,
-27,4,0,0,15,3,4,0,30,6,2,218,9,9,115,101,
-108,102,46,105,98,108,111,99,107,40,105,116,101,109,115,41,
-0,0,0,0,12,6,0,6,105,98,108,111,99,107,0,0,
-9,5,1,6,15,6,3,0,31,4,6,1,19,4,5,4,
-30,6,2,219,9,9,115,101,108,102,46,97,100,118,97,110,
-99,101,40,39,101,111,102,39,41,0,0,0,12,6,0,7,
-97,100,118,97,110,99,101,0,9,5,1,6,12,6,0,3,
-101,111,102,0,31,4,6,1,19,4,5,4,30,6,2,220,
-9,9,105,102,32,108,101,110,40,105,116,101,109,115,41,32,
-62,32,49,58,0,0,0,0,11,4,0,0,0,0,0,0,
-0,0,240,63,12,7,0,3,108,101,110,0,13,6,7,0,
-15,7,3,0,31,5,7,1,19,5,6,5,25,4,4,5,
-21,4,0,0,18,0,0,32,30,12,2,221,9,9,9,114,
-101,116,117,114,110,32,84,111,107,101,110,40,116,111,107,46,
-112,111,115,44,39,115,116,97,116,101,109,101,110,116,115,39,
-44,39,59,39,44,105,116,101,109,115,41,0,12,6,0,5,
-84,111,107,101,110,0,0,0,13,5,6,0,12,10,0,3,
-112,111,115,0,9,6,2,10,12,7,0,10,115,116,97,116,
-101,109,101,110,116,115,0,0,12,8,0,1,59,0,0,0,
-15,9,3,0,31,4,6,4,19,4,5,4,20,4,0,0,
-18,0,0,1,30,6,2,222,9,9,114,101,116,117,114,110,
-32,105,116,101,109,115,46,112,111,112,40,41,0,0,0,0,
-12,6,0,3,112,111,112,0,9,5,3,6,31,4,0,0,
-19,4,5,4,20,4,0,0,0,0,0,0,12,66,0,9,
-100,111,95,109,111,100,117,108,101,0,0,0,10,7,66,65,
-16,66,0,48,44,7,0,0,30,5,2,226,9,100,101,102,
+12,9,0,4,103,109,97,112,0,0,0,0,49,5,1,9,
+15,7,2,0,12,9,0,4,116,121,112,101,0,0,0,0,
+9,8,2,9,50,4,5,2,15,3,4,0,18,0,0,1,
+30,4,2,219,9,9,109,101,114,103,101,40,116,44,114,41,
+0,0,0,0,12,6,0,5,109,101,114,103,101,0,0,0,
+13,5,6,0,15,6,2,0,15,7,3,0,31,4,6,2,
+19,4,5,4,30,3,2,220,9,9,114,101,116,117,114,110,
+32,116,0,0,20,2,0,0,0,0,0,0,12,66,0,2,
+100,111,0,0,10,8,66,65,16,66,0,129,44,11,0,0,
+30,6,2,223,9,100,101,102,32,100,111,95,109,111,100,117,
+108,101,40,115,101,108,102,41,58,0,0,0,12,1,0,9,
+116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
+12,1,0,9,100,111,95,109,111,100,117,108,101,0,0,0,
+34,1,0,0,28,2,0,0,9,1,0,2,30,5,2,224,
+9,9,116,111,107,32,61,32,115,101,108,102,46,116,111,107,
+101,110,0,0,12,4,0,5,116,111,107,101,110,0,0,0,
+9,3,1,4,15,2,3,0,30,4,2,225,9,9,105,116,
+101,109,115,32,61,32,91,93,0,0,0,0,27,4,0,0,
+15,3,4,0,30,6,2,226,9,9,115,101,108,102,46,105,
+98,108,111,99,107,40,105,116,101,109,115,41,0,0,0,0,
+12,8,0,6,105,98,108,111,99,107,0,0,49,5,1,8,
+15,7,3,0,50,4,5,1,30,6,2,227,9,9,115,101,
+108,102,46,97,100,118,97,110,99,101,40,39,101,111,102,39,
+41,0,0,0,12,8,0,7,97,100,118,97,110,99,101,0,
+49,5,1,8,12,7,0,3,101,111,102,0,50,4,5,1,
+30,6,2,228,9,9,105,102,32,108,101,110,40,105,116,101,
+109,115,41,32,62,32,49,58,0,0,0,0,11,4,0,1,
+1,0,0,0,0,0,0,0,12,7,0,3,108,101,110,0,
+13,6,7,0,15,7,3,0,31,5,7,1,19,5,6,5,
+25,4,4,5,21,4,0,0,18,0,0,32,30,12,2,229,
+9,9,9,114,101,116,117,114,110,32,84,111,107,101,110,40,
+116,111,107,46,112,111,115,44,39,115,116,97,116,101,109,101,
+110,116,115,39,44,39,59,39,44,105,116,101,109,115,41,0,
+12,6,0,5,84,111,107,101,110,0,0,0,13,5,6,0,
+12,10,0,3,112,111,115,0,9,6,2,10,12,7,0,10,
+115,116,97,116,101,109,101,110,116,115,0,0,12,8,0,1,
+59,0,0,0,15,9,3,0,31,4,6,4,19,4,5,4,
+20,4,0,0,18,0,0,1,30,6,2,230,9,9,114,101,
+116,117,114,110,32,105,116,101,109,115,46,112,111,112,40,41,
+0,0,0,0,12,7,0,3,112,111,112,0,49,5,3,7,
+50,4,5,0,20,4,0,0,0,0,0,0,12,67,0,9,
+100,111,95,109,111,100,117,108,101,0,0,0,10,8,67,66,
+16,67,0,48,44,7,0,0,30,5,2,234,9,100,101,102,
 32,99,112,121,40,115,101,108,102,44,100,41,58,0,0,0,
 12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
 33,1,0,0,12,1,0,3,99,112,121,0,34,1,0,0,
 28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-30,3,2,227,9,9,114,32,61,32,123,125,0,0,0,0,
-26,4,0,0,15,3,4,0,30,7,2,228,9,9,102,111,
+30,3,2,235,9,9,114,32,61,32,123,125,0,0,0,0,
+26,4,0,0,15,3,4,0,30,7,2,236,9,9,102,111,
 114,32,107,32,105,110,32,100,58,32,114,91,107,93,32,61,
-32,100,91,107,93,0,0,0,11,5,0,0,0,0,0,0,
+32,100,91,107,93,0,0,0,11,5,0,1,0,0,0,0,
 0,0,0,0,42,4,2,5,18,0,0,4,9,6,2,4,
-10,3,4,6,18,0,255,252,30,3,2,229,9,9,114,101,
+10,3,4,6,18,0,255,252,30,3,2,237,9,9,114,101,
 116,117,114,110,32,114,0,0,20,3,0,0,0,0,0,0,
-12,67,0,3,99,112,121,0,10,7,67,66,16,67,0,207,
-44,9,0,0,30,8,2,232,9,100,101,102,32,100,111,80,
+12,68,0,3,99,112,121,0,10,8,68,67,16,68,0,202,
+44,10,0,0,30,8,2,240,9,100,101,102,32,100,111,80,
 97,114,115,101,40,115,101,108,102,44,115,44,116,111,107,101,
 110,115,41,58,0,0,0,0,12,1,0,9,116,105,110,121,
 112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,7,
 100,111,80,97,114,115,101,0,34,1,0,0,28,2,0,0,
 9,1,0,2,28,3,0,0,9,2,0,3,28,4,0,0,
-9,3,0,4,30,6,2,233,9,9,116,111,107,101,110,105,
+9,3,0,4,30,6,2,241,9,9,116,111,107,101,110,105,
 122,101,114,61,84,111,107,101,110,105,122,101,114,40,41,0,
 12,7,0,9,84,111,107,101,110,105,122,101,114,0,0,0,
 13,6,7,0,31,5,0,0,19,5,6,5,15,4,5,0,
-30,7,2,234,9,9,115,32,61,32,116,111,107,101,110,105,
+30,7,2,242,9,9,115,32,61,32,116,111,107,101,110,105,
 122,101,114,46,99,108,101,97,110,40,115,41,0,0,0,0,
-12,7,0,5,99,108,101,97,110,0,0,0,9,6,4,7,
-15,7,2,0,31,5,7,1,19,5,6,5,15,2,5,0,
-30,4,2,236,9,9,115,101,108,102,46,115,32,61,32,115,
-0,0,0,0,12,5,0,1,115,0,0,0,10,1,5,2,
-30,6,2,237,9,9,115,101,108,102,46,116,111,107,101,110,
-115,32,61,32,116,111,107,101,110,115,0,0,12,5,0,6,
-116,111,107,101,110,115,0,0,10,1,5,3,30,4,2,238,
-9,9,115,101,108,102,46,112,111,115,32,61,32,48,0,0,
-11,5,0,0,0,0,0,0,0,0,0,0,12,6,0,3,
-112,111,115,0,10,1,6,5,30,5,2,239,9,9,115,101,
-108,102,46,116,111,107,101,110,32,61,32,78,111,110,101,0,
-28,5,0,0,12,6,0,5,116,111,107,101,110,0,0,0,
-10,1,6,5,30,5,2,240,9,9,115,101,108,102,46,115,
-116,97,99,107,32,61,32,91,93,0,0,0,27,5,0,0,
-12,6,0,5,115,116,97,99,107,0,0,0,10,1,6,5,
-30,6,2,241,9,9,115,101,108,102,46,95,116,101,114,109,
-105,110,97,108,32,61,32,48,0,0,0,0,11,5,0,0,
-0,0,0,0,0,0,0,0,12,6,0,9,95,116,101,114,
-109,105,110,97,108,0,0,0,10,1,6,5,30,10,2,243,
-9,9,115,101,108,102,46,111,109,97,112,32,61,32,115,101,
-108,102,46,99,112,121,40,115,101,108,102,46,98,97,115,101,
-95,100,109,97,112,41,0,0,12,7,0,3,99,112,121,0,
-9,6,1,7,12,8,0,9,98,97,115,101,95,100,109,97,
-112,0,0,0,9,7,1,8,31,5,7,1,19,5,6,5,
-12,6,0,4,111,109,97,112,0,0,0,0,10,1,6,5,
-30,10,2,244,9,9,115,101,108,102,46,100,109,97,112,32,
-61,32,115,101,108,102,46,99,112,121,40,115,101,108,102,46,
-98,97,115,101,95,100,109,97,112,41,0,0,12,7,0,3,
-99,112,121,0,9,6,1,7,12,8,0,9,98,97,115,101,
-95,100,109,97,112,0,0,0,9,7,1,8,31,5,7,1,
-19,5,6,5,12,6,0,4,100,109,97,112,0,0,0,0,
-10,1,6,5,30,5,2,245,9,9,115,101,108,102,46,97,
-100,118,97,110,99,101,40,41,0,0,0,0,12,7,0,7,
-97,100,118,97,110,99,101,0,9,6,1,7,31,5,0,0,
-19,5,6,5,30,6,2,247,9,9,114,32,61,32,115,101,
+12,9,0,5,99,108,101,97,110,0,0,0,49,6,4,9,
+15,8,2,0,50,5,6,1,15,2,5,0,30,4,2,244,
+9,9,115,101,108,102,46,115,32,61,32,115,0,0,0,0,
+12,5,0,1,115,0,0,0,10,1,5,2,30,6,2,245,
+9,9,115,101,108,102,46,116,111,107,101,110,115,32,61,32,
+116,111,107,101,110,115,0,0,12,5,0,6,116,111,107,101,
+110,115,0,0,10,1,5,3,30,4,2,246,9,9,115,101,
+108,102,46,112,111,115,32,61,32,48,0,0,11,5,0,1,
+0,0,0,0,0,0,0,0,12,6,0,3,112,111,115,0,
+10,1,6,5,30,5,2,247,9,9,115,101,108,102,46,116,
+111,107,101,110,32,61,32,78,111,110,101,0,28,5,0,0,
+12,6,0,5,116,111,107,101,110,0,0,0,10,1,6,5,
+30,5,2,248,9,9,115,101,108,102,46,115,116,97,99,107,
+32,61,32,91,93,0,0,0,27,5,0,0,12,6,0,5,
+115,116,97,99,107,0,0,0,10,1,6,5,30,6,2,249,
+9,9,115,101,108,102,46,95,116,101,114,109,105,110,97,108,
+32,61,32,48,0,0,0,0,11,5,0,1,0,0,0,0,
+0,0,0,0,12,6,0,9,95,116,101,114,109,105,110,97,
+108,0,0,0,10,1,6,5,30,10,2,251,9,9,115,101,
+108,102,46,111,109,97,112,32,61,32,115,101,108,102,46,99,
+112,121,40,115,101,108,102,46,98,97,115,101,95,100,109,97,
+112,41,0,0,12,9,0,3,99,112,121,0,49,6,1,9,
+12,9,0,9,98,97,115,101,95,100,109,97,112,0,0,0,
+9,8,1,9,50,5,6,1,12,6,0,4,111,109,97,112,
+0,0,0,0,10,1,6,5,30,10,2,252,9,9,115,101,
+108,102,46,100,109,97,112,32,61,32,115,101,108,102,46,99,
+112,121,40,115,101,108,102,46,98,97,115,101,95,100,109,97,
+112,41,0,0,12,9,0,3,99,112,121,0,49,6,1,9,
+12,9,0,9,98,97,115,101,95,100,109,97,112,0,0,0,
+9,8,1,9,50,5,6,1,12,6,0,4,100,109,97,112,
+0,0,0,0,10,1,6,5,30,5,2,253,9,9,115,101,
+108,102,46,97,100,118,97,110,99,101,40,41,0,0,0,0,
+12,8,0,7,97,100,118,97,110,99,101,0,49,6,1,8,
+50,5,6,0,30,6,2,255,9,9,114,32,61,32,115,101,
 108,102,46,100,111,95,109,111,100,117,108,101,40,41,0,0,
-12,8,0,9,100,111,95,109,111,100,117,108,101,0,0,0,
-9,7,1,8,31,6,0,0,19,6,7,6,15,5,6,0,
-30,3,2,248,9,9,114,101,116,117,114,110,32,114,0,0,
-20,5,0,0,0,0,0,0,12,68,0,7,100,111,80,97,
-114,115,101,0,10,7,68,67,30,4,2,251,99,108,97,115,
-115,32,69,110,99,111,100,101,114,58,0,0,26,7,0,0,
-12,68,0,7,69,110,99,111,100,101,114,0,14,68,7,0,
-12,70,0,7,115,101,116,109,101,116,97,0,13,69,70,0,
-15,70,7,0,12,72,0,6,111,98,106,101,99,116,0,0,
-13,71,72,0,31,68,70,2,19,68,69,68,16,68,1,233,
-44,38,0,0,30,6,2,254,9,100,101,102,32,95,95,105,
-110,105,116,95,95,40,115,101,108,102,41,58,0,0,0,0,
-12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
-33,1,0,0,12,1,0,8,95,95,105,110,105,116,95,95,
-0,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
-30,4,3,0,9,9,115,101,108,102,46,102,109,97,112,32,
-61,32,123,0,30,7,3,1,9,9,9,39,109,111,100,117,
-108,101,39,58,115,101,108,102,46,100,111,95,109,111,100,117,
-108,101,44,0,12,3,0,6,109,111,100,117,108,101,0,0,
-12,37,0,9,100,111,95,109,111,100,117,108,101,0,0,0,
-9,4,1,37,30,9,3,2,9,9,9,39,115,116,97,116,
-101,109,101,110,116,115,39,58,115,101,108,102,46,100,111,95,
-115,116,97,116,101,109,101,110,116,115,44,0,12,5,0,10,
-115,116,97,116,101,109,101,110,116,115,0,0,12,37,0,13,
-100,111,95,115,116,97,116,101,109,101,110,116,115,0,0,0,
-9,6,1,37,30,6,3,3,9,9,9,39,100,101,102,39,
-58,115,101,108,102,46,100,111,95,100,101,102,44,0,0,0,
-12,7,0,3,100,101,102,0,12,37,0,6,100,111,95,100,
-101,102,0,0,9,8,1,37,30,7,3,4,9,9,9,39,
-114,101,116,117,114,110,39,58,115,101,108,102,46,100,111,95,
-114,101,116,117,114,110,44,0,12,9,0,6,114,101,116,117,
-114,110,0,0,12,37,0,9,100,111,95,114,101,116,117,114,
-110,0,0,0,9,10,1,37,30,7,3,5,9,9,9,39,
-119,104,105,108,101,39,58,115,101,108,102,46,100,111,95,119,
-104,105,108,101,44,0,0,0,12,11,0,5,119,104,105,108,
-101,0,0,0,12,37,0,8,100,111,95,119,104,105,108,101,
-0,0,0,0,9,12,1,37,30,5,3,6,9,9,9,39,
-105,102,39,58,115,101,108,102,46,100,111,95,105,102,44,0,
-12,13,0,2,105,102,0,0,12,37,0,5,100,111,95,105,
-102,0,0,0,9,14,1,37,30,7,3,7,9,9,9,39,
-98,114,101,97,107,39,58,115,101,108,102,46,100,111,95,98,
-114,101,97,107,44,0,0,0,12,15,0,5,98,114,101,97,
-107,0,0,0,12,37,0,8,100,111,95,98,114,101,97,107,
-0,0,0,0,9,16,1,37,30,6,3,8,9,9,9,39,
-112,97,115,115,39,58,115,101,108,102,46,100,111,95,112,97,
-115,115,44,0,12,17,0,4,112,97,115,115,0,0,0,0,
-12,37,0,7,100,111,95,112,97,115,115,0,9,18,1,37,
-30,8,3,9,9,9,9,39,99,111,110,116,105,110,117,101,
-39,58,115,101,108,102,46,100,111,95,99,111,110,116,105,110,
-117,101,44,0,12,19,0,8,99,111,110,116,105,110,117,101,
-0,0,0,0,12,37,0,11,100,111,95,99,111,110,116,105,
-110,117,101,0,9,20,1,37,30,6,3,10,9,9,9,39,
-102,111,114,39,58,115,101,108,102,46,100,111,95,102,111,114,
-44,0,0,0,12,21,0,3,102,111,114,0,12,37,0,6,
-100,111,95,102,111,114,0,0,9,22,1,37,30,7,3,11,
-9,9,9,39,99,108,97,115,115,39,58,115,101,108,102,46,
-100,111,95,99,108,97,115,115,44,0,0,0,12,23,0,5,
-99,108,97,115,115,0,0,0,12,37,0,8,100,111,95,99,
-108,97,115,115,0,0,0,0,9,24,1,37,30,7,3,12,
-9,9,9,39,114,97,105,115,101,39,58,115,101,108,102,46,
-100,111,95,114,97,105,115,101,44,0,0,0,12,25,0,5,
-114,97,105,115,101,0,0,0,12,37,0,8,100,111,95,114,
-97,105,115,101,0,0,0,0,9,26,1,37,30,6,3,13,
-9,9,9,39,116,114,121,39,58,115,101,108,102,46,100,111,
-95,116,114,121,44,0,0,0,12,27,0,3,116,114,121,0,
-12,37,0,6,100,111,95,116,114,121,0,0,9,28,1,37,
-30,7,3,14,9,9,9,39,105,109,112,111,114,116,39,58,
-115,101,108,102,46,100,111,95,105,109,112,111,114,116,44,0,
-12,29,0,6,105,109,112,111,114,116,0,0,12,37,0,9,
-100,111,95,105,109,112,111,114,116,0,0,0,9,30,1,37,
-30,8,3,15,9,9,9,39,103,108,111,98,97,108,115,39,
-58,115,101,108,102,46,100,111,95,103,108,111,98,97,108,115,
-44,0,0,0,12,31,0,7,103,108,111,98,97,108,115,0,
-12,37,0,10,100,111,95,103,108,111,98,97,108,115,0,0,
-9,32,1,37,30,6,3,16,9,9,9,39,100,101,108,39,
-58,115,101,108,102,46,100,111,95,100,101,108,44,0,0,0,
-12,33,0,3,100,101,108,0,12,37,0,6,100,111,95,100,
-101,108,0,0,9,34,1,37,30,6,3,17,9,9,9,39,
-102,114,111,109,39,58,115,101,108,102,46,100,111,95,102,114,
-111,109,44,0,12,35,0,4,102,114,111,109,0,0,0,0,
-12,37,0,7,100,111,95,102,114,111,109,0,9,36,1,37,
-26,2,3,34,30,4,3,0,9,9,115,101,108,102,46,102,
-109,97,112,32,61,32,123,0,12,3,0,4,102,109,97,112,
-0,0,0,0,10,1,3,2,30,4,3,20,9,9,115,101,
-108,102,46,114,109,97,112,32,61,32,123,0,30,7,3,21,
-9,9,9,39,108,105,115,116,39,58,115,101,108,102,46,100,
-111,95,108,105,115,116,44,32,0,0,0,0,12,3,0,4,
-108,105,115,116,0,0,0,0,12,27,0,7,100,111,95,108,
-105,115,116,0,9,4,1,27,30,7,3,22,9,9,9,39,
-116,117,112,108,101,39,58,115,101,108,102,46,100,111,95,108,
-105,115,116,44,32,0,0,0,12,5,0,5,116,117,112,108,
-101,0,0,0,12,27,0,7,100,111,95,108,105,115,116,0,
-9,6,1,27,30,7,3,23,9,9,9,39,100,105,99,116,
-39,58,115,101,108,102,46,100,111,95,100,105,99,116,44,32,
-0,0,0,0,12,7,0,4,100,105,99,116,0,0,0,0,
-12,27,0,7,100,111,95,100,105,99,116,0,9,8,1,27,
-30,7,3,24,9,9,9,39,115,108,105,99,101,39,58,115,
-101,108,102,46,100,111,95,108,105,115,116,44,0,0,0,0,
-12,9,0,5,115,108,105,99,101,0,0,0,12,27,0,7,
-100,111,95,108,105,115,116,0,9,10,1,27,30,7,3,25,
-9,9,9,39,99,111,109,112,39,58,115,101,108,102,46,100,
-111,95,99,111,109,112,44,32,0,0,0,0,12,11,0,4,
-99,111,109,112,0,0,0,0,12,27,0,7,100,111,95,99,
-111,109,112,0,9,12,1,27,30,6,3,26,9,9,9,39,
-110,97,109,101,39,58,115,101,108,102,46,100,111,95,110,97,
-109,101,44,0,12,13,0,4,110,97,109,101,0,0,0,0,
-12,27,0,7,100,111,95,110,97,109,101,0,9,14,1,27,
-30,7,3,27,9,9,9,39,115,121,109,98,111,108,39,58,
-115,101,108,102,46,100,111,95,115,121,109,98,111,108,44,0,
-12,15,0,6,115,121,109,98,111,108,0,0,12,27,0,9,
-100,111,95,115,121,109,98,111,108,0,0,0,9,16,1,27,
-30,7,3,28,9,9,9,39,110,117,109,98,101,114,39,58,
-115,101,108,102,46,100,111,95,110,117,109,98,101,114,44,0,
-12,17,0,6,110,117,109,98,101,114,0,0,12,27,0,9,
-100,111,95,110,117,109,98,101,114,0,0,0,9,18,1,27,
-30,7,3,29,9,9,9,39,115,116,114,105,110,103,39,58,
-115,101,108,102,46,100,111,95,115,116,114,105,110,103,44,0,
-12,19,0,6,115,116,114,105,110,103,0,0,12,27,0,9,
-100,111,95,115,116,114,105,110,103,0,0,0,9,20,1,27,
-30,6,3,30,9,9,9,39,103,101,116,39,58,115,101,108,
-102,46,100,111,95,103,101,116,44,32,0,0,12,21,0,3,
-103,101,116,0,12,27,0,6,100,111,95,103,101,116,0,0,
-9,22,1,27,30,7,3,31,9,9,9,39,99,97,108,108,
-39,58,115,101,108,102,46,100,111,95,99,97,108,108,44,32,
-0,0,0,0,12,23,0,4,99,97,108,108,0,0,0,0,
-12,27,0,7,100,111,95,99,97,108,108,0,9,24,1,27,
-30,6,3,32,9,9,9,39,114,101,103,39,58,115,101,108,
-102,46,100,111,95,114,101,103,44,0,0,0,12,25,0,3,
-114,101,103,0,12,27,0,6,100,111,95,114,101,103,0,0,
-9,26,1,27,26,2,3,24,30,4,3,20,9,9,115,101,
-108,102,46,114,109,97,112,32,61,32,123,0,12,3,0,4,
-114,109,97,112,0,0,0,0,10,1,3,2,0,0,0,0,
-12,69,0,8,95,95,105,110,105,116,95,95,0,0,0,0,
-10,7,69,68,16,69,0,42,44,6,0,0,30,6,3,37,
-9,100,101,102,32,105,110,115,101,114,116,40,115,101,108,102,
-44,118,41,58,32,0,0,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,6,
-105,110,115,101,114,116,0,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,30,5,3,38,
-9,9,68,46,111,117,116,46,97,112,112,101,110,100,40,118,
-41,0,0,0,12,5,0,1,68,0,0,0,13,4,5,0,
-12,5,0,3,111,117,116,0,9,4,4,5,12,5,0,6,
-97,112,112,101,110,100,0,0,9,4,4,5,15,5,2,0,
-31,3,5,1,19,3,4,3,0,0,0,0,12,70,0,6,
-105,110,115,101,114,116,0,0,10,7,70,69,16,70,1,168,
-44,19,0,0,30,7,3,41,9,100,101,102,32,98,101,103,
-105,110,40,115,101,108,102,44,103,98,108,61,70,97,108,115,
-101,41,58,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,5,98,101,103,105,
-110,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
-11,2,0,0,0,0,0,0,0,0,0,0,28,3,0,0,
-32,2,0,3,30,5,3,42,9,9,105,102,32,108,101,110,
-40,68,46,115,116,97,99,107,41,58,32,0,12,5,0,3,
-108,101,110,0,13,4,5,0,12,6,0,1,68,0,0,0,
-13,5,6,0,12,6,0,5,115,116,97,99,107,0,0,0,
-9,5,5,6,31,3,5,1,19,3,4,3,21,3,0,0,
-18,0,0,131,30,30,3,43,9,9,9,68,46,115,116,97,
-99,107,46,97,112,112,101,110,100,40,40,68,46,118,97,114,
-115,44,68,46,114,50,110,44,68,46,110,50,114,44,68,46,
-95,116,109,112,105,44,68,46,109,114,101,103,44,68,46,115,
-110,117,109,44,68,46,95,103,108,111,98,97,108,115,44,68,
-46,108,105,110,101,110,111,44,68,46,103,108,111,98,97,108,
-115,44,68,46,114,103,108,111,98,97,108,115,44,68,46,99,
-114,101,103,115,44,68,46,116,109,112,99,41,41,0,0,0,
-12,5,0,1,68,0,0,0,13,4,5,0,12,5,0,5,
-115,116,97,99,107,0,0,0,9,4,4,5,12,5,0,6,
-97,112,112,101,110,100,0,0,9,4,4,5,12,18,0,1,
-68,0,0,0,13,6,18,0,12,18,0,4,118,97,114,115,
-0,0,0,0,9,6,6,18,12,18,0,1,68,0,0,0,
-13,7,18,0,12,18,0,3,114,50,110,0,9,7,7,18,
-12,18,0,1,68,0,0,0,13,8,18,0,12,18,0,3,
-110,50,114,0,9,8,8,18,12,18,0,1,68,0,0,0,
-13,9,18,0,12,18,0,5,95,116,109,112,105,0,0,0,
-9,9,9,18,12,18,0,1,68,0,0,0,13,10,18,0,
-12,18,0,4,109,114,101,103,0,0,0,0,9,10,10,18,
-12,18,0,1,68,0,0,0,13,11,18,0,12,18,0,4,
-115,110,117,109,0,0,0,0,9,11,11,18,12,18,0,1,
-68,0,0,0,13,12,18,0,12,18,0,8,95,103,108,111,
-98,97,108,115,0,0,0,0,9,12,12,18,12,18,0,1,
-68,0,0,0,13,13,18,0,12,18,0,6,108,105,110,101,
-110,111,0,0,9,13,13,18,12,18,0,1,68,0,0,0,
-13,14,18,0,12,18,0,7,103,108,111,98,97,108,115,0,
-9,14,14,18,12,18,0,1,68,0,0,0,13,15,18,0,
-12,18,0,8,114,103,108,111,98,97,108,115,0,0,0,0,
-9,15,15,18,12,18,0,1,68,0,0,0,13,16,18,0,
-12,18,0,5,99,114,101,103,115,0,0,0,9,16,16,18,
-12,18,0,1,68,0,0,0,13,17,18,0,12,18,0,4,
-116,109,112,99,0,0,0,0,9,17,17,18,27,5,6,12,
-31,3,5,1,19,3,4,3,18,0,0,23,30,6,3,45,
+12,9,0,9,100,111,95,109,111,100,117,108,101,0,0,0,
+49,7,1,9,50,6,7,0,15,5,6,0,30,3,3,0,
+9,9,114,101,116,117,114,110,32,114,0,0,20,5,0,0,
+0,0,0,0,12,69,0,7,100,111,80,97,114,115,101,0,
+10,8,69,68,30,4,3,3,99,108,97,115,115,32,69,110,
+99,111,100,101,114,58,0,0,26,8,0,0,12,69,0,7,
+69,110,99,111,100,101,114,0,14,69,8,0,12,71,0,7,
+115,101,116,109,101,116,97,0,13,70,71,0,15,71,8,0,
+12,73,0,6,111,98,106,101,99,116,0,0,13,72,73,0,
+31,69,71,2,19,69,70,69,16,69,1,233,44,38,0,0,
+30,6,3,6,9,100,101,102,32,95,95,105,110,105,116,95,
+95,40,115,101,108,102,41,58,0,0,0,0,12,1,0,9,
+116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
+12,1,0,8,95,95,105,110,105,116,95,95,0,0,0,0,
+34,1,0,0,28,2,0,0,9,1,0,2,30,4,3,8,
+9,9,115,101,108,102,46,102,109,97,112,32,61,32,123,0,
+30,7,3,9,9,9,9,39,109,111,100,117,108,101,39,58,
+115,101,108,102,46,100,111,95,109,111,100,117,108,101,44,0,
+12,3,0,6,109,111,100,117,108,101,0,0,12,37,0,9,
+100,111,95,109,111,100,117,108,101,0,0,0,9,4,1,37,
+30,9,3,10,9,9,9,39,115,116,97,116,101,109,101,110,
+116,115,39,58,115,101,108,102,46,100,111,95,115,116,97,116,
+101,109,101,110,116,115,44,0,12,5,0,10,115,116,97,116,
+101,109,101,110,116,115,0,0,12,37,0,13,100,111,95,115,
+116,97,116,101,109,101,110,116,115,0,0,0,9,6,1,37,
+30,6,3,11,9,9,9,39,100,101,102,39,58,115,101,108,
+102,46,100,111,95,100,101,102,44,0,0,0,12,7,0,3,
+100,101,102,0,12,37,0,6,100,111,95,100,101,102,0,0,
+9,8,1,37,30,7,3,12,9,9,9,39,114,101,116,117,
+114,110,39,58,115,101,108,102,46,100,111,95,114,101,116,117,
+114,110,44,0,12,9,0,6,114,101,116,117,114,110,0,0,
+12,37,0,9,100,111,95,114,101,116,117,114,110,0,0,0,
+9,10,1,37,30,7,3,13,9,9,9,39,119,104,105,108,
+101,39,58,115,101,108,102,46,100,111,95,119,104,105,108,101,
+44,0,0,0,12,11,0,5,119,104,105,108,101,0,0,0,
+12,37,0,8,100,111,95,119,104,105,108,101,0,0,0,0,
+9,12,1,37,30,5,3,14,9,9,9,39,105,102,39,58,
+115,101,108,102,46,100,111,95,105,102,44,0,12,13,0,2,
+105,102,0,0,12,37,0,5,100,111,95,105,102,0,0,0,
+9,14,1,37,30,7,3,15,9,9,9,39,98,114,101,97,
+107,39,58,115,101,108,102,46,100,111,95,98,114,101,97,107,
+44,0,0,0,12,15,0,5,98,114,101,97,107,0,0,0,
+12,37,0,8,100,111,95,98,114,101,97,107,0,0,0,0,
+9,16,1,37,30,6,3,16,9,9,9,39,112,97,115,115,
+39,58,115,101,108,102,46,100,111,95,112,97,115,115,44,0,
+12,17,0,4,112,97,115,115,0,0,0,0,12,37,0,7,
+100,111,95,112,97,115,115,0,9,18,1,37,30,8,3,17,
+9,9,9,39,99,111,110,116,105,110,117,101,39,58,115,101,
+108,102,46,100,111,95,99,111,110,116,105,110,117,101,44,0,
+12,19,0,8,99,111,110,116,105,110,117,101,0,0,0,0,
+12,37,0,11,100,111,95,99,111,110,116,105,110,117,101,0,
+9,20,1,37,30,6,3,18,9,9,9,39,102,111,114,39,
+58,115,101,108,102,46,100,111,95,102,111,114,44,0,0,0,
+12,21,0,3,102,111,114,0,12,37,0,6,100,111,95,102,
+111,114,0,0,9,22,1,37,30,7,3,19,9,9,9,39,
+99,108,97,115,115,39,58,115,101,108,102,46,100,111,95,99,
+108,97,115,115,44,0,0,0,12,23,0,5,99,108,97,115,
+115,0,0,0,12,37,0,8,100,111,95,99,108,97,115,115,
+0,0,0,0,9,24,1,37,30,7,3,20,9,9,9,39,
+114,97,105,115,101,39,58,115,101,108,102,46,100,111,95,114,
+97,105,115,101,44,0,0,0,12,25,0,5,114,97,105,115,
+101,0,0,0,12,37,0,8,100,111,95,114,97,105,115,101,
+0,0,0,0,9,26,1,37,30,6,3,21,9,9,9,39,
+116,114,121,39,58,115,101,108,102,46,100,111,95,116,114,121,
+44,0,0,0,12,27,0,3,116,114,121,0,12,37,0,6,
+100,111,95,116,114,121,0,0,9,28,1,37,30,7,3,22,
+9,9,9,39,105,109,112,111,114,116,39,58,115,101,108,102,
+46,100,111,95,105,109,112,111,114,116,44,0,12,29,0,6,
+105,109,112,111,114,116,0,0,12,37,0,9,100,111,95,105,
+109,112,111,114,116,0,0,0,9,30,1,37,30,8,3,23,
+9,9,9,39,103,108,111,98,97,108,115,39,58,115,101,108,
+102,46,100,111,95,103,108,111,98,97,108,115,44,0,0,0,
+12,31,0,7,103,108,111,98,97,108,115,0,12,37,0,10,
+100,111,95,103,108,111,98,97,108,115,0,0,9,32,1,37,
+30,6,3,24,9,9,9,39,100,101,108,39,58,115,101,108,
+102,46,100,111,95,100,101,108,44,0,0,0,12,33,0,3,
+100,101,108,0,12,37,0,6,100,111,95,100,101,108,0,0,
+9,34,1,37,30,6,3,25,9,9,9,39,102,114,111,109,
+39,58,115,101,108,102,46,100,111,95,102,114,111,109,44,0,
+12,35,0,4,102,114,111,109,0,0,0,0,12,37,0,7,
+100,111,95,102,114,111,109,0,9,36,1,37,26,2,3,34,
+30,4,3,8,9,9,115,101,108,102,46,102,109,97,112,32,
+61,32,123,0,12,3,0,4,102,109,97,112,0,0,0,0,
+10,1,3,2,30,4,3,28,9,9,115,101,108,102,46,114,
+109,97,112,32,61,32,123,0,30,7,3,29,9,9,9,39,
+108,105,115,116,39,58,115,101,108,102,46,100,111,95,108,105,
+115,116,44,32,0,0,0,0,12,3,0,4,108,105,115,116,
+0,0,0,0,12,27,0,7,100,111,95,108,105,115,116,0,
+9,4,1,27,30,7,3,30,9,9,9,39,116,117,112,108,
+101,39,58,115,101,108,102,46,100,111,95,108,105,115,116,44,
+32,0,0,0,12,5,0,5,116,117,112,108,101,0,0,0,
+12,27,0,7,100,111,95,108,105,115,116,0,9,6,1,27,
+30,7,3,31,9,9,9,39,100,105,99,116,39,58,115,101,
+108,102,46,100,111,95,100,105,99,116,44,32,0,0,0,0,
+12,7,0,4,100,105,99,116,0,0,0,0,12,27,0,7,
+100,111,95,100,105,99,116,0,9,8,1,27,30,7,3,32,
+9,9,9,39,115,108,105,99,101,39,58,115,101,108,102,46,
+100,111,95,108,105,115,116,44,0,0,0,0,12,9,0,5,
+115,108,105,99,101,0,0,0,12,27,0,7,100,111,95,108,
+105,115,116,0,9,10,1,27,30,7,3,33,9,9,9,39,
+99,111,109,112,39,58,115,101,108,102,46,100,111,95,99,111,
+109,112,44,32,0,0,0,0,12,11,0,4,99,111,109,112,
+0,0,0,0,12,27,0,7,100,111,95,99,111,109,112,0,
+9,12,1,27,30,6,3,34,9,9,9,39,110,97,109,101,
+39,58,115,101,108,102,46,100,111,95,110,97,109,101,44,0,
+12,13,0,4,110,97,109,101,0,0,0,0,12,27,0,7,
+100,111,95,110,97,109,101,0,9,14,1,27,30,7,3,35,
+9,9,9,39,115,121,109,98,111,108,39,58,115,101,108,102,
+46,100,111,95,115,121,109,98,111,108,44,0,12,15,0,6,
+115,121,109,98,111,108,0,0,12,27,0,9,100,111,95,115,
+121,109,98,111,108,0,0,0,9,16,1,27,30,7,3,36,
+9,9,9,39,110,117,109,98,101,114,39,58,115,101,108,102,
+46,100,111,95,110,117,109,98,101,114,44,0,12,17,0,6,
+110,117,109,98,101,114,0,0,12,27,0,9,100,111,95,110,
+117,109,98,101,114,0,0,0,9,18,1,27,30,7,3,37,
+9,9,9,39,115,116,114,105,110,103,39,58,115,101,108,102,
+46,100,111,95,115,116,114,105,110,103,44,0,12,19,0,6,
+115,116,114,105,110,103,0,0,12,27,0,9,100,111,95,115,
+116,114,105,110,103,0,0,0,9,20,1,27,30,6,3,38,
+9,9,9,39,103,101,116,39,58,115,101,108,102,46,100,111,
+95,103,101,116,44,32,0,0,12,21,0,3,103,101,116,0,
+12,27,0,6,100,111,95,103,101,116,0,0,9,22,1,27,
+30,7,3,39,9,9,9,39,99,97,108,108,39,58,115,101,
+108,102,46,100,111,95,99,97,108,108,44,32,0,0,0,0,
+12,23,0,4,99,97,108,108,0,0,0,0,12,27,0,7,
+100,111,95,99,97,108,108,0,9,24,1,27,30,6,3,40,
+9,9,9,39,114,101,103,39,58,115,101,108,102,46,100,111,
+95,114,101,103,44,0,0,0,12,25,0,3,114,101,103,0,
+12,27,0,6,100,111,95,114,101,103,0,0,9,26,1,27,
+26,2,3,24,30,4,3,28,9,9,115,101,108,102,46,114,
+109,97,112,32,61,32,123,0,12,3,0,4,114,109,97,112,
+0,0,0,0,10,1,3,2,0,0,0,0,12,70,0,8,
+95,95,105,110,105,116,95,95,0,0,0,0,10,8,70,69,
+16,70,0,41,44,9,0,0,30,6,3,45,9,100,101,102,
+32,105,110,115,101,114,116,40,115,101,108,102,44,118,41,58,
+32,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
+121,0,0,0,33,1,0,0,12,1,0,6,105,110,115,101,
+114,116,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
+28,3,0,0,9,2,0,3,30,5,3,46,9,9,68,46,
+111,117,116,46,97,112,112,101,110,100,40,118,41,0,0,0,
+12,8,0,1,68,0,0,0,13,7,8,0,12,8,0,3,
+111,117,116,0,9,7,7,8,12,8,0,6,97,112,112,101,
+110,100,0,0,49,4,7,8,15,6,2,0,50,3,4,1,
+0,0,0,0,12,71,0,6,105,110,115,101,114,116,0,0,
+10,8,71,70,16,71,1,165,44,20,0,0,30,7,3,49,
+9,100,101,102,32,98,101,103,105,110,40,115,101,108,102,44,
+103,98,108,61,70,97,108,115,101,41,58,0,12,1,0,9,
+116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
+12,1,0,5,98,101,103,105,110,0,0,0,34,1,0,0,
+28,2,0,0,9,1,0,2,11,2,0,1,0,0,0,0,
+0,0,0,0,28,3,0,0,32,2,0,3,30,5,3,50,
+9,9,105,102,32,108,101,110,40,68,46,115,116,97,99,107,
+41,58,32,0,12,5,0,3,108,101,110,0,13,4,5,0,
+12,6,0,1,68,0,0,0,13,5,6,0,12,6,0,5,
+115,116,97,99,107,0,0,0,9,5,5,6,31,3,5,1,
+19,3,4,3,21,3,0,0,18,0,0,130,30,30,3,51,
 9,9,9,68,46,115,116,97,99,107,46,97,112,112,101,110,
-100,40,78,111,110,101,41,0,12,5,0,1,68,0,0,0,
-13,4,5,0,12,5,0,5,115,116,97,99,107,0,0,0,
-9,4,4,5,12,5,0,6,97,112,112,101,110,100,0,0,
-9,4,4,5,28,5,0,0,31,3,5,1,19,3,4,3,
-18,0,0,1,30,4,3,47,9,9,68,46,118,97,114,115,
+100,40,40,68,46,118,97,114,115,44,68,46,114,50,110,44,
+68,46,110,50,114,44,68,46,95,116,109,112,105,44,68,46,
+109,114,101,103,44,68,46,115,110,117,109,44,68,46,95,103,
+108,111,98,97,108,115,44,68,46,108,105,110,101,110,111,44,
+68,46,103,108,111,98,97,108,115,44,68,46,114,103,108,111,
+98,97,108,115,44,68,46,99,114,101,103,115,44,68,46,116,
+109,112,99,41,41,0,0,0,12,8,0,1,68,0,0,0,
+13,7,8,0,12,8,0,5,115,116,97,99,107,0,0,0,
+9,7,7,8,12,8,0,6,97,112,112,101,110,100,0,0,
+49,4,7,8,12,19,0,1,68,0,0,0,13,7,19,0,
+12,19,0,4,118,97,114,115,0,0,0,0,9,7,7,19,
+12,19,0,1,68,0,0,0,13,8,19,0,12,19,0,3,
+114,50,110,0,9,8,8,19,12,19,0,1,68,0,0,0,
+13,9,19,0,12,19,0,3,110,50,114,0,9,9,9,19,
+12,19,0,1,68,0,0,0,13,10,19,0,12,19,0,5,
+95,116,109,112,105,0,0,0,9,10,10,19,12,19,0,1,
+68,0,0,0,13,11,19,0,12,19,0,4,109,114,101,103,
+0,0,0,0,9,11,11,19,12,19,0,1,68,0,0,0,
+13,12,19,0,12,19,0,4,115,110,117,109,0,0,0,0,
+9,12,12,19,12,19,0,1,68,0,0,0,13,13,19,0,
+12,19,0,8,95,103,108,111,98,97,108,115,0,0,0,0,
+9,13,13,19,12,19,0,1,68,0,0,0,13,14,19,0,
+12,19,0,6,108,105,110,101,110,111,0,0,9,14,14,19,
+12,19,0,1,68,0,0,0,13,15,19,0,12,19,0,7,
+103,108,111,98,97,108,115,0,9,15,15,19,12,19,0,1,
+68,0,0,0,13,16,19,0,12,19,0,8,114,103,108,111,
+98,97,108,115,0,0,0,0,9,16,16,19,12,19,0,1,
+68,0,0,0,13,17,19,0,12,19,0,5,99,114,101,103,
+115,0,0,0,9,17,17,19,12,19,0,1,68,0,0,0,
+13,18,19,0,12,19,0,4,116,109,112,99,0,0,0,0,
+9,18,18,19,27,6,7,12,50,3,4,1,18,0,0,22,
+30,6,3,53,9,9,9,68,46,115,116,97,99,107,46,97,
+112,112,101,110,100,40,78,111,110,101,41,0,12,8,0,1,
+68,0,0,0,13,7,8,0,12,8,0,5,115,116,97,99,
+107,0,0,0,9,7,7,8,12,8,0,6,97,112,112,101,
+110,100,0,0,49,4,7,8,28,6,0,0,50,3,4,1,
+18,0,0,1,30,4,3,55,9,9,68,46,118,97,114,115,
 61,32,91,93,0,0,0,0,12,4,0,1,68,0,0,0,
 13,3,4,0,27,4,0,0,12,5,0,4,118,97,114,115,
-0,0,0,0,10,3,5,4,30,3,3,48,9,9,68,46,
+0,0,0,0,10,3,5,4,30,3,3,56,9,9,68,46,
 114,50,110,61,32,123,125,0,12,4,0,1,68,0,0,0,
 13,3,4,0,26,4,0,0,12,5,0,3,114,50,110,0,
-10,3,5,4,30,3,3,49,9,9,68,46,110,50,114,61,
+10,3,5,4,30,3,3,57,9,9,68,46,110,50,114,61,
 32,123,125,0,12,4,0,1,68,0,0,0,13,3,4,0,
 26,4,0,0,12,5,0,3,110,50,114,0,10,3,5,4,
-30,4,3,50,9,9,68,46,95,116,109,112,105,61,32,48,
+30,4,3,58,9,9,68,46,95,116,109,112,105,61,32,48,
 0,0,0,0,12,4,0,1,68,0,0,0,13,3,4,0,
-11,4,0,0,0,0,0,0,0,0,0,0,12,5,0,5,
-95,116,109,112,105,0,0,0,10,3,5,4,30,3,3,51,
+11,4,0,1,0,0,0,0,0,0,0,0,12,5,0,5,
+95,116,109,112,105,0,0,0,10,3,5,4,30,3,3,59,
 9,9,68,46,109,114,101,103,61,32,48,0,12,4,0,1,
-68,0,0,0,13,3,4,0,11,4,0,0,0,0,0,0,
+68,0,0,0,13,3,4,0,11,4,0,1,0,0,0,0,
 0,0,0,0,12,5,0,4,109,114,101,103,0,0,0,0,
-10,3,5,4,30,7,3,52,9,9,68,46,115,110,117,109,
+10,3,5,4,30,7,3,60,9,9,68,46,115,110,117,109,
 61,32,115,116,114,40,68,46,95,115,99,111,112,101,105,41,
 0,0,0,0,12,4,0,1,68,0,0,0,13,3,4,0,
 12,6,0,3,115,116,114,0,13,5,6,0,12,7,0,1,
 68,0,0,0,13,6,7,0,12,7,0,7,95,115,99,111,
 112,101,105,0,9,6,6,7,31,4,6,1,19,4,5,4,
 12,5,0,4,115,110,117,109,0,0,0,0,10,3,5,4,
-30,5,3,53,9,9,68,46,95,103,108,111,98,97,108,115,
+30,5,3,61,9,9,68,46,95,103,108,111,98,97,108,115,
 61,32,103,98,108,0,0,0,12,4,0,1,68,0,0,0,
 13,3,4,0,12,4,0,8,95,103,108,111,98,97,108,115,
-0,0,0,0,10,3,4,2,30,4,3,54,9,9,68,46,
+0,0,0,0,10,3,4,2,30,4,3,62,9,9,68,46,
 108,105,110,101,110,111,61,32,45,49,0,0,12,4,0,1,
 68,0,0,0,13,3,4,0,11,4,0,0,0,0,0,0,
 0,0,240,191,12,5,0,6,108,105,110,101,110,111,0,0,
-10,3,5,4,30,4,3,55,9,9,68,46,103,108,111,98,
+10,3,5,4,30,4,3,63,9,9,68,46,103,108,111,98,
 97,108,115,61,32,91,93,0,12,4,0,1,68,0,0,0,
 13,3,4,0,27,4,0,0,12,5,0,7,103,108,111,98,
-97,108,115,0,10,3,5,4,30,5,3,56,9,9,68,46,
+97,108,115,0,10,3,5,4,30,5,3,64,9,9,68,46,
 114,103,108,111,98,97,108,115,61,32,91,93,0,0,0,0,
 12,4,0,1,68,0,0,0,13,3,4,0,27,4,0,0,
 12,5,0,8,114,103,108,111,98,97,108,115,0,0,0,0,
-10,3,5,4,30,6,3,57,9,9,68,46,99,114,101,103,
+10,3,5,4,30,6,3,65,9,9,68,46,99,114,101,103,
 115,32,61,32,91,39,114,101,103,115,39,93,0,0,0,0,
 12,4,0,1,68,0,0,0,13,3,4,0,12,5,0,4,
 114,101,103,115,0,0,0,0,27,4,5,1,12,5,0,5,
-99,114,101,103,115,0,0,0,10,3,5,4,30,4,3,58,
+99,114,101,103,115,0,0,0,10,3,5,4,30,4,3,66,
 9,9,68,46,116,109,112,99,32,61,32,48,0,0,0,0,
-12,4,0,1,68,0,0,0,13,3,4,0,11,4,0,0,
+12,4,0,1,68,0,0,0,13,3,4,0,11,4,0,1,
 0,0,0,0,0,0,0,0,12,5,0,4,116,109,112,99,
-0,0,0,0,10,3,5,4,30,5,3,59,9,9,68,46,
+0,0,0,0,10,3,5,4,30,5,3,67,9,9,68,46,
 95,115,99,111,112,101,105,32,43,61,32,49,0,0,0,0,
 12,4,0,1,68,0,0,0,13,3,4,0,12,5,0,1,
 68,0,0,0,13,4,5,0,12,5,0,7,95,115,99,111,
-112,101,105,0,9,4,4,5,11,5,0,0,0,0,0,0,
-0,0,240,63,1,4,4,5,12,5,0,7,95,115,99,111,
-112,101,105,0,10,3,5,4,30,6,3,60,9,9,115,101,
+112,101,105,0,9,4,4,5,11,5,0,1,1,0,0,0,
+0,0,0,0,1,4,4,5,12,5,0,7,95,115,99,111,
+112,101,105,0,10,3,5,4,30,6,3,68,9,9,115,101,
 108,102,46,105,110,115,101,114,116,40,68,46,99,114,101,103,
-115,41,0,0,12,5,0,6,105,110,115,101,114,116,0,0,
-9,4,1,5,12,6,0,1,68,0,0,0,13,5,6,0,
-12,6,0,5,99,114,101,103,115,0,0,0,9,5,5,6,
-31,3,5,1,19,3,4,3,0,0,0,0,12,71,0,5,
-98,101,103,105,110,0,0,0,10,7,71,70,16,71,1,82,
-44,7,0,0,30,4,3,63,9,100,101,102,32,101,110,100,
-40,115,101,108,102,41,58,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,3,
-101,110,100,0,34,1,0,0,28,2,0,0,9,1,0,2,
-30,7,3,64,9,9,68,46,99,114,101,103,115,46,97,112,
-112,101,110,100,40,68,46,109,114,101,103,41,0,0,0,0,
-12,4,0,1,68,0,0,0,13,3,4,0,12,4,0,5,
-99,114,101,103,115,0,0,0,9,3,3,4,12,4,0,6,
-97,112,112,101,110,100,0,0,9,3,3,4,12,5,0,1,
-68,0,0,0,13,4,5,0,12,5,0,4,109,114,101,103,
-0,0,0,0,9,4,4,5,31,2,4,1,19,2,3,2,
-30,6,3,65,9,9,115,101,108,102,46,100,111,95,99,111,
-100,101,40,79,80,95,69,79,70,41,0,0,12,4,0,7,
-100,111,95,99,111,100,101,0,9,3,1,4,12,5,0,6,
-79,80,95,69,79,70,0,0,13,4,5,0,31,2,4,1,
-19,2,3,2,30,5,3,67,9,9,105,102,32,68,46,116,
-109,112,99,32,33,61,32,48,58,0,0,0,12,3,0,1,
-68,0,0,0,13,2,3,0,12,3,0,4,116,109,112,99,
-0,0,0,0,9,2,2,3,11,3,0,0,0,0,0,0,
-0,0,0,0,35,2,2,3,21,2,0,0,18,0,0,37,
-30,15,3,68,9,9,9,112,114,105,110,116,40,34,87,97,
-114,110,105,110,103,58,92,110,101,110,99,111,100,101,46,112,
-121,32,99,111,110,116,97,105,110,115,32,97,32,114,101,103,
-105,115,116,101,114,32,108,101,97,107,92,110,34,41,0,0,
-12,4,0,5,112,114,105,110,116,0,0,0,13,3,4,0,
-12,4,0,44,87,97,114,110,105,110,103,58,10,101,110,99,
-111,100,101,46,112,121,32,99,111,110,116,97,105,110,115,32,
-97,32,114,101,103,105,115,116,101,114,32,108,101,97,107,10,
-0,0,0,0,31,2,4,1,19,2,3,2,18,0,0,1,
-30,6,3,70,9,9,105,102,32,108,101,110,40,68,46,115,
-116,97,99,107,41,32,62,32,49,58,0,0,11,2,0,0,
-0,0,0,0,0,0,240,63,12,5,0,3,108,101,110,0,
-13,4,5,0,12,6,0,1,68,0,0,0,13,5,6,0,
-12,6,0,5,115,116,97,99,107,0,0,0,9,5,5,6,
-31,3,5,1,19,3,4,3,25,2,2,3,21,2,0,0,
-18,0,0,176,30,29,3,71,9,9,9,68,46,118,97,114,
-115,44,68,46,114,50,110,44,68,46,110,50,114,44,68,46,
-95,116,109,112,105,44,68,46,109,114,101,103,44,68,46,115,
-110,117,109,44,68,46,95,103,108,111,98,97,108,115,44,68,
-46,108,105,110,101,110,111,44,68,46,103,108,111,98,97,108,
-115,44,68,46,114,103,108,111,98,97,108,115,44,68,46,99,
-114,101,103,115,44,68,46,116,109,112,99,32,61,32,68,46,
-115,116,97,99,107,46,112,111,112,40,41,0,12,4,0,1,
-68,0,0,0,13,3,4,0,12,4,0,5,115,116,97,99,
-107,0,0,0,9,3,3,4,12,4,0,3,112,111,112,0,
-9,3,3,4,31,2,0,0,19,2,3,2,12,4,0,1,
-68,0,0,0,13,3,4,0,11,5,0,0,0,0,0,0,
+115,41,0,0,12,7,0,6,105,110,115,101,114,116,0,0,
+49,4,1,7,12,7,0,1,68,0,0,0,13,6,7,0,
+12,7,0,5,99,114,101,103,115,0,0,0,9,6,6,7,
+50,3,4,1,0,0,0,0,12,72,0,5,98,101,103,105,
+110,0,0,0,10,8,72,71,16,72,1,78,44,8,0,0,
+30,4,3,71,9,100,101,102,32,101,110,100,40,115,101,108,
+102,41,58,0,12,1,0,9,116,105,110,121,112,121,46,112,
+121,0,0,0,33,1,0,0,12,1,0,3,101,110,100,0,
+34,1,0,0,28,2,0,0,9,1,0,2,30,7,3,72,
+9,9,68,46,99,114,101,103,115,46,97,112,112,101,110,100,
+40,68,46,109,114,101,103,41,0,0,0,0,12,7,0,1,
+68,0,0,0,13,6,7,0,12,7,0,5,99,114,101,103,
+115,0,0,0,9,6,6,7,12,7,0,6,97,112,112,101,
+110,100,0,0,49,3,6,7,12,6,0,1,68,0,0,0,
+13,5,6,0,12,6,0,4,109,114,101,103,0,0,0,0,
+9,5,5,6,50,2,3,1,30,6,3,73,9,9,115,101,
+108,102,46,100,111,95,99,111,100,101,40,79,80,95,69,79,
+70,41,0,0,12,6,0,7,100,111,95,99,111,100,101,0,
+49,3,1,6,12,6,0,6,79,80,95,69,79,70,0,0,
+13,5,6,0,50,2,3,1,30,5,3,75,9,9,105,102,
+32,68,46,116,109,112,99,32,33,61,32,48,58,0,0,0,
+12,3,0,1,68,0,0,0,13,2,3,0,12,3,0,4,
+116,109,112,99,0,0,0,0,9,2,2,3,11,3,0,1,
+0,0,0,0,0,0,0,0,35,2,2,3,21,2,0,0,
+18,0,0,37,30,15,3,76,9,9,9,112,114,105,110,116,
+40,34,87,97,114,110,105,110,103,58,92,110,101,110,99,111,
+100,101,46,112,121,32,99,111,110,116,97,105,110,115,32,97,
+32,114,101,103,105,115,116,101,114,32,108,101,97,107,92,110,
+34,41,0,0,12,4,0,5,112,114,105,110,116,0,0,0,
+13,3,4,0,12,4,0,44,87,97,114,110,105,110,103,58,
+10,101,110,99,111,100,101,46,112,121,32,99,111,110,116,97,
+105,110,115,32,97,32,114,101,103,105,115,116,101,114,32,108,
+101,97,107,10,0,0,0,0,31,2,4,1,19,2,3,2,
+18,0,0,1,30,6,3,78,9,9,105,102,32,108,101,110,
+40,68,46,115,116,97,99,107,41,32,62,32,49,58,0,0,
+11,2,0,1,1,0,0,0,0,0,0,0,12,5,0,3,
+108,101,110,0,13,4,5,0,12,6,0,1,68,0,0,0,
+13,5,6,0,12,6,0,5,115,116,97,99,107,0,0,0,
+9,5,5,6,31,3,5,1,19,3,4,3,25,2,2,3,
+21,2,0,0,18,0,0,175,30,29,3,79,9,9,9,68,
+46,118,97,114,115,44,68,46,114,50,110,44,68,46,110,50,
+114,44,68,46,95,116,109,112,105,44,68,46,109,114,101,103,
+44,68,46,115,110,117,109,44,68,46,95,103,108,111,98,97,
+108,115,44,68,46,108,105,110,101,110,111,44,68,46,103,108,
+111,98,97,108,115,44,68,46,114,103,108,111,98,97,108,115,
+44,68,46,99,114,101,103,115,44,68,46,116,109,112,99,32,
+61,32,68,46,115,116,97,99,107,46,112,111,112,40,41,0,
+12,6,0,1,68,0,0,0,13,5,6,0,12,6,0,5,
+115,116,97,99,107,0,0,0,9,5,5,6,12,6,0,3,
+112,111,112,0,49,3,5,6,50,2,3,0,12,4,0,1,
+68,0,0,0,13,3,4,0,11,5,0,1,0,0,0,0,
 0,0,0,0,9,4,2,5,12,5,0,4,118,97,114,115,
 0,0,0,0,10,3,5,4,12,4,0,1,68,0,0,0,
-13,3,4,0,11,5,0,0,0,0,0,0,0,0,240,63,
+13,3,4,0,11,5,0,1,1,0,0,0,0,0,0,0,
 9,4,2,5,12,5,0,3,114,50,110,0,10,3,5,4,
-12,4,0,1,68,0,0,0,13,3,4,0,11,5,0,0,
-0,0,0,0,0,0,0,64,9,4,2,5,12,5,0,3,
+12,4,0,1,68,0,0,0,13,3,4,0,11,5,0,1,
+2,0,0,0,0,0,0,0,9,4,2,5,12,5,0,3,
 110,50,114,0,10,3,5,4,12,4,0,1,68,0,0,0,
-13,3,4,0,11,5,0,0,0,0,0,0,0,0,8,64,
+13,3,4,0,11,5,0,1,3,0,0,0,0,0,0,0,
 9,4,2,5,12,5,0,5,95,116,109,112,105,0,0,0,
 10,3,5,4,12,4,0,1,68,0,0,0,13,3,4,0,
-11,5,0,0,0,0,0,0,0,0,16,64,9,4,2,5,
+11,5,0,1,4,0,0,0,0,0,0,0,9,4,2,5,
 12,5,0,4,109,114,101,103,0,0,0,0,10,3,5,4,
-12,4,0,1,68,0,0,0,13,3,4,0,11,5,0,0,
-0,0,0,0,0,0,20,64,9,4,2,5,12,5,0,4,
+12,4,0,1,68,0,0,0,13,3,4,0,11,5,0,1,
+5,0,0,0,0,0,0,0,9,4,2,5,12,5,0,4,
 115,110,117,109,0,0,0,0,10,3,5,4,12,4,0,1,
-68,0,0,0,13,3,4,0,11,5,0,0,0,0,0,0,
-0,0,24,64,9,4,2,5,12,5,0,8,95,103,108,111,
+68,0,0,0,13,3,4,0,11,5,0,1,6,0,0,0,
+0,0,0,0,9,4,2,5,12,5,0,8,95,103,108,111,
 98,97,108,115,0,0,0,0,10,3,5,4,12,4,0,1,
-68,0,0,0,13,3,4,0,11,5,0,0,0,0,0,0,
-0,0,28,64,9,4,2,5,12,5,0,6,108,105,110,101,
+68,0,0,0,13,3,4,0,11,5,0,1,7,0,0,0,
+0,0,0,0,9,4,2,5,12,5,0,6,108,105,110,101,
 110,111,0,0,10,3,5,4,12,4,0,1,68,0,0,0,
-13,3,4,0,11,5,0,0,0,0,0,0,0,0,32,64,
+13,3,4,0,11,5,0,1,8,0,0,0,0,0,0,0,
 9,4,2,5,12,5,0,7,103,108,111,98,97,108,115,0,
 10,3,5,4,12,4,0,1,68,0,0,0,13,3,4,0,
-11,5,0,0,0,0,0,0,0,0,34,64,9,4,2,5,
+11,5,0,1,9,0,0,0,0,0,0,0,9,4,2,5,
 12,5,0,8,114,103,108,111,98,97,108,115,0,0,0,0,
 10,3,5,4,12,4,0,1,68,0,0,0,13,3,4,0,
-11,5,0,0,0,0,0,0,0,0,36,64,9,4,2,5,
+11,5,0,1,10,0,0,0,0,0,0,0,9,4,2,5,
 12,5,0,5,99,114,101,103,115,0,0,0,10,3,5,4,
-12,4,0,1,68,0,0,0,13,3,4,0,11,5,0,0,
-0,0,0,0,0,0,38,64,9,4,2,5,12,5,0,4,
-116,109,112,99,0,0,0,0,10,3,5,4,18,0,0,21,
-30,6,3,72,9,9,101,108,115,101,58,32,68,46,115,116,
-97,99,107,46,112,111,112,40,41,0,0,0,12,4,0,1,
-68,0,0,0,13,3,4,0,12,4,0,5,115,116,97,99,
-107,0,0,0,9,3,3,4,12,4,0,3,112,111,112,0,
-9,3,3,4,31,2,0,0,19,2,3,2,18,0,0,1,
-0,0,0,0,12,72,0,3,101,110,100,0,10,7,72,71,
-16,72,0,121,44,15,0,0,30,5,3,75,9,100,101,102,
-32,119,114,105,116,101,40,115,101,108,102,44,118,41,58,0,
-12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
-33,1,0,0,12,1,0,5,119,114,105,116,101,0,0,0,
-34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,30,6,3,76,9,9,105,102,32,105,115,116,
-121,112,101,40,118,44,39,108,105,115,116,39,41,58,0,0,
-12,5,0,6,105,115,116,121,112,101,0,0,13,4,5,0,
-15,5,2,0,12,6,0,4,108,105,115,116,0,0,0,0,
-31,3,5,2,19,3,4,3,21,3,0,0,18,0,0,21,
-30,5,3,77,9,9,9,115,101,108,102,46,105,110,115,101,
-114,116,40,118,41,0,0,0,12,5,0,6,105,110,115,101,
-114,116,0,0,9,4,1,5,15,5,2,0,31,3,5,1,
-19,3,4,3,30,3,3,78,9,9,9,114,101,116,117,114,
-110,0,0,0,28,3,0,0,20,3,0,0,18,0,0,1,
-30,8,3,79,9,9,102,111,114,32,110,32,105,110,32,114,
-97,110,103,101,40,48,44,108,101,110,40,118,41,44,52,41,
-58,0,0,0,12,6,0,5,114,97,110,103,101,0,0,0,
-13,5,6,0,11,6,0,0,0,0,0,0,0,0,0,0,
-12,10,0,3,108,101,110,0,13,9,10,0,15,10,2,0,
-31,7,10,1,19,7,9,7,11,8,0,0,0,0,0,0,
-0,0,16,64,31,4,6,3,19,4,5,4,11,5,0,0,
-0,0,0,0,0,0,0,0,42,3,4,5,18,0,0,29,
-30,9,3,80,9,9,9,115,101,108,102,46,105,110,115,101,
-114,116,40,40,39,100,97,116,97,39,44,118,91,110,58,110,
-43,52,93,41,41,0,0,0,12,8,0,6,105,110,115,101,
-114,116,0,0,9,7,1,8,12,9,0,4,100,97,116,97,
-0,0,0,0,15,12,3,0,11,14,0,0,0,0,0,0,
-0,0,16,64,1,13,3,14,27,11,12,2,9,10,2,11,
-27,8,9,2,31,6,8,1,19,6,7,6,18,0,255,227,
-0,0,0,0,12,73,0,5,119,114,105,116,101,0,0,0,
-10,7,73,72,16,73,0,168,44,13,0,0,30,6,3,83,
-9,100,101,102,32,115,101,116,112,111,115,40,115,101,108,102,
-44,118,41,58,0,0,0,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,6,
-115,101,116,112,111,115,0,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,30,4,3,84,
-9,9,108,105,110,101,44,120,32,61,32,118,0,0,0,0,
-11,5,0,0,0,0,0,0,0,0,0,0,9,4,2,5,
-15,3,4,0,11,6,0,0,0,0,0,0,0,0,240,63,
-9,5,2,6,15,4,5,0,30,8,3,85,9,9,105,102,
-32,108,105,110,101,32,61,61,32,68,46,108,105,110,101,110,
-111,58,32,114,101,116,117,114,110,0,0,0,12,6,0,1,
-68,0,0,0,13,5,6,0,12,6,0,6,108,105,110,101,
-110,111,0,0,9,5,5,6,23,2,3,5,21,2,0,0,
-18,0,0,4,28,2,0,0,20,2,0,0,18,0,0,1,
-30,7,3,86,9,9,116,101,120,116,32,61,32,68,46,108,
-105,110,101,115,91,108,105,110,101,45,49,93,0,0,0,0,
-12,6,0,1,68,0,0,0,13,5,6,0,12,6,0,5,
-108,105,110,101,115,0,0,0,9,5,5,6,11,7,0,0,
-0,0,0,0,0,0,240,63,2,6,3,7,9,5,5,6,
-15,2,5,0,30,5,3,87,9,9,68,46,108,105,110,101,
-110,111,32,61,32,108,105,110,101,0,0,0,12,6,0,1,
-68,0,0,0,13,5,6,0,12,6,0,6,108,105,110,101,
-110,111,0,0,10,5,6,3,30,9,3,88,9,9,118,97,
-108,32,61,32,116,101,120,116,32,43,32,34,92,48,34,42,
-40,52,45,108,101,110,40,116,101,120,116,41,37,52,41,0,
-12,7,0,1,0,0,0,0,11,8,0,0,0,0,0,0,
-0,0,16,64,12,11,0,3,108,101,110,0,13,10,11,0,
-15,11,2,0,31,9,11,1,19,9,10,9,11,10,0,0,
-0,0,0,0,0,0,16,64,39,9,9,10,2,8,8,9,
-3,7,7,8,1,6,2,7,15,5,6,0,30,10,3,89,
-9,9,115,101,108,102,46,99,111,100,101,95,49,54,40,79,
-80,95,80,79,83,44,108,101,110,40,118,97,108,41,47,52,
-44,108,105,110,101,41,0,0,12,8,0,7,99,111,100,101,
-95,49,54,0,9,7,1,8,12,11,0,6,79,80,95,80,
-79,83,0,0,13,8,11,0,12,12,0,3,108,101,110,0,
-13,11,12,0,15,12,5,0,31,9,12,1,19,9,11,9,
-11,11,0,0,0,0,0,0,0,0,16,64,4,9,9,11,
-15,10,3,0,31,6,8,3,19,6,7,6,30,5,3,90,
-9,9,115,101,108,102,46,119,114,105,116,101,40,118,97,108,
-41,0,0,0,12,8,0,5,119,114,105,116,101,0,0,0,
-9,7,1,8,15,8,5,0,31,6,8,1,19,6,7,6,
-0,0,0,0,12,74,0,6,115,101,116,112,111,115,0,0,
-10,7,74,73,16,74,0,168,44,14,0,0,30,9,3,93,
-9,100,101,102,32,100,111,95,99,111,100,101,40,115,101,108,
-102,44,105,44,97,61,48,44,98,61,48,44,99,61,48,41,
-58,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,7,100,111,95,99,
-111,100,101,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,3,0,0,9,2,0,3,11,3,0,0,0,0,0,0,
-0,0,0,0,28,4,0,0,32,3,0,4,11,4,0,0,
-0,0,0,0,0,0,0,0,28,5,0,0,32,4,0,5,
-11,5,0,0,0,0,0,0,0,0,0,0,28,6,0,0,
-32,5,0,6,30,9,3,94,9,9,105,102,32,110,111,116,
-32,105,115,116,121,112,101,40,105,44,39,110,117,109,98,101,
-114,39,41,58,32,114,97,105,115,101,0,0,12,9,0,6,
-105,115,116,121,112,101,0,0,13,8,9,0,15,9,2,0,
-12,10,0,6,110,117,109,98,101,114,0,0,31,7,9,2,
-19,7,8,7,47,6,7,0,21,6,0,0,18,0,0,4,
-28,6,0,0,37,6,0,0,18,0,0,1,30,9,3,95,
-9,9,105,102,32,110,111,116,32,105,115,116,121,112,101,40,
-97,44,39,110,117,109,98,101,114,39,41,58,32,114,97,105,
-115,101,0,0,12,9,0,6,105,115,116,121,112,101,0,0,
-13,8,9,0,15,9,3,0,12,10,0,6,110,117,109,98,
-101,114,0,0,31,7,9,2,19,7,8,7,47,6,7,0,
-21,6,0,0,18,0,0,4,28,6,0,0,37,6,0,0,
-18,0,0,1,30,9,3,96,9,9,105,102,32,110,111,116,
-32,105,115,116,121,112,101,40,98,44,39,110,117,109,98,101,
-114,39,41,58,32,114,97,105,115,101,0,0,12,9,0,6,
-105,115,116,121,112,101,0,0,13,8,9,0,15,9,4,0,
-12,10,0,6,110,117,109,98,101,114,0,0,31,7,9,2,
-19,7,8,7,47,6,7,0,21,6,0,0,18,0,0,4,
-28,6,0,0,37,6,0,0,18,0,0,1,30,9,3,97,
-9,9,105,102,32,110,111,116,32,105,115,116,121,112,101,40,
-99,44,39,110,117,109,98,101,114,39,41,58,32,114,97,105,
-115,101,0,0,12,9,0,6,105,115,116,121,112,101,0,0,
-13,8,9,0,15,9,5,0,12,10,0,6,110,117,109,98,
-101,114,0,0,31,7,9,2,19,7,8,7,47,6,7,0,
-21,6,0,0,18,0,0,4,28,6,0,0,37,6,0,0,
-18,0,0,1,30,8,3,98,9,9,115,101,108,102,46,119,
-114,105,116,101,40,40,39,99,111,100,101,39,44,105,44,97,
-44,98,44,99,41,41,0,0,12,8,0,5,119,114,105,116,
-101,0,0,0,9,7,1,8,12,9,0,4,99,111,100,101,
-0,0,0,0,15,10,2,0,15,11,3,0,15,12,4,0,
-15,13,5,0,27,8,9,5,31,6,8,1,19,6,7,6,
-0,0,0,0,12,75,0,7,100,111,95,99,111,100,101,0,
-10,7,75,74,16,75,0,84,44,12,0,0,30,7,3,101,
-9,100,101,102,32,99,111,100,101,95,49,54,40,115,101,108,
-102,44,105,44,97,44,98,41,58,0,0,0,12,1,0,9,
+12,4,0,1,68,0,0,0,13,3,4,0,11,5,0,1,
+11,0,0,0,0,0,0,0,9,4,2,5,12,5,0,4,
+116,109,112,99,0,0,0,0,10,3,5,4,18,0,0,20,
+30,6,3,80,9,9,101,108,115,101,58,32,68,46,115,116,
+97,99,107,46,112,111,112,40,41,0,0,0,12,6,0,1,
+68,0,0,0,13,5,6,0,12,6,0,5,115,116,97,99,
+107,0,0,0,9,5,5,6,12,6,0,3,112,111,112,0,
+49,3,5,6,50,2,3,0,18,0,0,1,0,0,0,0,
+12,73,0,3,101,110,100,0,10,8,73,72,16,73,0,119,
+44,16,0,0,30,5,3,83,9,100,101,102,32,119,114,105,
+116,101,40,115,101,108,102,44,118,41,58,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,7,99,111,100,101,95,49,54,0,34,1,0,0,
+12,1,0,5,119,114,105,116,101,0,0,0,34,1,0,0,
 28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-28,4,0,0,9,3,0,4,28,5,0,0,9,4,0,5,
-30,6,3,102,9,9,105,102,32,98,32,60,32,48,58,32,
-98,32,43,61,32,48,120,56,48,48,48,0,11,6,0,0,
-0,0,0,0,0,0,0,0,25,5,4,6,21,5,0,0,
-18,0,0,7,11,6,0,0,0,0,0,0,0,0,224,64,
-1,5,4,6,15,4,5,0,18,0,0,1,30,12,3,103,
-9,9,115,101,108,102,46,100,111,95,99,111,100,101,40,105,
-44,97,44,40,98,38,48,120,102,102,48,48,41,62,62,56,
-44,40,98,38,48,120,102,102,41,62,62,48,41,0,0,0,
-12,7,0,7,100,111,95,99,111,100,101,0,9,6,1,7,
-15,7,2,0,15,8,3,0,11,11,0,0,0,0,0,0,
-0,224,239,64,6,9,4,11,11,11,0,0,0,0,0,0,
-0,0,32,64,41,9,9,11,11,11,0,0,0,0,0,0,
-0,224,111,64,6,10,4,11,11,11,0,0,0,0,0,0,
-0,0,0,0,41,10,10,11,31,5,7,4,19,5,6,5,
-0,0,0,0,12,76,0,7,99,111,100,101,95,49,54,0,
-10,7,76,75,16,76,0,66,44,12,0,0,30,8,3,106,
-9,100,101,102,32,103,101,116,95,99,111,100,101,49,54,40,
-115,101,108,102,44,105,44,97,44,98,41,58,0,0,0,0,
-12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
-33,1,0,0,12,1,0,10,103,101,116,95,99,111,100,101,
-49,54,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,3,0,0,9,2,0,3,28,4,0,0,9,3,0,4,
-28,5,0,0,9,4,0,5,30,12,3,107,9,9,114,101,
-116,117,114,110,32,40,39,99,111,100,101,39,44,105,44,97,
-44,40,98,38,48,120,102,102,48,48,41,62,62,56,44,40,
-98,38,48,120,102,102,41,62,62,48,41,0,12,6,0,4,
-99,111,100,101,0,0,0,0,15,7,2,0,15,8,3,0,
-11,11,0,0,0,0,0,0,0,224,239,64,6,9,4,11,
-11,11,0,0,0,0,0,0,0,0,32,64,41,9,9,11,
-11,11,0,0,0,0,0,0,0,224,111,64,6,10,4,11,
-11,11,0,0,0,0,0,0,0,0,0,0,41,10,10,11,
-27,5,6,5,20,5,0,0,0,0,0,0,12,77,0,10,
-103,101,116,95,99,111,100,101,49,54,0,0,10,7,77,76,
-16,77,0,118,44,12,0,0,30,8,3,110,9,100,101,102,
-32,95,100,111,95,115,116,114,105,110,103,40,115,101,108,102,
-44,118,44,114,61,78,111,110,101,41,58,0,12,1,0,9,
+30,6,3,84,9,9,105,102,32,105,115,116,121,112,101,40,
+118,44,39,108,105,115,116,39,41,58,0,0,12,5,0,6,
+105,115,116,121,112,101,0,0,13,4,5,0,15,5,2,0,
+12,6,0,4,108,105,115,116,0,0,0,0,31,3,5,2,
+19,3,4,3,21,3,0,0,18,0,0,20,30,5,3,85,
+9,9,9,115,101,108,102,46,105,110,115,101,114,116,40,118,
+41,0,0,0,12,7,0,6,105,110,115,101,114,116,0,0,
+49,4,1,7,15,6,2,0,50,3,4,1,30,3,3,86,
+9,9,9,114,101,116,117,114,110,0,0,0,28,3,0,0,
+20,3,0,0,18,0,0,1,30,8,3,87,9,9,102,111,
+114,32,110,32,105,110,32,114,97,110,103,101,40,48,44,108,
+101,110,40,118,41,44,52,41,58,0,0,0,12,6,0,5,
+114,97,110,103,101,0,0,0,13,5,6,0,11,6,0,1,
+0,0,0,0,0,0,0,0,12,10,0,3,108,101,110,0,
+13,9,10,0,15,10,2,0,31,7,10,1,19,7,9,7,
+11,8,0,1,4,0,0,0,0,0,0,0,31,4,6,3,
+19,4,5,4,11,5,0,1,0,0,0,0,0,0,0,0,
+42,3,4,5,18,0,0,28,30,9,3,88,9,9,9,115,
+101,108,102,46,105,110,115,101,114,116,40,40,39,100,97,116,
+97,39,44,118,91,110,58,110,43,52,93,41,41,0,0,0,
+12,10,0,6,105,110,115,101,114,116,0,0,49,7,1,10,
+12,10,0,4,100,97,116,97,0,0,0,0,15,13,3,0,
+11,15,0,1,4,0,0,0,0,0,0,0,1,14,3,15,
+27,12,13,2,9,11,2,12,27,9,10,2,50,6,7,1,
+18,0,255,228,0,0,0,0,12,74,0,5,119,114,105,116,
+101,0,0,0,10,8,74,73,16,74,0,166,44,14,0,0,
+30,6,3,91,9,100,101,102,32,115,101,116,112,111,115,40,
+115,101,108,102,44,118,41,58,0,0,0,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,10,95,100,111,95,115,116,114,105,110,103,0,0,
+12,1,0,6,115,101,116,112,111,115,0,0,34,1,0,0,
+28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
+30,4,3,92,9,9,108,105,110,101,44,120,32,61,32,118,
+0,0,0,0,11,5,0,1,0,0,0,0,0,0,0,0,
+9,4,2,5,15,3,4,0,11,6,0,1,1,0,0,0,
+0,0,0,0,9,5,2,6,15,4,5,0,30,8,3,93,
+9,9,105,102,32,108,105,110,101,32,61,61,32,68,46,108,
+105,110,101,110,111,58,32,114,101,116,117,114,110,0,0,0,
+12,6,0,1,68,0,0,0,13,5,6,0,12,6,0,6,
+108,105,110,101,110,111,0,0,9,5,5,6,23,2,3,5,
+21,2,0,0,18,0,0,4,28,2,0,0,20,2,0,0,
+18,0,0,1,30,7,3,94,9,9,116,101,120,116,32,61,
+32,68,46,108,105,110,101,115,91,108,105,110,101,45,49,93,
+0,0,0,0,12,6,0,1,68,0,0,0,13,5,6,0,
+12,6,0,5,108,105,110,101,115,0,0,0,9,5,5,6,
+11,7,0,1,1,0,0,0,0,0,0,0,2,6,3,7,
+9,5,5,6,15,2,5,0,30,5,3,95,9,9,68,46,
+108,105,110,101,110,111,32,61,32,108,105,110,101,0,0,0,
+12,6,0,1,68,0,0,0,13,5,6,0,12,6,0,6,
+108,105,110,101,110,111,0,0,10,5,6,3,30,9,3,96,
+9,9,118,97,108,32,61,32,116,101,120,116,32,43,32,34,
+92,48,34,42,40,52,45,108,101,110,40,116,101,120,116,41,
+37,52,41,0,12,7,0,1,0,0,0,0,11,8,0,1,
+4,0,0,0,0,0,0,0,12,11,0,3,108,101,110,0,
+13,10,11,0,15,11,2,0,31,9,11,1,19,9,10,9,
+11,10,0,1,4,0,0,0,0,0,0,0,39,9,9,10,
+2,8,8,9,3,7,7,8,1,6,2,7,15,5,6,0,
+30,10,3,97,9,9,115,101,108,102,46,99,111,100,101,95,
+49,54,40,79,80,95,80,79,83,44,108,101,110,40,118,97,
+108,41,47,52,44,108,105,110,101,41,0,0,12,12,0,7,
+99,111,100,101,95,49,54,0,49,7,1,12,12,12,0,6,
+79,80,95,80,79,83,0,0,13,9,12,0,12,13,0,3,
+108,101,110,0,13,12,13,0,15,13,5,0,31,10,13,1,
+19,10,12,10,11,12,0,1,4,0,0,0,0,0,0,0,
+4,10,10,12,15,11,3,0,50,6,7,3,30,5,3,98,
+9,9,115,101,108,102,46,119,114,105,116,101,40,118,97,108,
+41,0,0,0,12,10,0,5,119,114,105,116,101,0,0,0,
+49,7,1,10,15,9,5,0,50,6,7,1,0,0,0,0,
+12,75,0,6,115,101,116,112,111,115,0,0,10,8,75,74,
+16,75,0,167,44,15,0,0,30,9,3,101,9,100,101,102,
+32,100,111,95,99,111,100,101,40,115,101,108,102,44,105,44,
+97,61,48,44,98,61,48,44,99,61,48,41,58,0,0,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,7,100,111,95,99,111,100,101,0,
 34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,28,3,0,0,28,4,0,0,32,3,0,4,
-30,6,3,111,9,9,114,32,61,32,115,101,108,102,46,103,
-101,116,95,116,109,112,40,114,41,0,0,0,12,6,0,7,
-103,101,116,95,116,109,112,0,9,5,1,6,15,6,3,0,
-31,4,6,1,19,4,5,4,15,3,4,0,30,8,3,112,
+9,2,0,3,11,3,0,1,0,0,0,0,0,0,0,0,
+28,4,0,0,32,3,0,4,11,4,0,1,0,0,0,0,
+0,0,0,0,28,5,0,0,32,4,0,5,11,5,0,1,
+0,0,0,0,0,0,0,0,28,6,0,0,32,5,0,6,
+30,9,3,102,9,9,105,102,32,110,111,116,32,105,115,116,
+121,112,101,40,105,44,39,110,117,109,98,101,114,39,41,58,
+32,114,97,105,115,101,0,0,12,9,0,6,105,115,116,121,
+112,101,0,0,13,8,9,0,15,9,2,0,12,10,0,6,
+110,117,109,98,101,114,0,0,31,7,9,2,19,7,8,7,
+47,6,7,0,21,6,0,0,18,0,0,4,28,6,0,0,
+37,6,0,0,18,0,0,1,30,9,3,103,9,9,105,102,
+32,110,111,116,32,105,115,116,121,112,101,40,97,44,39,110,
+117,109,98,101,114,39,41,58,32,114,97,105,115,101,0,0,
+12,9,0,6,105,115,116,121,112,101,0,0,13,8,9,0,
+15,9,3,0,12,10,0,6,110,117,109,98,101,114,0,0,
+31,7,9,2,19,7,8,7,47,6,7,0,21,6,0,0,
+18,0,0,4,28,6,0,0,37,6,0,0,18,0,0,1,
+30,9,3,104,9,9,105,102,32,110,111,116,32,105,115,116,
+121,112,101,40,98,44,39,110,117,109,98,101,114,39,41,58,
+32,114,97,105,115,101,0,0,12,9,0,6,105,115,116,121,
+112,101,0,0,13,8,9,0,15,9,4,0,12,10,0,6,
+110,117,109,98,101,114,0,0,31,7,9,2,19,7,8,7,
+47,6,7,0,21,6,0,0,18,0,0,4,28,6,0,0,
+37,6,0,0,18,0,0,1,30,9,3,105,9,9,105,102,
+32,110,111,116,32,105,115,116,121,112,101,40,99,44,39,110,
+117,109,98,101,114,39,41,58,32,114,97,105,115,101,0,0,
+12,9,0,6,105,115,116,121,112,101,0,0,13,8,9,0,
+15,9,5,0,12,10,0,6,110,117,109,98,101,114,0,0,
+31,7,9,2,19,7,8,7,47,6,7,0,21,6,0,0,
+18,0,0,4,28,6,0,0,37,6,0,0,18,0,0,1,
+30,8,3,106,9,9,115,101,108,102,46,119,114,105,116,101,
+40,40,39,99,111,100,101,39,44,105,44,97,44,98,44,99,
+41,41,0,0,12,10,0,5,119,114,105,116,101,0,0,0,
+49,7,1,10,12,10,0,4,99,111,100,101,0,0,0,0,
+15,11,2,0,15,12,3,0,15,13,4,0,15,14,5,0,
+27,9,10,5,50,6,7,1,0,0,0,0,12,76,0,7,
+100,111,95,99,111,100,101,0,10,8,76,75,16,76,0,83,
+44,13,0,0,30,7,3,109,9,100,101,102,32,99,111,100,
+101,95,49,54,40,115,101,108,102,44,105,44,97,44,98,41,
+58,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
+121,0,0,0,33,1,0,0,12,1,0,7,99,111,100,101,
+95,49,54,0,34,1,0,0,28,2,0,0,9,1,0,2,
+28,3,0,0,9,2,0,3,28,4,0,0,9,3,0,4,
+28,5,0,0,9,4,0,5,30,6,3,110,9,9,105,102,
+32,98,32,60,32,48,58,32,98,32,43,61,32,48,120,56,
+48,48,48,0,11,6,0,1,0,0,0,0,0,0,0,0,
+25,5,4,6,21,5,0,0,18,0,0,7,11,6,0,1,
+0,128,0,0,0,0,0,0,1,5,4,6,15,4,5,0,
+18,0,0,1,30,12,3,111,9,9,115,101,108,102,46,100,
+111,95,99,111,100,101,40,105,44,97,44,40,98,38,48,120,
+102,102,48,48,41,62,62,56,44,40,98,38,48,120,102,102,
+41,62,62,48,41,0,0,0,12,12,0,7,100,111,95,99,
+111,100,101,0,49,6,1,12,15,8,2,0,15,9,3,0,
+11,12,0,1,0,255,0,0,0,0,0,0,6,10,4,12,
+11,12,0,1,8,0,0,0,0,0,0,0,41,10,10,12,
+11,12,0,1,255,0,0,0,0,0,0,0,6,11,4,12,
+11,12,0,1,0,0,0,0,0,0,0,0,41,11,11,12,
+50,5,6,4,0,0,0,0,12,77,0,7,99,111,100,101,
+95,49,54,0,10,8,77,76,16,77,0,66,44,12,0,0,
+30,8,3,114,9,100,101,102,32,103,101,116,95,99,111,100,
+101,49,54,40,115,101,108,102,44,105,44,97,44,98,41,58,
+0,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
+121,0,0,0,33,1,0,0,12,1,0,10,103,101,116,95,
+99,111,100,101,49,54,0,0,34,1,0,0,28,2,0,0,
+9,1,0,2,28,3,0,0,9,2,0,3,28,4,0,0,
+9,3,0,4,28,5,0,0,9,4,0,5,30,12,3,115,
+9,9,114,101,116,117,114,110,32,40,39,99,111,100,101,39,
+44,105,44,97,44,40,98,38,48,120,102,102,48,48,41,62,
+62,56,44,40,98,38,48,120,102,102,41,62,62,48,41,0,
+12,6,0,4,99,111,100,101,0,0,0,0,15,7,2,0,
+15,8,3,0,11,11,0,1,0,255,0,0,0,0,0,0,
+6,9,4,11,11,11,0,1,8,0,0,0,0,0,0,0,
+41,9,9,11,11,11,0,1,255,0,0,0,0,0,0,0,
+6,10,4,11,11,11,0,1,0,0,0,0,0,0,0,0,
+41,10,10,11,27,5,6,5,20,5,0,0,0,0,0,0,
+12,78,0,10,103,101,116,95,99,111,100,101,49,54,0,0,
+10,8,78,77,16,78,0,115,44,13,0,0,30,8,3,118,
+9,100,101,102,32,95,100,111,95,115,116,114,105,110,103,40,
+115,101,108,102,44,118,44,114,61,78,111,110,101,41,58,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,10,95,100,111,95,115,116,114,105,
+110,103,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
+28,3,0,0,9,2,0,3,28,3,0,0,28,4,0,0,
+32,3,0,4,30,6,3,119,9,9,114,32,61,32,115,101,
+108,102,46,103,101,116,95,116,109,112,40,114,41,0,0,0,
+12,8,0,7,103,101,116,95,116,109,112,0,49,5,1,8,
+15,7,3,0,50,4,5,1,15,3,4,0,30,8,3,120,
 9,9,118,97,108,32,61,32,118,32,43,32,34,92,48,34,
 42,40,52,45,108,101,110,40,118,41,37,52,41,0,0,0,
-12,6,0,1,0,0,0,0,11,7,0,0,0,0,0,0,
-0,0,16,64,12,10,0,3,108,101,110,0,13,9,10,0,
-15,10,2,0,31,8,10,1,19,8,9,8,11,9,0,0,
-0,0,0,0,0,0,16,64,39,8,8,9,2,7,7,8,
-3,6,6,7,1,5,2,6,15,4,5,0,30,9,3,113,
+12,6,0,1,0,0,0,0,11,7,0,1,4,0,0,0,
+0,0,0,0,12,10,0,3,108,101,110,0,13,9,10,0,
+15,10,2,0,31,8,10,1,19,8,9,8,11,9,0,1,
+4,0,0,0,0,0,0,0,39,8,8,9,2,7,7,8,
+3,6,6,7,1,5,2,6,15,4,5,0,30,9,3,121,
 9,9,115,101,108,102,46,99,111,100,101,95,49,54,40,79,
 80,95,83,84,82,73,78,71,44,114,44,108,101,110,40,118,
-41,41,0,0,12,7,0,7,99,111,100,101,95,49,54,0,
-9,6,1,7,12,10,0,9,79,80,95,83,84,82,73,78,
-71,0,0,0,13,7,10,0,15,8,3,0,12,11,0,3,
-108,101,110,0,13,10,11,0,15,11,2,0,31,9,11,1,
-19,9,10,9,31,5,7,3,19,5,6,5,30,5,3,114,
-9,9,115,101,108,102,46,119,114,105,116,101,40,118,97,108,
-41,0,0,0,12,7,0,5,119,114,105,116,101,0,0,0,
-9,6,1,7,15,7,4,0,31,5,7,1,19,5,6,5,
-30,3,3,115,9,9,114,101,116,117,114,110,32,114,0,0,
-20,3,0,0,0,0,0,0,12,78,0,10,95,100,111,95,
-115,116,114,105,110,103,0,0,10,7,78,77,16,78,0,161,
-44,22,0,0,30,6,3,119,9,100,101,102,32,100,111,95,
-105,109,112,111,114,116,40,115,101,108,102,44,116,41,58,0,
-12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
-33,1,0,0,12,1,0,9,100,111,95,105,109,112,111,114,
-116,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,3,0,0,9,2,0,3,30,6,3,120,9,9,102,111,
-114,32,109,111,100,32,105,110,32,116,46,105,116,101,109,115,
-58,0,0,0,12,5,0,5,105,116,101,109,115,0,0,0,
-9,4,2,5,11,5,0,0,0,0,0,0,0,0,0,0,
-42,3,4,5,18,0,0,122,30,6,3,121,9,9,9,109,
-111,100,46,116,121,112,101,32,61,32,39,115,116,114,105,110,
-103,39,0,0,12,6,0,6,115,116,114,105,110,103,0,0,
-12,7,0,4,116,121,112,101,0,0,0,0,10,3,7,6,
-30,21,3,122,9,9,9,118,32,61,32,115,101,108,102,46,
-100,111,95,99,97,108,108,40,84,111,107,101,110,40,116,46,
-112,111,115,44,39,99,97,108,108,39,44,78,111,110,101,44,
-91,84,111,107,101,110,40,116,46,112,111,115,44,39,110,97,
-109,101,39,44,39,105,109,112,111,114,116,39,41,44,109,111,
-100,93,41,41,0,0,0,0,12,9,0,7,100,111,95,99,
-97,108,108,0,9,8,1,9,12,11,0,5,84,111,107,101,
-110,0,0,0,13,10,11,0,12,15,0,3,112,111,115,0,
-9,11,2,15,12,12,0,4,99,97,108,108,0,0,0,0,
-28,13,0,0,12,18,0,5,84,111,107,101,110,0,0,0,
-13,17,18,0,12,21,0,3,112,111,115,0,9,18,2,21,
-12,19,0,4,110,97,109,101,0,0,0,0,12,20,0,6,
-105,109,112,111,114,116,0,0,31,15,18,3,19,15,17,15,
-15,16,3,0,27,14,15,2,31,9,11,4,19,9,10,9,
-31,7,9,1,19,7,8,7,15,6,7,0,30,6,3,123,
-9,9,9,109,111,100,46,116,121,112,101,32,61,32,39,110,
-97,109,101,39,0,0,0,0,12,7,0,4,110,97,109,101,
-0,0,0,0,12,8,0,4,116,121,112,101,0,0,0,0,
-10,3,8,7,30,12,3,124,9,9,9,115,101,108,102,46,
-100,111,95,115,101,116,95,99,116,120,40,109,111,100,44,84,
-111,107,101,110,40,116,46,112,111,115,44,39,114,101,103,39,
-44,118,41,41,0,0,0,0,12,9,0,10,100,111,95,115,
-101,116,95,99,116,120,0,0,9,8,1,9,15,9,3,0,
+41,41,0,0,12,11,0,7,99,111,100,101,95,49,54,0,
+49,6,1,11,12,11,0,9,79,80,95,83,84,82,73,78,
+71,0,0,0,13,8,11,0,15,9,3,0,12,12,0,3,
+108,101,110,0,13,11,12,0,15,12,2,0,31,10,12,1,
+19,10,11,10,50,5,6,3,30,5,3,122,9,9,115,101,
+108,102,46,119,114,105,116,101,40,118,97,108,41,0,0,0,
+12,9,0,5,119,114,105,116,101,0,0,0,49,6,1,9,
+15,8,4,0,50,5,6,1,30,3,3,123,9,9,114,101,
+116,117,114,110,32,114,0,0,20,3,0,0,0,0,0,0,
+12,79,0,10,95,100,111,95,115,116,114,105,110,103,0,0,
+10,8,79,78,16,79,0,159,44,23,0,0,30,6,3,127,
+9,100,101,102,32,100,111,95,105,109,112,111,114,116,40,115,
+101,108,102,44,116,41,58,0,12,1,0,9,116,105,110,121,
+112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,9,
+100,111,95,105,109,112,111,114,116,0,0,0,34,1,0,0,
+28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
+30,6,3,128,9,9,102,111,114,32,109,111,100,32,105,110,
+32,116,46,105,116,101,109,115,58,0,0,0,12,5,0,5,
+105,116,101,109,115,0,0,0,9,4,2,5,11,5,0,1,
+0,0,0,0,0,0,0,0,42,3,4,5,18,0,0,120,
+30,6,3,129,9,9,9,109,111,100,46,116,121,112,101,32,
+61,32,39,115,116,114,105,110,103,39,0,0,12,6,0,6,
+115,116,114,105,110,103,0,0,12,7,0,4,116,121,112,101,
+0,0,0,0,10,3,7,6,30,21,3,130,9,9,9,118,
+32,61,32,115,101,108,102,46,100,111,95,99,97,108,108,40,
+84,111,107,101,110,40,116,46,112,111,115,44,39,99,97,108,
+108,39,44,78,111,110,101,44,91,84,111,107,101,110,40,116,
+46,112,111,115,44,39,110,97,109,101,39,44,39,105,109,112,
+111,114,116,39,41,44,109,111,100,93,41,41,0,0,0,0,
+12,11,0,7,100,111,95,99,97,108,108,0,49,8,1,11,
 12,12,0,5,84,111,107,101,110,0,0,0,13,11,12,0,
-12,15,0,3,112,111,115,0,9,12,2,15,12,13,0,3,
-114,101,103,0,15,14,6,0,31,10,12,3,19,10,11,10,
-31,7,9,2,19,7,8,7,18,0,255,134,0,0,0,0,
-12,79,0,9,100,111,95,105,109,112,111,114,116,0,0,0,
-10,7,79,78,16,79,1,133,44,24,0,0,30,6,3,127,
+12,16,0,3,112,111,115,0,9,12,2,16,12,13,0,4,
+99,97,108,108,0,0,0,0,28,14,0,0,12,19,0,5,
+84,111,107,101,110,0,0,0,13,18,19,0,12,22,0,3,
+112,111,115,0,9,19,2,22,12,20,0,4,110,97,109,101,
+0,0,0,0,12,21,0,6,105,109,112,111,114,116,0,0,
+31,16,19,3,19,16,18,16,15,17,3,0,27,15,16,2,
+31,10,12,4,19,10,11,10,50,7,8,1,15,6,7,0,
+30,6,3,131,9,9,9,109,111,100,46,116,121,112,101,32,
+61,32,39,110,97,109,101,39,0,0,0,0,12,7,0,4,
+110,97,109,101,0,0,0,0,12,8,0,4,116,121,112,101,
+0,0,0,0,10,3,8,7,30,12,3,132,9,9,9,115,
+101,108,102,46,100,111,95,115,101,116,95,99,116,120,40,109,
+111,100,44,84,111,107,101,110,40,116,46,112,111,115,44,39,
+114,101,103,39,44,118,41,41,0,0,0,0,12,12,0,10,
+100,111,95,115,101,116,95,99,116,120,0,0,49,8,1,12,
+15,10,3,0,12,13,0,5,84,111,107,101,110,0,0,0,
+13,12,13,0,12,16,0,3,112,111,115,0,9,13,2,16,
+12,14,0,3,114,101,103,0,15,15,6,0,31,11,13,3,
+19,11,12,11,50,7,8,2,18,0,255,136,0,0,0,0,
+12,80,0,9,100,111,95,105,109,112,111,114,116,0,0,0,
+10,8,80,79,16,80,1,128,44,26,0,0,30,6,3,135,
 9,100,101,102,32,100,111,95,102,114,111,109,40,115,101,108,
 102,44,116,41,58,0,0,0,12,1,0,9,116,105,110,121,
 112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,7,
 100,111,95,102,114,111,109,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,30,5,3,128,
+9,1,0,2,28,3,0,0,9,2,0,3,30,5,3,136,
 9,9,109,111,100,32,61,32,116,46,105,116,101,109,115,91,
 48,93,0,0,12,5,0,5,105,116,101,109,115,0,0,0,
-9,4,2,5,11,5,0,0,0,0,0,0,0,0,0,0,
-9,4,4,5,15,3,4,0,30,6,3,129,9,9,109,111,
+9,4,2,5,11,5,0,1,0,0,0,0,0,0,0,0,
+9,4,4,5,15,3,4,0,30,6,3,137,9,9,109,111,
 100,46,116,121,112,101,32,61,32,39,115,116,114,105,110,103,
 39,0,0,0,12,4,0,6,115,116,114,105,110,103,0,0,
 12,5,0,4,116,121,112,101,0,0,0,0,10,3,5,4,
-30,10,3,130,9,9,118,32,61,32,115,101,108,102,46,100,
+30,10,3,138,9,9,118,32,61,32,115,101,108,102,46,100,
 111,40,84,111,107,101,110,40,116,46,112,111,115,44,39,99,
-97,108,108,39,44,78,111,110,101,44,91,0,12,7,0,2,
-100,111,0,0,9,6,1,7,12,9,0,5,84,111,107,101,
-110,0,0,0,13,8,9,0,12,13,0,3,112,111,115,0,
-9,9,2,13,12,10,0,4,99,97,108,108,0,0,0,0,
-28,11,0,0,30,9,3,131,9,9,9,84,111,107,101,110,
+97,108,108,39,44,78,111,110,101,44,91,0,12,9,0,2,
+100,111,0,0,49,6,1,9,12,10,0,5,84,111,107,101,
+110,0,0,0,13,9,10,0,12,14,0,3,112,111,115,0,
+9,10,2,14,12,11,0,4,99,97,108,108,0,0,0,0,
+28,12,0,0,30,9,3,139,9,9,9,84,111,107,101,110,
 40,116,46,112,111,115,44,39,110,97,109,101,39,44,39,105,
-109,112,111,114,116,39,41,44,0,0,0,0,12,16,0,5,
-84,111,107,101,110,0,0,0,13,15,16,0,12,19,0,3,
-112,111,115,0,9,16,2,19,12,17,0,4,110,97,109,101,
-0,0,0,0,12,18,0,6,105,109,112,111,114,116,0,0,
-31,13,16,3,19,13,15,13,30,3,3,132,9,9,9,109,
-111,100,93,41,41,0,0,0,15,14,3,0,27,12,13,2,
-31,7,9,4,19,7,8,7,31,5,7,1,19,5,6,5,
-15,4,5,0,30,5,3,133,9,9,105,116,101,109,32,61,
-32,116,46,105,116,101,109,115,91,49,93,0,12,7,0,5,
-105,116,101,109,115,0,0,0,9,6,2,7,11,7,0,0,
-0,0,0,0,0,0,240,63,9,6,6,7,15,5,6,0,
-30,6,3,134,9,9,105,102,32,105,116,101,109,46,118,97,
-108,32,61,61,32,39,42,39,58,0,0,0,12,7,0,3,
-118,97,108,0,9,6,5,7,12,7,0,1,42,0,0,0,
-23,6,6,7,21,6,0,0,18,0,0,115,30,13,3,135,
+109,112,111,114,116,39,41,44,0,0,0,0,12,17,0,5,
+84,111,107,101,110,0,0,0,13,16,17,0,12,20,0,3,
+112,111,115,0,9,17,2,20,12,18,0,4,110,97,109,101,
+0,0,0,0,12,19,0,6,105,109,112,111,114,116,0,0,
+31,14,17,3,19,14,16,14,30,3,3,140,9,9,9,109,
+111,100,93,41,41,0,0,0,15,15,3,0,27,13,14,2,
+31,8,10,4,19,8,9,8,50,5,6,1,15,4,5,0,
+30,5,3,141,9,9,105,116,101,109,32,61,32,116,46,105,
+116,101,109,115,91,49,93,0,12,7,0,5,105,116,101,109,
+115,0,0,0,9,6,2,7,11,7,0,1,1,0,0,0,
+0,0,0,0,9,6,6,7,15,5,6,0,30,6,3,142,
+9,9,105,102,32,105,116,101,109,46,118,97,108,32,61,61,
+32,39,42,39,58,0,0,0,12,7,0,3,118,97,108,0,
+9,6,5,7,12,7,0,1,42,0,0,0,23,6,6,7,
+21,6,0,0,18,0,0,113,30,13,3,143,9,9,9,115,
+101,108,102,46,102,114,101,101,95,116,109,112,40,115,101,108,
+102,46,100,111,40,84,111,107,101,110,40,116,46,112,111,115,
+44,39,99,97,108,108,39,44,78,111,110,101,44,91,0,0,
+12,10,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
+49,7,1,10,12,13,0,2,100,111,0,0,49,10,1,13,
+12,14,0,5,84,111,107,101,110,0,0,0,13,13,14,0,
+12,18,0,3,112,111,115,0,9,14,2,18,12,15,0,4,
+99,97,108,108,0,0,0,0,28,16,0,0,30,9,3,144,
+9,9,9,9,84,111,107,101,110,40,116,46,112,111,115,44,
+39,110,97,109,101,39,44,39,109,101,114,103,101,39,41,44,
+0,0,0,0,12,22,0,5,84,111,107,101,110,0,0,0,
+13,21,22,0,12,25,0,3,112,111,115,0,9,22,2,25,
+12,23,0,4,110,97,109,101,0,0,0,0,12,24,0,5,
+109,101,114,103,101,0,0,0,31,18,22,3,19,18,21,18,
+30,9,3,145,9,9,9,9,84,111,107,101,110,40,116,46,
+112,111,115,44,39,110,97,109,101,39,44,39,95,95,100,105,
+99,116,95,95,39,41,44,0,12,22,0,5,84,111,107,101,
+110,0,0,0,13,21,22,0,12,25,0,3,112,111,115,0,
+9,22,2,25,12,23,0,4,110,97,109,101,0,0,0,0,
+12,24,0,8,95,95,100,105,99,116,95,95,0,0,0,0,
+31,19,22,3,19,19,21,19,30,9,3,146,9,9,9,9,
+84,111,107,101,110,40,116,46,112,111,115,44,39,114,101,103,
+39,44,118,41,93,41,41,41,32,35,82,69,71,0,0,0,
+12,22,0,5,84,111,107,101,110,0,0,0,13,21,22,0,
+12,25,0,3,112,111,115,0,9,22,2,25,12,23,0,3,
+114,101,103,0,15,24,4,0,31,20,22,3,19,20,21,20,
+27,17,18,3,31,12,14,4,19,12,13,12,50,9,10,1,
+50,6,7,1,18,0,0,131,30,2,3,147,9,9,101,108,
+115,101,58,0,30,6,3,148,9,9,9,105,116,101,109,46,
+116,121,112,101,32,61,32,39,115,116,114,105,110,103,39,0,
+12,6,0,6,115,116,114,105,110,103,0,0,12,7,0,4,
+116,121,112,101,0,0,0,0,10,5,7,6,30,9,3,149,
 9,9,9,115,101,108,102,46,102,114,101,101,95,116,109,112,
-40,115,101,108,102,46,100,111,40,84,111,107,101,110,40,116,
-46,112,111,115,44,39,99,97,108,108,39,44,78,111,110,101,
-44,91,0,0,12,8,0,8,102,114,101,101,95,116,109,112,
-0,0,0,0,9,7,1,8,12,10,0,2,100,111,0,0,
-9,9,1,10,12,12,0,5,84,111,107,101,110,0,0,0,
-13,11,12,0,12,16,0,3,112,111,115,0,9,12,2,16,
-12,13,0,4,99,97,108,108,0,0,0,0,28,14,0,0,
-30,9,3,136,9,9,9,9,84,111,107,101,110,40,116,46,
-112,111,115,44,39,110,97,109,101,39,44,39,109,101,114,103,
-101,39,41,44,0,0,0,0,12,20,0,5,84,111,107,101,
-110,0,0,0,13,19,20,0,12,23,0,3,112,111,115,0,
-9,20,2,23,12,21,0,4,110,97,109,101,0,0,0,0,
-12,22,0,5,109,101,114,103,101,0,0,0,31,16,20,3,
-19,16,19,16,30,9,3,137,9,9,9,9,84,111,107,101,
-110,40,116,46,112,111,115,44,39,110,97,109,101,39,44,39,
-95,95,100,105,99,116,95,95,39,41,44,0,12,20,0,5,
-84,111,107,101,110,0,0,0,13,19,20,0,12,23,0,3,
-112,111,115,0,9,20,2,23,12,21,0,4,110,97,109,101,
-0,0,0,0,12,22,0,8,95,95,100,105,99,116,95,95,
-0,0,0,0,31,17,20,3,19,17,19,17,30,9,3,138,
+40,115,101,108,102,46,100,111,95,115,101,116,95,99,116,120,
+40,0,0,0,12,10,0,8,102,114,101,101,95,116,109,112,
+0,0,0,0,49,7,1,10,12,14,0,10,100,111,95,115,
+101,116,95,99,116,120,0,0,49,10,1,14,30,17,3,150,
 9,9,9,9,84,111,107,101,110,40,116,46,112,111,115,44,
-39,114,101,103,39,44,118,41,93,41,41,41,32,35,82,69,
-71,0,0,0,12,20,0,5,84,111,107,101,110,0,0,0,
-13,19,20,0,12,23,0,3,112,111,115,0,9,20,2,23,
-12,21,0,3,114,101,103,0,15,22,4,0,31,18,20,3,
-19,18,19,18,27,15,16,3,31,10,12,4,19,10,11,10,
-31,8,10,1,19,8,9,8,31,6,8,1,19,6,7,6,
-18,0,0,133,30,2,3,139,9,9,101,108,115,101,58,0,
-30,6,3,140,9,9,9,105,116,101,109,46,116,121,112,101,
-32,61,32,39,115,116,114,105,110,103,39,0,12,6,0,6,
-115,116,114,105,110,103,0,0,12,7,0,4,116,121,112,101,
-0,0,0,0,10,5,7,6,30,9,3,141,9,9,9,115,
-101,108,102,46,102,114,101,101,95,116,109,112,40,115,101,108,
-102,46,100,111,95,115,101,116,95,99,116,120,40,0,0,0,
-12,8,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
-9,7,1,8,12,10,0,10,100,111,95,115,101,116,95,99,
-116,120,0,0,9,9,1,10,30,17,3,142,9,9,9,9,
-84,111,107,101,110,40,116,46,112,111,115,44,39,103,101,116,
-39,44,78,111,110,101,44,91,32,84,111,107,101,110,40,116,
-46,112,111,115,44,39,110,97,109,101,39,44,39,95,95,100,
-105,99,116,95,95,39,41,44,105,116,101,109,93,41,44,0,
-12,13,0,5,84,111,107,101,110,0,0,0,13,12,13,0,
-12,17,0,3,112,111,115,0,9,13,2,17,12,14,0,3,
-103,101,116,0,28,15,0,0,12,20,0,5,84,111,107,101,
-110,0,0,0,13,19,20,0,12,23,0,3,112,111,115,0,
-9,20,2,23,12,21,0,4,110,97,109,101,0,0,0,0,
-12,22,0,8,95,95,100,105,99,116,95,95,0,0,0,0,
-31,17,20,3,19,17,19,17,15,18,5,0,27,16,17,2,
-31,10,13,4,19,10,12,10,30,15,3,143,9,9,9,9,
-84,111,107,101,110,40,116,46,112,111,115,44,39,103,101,116,
-39,44,78,111,110,101,44,91,32,84,111,107,101,110,40,116,
-46,112,111,115,44,39,114,101,103,39,44,118,41,44,105,116,
-101,109,93,41,0,0,0,0,12,13,0,5,84,111,107,101,
-110,0,0,0,13,12,13,0,12,17,0,3,112,111,115,0,
-9,13,2,17,12,14,0,3,103,101,116,0,28,15,0,0,
-12,20,0,5,84,111,107,101,110,0,0,0,13,19,20,0,
-12,23,0,3,112,111,115,0,9,20,2,23,12,21,0,3,
-114,101,103,0,15,22,4,0,31,17,20,3,19,17,19,17,
-15,18,5,0,27,16,17,2,31,11,13,4,19,11,12,11,
-31,8,10,2,19,8,9,8,31,6,8,1,19,6,7,6,
-18,0,0,1,0,0,0,0,12,80,0,7,100,111,95,102,
-114,111,109,0,10,7,80,79,16,80,0,92,44,9,0,0,
-30,7,3,147,9,100,101,102,32,100,111,95,103,108,111,98,
-97,108,115,40,115,101,108,102,44,116,41,58,0,0,0,0,
-12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
-33,1,0,0,12,1,0,10,100,111,95,103,108,111,98,97,
-108,115,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,3,0,0,9,2,0,3,30,5,3,148,9,9,102,111,
-114,32,116,32,105,110,32,116,46,105,116,101,109,115,58,0,
-12,4,0,5,105,116,101,109,115,0,0,0,9,3,2,4,
-11,4,0,0,0,0,0,0,0,0,0,0,42,2,3,4,
-18,0,0,53,30,8,3,149,9,9,9,105,102,32,116,46,
-118,97,108,32,110,111,116,32,105,110,32,68,46,103,108,111,
-98,97,108,115,58,0,0,0,12,6,0,1,68,0,0,0,
-13,5,6,0,12,6,0,7,103,108,111,98,97,108,115,0,
-9,5,5,6,12,7,0,3,118,97,108,0,9,6,2,7,
-36,5,5,6,11,6,0,0,0,0,0,0,0,0,0,0,
-23,5,5,6,21,5,0,0,18,0,0,26,30,7,3,150,
-9,9,9,9,68,46,103,108,111,98,97,108,115,46,97,112,
-112,101,110,100,40,116,46,118,97,108,41,0,12,7,0,1,
-68,0,0,0,13,6,7,0,12,7,0,7,103,108,111,98,
-97,108,115,0,9,6,6,7,12,7,0,6,97,112,112,101,
-110,100,0,0,9,6,6,7,12,8,0,3,118,97,108,0,
-9,7,2,8,31,5,7,1,19,5,6,5,18,0,0,1,
-18,0,255,203,0,0,0,0,12,81,0,10,100,111,95,103,
-108,111,98,97,108,115,0,0,10,7,81,80,16,81,0,133,
-44,14,0,0,30,6,3,153,9,100,101,102,32,100,111,95,
-100,101,108,40,115,101,108,102,44,116,116,41,58,0,0,0,
-12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
-33,1,0,0,12,1,0,6,100,111,95,100,101,108,0,0,
+39,103,101,116,39,44,78,111,110,101,44,91,32,84,111,107,
+101,110,40,116,46,112,111,115,44,39,110,97,109,101,39,44,
+39,95,95,100,105,99,116,95,95,39,41,44,105,116,101,109,
+93,41,44,0,12,15,0,5,84,111,107,101,110,0,0,0,
+13,14,15,0,12,19,0,3,112,111,115,0,9,15,2,19,
+12,16,0,3,103,101,116,0,28,17,0,0,12,22,0,5,
+84,111,107,101,110,0,0,0,13,21,22,0,12,25,0,3,
+112,111,115,0,9,22,2,25,12,23,0,4,110,97,109,101,
+0,0,0,0,12,24,0,8,95,95,100,105,99,116,95,95,
+0,0,0,0,31,19,22,3,19,19,21,19,15,20,5,0,
+27,18,19,2,31,12,15,4,19,12,14,12,30,15,3,151,
+9,9,9,9,84,111,107,101,110,40,116,46,112,111,115,44,
+39,103,101,116,39,44,78,111,110,101,44,91,32,84,111,107,
+101,110,40,116,46,112,111,115,44,39,114,101,103,39,44,118,
+41,44,105,116,101,109,93,41,0,0,0,0,12,15,0,5,
+84,111,107,101,110,0,0,0,13,14,15,0,12,19,0,3,
+112,111,115,0,9,15,2,19,12,16,0,3,103,101,116,0,
+28,17,0,0,12,22,0,5,84,111,107,101,110,0,0,0,
+13,21,22,0,12,25,0,3,112,111,115,0,9,22,2,25,
+12,23,0,3,114,101,103,0,15,24,4,0,31,19,22,3,
+19,19,21,19,15,20,5,0,27,18,19,2,31,13,15,4,
+19,13,14,13,50,9,10,2,50,6,7,1,18,0,0,1,
+0,0,0,0,12,81,0,7,100,111,95,102,114,111,109,0,
+10,8,81,80,16,81,0,91,44,11,0,0,30,7,3,155,
+9,100,101,102,32,100,111,95,103,108,111,98,97,108,115,40,
+115,101,108,102,44,116,41,58,0,0,0,0,12,1,0,9,
+116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
+12,1,0,10,100,111,95,103,108,111,98,97,108,115,0,0,
 34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,30,6,3,154,9,9,102,111,114,32,116,32,
-105,110,32,116,116,46,105,116,101,109,115,58,0,0,0,0,
-12,5,0,5,105,116,101,109,115,0,0,0,9,4,2,5,
-11,5,0,0,0,0,0,0,0,0,0,0,42,3,4,5,
-18,0,0,95,30,7,3,155,9,9,9,114,32,61,32,115,
-101,108,102,46,100,111,40,116,46,105,116,101,109,115,91,48,
-93,41,0,0,12,9,0,2,100,111,0,0,9,8,1,9,
-12,10,0,5,105,116,101,109,115,0,0,0,9,9,3,10,
-11,10,0,0,0,0,0,0,0,0,0,0,9,9,9,10,
-31,7,9,1,19,7,8,7,15,6,7,0,30,7,3,156,
-9,9,9,114,50,32,61,32,115,101,108,102,46,100,111,40,
-116,46,105,116,101,109,115,91,49,93,41,0,12,10,0,2,
-100,111,0,0,9,9,1,10,12,11,0,5,105,116,101,109,
-115,0,0,0,9,10,3,11,11,11,0,0,0,0,0,0,
-0,0,240,63,9,10,10,11,31,8,10,1,19,8,9,8,
-15,7,8,0,30,8,3,157,9,9,9,115,101,108,102,46,
+9,2,0,3,30,5,3,156,9,9,102,111,114,32,116,32,
+105,110,32,116,46,105,116,101,109,115,58,0,12,4,0,5,
+105,116,101,109,115,0,0,0,9,3,2,4,11,4,0,1,
+0,0,0,0,0,0,0,0,42,2,3,4,18,0,0,52,
+30,8,3,157,9,9,9,105,102,32,116,46,118,97,108,32,
+110,111,116,32,105,110,32,68,46,103,108,111,98,97,108,115,
+58,0,0,0,12,6,0,1,68,0,0,0,13,5,6,0,
+12,6,0,7,103,108,111,98,97,108,115,0,9,5,5,6,
+12,7,0,3,118,97,108,0,9,6,2,7,36,5,5,6,
+11,6,0,1,0,0,0,0,0,0,0,0,23,5,5,6,
+21,5,0,0,18,0,0,25,30,7,3,158,9,9,9,9,
+68,46,103,108,111,98,97,108,115,46,97,112,112,101,110,100,
+40,116,46,118,97,108,41,0,12,10,0,1,68,0,0,0,
+13,9,10,0,12,10,0,7,103,108,111,98,97,108,115,0,
+9,9,9,10,12,10,0,6,97,112,112,101,110,100,0,0,
+49,6,9,10,12,9,0,3,118,97,108,0,9,8,2,9,
+50,5,6,1,18,0,0,1,18,0,255,204,0,0,0,0,
+12,82,0,10,100,111,95,103,108,111,98,97,108,115,0,0,
+10,8,82,81,16,82,0,128,44,15,0,0,30,6,3,161,
+9,100,101,102,32,100,111,95,100,101,108,40,115,101,108,102,
+44,116,116,41,58,0,0,0,12,1,0,9,116,105,110,121,
+112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,6,
+100,111,95,100,101,108,0,0,34,1,0,0,28,2,0,0,
+9,1,0,2,28,3,0,0,9,2,0,3,30,6,3,162,
+9,9,102,111,114,32,116,32,105,110,32,116,116,46,105,116,
+101,109,115,58,0,0,0,0,12,5,0,5,105,116,101,109,
+115,0,0,0,9,4,2,5,11,5,0,1,0,0,0,0,
+0,0,0,0,42,3,4,5,18,0,0,90,30,7,3,163,
+9,9,9,114,32,61,32,115,101,108,102,46,100,111,40,116,
+46,105,116,101,109,115,91,48,93,41,0,0,12,11,0,2,
+100,111,0,0,49,8,1,11,12,11,0,5,105,116,101,109,
+115,0,0,0,9,10,3,11,11,11,0,1,0,0,0,0,
+0,0,0,0,9,10,10,11,50,7,8,1,15,6,7,0,
+30,7,3,164,9,9,9,114,50,32,61,32,115,101,108,102,
+46,100,111,40,116,46,105,116,101,109,115,91,49,93,41,0,
+12,12,0,2,100,111,0,0,49,9,1,12,12,12,0,5,
+105,116,101,109,115,0,0,0,9,11,3,12,11,12,0,1,
+1,0,0,0,0,0,0,0,9,11,11,12,50,8,9,1,
+15,7,8,0,30,8,3,165,9,9,9,115,101,108,102,46,
 100,111,95,99,111,100,101,40,79,80,95,68,69,76,44,114,
-44,114,50,41,0,0,0,0,12,10,0,7,100,111,95,99,
-111,100,101,0,9,9,1,10,12,13,0,6,79,80,95,68,
-69,76,0,0,13,10,13,0,15,11,6,0,15,12,7,0,
-31,8,10,3,19,8,9,8,30,11,3,158,9,9,9,115,
-101,108,102,46,102,114,101,101,95,116,109,112,40,114,41,59,
-32,115,101,108,102,46,102,114,101,101,95,116,109,112,40,114,
-50,41,32,35,82,69,71,0,12,10,0,8,102,114,101,101,
-95,116,109,112,0,0,0,0,9,9,1,10,15,10,6,0,
-31,8,10,1,19,8,9,8,12,10,0,8,102,114,101,101,
-95,116,109,112,0,0,0,0,9,9,1,10,15,10,7,0,
-31,8,10,1,19,8,9,8,18,0,255,161,0,0,0,0,
-12,82,0,6,100,111,95,100,101,108,0,0,10,7,82,81,
-16,82,2,143,44,32,0,0,30,8,3,161,9,100,101,102,
-32,100,111,95,99,97,108,108,40,115,101,108,102,44,116,44,
-114,61,78,111,110,101,41,58,0,0,0,0,12,1,0,9,
-116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,7,100,111,95,99,97,108,108,0,34,1,0,0,
-28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-28,3,0,0,28,4,0,0,32,3,0,4,30,6,3,162,
-9,9,114,32,61,32,115,101,108,102,46,103,101,116,95,116,
-109,112,40,114,41,0,0,0,12,6,0,7,103,101,116,95,
-116,109,112,0,9,5,1,6,15,6,3,0,31,4,6,1,
-19,4,5,4,15,3,4,0,30,5,3,163,9,9,105,116,
+44,114,50,41,0,0,0,0,12,14,0,7,100,111,95,99,
+111,100,101,0,49,9,1,14,12,14,0,6,79,80,95,68,
+69,76,0,0,13,11,14,0,15,12,6,0,15,13,7,0,
+50,8,9,3,30,11,3,166,9,9,9,115,101,108,102,46,
+102,114,101,101,95,116,109,112,40,114,41,59,32,115,101,108,
+102,46,102,114,101,101,95,116,109,112,40,114,50,41,32,35,
+82,69,71,0,12,12,0,8,102,114,101,101,95,116,109,112,
+0,0,0,0,49,9,1,12,15,11,6,0,50,8,9,1,
+12,12,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
+49,9,1,12,15,11,7,0,50,8,9,1,18,0,255,166,
+0,0,0,0,12,83,0,6,100,111,95,100,101,108,0,0,
+10,8,83,82,16,83,2,200,44,34,0,0,30,8,3,169,
+9,100,101,102,32,100,111,95,99,97,108,108,40,115,101,108,
+102,44,116,44,114,61,78,111,110,101,41,58,0,0,0,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,7,100,111,95,99,97,108,108,0,
+34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
+9,2,0,3,28,3,0,0,28,4,0,0,32,3,0,4,
+30,6,3,170,9,9,114,32,61,32,115,101,108,102,46,103,
+101,116,95,116,109,112,40,114,41,0,0,0,12,8,0,7,
+103,101,116,95,116,109,112,0,49,5,1,8,15,7,3,0,
+50,4,5,1,15,3,4,0,30,5,3,171,9,9,105,116,
 101,109,115,32,61,32,116,46,105,116,101,109,115,0,0,0,
 12,6,0,5,105,116,101,109,115,0,0,0,9,5,2,6,
-15,4,5,0,30,7,3,164,9,9,102,110,99,32,61,32,
-115,101,108,102,46,100,111,40,105,116,101,109,115,91,48,93,
-41,0,0,0,12,8,0,2,100,111,0,0,9,7,1,8,
-11,9,0,0,0,0,0,0,0,0,0,0,9,8,4,9,
-31,6,8,1,19,6,7,6,15,5,6,0,30,10,3,165,
-9,9,97,44,98,44,99,44,100,32,61,32,115,101,108,102,
-46,112,95,102,105,108,116,101,114,40,116,46,105,116,101,109,
-115,91,49,58,93,41,0,0,12,8,0,8,112,95,102,105,
-108,116,101,114,0,0,0,0,9,7,1,8,12,9,0,5,
-105,116,101,109,115,0,0,0,9,8,2,9,11,10,0,0,
-0,0,0,0,0,0,240,63,28,11,0,0,27,9,10,2,
-9,8,8,9,31,6,8,1,19,6,7,6,11,9,0,0,
-0,0,0,0,0,0,0,0,9,8,6,9,15,7,8,0,
-11,10,0,0,0,0,0,0,0,0,240,63,9,9,6,10,
-15,8,9,0,11,11,0,0,0,0,0,0,0,0,0,64,
-9,10,6,11,15,9,10,0,11,12,0,0,0,0,0,0,
-0,0,8,64,9,11,6,12,15,10,11,0,30,3,3,166,
-9,9,101,32,61,32,78,111,110,101,0,0,28,11,0,0,
-15,6,11,0,30,8,3,167,9,9,105,102,32,108,101,110,
-40,98,41,32,33,61,32,48,32,111,114,32,100,32,33,61,
-32,78,111,110,101,58,0,0,12,13,0,3,108,101,110,0,
-13,12,13,0,15,13,8,0,31,11,13,1,19,11,12,11,
-11,12,0,0,0,0,0,0,0,0,0,0,35,11,11,12,
-46,11,0,0,18,0,0,3,28,12,0,0,35,11,10,12,
-21,11,0,0,18,0,1,18,30,16,3,168,9,9,9,101,
-32,61,32,115,101,108,102,46,100,111,40,84,111,107,101,110,
-40,116,46,112,111,115,44,39,100,105,99,116,39,44,78,111,
-110,101,44,91,93,41,41,59,32,115,101,108,102,46,117,110,
-95,116,109,112,40,101,41,59,0,0,0,0,12,13,0,2,
-100,111,0,0,9,12,1,13,12,15,0,5,84,111,107,101,
-110,0,0,0,13,14,15,0,12,19,0,3,112,111,115,0,
-9,15,2,19,12,16,0,4,100,105,99,116,0,0,0,0,
-28,17,0,0,27,18,0,0,31,13,15,4,19,13,14,13,
-31,11,13,1,19,11,12,11,15,6,11,0,12,13,0,6,
-117,110,95,116,109,112,0,0,9,12,1,13,15,13,6,0,
-31,11,13,1,19,11,12,11,30,4,3,169,9,9,9,102,
-111,114,32,112,32,105,110,32,98,58,0,0,11,12,0,0,
-0,0,0,0,0,0,0,0,42,11,8,12,18,0,0,122,
-30,8,3,170,9,9,9,9,112,46,105,116,101,109,115,91,
+15,4,5,0,30,10,3,172,9,9,97,44,98,44,99,44,
+100,32,61,32,115,101,108,102,46,112,95,102,105,108,116,101,
+114,40,116,46,105,116,101,109,115,91,49,58,93,41,0,0,
+12,9,0,8,112,95,102,105,108,116,101,114,0,0,0,0,
+49,6,1,9,12,9,0,5,105,116,101,109,115,0,0,0,
+9,8,2,9,11,10,0,1,1,0,0,0,0,0,0,0,
+28,11,0,0,27,9,10,2,9,8,8,9,50,5,6,1,
+11,8,0,1,0,0,0,0,0,0,0,0,9,7,5,8,
+15,6,7,0,11,9,0,1,1,0,0,0,0,0,0,0,
+9,8,5,9,15,7,8,0,11,10,0,1,2,0,0,0,
+0,0,0,0,9,9,5,10,15,8,9,0,11,11,0,1,
+3,0,0,0,0,0,0,0,9,10,5,11,15,9,10,0,
+30,19,3,173,9,9,105,102,32,105,116,101,109,115,91,48,
+93,46,116,121,112,101,32,61,61,32,39,103,101,116,39,32,
+97,110,100,32,108,101,110,40,98,41,32,61,61,32,48,32,
+97,110,100,32,99,32,61,61,32,78,111,110,101,32,97,110,
+100,32,100,32,61,61,32,78,111,110,101,58,0,0,0,0,
+11,10,0,1,0,0,0,0,0,0,0,0,9,5,4,10,
+12,10,0,4,116,121,112,101,0,0,0,0,9,5,5,10,
+12,10,0,3,103,101,116,0,23,5,5,10,21,5,0,0,
+18,0,0,11,12,11,0,3,108,101,110,0,13,10,11,0,
+15,11,7,0,31,5,11,1,19,5,10,5,11,10,0,1,
+0,0,0,0,0,0,0,0,23,5,5,10,21,5,0,0,
+18,0,0,3,28,10,0,0,23,5,8,10,21,5,0,0,
+18,0,0,3,28,10,0,0,23,5,9,10,21,5,0,0,
+18,0,0,28,30,11,3,174,9,9,9,114,101,116,117,114,
+110,32,115,101,108,102,46,100,111,95,109,101,116,104,111,100,
+95,99,97,108,108,40,105,116,101,109,115,91,48,93,44,97,
+44,114,41,0,12,15,0,14,100,111,95,109,101,116,104,111,
+100,95,99,97,108,108,0,0,49,10,1,15,11,15,0,1,
+0,0,0,0,0,0,0,0,9,12,4,15,15,13,6,0,
+15,14,3,0,50,5,10,3,20,5,0,0,18,0,0,1,
+30,7,3,175,9,9,102,110,99,32,61,32,115,101,108,102,
+46,100,111,40,105,116,101,109,115,91,48,93,41,0,0,0,
+12,14,0,2,100,111,0,0,49,11,1,14,11,14,0,1,
+0,0,0,0,0,0,0,0,9,13,4,14,50,10,11,1,
+15,5,10,0,30,3,3,176,9,9,101,32,61,32,78,111,
+110,101,0,0,28,11,0,0,15,10,11,0,30,8,3,177,
+9,9,105,102,32,108,101,110,40,98,41,32,33,61,32,48,
+32,111,114,32,100,32,33,61,32,78,111,110,101,58,0,0,
+12,13,0,3,108,101,110,0,13,12,13,0,15,13,7,0,
+31,11,13,1,19,11,12,11,11,12,0,1,0,0,0,0,
+0,0,0,0,35,11,11,12,46,11,0,0,18,0,0,3,
+28,12,0,0,35,11,9,12,21,11,0,0,18,0,1,9,
+30,16,3,178,9,9,9,101,32,61,32,115,101,108,102,46,
+100,111,40,84,111,107,101,110,40,116,46,112,111,115,44,39,
+100,105,99,116,39,44,78,111,110,101,44,91,93,41,41,59,
+32,115,101,108,102,46,117,110,95,116,109,112,40,101,41,59,
+0,0,0,0,12,15,0,2,100,111,0,0,49,12,1,15,
+12,16,0,5,84,111,107,101,110,0,0,0,13,15,16,0,
+12,20,0,3,112,111,115,0,9,16,2,20,12,17,0,4,
+100,105,99,116,0,0,0,0,28,18,0,0,27,19,0,0,
+31,14,16,4,19,14,15,14,50,11,12,1,15,10,11,0,
+12,15,0,6,117,110,95,116,109,112,0,0,49,12,1,15,
+15,14,10,0,50,11,12,1,30,4,3,179,9,9,9,102,
+111,114,32,112,32,105,110,32,98,58,0,0,11,12,0,1,
+0,0,0,0,0,0,0,0,42,11,7,12,18,0,0,117,
+30,8,3,180,9,9,9,9,112,46,105,116,101,109,115,91,
 48,93,46,116,121,112,101,32,61,32,39,115,116,114,105,110,
 103,39,0,0,12,14,0,5,105,116,101,109,115,0,0,0,
-9,13,11,14,11,14,0,0,0,0,0,0,0,0,0,0,
+9,13,11,14,11,14,0,1,0,0,0,0,0,0,0,0,
 9,13,13,14,12,14,0,6,115,116,114,105,110,103,0,0,
 12,15,0,4,116,121,112,101,0,0,0,0,10,13,15,14,
-30,13,3,171,9,9,9,9,116,49,44,116,50,32,61,32,
+30,13,3,181,9,9,9,9,116,49,44,116,50,32,61,32,
 115,101,108,102,46,100,111,40,112,46,105,116,101,109,115,91,
 48,93,41,44,115,101,108,102,46,100,111,40,112,46,105,116,
-101,109,115,91,49,93,41,0,12,16,0,2,100,111,0,0,
-9,15,1,16,12,17,0,5,105,116,101,109,115,0,0,0,
-9,16,11,17,11,17,0,0,0,0,0,0,0,0,0,0,
-9,16,16,17,31,14,16,1,19,14,15,14,15,13,14,0,
-12,17,0,2,100,111,0,0,9,16,1,17,12,18,0,5,
-105,116,101,109,115,0,0,0,9,17,11,18,11,18,0,0,
-0,0,0,0,0,0,240,63,9,17,17,18,31,15,17,1,
-19,15,16,15,15,14,15,0,15,15,13,0,15,13,14,0,
-30,9,3,172,9,9,9,9,115,101,108,102,46,100,111,95,
-99,111,100,101,40,79,80,95,83,69,84,44,101,44,116,49,
-44,116,50,41,0,0,0,0,12,17,0,7,100,111,95,99,
-111,100,101,0,9,16,1,17,12,21,0,6,79,80,95,83,
-69,84,0,0,13,17,21,0,15,18,6,0,15,19,15,0,
-15,20,13,0,31,14,17,4,19,14,16,14,30,12,3,173,
-9,9,9,9,115,101,108,102,46,102,114,101,101,95,116,109,
-112,40,116,49,41,59,32,115,101,108,102,46,102,114,101,101,
-95,116,109,112,40,116,50,41,32,35,82,69,71,0,0,0,
-12,17,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
-9,16,1,17,15,17,15,0,31,14,17,1,19,14,16,14,
-12,17,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
-9,16,1,17,15,17,13,0,31,14,17,1,19,14,16,14,
-18,0,255,134,30,32,3,174,9,9,9,105,102,32,100,58,
-32,115,101,108,102,46,102,114,101,101,95,116,109,112,40,115,
-101,108,102,46,100,111,40,84,111,107,101,110,40,116,46,112,
-111,115,44,39,99,97,108,108,39,44,78,111,110,101,44,91,
-84,111,107,101,110,40,116,46,112,111,115,44,39,110,97,109,
-101,39,44,39,109,101,114,103,101,39,41,44,84,111,107,101,
-110,40,116,46,112,111,115,44,39,114,101,103,39,44,101,41,
-44,100,46,105,116,101,109,115,91,48,93,93,41,41,41,32,
-35,82,69,71,0,0,0,0,21,10,0,0,18,0,0,63,
-12,16,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
-9,14,1,16,12,18,0,2,100,111,0,0,9,17,1,18,
-12,20,0,5,84,111,107,101,110,0,0,0,13,19,20,0,
-12,24,0,3,112,111,115,0,9,20,2,24,12,21,0,4,
-99,97,108,108,0,0,0,0,28,22,0,0,12,28,0,5,
-84,111,107,101,110,0,0,0,13,27,28,0,12,31,0,3,
-112,111,115,0,9,28,2,31,12,29,0,4,110,97,109,101,
-0,0,0,0,12,30,0,5,109,101,114,103,101,0,0,0,
-31,24,28,3,19,24,27,24,12,28,0,5,84,111,107,101,
-110,0,0,0,13,27,28,0,12,31,0,3,112,111,115,0,
-9,28,2,31,12,29,0,3,114,101,103,0,15,30,6,0,
-31,25,28,3,19,25,27,25,12,27,0,5,105,116,101,109,
-115,0,0,0,9,26,10,27,11,27,0,0,0,0,0,0,
-0,0,0,0,9,26,26,27,27,23,24,3,31,18,20,4,
-19,18,19,18,31,16,18,1,19,16,17,16,31,12,16,1,
-19,12,14,12,18,0,0,1,18,0,0,1,30,9,3,175,
-9,9,115,101,108,102,46,109,97,110,97,103,101,95,115,101,
-113,40,79,80,95,80,65,82,65,77,83,44,114,44,97,41,
-0,0,0,0,12,16,0,10,109,97,110,97,103,101,95,115,
-101,113,0,0,9,14,1,16,12,19,0,9,79,80,95,80,
-65,82,65,77,83,0,0,0,13,16,19,0,15,17,3,0,
-15,18,7,0,31,12,16,3,19,12,14,12,30,4,3,176,
+101,109,115,91,49,93,41,0,12,18,0,2,100,111,0,0,
+49,15,1,18,12,18,0,5,105,116,101,109,115,0,0,0,
+9,17,11,18,11,18,0,1,0,0,0,0,0,0,0,0,
+9,17,17,18,50,14,15,1,15,13,14,0,12,19,0,2,
+100,111,0,0,49,16,1,19,12,19,0,5,105,116,101,109,
+115,0,0,0,9,18,11,19,11,19,0,1,1,0,0,0,
+0,0,0,0,9,18,18,19,50,15,16,1,15,14,15,0,
+15,15,13,0,15,13,14,0,30,9,3,182,9,9,9,9,
+115,101,108,102,46,100,111,95,99,111,100,101,40,79,80,95,
+83,69,84,44,101,44,116,49,44,116,50,41,0,0,0,0,
+12,22,0,7,100,111,95,99,111,100,101,0,49,16,1,22,
+12,22,0,6,79,80,95,83,69,84,0,0,13,18,22,0,
+15,19,10,0,15,20,15,0,15,21,13,0,50,14,16,4,
+30,12,3,183,9,9,9,9,115,101,108,102,46,102,114,101,
+101,95,116,109,112,40,116,49,41,59,32,115,101,108,102,46,
+102,114,101,101,95,116,109,112,40,116,50,41,32,35,82,69,
+71,0,0,0,12,19,0,8,102,114,101,101,95,116,109,112,
+0,0,0,0,49,16,1,19,15,18,15,0,50,14,16,1,
+12,19,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
+49,16,1,19,15,18,13,0,50,14,16,1,18,0,255,139,
+30,32,3,184,9,9,9,105,102,32,100,58,32,115,101,108,
+102,46,102,114,101,101,95,116,109,112,40,115,101,108,102,46,
+100,111,40,84,111,107,101,110,40,116,46,112,111,115,44,39,
+99,97,108,108,39,44,78,111,110,101,44,91,84,111,107,101,
+110,40,116,46,112,111,115,44,39,110,97,109,101,39,44,39,
+109,101,114,103,101,39,41,44,84,111,107,101,110,40,116,46,
+112,111,115,44,39,114,101,103,39,44,101,41,44,100,46,105,
+116,101,109,115,91,48,93,93,41,41,41,32,35,82,69,71,
+0,0,0,0,21,9,0,0,18,0,0,61,12,14,0,8,
+102,114,101,101,95,116,109,112,0,0,0,0,49,16,1,14,
+12,14,0,2,100,111,0,0,49,19,1,14,12,22,0,5,
+84,111,107,101,110,0,0,0,13,14,22,0,12,26,0,3,
+112,111,115,0,9,22,2,26,12,23,0,4,99,97,108,108,
+0,0,0,0,28,24,0,0,12,30,0,5,84,111,107,101,
+110,0,0,0,13,29,30,0,12,33,0,3,112,111,115,0,
+9,30,2,33,12,31,0,4,110,97,109,101,0,0,0,0,
+12,32,0,5,109,101,114,103,101,0,0,0,31,26,30,3,
+19,26,29,26,12,30,0,5,84,111,107,101,110,0,0,0,
+13,29,30,0,12,33,0,3,112,111,115,0,9,30,2,33,
+12,31,0,3,114,101,103,0,15,32,10,0,31,27,30,3,
+19,27,29,27,12,29,0,5,105,116,101,109,115,0,0,0,
+9,28,9,29,11,29,0,1,0,0,0,0,0,0,0,0,
+9,28,28,29,27,25,26,3,31,21,22,4,19,21,14,21,
+50,18,19,1,50,12,16,1,18,0,0,1,18,0,0,1,
+30,9,3,185,9,9,115,101,108,102,46,109,97,110,97,103,
+101,95,115,101,113,40,79,80,95,80,65,82,65,77,83,44,
+114,44,97,41,0,0,0,0,12,14,0,10,109,97,110,97,
+103,101,95,115,101,113,0,0,49,16,1,14,12,14,0,9,
+79,80,95,80,65,82,65,77,83,0,0,0,13,18,14,0,
+15,19,3,0,15,20,6,0,50,12,16,3,30,4,3,186,
 9,9,105,102,32,99,32,33,61,32,78,111,110,101,58,0,
-28,14,0,0,35,12,9,14,21,12,0,0,18,0,0,93,
-30,13,3,177,9,9,9,116,49,44,116,50,32,61,32,115,
+28,14,0,0,35,12,8,14,21,12,0,0,18,0,0,88,
+30,13,3,187,9,9,9,116,49,44,116,50,32,61,32,115,
 101,108,102,46,95,100,111,95,115,116,114,105,110,103,40,39,
 42,39,41,44,115,101,108,102,46,100,111,40,99,46,105,116,
-101,109,115,91,48,93,41,0,12,17,0,10,95,100,111,95,
-115,116,114,105,110,103,0,0,9,16,1,17,12,17,0,1,
-42,0,0,0,31,14,17,1,19,14,16,14,15,12,14,0,
-12,18,0,2,100,111,0,0,9,17,1,18,12,19,0,5,
-105,116,101,109,115,0,0,0,9,18,9,19,11,19,0,0,
-0,0,0,0,0,0,0,0,9,18,18,19,31,16,18,1,
-19,16,17,16,15,14,16,0,15,15,12,0,15,13,14,0,
-30,8,3,178,9,9,9,115,101,108,102,46,100,111,95,99,
-111,100,101,40,79,80,95,83,69,84,44,114,44,116,49,44,
-116,50,41,0,12,16,0,7,100,111,95,99,111,100,101,0,
-9,14,1,16,12,20,0,6,79,80,95,83,69,84,0,0,
-13,16,20,0,15,17,3,0,15,18,15,0,15,19,13,0,
-31,12,16,4,19,12,14,12,30,12,3,179,9,9,9,115,
-101,108,102,46,102,114,101,101,95,116,109,112,40,116,49,41,
-59,32,115,101,108,102,46,102,114,101,101,95,116,109,112,40,
-116,50,41,32,35,82,69,71,0,0,0,0,12,16,0,8,
-102,114,101,101,95,116,109,112,0,0,0,0,9,14,1,16,
-15,16,15,0,31,12,16,1,19,12,14,12,12,16,0,8,
-102,114,101,101,95,116,109,112,0,0,0,0,9,14,1,16,
-15,16,13,0,31,12,16,1,19,12,14,12,18,0,0,1,
-30,4,3,180,9,9,105,102,32,101,32,33,61,32,78,111,
-110,101,58,0,28,14,0,0,35,12,6,14,21,12,0,0,
-18,0,0,55,30,6,3,181,9,9,9,116,49,32,61,32,
-115,101,108,102,46,95,100,111,95,110,111,110,101,40,41,0,
-12,16,0,8,95,100,111,95,110,111,110,101,0,0,0,0,
-9,14,1,16,31,12,0,0,19,12,14,12,15,15,12,0,
-30,8,3,182,9,9,9,115,101,108,102,46,100,111,95,99,
-111,100,101,40,79,80,95,83,69,84,44,114,44,116,49,44,
-101,41,0,0,12,16,0,7,100,111,95,99,111,100,101,0,
-9,14,1,16,12,20,0,6,79,80,95,83,69,84,0,0,
-13,16,20,0,15,17,3,0,15,18,15,0,15,19,6,0,
-31,12,16,4,19,12,14,12,30,7,3,183,9,9,9,115,
-101,108,102,46,102,114,101,101,95,116,109,112,40,116,49,41,
-32,35,82,69,71,0,0,0,12,16,0,8,102,114,101,101,
-95,116,109,112,0,0,0,0,9,14,1,16,15,16,15,0,
-31,12,16,1,19,12,14,12,18,0,0,1,30,8,3,184,
+101,109,115,91,48,93,41,0,12,19,0,10,95,100,111,95,
+115,116,114,105,110,103,0,0,49,16,1,19,12,18,0,1,
+42,0,0,0,50,14,16,1,15,12,14,0,12,20,0,2,
+100,111,0,0,49,17,1,20,12,20,0,5,105,116,101,109,
+115,0,0,0,9,19,8,20,11,20,0,1,0,0,0,0,
+0,0,0,0,9,19,19,20,50,16,17,1,15,14,16,0,
+15,15,12,0,15,13,14,0,30,8,3,188,9,9,9,115,
+101,108,102,46,100,111,95,99,111,100,101,40,79,80,95,83,
+69,84,44,114,44,116,49,44,116,50,41,0,12,14,0,7,
+100,111,95,99,111,100,101,0,49,16,1,14,12,14,0,6,
+79,80,95,83,69,84,0,0,13,18,14,0,15,19,3,0,
+15,20,15,0,15,21,13,0,50,12,16,4,30,12,3,189,
+9,9,9,115,101,108,102,46,102,114,101,101,95,116,109,112,
+40,116,49,41,59,32,115,101,108,102,46,102,114,101,101,95,
+116,109,112,40,116,50,41,32,35,82,69,71,0,0,0,0,
+12,14,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
+49,16,1,14,15,18,15,0,50,12,16,1,12,14,0,8,
+102,114,101,101,95,116,109,112,0,0,0,0,49,16,1,14,
+15,18,13,0,50,12,16,1,18,0,0,1,30,4,3,190,
+9,9,105,102,32,101,32,33,61,32,78,111,110,101,58,0,
+28,14,0,0,35,12,10,14,21,12,0,0,18,0,0,52,
+30,6,3,191,9,9,9,116,49,32,61,32,115,101,108,102,
+46,95,100,111,95,110,111,110,101,40,41,0,12,14,0,8,
+95,100,111,95,110,111,110,101,0,0,0,0,49,16,1,14,
+50,12,16,0,15,15,12,0,30,8,3,192,9,9,9,115,
+101,108,102,46,100,111,95,99,111,100,101,40,79,80,95,83,
+69,84,44,114,44,116,49,44,101,41,0,0,12,14,0,7,
+100,111,95,99,111,100,101,0,49,16,1,14,12,14,0,6,
+79,80,95,83,69,84,0,0,13,18,14,0,15,19,3,0,
+15,20,15,0,15,21,10,0,50,12,16,4,30,7,3,193,
+9,9,9,115,101,108,102,46,102,114,101,101,95,116,109,112,
+40,116,49,41,32,35,82,69,71,0,0,0,12,14,0,8,
+102,114,101,101,95,116,109,112,0,0,0,0,49,16,1,14,
+15,18,15,0,50,12,16,1,18,0,0,1,30,8,3,194,
 9,9,115,101,108,102,46,100,111,95,99,111,100,101,40,79,
 80,95,67,65,76,76,44,114,44,102,110,99,44,114,41,0,
-12,16,0,7,100,111,95,99,111,100,101,0,9,14,1,16,
-12,20,0,7,79,80,95,67,65,76,76,0,13,16,20,0,
-15,17,3,0,15,18,5,0,15,19,3,0,31,12,16,4,
-19,12,14,12,30,7,3,185,9,9,115,101,108,102,46,102,
-114,101,101,95,116,109,112,40,102,110,99,41,32,35,82,69,
-71,0,0,0,12,16,0,8,102,114,101,101,95,116,109,112,
-0,0,0,0,9,14,1,16,15,16,5,0,31,12,16,1,
-19,12,14,12,30,3,3,186,9,9,114,101,116,117,114,110,
-32,114,0,0,20,3,0,0,0,0,0,0,12,83,0,7,
-100,111,95,99,97,108,108,0,10,7,83,82,16,83,0,191,
-44,11,0,0,30,8,3,189,9,100,101,102,32,100,111,95,
-110,97,109,101,40,115,101,108,102,44,116,44,114,61,78,111,
-110,101,41,58,0,0,0,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,7,
-100,111,95,110,97,109,101,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,28,3,0,0,
-28,4,0,0,32,3,0,4,30,6,3,190,9,9,105,102,
-32,116,46,118,97,108,32,105,110,32,68,46,118,97,114,115,
-58,0,0,0,12,5,0,1,68,0,0,0,13,4,5,0,
-12,5,0,4,118,97,114,115,0,0,0,0,9,4,4,5,
+12,14,0,7,100,111,95,99,111,100,101,0,49,16,1,14,
+12,14,0,7,79,80,95,67,65,76,76,0,13,18,14,0,
+15,19,3,0,15,20,5,0,15,21,3,0,50,12,16,4,
+30,7,3,195,9,9,115,101,108,102,46,102,114,101,101,95,
+116,109,112,40,102,110,99,41,32,35,82,69,71,0,0,0,
+12,14,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
+49,16,1,14,15,18,5,0,50,12,16,1,30,3,3,196,
+9,9,114,101,116,117,114,110,32,114,0,0,20,3,0,0,
+0,0,0,0,12,84,0,7,100,111,95,99,97,108,108,0,
+10,8,84,83,16,84,1,42,44,20,0,0,30,9,3,199,
+9,100,101,102,32,100,111,95,109,101,116,104,111,100,95,99,
+97,108,108,40,115,101,108,102,44,116,44,97,44,114,41,58,
+0,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
+121,0,0,0,33,1,0,0,12,1,0,14,100,111,95,109,
+101,116,104,111,100,95,99,97,108,108,0,0,34,1,0,0,
+28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
+28,4,0,0,9,3,0,4,28,5,0,0,9,4,0,5,
+30,9,3,200,9,9,116,109,112,115,32,61,32,115,101,108,
+102,46,103,101,116,95,116,109,112,115,40,50,43,108,101,110,
+40,97,41,41,0,0,0,0,12,10,0,8,103,101,116,95,
+116,109,112,115,0,0,0,0,49,7,1,10,11,9,0,1,
+2,0,0,0,0,0,0,0,12,12,0,3,108,101,110,0,
+13,11,12,0,15,12,3,0,31,10,12,1,19,10,11,10,
+1,9,9,10,50,6,7,1,15,5,6,0,30,12,3,201,
+9,9,98,44,99,32,61,32,115,101,108,102,46,100,111,40,
+116,46,105,116,101,109,115,91,48,93,41,44,115,101,108,102,
+46,100,111,40,116,46,105,116,101,109,115,91,49,93,41,0,
+12,11,0,2,100,111,0,0,49,8,1,11,12,11,0,5,
+105,116,101,109,115,0,0,0,9,10,2,11,11,11,0,1,
+0,0,0,0,0,0,0,0,9,10,10,11,50,7,8,1,
+15,6,7,0,12,12,0,2,100,111,0,0,49,9,1,12,
+12,12,0,5,105,116,101,109,115,0,0,0,9,11,2,12,
+11,12,0,1,1,0,0,0,0,0,0,0,9,11,11,12,
+50,8,9,1,15,7,8,0,15,8,6,0,15,6,7,0,
+30,11,3,202,9,9,115,101,108,102,46,100,111,95,99,111,
+100,101,40,79,80,95,76,79,65,68,77,69,84,72,79,68,
+44,116,109,112,115,91,48,93,44,98,44,99,41,0,0,0,
+12,15,0,7,100,111,95,99,111,100,101,0,49,9,1,15,
+12,15,0,13,79,80,95,76,79,65,68,77,69,84,72,79,
+68,0,0,0,13,11,15,0,11,15,0,1,0,0,0,0,
+0,0,0,0,9,12,5,15,15,13,8,0,15,14,6,0,
+50,7,9,4,30,11,3,203,9,9,115,101,108,102,46,102,
+114,101,101,95,116,109,112,40,98,41,59,32,115,101,108,102,
+46,102,114,101,101,95,116,109,112,40,99,41,32,35,82,69,
+71,0,0,0,12,12,0,8,102,114,101,101,95,116,109,112,
+0,0,0,0,49,9,1,12,15,11,8,0,50,7,9,1,
+12,12,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
+49,9,1,12,15,11,6,0,50,7,9,1,30,2,3,204,
+9,9,110,32,61,32,50,0,11,9,0,1,2,0,0,0,
+0,0,0,0,15,7,9,0,30,4,3,205,9,9,102,111,
+114,32,116,116,32,105,110,32,97,58,0,0,11,10,0,1,
+0,0,0,0,0,0,0,0,42,9,3,10,18,0,0,73,
+30,7,3,206,9,9,9,118,32,61,32,115,101,108,102,46,
+100,111,40,116,116,44,116,109,112,115,91,110,93,41,0,0,
+12,17,0,2,100,111,0,0,49,13,1,17,15,15,9,0,
+9,16,5,7,50,12,13,2,15,11,12,0,30,5,3,207,
+9,9,9,105,102,32,118,32,33,61,32,116,109,112,115,91,
+110,93,58,0,9,13,5,7,35,12,11,13,21,12,0,0,
+18,0,0,38,30,9,3,208,9,9,9,9,115,101,108,102,
+46,100,111,95,99,111,100,101,40,79,80,95,77,79,86,69,
+44,116,109,112,115,91,110,93,44,118,41,0,12,18,0,7,
+100,111,95,99,111,100,101,0,49,13,1,18,12,18,0,7,
+79,80,95,77,79,86,69,0,13,15,18,0,9,16,5,7,
+15,17,11,0,50,12,13,3,30,7,3,209,9,9,9,9,
+115,101,108,102,46,102,114,101,101,95,116,109,112,40,118,41,
+32,35,82,69,71,0,0,0,12,16,0,8,102,114,101,101,
+95,116,109,112,0,0,0,0,49,13,1,16,15,15,11,0,
+50,12,13,1,18,0,0,1,30,3,3,210,9,9,9,110,
+32,43,61,32,49,0,0,0,11,13,0,1,1,0,0,0,
+0,0,0,0,1,12,7,13,15,7,12,0,18,0,255,183,
+30,12,3,211,9,9,115,101,108,102,46,100,111,95,99,111,
+100,101,40,79,80,95,67,65,76,76,77,69,84,72,79,68,
+44,114,44,116,109,112,115,91,48,93,44,108,101,110,40,97,
+41,41,0,0,12,18,0,7,100,111,95,99,111,100,101,0,
+49,12,1,18,12,18,0,13,79,80,95,67,65,76,76,77,
+69,84,72,79,68,0,0,0,13,14,18,0,15,15,4,0,
+11,18,0,1,0,0,0,0,0,0,0,0,9,16,5,18,
+12,19,0,3,108,101,110,0,13,18,19,0,15,19,3,0,
+31,17,19,1,19,17,18,17,50,10,12,4,30,6,3,212,
+9,9,115,101,108,102,46,102,114,101,101,95,116,109,112,115,
+40,116,109,112,115,41,0,0,12,15,0,9,102,114,101,101,
+95,116,109,112,115,0,0,0,49,12,1,15,15,14,5,0,
+50,10,12,1,30,3,3,213,9,9,114,101,116,117,114,110,
+32,114,0,0,20,4,0,0,0,0,0,0,12,85,0,14,
+100,111,95,109,101,116,104,111,100,95,99,97,108,108,0,0,
+10,8,85,84,16,85,0,185,44,12,0,0,30,8,3,216,
+9,100,101,102,32,100,111,95,110,97,109,101,40,115,101,108,
+102,44,116,44,114,61,78,111,110,101,41,58,0,0,0,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,7,100,111,95,110,97,109,101,0,
+34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
+9,2,0,3,28,3,0,0,28,4,0,0,32,3,0,4,
+30,6,3,217,9,9,105,102,32,116,46,118,97,108,32,105,
+110,32,68,46,118,97,114,115,58,0,0,0,12,5,0,1,
+68,0,0,0,13,4,5,0,12,5,0,4,118,97,114,115,
+0,0,0,0,9,4,4,5,12,6,0,3,118,97,108,0,
+9,5,2,6,36,4,4,5,21,4,0,0,18,0,0,20,
+30,8,3,218,9,9,9,114,101,116,117,114,110,32,115,101,
+108,102,46,100,111,95,108,111,99,97,108,40,116,44,114,41,
+0,0,0,0,12,9,0,8,100,111,95,108,111,99,97,108,
+0,0,0,0,49,5,1,9,15,7,2,0,15,8,3,0,
+50,4,5,2,20,4,0,0,18,0,0,1,30,8,3,219,
+9,9,105,102,32,116,46,118,97,108,32,110,111,116,32,105,
+110,32,68,46,114,103,108,111,98,97,108,115,58,0,0,0,
+12,5,0,1,68,0,0,0,13,4,5,0,12,5,0,8,
+114,103,108,111,98,97,108,115,0,0,0,0,9,4,4,5,
 12,6,0,3,118,97,108,0,9,5,2,6,36,4,4,5,
-21,4,0,0,18,0,0,21,30,8,3,191,9,9,9,114,
-101,116,117,114,110,32,115,101,108,102,46,100,111,95,108,111,
-99,97,108,40,116,44,114,41,0,0,0,0,12,6,0,8,
-100,111,95,108,111,99,97,108,0,0,0,0,9,5,1,6,
-15,6,2,0,15,7,3,0,31,4,6,2,19,4,5,4,
-20,4,0,0,18,0,0,1,30,8,3,192,9,9,105,102,
-32,116,46,118,97,108,32,110,111,116,32,105,110,32,68,46,
-114,103,108,111,98,97,108,115,58,0,0,0,12,5,0,1,
-68,0,0,0,13,4,5,0,12,5,0,8,114,103,108,111,
-98,97,108,115,0,0,0,0,9,4,4,5,12,6,0,3,
-118,97,108,0,9,5,2,6,36,4,4,5,11,5,0,0,
-0,0,0,0,0,0,0,0,23,4,4,5,21,4,0,0,
-18,0,0,27,30,7,3,193,9,9,9,68,46,114,103,108,
-111,98,97,108,115,46,97,112,112,101,110,100,40,116,46,118,
-97,108,41,0,12,6,0,1,68,0,0,0,13,5,6,0,
-12,6,0,8,114,103,108,111,98,97,108,115,0,0,0,0,
-9,5,5,6,12,6,0,6,97,112,112,101,110,100,0,0,
-9,5,5,6,12,7,0,3,118,97,108,0,9,6,2,7,
-31,4,6,1,19,4,5,4,18,0,0,1,30,6,3,194,
+11,5,0,1,0,0,0,0,0,0,0,0,23,4,4,5,
+21,4,0,0,18,0,0,26,30,7,3,220,9,9,9,68,
+46,114,103,108,111,98,97,108,115,46,97,112,112,101,110,100,
+40,116,46,118,97,108,41,0,12,9,0,1,68,0,0,0,
+13,8,9,0,12,9,0,8,114,103,108,111,98,97,108,115,
+0,0,0,0,9,8,8,9,12,9,0,6,97,112,112,101,
+110,100,0,0,49,5,8,9,12,8,0,3,118,97,108,0,
+9,7,2,8,50,4,5,1,18,0,0,1,30,6,3,221,
 9,9,114,32,61,32,115,101,108,102,46,103,101,116,95,116,
-109,112,40,114,41,0,0,0,12,6,0,7,103,101,116,95,
-116,109,112,0,9,5,1,6,15,6,3,0,31,4,6,1,
-19,4,5,4,15,3,4,0,30,6,3,195,9,9,99,32,
-61,32,115,101,108,102,46,100,111,95,115,116,114,105,110,103,
-40,116,41,0,12,7,0,9,100,111,95,115,116,114,105,110,
-103,0,0,0,9,6,1,7,15,7,2,0,31,5,7,1,
-19,5,6,5,15,4,5,0,30,7,3,196,9,9,115,101,
-108,102,46,100,111,95,99,111,100,101,40,79,80,95,71,71,
-69,84,44,114,44,99,41,0,12,7,0,7,100,111,95,99,
-111,100,101,0,9,6,1,7,12,10,0,7,79,80,95,71,
-71,69,84,0,13,7,10,0,15,8,3,0,15,9,4,0,
-31,5,7,3,19,5,6,5,30,5,3,197,9,9,115,101,
-108,102,46,102,114,101,101,95,116,109,112,40,99,41,0,0,
-12,7,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
-9,6,1,7,15,7,4,0,31,5,7,1,19,5,6,5,
-30,3,3,198,9,9,114,101,116,117,114,110,32,114,0,0,
-20,3,0,0,0,0,0,0,12,84,0,7,100,111,95,110,
-97,109,101,0,10,7,84,83,16,84,0,175,44,10,0,0,
-30,8,3,201,9,100,101,102,32,100,111,95,108,111,99,97,
+109,112,40,114,41,0,0,0,12,8,0,7,103,101,116,95,
+116,109,112,0,49,5,1,8,15,7,3,0,50,4,5,1,
+15,3,4,0,30,6,3,222,9,9,99,32,61,32,115,101,
+108,102,46,100,111,95,115,116,114,105,110,103,40,116,41,0,
+12,9,0,9,100,111,95,115,116,114,105,110,103,0,0,0,
+49,6,1,9,15,8,2,0,50,5,6,1,15,4,5,0,
+30,7,3,223,9,9,115,101,108,102,46,100,111,95,99,111,
+100,101,40,79,80,95,71,71,69,84,44,114,44,99,41,0,
+12,11,0,7,100,111,95,99,111,100,101,0,49,6,1,11,
+12,11,0,7,79,80,95,71,71,69,84,0,13,8,11,0,
+15,9,3,0,15,10,4,0,50,5,6,3,30,5,3,224,
+9,9,115,101,108,102,46,102,114,101,101,95,116,109,112,40,
+99,41,0,0,12,9,0,8,102,114,101,101,95,116,109,112,
+0,0,0,0,49,6,1,9,15,8,4,0,50,5,6,1,
+30,3,3,225,9,9,114,101,116,117,114,110,32,114,0,0,
+20,3,0,0,0,0,0,0,12,86,0,7,100,111,95,110,
+97,109,101,0,10,8,86,85,16,86,0,173,44,10,0,0,
+30,8,3,228,9,100,101,102,32,100,111,95,108,111,99,97,
 108,40,115,101,108,102,44,116,44,114,61,78,111,110,101,41,
 58,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
 121,0,0,0,33,1,0,0,12,1,0,8,100,111,95,108,
 111,99,97,108,0,0,0,0,34,1,0,0,28,2,0,0,
 9,1,0,2,28,3,0,0,9,2,0,3,28,3,0,0,
-28,4,0,0,32,3,0,4,30,7,3,202,9,9,105,102,
+28,4,0,0,32,3,0,4,30,7,3,229,9,9,105,102,
 32,116,46,118,97,108,32,105,110,32,68,46,114,103,108,111,
 98,97,108,115,58,0,0,0,12,5,0,1,68,0,0,0,
 13,4,5,0,12,5,0,8,114,103,108,111,98,97,108,115,
 0,0,0,0,9,4,4,5,12,6,0,3,118,97,108,0,
 9,5,2,6,36,4,4,5,21,4,0,0,18,0,0,57,
-30,5,3,203,9,9,9,68,46,101,114,114,111,114,32,61,
+30,5,3,230,9,9,9,68,46,101,114,114,111,114,32,61,
 32,84,114,117,101,0,0,0,12,5,0,1,68,0,0,0,
-13,4,5,0,11,5,0,0,0,0,0,0,0,0,240,63,
+13,4,5,0,11,5,0,1,1,0,0,0,0,0,0,0,
 12,6,0,5,101,114,114,111,114,0,0,0,10,4,6,5,
-30,14,3,204,9,9,9,114,97,105,115,101,69,114,114,111,
+30,14,3,231,9,9,9,114,97,105,115,101,69,114,114,111,
 114,40,39,69,110,99,111,100,101,114,46,100,111,95,108,111,
 99,97,108,39,44,68,46,115,111,117,114,99,101,95,99,111,
 100,101,44,116,46,112,111,115,41,0,0,0,12,6,0,10,
@@ -4060,574 +4123,553 @@ unsigned char py_tinypy[] = {
 13,7,9,0,12,9,0,11,115,111,117,114,99,101,95,99,
 111,100,101,0,9,7,7,9,12,9,0,3,112,111,115,0,
 9,8,2,9,31,4,6,3,19,4,5,4,18,0,0,1,
-30,7,3,205,9,9,105,102,32,116,46,118,97,108,32,110,
+30,7,3,232,9,9,105,102,32,116,46,118,97,108,32,110,
 111,116,32,105,110,32,68,46,118,97,114,115,58,0,0,0,
 12,5,0,1,68,0,0,0,13,4,5,0,12,5,0,4,
 118,97,114,115,0,0,0,0,9,4,4,5,12,6,0,3,
-118,97,108,0,9,5,2,6,36,4,4,5,11,5,0,0,
+118,97,108,0,9,5,2,6,36,4,4,5,11,5,0,1,
 0,0,0,0,0,0,0,0,23,4,4,5,21,4,0,0,
-18,0,0,25,30,6,3,206,9,9,9,68,46,118,97,114,
+18,0,0,24,30,6,3,233,9,9,9,68,46,118,97,114,
 115,46,97,112,112,101,110,100,40,116,46,118,97,108,41,0,
-12,6,0,1,68,0,0,0,13,5,6,0,12,6,0,4,
-118,97,114,115,0,0,0,0,9,5,5,6,12,6,0,6,
-97,112,112,101,110,100,0,0,9,5,5,6,12,7,0,3,
-118,97,108,0,9,6,2,7,31,4,6,1,19,4,5,4,
-18,0,0,1,30,8,3,207,9,9,114,101,116,117,114,110,
-32,115,101,108,102,46,103,101,116,95,114,101,103,40,116,46,
-118,97,108,41,0,0,0,0,12,6,0,7,103,101,116,95,
-114,101,103,0,9,5,1,6,12,7,0,3,118,97,108,0,
-9,6,2,7,31,4,6,1,19,4,5,4,20,4,0,0,
-0,0,0,0,12,85,0,8,100,111,95,108,111,99,97,108,
-0,0,0,0,10,7,85,84,16,85,3,82,44,26,0,0,
-30,8,3,210,9,100,101,102,32,100,111,95,100,101,102,40,
-115,101,108,102,44,116,111,107,44,107,108,115,61,78,111,110,
-101,41,58,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,6,100,111,95,100,
-101,102,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,3,0,0,9,2,0,3,28,3,0,0,28,4,0,0,
-32,3,0,4,30,5,3,211,9,9,105,116,101,109,115,32,
-61,32,116,111,107,46,105,116,101,109,115,0,12,6,0,5,
-105,116,101,109,115,0,0,0,9,5,2,6,15,4,5,0,
-30,6,3,213,9,9,116,32,61,32,115,101,108,102,46,103,
-101,116,95,116,97,103,40,41,0,0,0,0,12,8,0,7,
-103,101,116,95,116,97,103,0,9,7,1,8,31,6,0,0,
-19,6,7,6,15,5,6,0,30,9,3,214,9,9,114,102,
-32,61,32,115,101,108,102,46,100,111,95,102,117,110,99,116,
-105,111,110,40,116,44,39,101,110,100,39,41,0,0,0,0,
-12,9,0,11,100,111,95,102,117,110,99,116,105,111,110,0,
-9,8,1,9,15,9,5,0,12,10,0,3,101,110,100,0,
-31,7,9,2,19,7,8,7,15,6,7,0,30,4,3,216,
+12,9,0,1,68,0,0,0,13,8,9,0,12,9,0,4,
+118,97,114,115,0,0,0,0,9,8,8,9,12,9,0,6,
+97,112,112,101,110,100,0,0,49,5,8,9,12,8,0,3,
+118,97,108,0,9,7,2,8,50,4,5,1,18,0,0,1,
+30,8,3,234,9,9,114,101,116,117,114,110,32,115,101,108,
+102,46,103,101,116,95,114,101,103,40,116,46,118,97,108,41,
+0,0,0,0,12,8,0,7,103,101,116,95,114,101,103,0,
+49,5,1,8,12,8,0,3,118,97,108,0,9,7,2,8,
+50,4,5,1,20,4,0,0,0,0,0,0,12,87,0,8,
+100,111,95,108,111,99,97,108,0,0,0,0,10,8,87,86,
+16,87,3,47,44,27,0,0,30,8,3,237,9,100,101,102,
+32,100,111,95,100,101,102,40,115,101,108,102,44,116,111,107,
+44,107,108,115,61,78,111,110,101,41,58,0,12,1,0,9,
+116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
+12,1,0,6,100,111,95,100,101,102,0,0,34,1,0,0,
+28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
+28,3,0,0,28,4,0,0,32,3,0,4,30,5,3,238,
+9,9,105,116,101,109,115,32,61,32,116,111,107,46,105,116,
+101,109,115,0,12,6,0,5,105,116,101,109,115,0,0,0,
+9,5,2,6,15,4,5,0,30,6,3,240,9,9,116,32,
+61,32,115,101,108,102,46,103,101,116,95,116,97,103,40,41,
+0,0,0,0,12,9,0,7,103,101,116,95,116,97,103,0,
+49,7,1,9,50,6,7,0,15,5,6,0,30,9,3,241,
+9,9,114,102,32,61,32,115,101,108,102,46,100,111,95,102,
+117,110,99,116,105,111,110,40,116,44,39,101,110,100,39,41,
+0,0,0,0,12,12,0,11,100,111,95,102,117,110,99,116,
+105,111,110,0,49,8,1,12,15,10,5,0,12,11,0,3,
+101,110,100,0,50,7,8,2,15,6,7,0,30,4,3,243,
 9,9,115,101,108,102,46,98,101,103,105,110,40,41,0,0,
-12,9,0,5,98,101,103,105,110,0,0,0,9,8,1,9,
-31,7,0,0,19,7,8,7,30,6,3,217,9,9,115,101,
-108,102,46,115,101,116,112,111,115,40,116,111,107,46,112,111,
-115,41,0,0,12,9,0,6,115,101,116,112,111,115,0,0,
-9,8,1,9,12,10,0,3,112,111,115,0,9,9,2,10,
-31,7,9,1,19,7,8,7,30,14,3,218,9,9,114,32,
-61,32,115,101,108,102,46,100,111,95,108,111,99,97,108,40,
-84,111,107,101,110,40,116,111,107,46,112,111,115,44,39,110,
-97,109,101,39,44,39,95,95,112,97,114,97,109,115,39,41,
-41,0,0,0,12,10,0,8,100,111,95,108,111,99,97,108,
-0,0,0,0,9,9,1,10,12,12,0,5,84,111,107,101,
-110,0,0,0,13,11,12,0,12,15,0,3,112,111,115,0,
-9,12,2,15,12,13,0,4,110,97,109,101,0,0,0,0,
-12,14,0,8,95,95,112,97,114,97,109,115,0,0,0,0,
-31,10,12,3,19,10,11,10,31,8,10,1,19,8,9,8,
-15,7,8,0,30,8,3,219,9,9,115,101,108,102,46,100,
-111,95,105,110,102,111,40,105,116,101,109,115,91,48,93,46,
-118,97,108,41,0,0,0,0,12,10,0,7,100,111,95,105,
-110,102,111,0,9,9,1,10,11,11,0,0,0,0,0,0,
-0,0,0,0,9,10,4,11,12,11,0,3,118,97,108,0,
-9,10,10,11,31,8,10,1,19,8,9,8,30,11,3,220,
+12,10,0,5,98,101,103,105,110,0,0,0,49,8,1,10,
+50,7,8,0,30,6,3,244,9,9,115,101,108,102,46,115,
+101,116,112,111,115,40,116,111,107,46,112,111,115,41,0,0,
+12,11,0,6,115,101,116,112,111,115,0,0,49,8,1,11,
+12,11,0,3,112,111,115,0,9,10,2,11,50,7,8,1,
+30,14,3,245,9,9,114,32,61,32,115,101,108,102,46,100,
+111,95,108,111,99,97,108,40,84,111,107,101,110,40,116,111,
+107,46,112,111,115,44,39,110,97,109,101,39,44,39,95,95,
+112,97,114,97,109,115,39,41,41,0,0,0,12,12,0,8,
+100,111,95,108,111,99,97,108,0,0,0,0,49,9,1,12,
+12,13,0,5,84,111,107,101,110,0,0,0,13,12,13,0,
+12,16,0,3,112,111,115,0,9,13,2,16,12,14,0,4,
+110,97,109,101,0,0,0,0,12,15,0,8,95,95,112,97,
+114,97,109,115,0,0,0,0,31,11,13,3,19,11,12,11,
+50,8,9,1,15,7,8,0,30,8,3,246,9,9,115,101,
+108,102,46,100,111,95,105,110,102,111,40,105,116,101,109,115,
+91,48,93,46,118,97,108,41,0,0,0,0,12,12,0,7,
+100,111,95,105,110,102,111,0,49,9,1,12,11,12,0,1,
+0,0,0,0,0,0,0,0,9,11,4,12,12,12,0,3,
+118,97,108,0,9,11,11,12,50,8,9,1,30,11,3,247,
 9,9,97,44,98,44,99,44,100,32,61,32,115,101,108,102,
 46,112,95,102,105,108,116,101,114,40,105,116,101,109,115,91,
-49,93,46,105,116,101,109,115,41,0,0,0,12,10,0,8,
-112,95,102,105,108,116,101,114,0,0,0,0,9,9,1,10,
-11,11,0,0,0,0,0,0,0,0,240,63,9,10,4,11,
-12,11,0,5,105,116,101,109,115,0,0,0,9,10,10,11,
-31,8,10,1,19,8,9,8,11,11,0,0,0,0,0,0,
-0,0,0,0,9,10,8,11,15,9,10,0,11,12,0,0,
-0,0,0,0,0,0,240,63,9,11,8,12,15,10,11,0,
-11,13,0,0,0,0,0,0,0,0,0,64,9,12,8,13,
-15,11,12,0,11,14,0,0,0,0,0,0,0,0,8,64,
-9,13,8,14,15,12,13,0,30,4,3,221,9,9,102,111,
-114,32,112,32,105,110,32,97,58,0,0,0,11,13,0,0,
-0,0,0,0,0,0,0,0,42,8,9,13,18,0,0,72,
-30,6,3,222,9,9,9,118,32,61,32,115,101,108,102,46,
-100,111,95,108,111,99,97,108,40,112,41,0,12,17,0,8,
-100,111,95,108,111,99,97,108,0,0,0,0,9,16,1,17,
-15,17,8,0,31,15,17,1,19,15,16,15,15,14,15,0,
-30,7,3,223,9,9,9,116,109,112,32,61,32,115,101,108,
-102,46,95,100,111,95,110,111,110,101,40,41,0,0,0,0,
-12,18,0,8,95,100,111,95,110,111,110,101,0,0,0,0,
-9,17,1,18,31,16,0,0,19,16,17,16,15,15,16,0,
-30,8,3,224,9,9,9,115,101,108,102,46,100,111,95,99,
-111,100,101,40,79,80,95,71,69,84,44,118,44,114,44,116,
-109,112,41,0,12,18,0,7,100,111,95,99,111,100,101,0,
-9,17,1,18,12,22,0,6,79,80,95,71,69,84,0,0,
-13,18,22,0,15,19,14,0,15,20,7,0,15,21,15,0,
-31,16,18,4,19,16,17,16,30,7,3,225,9,9,9,115,
+49,93,46,105,116,101,109,115,41,0,0,0,12,12,0,8,
+112,95,102,105,108,116,101,114,0,0,0,0,49,9,1,12,
+11,12,0,1,1,0,0,0,0,0,0,0,9,11,4,12,
+12,12,0,5,105,116,101,109,115,0,0,0,9,11,11,12,
+50,8,9,1,11,11,0,1,0,0,0,0,0,0,0,0,
+9,10,8,11,15,9,10,0,11,12,0,1,1,0,0,0,
+0,0,0,0,9,11,8,12,15,10,11,0,11,13,0,1,
+2,0,0,0,0,0,0,0,9,12,8,13,15,11,12,0,
+11,14,0,1,3,0,0,0,0,0,0,0,9,13,8,14,
+15,12,13,0,30,4,3,248,9,9,102,111,114,32,112,32,
+105,110,32,97,58,0,0,0,11,13,0,1,0,0,0,0,
+0,0,0,0,42,8,9,13,18,0,0,68,30,6,3,249,
+9,9,9,118,32,61,32,115,101,108,102,46,100,111,95,108,
+111,99,97,108,40,112,41,0,12,19,0,8,100,111,95,108,
+111,99,97,108,0,0,0,0,49,16,1,19,15,18,8,0,
+50,15,16,1,15,14,15,0,30,7,3,250,9,9,9,116,
+109,112,32,61,32,115,101,108,102,46,95,100,111,95,110,111,
+110,101,40,41,0,0,0,0,12,19,0,8,95,100,111,95,
+110,111,110,101,0,0,0,0,49,17,1,19,50,16,17,0,
+15,15,16,0,30,8,3,251,9,9,9,115,101,108,102,46,
+100,111,95,99,111,100,101,40,79,80,95,71,69,84,44,118,
+44,114,44,116,109,112,41,0,12,23,0,7,100,111,95,99,
+111,100,101,0,49,17,1,23,12,23,0,6,79,80,95,71,
+69,84,0,0,13,19,23,0,15,20,14,0,15,21,7,0,
+15,22,15,0,50,16,17,4,30,7,3,252,9,9,9,115,
 101,108,102,46,102,114,101,101,95,116,109,112,40,116,109,112,
-41,32,35,82,69,71,0,0,12,18,0,8,102,114,101,101,
-95,116,109,112,0,0,0,0,9,17,1,18,15,18,15,0,
-31,16,18,1,19,16,17,16,18,0,255,184,30,4,3,226,
-9,9,102,111,114,32,112,32,105,110,32,98,58,0,0,0,
-11,13,0,0,0,0,0,0,0,0,0,0,42,8,10,13,
-18,0,0,105,30,9,3,227,9,9,9,118,32,61,32,115,
-101,108,102,46,100,111,95,108,111,99,97,108,40,112,46,105,
-116,101,109,115,91,48,93,41,0,0,0,0,12,18,0,8,
-100,111,95,108,111,99,97,108,0,0,0,0,9,17,1,18,
-12,19,0,5,105,116,101,109,115,0,0,0,9,18,8,19,
-11,19,0,0,0,0,0,0,0,0,0,0,9,18,18,19,
-31,16,18,1,19,16,17,16,15,14,16,0,30,7,3,228,
-9,9,9,115,101,108,102,46,100,111,40,112,46,105,116,101,
-109,115,91,49,93,44,118,41,0,0,0,0,12,18,0,2,
-100,111,0,0,9,17,1,18,12,20,0,5,105,116,101,109,
-115,0,0,0,9,18,8,20,11,20,0,0,0,0,0,0,
-0,0,240,63,9,18,18,20,15,19,14,0,31,16,18,2,
-19,16,17,16,30,7,3,229,9,9,9,116,109,112,32,61,
-32,115,101,108,102,46,95,100,111,95,110,111,110,101,40,41,
-0,0,0,0,12,18,0,8,95,100,111,95,110,111,110,101,
-0,0,0,0,9,17,1,18,31,16,0,0,19,16,17,16,
-15,15,16,0,30,9,3,230,9,9,9,115,101,108,102,46,
+41,32,35,82,69,71,0,0,12,20,0,8,102,114,101,101,
+95,116,109,112,0,0,0,0,49,17,1,20,15,19,15,0,
+50,16,17,1,18,0,255,188,30,4,3,253,9,9,102,111,
+114,32,112,32,105,110,32,98,58,0,0,0,11,13,0,1,
+0,0,0,0,0,0,0,0,42,8,10,13,18,0,0,100,
+30,9,3,254,9,9,9,118,32,61,32,115,101,108,102,46,
+100,111,95,108,111,99,97,108,40,112,46,105,116,101,109,115,
+91,48,93,41,0,0,0,0,12,20,0,8,100,111,95,108,
+111,99,97,108,0,0,0,0,49,17,1,20,12,20,0,5,
+105,116,101,109,115,0,0,0,9,19,8,20,11,20,0,1,
+0,0,0,0,0,0,0,0,9,19,19,20,50,16,17,1,
+15,14,16,0,30,7,3,255,9,9,9,115,101,108,102,46,
+100,111,40,112,46,105,116,101,109,115,91,49,93,44,118,41,
+0,0,0,0,12,21,0,2,100,111,0,0,49,17,1,21,
+12,21,0,5,105,116,101,109,115,0,0,0,9,19,8,21,
+11,21,0,1,1,0,0,0,0,0,0,0,9,19,19,21,
+15,20,14,0,50,16,17,2,30,7,4,0,9,9,9,116,
+109,112,32,61,32,115,101,108,102,46,95,100,111,95,110,111,
+110,101,40,41,0,0,0,0,12,19,0,8,95,100,111,95,
+110,111,110,101,0,0,0,0,49,17,1,19,50,16,17,0,
+15,15,16,0,30,9,4,1,9,9,9,115,101,108,102,46,
 100,111,95,99,111,100,101,40,79,80,95,73,71,69,84,44,
-118,44,114,44,116,109,112,41,0,0,0,0,12,18,0,7,
-100,111,95,99,111,100,101,0,9,17,1,18,12,22,0,7,
-79,80,95,73,71,69,84,0,13,18,22,0,15,19,14,0,
-15,20,7,0,15,21,15,0,31,16,18,4,19,16,17,16,
-30,7,3,231,9,9,9,115,101,108,102,46,102,114,101,101,
-95,116,109,112,40,116,109,112,41,32,35,82,69,71,0,0,
-12,18,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
-9,17,1,18,15,18,15,0,31,16,18,1,19,16,17,16,
-18,0,255,151,30,4,3,232,9,9,105,102,32,99,32,33,
-61,32,78,111,110,101,58,0,28,16,0,0,35,13,11,16,
-21,13,0,0,18,0,0,85,30,9,3,233,9,9,9,118,
-32,61,32,115,101,108,102,46,100,111,95,108,111,99,97,108,
-40,99,46,105,116,101,109,115,91,48,93,41,0,0,0,0,
-12,17,0,8,100,111,95,108,111,99,97,108,0,0,0,0,
-9,16,1,17,12,18,0,5,105,116,101,109,115,0,0,0,
-9,17,11,18,11,18,0,0,0,0,0,0,0,0,0,0,
-9,17,17,18,31,13,17,1,19,13,16,13,15,14,13,0,
-30,8,3,234,9,9,9,116,109,112,32,61,32,115,101,108,
-102,46,95,100,111,95,115,116,114,105,110,103,40,39,42,39,
-41,0,0,0,12,17,0,10,95,100,111,95,115,116,114,105,
-110,103,0,0,9,16,1,17,12,17,0,1,42,0,0,0,
-31,13,17,1,19,13,16,13,15,15,13,0,30,8,3,235,
+118,44,114,44,116,109,112,41,0,0,0,0,12,23,0,7,
+100,111,95,99,111,100,101,0,49,17,1,23,12,23,0,7,
+79,80,95,73,71,69,84,0,13,19,23,0,15,20,14,0,
+15,21,7,0,15,22,15,0,50,16,17,4,30,7,4,2,
+9,9,9,115,101,108,102,46,102,114,101,101,95,116,109,112,
+40,116,109,112,41,32,35,82,69,71,0,0,12,20,0,8,
+102,114,101,101,95,116,109,112,0,0,0,0,49,17,1,20,
+15,19,15,0,50,16,17,1,18,0,255,156,30,4,4,3,
+9,9,105,102,32,99,32,33,61,32,78,111,110,101,58,0,
+28,16,0,0,35,13,11,16,21,13,0,0,18,0,0,81,
+30,9,4,4,9,9,9,118,32,61,32,115,101,108,102,46,
+100,111,95,108,111,99,97,108,40,99,46,105,116,101,109,115,
+91,48,93,41,0,0,0,0,12,19,0,8,100,111,95,108,
+111,99,97,108,0,0,0,0,49,16,1,19,12,19,0,5,
+105,116,101,109,115,0,0,0,9,18,11,19,11,19,0,1,
+0,0,0,0,0,0,0,0,9,18,18,19,50,13,16,1,
+15,14,13,0,30,8,4,5,9,9,9,116,109,112,32,61,
+32,115,101,108,102,46,95,100,111,95,115,116,114,105,110,103,
+40,39,42,39,41,0,0,0,12,19,0,10,95,100,111,95,
+115,116,114,105,110,103,0,0,49,16,1,19,12,18,0,1,
+42,0,0,0,50,13,16,1,15,15,13,0,30,8,4,6,
 9,9,9,115,101,108,102,46,100,111,95,99,111,100,101,40,
 79,80,95,71,69,84,44,118,44,114,44,116,109,112,41,0,
-12,17,0,7,100,111,95,99,111,100,101,0,9,16,1,17,
-12,21,0,6,79,80,95,71,69,84,0,0,13,17,21,0,
-15,18,14,0,15,19,7,0,15,20,15,0,31,13,17,4,
-19,13,16,13,30,7,3,236,9,9,9,115,101,108,102,46,
-102,114,101,101,95,116,109,112,40,116,109,112,41,32,35,82,
-69,71,0,0,12,17,0,8,102,114,101,101,95,116,109,112,
-0,0,0,0,9,16,1,17,15,17,15,0,31,13,17,1,
-19,13,16,13,18,0,0,1,30,4,3,237,9,9,105,102,
-32,100,32,33,61,32,78,111,110,101,58,0,28,16,0,0,
-35,13,12,16,21,13,0,0,18,0,0,109,30,9,3,238,
-9,9,9,101,32,61,32,115,101,108,102,46,100,111,95,108,
-111,99,97,108,40,100,46,105,116,101,109,115,91,48,93,41,
-0,0,0,0,12,18,0,8,100,111,95,108,111,99,97,108,
-0,0,0,0,9,17,1,18,12,19,0,5,105,116,101,109,
-115,0,0,0,9,18,12,19,11,19,0,0,0,0,0,0,
-0,0,0,0,9,18,18,19,31,16,18,1,19,16,17,16,
-15,13,16,0,30,8,3,239,9,9,9,115,101,108,102,46,
-100,111,95,99,111,100,101,40,79,80,95,68,73,67,84,44,
-101,44,48,44,48,41,0,0,12,18,0,7,100,111,95,99,
-111,100,101,0,9,17,1,18,12,22,0,7,79,80,95,68,
-73,67,84,0,13,18,22,0,15,19,13,0,11,20,0,0,
-0,0,0,0,0,0,0,0,11,21,0,0,0,0,0,0,
-0,0,0,0,31,16,18,4,19,16,17,16,30,7,3,240,
+12,22,0,7,100,111,95,99,111,100,101,0,49,16,1,22,
+12,22,0,6,79,80,95,71,69,84,0,0,13,18,22,0,
+15,19,14,0,15,20,7,0,15,21,15,0,50,13,16,4,
+30,7,4,7,9,9,9,115,101,108,102,46,102,114,101,101,
+95,116,109,112,40,116,109,112,41,32,35,82,69,71,0,0,
+12,19,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
+49,16,1,19,15,18,15,0,50,13,16,1,18,0,0,1,
+30,4,4,8,9,9,105,102,32,100,32,33,61,32,78,111,
+110,101,58,0,28,16,0,0,35,13,12,16,21,13,0,0,
+18,0,0,104,30,9,4,9,9,9,9,101,32,61,32,115,
+101,108,102,46,100,111,95,108,111,99,97,108,40,100,46,105,
+116,101,109,115,91,48,93,41,0,0,0,0,12,20,0,8,
+100,111,95,108,111,99,97,108,0,0,0,0,49,17,1,20,
+12,20,0,5,105,116,101,109,115,0,0,0,9,19,12,20,
+11,20,0,1,0,0,0,0,0,0,0,0,9,19,19,20,
+50,16,17,1,15,13,16,0,30,8,4,10,9,9,9,115,
+101,108,102,46,100,111,95,99,111,100,101,40,79,80,95,68,
+73,67,84,44,101,44,48,44,48,41,0,0,12,23,0,7,
+100,111,95,99,111,100,101,0,49,17,1,23,12,23,0,7,
+79,80,95,68,73,67,84,0,13,19,23,0,15,20,13,0,
+11,21,0,1,0,0,0,0,0,0,0,0,11,22,0,1,
+0,0,0,0,0,0,0,0,50,16,17,4,30,7,4,11,
 9,9,9,116,109,112,32,61,32,115,101,108,102,46,95,100,
-111,95,110,111,110,101,40,41,0,0,0,0,12,18,0,8,
-95,100,111,95,110,111,110,101,0,0,0,0,9,17,1,18,
-31,16,0,0,19,16,17,16,15,15,16,0,30,9,3,241,
-9,9,9,115,101,108,102,46,100,111,95,99,111,100,101,40,
-79,80,95,73,71,69,84,44,101,44,114,44,116,109,112,41,
-0,0,0,0,12,18,0,7,100,111,95,99,111,100,101,0,
-9,17,1,18,12,22,0,7,79,80,95,73,71,69,84,0,
-13,18,22,0,15,19,13,0,15,20,7,0,15,21,15,0,
-31,16,18,4,19,16,17,16,30,7,3,242,9,9,9,115,
-101,108,102,46,102,114,101,101,95,116,109,112,40,116,109,112,
-41,32,35,82,69,71,0,0,12,18,0,8,102,114,101,101,
-95,116,109,112,0,0,0,0,9,17,1,18,15,18,15,0,
-31,16,18,1,19,16,17,16,18,0,0,1,30,10,3,243,
-9,9,115,101,108,102,46,102,114,101,101,95,116,109,112,40,
-115,101,108,102,46,100,111,40,105,116,101,109,115,91,50,93,
-41,41,32,35,82,69,71,0,12,18,0,8,102,114,101,101,
-95,116,109,112,0,0,0,0,9,17,1,18,12,20,0,2,
-100,111,0,0,9,19,1,20,11,21,0,0,0,0,0,0,
-0,0,0,64,9,20,4,21,31,18,20,1,19,18,19,18,
-31,16,18,1,19,16,17,16,30,4,3,244,9,9,115,101,
-108,102,46,101,110,100,40,41,0,0,0,0,12,18,0,3,
-101,110,100,0,9,17,1,18,31,16,0,0,19,16,17,16,
-30,5,3,246,9,9,115,101,108,102,46,116,97,103,40,116,
-44,39,101,110,100,39,41,0,12,18,0,3,116,97,103,0,
-9,17,1,18,15,18,5,0,12,19,0,3,101,110,100,0,
-31,16,18,2,19,16,17,16,30,5,3,248,9,9,105,102,
-32,107,108,115,32,61,61,32,78,111,110,101,58,0,0,0,
-28,17,0,0,23,16,3,17,21,16,0,0,18,0,0,98,
-30,17,3,249,9,9,9,105,102,32,68,46,95,103,108,111,
-98,97,108,115,58,32,115,101,108,102,46,100,111,95,103,108,
-111,98,97,108,115,40,84,111,107,101,110,40,116,111,107,46,
-112,111,115,44,48,44,48,44,91,105,116,101,109,115,91,48,
-93,93,41,41,0,0,0,0,12,17,0,1,68,0,0,0,
-13,16,17,0,12,17,0,8,95,103,108,111,98,97,108,115,
-0,0,0,0,9,16,16,17,21,16,0,0,18,0,0,29,
-12,18,0,10,100,111,95,103,108,111,98,97,108,115,0,0,
-9,17,1,18,12,20,0,5,84,111,107,101,110,0,0,0,
-13,19,20,0,12,24,0,3,112,111,115,0,9,20,2,24,
-11,21,0,0,0,0,0,0,0,0,0,0,11,22,0,0,
-0,0,0,0,0,0,0,0,11,25,0,0,0,0,0,0,
-0,0,0,0,9,24,4,25,27,23,24,1,31,18,20,4,
-19,18,19,18,31,16,18,1,19,16,17,16,18,0,0,1,
-30,15,3,250,9,9,9,114,32,61,32,115,101,108,102,46,
+111,95,110,111,110,101,40,41,0,0,0,0,12,19,0,8,
+95,100,111,95,110,111,110,101,0,0,0,0,49,17,1,19,
+50,16,17,0,15,15,16,0,30,9,4,12,9,9,9,115,
+101,108,102,46,100,111,95,99,111,100,101,40,79,80,95,73,
+71,69,84,44,101,44,114,44,116,109,112,41,0,0,0,0,
+12,23,0,7,100,111,95,99,111,100,101,0,49,17,1,23,
+12,23,0,7,79,80,95,73,71,69,84,0,13,19,23,0,
+15,20,13,0,15,21,7,0,15,22,15,0,50,16,17,4,
+30,7,4,13,9,9,9,115,101,108,102,46,102,114,101,101,
+95,116,109,112,40,116,109,112,41,32,35,82,69,71,0,0,
+12,20,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
+49,17,1,20,15,19,15,0,50,16,17,1,18,0,0,1,
+30,10,4,14,9,9,115,101,108,102,46,102,114,101,101,95,
+116,109,112,40,115,101,108,102,46,100,111,40,105,116,101,109,
+115,91,50,93,41,41,32,35,82,69,71,0,12,20,0,8,
+102,114,101,101,95,116,109,112,0,0,0,0,49,17,1,20,
+12,23,0,2,100,111,0,0,49,20,1,23,11,23,0,1,
+2,0,0,0,0,0,0,0,9,22,4,23,50,19,20,1,
+50,16,17,1,30,4,4,15,9,9,115,101,108,102,46,101,
+110,100,40,41,0,0,0,0,12,19,0,3,101,110,100,0,
+49,17,1,19,50,16,17,0,30,5,4,17,9,9,115,101,
+108,102,46,116,97,103,40,116,44,39,101,110,100,39,41,0,
+12,21,0,3,116,97,103,0,49,17,1,21,15,19,5,0,
+12,20,0,3,101,110,100,0,50,16,17,2,30,5,4,19,
+9,9,105,102,32,107,108,115,32,61,61,32,78,111,110,101,
+58,0,0,0,28,17,0,0,23,16,3,17,21,16,0,0,
+18,0,0,96,30,17,4,20,9,9,9,105,102,32,68,46,
+95,103,108,111,98,97,108,115,58,32,115,101,108,102,46,100,
+111,95,103,108,111,98,97,108,115,40,84,111,107,101,110,40,
+116,111,107,46,112,111,115,44,48,44,48,44,91,105,116,101,
+109,115,91,48,93,93,41,41,0,0,0,0,12,17,0,1,
+68,0,0,0,13,16,17,0,12,17,0,8,95,103,108,111,
+98,97,108,115,0,0,0,0,9,16,16,17,21,16,0,0,
+18,0,0,28,12,20,0,10,100,111,95,103,108,111,98,97,
+108,115,0,0,49,17,1,20,12,21,0,5,84,111,107,101,
+110,0,0,0,13,20,21,0,12,25,0,3,112,111,115,0,
+9,21,2,25,11,22,0,1,0,0,0,0,0,0,0,0,
+11,23,0,1,0,0,0,0,0,0,0,0,11,26,0,1,
+0,0,0,0,0,0,0,0,9,25,4,26,27,24,25,1,
+31,19,21,4,19,19,20,19,50,16,17,1,18,0,0,1,
+30,15,4,21,9,9,9,114,32,61,32,115,101,108,102,46,
 100,111,95,115,101,116,95,99,116,120,40,105,116,101,109,115,
 91,48,93,44,84,111,107,101,110,40,116,111,107,46,112,111,
 115,44,39,114,101,103,39,44,114,102,41,41,0,0,0,0,
-12,18,0,10,100,111,95,115,101,116,95,99,116,120,0,0,
-9,17,1,18,11,20,0,0,0,0,0,0,0,0,0,0,
-9,18,4,20,12,21,0,5,84,111,107,101,110,0,0,0,
-13,20,21,0,12,24,0,3,112,111,115,0,9,21,2,24,
-12,22,0,3,114,101,103,0,15,23,6,0,31,19,21,3,
-19,19,20,19,31,16,18,2,19,16,17,16,15,7,16,0,
-18,0,0,65,30,2,3,251,9,9,101,108,115,101,58,0,
-30,9,3,252,9,9,9,114,110,32,61,32,115,101,108,102,
-46,100,111,95,115,116,114,105,110,103,40,105,116,101,109,115,
-91,48,93,41,0,0,0,0,12,19,0,9,100,111,95,115,
-116,114,105,110,103,0,0,0,9,18,1,19,11,20,0,0,
-0,0,0,0,0,0,0,0,9,19,4,20,31,17,19,1,
-19,17,18,17,15,16,17,0,30,9,3,253,9,9,9,115,
-101,108,102,46,100,111,95,99,111,100,101,40,79,80,95,83,
-69,84,44,107,108,115,44,114,110,44,114,102,41,0,0,0,
-12,19,0,7,100,111,95,99,111,100,101,0,9,18,1,19,
-12,23,0,6,79,80,95,83,69,84,0,0,13,19,23,0,
-15,20,3,0,15,21,16,0,15,22,6,0,31,17,19,4,
-19,17,18,17,30,6,3,254,9,9,9,115,101,108,102,46,
-102,114,101,101,95,116,109,112,40,114,110,41,0,0,0,0,
-12,19,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
-9,18,1,19,15,19,16,0,31,17,19,1,19,17,18,17,
-18,0,0,1,30,5,4,0,9,9,115,101,108,102,46,102,
-114,101,101,95,116,109,112,40,114,102,41,0,12,19,0,8,
-102,114,101,101,95,116,109,112,0,0,0,0,9,18,1,19,
-15,19,6,0,31,17,19,1,19,17,18,17,0,0,0,0,
-12,86,0,6,100,111,95,100,101,102,0,0,10,7,86,85,
-16,86,1,232,44,27,0,0,30,6,4,3,9,100,101,102,
-32,100,111,95,99,108,97,115,115,40,115,101,108,102,44,116,
-41,58,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,8,100,111,95,99,
-108,97,115,115,0,0,0,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,30,3,4,4,
-9,9,116,111,107,32,61,32,116,0,0,0,15,3,2,0,
-30,5,4,5,9,9,105,116,101,109,115,32,61,32,116,46,
-105,116,101,109,115,0,0,0,12,6,0,5,105,116,101,109,
-115,0,0,0,9,5,2,6,15,4,5,0,30,4,4,6,
-9,9,112,97,114,101,110,116,32,61,32,78,111,110,101,0,
-28,6,0,0,15,5,6,0,30,8,4,7,9,9,105,102,
-32,105,116,101,109,115,91,48,93,46,116,121,112,101,32,61,
-61,32,39,110,97,109,101,39,58,0,0,0,11,7,0,0,
-0,0,0,0,0,0,0,0,9,6,4,7,12,7,0,4,
-116,121,112,101,0,0,0,0,9,6,6,7,12,7,0,4,
-110,97,109,101,0,0,0,0,23,6,6,7,21,6,0,0,
-18,0,0,45,30,6,4,8,9,9,9,110,97,109,101,32,
-61,32,105,116,101,109,115,91,48,93,46,118,97,108,0,0,
-11,8,0,0,0,0,0,0,0,0,0,0,9,7,4,8,
+12,21,0,10,100,111,95,115,101,116,95,99,116,120,0,0,
+49,17,1,21,11,21,0,1,0,0,0,0,0,0,0,0,
+9,19,4,21,12,22,0,5,84,111,107,101,110,0,0,0,
+13,21,22,0,12,25,0,3,112,111,115,0,9,22,2,25,
+12,23,0,3,114,101,103,0,15,24,6,0,31,20,22,3,
+19,20,21,20,50,16,17,2,15,7,16,0,18,0,0,62,
+30,2,4,22,9,9,101,108,115,101,58,0,30,9,4,23,
+9,9,9,114,110,32,61,32,115,101,108,102,46,100,111,95,
+115,116,114,105,110,103,40,105,116,101,109,115,91,48,93,41,
+0,0,0,0,12,21,0,9,100,111,95,115,116,114,105,110,
+103,0,0,0,49,18,1,21,11,21,0,1,0,0,0,0,
+0,0,0,0,9,20,4,21,50,17,18,1,15,16,17,0,
+30,9,4,24,9,9,9,115,101,108,102,46,100,111,95,99,
+111,100,101,40,79,80,95,83,69,84,44,107,108,115,44,114,
+110,44,114,102,41,0,0,0,12,24,0,7,100,111,95,99,
+111,100,101,0,49,18,1,24,12,24,0,6,79,80,95,83,
+69,84,0,0,13,20,24,0,15,21,3,0,15,22,16,0,
+15,23,6,0,50,17,18,4,30,6,4,25,9,9,9,115,
+101,108,102,46,102,114,101,101,95,116,109,112,40,114,110,41,
+0,0,0,0,12,21,0,8,102,114,101,101,95,116,109,112,
+0,0,0,0,49,18,1,21,15,20,16,0,50,17,18,1,
+18,0,0,1,30,5,4,27,9,9,115,101,108,102,46,102,
+114,101,101,95,116,109,112,40,114,102,41,0,12,21,0,8,
+102,114,101,101,95,116,109,112,0,0,0,0,49,18,1,21,
+15,20,6,0,50,17,18,1,0,0,0,0,12,88,0,6,
+100,111,95,100,101,102,0,0,10,8,88,87,16,88,1,222,
+44,29,0,0,30,6,4,30,9,100,101,102,32,100,111,95,
+99,108,97,115,115,40,115,101,108,102,44,116,41,58,0,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,8,100,111,95,99,108,97,115,115,
+0,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
+28,3,0,0,9,2,0,3,30,3,4,31,9,9,116,111,
+107,32,61,32,116,0,0,0,15,3,2,0,30,5,4,32,
+9,9,105,116,101,109,115,32,61,32,116,46,105,116,101,109,
+115,0,0,0,12,6,0,5,105,116,101,109,115,0,0,0,
+9,5,2,6,15,4,5,0,30,4,4,33,9,9,112,97,
+114,101,110,116,32,61,32,78,111,110,101,0,28,6,0,0,
+15,5,6,0,30,8,4,34,9,9,105,102,32,105,116,101,
+109,115,91,48,93,46,116,121,112,101,32,61,61,32,39,110,
+97,109,101,39,58,0,0,0,11,7,0,1,0,0,0,0,
+0,0,0,0,9,6,4,7,12,7,0,4,116,121,112,101,
+0,0,0,0,9,6,6,7,12,7,0,4,110,97,109,101,
+0,0,0,0,23,6,6,7,21,6,0,0,18,0,0,45,
+30,6,4,35,9,9,9,110,97,109,101,32,61,32,105,116,
+101,109,115,91,48,93,46,118,97,108,0,0,11,8,0,1,
+0,0,0,0,0,0,0,0,9,7,4,8,12,8,0,3,
+118,97,108,0,9,7,7,8,15,6,7,0,30,11,4,36,
+9,9,9,112,97,114,101,110,116,32,61,32,84,111,107,101,
+110,40,116,111,107,46,112,111,115,44,39,110,97,109,101,39,
+44,39,111,98,106,101,99,116,39,41,0,0,12,9,0,5,
+84,111,107,101,110,0,0,0,13,8,9,0,12,12,0,3,
+112,111,115,0,9,9,3,12,12,10,0,4,110,97,109,101,
+0,0,0,0,12,11,0,6,111,98,106,101,99,116,0,0,
+31,7,9,3,19,7,8,7,15,5,7,0,18,0,0,52,
+30,2,4,37,9,9,101,108,115,101,58,0,30,8,4,38,
+9,9,9,110,97,109,101,32,61,32,105,116,101,109,115,91,
+48,93,46,105,116,101,109,115,91,48,93,46,118,97,108,0,
+11,8,0,1,0,0,0,0,0,0,0,0,9,7,4,8,
+12,8,0,5,105,116,101,109,115,0,0,0,9,7,7,8,
+11,8,0,1,0,0,0,0,0,0,0,0,9,7,7,8,
 12,8,0,3,118,97,108,0,9,7,7,8,15,6,7,0,
-30,11,4,9,9,9,9,112,97,114,101,110,116,32,61,32,
-84,111,107,101,110,40,116,111,107,46,112,111,115,44,39,110,
-97,109,101,39,44,39,111,98,106,101,99,116,39,41,0,0,
-12,9,0,5,84,111,107,101,110,0,0,0,13,8,9,0,
-12,12,0,3,112,111,115,0,9,9,3,12,12,10,0,4,
-110,97,109,101,0,0,0,0,12,11,0,6,111,98,106,101,
-99,116,0,0,31,7,9,3,19,7,8,7,15,5,7,0,
-18,0,0,52,30,2,4,10,9,9,101,108,115,101,58,0,
-30,8,4,11,9,9,9,110,97,109,101,32,61,32,105,116,
-101,109,115,91,48,93,46,105,116,101,109,115,91,48,93,46,
-118,97,108,0,11,8,0,0,0,0,0,0,0,0,0,0,
+30,8,4,39,9,9,9,112,97,114,101,110,116,32,61,32,
+105,116,101,109,115,91,48,93,46,105,116,101,109,115,91,49,
+93,0,0,0,11,8,0,1,0,0,0,0,0,0,0,0,
 9,7,4,8,12,8,0,5,105,116,101,109,115,0,0,0,
-9,7,7,8,11,8,0,0,0,0,0,0,0,0,0,0,
-9,7,7,8,12,8,0,3,118,97,108,0,9,7,7,8,
-15,6,7,0,30,8,4,12,9,9,9,112,97,114,101,110,
-116,32,61,32,105,116,101,109,115,91,48,93,46,105,116,101,
-109,115,91,49,93,0,0,0,11,8,0,0,0,0,0,0,
-0,0,0,0,9,7,4,8,12,8,0,5,105,116,101,109,
-115,0,0,0,9,7,7,8,11,8,0,0,0,0,0,0,
-0,0,240,63,9,7,7,8,15,5,7,0,18,0,0,1,
-30,11,4,14,9,9,107,108,115,32,61,32,115,101,108,102,
-46,100,111,40,84,111,107,101,110,40,116,46,112,111,115,44,
-39,100,105,99,116,39,44,48,44,91,93,41,41,0,0,0,
-12,10,0,2,100,111,0,0,9,9,1,10,12,12,0,5,
-84,111,107,101,110,0,0,0,13,11,12,0,12,16,0,3,
-112,111,115,0,9,12,2,16,12,13,0,4,100,105,99,116,
-0,0,0,0,11,14,0,0,0,0,0,0,0,0,0,0,
-27,15,0,0,31,10,12,4,19,10,11,10,31,8,10,1,
-19,8,9,8,15,7,8,0,30,5,4,15,9,9,115,101,
-108,102,46,117,110,95,116,109,112,40,107,108,115,41,0,0,
-12,10,0,6,117,110,95,116,109,112,0,0,9,9,1,10,
-15,10,7,0,31,8,10,1,19,8,9,8,30,8,4,16,
-9,9,116,115,32,61,32,115,101,108,102,46,95,100,111,95,
-115,116,114,105,110,103,40,110,97,109,101,41,0,0,0,0,
-12,11,0,10,95,100,111,95,115,116,114,105,110,103,0,0,
-9,10,1,11,15,11,6,0,31,9,11,1,19,9,10,9,
-15,8,9,0,30,8,4,17,9,9,115,101,108,102,46,100,
+9,7,7,8,11,8,0,1,1,0,0,0,0,0,0,0,
+9,7,7,8,15,5,7,0,18,0,0,1,30,11,4,41,
+9,9,107,108,115,32,61,32,115,101,108,102,46,100,111,40,
+84,111,107,101,110,40,116,46,112,111,115,44,39,100,105,99,
+116,39,44,48,44,91,93,41,41,0,0,0,12,12,0,2,
+100,111,0,0,49,9,1,12,12,13,0,5,84,111,107,101,
+110,0,0,0,13,12,13,0,12,17,0,3,112,111,115,0,
+9,13,2,17,12,14,0,4,100,105,99,116,0,0,0,0,
+11,15,0,1,0,0,0,0,0,0,0,0,27,16,0,0,
+31,11,13,4,19,11,12,11,50,8,9,1,15,7,8,0,
+30,5,4,42,9,9,115,101,108,102,46,117,110,95,116,109,
+112,40,107,108,115,41,0,0,12,12,0,6,117,110,95,116,
+109,112,0,0,49,9,1,12,15,11,7,0,50,8,9,1,
+30,8,4,43,9,9,116,115,32,61,32,115,101,108,102,46,
+95,100,111,95,115,116,114,105,110,103,40,110,97,109,101,41,
+0,0,0,0,12,13,0,10,95,100,111,95,115,116,114,105,
+110,103,0,0,49,10,1,13,15,12,6,0,50,9,10,1,
+15,8,9,0,30,8,4,44,9,9,115,101,108,102,46,100,
 111,95,99,111,100,101,40,79,80,95,71,83,69,84,44,116,
-115,44,107,108,115,41,0,0,12,11,0,7,100,111,95,99,
-111,100,101,0,9,10,1,11,12,14,0,7,79,80,95,71,
-83,69,84,0,13,11,14,0,15,12,8,0,15,13,7,0,
-31,9,11,3,19,9,10,9,30,7,4,18,9,9,115,101,
-108,102,46,102,114,101,101,95,116,109,112,40,116,115,41,32,
-35,82,69,71,0,0,0,0,12,11,0,8,102,114,101,101,
-95,116,109,112,0,0,0,0,9,10,1,11,15,11,8,0,
-31,9,11,1,19,9,10,9,30,13,4,20,9,9,115,101,
-108,102,46,102,114,101,101,95,116,109,112,40,115,101,108,102,
-46,100,111,40,84,111,107,101,110,40,116,111,107,46,112,111,
-115,44,39,99,97,108,108,39,44,78,111,110,101,44,91,0,
-12,11,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
-9,10,1,11,12,13,0,2,100,111,0,0,9,12,1,13,
-12,15,0,5,84,111,107,101,110,0,0,0,13,14,15,0,
-12,19,0,3,112,111,115,0,9,15,3,19,12,16,0,4,
-99,97,108,108,0,0,0,0,28,17,0,0,30,9,4,21,
-9,9,9,84,111,107,101,110,40,116,111,107,46,112,111,115,
-44,39,110,97,109,101,39,44,39,115,101,116,109,101,116,97,
-39,41,44,0,12,23,0,5,84,111,107,101,110,0,0,0,
-13,22,23,0,12,26,0,3,112,111,115,0,9,23,3,26,
-12,24,0,4,110,97,109,101,0,0,0,0,12,25,0,7,
-115,101,116,109,101,116,97,0,31,19,23,3,19,19,22,19,
-30,8,4,22,9,9,9,84,111,107,101,110,40,116,111,107,
-46,112,111,115,44,39,114,101,103,39,44,107,108,115,41,44,
-0,0,0,0,12,23,0,5,84,111,107,101,110,0,0,0,
-13,22,23,0,12,26,0,3,112,111,115,0,9,23,3,26,
-12,24,0,3,114,101,103,0,15,25,7,0,31,20,23,3,
-19,20,22,20,30,4,4,23,9,9,9,112,97,114,101,110,
-116,93,41,41,41,0,0,0,15,21,5,0,27,18,19,3,
-31,13,15,4,19,13,14,13,31,11,13,1,19,11,12,11,
-31,9,11,1,19,9,10,9,30,8,4,25,9,9,102,111,
+115,44,107,108,115,41,0,0,12,15,0,7,100,111,95,99,
+111,100,101,0,49,10,1,15,12,15,0,7,79,80,95,71,
+83,69,84,0,13,12,15,0,15,13,8,0,15,14,7,0,
+50,9,10,3,30,7,4,45,9,9,115,101,108,102,46,102,
+114,101,101,95,116,109,112,40,116,115,41,32,35,82,69,71,
+0,0,0,0,12,13,0,8,102,114,101,101,95,116,109,112,
+0,0,0,0,49,10,1,13,15,12,8,0,50,9,10,1,
+30,13,4,47,9,9,115,101,108,102,46,102,114,101,101,95,
+116,109,112,40,115,101,108,102,46,100,111,40,84,111,107,101,
+110,40,116,111,107,46,112,111,115,44,39,99,97,108,108,39,
+44,78,111,110,101,44,91,0,12,13,0,8,102,114,101,101,
+95,116,109,112,0,0,0,0,49,10,1,13,12,16,0,2,
+100,111,0,0,49,13,1,16,12,17,0,5,84,111,107,101,
+110,0,0,0,13,16,17,0,12,21,0,3,112,111,115,0,
+9,17,3,21,12,18,0,4,99,97,108,108,0,0,0,0,
+28,19,0,0,30,9,4,48,9,9,9,84,111,107,101,110,
+40,116,111,107,46,112,111,115,44,39,110,97,109,101,39,44,
+39,115,101,116,109,101,116,97,39,41,44,0,12,25,0,5,
+84,111,107,101,110,0,0,0,13,24,25,0,12,28,0,3,
+112,111,115,0,9,25,3,28,12,26,0,4,110,97,109,101,
+0,0,0,0,12,27,0,7,115,101,116,109,101,116,97,0,
+31,21,25,3,19,21,24,21,30,8,4,49,9,9,9,84,
+111,107,101,110,40,116,111,107,46,112,111,115,44,39,114,101,
+103,39,44,107,108,115,41,44,0,0,0,0,12,25,0,5,
+84,111,107,101,110,0,0,0,13,24,25,0,12,28,0,3,
+112,111,115,0,9,25,3,28,12,26,0,3,114,101,103,0,
+15,27,7,0,31,22,25,3,19,22,24,22,30,4,4,50,
+9,9,9,112,97,114,101,110,116,93,41,41,41,0,0,0,
+15,23,5,0,27,20,21,3,31,15,17,4,19,15,16,15,
+50,12,13,1,50,9,10,1,30,8,4,52,9,9,102,111,
 114,32,109,101,109,98,101,114,32,105,110,32,105,116,101,109,
-115,91,49,93,46,105,116,101,109,115,58,0,11,11,0,0,
-0,0,0,0,0,0,240,63,9,10,4,11,12,11,0,5,
-105,116,101,109,115,0,0,0,9,10,10,11,11,11,0,0,
-0,0,0,0,0,0,0,0,42,9,10,11,18,0,0,92,
-30,13,4,26,9,9,9,105,102,32,109,101,109,98,101,114,
+115,91,49,93,46,105,116,101,109,115,58,0,11,11,0,1,
+1,0,0,0,0,0,0,0,9,10,4,11,12,11,0,5,
+105,116,101,109,115,0,0,0,9,10,10,11,11,11,0,1,
+0,0,0,0,0,0,0,0,42,9,10,11,18,0,0,90,
+30,13,4,53,9,9,9,105,102,32,109,101,109,98,101,114,
 46,116,121,112,101,32,61,61,32,39,100,101,102,39,58,32,
 115,101,108,102,46,100,111,95,100,101,102,40,109,101,109,98,
 101,114,44,107,108,115,41,0,12,13,0,4,116,121,112,101,
 0,0,0,0,9,12,9,13,12,13,0,3,100,101,102,0,
-23,12,12,13,21,12,0,0,18,0,0,10,12,14,0,6,
-100,111,95,100,101,102,0,0,9,13,1,14,15,14,9,0,
-15,15,7,0,31,12,14,2,19,12,13,12,18,0,0,59,
-30,21,4,27,9,9,9,101,108,105,102,32,109,101,109,98,
-101,114,46,116,121,112,101,32,61,61,32,39,115,121,109,98,
-111,108,39,32,97,110,100,32,109,101,109,98,101,114,46,118,
-97,108,32,61,61,32,39,61,39,58,32,115,101,108,102,46,
-100,111,95,99,108,97,115,115,118,97,114,40,109,101,109,98,
-101,114,44,107,108,115,41,0,12,13,0,4,116,121,112,101,
-0,0,0,0,9,12,9,13,12,13,0,6,115,121,109,98,
-111,108,0,0,23,12,12,13,21,12,0,0,18,0,0,7,
-12,13,0,3,118,97,108,0,9,12,9,13,12,13,0,1,
-61,0,0,0,23,12,12,13,21,12,0,0,18,0,0,11,
-12,14,0,11,100,111,95,99,108,97,115,115,118,97,114,0,
-9,13,1,14,15,14,9,0,15,15,7,0,31,12,14,2,
-19,12,13,12,18,0,0,9,30,5,4,28,9,9,9,101,
-108,115,101,58,32,99,111,110,116,105,110,117,101,0,0,0,
-18,0,255,166,18,0,0,1,18,0,255,164,30,7,4,30,
-9,9,115,101,108,102,46,102,114,101,101,95,114,101,103,40,
-107,108,115,41,32,35,82,69,71,0,0,0,12,12,0,8,
-102,114,101,101,95,114,101,103,0,0,0,0,9,11,1,12,
-15,12,7,0,31,10,12,1,19,10,11,10,0,0,0,0,
-12,87,0,8,100,111,95,99,108,97,115,115,0,0,0,0,
-10,7,87,86,16,87,0,128,44,13,0,0,30,7,4,33,
-9,100,101,102,32,100,111,95,99,108,97,115,115,118,97,114,
-40,115,101,108,102,44,116,44,114,41,58,0,12,1,0,9,
-116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,11,100,111,95,99,108,97,115,115,118,97,114,0,
-34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,28,4,0,0,9,3,0,4,30,9,4,34,
-9,9,118,97,114,32,61,32,115,101,108,102,46,100,111,95,
-115,116,114,105,110,103,40,116,46,105,116,101,109,115,91,48,
-93,41,0,0,12,7,0,9,100,111,95,115,116,114,105,110,
-103,0,0,0,9,6,1,7,12,8,0,5,105,116,101,109,
-115,0,0,0,9,7,2,8,11,8,0,0,0,0,0,0,
-0,0,0,0,9,7,7,8,31,5,7,1,19,5,6,5,
-15,4,5,0,30,7,4,35,9,9,118,97,108,32,61,32,
+23,12,12,13,21,12,0,0,18,0,0,9,12,17,0,6,
+100,111,95,100,101,102,0,0,49,13,1,17,15,15,9,0,
+15,16,7,0,50,12,13,2,18,0,0,58,30,21,4,54,
+9,9,9,101,108,105,102,32,109,101,109,98,101,114,46,116,
+121,112,101,32,61,61,32,39,115,121,109,98,111,108,39,32,
+97,110,100,32,109,101,109,98,101,114,46,118,97,108,32,61,
+61,32,39,61,39,58,32,115,101,108,102,46,100,111,95,99,
+108,97,115,115,118,97,114,40,109,101,109,98,101,114,44,107,
+108,115,41,0,12,13,0,4,116,121,112,101,0,0,0,0,
+9,12,9,13,12,13,0,6,115,121,109,98,111,108,0,0,
+23,12,12,13,21,12,0,0,18,0,0,7,12,13,0,3,
+118,97,108,0,9,12,9,13,12,13,0,1,61,0,0,0,
+23,12,12,13,21,12,0,0,18,0,0,10,12,17,0,11,
+100,111,95,99,108,97,115,115,118,97,114,0,49,13,1,17,
+15,15,9,0,15,16,7,0,50,12,13,2,18,0,0,9,
+30,5,4,55,9,9,9,101,108,115,101,58,32,99,111,110,
+116,105,110,117,101,0,0,0,18,0,255,168,18,0,0,1,
+18,0,255,166,30,7,4,57,9,9,115,101,108,102,46,102,
+114,101,101,95,114,101,103,40,107,108,115,41,32,35,82,69,
+71,0,0,0,12,14,0,8,102,114,101,101,95,114,101,103,
+0,0,0,0,49,11,1,14,15,13,7,0,50,10,11,1,
+0,0,0,0,12,89,0,8,100,111,95,99,108,97,115,115,
+0,0,0,0,10,8,89,88,16,89,0,123,44,14,0,0,
+30,7,4,60,9,100,101,102,32,100,111,95,99,108,97,115,
+115,118,97,114,40,115,101,108,102,44,116,44,114,41,58,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,11,100,111,95,99,108,97,115,115,
+118,97,114,0,34,1,0,0,28,2,0,0,9,1,0,2,
+28,3,0,0,9,2,0,3,28,4,0,0,9,3,0,4,
+30,9,4,61,9,9,118,97,114,32,61,32,115,101,108,102,
+46,100,111,95,115,116,114,105,110,103,40,116,46,105,116,101,
+109,115,91,48,93,41,0,0,12,9,0,9,100,111,95,115,
+116,114,105,110,103,0,0,0,49,6,1,9,12,9,0,5,
+105,116,101,109,115,0,0,0,9,8,2,9,11,9,0,1,
+0,0,0,0,0,0,0,0,9,8,8,9,50,5,6,1,
+15,4,5,0,30,7,4,62,9,9,118,97,108,32,61,32,
 115,101,108,102,46,100,111,40,116,46,105,116,101,109,115,91,
-49,93,41,0,12,8,0,2,100,111,0,0,9,7,1,8,
-12,9,0,5,105,116,101,109,115,0,0,0,9,8,2,9,
-11,9,0,0,0,0,0,0,0,0,240,63,9,8,8,9,
-31,6,8,1,19,6,7,6,15,5,6,0,30,9,4,36,
-9,9,115,101,108,102,46,100,111,95,99,111,100,101,40,79,
-80,95,83,69,84,44,114,44,118,97,114,44,118,97,108,41,
-0,0,0,0,12,8,0,7,100,111,95,99,111,100,101,0,
-9,7,1,8,12,12,0,6,79,80,95,83,69,84,0,0,
-13,8,12,0,15,9,3,0,15,10,4,0,15,11,5,0,
-31,6,8,4,19,6,7,6,30,6,4,37,9,9,115,101,
-108,102,46,102,114,101,101,95,114,101,103,40,118,97,114,41,
-0,0,0,0,12,8,0,8,102,114,101,101,95,114,101,103,
-0,0,0,0,9,7,1,8,15,8,4,0,31,6,8,1,
-19,6,7,6,30,6,4,38,9,9,115,101,108,102,46,102,
-114,101,101,95,114,101,103,40,118,97,108,41,0,0,0,0,
-12,8,0,8,102,114,101,101,95,114,101,103,0,0,0,0,
-9,7,1,8,15,8,5,0,31,6,8,1,19,6,7,6,
-0,0,0,0,12,88,0,11,100,111,95,99,108,97,115,115,
-118,97,114,0,10,7,88,87,16,88,0,236,44,11,0,0,
-30,6,4,41,9,100,101,102,32,100,111,95,119,104,105,108,
+49,93,41,0,12,10,0,2,100,111,0,0,49,7,1,10,
+12,10,0,5,105,116,101,109,115,0,0,0,9,9,2,10,
+11,10,0,1,1,0,0,0,0,0,0,0,9,9,9,10,
+50,6,7,1,15,5,6,0,30,9,4,63,9,9,115,101,
+108,102,46,100,111,95,99,111,100,101,40,79,80,95,83,69,
+84,44,114,44,118,97,114,44,118,97,108,41,0,0,0,0,
+12,13,0,7,100,111,95,99,111,100,101,0,49,7,1,13,
+12,13,0,6,79,80,95,83,69,84,0,0,13,9,13,0,
+15,10,3,0,15,11,4,0,15,12,5,0,50,6,7,4,
+30,6,4,64,9,9,115,101,108,102,46,102,114,101,101,95,
+114,101,103,40,118,97,114,41,0,0,0,0,12,10,0,8,
+102,114,101,101,95,114,101,103,0,0,0,0,49,7,1,10,
+15,9,4,0,50,6,7,1,30,6,4,65,9,9,115,101,
+108,102,46,102,114,101,101,95,114,101,103,40,118,97,108,41,
+0,0,0,0,12,10,0,8,102,114,101,101,95,114,101,103,
+0,0,0,0,49,7,1,10,15,9,5,0,50,6,7,1,
+0,0,0,0,12,90,0,11,100,111,95,99,108,97,115,115,
+118,97,114,0,10,8,90,89,16,90,0,223,44,13,0,0,
+30,6,4,68,9,100,101,102,32,100,111,95,119,104,105,108,
 101,40,115,101,108,102,44,116,41,58,0,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
 12,1,0,8,100,111,95,119,104,105,108,101,0,0,0,0,
 34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,30,5,4,42,9,9,105,116,101,109,115,32,
+9,2,0,3,30,5,4,69,9,9,105,116,101,109,115,32,
 61,32,116,46,105,116,101,109,115,0,0,0,12,5,0,5,
 105,116,101,109,115,0,0,0,9,4,2,5,15,3,4,0,
-30,6,4,43,9,9,116,32,61,32,115,101,108,102,46,115,
-116,97,99,107,95,116,97,103,40,41,0,0,12,6,0,9,
-115,116,97,99,107,95,116,97,103,0,0,0,9,5,1,6,
-31,4,0,0,19,4,5,4,15,2,4,0,30,6,4,44,
-9,9,115,101,108,102,46,116,97,103,40,116,44,39,98,101,
-103,105,110,39,41,0,0,0,12,6,0,3,116,97,103,0,
-9,5,1,6,15,6,2,0,12,7,0,5,98,101,103,105,
-110,0,0,0,31,4,6,2,19,4,5,4,30,7,4,45,
-9,9,115,101,108,102,46,116,97,103,40,116,44,39,99,111,
-110,116,105,110,117,101,39,41,0,0,0,0,12,6,0,3,
-116,97,103,0,9,5,1,6,15,6,2,0,12,7,0,8,
-99,111,110,116,105,110,117,101,0,0,0,0,31,4,6,2,
-19,4,5,4,30,6,4,46,9,9,114,32,61,32,115,101,
-108,102,46,100,111,40,105,116,101,109,115,91,48,93,41,0,
-12,7,0,2,100,111,0,0,9,6,1,7,11,8,0,0,
-0,0,0,0,0,0,0,0,9,7,3,8,31,5,7,1,
-19,5,6,5,15,4,5,0,30,6,4,47,9,9,115,101,
+30,6,4,70,9,9,116,32,61,32,115,101,108,102,46,115,
+116,97,99,107,95,116,97,103,40,41,0,0,12,7,0,9,
+115,116,97,99,107,95,116,97,103,0,0,0,49,5,1,7,
+50,4,5,0,15,2,4,0,30,6,4,71,9,9,115,101,
+108,102,46,116,97,103,40,116,44,39,98,101,103,105,110,39,
+41,0,0,0,12,9,0,3,116,97,103,0,49,5,1,9,
+15,7,2,0,12,8,0,5,98,101,103,105,110,0,0,0,
+50,4,5,2,30,7,4,72,9,9,115,101,108,102,46,116,
+97,103,40,116,44,39,99,111,110,116,105,110,117,101,39,41,
+0,0,0,0,12,9,0,3,116,97,103,0,49,5,1,9,
+15,7,2,0,12,8,0,8,99,111,110,116,105,110,117,101,
+0,0,0,0,50,4,5,2,30,6,4,73,9,9,114,32,
+61,32,115,101,108,102,46,100,111,40,105,116,101,109,115,91,
+48,93,41,0,12,9,0,2,100,111,0,0,49,6,1,9,
+11,9,0,1,0,0,0,0,0,0,0,0,9,8,3,9,
+50,5,6,1,15,4,5,0,30,6,4,74,9,9,115,101,
 108,102,46,100,111,95,99,111,100,101,40,79,80,95,73,70,
-44,114,41,0,12,7,0,7,100,111,95,99,111,100,101,0,
-9,6,1,7,12,9,0,5,79,80,95,73,70,0,0,0,
-13,7,9,0,15,8,4,0,31,5,7,2,19,5,6,5,
-30,6,4,48,9,9,115,101,108,102,46,102,114,101,101,95,
-116,109,112,40,114,41,32,35,82,69,71,0,12,7,0,8,
-102,114,101,101,95,116,109,112,0,0,0,0,9,6,1,7,
-15,7,4,0,31,5,7,1,19,5,6,5,30,6,4,49,
-9,9,115,101,108,102,46,106,117,109,112,40,116,44,39,101,
-110,100,39,41,0,0,0,0,12,7,0,4,106,117,109,112,
-0,0,0,0,9,6,1,7,15,7,2,0,12,8,0,3,
-101,110,100,0,31,5,7,2,19,5,6,5,30,10,4,50,
-9,9,115,101,108,102,46,102,114,101,101,95,116,109,112,40,
-115,101,108,102,46,100,111,40,105,116,101,109,115,91,49,93,
-41,41,32,35,82,69,71,0,12,7,0,8,102,114,101,101,
-95,116,109,112,0,0,0,0,9,6,1,7,12,9,0,2,
-100,111,0,0,9,8,1,9,11,10,0,0,0,0,0,0,
-0,0,240,63,9,9,3,10,31,7,9,1,19,7,8,7,
-31,5,7,1,19,5,6,5,30,6,4,51,9,9,115,101,
-108,102,46,106,117,109,112,40,116,44,39,98,101,103,105,110,
-39,41,0,0,12,7,0,4,106,117,109,112,0,0,0,0,
-9,6,1,7,15,7,2,0,12,8,0,5,98,101,103,105,
-110,0,0,0,31,5,7,2,19,5,6,5,30,6,4,52,
-9,9,115,101,108,102,46,116,97,103,40,116,44,39,98,114,
-101,97,107,39,41,0,0,0,12,7,0,3,116,97,103,0,
-9,6,1,7,15,7,2,0,12,8,0,5,98,114,101,97,
-107,0,0,0,31,5,7,2,19,5,6,5,30,5,4,53,
-9,9,115,101,108,102,46,116,97,103,40,116,44,39,101,110,
-100,39,41,0,12,7,0,3,116,97,103,0,9,6,1,7,
-15,7,2,0,12,8,0,3,101,110,100,0,31,5,7,2,
-19,5,6,5,30,5,4,54,9,9,115,101,108,102,46,112,
-111,112,95,116,97,103,40,41,0,0,0,0,12,7,0,7,
-112,111,112,95,116,97,103,0,9,6,1,7,31,5,0,0,
-19,5,6,5,0,0,0,0,12,89,0,8,100,111,95,119,
-104,105,108,101,0,0,0,0,10,7,89,88,16,89,1,39,
-44,15,0,0,30,6,4,57,9,100,101,102,32,100,111,95,
-102,111,114,40,115,101,108,102,44,116,111,107,41,58,0,0,
-12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
-33,1,0,0,12,1,0,6,100,111,95,102,111,114,0,0,
-34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,30,5,4,58,9,9,105,116,101,109,115,32,
-61,32,116,111,107,46,105,116,101,109,115,0,12,5,0,5,
-105,116,101,109,115,0,0,0,9,4,2,5,15,3,4,0,
-30,8,4,60,9,9,114,101,103,32,61,32,115,101,108,102,
-46,100,111,95,108,111,99,97,108,40,105,116,101,109,115,91,
-48,93,41,0,12,7,0,8,100,111,95,108,111,99,97,108,
-0,0,0,0,9,6,1,7,11,8,0,0,0,0,0,0,
-0,0,0,0,9,7,3,8,31,5,7,1,19,5,6,5,
-15,4,5,0,30,7,4,61,9,9,105,116,114,32,61,32,
-115,101,108,102,46,100,111,40,105,116,101,109,115,91,49,93,
-41,0,0,0,12,8,0,2,100,111,0,0,9,7,1,8,
-11,9,0,0,0,0,0,0,0,0,240,63,9,8,3,9,
-31,6,8,1,19,6,7,6,15,5,6,0,30,7,4,62,
-9,9,105,32,61,32,115,101,108,102,46,95,100,111,95,110,
-117,109,98,101,114,40,39,48,39,41,0,0,12,9,0,10,
-95,100,111,95,110,117,109,98,101,114,0,0,9,8,1,9,
-12,9,0,1,48,0,0,0,31,7,9,1,19,7,8,7,
-15,6,7,0,30,6,4,64,9,9,116,32,61,32,115,101,
+44,114,41,0,12,10,0,7,100,111,95,99,111,100,101,0,
+49,6,1,10,12,10,0,5,79,80,95,73,70,0,0,0,
+13,8,10,0,15,9,4,0,50,5,6,2,30,6,4,75,
+9,9,115,101,108,102,46,102,114,101,101,95,116,109,112,40,
+114,41,32,35,82,69,71,0,12,9,0,8,102,114,101,101,
+95,116,109,112,0,0,0,0,49,6,1,9,15,8,4,0,
+50,5,6,1,30,6,4,76,9,9,115,101,108,102,46,106,
+117,109,112,40,116,44,39,101,110,100,39,41,0,0,0,0,
+12,10,0,4,106,117,109,112,0,0,0,0,49,6,1,10,
+15,8,2,0,12,9,0,3,101,110,100,0,50,5,6,2,
+30,10,4,77,9,9,115,101,108,102,46,102,114,101,101,95,
+116,109,112,40,115,101,108,102,46,100,111,40,105,116,101,109,
+115,91,49,93,41,41,32,35,82,69,71,0,12,9,0,8,
+102,114,101,101,95,116,109,112,0,0,0,0,49,6,1,9,
+12,12,0,2,100,111,0,0,49,9,1,12,11,12,0,1,
+1,0,0,0,0,0,0,0,9,11,3,12,50,8,9,1,
+50,5,6,1,30,6,4,78,9,9,115,101,108,102,46,106,
+117,109,112,40,116,44,39,98,101,103,105,110,39,41,0,0,
+12,10,0,4,106,117,109,112,0,0,0,0,49,6,1,10,
+15,8,2,0,12,9,0,5,98,101,103,105,110,0,0,0,
+50,5,6,2,30,6,4,79,9,9,115,101,108,102,46,116,
+97,103,40,116,44,39,98,114,101,97,107,39,41,0,0,0,
+12,10,0,3,116,97,103,0,49,6,1,10,15,8,2,0,
+12,9,0,5,98,114,101,97,107,0,0,0,50,5,6,2,
+30,5,4,80,9,9,115,101,108,102,46,116,97,103,40,116,
+44,39,101,110,100,39,41,0,12,10,0,3,116,97,103,0,
+49,6,1,10,15,8,2,0,12,9,0,3,101,110,100,0,
+50,5,6,2,30,5,4,81,9,9,115,101,108,102,46,112,
+111,112,95,116,97,103,40,41,0,0,0,0,12,8,0,7,
+112,111,112,95,116,97,103,0,49,6,1,8,50,5,6,0,
+0,0,0,0,12,91,0,8,100,111,95,119,104,105,108,101,
+0,0,0,0,10,8,91,90,16,91,1,23,44,16,0,0,
+30,6,4,84,9,100,101,102,32,100,111,95,102,111,114,40,
+115,101,108,102,44,116,111,107,41,58,0,0,12,1,0,9,
+116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
+12,1,0,6,100,111,95,102,111,114,0,0,34,1,0,0,
+28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
+30,5,4,85,9,9,105,116,101,109,115,32,61,32,116,111,
+107,46,105,116,101,109,115,0,12,5,0,5,105,116,101,109,
+115,0,0,0,9,4,2,5,15,3,4,0,30,8,4,87,
+9,9,114,101,103,32,61,32,115,101,108,102,46,100,111,95,
+108,111,99,97,108,40,105,116,101,109,115,91,48,93,41,0,
+12,9,0,8,100,111,95,108,111,99,97,108,0,0,0,0,
+49,6,1,9,11,9,0,1,0,0,0,0,0,0,0,0,
+9,8,3,9,50,5,6,1,15,4,5,0,30,7,4,88,
+9,9,105,116,114,32,61,32,115,101,108,102,46,100,111,40,
+105,116,101,109,115,91,49,93,41,0,0,0,12,10,0,2,
+100,111,0,0,49,7,1,10,11,10,0,1,1,0,0,0,
+0,0,0,0,9,9,3,10,50,6,7,1,15,5,6,0,
+30,7,4,89,9,9,105,32,61,32,115,101,108,102,46,95,
+100,111,95,110,117,109,98,101,114,40,39,48,39,41,0,0,
+12,11,0,10,95,100,111,95,110,117,109,98,101,114,0,0,
+49,8,1,11,12,10,0,1,48,0,0,0,50,7,8,1,
+15,6,7,0,30,6,4,91,9,9,116,32,61,32,115,101,
 108,102,46,115,116,97,99,107,95,116,97,103,40,41,0,0,
-12,10,0,9,115,116,97,99,107,95,116,97,103,0,0,0,
-9,9,1,10,31,8,0,0,19,8,9,8,15,7,8,0,
-30,6,4,65,9,9,115,101,108,102,46,116,97,103,40,116,
-44,39,108,111,111,112,39,41,0,0,0,0,12,10,0,3,
-116,97,103,0,9,9,1,10,15,10,7,0,12,11,0,4,
-108,111,111,112,0,0,0,0,31,8,10,2,19,8,9,8,
-30,7,4,66,9,9,115,101,108,102,46,116,97,103,40,116,
-44,39,99,111,110,116,105,110,117,101,39,41,0,0,0,0,
-12,10,0,3,116,97,103,0,9,9,1,10,15,10,7,0,
-12,11,0,8,99,111,110,116,105,110,117,101,0,0,0,0,
-31,8,10,2,19,8,9,8,30,9,4,67,9,9,115,101,
-108,102,46,100,111,95,99,111,100,101,40,79,80,95,73,84,
-69,82,44,114,101,103,44,105,116,114,44,105,41,0,0,0,
-12,10,0,7,100,111,95,99,111,100,101,0,9,9,1,10,
-12,14,0,7,79,80,95,73,84,69,82,0,13,10,14,0,
-15,11,4,0,15,12,5,0,15,13,6,0,31,8,10,4,
-19,8,9,8,30,6,4,68,9,9,115,101,108,102,46,106,
+12,11,0,9,115,116,97,99,107,95,116,97,103,0,0,0,
+49,9,1,11,50,8,9,0,15,7,8,0,30,6,4,92,
+9,9,115,101,108,102,46,116,97,103,40,116,44,39,108,111,
+111,112,39,41,0,0,0,0,12,13,0,3,116,97,103,0,
+49,9,1,13,15,11,7,0,12,12,0,4,108,111,111,112,
+0,0,0,0,50,8,9,2,30,7,4,93,9,9,115,101,
+108,102,46,116,97,103,40,116,44,39,99,111,110,116,105,110,
+117,101,39,41,0,0,0,0,12,13,0,3,116,97,103,0,
+49,9,1,13,15,11,7,0,12,12,0,8,99,111,110,116,
+105,110,117,101,0,0,0,0,50,8,9,2,30,9,4,94,
+9,9,115,101,108,102,46,100,111,95,99,111,100,101,40,79,
+80,95,73,84,69,82,44,114,101,103,44,105,116,114,44,105,
+41,0,0,0,12,15,0,7,100,111,95,99,111,100,101,0,
+49,9,1,15,12,15,0,7,79,80,95,73,84,69,82,0,
+13,11,15,0,15,12,4,0,15,13,5,0,15,14,6,0,
+50,8,9,4,30,6,4,95,9,9,115,101,108,102,46,106,
 117,109,112,40,116,44,39,101,110,100,39,41,0,0,0,0,
-12,10,0,4,106,117,109,112,0,0,0,0,9,9,1,10,
-15,10,7,0,12,11,0,3,101,110,100,0,31,8,10,2,
-19,8,9,8,30,10,4,69,9,9,115,101,108,102,46,102,
-114,101,101,95,116,109,112,40,115,101,108,102,46,100,111,40,
-105,116,101,109,115,91,50,93,41,41,32,35,82,69,71,0,
-12,10,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
-9,9,1,10,12,12,0,2,100,111,0,0,9,11,1,12,
-11,13,0,0,0,0,0,0,0,0,0,64,9,12,3,13,
-31,10,12,1,19,10,11,10,31,8,10,1,19,8,9,8,
-30,6,4,70,9,9,115,101,108,102,46,106,117,109,112,40,
-116,44,39,108,111,111,112,39,41,0,0,0,12,10,0,4,
-106,117,109,112,0,0,0,0,9,9,1,10,15,10,7,0,
-12,11,0,4,108,111,111,112,0,0,0,0,31,8,10,2,
-19,8,9,8,30,6,4,71,9,9,115,101,108,102,46,116,
+12,13,0,4,106,117,109,112,0,0,0,0,49,9,1,13,
+15,11,7,0,12,12,0,3,101,110,100,0,50,8,9,2,
+30,10,4,96,9,9,115,101,108,102,46,102,114,101,101,95,
+116,109,112,40,115,101,108,102,46,100,111,40,105,116,101,109,
+115,91,50,93,41,41,32,35,82,69,71,0,12,12,0,8,
+102,114,101,101,95,116,109,112,0,0,0,0,49,9,1,12,
+12,15,0,2,100,111,0,0,49,12,1,15,11,15,0,1,
+2,0,0,0,0,0,0,0,9,14,3,15,50,11,12,1,
+50,8,9,1,30,6,4,97,9,9,115,101,108,102,46,106,
+117,109,112,40,116,44,39,108,111,111,112,39,41,0,0,0,
+12,13,0,4,106,117,109,112,0,0,0,0,49,9,1,13,
+15,11,7,0,12,12,0,4,108,111,111,112,0,0,0,0,
+50,8,9,2,30,6,4,98,9,9,115,101,108,102,46,116,
 97,103,40,116,44,39,98,114,101,97,107,39,41,0,0,0,
-12,10,0,3,116,97,103,0,9,9,1,10,15,10,7,0,
-12,11,0,5,98,114,101,97,107,0,0,0,31,8,10,2,
-19,8,9,8,30,5,4,72,9,9,115,101,108,102,46,116,
-97,103,40,116,44,39,101,110,100,39,41,0,12,10,0,3,
-116,97,103,0,9,9,1,10,15,10,7,0,12,11,0,3,
-101,110,100,0,31,8,10,2,19,8,9,8,30,5,4,73,
-9,9,115,101,108,102,46,112,111,112,95,116,97,103,40,41,
-0,0,0,0,12,10,0,7,112,111,112,95,116,97,103,0,
-9,9,1,10,31,8,0,0,19,8,9,8,30,7,4,75,
+12,13,0,3,116,97,103,0,49,9,1,13,15,11,7,0,
+12,12,0,5,98,114,101,97,107,0,0,0,50,8,9,2,
+30,5,4,99,9,9,115,101,108,102,46,116,97,103,40,116,
+44,39,101,110,100,39,41,0,12,13,0,3,116,97,103,0,
+49,9,1,13,15,11,7,0,12,12,0,3,101,110,100,0,
+50,8,9,2,30,5,4,100,9,9,115,101,108,102,46,112,
+111,112,95,116,97,103,40,41,0,0,0,0,12,11,0,7,
+112,111,112,95,116,97,103,0,49,9,1,11,50,8,9,0,
+30,7,4,102,9,9,115,101,108,102,46,102,114,101,101,95,
+116,109,112,40,105,116,114,41,32,35,82,69,71,0,0,0,
+12,12,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
+49,9,1,12,15,11,5,0,50,8,9,1,30,5,4,103,
 9,9,115,101,108,102,46,102,114,101,101,95,116,109,112,40,
-105,116,114,41,32,35,82,69,71,0,0,0,12,10,0,8,
-102,114,101,101,95,116,109,112,0,0,0,0,9,9,1,10,
-15,10,5,0,31,8,10,1,19,8,9,8,30,5,4,76,
-9,9,115,101,108,102,46,102,114,101,101,95,116,109,112,40,
-105,41,0,0,12,10,0,8,102,114,101,101,95,116,109,112,
-0,0,0,0,9,9,1,10,15,10,6,0,31,8,10,1,
-19,8,9,8,0,0,0,0,12,90,0,6,100,111,95,102,
-111,114,0,0,10,7,90,89,16,90,1,17,44,19,0,0,
-30,8,4,79,9,100,101,102,32,100,111,95,99,111,109,112,
-40,115,101,108,102,44,116,44,114,61,78,111,110,101,41,58,
-0,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,7,100,111,95,99,
-111,109,112,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,3,0,0,9,2,0,3,28,3,0,0,28,4,0,0,
-32,3,0,4,30,8,4,80,9,9,110,97,109,101,32,61,
-32,39,99,111,109,112,58,39,43,115,101,108,102,46,103,101,
-116,95,116,97,103,40,41,0,12,5,0,5,99,111,109,112,
-58,0,0,0,12,8,0,7,103,101,116,95,116,97,103,0,
-9,7,1,8,31,6,0,0,19,6,7,6,1,5,5,6,
-15,4,5,0,30,12,4,81,9,9,114,32,61,32,115,101,
-108,102,46,100,111,95,108,111,99,97,108,40,84,111,107,101,
-110,40,116,46,112,111,115,44,39,110,97,109,101,39,44,110,
-97,109,101,41,41,0,0,0,12,7,0,8,100,111,95,108,
-111,99,97,108,0,0,0,0,9,6,1,7,12,9,0,5,
-84,111,107,101,110,0,0,0,13,8,9,0,12,12,0,3,
-112,111,115,0,9,9,2,12,12,10,0,4,110,97,109,101,
-0,0,0,0,15,11,4,0,31,7,9,3,19,7,8,7,
-31,5,7,1,19,5,6,5,15,3,5,0,30,8,4,82,
-9,9,115,101,108,102,46,100,111,95,99,111,100,101,40,79,
-80,95,76,73,83,84,44,114,44,48,44,48,41,0,0,0,
-12,7,0,7,100,111,95,99,111,100,101,0,9,6,1,7,
-12,11,0,7,79,80,95,76,73,83,84,0,13,7,11,0,
-15,8,3,0,11,9,0,0,0,0,0,0,0,0,0,0,
-11,10,0,0,0,0,0,0,0,0,0,0,31,5,7,4,
-19,5,6,5,30,9,4,83,9,9,107,101,121,32,61,32,
+105,41,0,0,12,12,0,8,102,114,101,101,95,116,109,112,
+0,0,0,0,49,9,1,12,15,11,6,0,50,8,9,1,
+0,0,0,0,12,92,0,6,100,111,95,102,111,114,0,0,
+10,8,92,91,16,92,1,13,44,20,0,0,30,8,4,106,
+9,100,101,102,32,100,111,95,99,111,109,112,40,115,101,108,
+102,44,116,44,114,61,78,111,110,101,41,58,0,0,0,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,7,100,111,95,99,111,109,112,0,
+34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
+9,2,0,3,28,3,0,0,28,4,0,0,32,3,0,4,
+30,8,4,107,9,9,110,97,109,101,32,61,32,39,99,111,
+109,112,58,39,43,115,101,108,102,46,103,101,116,95,116,97,
+103,40,41,0,12,5,0,5,99,111,109,112,58,0,0,0,
+12,9,0,7,103,101,116,95,116,97,103,0,49,7,1,9,
+50,6,7,0,1,5,5,6,15,4,5,0,30,12,4,108,
+9,9,114,32,61,32,115,101,108,102,46,100,111,95,108,111,
+99,97,108,40,84,111,107,101,110,40,116,46,112,111,115,44,
+39,110,97,109,101,39,44,110,97,109,101,41,41,0,0,0,
+12,9,0,8,100,111,95,108,111,99,97,108,0,0,0,0,
+49,6,1,9,12,10,0,5,84,111,107,101,110,0,0,0,
+13,9,10,0,12,13,0,3,112,111,115,0,9,10,2,13,
+12,11,0,4,110,97,109,101,0,0,0,0,15,12,4,0,
+31,8,10,3,19,8,9,8,50,5,6,1,15,3,5,0,
+30,8,4,109,9,9,115,101,108,102,46,100,111,95,99,111,
+100,101,40,79,80,95,76,73,83,84,44,114,44,48,44,48,
+41,0,0,0,12,12,0,7,100,111,95,99,111,100,101,0,
+49,6,1,12,12,12,0,7,79,80,95,76,73,83,84,0,
+13,8,12,0,15,9,3,0,11,10,0,1,0,0,0,0,
+0,0,0,0,11,11,0,1,0,0,0,0,0,0,0,0,
+50,5,6,4,30,9,4,110,9,9,107,101,121,32,61,32,
 84,111,107,101,110,40,116,46,112,111,115,44,39,103,101,116,
 39,44,78,111,110,101,44,91,0,0,0,0,12,8,0,5,
 84,111,107,101,110,0,0,0,13,7,8,0,12,12,0,3,
 112,111,115,0,9,8,2,12,12,9,0,3,103,101,116,0,
-28,10,0,0,30,7,4,84,9,9,9,9,84,111,107,101,
+28,10,0,0,30,7,4,111,9,9,9,9,84,111,107,101,
 110,40,116,46,112,111,115,44,39,114,101,103,39,44,114,41,
 44,0,0,0,12,15,0,5,84,111,107,101,110,0,0,0,
 13,14,15,0,12,18,0,3,112,111,115,0,9,15,2,18,
 12,16,0,3,114,101,103,0,15,17,3,0,31,12,15,3,
-19,12,14,12,30,9,4,85,9,9,9,9,84,111,107,101,
+19,12,14,12,30,9,4,112,9,9,9,9,84,111,107,101,
 110,40,116,46,112,111,115,44,39,115,121,109,98,111,108,39,
 44,39,78,111,110,101,39,41,93,41,0,0,12,15,0,5,
 84,111,107,101,110,0,0,0,13,14,15,0,12,18,0,3,
 112,111,115,0,9,15,2,18,12,16,0,6,115,121,109,98,
 111,108,0,0,12,17,0,4,78,111,110,101,0,0,0,0,
 31,13,15,3,19,13,14,13,27,11,12,2,31,6,8,4,
-19,6,7,6,15,5,6,0,30,13,4,86,9,9,97,112,
+19,6,7,6,15,5,6,0,30,13,4,113,9,9,97,112,
 32,61,32,84,111,107,101,110,40,116,46,112,111,115,44,39,
 115,121,109,98,111,108,39,44,39,61,39,44,91,107,101,121,
 44,116,46,105,116,101,109,115,91,48,93,93,41,0,0,0,
@@ -4635,1003 +4677,975 @@ unsigned char py_tinypy[] = {
 12,13,0,3,112,111,115,0,9,9,2,13,12,10,0,6,
 115,121,109,98,111,108,0,0,12,11,0,1,61,0,0,0,
 15,13,5,0,12,15,0,5,105,116,101,109,115,0,0,0,
-9,14,2,15,11,15,0,0,0,0,0,0,0,0,0,0,
+9,14,2,15,11,15,0,1,0,0,0,0,0,0,0,0,
 9,14,14,15,27,12,13,2,31,7,9,4,19,7,8,7,
-15,6,7,0,30,16,4,87,9,9,115,101,108,102,46,100,
+15,6,7,0,30,16,4,114,9,9,115,101,108,102,46,100,
 111,40,84,111,107,101,110,40,116,46,112,111,115,44,39,102,
 111,114,39,44,78,111,110,101,44,91,116,46,105,116,101,109,
 115,91,49,93,44,116,46,105,116,101,109,115,91,50,93,44,
-97,112,93,41,41,0,0,0,12,9,0,2,100,111,0,0,
-9,8,1,9,12,11,0,5,84,111,107,101,110,0,0,0,
-13,10,11,0,12,15,0,3,112,111,115,0,9,11,2,15,
-12,12,0,3,102,111,114,0,28,13,0,0,12,18,0,5,
-105,116,101,109,115,0,0,0,9,15,2,18,11,18,0,0,
-0,0,0,0,0,0,240,63,9,15,15,18,12,18,0,5,
-105,116,101,109,115,0,0,0,9,16,2,18,11,18,0,0,
-0,0,0,0,0,0,0,64,9,16,16,18,15,17,6,0,
-27,14,15,3,31,9,11,4,19,9,10,9,31,7,9,1,
-19,7,8,7,30,3,4,88,9,9,114,101,116,117,114,110,
-32,114,0,0,20,3,0,0,0,0,0,0,12,91,0,7,
-100,111,95,99,111,109,112,0,10,7,91,90,16,91,1,55,
-44,14,0,0,30,5,4,91,9,100,101,102,32,100,111,95,
-105,102,40,115,101,108,102,44,116,41,58,0,12,1,0,9,
-116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,5,100,111,95,105,102,0,0,0,34,1,0,0,
-28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-30,5,4,92,9,9,105,116,101,109,115,32,61,32,116,46,
-105,116,101,109,115,0,0,0,12,5,0,5,105,116,101,109,
-115,0,0,0,9,4,2,5,15,3,4,0,30,6,4,93,
-9,9,116,32,61,32,115,101,108,102,46,103,101,116,95,116,
-97,103,40,41,0,0,0,0,12,6,0,7,103,101,116,95,
-116,97,103,0,9,5,1,6,31,4,0,0,19,4,5,4,
-15,2,4,0,30,2,4,94,9,9,110,32,61,32,48,0,
-11,5,0,0,0,0,0,0,0,0,0,0,15,4,5,0,
-30,5,4,95,9,9,102,111,114,32,116,116,32,105,110,32,
-105,116,101,109,115,58,0,0,11,6,0,0,0,0,0,0,
-0,0,0,0,42,5,3,6,18,0,0,221,30,5,4,96,
-9,9,9,115,101,108,102,46,116,97,103,40,116,44,110,41,
-0,0,0,0,12,9,0,3,116,97,103,0,9,8,1,9,
-15,9,2,0,15,10,4,0,31,7,9,2,19,7,8,7,
-30,7,4,97,9,9,9,105,102,32,116,116,46,116,121,112,
-101,32,61,61,32,39,101,108,105,102,39,58,0,0,0,0,
-12,8,0,4,116,121,112,101,0,0,0,0,9,7,5,8,
-12,8,0,4,101,108,105,102,0,0,0,0,23,7,7,8,
-21,7,0,0,18,0,0,105,30,18,4,98,9,9,9,9,
-97,32,61,32,115,101,108,102,46,100,111,40,116,116,46,105,
-116,101,109,115,91,48,93,41,59,32,115,101,108,102,46,100,
-111,95,99,111,100,101,40,79,80,95,73,70,44,97,41,59,
-32,115,101,108,102,46,102,114,101,101,95,116,109,112,40,97,
-41,59,0,0,12,10,0,2,100,111,0,0,9,9,1,10,
-12,11,0,5,105,116,101,109,115,0,0,0,9,10,5,11,
-11,11,0,0,0,0,0,0,0,0,0,0,9,10,10,11,
-31,8,10,1,19,8,9,8,15,7,8,0,12,10,0,7,
-100,111,95,99,111,100,101,0,9,9,1,10,12,12,0,5,
-79,80,95,73,70,0,0,0,13,10,12,0,15,11,7,0,
-31,8,10,2,19,8,9,8,12,10,0,8,102,114,101,101,
-95,116,109,112,0,0,0,0,9,9,1,10,15,10,7,0,
-31,8,10,1,19,8,9,8,30,6,4,99,9,9,9,9,
-115,101,108,102,46,106,117,109,112,40,116,44,110,43,49,41,
-0,0,0,0,12,10,0,4,106,117,109,112,0,0,0,0,
-9,9,1,10,15,10,2,0,11,12,0,0,0,0,0,0,
-0,0,240,63,1,11,4,12,31,8,10,2,19,8,9,8,
-30,12,4,100,9,9,9,9,115,101,108,102,46,102,114,101,
-101,95,116,109,112,40,115,101,108,102,46,100,111,40,116,116,
-46,105,116,101,109,115,91,49,93,41,41,32,35,82,69,71,
-0,0,0,0,12,10,0,8,102,114,101,101,95,116,109,112,
-0,0,0,0,9,9,1,10,12,12,0,2,100,111,0,0,
-9,11,1,12,12,13,0,5,105,116,101,109,115,0,0,0,
-9,12,5,13,11,13,0,0,0,0,0,0,0,0,240,63,
-9,12,12,13,31,10,12,1,19,10,11,10,31,8,10,1,
-19,8,9,8,18,0,0,60,30,7,4,101,9,9,9,101,
-108,105,102,32,116,116,46,116,121,112,101,32,61,61,32,39,
-101,108,115,101,39,58,0,0,12,9,0,4,116,121,112,101,
-0,0,0,0,9,8,5,9,12,9,0,4,101,108,115,101,
-0,0,0,0,23,8,8,9,21,8,0,0,18,0,0,35,
-30,12,4,102,9,9,9,9,115,101,108,102,46,102,114,101,
-101,95,116,109,112,40,115,101,108,102,46,100,111,40,116,116,
-46,105,116,101,109,115,91,48,93,41,41,32,35,82,69,71,
-0,0,0,0,12,10,0,8,102,114,101,101,95,116,109,112,
-0,0,0,0,9,9,1,10,12,12,0,2,100,111,0,0,
-9,11,1,12,12,13,0,5,105,116,101,109,115,0,0,0,
-9,12,5,13,11,13,0,0,0,0,0,0,0,0,0,0,
-9,12,12,13,31,10,12,1,19,10,11,10,31,8,10,1,
-19,8,9,8,18,0,0,8,30,3,4,104,9,9,9,9,
-114,97,105,115,101,0,0,0,28,8,0,0,37,8,0,0,
-18,0,0,1,30,6,4,105,9,9,9,115,101,108,102,46,
-106,117,109,112,40,116,44,39,101,110,100,39,41,0,0,0,
-12,10,0,4,106,117,109,112,0,0,0,0,9,9,1,10,
-15,10,2,0,12,11,0,3,101,110,100,0,31,8,10,2,
-19,8,9,8,30,3,4,106,9,9,9,110,32,43,61,32,
-49,0,0,0,11,9,0,0,0,0,0,0,0,0,240,63,
-1,8,4,9,15,4,8,0,18,0,255,35,30,4,4,107,
+97,112,93,41,41,0,0,0,12,11,0,2,100,111,0,0,
+49,8,1,11,12,12,0,5,84,111,107,101,110,0,0,0,
+13,11,12,0,12,16,0,3,112,111,115,0,9,12,2,16,
+12,13,0,3,102,111,114,0,28,14,0,0,12,19,0,5,
+105,116,101,109,115,0,0,0,9,16,2,19,11,19,0,1,
+1,0,0,0,0,0,0,0,9,16,16,19,12,19,0,5,
+105,116,101,109,115,0,0,0,9,17,2,19,11,19,0,1,
+2,0,0,0,0,0,0,0,9,17,17,19,15,18,6,0,
+27,15,16,3,31,10,12,4,19,10,11,10,50,7,8,1,
+30,3,4,115,9,9,114,101,116,117,114,110,32,114,0,0,
+20,3,0,0,0,0,0,0,12,93,0,7,100,111,95,99,
+111,109,112,0,10,8,93,92,16,93,1,42,44,16,0,0,
+30,5,4,118,9,100,101,102,32,100,111,95,105,102,40,115,
+101,108,102,44,116,41,58,0,12,1,0,9,116,105,110,121,
+112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,5,
+100,111,95,105,102,0,0,0,34,1,0,0,28,2,0,0,
+9,1,0,2,28,3,0,0,9,2,0,3,30,5,4,119,
+9,9,105,116,101,109,115,32,61,32,116,46,105,116,101,109,
+115,0,0,0,12,5,0,5,105,116,101,109,115,0,0,0,
+9,4,2,5,15,3,4,0,30,6,4,120,9,9,116,32,
+61,32,115,101,108,102,46,103,101,116,95,116,97,103,40,41,
+0,0,0,0,12,7,0,7,103,101,116,95,116,97,103,0,
+49,5,1,7,50,4,5,0,15,2,4,0,30,2,4,121,
+9,9,110,32,61,32,48,0,11,5,0,1,0,0,0,0,
+0,0,0,0,15,4,5,0,30,5,4,122,9,9,102,111,
+114,32,116,116,32,105,110,32,105,116,101,109,115,58,0,0,
+11,6,0,1,0,0,0,0,0,0,0,0,42,5,3,6,
+18,0,0,211,30,5,4,123,9,9,9,115,101,108,102,46,
+116,97,103,40,116,44,110,41,0,0,0,0,12,12,0,3,
+116,97,103,0,49,8,1,12,15,10,2,0,15,11,4,0,
+50,7,8,2,30,7,4,124,9,9,9,105,102,32,116,116,
+46,116,121,112,101,32,61,61,32,39,101,108,105,102,39,58,
+0,0,0,0,12,8,0,4,116,121,112,101,0,0,0,0,
+9,7,5,8,12,8,0,4,101,108,105,102,0,0,0,0,
+23,7,7,8,21,7,0,0,18,0,0,99,30,18,4,125,
+9,9,9,9,97,32,61,32,115,101,108,102,46,100,111,40,
+116,116,46,105,116,101,109,115,91,48,93,41,59,32,115,101,
+108,102,46,100,111,95,99,111,100,101,40,79,80,95,73,70,
+44,97,41,59,32,115,101,108,102,46,102,114,101,101,95,116,
+109,112,40,97,41,59,0,0,12,12,0,2,100,111,0,0,
+49,9,1,12,12,12,0,5,105,116,101,109,115,0,0,0,
+9,11,5,12,11,12,0,1,0,0,0,0,0,0,0,0,
+9,11,11,12,50,8,9,1,15,7,8,0,12,13,0,7,
+100,111,95,99,111,100,101,0,49,9,1,13,12,13,0,5,
+79,80,95,73,70,0,0,0,13,11,13,0,15,12,7,0,
+50,8,9,2,12,12,0,8,102,114,101,101,95,116,109,112,
+0,0,0,0,49,9,1,12,15,11,7,0,50,8,9,1,
+30,6,4,126,9,9,9,9,115,101,108,102,46,106,117,109,
+112,40,116,44,110,43,49,41,0,0,0,0,12,13,0,4,
+106,117,109,112,0,0,0,0,49,9,1,13,15,11,2,0,
+11,13,0,1,1,0,0,0,0,0,0,0,1,12,4,13,
+50,8,9,2,30,12,4,127,9,9,9,9,115,101,108,102,
+46,102,114,101,101,95,116,109,112,40,115,101,108,102,46,100,
+111,40,116,116,46,105,116,101,109,115,91,49,93,41,41,32,
+35,82,69,71,0,0,0,0,12,12,0,8,102,114,101,101,
+95,116,109,112,0,0,0,0,49,9,1,12,12,15,0,2,
+100,111,0,0,49,12,1,15,12,15,0,5,105,116,101,109,
+115,0,0,0,9,14,5,15,11,15,0,1,1,0,0,0,
+0,0,0,0,9,14,14,15,50,11,12,1,50,8,9,1,
+18,0,0,58,30,7,4,128,9,9,9,101,108,105,102,32,
+116,116,46,116,121,112,101,32,61,61,32,39,101,108,115,101,
+39,58,0,0,12,9,0,4,116,121,112,101,0,0,0,0,
+9,8,5,9,12,9,0,4,101,108,115,101,0,0,0,0,
+23,8,8,9,21,8,0,0,18,0,0,33,30,12,4,129,
+9,9,9,9,115,101,108,102,46,102,114,101,101,95,116,109,
+112,40,115,101,108,102,46,100,111,40,116,116,46,105,116,101,
+109,115,91,48,93,41,41,32,35,82,69,71,0,0,0,0,
+12,12,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
+49,9,1,12,12,15,0,2,100,111,0,0,49,12,1,15,
+12,15,0,5,105,116,101,109,115,0,0,0,9,14,5,15,
+11,15,0,1,0,0,0,0,0,0,0,0,9,14,14,15,
+50,11,12,1,50,8,9,1,18,0,0,8,30,3,4,131,
+9,9,9,9,114,97,105,115,101,0,0,0,28,8,0,0,
+37,8,0,0,18,0,0,1,30,6,4,132,9,9,9,115,
+101,108,102,46,106,117,109,112,40,116,44,39,101,110,100,39,
+41,0,0,0,12,13,0,4,106,117,109,112,0,0,0,0,
+49,9,1,13,15,11,2,0,12,12,0,3,101,110,100,0,
+50,8,9,2,30,3,4,133,9,9,9,110,32,43,61,32,
+49,0,0,0,11,9,0,1,1,0,0,0,0,0,0,0,
+1,8,4,9,15,4,8,0,18,0,255,45,30,4,4,134,
 9,9,115,101,108,102,46,116,97,103,40,116,44,110,41,0,
-12,9,0,3,116,97,103,0,9,8,1,9,15,9,2,0,
-15,10,4,0,31,6,9,2,19,6,8,6,30,5,4,108,
-9,9,115,101,108,102,46,116,97,103,40,116,44,39,101,110,
-100,39,41,0,12,9,0,3,116,97,103,0,9,8,1,9,
-15,9,2,0,12,10,0,3,101,110,100,0,31,6,9,2,
-19,6,8,6,0,0,0,0,12,92,0,5,100,111,95,105,
-102,0,0,0,10,7,92,91,16,92,0,199,44,10,0,0,
-30,6,4,111,9,100,101,102,32,100,111,95,116,114,121,40,
-115,101,108,102,44,116,41,58,0,0,0,0,12,1,0,9,
-116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,6,100,111,95,116,114,121,0,0,34,1,0,0,
-28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-30,5,4,112,9,9,105,116,101,109,115,32,61,32,116,46,
-105,116,101,109,115,0,0,0,12,5,0,5,105,116,101,109,
-115,0,0,0,9,4,2,5,15,3,4,0,30,6,4,113,
-9,9,116,32,61,32,115,101,108,102,46,103,101,116,95,116,
-97,103,40,41,0,0,0,0,12,6,0,7,103,101,116,95,
-116,97,103,0,9,5,1,6,31,4,0,0,19,4,5,4,
-15,2,4,0,30,7,4,114,9,9,115,101,108,102,46,115,
-101,116,106,109,112,40,116,44,39,101,120,99,101,112,116,39,
-41,0,0,0,12,6,0,6,115,101,116,106,109,112,0,0,
-9,5,1,6,15,6,2,0,12,7,0,6,101,120,99,101,
-112,116,0,0,31,4,6,2,19,4,5,4,30,10,4,115,
+12,12,0,3,116,97,103,0,49,8,1,12,15,10,2,0,
+15,11,4,0,50,6,8,2,30,5,4,135,9,9,115,101,
+108,102,46,116,97,103,40,116,44,39,101,110,100,39,41,0,
+12,12,0,3,116,97,103,0,49,8,1,12,15,10,2,0,
+12,11,0,3,101,110,100,0,50,6,8,2,0,0,0,0,
+12,94,0,5,100,111,95,105,102,0,0,0,10,8,94,93,
+16,94,0,189,44,12,0,0,30,6,4,138,9,100,101,102,
+32,100,111,95,116,114,121,40,115,101,108,102,44,116,41,58,
+0,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
+121,0,0,0,33,1,0,0,12,1,0,6,100,111,95,116,
+114,121,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
+28,3,0,0,9,2,0,3,30,5,4,139,9,9,105,116,
+101,109,115,32,61,32,116,46,105,116,101,109,115,0,0,0,
+12,5,0,5,105,116,101,109,115,0,0,0,9,4,2,5,
+15,3,4,0,30,6,4,140,9,9,116,32,61,32,115,101,
+108,102,46,103,101,116,95,116,97,103,40,41,0,0,0,0,
+12,7,0,7,103,101,116,95,116,97,103,0,49,5,1,7,
+50,4,5,0,15,2,4,0,30,7,4,141,9,9,115,101,
+108,102,46,115,101,116,106,109,112,40,116,44,39,101,120,99,
+101,112,116,39,41,0,0,0,12,9,0,6,115,101,116,106,
+109,112,0,0,49,5,1,9,15,7,2,0,12,8,0,6,
+101,120,99,101,112,116,0,0,50,4,5,2,30,10,4,142,
 9,9,115,101,108,102,46,102,114,101,101,95,116,109,112,40,
 115,101,108,102,46,100,111,40,105,116,101,109,115,91,48,93,
-41,41,32,35,82,69,71,0,12,6,0,8,102,114,101,101,
-95,116,109,112,0,0,0,0,9,5,1,6,12,8,0,2,
-100,111,0,0,9,7,1,8,11,9,0,0,0,0,0,0,
-0,0,0,0,9,8,3,9,31,6,8,1,19,6,7,6,
-31,4,6,1,19,4,5,4,30,7,4,116,9,9,115,101,
-108,102,46,100,111,95,99,111,100,101,40,79,80,95,83,69,
-84,74,77,80,44,48,41,0,12,6,0,7,100,111,95,99,
-111,100,101,0,9,5,1,6,12,8,0,9,79,80,95,83,
-69,84,74,77,80,0,0,0,13,6,8,0,11,7,0,0,
-0,0,0,0,0,0,0,0,31,4,6,2,19,4,5,4,
-30,6,4,117,9,9,115,101,108,102,46,106,117,109,112,40,
-116,44,39,101,110,100,39,41,0,0,0,0,12,6,0,4,
-106,117,109,112,0,0,0,0,9,5,1,6,15,6,2,0,
-12,7,0,3,101,110,100,0,31,4,6,2,19,4,5,4,
-30,6,4,118,9,9,115,101,108,102,46,116,97,103,40,116,
-44,39,101,120,99,101,112,116,39,41,0,0,12,6,0,3,
-116,97,103,0,9,5,1,6,15,6,2,0,12,7,0,6,
-101,120,99,101,112,116,0,0,31,4,6,2,19,4,5,4,
-30,13,4,119,9,9,115,101,108,102,46,102,114,101,101,95,
-116,109,112,40,115,101,108,102,46,100,111,40,105,116,101,109,
-115,91,49,93,46,105,116,101,109,115,91,49,93,41,41,32,
-35,82,69,71,0,0,0,0,12,6,0,8,102,114,101,101,
-95,116,109,112,0,0,0,0,9,5,1,6,12,8,0,2,
-100,111,0,0,9,7,1,8,11,9,0,0,0,0,0,0,
-0,0,240,63,9,8,3,9,12,9,0,5,105,116,101,109,
-115,0,0,0,9,8,8,9,11,9,0,0,0,0,0,0,
-0,0,240,63,9,8,8,9,31,6,8,1,19,6,7,6,
-31,4,6,1,19,4,5,4,30,5,4,120,9,9,115,101,
-108,102,46,116,97,103,40,116,44,39,101,110,100,39,41,0,
-12,6,0,3,116,97,103,0,9,5,1,6,15,6,2,0,
-12,7,0,3,101,110,100,0,31,4,6,2,19,4,5,4,
-0,0,0,0,12,93,0,6,100,111,95,116,114,121,0,0,
-10,7,93,92,16,93,0,113,44,9,0,0,30,6,4,123,
+41,41,32,35,82,69,71,0,12,8,0,8,102,114,101,101,
+95,116,109,112,0,0,0,0,49,5,1,8,12,11,0,2,
+100,111,0,0,49,8,1,11,11,11,0,1,0,0,0,0,
+0,0,0,0,9,10,3,11,50,7,8,1,50,4,5,1,
+30,7,4,143,9,9,115,101,108,102,46,100,111,95,99,111,
+100,101,40,79,80,95,83,69,84,74,77,80,44,48,41,0,
+12,9,0,7,100,111,95,99,111,100,101,0,49,5,1,9,
+12,9,0,9,79,80,95,83,69,84,74,77,80,0,0,0,
+13,7,9,0,11,8,0,1,0,0,0,0,0,0,0,0,
+50,4,5,2,30,6,4,144,9,9,115,101,108,102,46,106,
+117,109,112,40,116,44,39,101,110,100,39,41,0,0,0,0,
+12,9,0,4,106,117,109,112,0,0,0,0,49,5,1,9,
+15,7,2,0,12,8,0,3,101,110,100,0,50,4,5,2,
+30,6,4,145,9,9,115,101,108,102,46,116,97,103,40,116,
+44,39,101,120,99,101,112,116,39,41,0,0,12,9,0,3,
+116,97,103,0,49,5,1,9,15,7,2,0,12,8,0,6,
+101,120,99,101,112,116,0,0,50,4,5,2,30,13,4,146,
+9,9,115,101,108,102,46,102,114,101,101,95,116,109,112,40,
+115,101,108,102,46,100,111,40,105,116,101,109,115,91,49,93,
+46,105,116,101,109,115,91,49,93,41,41,32,35,82,69,71,
+0,0,0,0,12,8,0,8,102,114,101,101,95,116,109,112,
+0,0,0,0,49,5,1,8,12,11,0,2,100,111,0,0,
+49,8,1,11,11,11,0,1,1,0,0,0,0,0,0,0,
+9,10,3,11,12,11,0,5,105,116,101,109,115,0,0,0,
+9,10,10,11,11,11,0,1,1,0,0,0,0,0,0,0,
+9,10,10,11,50,7,8,1,50,4,5,1,30,5,4,147,
+9,9,115,101,108,102,46,116,97,103,40,116,44,39,101,110,
+100,39,41,0,12,9,0,3,116,97,103,0,49,5,1,9,
+15,7,2,0,12,8,0,3,101,110,100,0,50,4,5,2,
+0,0,0,0,12,95,0,6,100,111,95,116,114,121,0,0,
+10,8,95,94,16,95,0,109,44,10,0,0,30,6,4,150,
 9,100,101,102,32,100,111,95,114,101,116,117,114,110,40,115,
 101,108,102,44,116,41,58,0,12,1,0,9,116,105,110,121,
 112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,9,
 100,111,95,114,101,116,117,114,110,0,0,0,34,1,0,0,
 28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-30,10,4,124,9,9,105,102,32,116,46,105,116,101,109,115,
+30,10,4,151,9,9,105,102,32,116,46,105,116,101,109,115,
 58,32,114,32,61,32,115,101,108,102,46,100,111,40,116,46,
 105,116,101,109,115,91,48,93,41,0,0,0,12,4,0,5,
 105,116,101,109,115,0,0,0,9,3,2,4,21,3,0,0,
-18,0,0,16,12,6,0,2,100,111,0,0,9,5,1,6,
-12,7,0,5,105,116,101,109,115,0,0,0,9,6,2,7,
-11,7,0,0,0,0,0,0,0,0,0,0,9,6,6,7,
-31,4,6,1,19,4,5,4,15,3,4,0,18,0,0,18,
-30,7,4,125,9,9,101,108,115,101,58,32,114,32,61,32,
-115,101,108,102,46,95,100,111,95,110,111,110,101,40,41,0,
-12,6,0,8,95,100,111,95,110,111,110,101,0,0,0,0,
-9,5,1,6,31,4,0,0,19,4,5,4,15,3,4,0,
-18,0,0,1,30,7,4,126,9,9,115,101,108,102,46,100,
-111,95,99,111,100,101,40,79,80,95,82,69,84,85,82,78,
-44,114,41,0,12,6,0,7,100,111,95,99,111,100,101,0,
-9,5,1,6,12,8,0,9,79,80,95,82,69,84,85,82,
-78,0,0,0,13,6,8,0,15,7,3,0,31,4,6,2,
-19,4,5,4,30,5,4,127,9,9,115,101,108,102,46,102,
-114,101,101,95,116,109,112,40,114,41,0,0,12,6,0,8,
-102,114,101,101,95,116,109,112,0,0,0,0,9,5,1,6,
-15,6,3,0,31,4,6,1,19,4,5,4,30,3,4,128,
+18,0,0,15,12,8,0,2,100,111,0,0,49,5,1,8,
+12,8,0,5,105,116,101,109,115,0,0,0,9,7,2,8,
+11,8,0,1,0,0,0,0,0,0,0,0,9,7,7,8,
+50,4,5,1,15,3,4,0,18,0,0,17,30,7,4,152,
+9,9,101,108,115,101,58,32,114,32,61,32,115,101,108,102,
+46,95,100,111,95,110,111,110,101,40,41,0,12,7,0,8,
+95,100,111,95,110,111,110,101,0,0,0,0,49,5,1,7,
+50,4,5,0,15,3,4,0,18,0,0,1,30,7,4,153,
+9,9,115,101,108,102,46,100,111,95,99,111,100,101,40,79,
+80,95,82,69,84,85,82,78,44,114,41,0,12,9,0,7,
+100,111,95,99,111,100,101,0,49,5,1,9,12,9,0,9,
+79,80,95,82,69,84,85,82,78,0,0,0,13,7,9,0,
+15,8,3,0,50,4,5,2,30,5,4,154,9,9,115,101,
+108,102,46,102,114,101,101,95,116,109,112,40,114,41,0,0,
+12,8,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
+49,5,1,8,15,7,3,0,50,4,5,1,30,3,4,155,
 9,9,114,101,116,117,114,110,0,0,0,0,28,4,0,0,
-20,4,0,0,0,0,0,0,12,94,0,9,100,111,95,114,
-101,116,117,114,110,0,0,0,10,7,94,93,16,94,0,113,
-44,9,0,0,30,6,4,131,9,100,101,102,32,100,111,95,
+20,4,0,0,0,0,0,0,12,96,0,9,100,111,95,114,
+101,116,117,114,110,0,0,0,10,8,96,95,16,96,0,109,
+44,10,0,0,30,6,4,158,9,100,101,102,32,100,111,95,
 114,97,105,115,101,40,115,101,108,102,44,116,41,58,0,0,
 12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
 33,1,0,0,12,1,0,8,100,111,95,114,97,105,115,101,
 0,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,3,0,0,9,2,0,3,30,10,4,132,9,9,105,102,
+28,3,0,0,9,2,0,3,30,10,4,159,9,9,105,102,
 32,116,46,105,116,101,109,115,58,32,114,32,61,32,115,101,
 108,102,46,100,111,40,116,46,105,116,101,109,115,91,48,93,
 41,0,0,0,12,4,0,5,105,116,101,109,115,0,0,0,
-9,3,2,4,21,3,0,0,18,0,0,16,12,6,0,2,
-100,111,0,0,9,5,1,6,12,7,0,5,105,116,101,109,
-115,0,0,0,9,6,2,7,11,7,0,0,0,0,0,0,
-0,0,0,0,9,6,6,7,31,4,6,1,19,4,5,4,
-15,3,4,0,18,0,0,18,30,7,4,133,9,9,101,108,
-115,101,58,32,114,32,61,32,115,101,108,102,46,95,100,111,
-95,110,111,110,101,40,41,0,12,6,0,8,95,100,111,95,
-110,111,110,101,0,0,0,0,9,5,1,6,31,4,0,0,
-19,4,5,4,15,3,4,0,18,0,0,1,30,7,4,134,
-9,9,115,101,108,102,46,100,111,95,99,111,100,101,40,79,
-80,95,82,65,73,83,69,44,114,41,0,0,12,6,0,7,
-100,111,95,99,111,100,101,0,9,5,1,6,12,8,0,8,
-79,80,95,82,65,73,83,69,0,0,0,0,13,6,8,0,
-15,7,3,0,31,4,6,2,19,4,5,4,30,5,4,135,
-9,9,115,101,108,102,46,102,114,101,101,95,116,109,112,40,
-114,41,0,0,12,6,0,8,102,114,101,101,95,116,109,112,
-0,0,0,0,9,5,1,6,15,6,3,0,31,4,6,1,
-19,4,5,4,30,3,4,136,9,9,114,101,116,117,114,110,
+9,3,2,4,21,3,0,0,18,0,0,15,12,8,0,2,
+100,111,0,0,49,5,1,8,12,8,0,5,105,116,101,109,
+115,0,0,0,9,7,2,8,11,8,0,1,0,0,0,0,
+0,0,0,0,9,7,7,8,50,4,5,1,15,3,4,0,
+18,0,0,17,30,7,4,160,9,9,101,108,115,101,58,32,
+114,32,61,32,115,101,108,102,46,95,100,111,95,110,111,110,
+101,40,41,0,12,7,0,8,95,100,111,95,110,111,110,101,
+0,0,0,0,49,5,1,7,50,4,5,0,15,3,4,0,
+18,0,0,1,30,7,4,161,9,9,115,101,108,102,46,100,
+111,95,99,111,100,101,40,79,80,95,82,65,73,83,69,44,
+114,41,0,0,12,9,0,7,100,111,95,99,111,100,101,0,
+49,5,1,9,12,9,0,8,79,80,95,82,65,73,83,69,
+0,0,0,0,13,7,9,0,15,8,3,0,50,4,5,2,
+30,5,4,162,9,9,115,101,108,102,46,102,114,101,101,95,
+116,109,112,40,114,41,0,0,12,8,0,8,102,114,101,101,
+95,116,109,112,0,0,0,0,49,5,1,8,15,7,3,0,
+50,4,5,1,30,3,4,163,9,9,114,101,116,117,114,110,
 0,0,0,0,28,4,0,0,20,4,0,0,0,0,0,0,
-12,95,0,8,100,111,95,114,97,105,115,101,0,0,0,0,
-10,7,95,94,16,95,0,62,44,11,0,0,30,7,4,139,
+12,97,0,8,100,111,95,114,97,105,115,101,0,0,0,0,
+10,8,97,96,16,97,0,60,44,14,0,0,30,7,4,166,
 9,100,101,102,32,100,111,95,115,116,97,116,101,109,101,110,
 116,115,40,115,101,108,102,44,116,41,58,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
 12,1,0,13,100,111,95,115,116,97,116,101,109,101,110,116,
 115,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,3,0,0,9,2,0,3,30,12,4,140,9,9,102,111,
+28,3,0,0,9,2,0,3,30,12,4,167,9,9,102,111,
 114,32,116,116,32,105,110,32,116,46,105,116,101,109,115,58,
 32,115,101,108,102,46,102,114,101,101,95,116,109,112,40,115,
 101,108,102,46,100,111,40,116,116,41,41,0,12,5,0,5,
-105,116,101,109,115,0,0,0,9,4,2,5,11,5,0,0,
-0,0,0,0,0,0,0,0,42,3,4,5,18,0,0,15,
-12,8,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
-9,7,1,8,12,10,0,2,100,111,0,0,9,9,1,10,
-15,10,3,0,31,8,10,1,19,8,9,8,31,6,8,1,
-19,6,7,6,18,0,255,241,0,0,0,0,12,96,0,13,
-100,111,95,115,116,97,116,101,109,101,110,116,115,0,0,0,
-10,7,96,95,16,96,0,75,44,10,0,0,30,8,4,143,
-9,100,101,102,32,100,111,95,108,105,115,116,40,115,101,108,
-102,44,116,44,114,61,78,111,110,101,41,58,0,0,0,0,
-12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
-33,1,0,0,12,1,0,7,100,111,95,108,105,115,116,0,
-34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,28,3,0,0,28,4,0,0,32,3,0,4,
-30,6,4,144,9,9,114,32,61,32,115,101,108,102,46,103,
-101,116,95,116,109,112,40,114,41,0,0,0,12,6,0,7,
-103,101,116,95,116,109,112,0,9,5,1,6,15,6,3,0,
-31,4,6,1,19,4,5,4,15,3,4,0,30,10,4,145,
-9,9,115,101,108,102,46,109,97,110,97,103,101,95,115,101,
-113,40,79,80,95,76,73,83,84,44,114,44,116,46,105,116,
-101,109,115,41,0,0,0,0,12,6,0,10,109,97,110,97,
-103,101,95,115,101,113,0,0,9,5,1,6,12,9,0,7,
-79,80,95,76,73,83,84,0,13,6,9,0,15,7,3,0,
-12,9,0,5,105,116,101,109,115,0,0,0,9,8,2,9,
-31,4,6,3,19,4,5,4,30,3,4,146,9,9,114,101,
+105,116,101,109,115,0,0,0,9,4,2,5,11,5,0,1,
+0,0,0,0,0,0,0,0,42,3,4,5,18,0,0,13,
+12,10,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
+49,7,1,10,12,13,0,2,100,111,0,0,49,10,1,13,
+15,12,3,0,50,9,10,1,50,6,7,1,18,0,255,243,
+0,0,0,0,12,98,0,13,100,111,95,115,116,97,116,101,
+109,101,110,116,115,0,0,0,10,8,98,97,16,98,0,73,
+44,11,0,0,30,8,4,170,9,100,101,102,32,100,111,95,
+108,105,115,116,40,115,101,108,102,44,116,44,114,61,78,111,
+110,101,41,58,0,0,0,0,12,1,0,9,116,105,110,121,
+112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,7,
+100,111,95,108,105,115,116,0,34,1,0,0,28,2,0,0,
+9,1,0,2,28,3,0,0,9,2,0,3,28,3,0,0,
+28,4,0,0,32,3,0,4,30,6,4,171,9,9,114,32,
+61,32,115,101,108,102,46,103,101,116,95,116,109,112,40,114,
+41,0,0,0,12,8,0,7,103,101,116,95,116,109,112,0,
+49,5,1,8,15,7,3,0,50,4,5,1,15,3,4,0,
+30,10,4,172,9,9,115,101,108,102,46,109,97,110,97,103,
+101,95,115,101,113,40,79,80,95,76,73,83,84,44,114,44,
+116,46,105,116,101,109,115,41,0,0,0,0,12,10,0,10,
+109,97,110,97,103,101,95,115,101,113,0,0,49,5,1,10,
+12,10,0,7,79,80,95,76,73,83,84,0,13,7,10,0,
+15,8,3,0,12,10,0,5,105,116,101,109,115,0,0,0,
+9,9,2,10,50,4,5,3,30,3,4,173,9,9,114,101,
 116,117,114,110,32,114,0,0,20,3,0,0,0,0,0,0,
-12,97,0,7,100,111,95,108,105,115,116,0,10,7,97,96,
-16,97,0,75,44,10,0,0,30,8,4,149,9,100,101,102,
+12,99,0,7,100,111,95,108,105,115,116,0,10,8,99,98,
+16,99,0,73,44,11,0,0,30,8,4,176,9,100,101,102,
 32,100,111,95,100,105,99,116,40,115,101,108,102,44,116,44,
 114,61,78,111,110,101,41,58,0,0,0,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
 12,1,0,7,100,111,95,100,105,99,116,0,34,1,0,0,
 28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-28,3,0,0,28,4,0,0,32,3,0,4,30,6,4,150,
+28,3,0,0,28,4,0,0,32,3,0,4,30,6,4,177,
 9,9,114,32,61,32,115,101,108,102,46,103,101,116,95,116,
-109,112,40,114,41,0,0,0,12,6,0,7,103,101,116,95,
-116,109,112,0,9,5,1,6,15,6,3,0,31,4,6,1,
-19,4,5,4,15,3,4,0,30,10,4,151,9,9,115,101,
-108,102,46,109,97,110,97,103,101,95,115,101,113,40,79,80,
-95,68,73,67,84,44,114,44,116,46,105,116,101,109,115,41,
-0,0,0,0,12,6,0,10,109,97,110,97,103,101,95,115,
-101,113,0,0,9,5,1,6,12,9,0,7,79,80,95,68,
-73,67,84,0,13,6,9,0,15,7,3,0,12,9,0,5,
-105,116,101,109,115,0,0,0,9,8,2,9,31,4,6,3,
-19,4,5,4,30,3,4,152,9,9,114,101,116,117,114,110,
-32,114,0,0,20,3,0,0,0,0,0,0,12,98,0,7,
-100,111,95,100,105,99,116,0,10,7,98,97,16,98,0,71,
-44,12,0,0,30,7,4,155,9,100,101,102,32,100,111,95,
-103,101,116,40,115,101,108,102,44,116,44,114,61,78,111,110,
-101,41,58,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,6,100,111,95,103,
-101,116,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,3,0,0,9,2,0,3,28,3,0,0,28,4,0,0,
-32,3,0,4,30,5,4,156,9,9,105,116,101,109,115,32,
-61,32,116,46,105,116,101,109,115,0,0,0,12,6,0,5,
-105,116,101,109,115,0,0,0,9,5,2,6,15,4,5,0,
-30,12,4,157,9,9,114,101,116,117,114,110,32,115,101,108,
-102,46,105,110,102,105,120,40,79,80,95,71,69,84,44,105,
-116,101,109,115,91,48,93,44,105,116,101,109,115,91,49,93,
-44,114,41,0,12,7,0,5,105,110,102,105,120,0,0,0,
-9,6,1,7,12,11,0,6,79,80,95,71,69,84,0,0,
-13,7,11,0,11,11,0,0,0,0,0,0,0,0,0,0,
-9,8,4,11,11,11,0,0,0,0,0,0,0,0,240,63,
-9,9,4,11,15,10,3,0,31,5,7,4,19,5,6,5,
-20,5,0,0,0,0,0,0,12,99,0,6,100,111,95,103,
-101,116,0,0,10,7,99,98,16,99,0,54,44,8,0,0,
-30,6,4,160,9,100,101,102,32,100,111,95,98,114,101,97,
-107,40,115,101,108,102,44,116,41,58,32,0,12,1,0,9,
+109,112,40,114,41,0,0,0,12,8,0,7,103,101,116,95,
+116,109,112,0,49,5,1,8,15,7,3,0,50,4,5,1,
+15,3,4,0,30,10,4,178,9,9,115,101,108,102,46,109,
+97,110,97,103,101,95,115,101,113,40,79,80,95,68,73,67,
+84,44,114,44,116,46,105,116,101,109,115,41,0,0,0,0,
+12,10,0,10,109,97,110,97,103,101,95,115,101,113,0,0,
+49,5,1,10,12,10,0,7,79,80,95,68,73,67,84,0,
+13,7,10,0,15,8,3,0,12,10,0,5,105,116,101,109,
+115,0,0,0,9,9,2,10,50,4,5,3,30,3,4,179,
+9,9,114,101,116,117,114,110,32,114,0,0,20,3,0,0,
+0,0,0,0,12,100,0,7,100,111,95,100,105,99,116,0,
+10,8,100,99,16,100,0,70,44,13,0,0,30,7,4,182,
+9,100,101,102,32,100,111,95,103,101,116,40,115,101,108,102,
+44,116,44,114,61,78,111,110,101,41,58,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,8,100,111,95,98,114,101,97,107,0,0,0,0,
-34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,30,9,4,161,9,9,115,101,108,102,46,106,
-117,109,112,40,68,46,116,115,116,97,99,107,91,45,49,93,
-44,39,98,114,101,97,107,39,41,0,0,0,12,5,0,4,
-106,117,109,112,0,0,0,0,9,4,1,5,12,7,0,1,
-68,0,0,0,13,5,7,0,12,7,0,6,116,115,116,97,
-99,107,0,0,9,5,5,7,11,7,0,0,0,0,0,0,
-0,0,240,191,9,5,5,7,12,6,0,5,98,114,101,97,
-107,0,0,0,31,3,5,2,19,3,4,3,0,0,0,0,
-12,100,0,8,100,111,95,98,114,101,97,107,0,0,0,0,
-10,7,100,99,16,100,0,57,44,8,0,0,30,7,4,164,
+12,1,0,6,100,111,95,103,101,116,0,0,34,1,0,0,
+28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
+28,3,0,0,28,4,0,0,32,3,0,4,30,5,4,183,
+9,9,105,116,101,109,115,32,61,32,116,46,105,116,101,109,
+115,0,0,0,12,6,0,5,105,116,101,109,115,0,0,0,
+9,5,2,6,15,4,5,0,30,12,4,184,9,9,114,101,
+116,117,114,110,32,115,101,108,102,46,105,110,102,105,120,40,
+79,80,95,71,69,84,44,105,116,101,109,115,91,48,93,44,
+105,116,101,109,115,91,49,93,44,114,41,0,12,12,0,5,
+105,110,102,105,120,0,0,0,49,6,1,12,12,12,0,6,
+79,80,95,71,69,84,0,0,13,8,12,0,11,12,0,1,
+0,0,0,0,0,0,0,0,9,9,4,12,11,12,0,1,
+1,0,0,0,0,0,0,0,9,10,4,12,15,11,3,0,
+50,5,6,4,20,5,0,0,0,0,0,0,12,101,0,6,
+100,111,95,103,101,116,0,0,10,8,101,100,16,101,0,53,
+44,9,0,0,30,6,4,187,9,100,101,102,32,100,111,95,
+98,114,101,97,107,40,115,101,108,102,44,116,41,58,32,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,8,100,111,95,98,114,101,97,107,
+0,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
+28,3,0,0,9,2,0,3,30,9,4,188,9,9,115,101,
+108,102,46,106,117,109,112,40,68,46,116,115,116,97,99,107,
+91,45,49,93,44,39,98,114,101,97,107,39,41,0,0,0,
+12,8,0,4,106,117,109,112,0,0,0,0,49,4,1,8,
+12,8,0,1,68,0,0,0,13,6,8,0,12,8,0,6,
+116,115,116,97,99,107,0,0,9,6,6,8,11,8,0,0,
+0,0,0,0,0,0,240,191,9,6,6,8,12,7,0,5,
+98,114,101,97,107,0,0,0,50,3,4,2,0,0,0,0,
+12,102,0,8,100,111,95,98,114,101,97,107,0,0,0,0,
+10,8,102,101,16,102,0,56,44,9,0,0,30,7,4,191,
 9,100,101,102,32,100,111,95,99,111,110,116,105,110,117,101,
 40,115,101,108,102,44,116,41,58,32,0,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
 12,1,0,11,100,111,95,99,111,110,116,105,110,117,101,0,
 34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,30,10,4,165,9,9,115,101,108,102,46,106,
+9,2,0,3,30,10,4,192,9,9,115,101,108,102,46,106,
 117,109,112,40,68,46,116,115,116,97,99,107,91,45,49,93,
 44,39,99,111,110,116,105,110,117,101,39,41,0,0,0,0,
-12,5,0,4,106,117,109,112,0,0,0,0,9,4,1,5,
-12,7,0,1,68,0,0,0,13,5,7,0,12,7,0,6,
-116,115,116,97,99,107,0,0,9,5,5,7,11,7,0,0,
-0,0,0,0,0,0,240,191,9,5,5,7,12,6,0,8,
-99,111,110,116,105,110,117,101,0,0,0,0,31,3,5,2,
-19,3,4,3,0,0,0,0,12,101,0,11,100,111,95,99,
-111,110,116,105,110,117,101,0,10,7,101,100,16,101,0,40,
-44,7,0,0,30,6,4,168,9,100,101,102,32,100,111,95,
-112,97,115,115,40,115,101,108,102,44,116,41,58,32,0,0,
+12,8,0,4,106,117,109,112,0,0,0,0,49,4,1,8,
+12,8,0,1,68,0,0,0,13,6,8,0,12,8,0,6,
+116,115,116,97,99,107,0,0,9,6,6,8,11,8,0,0,
+0,0,0,0,0,0,240,191,9,6,6,8,12,7,0,8,
+99,111,110,116,105,110,117,101,0,0,0,0,50,3,4,2,
+0,0,0,0,12,103,0,11,100,111,95,99,111,110,116,105,
+110,117,101,0,10,8,103,102,16,103,0,39,44,8,0,0,
+30,6,4,195,9,100,101,102,32,100,111,95,112,97,115,115,
+40,115,101,108,102,44,116,41,58,32,0,0,12,1,0,9,
+116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
+12,1,0,7,100,111,95,112,97,115,115,0,34,1,0,0,
+28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
+30,6,4,196,9,9,115,101,108,102,46,100,111,95,99,111,
+100,101,40,79,80,95,80,65,83,83,41,0,12,7,0,7,
+100,111,95,99,111,100,101,0,49,4,1,7,12,7,0,7,
+79,80,95,80,65,83,83,0,13,6,7,0,50,3,4,1,
+0,0,0,0,12,104,0,7,100,111,95,112,97,115,115,0,
+10,8,104,103,16,104,0,113,44,15,0,0,30,8,4,199,
+9,100,101,102,32,100,111,95,105,110,102,111,40,115,101,108,
+102,44,110,97,109,101,61,39,63,39,41,58,0,0,0,0,
 12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
-33,1,0,0,12,1,0,7,100,111,95,112,97,115,115,0,
-34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,30,6,4,169,9,9,115,101,108,102,46,100,
-111,95,99,111,100,101,40,79,80,95,80,65,83,83,41,0,
-12,5,0,7,100,111,95,99,111,100,101,0,9,4,1,5,
-12,6,0,7,79,80,95,80,65,83,83,0,13,5,6,0,
-31,3,5,1,19,3,4,3,0,0,0,0,12,102,0,7,
-100,111,95,112,97,115,115,0,10,7,102,101,16,102,0,119,
-44,12,0,0,30,8,4,172,9,100,101,102,32,100,111,95,
-105,110,102,111,40,115,101,108,102,44,110,97,109,101,61,39,
-63,39,41,58,0,0,0,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,7,
-100,111,95,105,110,102,111,0,34,1,0,0,28,2,0,0,
-9,1,0,2,12,2,0,1,63,0,0,0,28,3,0,0,
-32,2,0,3,30,17,4,173,9,9,115,101,108,102,46,100,
-111,95,99,111,100,101,40,79,80,95,70,73,76,69,44,115,
-101,108,102,46,102,114,101,101,95,116,109,112,40,115,101,108,
-102,46,95,100,111,95,115,116,114,105,110,103,40,68,46,102,
-105,108,101,110,97,109,101,41,41,41,0,0,12,5,0,7,
-100,111,95,99,111,100,101,0,9,4,1,5,12,7,0,7,
-79,80,95,70,73,76,69,0,13,5,7,0,12,8,0,8,
-102,114,101,101,95,116,109,112,0,0,0,0,9,7,1,8,
-12,10,0,10,95,100,111,95,115,116,114,105,110,103,0,0,
-9,9,1,10,12,11,0,1,68,0,0,0,13,10,11,0,
-12,11,0,8,102,105,108,101,110,97,109,101,0,0,0,0,
-9,10,10,11,31,8,10,1,19,8,9,8,31,6,8,1,
-19,6,7,6,31,3,5,2,19,3,4,3,30,16,4,174,
+33,1,0,0,12,1,0,7,100,111,95,105,110,102,111,0,
+34,1,0,0,28,2,0,0,9,1,0,2,12,2,0,1,
+63,0,0,0,28,3,0,0,32,2,0,3,30,17,4,200,
 9,9,115,101,108,102,46,100,111,95,99,111,100,101,40,79,
-80,95,78,65,77,69,44,115,101,108,102,46,102,114,101,101,
+80,95,70,73,76,69,44,115,101,108,102,46,102,114,101,101,
 95,116,109,112,40,115,101,108,102,46,95,100,111,95,115,116,
-114,105,110,103,40,110,97,109,101,41,41,41,0,0,0,0,
-12,5,0,7,100,111,95,99,111,100,101,0,9,4,1,5,
-12,7,0,7,79,80,95,78,65,77,69,0,13,5,7,0,
-12,8,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
-9,7,1,8,12,10,0,10,95,100,111,95,115,116,114,105,
-110,103,0,0,9,9,1,10,15,10,2,0,31,8,10,1,
-19,8,9,8,31,6,8,1,19,6,7,6,31,3,5,2,
-19,3,4,3,0,0,0,0,12,103,0,7,100,111,95,105,
-110,102,111,0,10,7,103,102,16,103,0,68,44,9,0,0,
-30,6,4,177,9,100,101,102,32,100,111,95,109,111,100,117,
+114,105,110,103,40,68,46,102,105,108,101,110,97,109,101,41,
+41,41,0,0,12,8,0,7,100,111,95,99,111,100,101,0,
+49,4,1,8,12,8,0,7,79,80,95,70,73,76,69,0,
+13,6,8,0,12,11,0,8,102,114,101,101,95,116,109,112,
+0,0,0,0,49,8,1,11,12,14,0,10,95,100,111,95,
+115,116,114,105,110,103,0,0,49,11,1,14,12,14,0,1,
+68,0,0,0,13,13,14,0,12,14,0,8,102,105,108,101,
+110,97,109,101,0,0,0,0,9,13,13,14,50,10,11,1,
+50,7,8,1,50,3,4,2,30,16,4,201,9,9,115,101,
+108,102,46,100,111,95,99,111,100,101,40,79,80,95,78,65,
+77,69,44,115,101,108,102,46,102,114,101,101,95,116,109,112,
+40,115,101,108,102,46,95,100,111,95,115,116,114,105,110,103,
+40,110,97,109,101,41,41,41,0,0,0,0,12,8,0,7,
+100,111,95,99,111,100,101,0,49,4,1,8,12,8,0,7,
+79,80,95,78,65,77,69,0,13,6,8,0,12,11,0,8,
+102,114,101,101,95,116,109,112,0,0,0,0,49,8,1,11,
+12,14,0,10,95,100,111,95,115,116,114,105,110,103,0,0,
+49,11,1,14,15,13,2,0,50,10,11,1,50,7,8,1,
+50,3,4,2,0,0,0,0,12,105,0,7,100,111,95,105,
+110,102,111,0,10,8,105,104,16,105,0,65,44,11,0,0,
+30,6,4,204,9,100,101,102,32,100,111,95,109,111,100,117,
 108,101,40,115,101,108,102,44,116,41,58,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
 12,1,0,9,100,111,95,109,111,100,117,108,101,0,0,0,
 34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,30,5,4,178,9,9,115,101,108,102,46,100,
-111,95,105,110,102,111,40,41,0,0,0,0,12,5,0,7,
-100,111,95,105,110,102,111,0,9,4,1,5,31,3,0,0,
-19,3,4,3,30,11,4,179,9,9,115,101,108,102,46,102,
-114,101,101,95,116,109,112,40,115,101,108,102,46,100,111,40,
-116,46,105,116,101,109,115,91,48,93,41,41,32,35,82,69,
-71,0,0,0,12,5,0,8,102,114,101,101,95,116,109,112,
-0,0,0,0,9,4,1,5,12,7,0,2,100,111,0,0,
-9,6,1,7,12,8,0,5,105,116,101,109,115,0,0,0,
-9,7,2,8,11,8,0,0,0,0,0,0,0,0,0,0,
-9,7,7,8,31,5,7,1,19,5,6,5,31,3,5,1,
-19,3,4,3,0,0,0,0,12,104,0,9,100,111,95,109,
-111,100,117,108,101,0,0,0,10,7,104,103,16,104,0,37,
-44,6,0,0,30,8,4,182,9,100,101,102,32,100,111,95,
-114,101,103,40,115,101,108,102,44,116,44,114,61,78,111,110,
-101,41,58,32,0,0,0,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,6,
-100,111,95,114,101,103,0,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,28,3,0,0,
-28,4,0,0,32,3,0,4,30,4,4,183,9,9,114,101,
-116,117,114,110,32,116,46,118,97,108,0,0,12,5,0,3,
-118,97,108,0,9,4,2,5,20,4,0,0,0,0,0,0,
-12,105,0,6,100,111,95,114,101,103,0,0,10,7,105,104,
-16,105,0,225,44,13,0,0,30,11,4,187,9,100,101,102,
-32,108,111,103,105,99,95,105,110,102,105,120,40,115,101,108,
-102,44,111,112,44,32,116,98,44,32,116,99,44,32,95,114,
-61,78,111,110,101,41,58,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,11,
-108,111,103,105,99,95,105,110,102,105,120,0,34,1,0,0,
+9,2,0,3,30,5,4,205,9,9,115,101,108,102,46,100,
+111,95,105,110,102,111,40,41,0,0,0,0,12,6,0,7,
+100,111,95,105,110,102,111,0,49,4,1,6,50,3,4,0,
+30,11,4,206,9,9,115,101,108,102,46,102,114,101,101,95,
+116,109,112,40,115,101,108,102,46,100,111,40,116,46,105,116,
+101,109,115,91,48,93,41,41,32,35,82,69,71,0,0,0,
+12,7,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
+49,4,1,7,12,10,0,2,100,111,0,0,49,7,1,10,
+12,10,0,5,105,116,101,109,115,0,0,0,9,9,2,10,
+11,10,0,1,0,0,0,0,0,0,0,0,9,9,9,10,
+50,6,7,1,50,3,4,1,0,0,0,0,12,106,0,9,
+100,111,95,109,111,100,117,108,101,0,0,0,10,8,106,105,
+16,106,0,37,44,6,0,0,30,8,4,209,9,100,101,102,
+32,100,111,95,114,101,103,40,115,101,108,102,44,116,44,114,
+61,78,111,110,101,41,58,32,0,0,0,0,12,1,0,9,
+116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
+12,1,0,6,100,111,95,114,101,103,0,0,34,1,0,0,
 28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-28,4,0,0,9,3,0,4,28,5,0,0,9,4,0,5,
-28,5,0,0,28,6,0,0,32,5,0,6,30,6,4,188,
-9,9,116,32,61,32,115,101,108,102,46,103,101,116,95,116,
-97,103,40,41,32,0,0,0,12,9,0,7,103,101,116,95,
-116,97,103,0,9,8,1,9,31,7,0,0,19,7,8,7,
-15,6,7,0,30,6,4,189,9,9,114,32,61,32,115,101,
+28,3,0,0,28,4,0,0,32,3,0,4,30,4,4,210,
+9,9,114,101,116,117,114,110,32,116,46,118,97,108,0,0,
+12,5,0,3,118,97,108,0,9,4,2,5,20,4,0,0,
+0,0,0,0,12,107,0,6,100,111,95,114,101,103,0,0,
+10,8,107,106,16,107,0,216,44,14,0,0,30,11,4,214,
+9,100,101,102,32,108,111,103,105,99,95,105,110,102,105,120,
+40,115,101,108,102,44,111,112,44,32,116,98,44,32,116,99,
+44,32,95,114,61,78,111,110,101,41,58,0,12,1,0,9,
+116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
+12,1,0,11,108,111,103,105,99,95,105,110,102,105,120,0,
+34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
+9,2,0,3,28,4,0,0,9,3,0,4,28,5,0,0,
+9,4,0,5,28,5,0,0,28,6,0,0,32,5,0,6,
+30,6,4,215,9,9,116,32,61,32,115,101,108,102,46,103,
+101,116,95,116,97,103,40,41,32,0,0,0,12,10,0,7,
+103,101,116,95,116,97,103,0,49,8,1,10,50,7,8,0,
+15,6,7,0,30,6,4,216,9,9,114,32,61,32,115,101,
 108,102,46,100,111,40,116,98,44,32,95,114,41,0,0,0,
-12,10,0,2,100,111,0,0,9,9,1,10,15,10,3,0,
-15,11,5,0,31,8,10,2,19,8,9,8,15,7,8,0,
-30,10,4,190,9,9,105,102,32,95,114,32,33,61,32,114,
-58,32,115,101,108,102,46,102,114,101,101,95,116,109,112,40,
-95,114,41,32,35,82,69,71,0,0,0,0,35,8,5,7,
-21,8,0,0,18,0,0,10,12,10,0,8,102,114,101,101,
-95,116,109,112,0,0,0,0,9,9,1,10,15,10,5,0,
-31,8,10,1,19,8,9,8,18,0,0,1,30,11,4,191,
-9,9,105,102,32,111,112,32,61,61,32,39,97,110,100,39,
-58,32,32,32,115,101,108,102,46,100,111,95,99,111,100,101,
-40,79,80,95,73,70,44,32,114,41,0,0,12,9,0,3,
-97,110,100,0,23,8,2,9,21,8,0,0,18,0,0,13,
-12,10,0,7,100,111,95,99,111,100,101,0,9,9,1,10,
-12,12,0,5,79,80,95,73,70,0,0,0,13,10,12,0,
-15,11,7,0,31,8,10,2,19,8,9,8,18,0,0,30,
-30,11,4,192,9,9,101,108,105,102,32,111,112,32,61,61,
-32,39,111,114,39,58,32,32,115,101,108,102,46,100,111,95,
-99,111,100,101,40,79,80,95,73,70,78,44,32,114,41,0,
-12,9,0,2,111,114,0,0,23,8,2,9,21,8,0,0,
-18,0,0,13,12,10,0,7,100,111,95,99,111,100,101,0,
-9,9,1,10,12,12,0,6,79,80,95,73,70,78,0,0,
-13,10,12,0,15,11,7,0,31,8,10,2,19,8,9,8,
-18,0,0,1,30,6,4,193,9,9,115,101,108,102,46,106,
+12,13,0,2,100,111,0,0,49,9,1,13,15,11,3,0,
+15,12,5,0,50,8,9,2,15,7,8,0,30,10,4,217,
+9,9,105,102,32,95,114,32,33,61,32,114,58,32,115,101,
+108,102,46,102,114,101,101,95,116,109,112,40,95,114,41,32,
+35,82,69,71,0,0,0,0,35,8,5,7,21,8,0,0,
+18,0,0,9,12,12,0,8,102,114,101,101,95,116,109,112,
+0,0,0,0,49,9,1,12,15,11,5,0,50,8,9,1,
+18,0,0,1,30,11,4,218,9,9,105,102,32,111,112,32,
+61,61,32,39,97,110,100,39,58,32,32,32,115,101,108,102,
+46,100,111,95,99,111,100,101,40,79,80,95,73,70,44,32,
+114,41,0,0,12,9,0,3,97,110,100,0,23,8,2,9,
+21,8,0,0,18,0,0,12,12,13,0,7,100,111,95,99,
+111,100,101,0,49,9,1,13,12,13,0,5,79,80,95,73,
+70,0,0,0,13,11,13,0,15,12,7,0,50,8,9,2,
+18,0,0,29,30,11,4,219,9,9,101,108,105,102,32,111,
+112,32,61,61,32,39,111,114,39,58,32,32,115,101,108,102,
+46,100,111,95,99,111,100,101,40,79,80,95,73,70,78,44,
+32,114,41,0,12,9,0,2,111,114,0,0,23,8,2,9,
+21,8,0,0,18,0,0,12,12,13,0,7,100,111,95,99,
+111,100,101,0,49,9,1,13,12,13,0,6,79,80,95,73,
+70,78,0,0,13,11,13,0,15,12,7,0,50,8,9,2,
+18,0,0,1,30,6,4,220,9,9,115,101,108,102,46,106,
 117,109,112,40,116,44,32,39,101,110,100,39,41,0,0,0,
-12,10,0,4,106,117,109,112,0,0,0,0,9,9,1,10,
-15,10,6,0,12,11,0,3,101,110,100,0,31,8,10,2,
-19,8,9,8,30,3,4,194,9,9,95,114,32,61,32,114,
-0,0,0,0,15,5,7,0,30,6,4,195,9,9,114,32,
-61,32,115,101,108,102,46,100,111,40,116,99,44,32,95,114,
-41,0,0,0,12,10,0,2,100,111,0,0,9,9,1,10,
-15,10,4,0,15,11,5,0,31,8,10,2,19,8,9,8,
-15,7,8,0,30,10,4,196,9,9,105,102,32,95,114,32,
-33,61,32,114,58,32,115,101,108,102,46,102,114,101,101,95,
-116,109,112,40,95,114,41,32,35,82,69,71,0,0,0,0,
-35,8,5,7,21,8,0,0,18,0,0,10,12,10,0,8,
-102,114,101,101,95,116,109,112,0,0,0,0,9,9,1,10,
-15,10,5,0,31,8,10,1,19,8,9,8,18,0,0,1,
-30,6,4,197,9,9,115,101,108,102,46,116,97,103,40,116,
-44,32,39,101,110,100,39,41,0,0,0,0,12,10,0,3,
-116,97,103,0,9,9,1,10,15,10,6,0,12,11,0,3,
-101,110,100,0,31,8,10,2,19,8,9,8,30,3,4,198,
+12,13,0,4,106,117,109,112,0,0,0,0,49,9,1,13,
+15,11,6,0,12,12,0,3,101,110,100,0,50,8,9,2,
+30,3,4,221,9,9,95,114,32,61,32,114,0,0,0,0,
+15,5,7,0,30,6,4,222,9,9,114,32,61,32,115,101,
+108,102,46,100,111,40,116,99,44,32,95,114,41,0,0,0,
+12,13,0,2,100,111,0,0,49,9,1,13,15,11,4,0,
+15,12,5,0,50,8,9,2,15,7,8,0,30,10,4,223,
+9,9,105,102,32,95,114,32,33,61,32,114,58,32,115,101,
+108,102,46,102,114,101,101,95,116,109,112,40,95,114,41,32,
+35,82,69,71,0,0,0,0,35,8,5,7,21,8,0,0,
+18,0,0,9,12,12,0,8,102,114,101,101,95,116,109,112,
+0,0,0,0,49,9,1,12,15,11,5,0,50,8,9,1,
+18,0,0,1,30,6,4,224,9,9,115,101,108,102,46,116,
+97,103,40,116,44,32,39,101,110,100,39,41,0,0,0,0,
+12,13,0,3,116,97,103,0,49,9,1,13,15,11,6,0,
+12,12,0,3,101,110,100,0,50,8,9,2,30,3,4,225,
 9,9,114,101,116,117,114,110,32,114,0,0,20,7,0,0,
-0,0,0,0,12,106,0,11,108,111,103,105,99,95,105,110,
-102,105,120,0,10,7,106,105,16,106,0,65,44,8,0,0,
-30,7,4,201,9,100,101,102,32,95,100,111,95,110,111,110,
+0,0,0,0,12,108,0,11,108,111,103,105,99,95,105,110,
+102,105,120,0,10,8,108,107,16,108,0,63,44,9,0,0,
+30,7,4,228,9,100,101,102,32,95,100,111,95,110,111,110,
 101,40,115,101,108,102,44,114,61,78,111,110,101,41,58,0,
 12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
 33,1,0,0,12,1,0,8,95,100,111,95,110,111,110,101,
 0,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,2,0,0,28,3,0,0,32,2,0,3,30,6,4,202,
+28,2,0,0,28,3,0,0,32,2,0,3,30,6,4,229,
 9,9,114,32,61,32,115,101,108,102,46,103,101,116,95,116,
-109,112,40,114,41,0,0,0,12,5,0,7,103,101,116,95,
-116,109,112,0,9,4,1,5,15,5,2,0,31,3,5,1,
-19,3,4,3,15,2,3,0,30,7,4,203,9,9,115,101,
-108,102,46,100,111,95,99,111,100,101,40,79,80,95,78,79,
-78,69,44,114,41,0,0,0,12,5,0,7,100,111,95,99,
-111,100,101,0,9,4,1,5,12,7,0,7,79,80,95,78,
-79,78,69,0,13,5,7,0,15,6,2,0,31,3,5,2,
-19,3,4,3,30,3,4,204,9,9,114,101,116,117,114,110,
-32,114,0,0,20,2,0,0,0,0,0,0,12,107,0,8,
-95,100,111,95,110,111,110,101,0,0,0,0,10,7,107,106,
-16,107,3,208,44,32,0,0,30,8,4,207,9,100,101,102,
-32,100,111,95,115,121,109,98,111,108,40,115,101,108,102,44,
-116,44,114,61,78,111,110,101,41,58,0,0,12,1,0,9,
-116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,9,100,111,95,115,121,109,98,111,108,0,0,0,
-34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,28,3,0,0,28,4,0,0,32,3,0,4,
-30,4,4,208,9,9,115,101,116,115,32,61,32,91,39,61,
-39,93,0,0,12,6,0,1,61,0,0,0,27,5,6,1,
-15,4,5,0,30,13,4,209,9,9,105,115,101,116,115,32,
-61,32,91,39,43,61,39,44,39,45,61,39,44,39,42,61,
-39,44,39,47,61,39,44,32,39,124,61,39,44,32,39,38,
-61,39,44,32,39,94,61,39,93,0,0,0,12,7,0,2,
-43,61,0,0,12,8,0,2,45,61,0,0,12,9,0,2,
-42,61,0,0,12,10,0,2,47,61,0,0,12,11,0,2,
-124,61,0,0,12,12,0,2,38,61,0,0,12,13,0,2,
-94,61,0,0,27,6,7,7,15,5,6,0,30,10,4,210,
-9,9,99,109,112,115,32,61,32,91,39,60,39,44,39,62,
-39,44,39,60,61,39,44,39,62,61,39,44,39,61,61,39,
-44,39,33,61,39,93,0,0,12,8,0,1,60,0,0,0,
-12,9,0,1,62,0,0,0,12,10,0,2,60,61,0,0,
-12,11,0,2,62,61,0,0,12,12,0,2,61,61,0,0,
-12,13,0,2,33,61,0,0,27,7,8,6,15,6,7,0,
-30,3,4,211,9,9,109,101,116,97,115,32,61,32,123,0,
-30,13,4,212,9,9,9,39,43,39,58,79,80,95,65,68,
-68,44,39,42,39,58,79,80,95,77,85,76,44,39,47,39,
-58,79,80,95,68,73,86,44,39,42,42,39,58,79,80,95,
-80,79,87,44,0,0,0,0,12,9,0,1,43,0,0,0,
-12,31,0,6,79,80,95,65,68,68,0,0,13,10,31,0,
-12,11,0,1,42,0,0,0,12,31,0,6,79,80,95,77,
-85,76,0,0,13,12,31,0,12,13,0,1,47,0,0,0,
-12,31,0,6,79,80,95,68,73,86,0,0,13,14,31,0,
-12,15,0,2,42,42,0,0,12,31,0,6,79,80,95,80,
-79,87,0,0,13,16,31,0,30,4,4,213,9,9,9,39,
-45,39,58,79,80,95,83,85,66,44,0,0,12,17,0,1,
-45,0,0,0,12,31,0,6,79,80,95,83,85,66,0,0,
-13,18,31,0,30,10,4,214,9,9,9,39,37,39,58,79,
-80,95,77,79,68,44,39,62,62,39,58,79,80,95,82,83,
-72,44,39,60,60,39,58,79,80,95,76,83,72,44,0,0,
-12,19,0,1,37,0,0,0,12,31,0,6,79,80,95,77,
-79,68,0,0,13,20,31,0,12,21,0,2,62,62,0,0,
-12,31,0,6,79,80,95,82,83,72,0,0,13,22,31,0,
-12,23,0,2,60,60,0,0,12,31,0,6,79,80,95,76,
-83,72,0,0,13,24,31,0,30,12,4,215,9,9,9,39,
-38,39,58,79,80,95,66,73,84,65,78,68,44,39,124,39,
-58,79,80,95,66,73,84,79,82,44,39,94,39,58,79,80,
-95,66,73,84,88,79,82,44,0,0,0,0,12,25,0,1,
-38,0,0,0,12,31,0,9,79,80,95,66,73,84,65,78,
-68,0,0,0,13,26,31,0,12,27,0,1,124,0,0,0,
-12,31,0,8,79,80,95,66,73,84,79,82,0,0,0,0,
-13,28,31,0,12,29,0,1,94,0,0,0,12,31,0,9,
-79,80,95,66,73,84,88,79,82,0,0,0,13,30,31,0,
-26,8,9,22,15,7,8,0,30,12,4,217,9,9,105,102,
-32,116,46,118,97,108,32,61,61,32,39,78,111,110,101,39,
-58,32,114,101,116,117,114,110,32,115,101,108,102,46,95,100,
-111,95,110,111,110,101,40,114,41,0,0,0,12,9,0,3,
-118,97,108,0,9,8,2,9,12,9,0,4,78,111,110,101,
-0,0,0,0,23,8,8,9,21,8,0,0,18,0,0,11,
-12,10,0,8,95,100,111,95,110,111,110,101,0,0,0,0,
-9,9,1,10,15,10,3,0,31,8,10,1,19,8,9,8,
-20,8,0,0,18,0,0,1,30,6,4,218,9,9,105,102,
-32,116,46,118,97,108,32,61,61,32,39,84,114,117,101,39,
-58,0,0,0,12,9,0,3,118,97,108,0,9,8,2,9,
-12,9,0,4,84,114,117,101,0,0,0,0,23,8,8,9,
-21,8,0,0,18,0,0,23,30,9,4,219,9,9,9,114,
-101,116,117,114,110,32,115,101,108,102,46,95,100,111,95,110,
-117,109,98,101,114,40,39,49,39,44,114,41,0,0,0,0,
-12,10,0,10,95,100,111,95,110,117,109,98,101,114,0,0,
-9,9,1,10,12,10,0,1,49,0,0,0,15,11,3,0,
-31,8,10,2,19,8,9,8,20,8,0,0,18,0,0,1,
-30,6,4,220,9,9,105,102,32,116,46,118,97,108,32,61,
+109,112,40,114,41,0,0,0,12,7,0,7,103,101,116,95,
+116,109,112,0,49,4,1,7,15,6,2,0,50,3,4,1,
+15,2,3,0,30,7,4,230,9,9,115,101,108,102,46,100,
+111,95,99,111,100,101,40,79,80,95,78,79,78,69,44,114,
+41,0,0,0,12,8,0,7,100,111,95,99,111,100,101,0,
+49,4,1,8,12,8,0,7,79,80,95,78,79,78,69,0,
+13,6,8,0,15,7,2,0,50,3,4,2,30,3,4,231,
+9,9,114,101,116,117,114,110,32,114,0,0,20,2,0,0,
+0,0,0,0,12,109,0,8,95,100,111,95,110,111,110,101,
+0,0,0,0,10,8,109,108,16,109,3,192,44,32,0,0,
+30,8,4,234,9,100,101,102,32,100,111,95,115,121,109,98,
+111,108,40,115,101,108,102,44,116,44,114,61,78,111,110,101,
+41,58,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
+121,0,0,0,33,1,0,0,12,1,0,9,100,111,95,115,
+121,109,98,111,108,0,0,0,34,1,0,0,28,2,0,0,
+9,1,0,2,28,3,0,0,9,2,0,3,28,3,0,0,
+28,4,0,0,32,3,0,4,30,4,4,235,9,9,115,101,
+116,115,32,61,32,91,39,61,39,93,0,0,12,6,0,1,
+61,0,0,0,27,5,6,1,15,4,5,0,30,13,4,236,
+9,9,105,115,101,116,115,32,61,32,91,39,43,61,39,44,
+39,45,61,39,44,39,42,61,39,44,39,47,61,39,44,32,
+39,124,61,39,44,32,39,38,61,39,44,32,39,94,61,39,
+93,0,0,0,12,7,0,2,43,61,0,0,12,8,0,2,
+45,61,0,0,12,9,0,2,42,61,0,0,12,10,0,2,
+47,61,0,0,12,11,0,2,124,61,0,0,12,12,0,2,
+38,61,0,0,12,13,0,2,94,61,0,0,27,6,7,7,
+15,5,6,0,30,10,4,237,9,9,99,109,112,115,32,61,
+32,91,39,60,39,44,39,62,39,44,39,60,61,39,44,39,
+62,61,39,44,39,61,61,39,44,39,33,61,39,93,0,0,
+12,8,0,1,60,0,0,0,12,9,0,1,62,0,0,0,
+12,10,0,2,60,61,0,0,12,11,0,2,62,61,0,0,
+12,12,0,2,61,61,0,0,12,13,0,2,33,61,0,0,
+27,7,8,6,15,6,7,0,30,3,4,238,9,9,109,101,
+116,97,115,32,61,32,123,0,30,13,4,239,9,9,9,39,
+43,39,58,79,80,95,65,68,68,44,39,42,39,58,79,80,
+95,77,85,76,44,39,47,39,58,79,80,95,68,73,86,44,
+39,42,42,39,58,79,80,95,80,79,87,44,0,0,0,0,
+12,9,0,1,43,0,0,0,12,31,0,6,79,80,95,65,
+68,68,0,0,13,10,31,0,12,11,0,1,42,0,0,0,
+12,31,0,6,79,80,95,77,85,76,0,0,13,12,31,0,
+12,13,0,1,47,0,0,0,12,31,0,6,79,80,95,68,
+73,86,0,0,13,14,31,0,12,15,0,2,42,42,0,0,
+12,31,0,6,79,80,95,80,79,87,0,0,13,16,31,0,
+30,4,4,240,9,9,9,39,45,39,58,79,80,95,83,85,
+66,44,0,0,12,17,0,1,45,0,0,0,12,31,0,6,
+79,80,95,83,85,66,0,0,13,18,31,0,30,10,4,241,
+9,9,9,39,37,39,58,79,80,95,77,79,68,44,39,62,
+62,39,58,79,80,95,82,83,72,44,39,60,60,39,58,79,
+80,95,76,83,72,44,0,0,12,19,0,1,37,0,0,0,
+12,31,0,6,79,80,95,77,79,68,0,0,13,20,31,0,
+12,21,0,2,62,62,0,0,12,31,0,6,79,80,95,82,
+83,72,0,0,13,22,31,0,12,23,0,2,60,60,0,0,
+12,31,0,6,79,80,95,76,83,72,0,0,13,24,31,0,
+30,12,4,242,9,9,9,39,38,39,58,79,80,95,66,73,
+84,65,78,68,44,39,124,39,58,79,80,95,66,73,84,79,
+82,44,39,94,39,58,79,80,95,66,73,84,88,79,82,44,
+0,0,0,0,12,25,0,1,38,0,0,0,12,31,0,9,
+79,80,95,66,73,84,65,78,68,0,0,0,13,26,31,0,
+12,27,0,1,124,0,0,0,12,31,0,8,79,80,95,66,
+73,84,79,82,0,0,0,0,13,28,31,0,12,29,0,1,
+94,0,0,0,12,31,0,9,79,80,95,66,73,84,88,79,
+82,0,0,0,13,30,31,0,26,8,9,22,15,7,8,0,
+30,12,4,244,9,9,105,102,32,116,46,118,97,108,32,61,
+61,32,39,78,111,110,101,39,58,32,114,101,116,117,114,110,
+32,115,101,108,102,46,95,100,111,95,110,111,110,101,40,114,
+41,0,0,0,12,9,0,3,118,97,108,0,9,8,2,9,
+12,9,0,4,78,111,110,101,0,0,0,0,23,8,8,9,
+21,8,0,0,18,0,0,10,12,12,0,8,95,100,111,95,
+110,111,110,101,0,0,0,0,49,9,1,12,15,11,3,0,
+50,8,9,1,20,8,0,0,18,0,0,1,30,6,4,245,
+9,9,105,102,32,116,46,118,97,108,32,61,61,32,39,84,
+114,117,101,39,58,0,0,0,12,9,0,3,118,97,108,0,
+9,8,2,9,12,9,0,4,84,114,117,101,0,0,0,0,
+23,8,8,9,21,8,0,0,18,0,0,22,30,9,4,246,
+9,9,9,114,101,116,117,114,110,32,115,101,108,102,46,95,
+100,111,95,110,117,109,98,101,114,40,39,49,39,44,114,41,
+0,0,0,0,12,13,0,10,95,100,111,95,110,117,109,98,
+101,114,0,0,49,9,1,13,12,11,0,1,49,0,0,0,
+15,12,3,0,50,8,9,2,20,8,0,0,18,0,0,1,
+30,6,4,247,9,9,105,102,32,116,46,118,97,108,32,61,
 61,32,39,70,97,108,115,101,39,58,0,0,12,9,0,3,
 118,97,108,0,9,8,2,9,12,9,0,5,70,97,108,115,
-101,0,0,0,23,8,8,9,21,8,0,0,18,0,0,23,
-30,9,4,221,9,9,9,114,101,116,117,114,110,32,115,101,
+101,0,0,0,23,8,8,9,21,8,0,0,18,0,0,22,
+30,9,4,248,9,9,9,114,101,116,117,114,110,32,115,101,
 108,102,46,95,100,111,95,110,117,109,98,101,114,40,39,48,
-39,44,114,41,0,0,0,0,12,10,0,10,95,100,111,95,
-110,117,109,98,101,114,0,0,9,9,1,10,12,10,0,1,
-48,0,0,0,15,11,3,0,31,8,10,2,19,8,9,8,
-20,8,0,0,18,0,0,1,30,5,4,222,9,9,105,116,
-101,109,115,32,61,32,116,46,105,116,101,109,115,0,0,0,
-12,10,0,5,105,116,101,109,115,0,0,0,9,9,2,10,
-15,8,9,0,30,7,4,224,9,9,105,102,32,116,46,118,
-97,108,32,105,110,32,91,39,97,110,100,39,44,39,111,114,
-39,93,58,0,12,10,0,3,97,110,100,0,12,11,0,2,
-111,114,0,0,27,9,10,2,12,11,0,3,118,97,108,0,
-9,10,2,11,36,9,9,10,21,9,0,0,18,0,0,38,
-30,15,4,225,9,9,9,114,101,116,117,114,110,32,115,101,
-108,102,46,108,111,103,105,99,95,105,110,102,105,120,40,116,
-46,118,97,108,44,32,105,116,101,109,115,91,48,93,44,32,
-105,116,101,109,115,91,49,93,44,32,114,41,0,0,0,0,
-12,11,0,11,108,111,103,105,99,95,105,110,102,105,120,0,
-9,10,1,11,12,15,0,3,118,97,108,0,9,11,2,15,
-11,15,0,0,0,0,0,0,0,0,0,0,9,12,8,15,
-11,15,0,0,0,0,0,0,0,0,240,63,9,13,8,15,
-15,14,3,0,31,9,11,4,19,9,10,9,20,9,0,0,
-18,0,0,1,30,6,4,226,9,9,105,102,32,116,46,118,
-97,108,32,105,110,32,105,115,101,116,115,58,0,0,0,0,
-12,11,0,3,118,97,108,0,9,10,2,11,36,9,5,10,
-21,9,0,0,18,0,0,27,30,11,4,227,9,9,9,114,
-101,116,117,114,110,32,115,101,108,102,46,105,109,97,110,97,
-103,101,40,116,44,115,101,108,102,46,100,111,95,115,121,109,
-98,111,108,41,0,0,0,0,12,11,0,7,105,109,97,110,
-97,103,101,0,9,10,1,11,15,11,2,0,12,13,0,9,
-100,111,95,115,121,109,98,111,108,0,0,0,9,12,1,13,
-31,9,11,2,19,9,10,9,20,9,0,0,18,0,0,1,
-30,5,4,228,9,9,105,102,32,116,46,118,97,108,32,61,
-61,32,39,105,115,39,58,0,12,10,0,3,118,97,108,0,
-9,9,2,10,12,10,0,2,105,115,0,0,23,9,9,10,
-21,9,0,0,18,0,0,35,30,12,4,229,9,9,9,114,
-101,116,117,114,110,32,115,101,108,102,46,105,110,102,105,120,
-40,79,80,95,69,81,44,105,116,101,109,115,91,48,93,44,
-105,116,101,109,115,91,49,93,44,114,41,0,12,11,0,5,
-105,110,102,105,120,0,0,0,9,10,1,11,12,15,0,5,
-79,80,95,69,81,0,0,0,13,11,15,0,11,15,0,0,
-0,0,0,0,0,0,0,0,9,12,8,15,11,15,0,0,
-0,0,0,0,0,0,240,63,9,13,8,15,15,14,3,0,
-31,9,11,4,19,9,10,9,20,9,0,0,18,0,0,1,
-30,6,4,230,9,9,105,102,32,116,46,118,97,108,32,61,
+39,44,114,41,0,0,0,0,12,13,0,10,95,100,111,95,
+110,117,109,98,101,114,0,0,49,9,1,13,12,11,0,1,
+48,0,0,0,15,12,3,0,50,8,9,2,20,8,0,0,
+18,0,0,1,30,5,4,249,9,9,105,116,101,109,115,32,
+61,32,116,46,105,116,101,109,115,0,0,0,12,10,0,5,
+105,116,101,109,115,0,0,0,9,9,2,10,15,8,9,0,
+30,7,4,251,9,9,105,102,32,116,46,118,97,108,32,105,
+110,32,91,39,97,110,100,39,44,39,111,114,39,93,58,0,
+12,10,0,3,97,110,100,0,12,11,0,2,111,114,0,0,
+27,9,10,2,12,11,0,3,118,97,108,0,9,10,2,11,
+36,9,9,10,21,9,0,0,18,0,0,37,30,15,4,252,
+9,9,9,114,101,116,117,114,110,32,115,101,108,102,46,108,
+111,103,105,99,95,105,110,102,105,120,40,116,46,118,97,108,
+44,32,105,116,101,109,115,91,48,93,44,32,105,116,101,109,
+115,91,49,93,44,32,114,41,0,0,0,0,12,16,0,11,
+108,111,103,105,99,95,105,110,102,105,120,0,49,10,1,16,
+12,16,0,3,118,97,108,0,9,12,2,16,11,16,0,1,
+0,0,0,0,0,0,0,0,9,13,8,16,11,16,0,1,
+1,0,0,0,0,0,0,0,9,14,8,16,15,15,3,0,
+50,9,10,4,20,9,0,0,18,0,0,1,30,6,4,253,
+9,9,105,102,32,116,46,118,97,108,32,105,110,32,105,115,
+101,116,115,58,0,0,0,0,12,11,0,3,118,97,108,0,
+9,10,2,11,36,9,5,10,21,9,0,0,18,0,0,26,
+30,11,4,254,9,9,9,114,101,116,117,114,110,32,115,101,
+108,102,46,105,109,97,110,97,103,101,40,116,44,115,101,108,
+102,46,100,111,95,115,121,109,98,111,108,41,0,0,0,0,
+12,14,0,7,105,109,97,110,97,103,101,0,49,10,1,14,
+15,12,2,0,12,14,0,9,100,111,95,115,121,109,98,111,
+108,0,0,0,9,13,1,14,50,9,10,2,20,9,0,0,
+18,0,0,1,30,5,4,255,9,9,105,102,32,116,46,118,
+97,108,32,61,61,32,39,105,115,39,58,0,12,10,0,3,
+118,97,108,0,9,9,2,10,12,10,0,2,105,115,0,0,
+23,9,9,10,21,9,0,0,18,0,0,34,30,12,5,0,
+9,9,9,114,101,116,117,114,110,32,115,101,108,102,46,105,
+110,102,105,120,40,79,80,95,69,81,44,105,116,101,109,115,
+91,48,93,44,105,116,101,109,115,91,49,93,44,114,41,0,
+12,16,0,5,105,110,102,105,120,0,0,0,49,10,1,16,
+12,16,0,5,79,80,95,69,81,0,0,0,13,12,16,0,
+11,16,0,1,0,0,0,0,0,0,0,0,9,13,8,16,
+11,16,0,1,1,0,0,0,0,0,0,0,9,14,8,16,
+15,15,3,0,50,9,10,4,20,9,0,0,18,0,0,1,
+30,6,5,1,9,9,105,102,32,116,46,118,97,108,32,61,
 61,32,39,105,115,110,111,116,39,58,0,0,12,10,0,3,
 118,97,108,0,9,9,2,10,12,10,0,5,105,115,110,111,
-116,0,0,0,23,9,9,10,21,9,0,0,18,0,0,36,
-30,13,4,231,9,9,9,114,101,116,117,114,110,32,115,101,
+116,0,0,0,23,9,9,10,21,9,0,0,18,0,0,35,
+30,13,5,2,9,9,9,114,101,116,117,114,110,32,115,101,
 108,102,46,105,110,102,105,120,40,79,80,95,67,77,80,44,
 105,116,101,109,115,91,48,93,44,105,116,101,109,115,91,49,
-93,44,114,41,0,0,0,0,12,11,0,5,105,110,102,105,
-120,0,0,0,9,10,1,11,12,15,0,6,79,80,95,67,
-77,80,0,0,13,11,15,0,11,15,0,0,0,0,0,0,
-0,0,0,0,9,12,8,15,11,15,0,0,0,0,0,0,
-0,0,240,63,9,13,8,15,15,14,3,0,31,9,11,4,
-19,9,10,9,20,9,0,0,18,0,0,1,30,6,4,232,
-9,9,105,102,32,116,46,118,97,108,32,61,61,32,39,110,
-111,116,39,58,0,0,0,0,12,10,0,3,118,97,108,0,
-9,9,2,10,12,10,0,3,110,111,116,0,23,9,9,10,
-21,9,0,0,18,0,0,30,30,11,4,233,9,9,9,114,
-101,116,117,114,110,32,115,101,108,102,46,117,110,97,114,121,
-40,79,80,95,78,79,84,44,32,105,116,101,109,115,91,48,
-93,44,32,114,41,0,0,0,12,11,0,5,117,110,97,114,
-121,0,0,0,9,10,1,11,12,14,0,6,79,80,95,78,
-79,84,0,0,13,11,14,0,11,14,0,0,0,0,0,0,
-0,0,0,0,9,12,8,14,15,13,3,0,31,9,11,3,
-19,9,10,9,20,9,0,0,18,0,0,1,30,5,4,234,
-9,9,105,102,32,116,46,118,97,108,32,61,61,32,39,105,
-110,39,58,0,12,10,0,3,118,97,108,0,9,9,2,10,
-12,10,0,2,105,110,0,0,23,9,9,10,21,9,0,0,
-18,0,0,36,30,13,4,235,9,9,9,114,101,116,117,114,
-110,32,115,101,108,102,46,105,110,102,105,120,40,79,80,95,
-72,65,83,44,105,116,101,109,115,91,49,93,44,105,116,101,
-109,115,91,48,93,44,114,41,0,0,0,0,12,11,0,5,
-105,110,102,105,120,0,0,0,9,10,1,11,12,15,0,6,
-79,80,95,72,65,83,0,0,13,11,15,0,11,15,0,0,
-0,0,0,0,0,0,240,63,9,12,8,15,11,15,0,0,
-0,0,0,0,0,0,0,0,9,13,8,15,15,14,3,0,
-31,9,11,4,19,9,10,9,20,9,0,0,18,0,0,1,
-30,6,4,236,9,9,105,102,32,116,46,118,97,108,32,61,
-61,32,39,110,111,116,105,110,39,58,0,0,12,10,0,3,
-118,97,108,0,9,9,2,10,12,10,0,5,110,111,116,105,
-110,0,0,0,23,9,9,10,21,9,0,0,18,0,0,92,
-30,12,4,237,9,9,9,114,32,61,32,115,101,108,102,46,
-105,110,102,105,120,40,79,80,95,72,65,83,44,105,116,101,
-109,115,91,49,93,44,105,116,101,109,115,91,48,93,44,114,
-41,0,0,0,12,11,0,5,105,110,102,105,120,0,0,0,
-9,10,1,11,12,15,0,6,79,80,95,72,65,83,0,0,
-13,11,15,0,11,15,0,0,0,0,0,0,0,0,240,63,
-9,12,8,15,11,15,0,0,0,0,0,0,0,0,0,0,
-9,13,8,15,15,14,3,0,31,9,11,4,19,9,10,9,
-15,3,9,0,30,8,4,238,9,9,9,122,101,114,111,32,
+93,44,114,41,0,0,0,0,12,16,0,5,105,110,102,105,
+120,0,0,0,49,10,1,16,12,16,0,6,79,80,95,67,
+77,80,0,0,13,12,16,0,11,16,0,1,0,0,0,0,
+0,0,0,0,9,13,8,16,11,16,0,1,1,0,0,0,
+0,0,0,0,9,14,8,16,15,15,3,0,50,9,10,4,
+20,9,0,0,18,0,0,1,30,6,5,3,9,9,105,102,
+32,116,46,118,97,108,32,61,61,32,39,110,111,116,39,58,
+0,0,0,0,12,10,0,3,118,97,108,0,9,9,2,10,
+12,10,0,3,110,111,116,0,23,9,9,10,21,9,0,0,
+18,0,0,29,30,11,5,4,9,9,9,114,101,116,117,114,
+110,32,115,101,108,102,46,117,110,97,114,121,40,79,80,95,
+78,79,84,44,32,105,116,101,109,115,91,48,93,44,32,114,
+41,0,0,0,12,15,0,5,117,110,97,114,121,0,0,0,
+49,10,1,15,12,15,0,6,79,80,95,78,79,84,0,0,
+13,12,15,0,11,15,0,1,0,0,0,0,0,0,0,0,
+9,13,8,15,15,14,3,0,50,9,10,3,20,9,0,0,
+18,0,0,1,30,5,5,5,9,9,105,102,32,116,46,118,
+97,108,32,61,61,32,39,105,110,39,58,0,12,10,0,3,
+118,97,108,0,9,9,2,10,12,10,0,2,105,110,0,0,
+23,9,9,10,21,9,0,0,18,0,0,35,30,13,5,6,
+9,9,9,114,101,116,117,114,110,32,115,101,108,102,46,105,
+110,102,105,120,40,79,80,95,72,65,83,44,105,116,101,109,
+115,91,49,93,44,105,116,101,109,115,91,48,93,44,114,41,
+0,0,0,0,12,16,0,5,105,110,102,105,120,0,0,0,
+49,10,1,16,12,16,0,6,79,80,95,72,65,83,0,0,
+13,12,16,0,11,16,0,1,1,0,0,0,0,0,0,0,
+9,13,8,16,11,16,0,1,0,0,0,0,0,0,0,0,
+9,14,8,16,15,15,3,0,50,9,10,4,20,9,0,0,
+18,0,0,1,30,6,5,7,9,9,105,102,32,116,46,118,
+97,108,32,61,61,32,39,110,111,116,105,110,39,58,0,0,
+12,10,0,3,118,97,108,0,9,9,2,10,12,10,0,5,
+110,111,116,105,110,0,0,0,23,9,9,10,21,9,0,0,
+18,0,0,88,30,12,5,8,9,9,9,114,32,61,32,115,
+101,108,102,46,105,110,102,105,120,40,79,80,95,72,65,83,
+44,105,116,101,109,115,91,49,93,44,105,116,101,109,115,91,
+48,93,44,114,41,0,0,0,12,16,0,5,105,110,102,105,
+120,0,0,0,49,10,1,16,12,16,0,6,79,80,95,72,
+65,83,0,0,13,12,16,0,11,16,0,1,1,0,0,0,
+0,0,0,0,9,13,8,16,11,16,0,1,0,0,0,0,
+0,0,0,0,9,14,8,16,15,15,3,0,50,9,10,4,
+15,3,9,0,30,8,5,9,9,9,9,122,101,114,111,32,
 61,32,115,101,108,102,46,95,100,111,95,110,117,109,98,101,
-114,40,39,48,39,41,0,0,12,12,0,10,95,100,111,95,
-110,117,109,98,101,114,0,0,9,11,1,12,12,12,0,1,
-48,0,0,0,31,10,12,1,19,10,11,10,15,9,10,0,
-30,12,4,239,9,9,9,115,101,108,102,46,100,111,95,99,
-111,100,101,40,79,80,95,69,81,44,114,44,114,44,115,101,
-108,102,46,102,114,101,101,95,116,109,112,40,122,101,114,111,
-41,41,0,0,12,12,0,7,100,111,95,99,111,100,101,0,
-9,11,1,12,12,16,0,5,79,80,95,69,81,0,0,0,
-13,12,16,0,15,13,3,0,15,14,3,0,12,17,0,8,
-102,114,101,101,95,116,109,112,0,0,0,0,9,16,1,17,
-15,17,9,0,31,15,17,1,19,15,16,15,31,10,12,4,
-19,10,11,10,30,3,4,240,9,9,9,114,101,116,117,114,
-110,32,114,0,20,3,0,0,18,0,0,1,30,5,4,241,
-9,9,105,102,32,116,46,118,97,108,32,105,110,32,115,101,
-116,115,58,0,12,12,0,3,118,97,108,0,9,11,2,12,
-36,10,4,11,21,10,0,0,18,0,0,31,30,12,4,242,
-9,9,9,114,101,116,117,114,110,32,115,101,108,102,46,100,
-111,95,115,101,116,95,99,116,120,40,105,116,101,109,115,91,
-48,93,44,105,116,101,109,115,91,49,93,41,59,0,0,0,
-12,12,0,10,100,111,95,115,101,116,95,99,116,120,0,0,
-9,11,1,12,11,14,0,0,0,0,0,0,0,0,0,0,
-9,12,8,14,11,14,0,0,0,0,0,0,0,0,240,63,
-9,13,8,14,31,10,12,2,19,10,11,10,20,10,0,0,
-18,0,0,211,30,6,4,243,9,9,101,108,105,102,32,116,
+114,40,39,48,39,41,0,0,12,14,0,10,95,100,111,95,
+110,117,109,98,101,114,0,0,49,11,1,14,12,13,0,1,
+48,0,0,0,50,10,11,1,15,9,10,0,30,12,5,10,
+9,9,9,115,101,108,102,46,100,111,95,99,111,100,101,40,
+79,80,95,69,81,44,114,44,114,44,115,101,108,102,46,102,
+114,101,101,95,116,109,112,40,122,101,114,111,41,41,0,0,
+12,17,0,7,100,111,95,99,111,100,101,0,49,11,1,17,
+12,17,0,5,79,80,95,69,81,0,0,0,13,13,17,0,
+15,14,3,0,15,15,3,0,12,20,0,8,102,114,101,101,
+95,116,109,112,0,0,0,0,49,17,1,20,15,19,9,0,
+50,16,17,1,50,10,11,4,30,3,5,11,9,9,9,114,
+101,116,117,114,110,32,114,0,20,3,0,0,18,0,0,1,
+30,5,5,12,9,9,105,102,32,116,46,118,97,108,32,105,
+110,32,115,101,116,115,58,0,12,12,0,3,118,97,108,0,
+9,11,2,12,36,10,4,11,21,10,0,0,18,0,0,30,
+30,12,5,13,9,9,9,114,101,116,117,114,110,32,115,101,
+108,102,46,100,111,95,115,101,116,95,99,116,120,40,105,116,
+101,109,115,91,48,93,44,105,116,101,109,115,91,49,93,41,
+59,0,0,0,12,15,0,10,100,111,95,115,101,116,95,99,
+116,120,0,0,49,11,1,15,11,15,0,1,0,0,0,0,
+0,0,0,0,9,13,8,15,11,15,0,1,1,0,0,0,
+0,0,0,0,9,14,8,15,50,10,11,2,20,10,0,0,
+18,0,0,209,30,6,5,14,9,9,101,108,105,102,32,116,
 46,118,97,108,32,105,110,32,99,109,112,115,58,0,0,0,
 12,12,0,3,118,97,108,0,9,11,2,12,36,10,6,11,
-21,10,0,0,18,0,0,162,30,7,4,244,9,9,9,98,
+21,10,0,0,18,0,0,161,30,7,5,15,9,9,9,98,
 44,99,32,61,32,105,116,101,109,115,91,48,93,44,105,116,
-101,109,115,91,49,93,0,0,11,12,0,0,0,0,0,0,
-0,0,0,0,9,11,8,12,15,10,11,0,11,13,0,0,
-0,0,0,0,0,0,240,63,9,12,8,13,15,11,12,0,
-15,12,10,0,15,10,11,0,30,4,4,245,9,9,9,118,
+101,109,115,91,49,93,0,0,11,12,0,1,0,0,0,0,
+0,0,0,0,9,11,8,12,15,10,11,0,11,13,0,1,
+1,0,0,0,0,0,0,0,9,12,8,13,15,11,12,0,
+15,12,10,0,15,10,11,0,30,4,5,16,9,9,9,118,
 32,61,32,116,46,118,97,108,0,0,0,0,12,14,0,3,
-118,97,108,0,9,13,2,14,15,11,13,0,30,7,4,246,
+118,97,108,0,9,13,2,14,15,11,13,0,30,7,5,17,
 9,9,9,105,102,32,118,91,48,93,32,105,110,32,40,39,
 62,39,44,39,62,61,39,41,58,0,0,0,12,14,0,1,
 62,0,0,0,12,15,0,2,62,61,0,0,27,13,14,2,
-11,15,0,0,0,0,0,0,0,0,0,0,9,14,11,15,
-36,13,13,14,21,13,0,0,18,0,0,25,30,7,4,247,
+11,15,0,1,0,0,0,0,0,0,0,0,9,14,11,15,
+36,13,13,14,21,13,0,0,18,0,0,25,30,7,5,18,
 9,9,9,9,98,44,99,44,118,32,61,32,99,44,98,44,
 39,60,39,43,118,91,49,58,93,0,0,0,15,13,10,0,
-15,14,12,0,12,16,0,1,60,0,0,0,11,19,0,0,
-0,0,0,0,0,0,240,63,28,20,0,0,27,18,19,2,
+15,14,12,0,12,16,0,1,60,0,0,0,11,19,0,1,
+1,0,0,0,0,0,0,0,28,20,0,0,27,18,19,2,
 9,17,11,18,1,16,16,17,15,15,16,0,15,12,13,0,
-15,10,14,0,15,11,15,0,18,0,0,1,30,4,4,248,
+15,10,14,0,15,11,15,0,18,0,0,1,30,4,5,19,
 9,9,9,99,100,32,61,32,79,80,95,69,81,0,0,0,
 12,15,0,5,79,80,95,69,81,0,0,0,13,14,15,0,
-15,13,14,0,30,7,4,249,9,9,9,105,102,32,118,32,
+15,13,14,0,30,7,5,20,9,9,9,105,102,32,118,32,
 61,61,32,39,60,39,58,32,99,100,32,61,32,79,80,95,
 76,84,0,0,12,15,0,1,60,0,0,0,23,14,11,15,
 21,14,0,0,18,0,0,7,12,15,0,5,79,80,95,76,
 84,0,0,0,13,14,15,0,15,13,14,0,18,0,0,1,
-30,7,4,250,9,9,9,105,102,32,118,32,61,61,32,39,
+30,7,5,21,9,9,9,105,102,32,118,32,61,61,32,39,
 60,61,39,58,32,99,100,32,61,32,79,80,95,76,69,0,
 12,15,0,2,60,61,0,0,23,14,11,15,21,14,0,0,
 18,0,0,7,12,15,0,5,79,80,95,76,69,0,0,0,
-13,14,15,0,15,13,14,0,18,0,0,1,30,7,4,251,
+13,14,15,0,15,13,14,0,18,0,0,1,30,7,5,22,
 9,9,9,105,102,32,118,32,61,61,32,39,33,61,39,58,
 32,99,100,32,61,32,79,80,95,78,69,0,12,15,0,2,
 33,61,0,0,23,14,11,15,21,14,0,0,18,0,0,7,
 12,15,0,5,79,80,95,78,69,0,0,0,13,14,15,0,
-15,13,14,0,18,0,0,1,30,8,4,252,9,9,9,114,
+15,13,14,0,18,0,0,1,30,8,5,23,9,9,9,114,
 101,116,117,114,110,32,115,101,108,102,46,105,110,102,105,120,
-40,99,100,44,98,44,99,44,114,41,0,0,12,16,0,5,
-105,110,102,105,120,0,0,0,9,15,1,16,15,16,13,0,
-15,17,12,0,15,18,10,0,15,19,3,0,31,14,16,4,
-19,14,15,14,20,14,0,0,18,0,0,37,30,14,4,254,
-9,9,9,114,101,116,117,114,110,32,115,101,108,102,46,105,
-110,102,105,120,40,109,101,116,97,115,91,116,46,118,97,108,
-93,44,105,116,101,109,115,91,48,93,44,105,116,101,109,115,
-91,49,93,44,114,41,0,0,12,16,0,5,105,110,102,105,
-120,0,0,0,9,15,1,16,12,21,0,3,118,97,108,0,
-9,20,2,21,9,16,7,20,11,20,0,0,0,0,0,0,
-0,0,0,0,9,17,8,20,11,20,0,0,0,0,0,0,
-0,0,240,63,9,18,8,20,15,19,3,0,31,14,16,4,
-19,14,15,14,20,14,0,0,18,0,0,1,0,0,0,0,
-12,108,0,9,100,111,95,115,121,109,98,111,108,0,0,0,
-10,7,108,107,16,108,3,69,44,35,0,0,30,7,5,1,
-9,100,101,102,32,100,111,95,115,101,116,95,99,116,120,40,
-115,101,108,102,44,107,44,118,41,58,0,0,12,1,0,9,
-116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,10,100,111,95,115,101,116,95,99,116,120,0,0,
-34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,28,4,0,0,9,3,0,4,30,6,5,2,
-9,9,105,102,32,107,46,116,121,112,101,32,61,61,32,39,
-110,97,109,101,39,58,0,0,12,5,0,4,116,121,112,101,
-0,0,0,0,9,4,2,5,12,5,0,4,110,97,109,101,
-0,0,0,0,23,4,4,5,21,4,0,0,18,0,0,217,
-30,17,5,3,9,9,9,105,102,32,40,68,46,95,103,108,
-111,98,97,108,115,32,97,110,100,32,107,46,118,97,108,32,
-110,111,116,32,105,110,32,68,46,118,97,114,115,41,32,111,
-114,32,40,107,46,118,97,108,32,105,110,32,68,46,103,108,
-111,98,97,108,115,41,58,0,12,5,0,1,68,0,0,0,
-13,4,5,0,12,5,0,8,95,103,108,111,98,97,108,115,
-0,0,0,0,9,4,4,5,21,4,0,0,18,0,0,16,
-12,5,0,1,68,0,0,0,13,4,5,0,12,5,0,4,
-118,97,114,115,0,0,0,0,9,4,4,5,12,6,0,3,
-118,97,108,0,9,5,2,6,36,4,4,5,11,5,0,0,
-0,0,0,0,0,0,0,0,23,4,4,5,46,4,0,0,
-18,0,0,12,12,5,0,1,68,0,0,0,13,4,5,0,
-12,5,0,7,103,108,111,98,97,108,115,0,9,4,4,5,
-12,6,0,3,118,97,108,0,9,5,2,6,36,4,4,5,
-21,4,0,0,18,0,0,89,30,7,5,4,9,9,9,9,
-99,32,61,32,115,101,108,102,46,100,111,95,115,116,114,105,
-110,103,40,107,41,0,0,0,12,7,0,9,100,111,95,115,
-116,114,105,110,103,0,0,0,9,6,1,7,15,7,2,0,
-31,5,7,1,19,5,6,5,15,4,5,0,30,5,5,5,
-9,9,9,9,98,32,61,32,115,101,108,102,46,100,111,40,
-118,41,0,0,12,8,0,2,100,111,0,0,9,7,1,8,
-15,8,3,0,31,6,8,1,19,6,7,6,15,5,6,0,
-30,8,5,6,9,9,9,9,115,101,108,102,46,100,111,95,
+40,99,100,44,98,44,99,44,114,41,0,0,12,21,0,5,
+105,110,102,105,120,0,0,0,49,15,1,21,15,17,13,0,
+15,18,12,0,15,19,10,0,15,20,3,0,50,14,15,4,
+20,14,0,0,18,0,0,36,30,14,5,25,9,9,9,114,
+101,116,117,114,110,32,115,101,108,102,46,105,110,102,105,120,
+40,109,101,116,97,115,91,116,46,118,97,108,93,44,105,116,
+101,109,115,91,48,93,44,105,116,101,109,115,91,49,93,44,
+114,41,0,0,12,21,0,5,105,110,102,105,120,0,0,0,
+49,15,1,21,12,22,0,3,118,97,108,0,9,21,2,22,
+9,17,7,21,11,21,0,1,0,0,0,0,0,0,0,0,
+9,18,8,21,11,21,0,1,1,0,0,0,0,0,0,0,
+9,19,8,21,15,20,3,0,50,14,15,4,20,14,0,0,
+18,0,0,1,0,0,0,0,12,110,0,9,100,111,95,115,
+121,109,98,111,108,0,0,0,10,8,110,109,16,110,3,42,
+44,37,0,0,30,7,5,28,9,100,101,102,32,100,111,95,
+115,101,116,95,99,116,120,40,115,101,108,102,44,107,44,118,
+41,58,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
+121,0,0,0,33,1,0,0,12,1,0,10,100,111,95,115,
+101,116,95,99,116,120,0,0,34,1,0,0,28,2,0,0,
+9,1,0,2,28,3,0,0,9,2,0,3,28,4,0,0,
+9,3,0,4,30,6,5,29,9,9,105,102,32,107,46,116,
+121,112,101,32,61,61,32,39,110,97,109,101,39,58,0,0,
+12,5,0,4,116,121,112,101,0,0,0,0,9,4,2,5,
+12,5,0,4,110,97,109,101,0,0,0,0,23,4,4,5,
+21,4,0,0,18,0,0,208,30,17,5,30,9,9,9,105,
+102,32,40,68,46,95,103,108,111,98,97,108,115,32,97,110,
+100,32,107,46,118,97,108,32,110,111,116,32,105,110,32,68,
+46,118,97,114,115,41,32,111,114,32,40,107,46,118,97,108,
+32,105,110,32,68,46,103,108,111,98,97,108,115,41,58,0,
+12,5,0,1,68,0,0,0,13,4,5,0,12,5,0,8,
+95,103,108,111,98,97,108,115,0,0,0,0,9,4,4,5,
+21,4,0,0,18,0,0,16,12,5,0,1,68,0,0,0,
+13,4,5,0,12,5,0,4,118,97,114,115,0,0,0,0,
+9,4,4,5,12,6,0,3,118,97,108,0,9,5,2,6,
+36,4,4,5,11,5,0,1,0,0,0,0,0,0,0,0,
+23,4,4,5,46,4,0,0,18,0,0,12,12,5,0,1,
+68,0,0,0,13,4,5,0,12,5,0,7,103,108,111,98,
+97,108,115,0,9,4,4,5,12,6,0,3,118,97,108,0,
+9,5,2,6,36,4,4,5,21,4,0,0,18,0,0,84,
+30,7,5,31,9,9,9,9,99,32,61,32,115,101,108,102,
+46,100,111,95,115,116,114,105,110,103,40,107,41,0,0,0,
+12,9,0,9,100,111,95,115,116,114,105,110,103,0,0,0,
+49,6,1,9,15,8,2,0,50,5,6,1,15,4,5,0,
+30,5,5,32,9,9,9,9,98,32,61,32,115,101,108,102,
+46,100,111,40,118,41,0,0,12,10,0,2,100,111,0,0,
+49,7,1,10,15,9,3,0,50,6,7,1,15,5,6,0,
+30,8,5,33,9,9,9,9,115,101,108,102,46,100,111,95,
 99,111,100,101,40,79,80,95,71,83,69,84,44,99,44,98,
-41,0,0,0,12,8,0,7,100,111,95,99,111,100,101,0,
-9,7,1,8,12,11,0,7,79,80,95,71,83,69,84,0,
-13,8,11,0,15,9,4,0,15,10,5,0,31,6,8,3,
-19,6,7,6,30,6,5,7,9,9,9,9,115,101,108,102,
-46,102,114,101,101,95,116,109,112,40,99,41,0,0,0,0,
-12,8,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
-9,7,1,8,15,8,4,0,31,6,8,1,19,6,7,6,
-30,6,5,8,9,9,9,9,115,101,108,102,46,102,114,101,
-101,95,116,109,112,40,98,41,0,0,0,0,12,8,0,8,
-102,114,101,101,95,116,109,112,0,0,0,0,9,7,1,8,
-15,8,5,0,31,6,8,1,19,6,7,6,30,3,5,9,
-9,9,9,9,114,101,116,117,114,110,0,0,28,6,0,0,
-20,6,0,0,18,0,0,1,30,6,5,10,9,9,9,97,
-32,61,32,115,101,108,102,46,100,111,95,108,111,99,97,108,
-40,107,41,0,12,9,0,8,100,111,95,108,111,99,97,108,
-0,0,0,0,9,8,1,9,15,9,2,0,31,7,9,1,
-19,7,8,7,15,6,7,0,30,5,5,11,9,9,9,98,
+41,0,0,0,12,12,0,7,100,111,95,99,111,100,101,0,
+49,7,1,12,12,12,0,7,79,80,95,71,83,69,84,0,
+13,9,12,0,15,10,4,0,15,11,5,0,50,6,7,3,
+30,6,5,34,9,9,9,9,115,101,108,102,46,102,114,101,
+101,95,116,109,112,40,99,41,0,0,0,0,12,10,0,8,
+102,114,101,101,95,116,109,112,0,0,0,0,49,7,1,10,
+15,9,4,0,50,6,7,1,30,6,5,35,9,9,9,9,
+115,101,108,102,46,102,114,101,101,95,116,109,112,40,98,41,
+0,0,0,0,12,10,0,8,102,114,101,101,95,116,109,112,
+0,0,0,0,49,7,1,10,15,9,5,0,50,6,7,1,
+30,3,5,36,9,9,9,9,114,101,116,117,114,110,0,0,
+28,6,0,0,20,6,0,0,18,0,0,1,30,6,5,37,
+9,9,9,97,32,61,32,115,101,108,102,46,100,111,95,108,
+111,99,97,108,40,107,41,0,12,11,0,8,100,111,95,108,
+111,99,97,108,0,0,0,0,49,8,1,11,15,10,2,0,
+50,7,8,1,15,6,7,0,30,5,5,38,9,9,9,98,
 32,61,32,115,101,108,102,46,100,111,40,118,41,0,0,0,
-12,9,0,2,100,111,0,0,9,8,1,9,15,9,3,0,
-31,7,9,1,19,7,8,7,15,5,7,0,30,8,5,12,
-9,9,9,115,101,108,102,46,100,111,95,99,111,100,101,40,
-79,80,95,77,79,86,69,44,97,44,98,41,0,0,0,0,
-12,9,0,7,100,111,95,99,111,100,101,0,9,8,1,9,
-12,12,0,7,79,80,95,77,79,86,69,0,13,9,12,0,
-15,10,6,0,15,11,5,0,31,7,9,3,19,7,8,7,
-30,5,5,13,9,9,9,115,101,108,102,46,102,114,101,101,
-95,116,109,112,40,98,41,0,12,9,0,8,102,114,101,101,
-95,116,109,112,0,0,0,0,9,8,1,9,15,9,5,0,
-31,7,9,1,19,7,8,7,30,3,5,14,9,9,9,114,
-101,116,117,114,110,32,97,0,20,6,0,0,18,0,1,207,
-30,9,5,15,9,9,101,108,105,102,32,107,46,116,121,112,
-101,32,105,110,32,40,39,116,117,112,108,101,39,44,39,108,
-105,115,116,39,41,58,0,0,12,8,0,5,116,117,112,108,
-101,0,0,0,12,9,0,4,108,105,115,116,0,0,0,0,
-27,7,8,2,12,9,0,4,116,121,112,101,0,0,0,0,
-9,8,2,9,36,7,7,8,21,7,0,0,18,0,1,183,
-30,9,5,16,9,9,9,105,102,32,118,46,116,121,112,101,
-32,105,110,32,40,39,116,117,112,108,101,39,44,39,108,105,
-115,116,39,41,58,0,0,0,12,8,0,5,116,117,112,108,
-101,0,0,0,12,9,0,4,108,105,115,116,0,0,0,0,
-27,7,8,2,12,9,0,4,116,121,112,101,0,0,0,0,
-9,8,3,9,36,7,7,8,21,7,0,0,18,0,0,240,
-30,5,5,17,9,9,9,9,110,44,116,109,112,115,32,61,
-32,48,44,91,93,0,0,0,11,8,0,0,0,0,0,0,
-0,0,0,0,15,7,8,0,27,9,0,0,15,8,9,0,
-15,9,7,0,15,7,8,0,30,6,5,18,9,9,9,9,
-102,111,114,32,107,107,32,105,110,32,107,46,105,116,101,109,
-115,58,0,0,12,11,0,5,105,116,101,109,115,0,0,0,
-9,10,2,11,11,11,0,0,0,0,0,0,0,0,0,0,
-42,8,10,11,18,0,0,102,30,6,5,19,9,9,9,9,
-9,118,118,32,61,32,118,46,105,116,101,109,115,91,110,93,
-0,0,0,0,12,14,0,5,105,116,101,109,115,0,0,0,
-9,13,3,14,9,13,13,9,15,12,13,0,30,11,5,20,
-9,9,9,9,9,116,109,112,32,61,32,115,101,108,102,46,
-103,101,116,95,116,109,112,40,41,59,32,116,109,112,115,46,
-97,112,112,101,110,100,40,116,109,112,41,0,12,16,0,7,
-103,101,116,95,116,109,112,0,9,15,1,16,31,14,0,0,
-19,14,15,14,15,13,14,0,12,16,0,6,97,112,112,101,
-110,100,0,0,9,15,7,16,15,16,13,0,31,14,16,1,
-19,14,15,14,30,6,5,21,9,9,9,9,9,114,32,61,
-32,115,101,108,102,46,100,111,40,118,118,41,0,0,0,0,
-12,17,0,2,100,111,0,0,9,16,1,17,15,17,12,0,
-31,15,17,1,19,15,16,15,15,14,15,0,30,9,5,22,
-9,9,9,9,9,115,101,108,102,46,100,111,95,99,111,100,
-101,40,79,80,95,77,79,86,69,44,116,109,112,44,114,41,
-0,0,0,0,12,17,0,7,100,111,95,99,111,100,101,0,
-9,16,1,17,12,20,0,7,79,80,95,77,79,86,69,0,
-13,17,20,0,15,18,13,0,15,19,14,0,31,15,17,3,
-19,15,16,15,30,7,5,23,9,9,9,9,9,115,101,108,
-102,46,102,114,101,101,95,116,109,112,40,114,41,32,35,82,
-69,71,0,0,12,17,0,8,102,114,101,101,95,116,109,112,
-0,0,0,0,9,16,1,17,15,17,14,0,31,15,17,1,
-19,15,16,15,30,3,5,24,9,9,9,9,9,110,43,61,
-49,0,0,0,11,16,0,0,0,0,0,0,0,0,240,63,
-1,15,9,16,15,9,15,0,18,0,255,154,30,3,5,25,
-9,9,9,9,110,32,61,32,48,0,0,0,11,10,0,0,
-0,0,0,0,0,0,0,0,15,9,10,0,30,6,5,26,
+12,11,0,2,100,111,0,0,49,8,1,11,15,10,3,0,
+50,7,8,1,15,5,7,0,30,8,5,39,9,9,9,115,
+101,108,102,46,100,111,95,99,111,100,101,40,79,80,95,77,
+79,86,69,44,97,44,98,41,0,0,0,0,12,13,0,7,
+100,111,95,99,111,100,101,0,49,8,1,13,12,13,0,7,
+79,80,95,77,79,86,69,0,13,10,13,0,15,11,6,0,
+15,12,5,0,50,7,8,3,30,5,5,40,9,9,9,115,
+101,108,102,46,102,114,101,101,95,116,109,112,40,98,41,0,
+12,11,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
+49,8,1,11,15,10,5,0,50,7,8,1,30,3,5,41,
+9,9,9,114,101,116,117,114,110,32,97,0,20,6,0,0,
+18,0,1,195,30,9,5,42,9,9,101,108,105,102,32,107,
+46,116,121,112,101,32,105,110,32,40,39,116,117,112,108,101,
+39,44,39,108,105,115,116,39,41,58,0,0,12,8,0,5,
+116,117,112,108,101,0,0,0,12,9,0,4,108,105,115,116,
+0,0,0,0,27,7,8,2,12,9,0,4,116,121,112,101,
+0,0,0,0,9,8,2,9,36,7,7,8,21,7,0,0,
+18,0,1,171,30,9,5,43,9,9,9,105,102,32,118,46,
+116,121,112,101,32,105,110,32,40,39,116,117,112,108,101,39,
+44,39,108,105,115,116,39,41,58,0,0,0,12,8,0,5,
+116,117,112,108,101,0,0,0,12,9,0,4,108,105,115,116,
+0,0,0,0,27,7,8,2,12,9,0,4,116,121,112,101,
+0,0,0,0,9,8,3,9,36,7,7,8,21,7,0,0,
+18,0,0,233,30,5,5,44,9,9,9,9,110,44,116,109,
+112,115,32,61,32,48,44,91,93,0,0,0,11,8,0,1,
+0,0,0,0,0,0,0,0,15,7,8,0,27,9,0,0,
+15,8,9,0,15,9,7,0,15,7,8,0,30,6,5,45,
 9,9,9,9,102,111,114,32,107,107,32,105,110,32,107,46,
 105,116,101,109,115,58,0,0,12,11,0,5,105,116,101,109,
-115,0,0,0,9,10,2,11,11,11,0,0,0,0,0,0,
-0,0,0,0,42,8,10,11,18,0,0,78,30,6,5,27,
+115,0,0,0,9,10,2,11,11,11,0,1,0,0,0,0,
+0,0,0,0,42,8,10,11,18,0,0,97,30,6,5,46,
+9,9,9,9,9,118,118,32,61,32,118,46,105,116,101,109,
+115,91,110,93,0,0,0,0,12,14,0,5,105,116,101,109,
+115,0,0,0,9,13,3,14,9,13,13,9,15,12,13,0,
+30,11,5,47,9,9,9,9,9,116,109,112,32,61,32,115,
+101,108,102,46,103,101,116,95,116,109,112,40,41,59,32,116,
+109,112,115,46,97,112,112,101,110,100,40,116,109,112,41,0,
+12,17,0,7,103,101,116,95,116,109,112,0,49,15,1,17,
+50,14,15,0,15,13,14,0,12,18,0,6,97,112,112,101,
+110,100,0,0,49,15,7,18,15,17,13,0,50,14,15,1,
+30,6,5,48,9,9,9,9,9,114,32,61,32,115,101,108,
+102,46,100,111,40,118,118,41,0,0,0,0,12,19,0,2,
+100,111,0,0,49,16,1,19,15,18,12,0,50,15,16,1,
+15,14,15,0,30,9,5,49,9,9,9,9,9,115,101,108,
+102,46,100,111,95,99,111,100,101,40,79,80,95,77,79,86,
+69,44,116,109,112,44,114,41,0,0,0,0,12,21,0,7,
+100,111,95,99,111,100,101,0,49,16,1,21,12,21,0,7,
+79,80,95,77,79,86,69,0,13,18,21,0,15,19,13,0,
+15,20,14,0,50,15,16,3,30,7,5,50,9,9,9,9,
+9,115,101,108,102,46,102,114,101,101,95,116,109,112,40,114,
+41,32,35,82,69,71,0,0,12,19,0,8,102,114,101,101,
+95,116,109,112,0,0,0,0,49,16,1,19,15,18,14,0,
+50,15,16,1,30,3,5,51,9,9,9,9,9,110,43,61,
+49,0,0,0,11,16,0,1,1,0,0,0,0,0,0,0,
+1,15,9,16,15,9,15,0,18,0,255,159,30,3,5,52,
+9,9,9,9,110,32,61,32,48,0,0,0,11,10,0,1,
+0,0,0,0,0,0,0,0,15,9,10,0,30,6,5,53,
+9,9,9,9,102,111,114,32,107,107,32,105,110,32,107,46,
+105,116,101,109,115,58,0,0,12,11,0,5,105,116,101,109,
+115,0,0,0,9,10,2,11,11,11,0,1,0,0,0,0,
+0,0,0,0,42,8,10,11,18,0,0,76,30,6,5,54,
 9,9,9,9,9,118,118,32,61,32,118,46,105,116,101,109,
 115,91,110,93,0,0,0,0,12,16,0,5,105,116,101,109,
 115,0,0,0,9,15,3,16,9,15,15,9,15,12,15,0,
-30,5,5,28,9,9,9,9,9,116,109,112,32,61,32,116,
+30,5,5,55,9,9,9,9,9,116,109,112,32,61,32,116,
 109,112,115,91,110,93,0,0,9,15,7,9,15,13,15,0,
-30,18,5,29,9,9,9,9,9,115,101,108,102,46,102,114,
+30,18,5,56,9,9,9,9,9,115,101,108,102,46,102,114,
 101,101,95,116,109,112,40,115,101,108,102,46,100,111,95,115,
 101,116,95,99,116,120,40,107,107,44,84,111,107,101,110,40,
 118,118,46,112,111,115,44,39,114,101,103,39,44,116,109,112,
-41,41,41,32,35,82,69,71,0,0,0,0,12,17,0,8,
-102,114,101,101,95,116,109,112,0,0,0,0,9,16,1,17,
-12,19,0,10,100,111,95,115,101,116,95,99,116,120,0,0,
-9,18,1,19,15,19,8,0,12,22,0,5,84,111,107,101,
-110,0,0,0,13,21,22,0,12,25,0,3,112,111,115,0,
-9,22,12,25,12,23,0,3,114,101,103,0,15,24,13,0,
-31,20,22,3,19,20,21,20,31,17,19,2,19,17,18,17,
-31,15,17,1,19,15,16,15,30,3,5,30,9,9,9,9,
-9,110,32,43,61,32,49,0,11,16,0,0,0,0,0,0,
-0,0,240,63,1,15,9,16,15,9,15,0,18,0,255,178,
-30,3,5,31,9,9,9,9,114,101,116,117,114,110,0,0,
-28,10,0,0,20,10,0,0,18,0,0,1,30,9,5,33,
-9,9,9,114,32,61,32,115,101,108,102,46,100,111,40,118,
-41,59,32,115,101,108,102,46,117,110,95,116,109,112,40,114,
-41,0,0,0,12,15,0,2,100,111,0,0,9,11,1,15,
-15,15,3,0,31,10,15,1,19,10,11,10,15,14,10,0,
-12,15,0,6,117,110,95,116,109,112,0,0,9,11,1,15,
-15,15,14,0,31,10,15,1,19,10,11,10,30,9,5,34,
+41,41,41,32,35,82,69,71,0,0,0,0,12,19,0,8,
+102,114,101,101,95,116,109,112,0,0,0,0,49,16,1,19,
+12,23,0,10,100,111,95,115,101,116,95,99,116,120,0,0,
+49,19,1,23,15,21,8,0,12,24,0,5,84,111,107,101,
+110,0,0,0,13,23,24,0,12,27,0,3,112,111,115,0,
+9,24,12,27,12,25,0,3,114,101,103,0,15,26,13,0,
+31,22,24,3,19,22,23,22,50,18,19,2,50,15,16,1,
+30,3,5,57,9,9,9,9,9,110,32,43,61,32,49,0,
+11,16,0,1,1,0,0,0,0,0,0,0,1,15,9,16,
+15,9,15,0,18,0,255,180,30,3,5,58,9,9,9,9,
+114,101,116,117,114,110,0,0,28,10,0,0,20,10,0,0,
+18,0,0,1,30,9,5,60,9,9,9,114,32,61,32,115,
+101,108,102,46,100,111,40,118,41,59,32,115,101,108,102,46,
+117,110,95,116,109,112,40,114,41,0,0,0,12,11,0,2,
+100,111,0,0,49,15,1,11,15,17,3,0,50,10,15,1,
+15,14,10,0,12,11,0,6,117,110,95,116,109,112,0,0,
+49,15,1,11,15,17,14,0,50,10,15,1,30,9,5,61,
 9,9,9,110,44,32,116,109,112,32,61,32,48,44,32,84,
 111,107,101,110,40,118,46,112,111,115,44,39,114,101,103,39,
-44,114,41,0,11,11,0,0,0,0,0,0,0,0,0,0,
+44,114,41,0,11,11,0,1,0,0,0,0,0,0,0,0,
 15,10,11,0,12,17,0,5,84,111,107,101,110,0,0,0,
 13,16,17,0,12,20,0,3,112,111,115,0,9,17,3,20,
 12,18,0,3,114,101,103,0,15,19,14,0,31,15,17,3,
 19,15,16,15,15,11,15,0,15,9,10,0,15,13,11,0,
-30,6,5,35,9,9,9,102,111,114,32,116,116,32,105,110,
+30,6,5,62,9,9,9,102,111,114,32,116,116,32,105,110,
 32,107,46,105,116,101,109,115,58,0,0,0,12,15,0,5,
-105,116,101,109,115,0,0,0,9,11,2,15,11,15,0,0,
-0,0,0,0,0,0,0,0,42,10,11,15,18,0,0,86,
-30,27,5,36,9,9,9,9,115,101,108,102,46,102,114,101,
+105,116,101,109,115,0,0,0,9,11,2,15,11,15,0,1,
+0,0,0,0,0,0,0,0,42,10,11,15,18,0,0,84,
+30,27,5,63,9,9,9,9,115,101,108,102,46,102,114,101,
 101,95,116,109,112,40,115,101,108,102,46,100,111,95,115,101,
 116,95,99,116,120,40,116,116,44,84,111,107,101,110,40,116,
 109,112,46,112,111,115,44,39,103,101,116,39,44,78,111,110,
 101,44,91,116,109,112,44,84,111,107,101,110,40,116,109,112,
 46,112,111,115,44,39,110,117,109,98,101,114,39,44,115,116,
 114,40,110,41,41,93,41,41,41,32,35,82,69,71,0,0,
-12,18,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
-9,17,1,18,12,20,0,10,100,111,95,115,101,116,95,99,
-116,120,0,0,9,19,1,20,15,20,10,0,12,23,0,5,
-84,111,107,101,110,0,0,0,13,22,23,0,12,27,0,3,
-112,111,115,0,9,23,13,27,12,24,0,3,103,101,116,0,
-28,25,0,0,15,27,13,0,12,30,0,5,84,111,107,101,
-110,0,0,0,13,29,30,0,12,33,0,3,112,111,115,0,
-9,30,13,33,12,31,0,6,110,117,109,98,101,114,0,0,
-12,34,0,3,115,116,114,0,13,33,34,0,15,34,9,0,
-31,32,34,1,19,32,33,32,31,28,30,3,19,28,29,28,
-27,26,27,2,31,21,23,4,19,21,22,21,31,18,20,2,
-19,18,19,18,31,16,18,1,19,16,17,16,30,3,5,37,
-9,9,9,9,110,32,43,61,32,49,0,0,11,17,0,0,
-0,0,0,0,0,0,240,63,1,16,9,17,15,9,16,0,
-18,0,255,170,30,5,5,38,9,9,9,115,101,108,102,46,
-102,114,101,101,95,114,101,103,40,114,41,0,12,16,0,8,
-102,114,101,101,95,114,101,103,0,0,0,0,9,15,1,16,
-15,16,14,0,31,11,16,1,19,11,15,11,30,3,5,39,
-9,9,9,114,101,116,117,114,110,0,0,0,28,11,0,0,
-20,11,0,0,18,0,0,1,30,7,5,40,9,9,114,32,
-61,32,115,101,108,102,46,100,111,40,107,46,105,116,101,109,
-115,91,48,93,41,0,0,0,12,16,0,2,100,111,0,0,
-9,15,1,16,12,17,0,5,105,116,101,109,115,0,0,0,
-9,16,2,17,11,17,0,0,0,0,0,0,0,0,0,0,
-9,16,16,17,31,11,16,1,19,11,15,11,15,14,11,0,
-30,5,5,41,9,9,114,114,32,61,32,115,101,108,102,46,
-100,111,40,118,41,0,0,0,12,17,0,2,100,111,0,0,
-9,16,1,17,15,17,3,0,31,15,17,1,19,15,16,15,
-15,11,15,0,30,7,5,42,9,9,116,109,112,32,61,32,
-115,101,108,102,46,100,111,40,107,46,105,116,101,109,115,91,
-49,93,41,0,12,17,0,2,100,111,0,0,9,16,1,17,
-12,18,0,5,105,116,101,109,115,0,0,0,9,17,2,18,
-11,18,0,0,0,0,0,0,0,0,240,63,9,17,17,18,
-31,15,17,1,19,15,16,15,15,13,15,0,30,8,5,43,
-9,9,115,101,108,102,46,100,111,95,99,111,100,101,40,79,
-80,95,83,69,84,44,114,44,116,109,112,44,114,114,41,0,
-12,17,0,7,100,111,95,99,111,100,101,0,9,16,1,17,
-12,21,0,6,79,80,95,83,69,84,0,0,13,17,21,0,
-15,18,14,0,15,19,13,0,15,20,11,0,31,15,17,4,
-19,15,16,15,30,6,5,44,9,9,115,101,108,102,46,102,
-114,101,101,95,116,109,112,40,114,41,32,35,82,69,71,0,
-12,17,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
-9,16,1,17,15,17,14,0,31,15,17,1,19,15,16,15,
-30,7,5,45,9,9,115,101,108,102,46,102,114,101,101,95,
+12,20,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
+49,17,1,20,12,24,0,10,100,111,95,115,101,116,95,99,
+116,120,0,0,49,20,1,24,15,22,10,0,12,25,0,5,
+84,111,107,101,110,0,0,0,13,24,25,0,12,29,0,3,
+112,111,115,0,9,25,13,29,12,26,0,3,103,101,116,0,
+28,27,0,0,15,29,13,0,12,32,0,5,84,111,107,101,
+110,0,0,0,13,31,32,0,12,35,0,3,112,111,115,0,
+9,32,13,35,12,33,0,6,110,117,109,98,101,114,0,0,
+12,36,0,3,115,116,114,0,13,35,36,0,15,36,9,0,
+31,34,36,1,19,34,35,34,31,30,32,3,19,30,31,30,
+27,28,29,2,31,23,25,4,19,23,24,23,50,19,20,2,
+50,16,17,1,30,3,5,64,9,9,9,9,110,32,43,61,
+32,49,0,0,11,17,0,1,1,0,0,0,0,0,0,0,
+1,16,9,17,15,9,16,0,18,0,255,172,30,5,5,65,
+9,9,9,115,101,108,102,46,102,114,101,101,95,114,101,103,
+40,114,41,0,12,18,0,8,102,114,101,101,95,114,101,103,
+0,0,0,0,49,15,1,18,15,17,14,0,50,11,15,1,
+30,3,5,66,9,9,9,114,101,116,117,114,110,0,0,0,
+28,11,0,0,20,11,0,0,18,0,0,1,30,7,5,67,
+9,9,114,32,61,32,115,101,108,102,46,100,111,40,107,46,
+105,116,101,109,115,91,48,93,41,0,0,0,12,18,0,2,
+100,111,0,0,49,15,1,18,12,18,0,5,105,116,101,109,
+115,0,0,0,9,17,2,18,11,18,0,1,0,0,0,0,
+0,0,0,0,9,17,17,18,50,11,15,1,15,14,11,0,
+30,5,5,68,9,9,114,114,32,61,32,115,101,108,102,46,
+100,111,40,118,41,0,0,0,12,19,0,2,100,111,0,0,
+49,16,1,19,15,18,3,0,50,15,16,1,15,11,15,0,
+30,7,5,69,9,9,116,109,112,32,61,32,115,101,108,102,
+46,100,111,40,107,46,105,116,101,109,115,91,49,93,41,0,
+12,19,0,2,100,111,0,0,49,16,1,19,12,19,0,5,
+105,116,101,109,115,0,0,0,9,18,2,19,11,19,0,1,
+1,0,0,0,0,0,0,0,9,18,18,19,50,15,16,1,
+15,13,15,0,30,8,5,70,9,9,115,101,108,102,46,100,
+111,95,99,111,100,101,40,79,80,95,83,69,84,44,114,44,
+116,109,112,44,114,114,41,0,12,22,0,7,100,111,95,99,
+111,100,101,0,49,16,1,22,12,22,0,6,79,80,95,83,
+69,84,0,0,13,18,22,0,15,19,14,0,15,20,13,0,
+15,21,11,0,50,15,16,4,30,6,5,71,9,9,115,101,
+108,102,46,102,114,101,101,95,116,109,112,40,114,41,32,35,
+82,69,71,0,12,19,0,8,102,114,101,101,95,116,109,112,
+0,0,0,0,49,16,1,19,15,18,14,0,50,15,16,1,
+30,7,5,72,9,9,115,101,108,102,46,102,114,101,101,95,
 116,109,112,40,116,109,112,41,32,35,82,69,71,0,0,0,
-12,17,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
-9,16,1,17,15,17,13,0,31,15,17,1,19,15,16,15,
-30,3,5,46,9,9,114,101,116,117,114,110,32,114,114,0,
-20,11,0,0,0,0,0,0,12,109,0,10,100,111,95,115,
-101,116,95,99,116,120,0,0,10,7,109,108,16,109,1,20,
-44,20,0,0,30,10,5,49,9,100,101,102,32,109,97,110,
-97,103,101,95,115,101,113,40,115,101,108,102,44,105,44,97,
-44,105,116,101,109,115,44,115,97,118,61,48,41,58,0,0,
-12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
-33,1,0,0,12,1,0,10,109,97,110,97,103,101,95,115,
-101,113,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,3,0,0,9,2,0,3,28,4,0,0,9,3,0,4,
-28,5,0,0,9,4,0,5,11,5,0,0,0,0,0,0,
-0,0,0,0,28,6,0,0,32,5,0,6,30,7,5,50,
-9,9,108,32,61,32,109,97,120,40,115,97,118,44,108,101,
-110,40,105,116,101,109,115,41,41,0,0,0,12,9,0,3,
-109,97,120,0,13,8,9,0,15,9,5,0,12,12,0,3,
-108,101,110,0,13,11,12,0,15,12,4,0,31,10,12,1,
-19,10,11,10,31,7,9,2,19,7,8,7,15,6,7,0,
-30,8,5,51,9,9,110,44,116,109,112,115,32,61,32,48,
-44,115,101,108,102,46,103,101,116,95,116,109,112,115,40,108,
-41,0,0,0,11,8,0,0,0,0,0,0,0,0,0,0,
-15,7,8,0,12,11,0,8,103,101,116,95,116,109,112,115,
-0,0,0,0,9,10,1,11,15,11,6,0,31,9,11,1,
-19,9,10,9,15,8,9,0,15,9,7,0,15,7,8,0,
-30,5,5,52,9,9,102,111,114,32,116,116,32,105,110,32,
-105,116,101,109,115,58,0,0,11,10,0,0,0,0,0,0,
-0,0,0,0,42,8,4,10,18,0,0,78,30,4,5,53,
-9,9,9,114,32,61,32,116,109,112,115,91,110,93,0,0,
-9,12,7,9,15,11,12,0,30,6,5,54,9,9,9,98,
-32,61,32,115,101,108,102,46,100,111,40,116,116,44,114,41,
-0,0,0,0,12,15,0,2,100,111,0,0,9,14,1,15,
-15,15,8,0,15,16,11,0,31,13,15,2,19,13,14,13,
-15,12,13,0,30,4,5,55,9,9,9,105,102,32,114,32,
-33,61,32,98,58,0,0,0,35,13,11,12,21,13,0,0,
-18,0,0,38,30,8,5,56,9,9,9,9,115,101,108,102,
-46,100,111,95,99,111,100,101,40,79,80,95,77,79,86,69,
-44,114,44,98,41,0,0,0,12,15,0,7,100,111,95,99,
-111,100,101,0,9,14,1,15,12,18,0,7,79,80,95,77,
-79,86,69,0,13,15,18,0,15,16,11,0,15,17,12,0,
-31,13,15,3,19,13,14,13,30,6,5,57,9,9,9,9,
+12,19,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
+49,16,1,19,15,18,13,0,50,15,16,1,30,3,5,73,
+9,9,114,101,116,117,114,110,32,114,114,0,20,11,0,0,
+0,0,0,0,12,111,0,10,100,111,95,115,101,116,95,99,
+116,120,0,0,10,8,111,110,16,111,1,13,44,21,0,0,
+30,10,5,76,9,100,101,102,32,109,97,110,97,103,101,95,
+115,101,113,40,115,101,108,102,44,105,44,97,44,105,116,101,
+109,115,44,115,97,118,61,48,41,58,0,0,12,1,0,9,
+116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
+12,1,0,10,109,97,110,97,103,101,95,115,101,113,0,0,
+34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
+9,2,0,3,28,4,0,0,9,3,0,4,28,5,0,0,
+9,4,0,5,11,5,0,1,0,0,0,0,0,0,0,0,
+28,6,0,0,32,5,0,6,30,7,5,77,9,9,108,32,
+61,32,109,97,120,40,115,97,118,44,108,101,110,40,105,116,
+101,109,115,41,41,0,0,0,12,9,0,3,109,97,120,0,
+13,8,9,0,15,9,5,0,12,12,0,3,108,101,110,0,
+13,11,12,0,15,12,4,0,31,10,12,1,19,10,11,10,
+31,7,9,2,19,7,8,7,15,6,7,0,30,8,5,78,
+9,9,110,44,116,109,112,115,32,61,32,48,44,115,101,108,
+102,46,103,101,116,95,116,109,112,115,40,108,41,0,0,0,
+11,8,0,1,0,0,0,0,0,0,0,0,15,7,8,0,
+12,13,0,8,103,101,116,95,116,109,112,115,0,0,0,0,
+49,10,1,13,15,12,6,0,50,9,10,1,15,8,9,0,
+15,9,7,0,15,7,8,0,30,5,5,79,9,9,102,111,
+114,32,116,116,32,105,110,32,105,116,101,109,115,58,0,0,
+11,10,0,1,0,0,0,0,0,0,0,0,42,8,4,10,
+18,0,0,75,30,4,5,80,9,9,9,114,32,61,32,116,
+109,112,115,91,110,93,0,0,9,12,7,9,15,11,12,0,
+30,6,5,81,9,9,9,98,32,61,32,115,101,108,102,46,
+100,111,40,116,116,44,114,41,0,0,0,0,12,18,0,2,
+100,111,0,0,49,14,1,18,15,16,8,0,15,17,11,0,
+50,13,14,2,15,12,13,0,30,4,5,82,9,9,9,105,
+102,32,114,32,33,61,32,98,58,0,0,0,35,13,11,12,
+21,13,0,0,18,0,0,36,30,8,5,83,9,9,9,9,
+115,101,108,102,46,100,111,95,99,111,100,101,40,79,80,95,
+77,79,86,69,44,114,44,98,41,0,0,0,12,19,0,7,
+100,111,95,99,111,100,101,0,49,14,1,19,12,19,0,7,
+79,80,95,77,79,86,69,0,13,16,19,0,15,17,11,0,
+15,18,12,0,50,13,14,3,30,6,5,84,9,9,9,9,
 115,101,108,102,46,102,114,101,101,95,116,109,112,40,98,41,
-0,0,0,0,12,15,0,8,102,114,101,101,95,116,109,112,
-0,0,0,0,9,14,1,15,15,15,12,0,31,13,15,1,
-19,13,14,13,18,0,0,1,30,3,5,58,9,9,9,110,
-32,43,61,49,0,0,0,0,11,14,0,0,0,0,0,0,
-0,0,240,63,1,13,9,14,15,9,13,0,18,0,255,178,
-30,5,5,59,9,9,105,102,32,110,111,116,32,108,101,110,
-40,116,109,112,115,41,58,0,12,15,0,3,108,101,110,0,
-13,14,15,0,15,15,7,0,31,13,15,1,19,13,14,13,
-47,10,13,0,21,10,0,0,18,0,0,32,30,7,5,60,
-9,9,9,115,101,108,102,46,100,111,95,99,111,100,101,40,
-105,44,97,44,48,44,48,41,0,0,0,0,12,14,0,7,
-100,111,95,99,111,100,101,0,9,13,1,14,15,14,2,0,
-15,15,3,0,11,16,0,0,0,0,0,0,0,0,0,0,
-11,17,0,0,0,0,0,0,0,0,0,0,31,10,14,4,
-19,10,13,10,30,3,5,61,9,9,9,114,101,116,117,114,
-110,32,48,0,11,10,0,0,0,0,0,0,0,0,0,0,
-20,10,0,0,18,0,0,1,30,10,5,62,9,9,115,101,
-108,102,46,100,111,95,99,111,100,101,40,105,44,97,44,116,
-109,112,115,91,48,93,44,108,101,110,40,105,116,101,109,115,
-41,41,0,0,12,14,0,7,100,111,95,99,111,100,101,0,
-9,13,1,14,15,14,2,0,15,15,3,0,11,18,0,0,
-0,0,0,0,0,0,0,0,9,16,7,18,12,19,0,3,
-108,101,110,0,13,18,19,0,15,19,4,0,31,17,19,1,
-19,17,18,17,31,10,14,4,19,10,13,10,30,8,5,63,
-9,9,115,101,108,102,46,102,114,101,101,95,116,109,112,115,
-40,116,109,112,115,91,115,97,118,58,93,41,0,0,0,0,
-12,14,0,9,102,114,101,101,95,116,109,112,115,0,0,0,
-9,13,1,14,15,16,5,0,28,17,0,0,27,15,16,2,
-9,14,7,15,31,10,14,1,19,10,13,10,30,5,5,64,
+0,0,0,0,12,17,0,8,102,114,101,101,95,116,109,112,
+0,0,0,0,49,14,1,17,15,16,12,0,50,13,14,1,
+18,0,0,1,30,3,5,85,9,9,9,110,32,43,61,49,
+0,0,0,0,11,14,0,1,1,0,0,0,0,0,0,0,
+1,13,9,14,15,9,13,0,18,0,255,181,30,5,5,86,
+9,9,105,102,32,110,111,116,32,108,101,110,40,116,109,112,
+115,41,58,0,12,15,0,3,108,101,110,0,13,14,15,0,
+15,15,7,0,31,13,15,1,19,13,14,13,47,10,13,0,
+21,10,0,0,18,0,0,31,30,7,5,87,9,9,9,115,
+101,108,102,46,100,111,95,99,111,100,101,40,105,44,97,44,
+48,44,48,41,0,0,0,0,12,19,0,7,100,111,95,99,
+111,100,101,0,49,13,1,19,15,15,2,0,15,16,3,0,
+11,17,0,1,0,0,0,0,0,0,0,0,11,18,0,1,
+0,0,0,0,0,0,0,0,50,10,13,4,30,3,5,88,
+9,9,9,114,101,116,117,114,110,32,48,0,11,10,0,1,
+0,0,0,0,0,0,0,0,20,10,0,0,18,0,0,1,
+30,10,5,89,9,9,115,101,108,102,46,100,111,95,99,111,
+100,101,40,105,44,97,44,116,109,112,115,91,48,93,44,108,
+101,110,40,105,116,101,109,115,41,41,0,0,12,19,0,7,
+100,111,95,99,111,100,101,0,49,13,1,19,15,15,2,0,
+15,16,3,0,11,19,0,1,0,0,0,0,0,0,0,0,
+9,17,7,19,12,20,0,3,108,101,110,0,13,19,20,0,
+15,20,4,0,31,18,20,1,19,18,19,18,50,10,13,4,
+30,8,5,90,9,9,115,101,108,102,46,102,114,101,101,95,
+116,109,112,115,40,116,109,112,115,91,115,97,118,58,93,41,
+0,0,0,0,12,16,0,9,102,114,101,101,95,116,109,112,
+115,0,0,0,49,13,1,16,15,17,5,0,28,18,0,0,
+27,16,17,2,9,15,7,16,50,10,13,1,30,5,5,91,
 9,9,114,101,116,117,114,110,32,116,109,112,115,91,48,93,
-0,0,0,0,11,13,0,0,0,0,0,0,0,0,0,0,
-9,10,7,13,20,10,0,0,0,0,0,0,12,110,0,10,
-109,97,110,97,103,101,95,115,101,113,0,0,10,7,110,109,
-16,110,0,168,44,13,0,0,30,7,5,67,9,100,101,102,
+0,0,0,0,11,13,0,1,0,0,0,0,0,0,0,0,
+9,10,7,13,20,10,0,0,0,0,0,0,12,112,0,10,
+109,97,110,97,103,101,95,115,101,113,0,0,10,8,112,111,
+16,112,0,166,44,14,0,0,30,7,5,94,9,100,101,102,
 32,112,95,102,105,108,116,101,114,40,115,101,108,102,44,105,
 116,101,109,115,41,58,0,0,12,1,0,9,116,105,110,121,
 112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,8,
 112,95,102,105,108,116,101,114,0,0,0,0,34,1,0,0,
 28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-30,7,5,68,9,9,97,44,98,44,99,44,100,32,61,32,
+30,7,5,95,9,9,97,44,98,44,99,44,100,32,61,32,
 91,93,44,91,93,44,78,111,110,101,44,78,111,110,101,0,
 27,4,0,0,15,3,4,0,27,5,0,0,15,4,5,0,
 28,6,0,0,15,5,6,0,28,7,0,0,15,6,7,0,
 15,7,3,0,15,3,4,0,15,4,5,0,15,5,6,0,
-30,5,5,69,9,9,102,111,114,32,116,32,105,110,32,105,
-116,101,109,115,58,0,0,0,11,8,0,0,0,0,0,0,
-0,0,0,0,42,6,2,8,18,0,0,101,30,14,5,70,
+30,5,5,96,9,9,102,111,114,32,116,32,105,110,32,105,
+116,101,109,115,58,0,0,0,11,8,0,1,0,0,0,0,
+0,0,0,0,42,6,2,8,18,0,0,99,30,14,5,97,
 9,9,9,105,102,32,116,46,116,121,112,101,32,61,61,32,
 39,115,121,109,98,111,108,39,32,97,110,100,32,116,46,118,
 97,108,32,61,61,32,39,61,39,58,32,98,46,97,112,112,
@@ -5639,738 +5653,810 @@ unsigned char py_tinypy[] = {
 0,0,0,0,9,9,6,10,12,10,0,6,115,121,109,98,
 111,108,0,0,23,9,9,10,21,9,0,0,18,0,0,7,
 12,10,0,3,118,97,108,0,9,9,6,10,12,10,0,1,
-61,0,0,0,23,9,9,10,21,9,0,0,18,0,0,9,
-12,11,0,6,97,112,112,101,110,100,0,0,9,10,3,11,
-15,11,6,0,31,9,11,1,19,9,10,9,18,0,0,59,
-30,8,5,71,9,9,9,101,108,105,102,32,116,46,116,121,
-112,101,32,61,61,32,39,97,114,103,115,39,58,32,99,32,
-61,32,116,0,12,10,0,4,116,121,112,101,0,0,0,0,
-9,9,6,10,12,10,0,4,97,114,103,115,0,0,0,0,
-23,9,9,10,21,9,0,0,18,0,0,3,15,4,6,0,
-18,0,0,38,30,9,5,72,9,9,9,101,108,105,102,32,
-116,46,116,121,112,101,32,61,61,32,39,110,97,114,103,115,
-39,58,32,100,32,61,32,116,0,0,0,0,12,10,0,4,
-116,121,112,101,0,0,0,0,9,9,6,10,12,10,0,5,
-110,97,114,103,115,0,0,0,23,9,9,10,21,9,0,0,
-18,0,0,3,15,5,6,0,18,0,0,16,30,6,5,73,
-9,9,9,101,108,115,101,58,32,97,46,97,112,112,101,110,
-100,40,116,41,0,0,0,0,12,11,0,6,97,112,112,101,
-110,100,0,0,9,10,7,11,15,11,6,0,31,9,11,1,
-19,9,10,9,18,0,0,1,18,0,255,155,30,5,5,74,
-9,9,114,101,116,117,114,110,32,97,44,98,44,99,44,100,
-0,0,0,0,15,9,7,0,15,10,3,0,15,11,4,0,
-15,12,5,0,27,8,9,4,20,8,0,0,0,0,0,0,
-12,111,0,8,112,95,102,105,108,116,101,114,0,0,0,0,
-10,7,111,110,16,111,0,65,44,5,0,0,30,6,5,78,
-9,100,101,102,32,105,115,95,116,109,112,40,115,101,108,102,
-44,114,41,58,0,0,0,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,6,
-105,115,95,116,109,112,0,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,30,8,5,79,
-9,9,105,102,32,114,32,105,115,32,78,111,110,101,58,32,
-114,101,116,117,114,110,32,70,97,108,115,101,0,0,0,0,
-28,4,0,0,23,3,2,4,21,3,0,0,18,0,0,6,
-11,3,0,0,0,0,0,0,0,0,0,0,20,3,0,0,
-18,0,0,1,30,8,5,80,9,9,114,101,116,117,114,110,
-32,40,68,46,114,50,110,91,114,93,91,48,93,32,61,61,
-32,39,36,39,41,0,0,0,12,4,0,1,68,0,0,0,
-13,3,4,0,12,4,0,3,114,50,110,0,9,3,3,4,
-9,3,3,2,11,4,0,0,0,0,0,0,0,0,0,0,
-9,3,3,4,12,4,0,1,36,0,0,0,23,3,3,4,
-20,3,0,0,0,0,0,0,12,112,0,6,105,115,95,116,
-109,112,0,0,10,7,112,111,16,112,0,67,44,8,0,0,
-30,6,5,83,9,100,101,102,32,117,110,95,116,109,112,40,
-115,101,108,102,44,114,41,58,0,0,0,0,12,1,0,9,
-116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,6,117,110,95,116,109,112,0,0,34,1,0,0,
-28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-30,4,5,84,9,9,110,32,61,32,68,46,114,50,110,91,
-114,93,0,0,12,5,0,1,68,0,0,0,13,4,5,0,
-12,5,0,3,114,50,110,0,9,4,4,5,9,4,4,2,
-15,3,4,0,30,5,5,85,9,9,115,101,108,102,46,102,
-114,101,101,95,114,101,103,40,114,41,0,0,12,6,0,8,
-102,114,101,101,95,114,101,103,0,0,0,0,9,5,1,6,
-15,6,2,0,31,4,6,1,19,4,5,4,30,6,5,86,
-9,9,115,101,108,102,46,115,101,116,95,114,101,103,40,114,
-44,39,42,39,43,110,41,0,12,6,0,7,115,101,116,95,
-114,101,103,0,9,5,1,6,15,6,2,0,12,7,0,1,
-42,0,0,0,1,7,7,3,31,4,6,2,19,4,5,4,
-0,0,0,0,12,113,0,6,117,110,95,116,109,112,0,0,
-10,7,113,112,16,113,0,58,44,6,0,0,30,6,5,89,
+61,0,0,0,23,9,9,10,21,9,0,0,18,0,0,8,
+12,13,0,6,97,112,112,101,110,100,0,0,49,10,3,13,
+15,12,6,0,50,9,10,1,18,0,0,58,30,8,5,98,
+9,9,9,101,108,105,102,32,116,46,116,121,112,101,32,61,
+61,32,39,97,114,103,115,39,58,32,99,32,61,32,116,0,
+12,10,0,4,116,121,112,101,0,0,0,0,9,9,6,10,
+12,10,0,4,97,114,103,115,0,0,0,0,23,9,9,10,
+21,9,0,0,18,0,0,3,15,4,6,0,18,0,0,37,
+30,9,5,99,9,9,9,101,108,105,102,32,116,46,116,121,
+112,101,32,61,61,32,39,110,97,114,103,115,39,58,32,100,
+32,61,32,116,0,0,0,0,12,10,0,4,116,121,112,101,
+0,0,0,0,9,9,6,10,12,10,0,5,110,97,114,103,
+115,0,0,0,23,9,9,10,21,9,0,0,18,0,0,3,
+15,5,6,0,18,0,0,15,30,6,5,100,9,9,9,101,
+108,115,101,58,32,97,46,97,112,112,101,110,100,40,116,41,
+0,0,0,0,12,13,0,6,97,112,112,101,110,100,0,0,
+49,10,7,13,15,12,6,0,50,9,10,1,18,0,0,1,
+18,0,255,157,30,5,5,101,9,9,114,101,116,117,114,110,
+32,97,44,98,44,99,44,100,0,0,0,0,15,9,7,0,
+15,10,3,0,15,11,4,0,15,12,5,0,27,8,9,4,
+20,8,0,0,0,0,0,0,12,113,0,8,112,95,102,105,
+108,116,101,114,0,0,0,0,10,8,113,112,16,113,0,65,
+44,5,0,0,30,6,5,105,9,100,101,102,32,105,115,95,
+116,109,112,40,115,101,108,102,44,114,41,58,0,0,0,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,6,105,115,95,116,109,112,0,0,
+34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
+9,2,0,3,30,8,5,106,9,9,105,102,32,114,32,105,
+115,32,78,111,110,101,58,32,114,101,116,117,114,110,32,70,
+97,108,115,101,0,0,0,0,28,4,0,0,23,3,2,4,
+21,3,0,0,18,0,0,6,11,3,0,1,0,0,0,0,
+0,0,0,0,20,3,0,0,18,0,0,1,30,8,5,107,
+9,9,114,101,116,117,114,110,32,40,68,46,114,50,110,91,
+114,93,91,48,93,32,61,61,32,39,36,39,41,0,0,0,
+12,4,0,1,68,0,0,0,13,3,4,0,12,4,0,3,
+114,50,110,0,9,3,3,4,9,3,3,2,11,4,0,1,
+0,0,0,0,0,0,0,0,9,3,3,4,12,4,0,1,
+36,0,0,0,23,3,3,4,20,3,0,0,0,0,0,0,
+12,114,0,6,105,115,95,116,109,112,0,0,10,8,114,113,
+16,114,0,65,44,10,0,0,30,6,5,110,9,100,101,102,
+32,117,110,95,116,109,112,40,115,101,108,102,44,114,41,58,
+0,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
+121,0,0,0,33,1,0,0,12,1,0,6,117,110,95,116,
+109,112,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
+28,3,0,0,9,2,0,3,30,4,5,111,9,9,110,32,
+61,32,68,46,114,50,110,91,114,93,0,0,12,5,0,1,
+68,0,0,0,13,4,5,0,12,5,0,3,114,50,110,0,
+9,4,4,5,9,4,4,2,15,3,4,0,30,5,5,112,
+9,9,115,101,108,102,46,102,114,101,101,95,114,101,103,40,
+114,41,0,0,12,8,0,8,102,114,101,101,95,114,101,103,
+0,0,0,0,49,5,1,8,15,7,2,0,50,4,5,1,
+30,6,5,113,9,9,115,101,108,102,46,115,101,116,95,114,
+101,103,40,114,44,39,42,39,43,110,41,0,12,9,0,7,
+115,101,116,95,114,101,103,0,49,5,1,9,15,7,2,0,
+12,8,0,1,42,0,0,0,1,8,8,3,50,4,5,2,
+0,0,0,0,12,115,0,6,117,110,95,116,109,112,0,0,
+10,8,115,114,16,115,0,56,44,8,0,0,30,6,5,116,
 9,100,101,102,32,102,114,101,101,95,116,109,112,40,115,101,
 108,102,44,114,41,58,0,0,12,1,0,9,116,105,110,121,
 112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,8,
 102,114,101,101,95,116,109,112,0,0,0,0,34,1,0,0,
 28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-30,10,5,90,9,9,105,102,32,115,101,108,102,46,105,115,
+30,10,5,117,9,9,105,102,32,115,101,108,102,46,105,115,
 95,116,109,112,40,114,41,58,32,115,101,108,102,46,102,114,
-101,101,95,114,101,103,40,114,41,0,0,0,12,5,0,6,
-105,115,95,116,109,112,0,0,9,4,1,5,15,5,2,0,
-31,3,5,1,19,3,4,3,21,3,0,0,18,0,0,10,
-12,5,0,8,102,114,101,101,95,114,101,103,0,0,0,0,
-9,4,1,5,15,5,2,0,31,3,5,1,19,3,4,3,
-18,0,0,1,30,3,5,91,9,9,114,101,116,117,114,110,
-32,114,0,0,20,2,0,0,0,0,0,0,12,114,0,8,
-102,114,101,101,95,116,109,112,0,0,0,0,10,7,114,113,
-16,114,0,47,44,8,0,0,30,6,5,94,9,100,101,102,
-32,102,114,101,101,95,116,109,112,115,40,115,101,108,102,44,
-114,41,58,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,9,102,114,101,101,
-95,116,109,112,115,0,0,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,30,8,5,95,
-9,9,102,111,114,32,107,32,105,110,32,114,58,32,115,101,
-108,102,46,102,114,101,101,95,116,109,112,40,107,41,0,0,
-11,4,0,0,0,0,0,0,0,0,0,0,42,3,2,4,
-18,0,0,10,12,7,0,8,102,114,101,101,95,116,109,112,
-0,0,0,0,9,6,1,7,15,7,3,0,31,5,7,1,
-19,5,6,5,18,0,255,246,0,0,0,0,12,115,0,9,
-102,114,101,101,95,116,109,112,115,0,0,0,10,7,115,114,
-16,115,0,84,44,9,0,0,30,6,5,98,9,100,101,102,
-32,103,101,116,95,114,101,103,40,115,101,108,102,44,110,41,
-58,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,7,103,101,116,95,
-114,101,103,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,3,0,0,9,2,0,3,30,6,5,99,9,9,105,102,
-32,110,32,110,111,116,32,105,110,32,68,46,110,50,114,58,
-0,0,0,0,12,4,0,1,68,0,0,0,13,3,4,0,
-12,4,0,3,110,50,114,0,9,3,3,4,36,3,3,2,
-11,4,0,0,0,0,0,0,0,0,0,0,23,3,3,4,
-21,3,0,0,18,0,0,28,30,9,5,100,9,9,9,115,
-101,108,102,46,115,101,116,95,114,101,103,40,115,101,108,102,
-46,97,108,108,111,99,40,49,41,44,110,41,0,0,0,0,
-12,5,0,7,115,101,116,95,114,101,103,0,9,4,1,5,
-12,8,0,5,97,108,108,111,99,0,0,0,9,7,1,8,
-11,8,0,0,0,0,0,0,0,0,240,63,31,5,8,1,
-19,5,7,5,15,6,2,0,31,3,5,2,19,3,4,3,
-18,0,0,1,30,5,5,101,9,9,114,101,116,117,114,110,
-32,68,46,110,50,114,91,110,93,0,0,0,12,4,0,1,
-68,0,0,0,13,3,4,0,12,4,0,3,110,50,114,0,
-9,3,3,4,9,3,3,2,20,3,0,0,0,0,0,0,
-12,116,0,7,103,101,116,95,114,101,103,0,10,7,116,115,
-16,116,0,80,44,10,0,0,30,6,5,104,9,100,101,102,
-32,115,101,116,95,114,101,103,40,115,101,108,102,44,114,44,
-110,41,58,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,7,115,101,116,95,
-114,101,103,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,3,0,0,9,2,0,3,28,4,0,0,9,3,0,4,
-30,4,5,105,9,9,68,46,110,50,114,91,110,93,32,61,
-32,114,0,0,12,5,0,1,68,0,0,0,13,4,5,0,
-12,5,0,3,110,50,114,0,9,4,4,5,10,4,3,2,
-30,4,5,106,9,9,68,46,114,50,110,91,114,93,32,61,
-32,110,0,0,12,5,0,1,68,0,0,0,13,4,5,0,
-12,5,0,3,114,50,110,0,9,4,4,5,10,4,2,3,
-30,7,5,107,9,9,68,46,109,114,101,103,32,61,32,109,
-97,120,40,68,46,109,114,101,103,44,114,43,49,41,0,0,
-12,5,0,1,68,0,0,0,13,4,5,0,12,7,0,3,
-109,97,120,0,13,6,7,0,12,9,0,1,68,0,0,0,
-13,7,9,0,12,9,0,4,109,114,101,103,0,0,0,0,
-9,7,7,9,11,9,0,0,0,0,0,0,0,0,240,63,
-1,8,2,9,31,5,7,2,19,5,6,5,12,6,0,4,
-109,114,101,103,0,0,0,0,10,4,6,5,0,0,0,0,
-12,117,0,7,115,101,116,95,114,101,103,0,10,7,117,116,
-16,117,0,96,44,6,0,0,30,6,5,110,9,100,101,102,
-32,102,114,101,101,95,114,101,103,40,115,101,108,102,44,114,
-41,58,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
-121,0,0,0,33,1,0,0,12,1,0,8,102,114,101,101,
-95,114,101,103,0,0,0,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,30,9,5,111,
-9,9,105,102,32,115,101,108,102,46,105,115,95,116,109,112,
-40,114,41,58,32,68,46,116,109,112,99,32,45,61,32,49,
-0,0,0,0,12,5,0,6,105,115,95,116,109,112,0,0,
-9,4,1,5,15,5,2,0,31,3,5,1,19,3,4,3,
-21,3,0,0,18,0,0,20,12,4,0,1,68,0,0,0,
-13,3,4,0,12,5,0,1,68,0,0,0,13,4,5,0,
-12,5,0,4,116,109,112,99,0,0,0,0,9,4,4,5,
-11,5,0,0,0,0,0,0,0,0,240,63,2,4,4,5,
-12,5,0,4,116,109,112,99,0,0,0,0,10,3,5,4,
-18,0,0,1,30,11,5,112,9,9,110,32,61,32,68,46,
-114,50,110,91,114,93,59,32,100,101,108,32,68,46,114,50,
-110,91,114,93,59,32,100,101,108,32,68,46,110,50,114,91,
-110,93,0,0,12,5,0,1,68,0,0,0,13,4,5,0,
-12,5,0,3,114,50,110,0,9,4,4,5,9,4,4,2,
-15,3,4,0,12,5,0,1,68,0,0,0,13,4,5,0,
-12,5,0,3,114,50,110,0,9,4,4,5,43,4,2,0,
-12,5,0,1,68,0,0,0,13,4,5,0,12,5,0,3,
-110,50,114,0,9,4,4,5,43,4,3,0,0,0,0,0,
-12,118,0,8,102,114,101,101,95,114,101,103,0,0,0,0,
-10,7,118,117,16,118,0,103,44,15,0,0,30,8,5,115,
-9,100,101,102,32,105,109,97,110,97,103,101,40,115,101,108,
-102,44,111,114,105,103,44,102,110,99,41,58,0,0,0,0,
+101,101,95,114,101,103,40,114,41,0,0,0,12,7,0,6,
+105,115,95,116,109,112,0,0,49,4,1,7,15,6,2,0,
+50,3,4,1,21,3,0,0,18,0,0,9,12,7,0,8,
+102,114,101,101,95,114,101,103,0,0,0,0,49,4,1,7,
+15,6,2,0,50,3,4,1,18,0,0,1,30,3,5,118,
+9,9,114,101,116,117,114,110,32,114,0,0,20,2,0,0,
+0,0,0,0,12,116,0,8,102,114,101,101,95,116,109,112,
+0,0,0,0,10,8,116,115,16,116,0,46,44,10,0,0,
+30,6,5,121,9,100,101,102,32,102,114,101,101,95,116,109,
+112,115,40,115,101,108,102,44,114,41,58,0,12,1,0,9,
+116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
+12,1,0,9,102,114,101,101,95,116,109,112,115,0,0,0,
+34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
+9,2,0,3,30,8,5,122,9,9,102,111,114,32,107,32,
+105,110,32,114,58,32,115,101,108,102,46,102,114,101,101,95,
+116,109,112,40,107,41,0,0,11,4,0,1,0,0,0,0,
+0,0,0,0,42,3,2,4,18,0,0,9,12,9,0,8,
+102,114,101,101,95,116,109,112,0,0,0,0,49,6,1,9,
+15,8,3,0,50,5,6,1,18,0,255,247,0,0,0,0,
+12,117,0,9,102,114,101,101,95,116,109,112,115,0,0,0,
+10,8,117,116,16,117,0,82,44,12,0,0,30,6,5,125,
+9,100,101,102,32,103,101,116,95,114,101,103,40,115,101,108,
+102,44,110,41,58,0,0,0,12,1,0,9,116,105,110,121,
+112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,7,
+103,101,116,95,114,101,103,0,34,1,0,0,28,2,0,0,
+9,1,0,2,28,3,0,0,9,2,0,3,30,6,5,126,
+9,9,105,102,32,110,32,110,111,116,32,105,110,32,68,46,
+110,50,114,58,0,0,0,0,12,4,0,1,68,0,0,0,
+13,3,4,0,12,4,0,3,110,50,114,0,9,3,3,4,
+36,3,3,2,11,4,0,1,0,0,0,0,0,0,0,0,
+23,3,3,4,21,3,0,0,18,0,0,26,30,9,5,127,
+9,9,9,115,101,108,102,46,115,101,116,95,114,101,103,40,
+115,101,108,102,46,97,108,108,111,99,40,49,41,44,110,41,
+0,0,0,0,12,8,0,7,115,101,116,95,114,101,103,0,
+49,4,1,8,12,11,0,5,97,108,108,111,99,0,0,0,
+49,8,1,11,11,10,0,1,1,0,0,0,0,0,0,0,
+50,6,8,1,15,7,2,0,50,3,4,2,18,0,0,1,
+30,5,5,128,9,9,114,101,116,117,114,110,32,68,46,110,
+50,114,91,110,93,0,0,0,12,4,0,1,68,0,0,0,
+13,3,4,0,12,4,0,3,110,50,114,0,9,3,3,4,
+9,3,3,2,20,3,0,0,0,0,0,0,12,118,0,7,
+103,101,116,95,114,101,103,0,10,8,118,117,16,118,0,80,
+44,10,0,0,30,6,5,131,9,100,101,102,32,115,101,116,
+95,114,101,103,40,115,101,108,102,44,114,44,110,41,58,0,
 12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
-33,1,0,0,12,1,0,7,105,109,97,110,97,103,101,0,
+33,1,0,0,12,1,0,7,115,101,116,95,114,101,103,0,
 34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,28,4,0,0,9,3,0,4,30,6,5,116,
-9,9,105,116,101,109,115,32,61,32,111,114,105,103,46,105,
-116,101,109,115,0,0,0,0,12,6,0,5,105,116,101,109,
-115,0,0,0,9,5,2,6,15,4,5,0,30,7,5,117,
-9,9,111,114,105,103,46,118,97,108,32,61,32,111,114,105,
-103,46,118,97,108,91,58,45,49,93,0,0,12,6,0,3,
-118,97,108,0,9,5,2,6,28,7,0,0,11,8,0,0,
-0,0,0,0,0,0,240,191,27,6,7,2,9,5,5,6,
-12,6,0,3,118,97,108,0,10,2,6,5,30,13,5,118,
-9,9,116,32,61,32,84,111,107,101,110,40,111,114,105,103,
-46,112,111,115,44,39,115,121,109,98,111,108,39,44,39,61,
-39,44,91,105,116,101,109,115,91,48,93,44,111,114,105,103,
-93,41,0,0,12,8,0,5,84,111,107,101,110,0,0,0,
-13,7,8,0,12,12,0,3,112,111,115,0,9,8,2,12,
-12,9,0,6,115,121,109,98,111,108,0,0,12,10,0,1,
-61,0,0,0,11,14,0,0,0,0,0,0,0,0,0,0,
-9,12,4,14,15,13,2,0,27,11,12,2,31,6,8,4,
-19,6,7,6,15,5,6,0,30,4,5,119,9,9,114,101,
-116,117,114,110,32,102,110,99,40,116,41,0,15,7,5,0,
-31,6,7,1,19,6,3,6,20,6,0,0,0,0,0,0,
-12,119,0,7,105,109,97,110,97,103,101,0,10,7,119,118,
-16,119,0,100,44,11,0,0,30,8,5,122,9,100,101,102,
-32,117,110,97,114,121,40,115,101,108,102,44,105,44,116,98,
-44,114,61,78,111,110,101,41,58,0,0,0,12,1,0,9,
-116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,5,117,110,97,114,121,0,0,0,34,1,0,0,
-28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-28,4,0,0,9,3,0,4,28,4,0,0,28,5,0,0,
-32,4,0,5,30,6,5,123,9,9,114,32,61,32,115,101,
-108,102,46,103,101,116,95,116,109,112,40,114,41,0,0,0,
-12,7,0,7,103,101,116,95,116,109,112,0,9,6,1,7,
-15,7,4,0,31,5,7,1,19,5,6,5,15,4,5,0,
-30,5,5,124,9,9,98,32,61,32,115,101,108,102,46,100,
-111,40,116,98,41,0,0,0,12,8,0,2,100,111,0,0,
-9,7,1,8,15,8,3,0,31,6,8,1,19,6,7,6,
-15,5,6,0,30,6,5,125,9,9,115,101,108,102,46,100,
+9,2,0,3,28,4,0,0,9,3,0,4,30,4,5,132,
+9,9,68,46,110,50,114,91,110,93,32,61,32,114,0,0,
+12,5,0,1,68,0,0,0,13,4,5,0,12,5,0,3,
+110,50,114,0,9,4,4,5,10,4,3,2,30,4,5,133,
+9,9,68,46,114,50,110,91,114,93,32,61,32,110,0,0,
+12,5,0,1,68,0,0,0,13,4,5,0,12,5,0,3,
+114,50,110,0,9,4,4,5,10,4,2,3,30,7,5,134,
+9,9,68,46,109,114,101,103,32,61,32,109,97,120,40,68,
+46,109,114,101,103,44,114,43,49,41,0,0,12,5,0,1,
+68,0,0,0,13,4,5,0,12,7,0,3,109,97,120,0,
+13,6,7,0,12,9,0,1,68,0,0,0,13,7,9,0,
+12,9,0,4,109,114,101,103,0,0,0,0,9,7,7,9,
+11,9,0,1,1,0,0,0,0,0,0,0,1,8,2,9,
+31,5,7,2,19,5,6,5,12,6,0,4,109,114,101,103,
+0,0,0,0,10,4,6,5,0,0,0,0,12,119,0,7,
+115,101,116,95,114,101,103,0,10,8,119,118,16,119,0,95,
+44,8,0,0,30,6,5,137,9,100,101,102,32,102,114,101,
+101,95,114,101,103,40,115,101,108,102,44,114,41,58,0,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,8,102,114,101,101,95,114,101,103,
+0,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
+28,3,0,0,9,2,0,3,30,9,5,138,9,9,105,102,
+32,115,101,108,102,46,105,115,95,116,109,112,40,114,41,58,
+32,68,46,116,109,112,99,32,45,61,32,49,0,0,0,0,
+12,7,0,6,105,115,95,116,109,112,0,0,49,4,1,7,
+15,6,2,0,50,3,4,1,21,3,0,0,18,0,0,20,
+12,4,0,1,68,0,0,0,13,3,4,0,12,5,0,1,
+68,0,0,0,13,4,5,0,12,5,0,4,116,109,112,99,
+0,0,0,0,9,4,4,5,11,5,0,1,1,0,0,0,
+0,0,0,0,2,4,4,5,12,5,0,4,116,109,112,99,
+0,0,0,0,10,3,5,4,18,0,0,1,30,11,5,139,
+9,9,110,32,61,32,68,46,114,50,110,91,114,93,59,32,
+100,101,108,32,68,46,114,50,110,91,114,93,59,32,100,101,
+108,32,68,46,110,50,114,91,110,93,0,0,12,5,0,1,
+68,0,0,0,13,4,5,0,12,5,0,3,114,50,110,0,
+9,4,4,5,9,4,4,2,15,3,4,0,12,5,0,1,
+68,0,0,0,13,4,5,0,12,5,0,3,114,50,110,0,
+9,4,4,5,43,4,2,0,12,5,0,1,68,0,0,0,
+13,4,5,0,12,5,0,3,110,50,114,0,9,4,4,5,
+43,4,3,0,0,0,0,0,12,120,0,8,102,114,101,101,
+95,114,101,103,0,0,0,0,10,8,120,119,16,120,0,103,
+44,15,0,0,30,8,5,142,9,100,101,102,32,105,109,97,
+110,97,103,101,40,115,101,108,102,44,111,114,105,103,44,102,
+110,99,41,58,0,0,0,0,12,1,0,9,116,105,110,121,
+112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,7,
+105,109,97,110,97,103,101,0,34,1,0,0,28,2,0,0,
+9,1,0,2,28,3,0,0,9,2,0,3,28,4,0,0,
+9,3,0,4,30,6,5,143,9,9,105,116,101,109,115,32,
+61,32,111,114,105,103,46,105,116,101,109,115,0,0,0,0,
+12,6,0,5,105,116,101,109,115,0,0,0,9,5,2,6,
+15,4,5,0,30,7,5,144,9,9,111,114,105,103,46,118,
+97,108,32,61,32,111,114,105,103,46,118,97,108,91,58,45,
+49,93,0,0,12,6,0,3,118,97,108,0,9,5,2,6,
+28,7,0,0,11,8,0,0,0,0,0,0,0,0,240,191,
+27,6,7,2,9,5,5,6,12,6,0,3,118,97,108,0,
+10,2,6,5,30,13,5,145,9,9,116,32,61,32,84,111,
+107,101,110,40,111,114,105,103,46,112,111,115,44,39,115,121,
+109,98,111,108,39,44,39,61,39,44,91,105,116,101,109,115,
+91,48,93,44,111,114,105,103,93,41,0,0,12,8,0,5,
+84,111,107,101,110,0,0,0,13,7,8,0,12,12,0,3,
+112,111,115,0,9,8,2,12,12,9,0,6,115,121,109,98,
+111,108,0,0,12,10,0,1,61,0,0,0,11,14,0,1,
+0,0,0,0,0,0,0,0,9,12,4,14,15,13,2,0,
+27,11,12,2,31,6,8,4,19,6,7,6,15,5,6,0,
+30,4,5,146,9,9,114,101,116,117,114,110,32,102,110,99,
+40,116,41,0,15,7,5,0,31,6,7,1,19,6,3,6,
+20,6,0,0,0,0,0,0,12,121,0,7,105,109,97,110,
+97,103,101,0,10,8,121,120,16,121,0,96,44,13,0,0,
+30,8,5,149,9,100,101,102,32,117,110,97,114,121,40,115,
+101,108,102,44,105,44,116,98,44,114,61,78,111,110,101,41,
+58,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
+121,0,0,0,33,1,0,0,12,1,0,5,117,110,97,114,
+121,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
+28,3,0,0,9,2,0,3,28,4,0,0,9,3,0,4,
+28,4,0,0,28,5,0,0,32,4,0,5,30,6,5,150,
+9,9,114,32,61,32,115,101,108,102,46,103,101,116,95,116,
+109,112,40,114,41,0,0,0,12,9,0,7,103,101,116,95,
+116,109,112,0,49,6,1,9,15,8,4,0,50,5,6,1,
+15,4,5,0,30,5,5,151,9,9,98,32,61,32,115,101,
+108,102,46,100,111,40,116,98,41,0,0,0,12,10,0,2,
+100,111,0,0,49,7,1,10,15,9,3,0,50,6,7,1,
+15,5,6,0,30,6,5,152,9,9,115,101,108,102,46,100,
 111,95,99,111,100,101,40,105,44,114,44,98,41,0,0,0,
-12,8,0,7,100,111,95,99,111,100,101,0,9,7,1,8,
-15,8,2,0,15,9,4,0,15,10,5,0,31,6,8,3,
-19,6,7,6,30,8,5,126,9,9,105,102,32,114,32,33,
+12,12,0,7,100,111,95,99,111,100,101,0,49,7,1,12,
+15,9,2,0,15,10,4,0,15,11,5,0,50,6,7,3,
+30,8,5,153,9,9,105,102,32,114,32,33,61,32,98,58,
+32,115,101,108,102,46,102,114,101,101,95,116,109,112,40,98,
+41,0,0,0,35,6,4,5,21,6,0,0,18,0,0,9,
+12,10,0,8,102,114,101,101,95,116,109,112,0,0,0,0,
+49,7,1,10,15,9,5,0,50,6,7,1,18,0,0,1,
+30,3,5,154,9,9,114,101,116,117,114,110,32,114,0,0,
+20,4,0,0,0,0,0,0,12,122,0,5,117,110,97,114,
+121,0,0,0,10,8,122,121,16,122,0,126,44,16,0,0,
+30,9,5,157,9,100,101,102,32,105,110,102,105,120,40,115,
+101,108,102,44,105,44,116,98,44,116,99,44,114,61,78,111,
+110,101,41,58,0,0,0,0,12,1,0,9,116,105,110,121,
+112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,5,
+105,110,102,105,120,0,0,0,34,1,0,0,28,2,0,0,
+9,1,0,2,28,3,0,0,9,2,0,3,28,4,0,0,
+9,3,0,4,28,5,0,0,9,4,0,5,28,5,0,0,
+28,6,0,0,32,5,0,6,30,6,5,158,9,9,114,32,
+61,32,115,101,108,102,46,103,101,116,95,116,109,112,40,114,
+41,0,0,0,12,10,0,7,103,101,116,95,116,109,112,0,
+49,7,1,10,15,9,5,0,50,6,7,1,15,5,6,0,
+30,9,5,159,9,9,98,44,99,32,61,32,115,101,108,102,
+46,100,111,40,116,98,44,114,41,44,115,101,108,102,46,100,
+111,40,116,99,41,0,0,0,12,12,0,2,100,111,0,0,
+49,8,1,12,15,10,3,0,15,11,5,0,50,7,8,2,
+15,6,7,0,12,12,0,2,100,111,0,0,49,9,1,12,
+15,11,4,0,50,8,9,1,15,7,8,0,15,8,6,0,
+15,6,7,0,30,6,5,160,9,9,115,101,108,102,46,100,
+111,95,99,111,100,101,40,105,44,114,44,98,44,99,41,0,
+12,15,0,7,100,111,95,99,111,100,101,0,49,9,1,15,
+15,11,2,0,15,12,5,0,15,13,8,0,15,14,6,0,
+50,7,9,4,30,8,5,161,9,9,105,102,32,114,32,33,
 61,32,98,58,32,115,101,108,102,46,102,114,101,101,95,116,
-109,112,40,98,41,0,0,0,35,6,4,5,21,6,0,0,
-18,0,0,10,12,8,0,8,102,114,101,101,95,116,109,112,
-0,0,0,0,9,7,1,8,15,8,5,0,31,6,8,1,
-19,6,7,6,18,0,0,1,30,3,5,127,9,9,114,101,
-116,117,114,110,32,114,0,0,20,4,0,0,0,0,0,0,
-12,120,0,5,117,110,97,114,121,0,0,0,10,7,120,119,
-16,120,0,132,44,14,0,0,30,9,5,130,9,100,101,102,
-32,105,110,102,105,120,40,115,101,108,102,44,105,44,116,98,
-44,116,99,44,114,61,78,111,110,101,41,58,0,0,0,0,
-12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
-33,1,0,0,12,1,0,5,105,110,102,105,120,0,0,0,
-34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
-9,2,0,3,28,4,0,0,9,3,0,4,28,5,0,0,
-9,4,0,5,28,5,0,0,28,6,0,0,32,5,0,6,
-30,6,5,131,9,9,114,32,61,32,115,101,108,102,46,103,
-101,116,95,116,109,112,40,114,41,0,0,0,12,8,0,7,
-103,101,116,95,116,109,112,0,9,7,1,8,15,8,5,0,
-31,6,8,1,19,6,7,6,15,5,6,0,30,9,5,132,
-9,9,98,44,99,32,61,32,115,101,108,102,46,100,111,40,
-116,98,44,114,41,44,115,101,108,102,46,100,111,40,116,99,
-41,0,0,0,12,9,0,2,100,111,0,0,9,8,1,9,
-15,9,3,0,15,10,5,0,31,7,9,2,19,7,8,7,
-15,6,7,0,12,10,0,2,100,111,0,0,9,9,1,10,
-15,10,4,0,31,8,10,1,19,8,9,8,15,7,8,0,
-15,8,6,0,15,6,7,0,30,6,5,133,9,9,115,101,
-108,102,46,100,111,95,99,111,100,101,40,105,44,114,44,98,
-44,99,41,0,12,10,0,7,100,111,95,99,111,100,101,0,
-9,9,1,10,15,10,2,0,15,11,5,0,15,12,8,0,
-15,13,6,0,31,7,10,4,19,7,9,7,30,8,5,134,
-9,9,105,102,32,114,32,33,61,32,98,58,32,115,101,108,
-102,46,102,114,101,101,95,116,109,112,40,98,41,0,0,0,
-35,7,5,8,21,7,0,0,18,0,0,10,12,10,0,8,
-102,114,101,101,95,116,109,112,0,0,0,0,9,9,1,10,
-15,10,8,0,31,7,10,1,19,7,9,7,18,0,0,1,
-30,5,5,135,9,9,115,101,108,102,46,102,114,101,101,95,
-116,109,112,40,99,41,0,0,12,10,0,8,102,114,101,101,
-95,116,109,112,0,0,0,0,9,9,1,10,15,10,6,0,
-31,7,10,1,19,7,9,7,30,3,5,136,9,9,114,101,
+109,112,40,98,41,0,0,0,35,7,5,8,21,7,0,0,
+18,0,0,9,12,12,0,8,102,114,101,101,95,116,109,112,
+0,0,0,0,49,9,1,12,15,11,8,0,50,7,9,1,
+18,0,0,1,30,5,5,162,9,9,115,101,108,102,46,102,
+114,101,101,95,116,109,112,40,99,41,0,0,12,12,0,8,
+102,114,101,101,95,116,109,112,0,0,0,0,49,9,1,12,
+15,11,6,0,50,7,9,1,30,3,5,163,9,9,114,101,
 116,117,114,110,32,114,0,0,20,5,0,0,0,0,0,0,
-12,121,0,5,105,110,102,105,120,0,0,0,10,7,121,120,
-16,121,2,145,44,18,0,0,30,6,5,140,9,100,101,102,
+12,123,0,5,105,110,102,105,120,0,0,0,10,8,123,122,
+16,123,2,139,44,18,0,0,30,6,5,167,9,100,101,102,
 32,109,97,112,95,116,97,103,115,40,115,101,108,102,41,58,
 0,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
 121,0,0,0,33,1,0,0,12,1,0,8,109,97,112,95,
 116,97,103,115,0,0,0,0,34,1,0,0,28,2,0,0,
-9,1,0,2,30,3,5,141,9,9,116,97,103,115,32,61,
-32,123,125,0,26,3,0,0,15,2,3,0,30,3,5,142,
+9,1,0,2,30,3,5,168,9,9,116,97,103,115,32,61,
+32,123,125,0,26,3,0,0,15,2,3,0,30,3,5,169,
 9,9,111,117,116,32,61,32,91,93,0,0,27,4,0,0,
-15,3,4,0,30,2,5,143,9,9,110,32,61,32,48,0,
-11,5,0,0,0,0,0,0,0,0,0,0,15,4,5,0,
-30,6,5,144,9,9,102,111,114,32,105,116,101,109,32,105,
+15,3,4,0,30,2,5,170,9,9,110,32,61,32,48,0,
+11,5,0,1,0,0,0,0,0,0,0,0,15,4,5,0,
+30,6,5,171,9,9,102,111,114,32,105,116,101,109,32,105,
 110,32,68,46,111,117,116,58,0,0,0,0,12,7,0,1,
 68,0,0,0,13,6,7,0,12,7,0,3,111,117,116,0,
-9,6,6,7,11,7,0,0,0,0,0,0,0,0,0,0,
-42,5,6,7,18,0,0,131,30,6,5,145,9,9,9,105,
+9,6,6,7,11,7,0,1,0,0,0,0,0,0,0,0,
+42,5,6,7,18,0,0,128,30,6,5,172,9,9,9,105,
 102,32,105,116,101,109,91,48,93,32,61,61,32,39,116,97,
-103,39,58,0,11,9,0,0,0,0,0,0,0,0,0,0,
+103,39,58,0,11,9,0,1,0,0,0,0,0,0,0,0,
 9,8,5,9,12,9,0,3,116,97,103,0,23,8,8,9,
-21,8,0,0,18,0,0,20,30,6,5,146,9,9,9,9,
+21,8,0,0,18,0,0,20,30,6,5,173,9,9,9,9,
 116,97,103,115,91,105,116,101,109,91,49,93,93,32,61,32,
-110,0,0,0,11,9,0,0,0,0,0,0,0,0,240,63,
-9,8,5,9,10,2,8,4,30,4,5,147,9,9,9,9,
+110,0,0,0,11,9,0,1,1,0,0,0,0,0,0,0,
+9,8,5,9,10,2,8,4,30,4,5,174,9,9,9,9,
 99,111,110,116,105,110,117,101,0,0,0,0,18,0,255,221,
-18,0,0,1,30,7,5,148,9,9,9,105,102,32,105,116,
+18,0,0,1,30,7,5,175,9,9,9,105,102,32,105,116,
 101,109,91,48,93,32,61,61,32,39,114,101,103,115,39,58,
-0,0,0,0,11,9,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,11,9,0,1,0,0,0,0,0,0,0,0,
 9,8,5,9,12,9,0,4,114,101,103,115,0,0,0,0,
-23,8,8,9,21,8,0,0,18,0,0,55,30,13,5,149,
+23,8,8,9,21,8,0,0,18,0,0,53,30,13,5,176,
 9,9,9,9,111,117,116,46,97,112,112,101,110,100,40,115,
 101,108,102,46,103,101,116,95,99,111,100,101,49,54,40,79,
 80,95,82,69,71,83,44,105,116,101,109,91,49,93,44,48,
-41,41,0,0,12,10,0,6,97,112,112,101,110,100,0,0,
-9,9,3,10,12,12,0,10,103,101,116,95,99,111,100,101,
-49,54,0,0,9,11,1,12,12,15,0,7,79,80,95,82,
-69,71,83,0,13,12,15,0,11,15,0,0,0,0,0,0,
-0,0,240,63,9,13,5,15,11,14,0,0,0,0,0,0,
-0,0,0,0,31,10,12,3,19,10,11,10,31,8,10,1,
-19,8,9,8,30,3,5,150,9,9,9,9,110,32,43,61,
-32,49,0,0,11,9,0,0,0,0,0,0,0,0,240,63,
-1,8,4,9,15,4,8,0,30,4,5,151,9,9,9,9,
-99,111,110,116,105,110,117,101,0,0,0,0,18,0,255,149,
-18,0,0,1,30,5,5,152,9,9,9,111,117,116,46,97,
-112,112,101,110,100,40,105,116,101,109,41,0,12,10,0,6,
-97,112,112,101,110,100,0,0,9,9,3,10,15,10,5,0,
-31,8,10,1,19,8,9,8,30,3,5,153,9,9,9,110,
-32,43,61,32,49,0,0,0,11,9,0,0,0,0,0,0,
-0,0,240,63,1,8,4,9,15,4,8,0,18,0,255,125,
-30,8,5,154,9,9,102,111,114,32,110,32,105,110,32,114,
-97,110,103,101,40,48,44,108,101,110,40,111,117,116,41,41,
-58,0,0,0,12,8,0,5,114,97,110,103,101,0,0,0,
-13,7,8,0,11,8,0,0,0,0,0,0,0,0,0,0,
-12,11,0,3,108,101,110,0,13,10,11,0,15,11,3,0,
-31,9,11,1,19,9,10,9,31,6,8,2,19,6,7,6,
-11,7,0,0,0,0,0,0,0,0,0,0,42,4,6,7,
-18,0,0,180,30,5,5,155,9,9,9,105,116,101,109,32,
-61,32,111,117,116,91,110,93,0,0,0,0,9,8,3,4,
-15,5,8,0,30,7,5,156,9,9,9,105,102,32,105,116,
-101,109,91,48,93,32,61,61,32,39,106,117,109,112,39,58,
-0,0,0,0,11,9,0,0,0,0,0,0,0,0,0,0,
-9,8,5,9,12,9,0,4,106,117,109,112,0,0,0,0,
-23,8,8,9,21,8,0,0,18,0,0,38,30,14,5,157,
-9,9,9,9,111,117,116,91,110,93,32,61,32,115,101,108,
-102,46,103,101,116,95,99,111,100,101,49,54,40,79,80,95,
-74,85,77,80,44,48,44,116,97,103,115,91,105,116,101,109,
-91,49,93,93,45,110,41,0,12,10,0,10,103,101,116,95,
-99,111,100,101,49,54,0,0,9,9,1,10,12,13,0,7,
-79,80,95,74,85,77,80,0,13,10,13,0,11,11,0,0,
-0,0,0,0,0,0,0,0,11,14,0,0,0,0,0,0,
-0,0,240,63,9,13,5,14,9,12,2,13,2,12,12,4,
-31,8,10,3,19,8,9,8,10,3,4,8,18,0,0,116,
-30,8,5,158,9,9,9,101,108,105,102,32,105,116,101,109,
+41,41,0,0,12,12,0,6,97,112,112,101,110,100,0,0,
+49,9,3,12,12,17,0,10,103,101,116,95,99,111,100,101,
+49,54,0,0,49,12,1,17,12,17,0,7,79,80,95,82,
+69,71,83,0,13,14,17,0,11,17,0,1,1,0,0,0,
+0,0,0,0,9,15,5,17,11,16,0,1,0,0,0,0,
+0,0,0,0,50,11,12,3,50,8,9,1,30,3,5,177,
+9,9,9,9,110,32,43,61,32,49,0,0,11,9,0,1,
+1,0,0,0,0,0,0,0,1,8,4,9,15,4,8,0,
+30,4,5,178,9,9,9,9,99,111,110,116,105,110,117,101,
+0,0,0,0,18,0,255,151,18,0,0,1,30,5,5,179,
+9,9,9,111,117,116,46,97,112,112,101,110,100,40,105,116,
+101,109,41,0,12,12,0,6,97,112,112,101,110,100,0,0,
+49,9,3,12,15,11,5,0,50,8,9,1,30,3,5,180,
+9,9,9,110,32,43,61,32,49,0,0,0,11,9,0,1,
+1,0,0,0,0,0,0,0,1,8,4,9,15,4,8,0,
+18,0,255,128,30,8,5,181,9,9,102,111,114,32,110,32,
+105,110,32,114,97,110,103,101,40,48,44,108,101,110,40,111,
+117,116,41,41,58,0,0,0,12,8,0,5,114,97,110,103,
+101,0,0,0,13,7,8,0,11,8,0,1,0,0,0,0,
+0,0,0,0,12,11,0,3,108,101,110,0,13,10,11,0,
+15,11,3,0,31,9,11,1,19,9,10,9,31,6,8,2,
+19,6,7,6,11,7,0,1,0,0,0,0,0,0,0,0,
+42,4,6,7,18,0,0,177,30,5,5,182,9,9,9,105,
+116,101,109,32,61,32,111,117,116,91,110,93,0,0,0,0,
+9,8,3,4,15,5,8,0,30,7,5,183,9,9,9,105,
+102,32,105,116,101,109,91,48,93,32,61,61,32,39,106,117,
+109,112,39,58,0,0,0,0,11,9,0,1,0,0,0,0,
+0,0,0,0,9,8,5,9,12,9,0,4,106,117,109,112,
+0,0,0,0,23,8,8,9,21,8,0,0,18,0,0,37,
+30,14,5,184,9,9,9,9,111,117,116,91,110,93,32,61,
+32,115,101,108,102,46,103,101,116,95,99,111,100,101,49,54,
+40,79,80,95,74,85,77,80,44,48,44,116,97,103,115,91,
+105,116,101,109,91,49,93,93,45,110,41,0,12,14,0,10,
+103,101,116,95,99,111,100,101,49,54,0,0,49,9,1,14,
+12,14,0,7,79,80,95,74,85,77,80,0,13,11,14,0,
+11,12,0,1,0,0,0,0,0,0,0,0,11,15,0,1,
+1,0,0,0,0,0,0,0,9,14,5,15,9,13,2,14,
+2,13,13,4,50,8,9,3,10,3,4,8,18,0,0,114,
+30,8,5,185,9,9,9,101,108,105,102,32,105,116,101,109,
 91,48,93,32,61,61,32,39,115,101,116,106,109,112,39,58,
-0,0,0,0,11,9,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,11,9,0,1,0,0,0,0,0,0,0,0,
 9,8,5,9,12,9,0,6,115,101,116,106,109,112,0,0,
-23,8,8,9,21,8,0,0,18,0,0,40,30,15,5,159,
+23,8,8,9,21,8,0,0,18,0,0,39,30,15,5,186,
 9,9,9,9,111,117,116,91,110,93,32,61,32,115,101,108,
 102,46,103,101,116,95,99,111,100,101,49,54,40,79,80,95,
 83,69,84,74,77,80,44,48,44,116,97,103,115,91,105,116,
-101,109,91,49,93,93,45,110,41,0,0,0,12,10,0,10,
-103,101,116,95,99,111,100,101,49,54,0,0,9,9,1,10,
-12,13,0,9,79,80,95,83,69,84,74,77,80,0,0,0,
-13,10,13,0,11,11,0,0,0,0,0,0,0,0,0,0,
-11,14,0,0,0,0,0,0,0,0,240,63,9,13,5,14,
-9,12,2,13,2,12,12,4,31,8,10,3,19,8,9,8,
-10,3,4,8,18,0,0,58,30,7,5,160,9,9,9,101,
+101,109,91,49,93,93,45,110,41,0,0,0,12,14,0,10,
+103,101,116,95,99,111,100,101,49,54,0,0,49,9,1,14,
+12,14,0,9,79,80,95,83,69,84,74,77,80,0,0,0,
+13,11,14,0,11,12,0,1,0,0,0,0,0,0,0,0,
+11,15,0,1,1,0,0,0,0,0,0,0,9,14,5,15,
+9,13,2,14,2,13,13,4,50,8,9,3,10,3,4,8,
+18,0,0,57,30,7,5,187,9,9,9,101,108,105,102,32,
+105,116,101,109,91,48,93,32,61,61,32,39,102,110,99,39,
+58,0,0,0,11,9,0,1,0,0,0,0,0,0,0,0,
+9,8,5,9,12,9,0,3,102,110,99,0,23,8,8,9,
+21,8,0,0,18,0,0,40,30,16,5,188,9,9,9,9,
+111,117,116,91,110,93,32,61,32,115,101,108,102,46,103,101,
+116,95,99,111,100,101,49,54,40,79,80,95,68,69,70,44,
+105,116,101,109,91,49,93,44,116,97,103,115,91,105,116,101,
+109,91,50,93,93,45,110,41,0,0,0,0,12,14,0,10,
+103,101,116,95,99,111,100,101,49,54,0,0,49,9,1,14,
+12,14,0,6,79,80,95,68,69,70,0,0,13,11,14,0,
+11,14,0,1,1,0,0,0,0,0,0,0,9,12,5,14,
+11,15,0,1,2,0,0,0,0,0,0,0,9,14,5,15,
+9,13,2,14,2,13,13,4,50,8,9,3,10,3,4,8,
+18,0,0,1,18,0,255,79,30,8,5,189,9,9,102,111,
+114,32,110,32,105,110,32,114,97,110,103,101,40,48,44,108,
+101,110,40,111,117,116,41,41,58,0,0,0,12,8,0,5,
+114,97,110,103,101,0,0,0,13,7,8,0,11,8,0,1,
+0,0,0,0,0,0,0,0,12,11,0,3,108,101,110,0,
+13,10,11,0,15,11,3,0,31,9,11,1,19,9,10,9,
+31,6,8,2,19,6,7,6,11,7,0,1,0,0,0,0,
+0,0,0,0,42,4,6,7,18,0,0,221,30,5,5,190,
+9,9,9,105,116,101,109,32,61,32,111,117,116,91,110,93,
+0,0,0,0,9,8,3,4,15,5,8,0,30,7,5,191,
+9,9,9,105,102,32,105,116,101,109,91,48,93,32,61,61,
+32,39,100,97,116,97,39,58,0,0,0,0,11,9,0,1,
+0,0,0,0,0,0,0,0,9,8,5,9,12,9,0,4,
+100,97,116,97,0,0,0,0,23,8,8,9,21,8,0,0,
+18,0,0,14,30,6,5,192,9,9,9,9,111,117,116,91,
+110,93,32,61,32,105,116,101,109,91,49,93,0,0,0,0,
+11,9,0,1,1,0,0,0,0,0,0,0,9,8,5,9,
+10,3,4,8,18,0,0,114,30,7,5,193,9,9,9,101,
 108,105,102,32,105,116,101,109,91,48,93,32,61,61,32,39,
-102,110,99,39,58,0,0,0,11,9,0,0,0,0,0,0,
-0,0,0,0,9,8,5,9,12,9,0,3,102,110,99,0,
-23,8,8,9,21,8,0,0,18,0,0,41,30,16,5,161,
-9,9,9,9,111,117,116,91,110,93,32,61,32,115,101,108,
-102,46,103,101,116,95,99,111,100,101,49,54,40,79,80,95,
-68,69,70,44,105,116,101,109,91,49,93,44,116,97,103,115,
-91,105,116,101,109,91,50,93,93,45,110,41,0,0,0,0,
-12,10,0,10,103,101,116,95,99,111,100,101,49,54,0,0,
-9,9,1,10,12,13,0,6,79,80,95,68,69,70,0,0,
-13,10,13,0,11,13,0,0,0,0,0,0,0,0,240,63,
-9,11,5,13,11,14,0,0,0,0,0,0,0,0,0,64,
-9,13,5,14,9,12,2,13,2,12,12,4,31,8,10,3,
-19,8,9,8,10,3,4,8,18,0,0,1,18,0,255,76,
-30,8,5,162,9,9,102,111,114,32,110,32,105,110,32,114,
-97,110,103,101,40,48,44,108,101,110,40,111,117,116,41,41,
-58,0,0,0,12,8,0,5,114,97,110,103,101,0,0,0,
-13,7,8,0,11,8,0,0,0,0,0,0,0,0,0,0,
-12,11,0,3,108,101,110,0,13,10,11,0,15,11,3,0,
-31,9,11,1,19,9,10,9,31,6,8,2,19,6,7,6,
-11,7,0,0,0,0,0,0,0,0,0,0,42,4,6,7,
-18,0,0,221,30,5,5,163,9,9,9,105,116,101,109,32,
-61,32,111,117,116,91,110,93,0,0,0,0,9,8,3,4,
-15,5,8,0,30,7,5,164,9,9,9,105,102,32,105,116,
-101,109,91,48,93,32,61,61,32,39,100,97,116,97,39,58,
-0,0,0,0,11,9,0,0,0,0,0,0,0,0,0,0,
-9,8,5,9,12,9,0,4,100,97,116,97,0,0,0,0,
-23,8,8,9,21,8,0,0,18,0,0,14,30,6,5,165,
-9,9,9,9,111,117,116,91,110,93,32,61,32,105,116,101,
-109,91,49,93,0,0,0,0,11,9,0,0,0,0,0,0,
-0,0,240,63,9,8,5,9,10,3,4,8,18,0,0,114,
-30,7,5,166,9,9,9,101,108,105,102,32,105,116,101,109,
-91,48,93,32,61,61,32,39,99,111,100,101,39,58,0,0,
-11,9,0,0,0,0,0,0,0,0,0,0,9,8,5,9,
-12,9,0,4,99,111,100,101,0,0,0,0,23,8,8,9,
-21,8,0,0,18,0,0,75,30,6,5,167,9,9,9,9,
-105,44,97,44,98,44,99,32,61,32,105,116,101,109,91,49,
-58,93,0,0,11,10,0,0,0,0,0,0,0,0,240,63,
-28,11,0,0,27,9,10,2,9,8,5,9,11,11,0,0,
-0,0,0,0,0,0,0,0,9,10,8,11,15,9,10,0,
-11,12,0,0,0,0,0,0,0,0,240,63,9,11,8,12,
-15,10,11,0,11,13,0,0,0,0,0,0,0,0,0,64,
-9,12,8,13,15,11,12,0,11,14,0,0,0,0,0,0,
-0,0,8,64,9,13,8,14,15,12,13,0,30,11,5,168,
-9,9,9,9,111,117,116,91,110,93,32,61,32,99,104,114,
-40,105,41,43,99,104,114,40,97,41,43,99,104,114,40,98,
-41,43,99,104,114,40,99,41,0,0,0,0,12,14,0,3,
-99,104,114,0,13,13,14,0,15,14,9,0,31,8,14,1,
-19,8,13,8,12,15,0,3,99,104,114,0,13,14,15,0,
-15,15,10,0,31,13,15,1,19,13,14,13,1,8,8,13,
-12,15,0,3,99,104,114,0,13,14,15,0,15,15,11,0,
-31,13,15,1,19,13,14,13,1,8,8,13,12,15,0,3,
-99,104,114,0,13,14,15,0,15,15,12,0,31,13,15,1,
-19,13,14,13,1,8,8,13,10,3,4,8,18,0,0,22,
-30,8,5,170,9,9,9,9,114,97,105,115,101,32,115,116,
-114,40,40,39,104,117,104,63,39,44,105,116,101,109,41,41,
-0,0,0,0,12,14,0,3,115,116,114,0,13,13,14,0,
-12,15,0,4,104,117,104,63,0,0,0,0,15,16,5,0,
-27,14,15,2,31,8,14,1,19,8,13,8,37,8,0,0,
-18,0,0,1,30,6,5,171,9,9,9,105,102,32,108,101,
-110,40,111,117,116,91,110,93,41,32,33,61,32,52,58,0,
-12,14,0,3,108,101,110,0,13,13,14,0,9,14,3,4,
-31,8,14,1,19,8,13,8,11,13,0,0,0,0,0,0,
-0,0,16,64,35,8,8,13,21,8,0,0,18,0,0,49,
-30,16,5,172,9,9,9,9,114,97,105,115,101,32,40,39,
-99,111,100,101,32,39,43,115,116,114,40,110,41,43,39,32,
-105,115,32,119,114,111,110,103,32,108,101,110,103,116,104,32,
-39,43,115,116,114,40,108,101,110,40,111,117,116,91,110,93,
-41,41,41,0,12,8,0,5,99,111,100,101,32,0,0,0,
-12,15,0,3,115,116,114,0,13,14,15,0,15,15,4,0,
-31,13,15,1,19,13,14,13,1,8,8,13,12,13,0,17,
-32,105,115,32,119,114,111,110,103,32,108,101,110,103,116,104,
-32,0,0,0,1,8,8,13,12,15,0,3,115,116,114,0,
-13,14,15,0,12,17,0,3,108,101,110,0,13,16,17,0,
-9,17,3,4,31,15,17,1,19,15,16,15,31,13,15,1,
-19,13,14,13,1,8,8,13,37,8,0,0,18,0,0,1,
-18,0,255,35,30,4,5,173,9,9,68,46,111,117,116,32,
-61,32,111,117,116,0,0,0,12,7,0,1,68,0,0,0,
-13,6,7,0,12,7,0,3,111,117,116,0,10,6,7,3,
-0,0,0,0,12,122,0,8,109,97,112,95,116,97,103,115,
-0,0,0,0,10,7,122,121,16,122,0,63,44,6,0,0,
-30,7,5,176,9,100,101,102,32,103,101,116,95,116,109,112,
-40,115,101,108,102,44,114,61,78,111,110,101,41,58,0,0,
-12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
-33,1,0,0,12,1,0,7,103,101,116,95,116,109,112,0,
-34,1,0,0,28,2,0,0,9,1,0,2,28,2,0,0,
-28,3,0,0,32,2,0,3,30,7,5,177,9,9,105,102,
-32,114,32,33,61,32,78,111,110,101,58,32,114,101,116,117,
-114,110,32,114,0,0,0,0,28,4,0,0,35,3,2,4,
-21,3,0,0,18,0,0,3,20,2,0,0,18,0,0,1,
-30,8,5,178,9,9,114,101,116,117,114,110,32,115,101,108,
-102,46,103,101,116,95,116,109,112,115,40,49,41,91,48,93,
-0,0,0,0,12,5,0,8,103,101,116,95,116,109,112,115,
-0,0,0,0,9,4,1,5,11,5,0,0,0,0,0,0,
-0,0,240,63,31,3,5,1,19,3,4,3,11,4,0,0,
-0,0,0,0,0,0,0,0,9,3,3,4,20,3,0,0,
-0,0,0,0,12,123,0,7,103,101,116,95,116,109,112,0,
-10,7,123,122,16,123,0,149,44,15,0,0,30,6,5,181,
-9,100,101,102,32,103,101,116,95,116,109,112,115,40,115,101,
-108,102,44,116,41,58,0,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,8,
-103,101,116,95,116,109,112,115,0,0,0,0,34,1,0,0,
-28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-30,6,5,182,9,9,114,115,32,61,32,115,101,108,102,46,
-97,108,108,111,99,40,116,41,0,0,0,0,12,6,0,5,
-97,108,108,111,99,0,0,0,9,5,1,6,15,6,2,0,
-31,4,6,1,19,4,5,4,15,3,4,0,30,6,5,183,
+99,111,100,101,39,58,0,0,11,9,0,1,0,0,0,0,
+0,0,0,0,9,8,5,9,12,9,0,4,99,111,100,101,
+0,0,0,0,23,8,8,9,21,8,0,0,18,0,0,75,
+30,6,5,194,9,9,9,9,105,44,97,44,98,44,99,32,
+61,32,105,116,101,109,91,49,58,93,0,0,11,10,0,1,
+1,0,0,0,0,0,0,0,28,11,0,0,27,9,10,2,
+9,8,5,9,11,11,0,1,0,0,0,0,0,0,0,0,
+9,10,8,11,15,9,10,0,11,12,0,1,1,0,0,0,
+0,0,0,0,9,11,8,12,15,10,11,0,11,13,0,1,
+2,0,0,0,0,0,0,0,9,12,8,13,15,11,12,0,
+11,14,0,1,3,0,0,0,0,0,0,0,9,13,8,14,
+15,12,13,0,30,11,5,195,9,9,9,9,111,117,116,91,
+110,93,32,61,32,99,104,114,40,105,41,43,99,104,114,40,
+97,41,43,99,104,114,40,98,41,43,99,104,114,40,99,41,
+0,0,0,0,12,14,0,3,99,104,114,0,13,13,14,0,
+15,14,9,0,31,8,14,1,19,8,13,8,12,15,0,3,
+99,104,114,0,13,14,15,0,15,15,10,0,31,13,15,1,
+19,13,14,13,1,8,8,13,12,15,0,3,99,104,114,0,
+13,14,15,0,15,15,11,0,31,13,15,1,19,13,14,13,
+1,8,8,13,12,15,0,3,99,104,114,0,13,14,15,0,
+15,15,12,0,31,13,15,1,19,13,14,13,1,8,8,13,
+10,3,4,8,18,0,0,22,30,8,5,197,9,9,9,9,
+114,97,105,115,101,32,115,116,114,40,40,39,104,117,104,63,
+39,44,105,116,101,109,41,41,0,0,0,0,12,14,0,3,
+115,116,114,0,13,13,14,0,12,15,0,4,104,117,104,63,
+0,0,0,0,15,16,5,0,27,14,15,2,31,8,14,1,
+19,8,13,8,37,8,0,0,18,0,0,1,30,6,5,198,
+9,9,9,105,102,32,108,101,110,40,111,117,116,91,110,93,
+41,32,33,61,32,52,58,0,12,14,0,3,108,101,110,0,
+13,13,14,0,9,14,3,4,31,8,14,1,19,8,13,8,
+11,13,0,1,4,0,0,0,0,0,0,0,35,8,8,13,
+21,8,0,0,18,0,0,49,30,16,5,199,9,9,9,9,
+114,97,105,115,101,32,40,39,99,111,100,101,32,39,43,115,
+116,114,40,110,41,43,39,32,105,115,32,119,114,111,110,103,
+32,108,101,110,103,116,104,32,39,43,115,116,114,40,108,101,
+110,40,111,117,116,91,110,93,41,41,41,0,12,8,0,5,
+99,111,100,101,32,0,0,0,12,15,0,3,115,116,114,0,
+13,14,15,0,15,15,4,0,31,13,15,1,19,13,14,13,
+1,8,8,13,12,13,0,17,32,105,115,32,119,114,111,110,
+103,32,108,101,110,103,116,104,32,0,0,0,1,8,8,13,
+12,15,0,3,115,116,114,0,13,14,15,0,12,17,0,3,
+108,101,110,0,13,16,17,0,9,17,3,4,31,15,17,1,
+19,15,16,15,31,13,15,1,19,13,14,13,1,8,8,13,
+37,8,0,0,18,0,0,1,18,0,255,35,30,4,5,200,
+9,9,68,46,111,117,116,32,61,32,111,117,116,0,0,0,
+12,7,0,1,68,0,0,0,13,6,7,0,12,7,0,3,
+111,117,116,0,10,6,7,3,0,0,0,0,12,124,0,8,
+109,97,112,95,116,97,103,115,0,0,0,0,10,8,124,123,
+16,124,0,62,44,8,0,0,30,7,5,203,9,100,101,102,
+32,103,101,116,95,116,109,112,40,115,101,108,102,44,114,61,
+78,111,110,101,41,58,0,0,12,1,0,9,116,105,110,121,
+112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,7,
+103,101,116,95,116,109,112,0,34,1,0,0,28,2,0,0,
+9,1,0,2,28,2,0,0,28,3,0,0,32,2,0,3,
+30,7,5,204,9,9,105,102,32,114,32,33,61,32,78,111,
+110,101,58,32,114,101,116,117,114,110,32,114,0,0,0,0,
+28,4,0,0,35,3,2,4,21,3,0,0,18,0,0,3,
+20,2,0,0,18,0,0,1,30,8,5,205,9,9,114,101,
+116,117,114,110,32,115,101,108,102,46,103,101,116,95,116,109,
+112,115,40,49,41,91,48,93,0,0,0,0,12,7,0,8,
+103,101,116,95,116,109,112,115,0,0,0,0,49,4,1,7,
+11,6,0,1,1,0,0,0,0,0,0,0,50,3,4,1,
+11,4,0,1,0,0,0,0,0,0,0,0,9,3,3,4,
+20,3,0,0,0,0,0,0,12,125,0,7,103,101,116,95,
+116,109,112,0,10,8,125,124,16,125,0,147,44,16,0,0,
+30,6,5,208,9,100,101,102,32,103,101,116,95,116,109,112,
+115,40,115,101,108,102,44,116,41,58,0,0,12,1,0,9,
+116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
+12,1,0,8,103,101,116,95,116,109,112,115,0,0,0,0,
+34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
+9,2,0,3,30,6,5,209,9,9,114,115,32,61,32,115,
+101,108,102,46,97,108,108,111,99,40,116,41,0,0,0,0,
+12,8,0,5,97,108,108,111,99,0,0,0,49,5,1,8,
+15,7,2,0,50,4,5,1,15,3,4,0,30,6,5,210,
 9,9,114,101,103,115,32,61,32,114,97,110,103,101,40,114,
 115,44,114,115,43,116,41,0,12,7,0,5,114,97,110,103,
 101,0,0,0,13,6,7,0,15,7,3,0,1,8,3,2,
-31,5,7,2,19,5,6,5,15,4,5,0,30,5,5,184,
+31,5,7,2,19,5,6,5,15,4,5,0,30,5,5,211,
 9,9,102,111,114,32,114,32,105,110,32,114,101,103,115,58,
-0,0,0,0,11,6,0,0,0,0,0,0,0,0,0,0,
-42,5,4,6,18,0,0,57,30,9,5,185,9,9,9,115,
+0,0,0,0,11,6,0,1,0,0,0,0,0,0,0,0,
+42,5,4,6,18,0,0,56,30,9,5,212,9,9,9,115,
 101,108,102,46,115,101,116,95,114,101,103,40,114,44,34,36,
 34,43,115,116,114,40,68,46,95,116,109,112,105,41,41,0,
-12,9,0,7,115,101,116,95,114,101,103,0,9,8,1,9,
-15,9,5,0,12,10,0,1,36,0,0,0,12,13,0,3,
-115,116,114,0,13,12,13,0,12,14,0,1,68,0,0,0,
-13,13,14,0,12,14,0,5,95,116,109,112,105,0,0,0,
-9,13,13,14,31,11,13,1,19,11,12,11,1,10,10,11,
-31,7,9,2,19,7,8,7,30,4,5,186,9,9,9,68,
-46,95,116,109,112,105,32,43,61,32,49,0,12,8,0,1,
-68,0,0,0,13,7,8,0,12,9,0,1,68,0,0,0,
-13,8,9,0,12,9,0,5,95,116,109,112,105,0,0,0,
-9,8,8,9,11,9,0,0,0,0,0,0,0,0,240,63,
-1,8,8,9,12,9,0,5,95,116,109,112,105,0,0,0,
-10,7,9,8,18,0,255,199,30,5,5,187,9,9,68,46,
-116,109,112,99,32,43,61,32,116,32,35,82,69,71,0,0,
-12,7,0,1,68,0,0,0,13,6,7,0,12,8,0,1,
-68,0,0,0,13,7,8,0,12,8,0,4,116,109,112,99,
-0,0,0,0,9,7,7,8,1,7,7,2,12,8,0,4,
-116,109,112,99,0,0,0,0,10,6,8,7,30,4,5,188,
-9,9,114,101,116,117,114,110,32,114,101,103,115,0,0,0,
-20,4,0,0,0,0,0,0,12,124,0,8,103,101,116,95,
-116,109,112,115,0,0,0,0,10,7,124,123,16,124,0,112,
-44,17,0,0,30,5,5,191,9,100,101,102,32,97,108,108,
-111,99,40,115,101,108,102,44,116,41,58,0,12,1,0,9,
+12,12,0,7,115,101,116,95,114,101,103,0,49,8,1,12,
+15,10,5,0,12,11,0,1,36,0,0,0,12,14,0,3,
+115,116,114,0,13,13,14,0,12,15,0,1,68,0,0,0,
+13,14,15,0,12,15,0,5,95,116,109,112,105,0,0,0,
+9,14,14,15,31,12,14,1,19,12,13,12,1,11,11,12,
+50,7,8,2,30,4,5,213,9,9,9,68,46,95,116,109,
+112,105,32,43,61,32,49,0,12,8,0,1,68,0,0,0,
+13,7,8,0,12,9,0,1,68,0,0,0,13,8,9,0,
+12,9,0,5,95,116,109,112,105,0,0,0,9,8,8,9,
+11,9,0,1,1,0,0,0,0,0,0,0,1,8,8,9,
+12,9,0,5,95,116,109,112,105,0,0,0,10,7,9,8,
+18,0,255,200,30,5,5,214,9,9,68,46,116,109,112,99,
+32,43,61,32,116,32,35,82,69,71,0,0,12,7,0,1,
+68,0,0,0,13,6,7,0,12,8,0,1,68,0,0,0,
+13,7,8,0,12,8,0,4,116,109,112,99,0,0,0,0,
+9,7,7,8,1,7,7,2,12,8,0,4,116,109,112,99,
+0,0,0,0,10,6,8,7,30,4,5,215,9,9,114,101,
+116,117,114,110,32,114,101,103,115,0,0,0,20,4,0,0,
+0,0,0,0,12,126,0,8,103,101,116,95,116,109,112,115,
+0,0,0,0,10,8,126,125,16,126,0,110,44,18,0,0,
+30,5,5,218,9,100,101,102,32,97,108,108,111,99,40,115,
+101,108,102,44,116,41,58,0,12,1,0,9,116,105,110,121,
+112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,5,
+97,108,108,111,99,0,0,0,34,1,0,0,28,2,0,0,
+9,1,0,2,28,3,0,0,9,2,0,3,30,18,5,219,
+9,9,115,32,61,32,39,39,46,106,111,105,110,40,91,34,
+48,49,34,91,114,32,105,110,32,68,46,114,50,110,93,32,
+102,111,114,32,114,32,105,110,32,114,97,110,103,101,40,48,
+44,109,105,110,40,50,53,54,44,68,46,109,114,101,103,43,
+116,41,41,93,41,0,0,0,12,8,0,0,0,0,0,0,
+12,9,0,4,106,111,105,110,0,0,0,0,49,5,8,9,
+27,8,0,0,12,12,0,5,114,97,110,103,101,0,0,0,
+13,11,12,0,11,12,0,1,0,0,0,0,0,0,0,0,
+12,15,0,3,109,105,110,0,13,14,15,0,11,15,0,1,
+0,1,0,0,0,0,0,0,12,17,0,1,68,0,0,0,
+13,16,17,0,12,17,0,4,109,114,101,103,0,0,0,0,
+9,16,16,17,1,16,16,2,31,13,15,2,19,13,14,13,
+31,10,12,2,19,10,11,10,11,11,0,1,0,0,0,0,
+0,0,0,0,42,9,10,11,18,0,0,14,12,12,0,2,
+48,49,0,0,12,14,0,1,68,0,0,0,13,13,14,0,
+12,14,0,3,114,50,110,0,9,13,13,14,36,13,13,9,
+9,12,12,13,28,13,0,0,10,8,13,12,18,0,255,242,
+15,7,8,0,50,4,5,1,15,3,4,0,30,6,5,220,
+9,9,114,101,116,117,114,110,32,115,46,105,110,100,101,120,
+40,39,48,39,42,116,41,0,12,10,0,5,105,110,100,101,
+120,0,0,0,49,5,3,10,12,7,0,1,48,0,0,0,
+3,7,7,2,50,4,5,1,20,4,0,0,0,0,0,0,
+12,127,0,5,97,108,108,111,99,0,0,0,10,8,127,126,
+16,127,0,50,44,10,0,0,30,8,5,225,9,100,101,102,
+32,100,111,95,115,116,114,105,110,103,40,115,101,108,102,44,
+116,44,114,61,78,111,110,101,41,58,0,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,5,97,108,108,111,99,0,0,0,34,1,0,0,
-28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-30,18,5,192,9,9,115,32,61,32,39,39,46,106,111,105,
-110,40,91,34,48,49,34,91,114,32,105,110,32,68,46,114,
-50,110,93,32,102,111,114,32,114,32,105,110,32,114,97,110,
-103,101,40,48,44,109,105,110,40,50,53,54,44,68,46,109,
-114,101,103,43,116,41,41,93,41,0,0,0,12,5,0,0,
-0,0,0,0,12,6,0,4,106,111,105,110,0,0,0,0,
-9,5,5,6,27,7,0,0,12,11,0,5,114,97,110,103,
-101,0,0,0,13,10,11,0,11,11,0,0,0,0,0,0,
-0,0,0,0,12,14,0,3,109,105,110,0,13,13,14,0,
-11,14,0,0,0,0,0,0,0,0,112,64,12,16,0,1,
-68,0,0,0,13,15,16,0,12,16,0,4,109,114,101,103,
-0,0,0,0,9,15,15,16,1,15,15,2,31,12,14,2,
-19,12,13,12,31,9,11,2,19,9,10,9,11,10,0,0,
-0,0,0,0,0,0,0,0,42,8,9,10,18,0,0,14,
-12,11,0,2,48,49,0,0,12,13,0,1,68,0,0,0,
-13,12,13,0,12,13,0,3,114,50,110,0,9,12,12,13,
-36,12,12,8,9,11,11,12,28,12,0,0,10,7,12,11,
-18,0,255,242,15,6,7,0,31,4,6,1,19,4,5,4,
-15,3,4,0,30,6,5,193,9,9,114,101,116,117,114,110,
-32,115,46,105,110,100,101,120,40,39,48,39,42,116,41,0,
-12,6,0,5,105,110,100,101,120,0,0,0,9,5,3,6,
-12,6,0,1,48,0,0,0,3,6,6,2,31,4,6,1,
-19,4,5,4,20,4,0,0,0,0,0,0,12,125,0,5,
-97,108,108,111,99,0,0,0,10,7,125,124,16,125,0,51,
-44,9,0,0,30,8,5,198,9,100,101,102,32,100,111,95,
-115,116,114,105,110,103,40,115,101,108,102,44,116,44,114,61,
-78,111,110,101,41,58,0,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,9,
-100,111,95,115,116,114,105,110,103,0,0,0,34,1,0,0,
-28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-28,3,0,0,28,4,0,0,32,3,0,4,30,9,5,199,
-9,9,114,101,116,117,114,110,32,115,101,108,102,46,95,100,
-111,95,115,116,114,105,110,103,40,116,46,118,97,108,44,114,
-41,0,0,0,12,6,0,10,95,100,111,95,115,116,114,105,
-110,103,0,0,9,5,1,6,12,8,0,3,118,97,108,0,
-9,6,2,8,15,7,3,0,31,4,6,2,19,4,5,4,
-20,4,0,0,0,0,0,0,12,126,0,9,100,111,95,115,
-116,114,105,110,103,0,0,0,10,7,126,125,16,126,0,104,
-44,11,0,0,30,8,5,202,9,100,101,102,32,95,100,111,
+12,1,0,9,100,111,95,115,116,114,105,110,103,0,0,0,
+34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
+9,2,0,3,28,3,0,0,28,4,0,0,32,3,0,4,
+30,9,5,226,9,9,114,101,116,117,114,110,32,115,101,108,
+102,46,95,100,111,95,115,116,114,105,110,103,40,116,46,118,
+97,108,44,114,41,0,0,0,12,9,0,10,95,100,111,95,
+115,116,114,105,110,103,0,0,49,5,1,9,12,9,0,3,
+118,97,108,0,9,7,2,9,15,8,3,0,50,4,5,2,
+20,4,0,0,0,0,0,0,12,128,0,9,100,111,95,115,
+116,114,105,110,103,0,0,0,10,8,128,127,16,128,0,168,
+44,12,0,0,30,8,5,229,9,100,101,102,32,95,100,111,
 95,110,117,109,98,101,114,40,115,101,108,102,44,118,44,114,
 61,78,111,110,101,41,58,0,12,1,0,9,116,105,110,121,
 112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,10,
 95,100,111,95,110,117,109,98,101,114,0,0,34,1,0,0,
 28,2,0,0,9,1,0,2,28,3,0,0,9,2,0,3,
-28,3,0,0,28,4,0,0,32,3,0,4,30,6,5,203,
+28,3,0,0,28,4,0,0,32,3,0,4,30,6,5,230,
 9,9,114,32,61,32,115,101,108,102,46,103,101,116,95,116,
-109,112,40,114,41,0,0,0,12,6,0,7,103,101,116,95,
-116,109,112,0,9,5,1,6,15,6,3,0,31,4,6,1,
-19,4,5,4,15,3,4,0,30,8,5,204,9,9,115,101,
-108,102,46,100,111,95,99,111,100,101,40,79,80,95,78,85,
-77,66,69,82,44,114,44,48,44,48,41,0,12,6,0,7,
-100,111,95,99,111,100,101,0,9,5,1,6,12,10,0,9,
-79,80,95,78,85,77,66,69,82,0,0,0,13,6,10,0,
-15,7,3,0,11,8,0,0,0,0,0,0,0,0,0,0,
-11,9,0,0,0,0,0,0,0,0,0,0,31,4,6,4,
-19,4,5,4,30,8,5,205,9,9,115,101,108,102,46,119,
-114,105,116,101,40,102,112,97,99,107,40,110,117,109,98,101,
-114,40,118,41,41,41,0,0,12,6,0,5,119,114,105,116,
-101,0,0,0,9,5,1,6,12,8,0,5,102,112,97,99,
-107,0,0,0,13,7,8,0,12,10,0,6,110,117,109,98,
-101,114,0,0,13,9,10,0,15,10,2,0,31,8,10,1,
-19,8,9,8,31,6,8,1,19,6,7,6,31,4,6,1,
-19,4,5,4,30,3,5,206,9,9,114,101,116,117,114,110,
-32,114,0,0,20,3,0,0,0,0,0,0,12,127,0,10,
-95,100,111,95,110,117,109,98,101,114,0,0,10,7,127,126,
-16,127,0,51,44,9,0,0,30,8,5,209,9,100,101,102,
+109,112,40,114,41,0,0,0,12,8,0,7,103,101,116,95,
+116,109,112,0,49,5,1,8,15,7,3,0,50,4,5,1,
+15,3,4,0,30,6,5,231,9,9,105,102,32,115,101,108,
+102,46,105,115,105,110,116,54,52,40,118,41,58,0,0,0,
+12,8,0,7,105,115,105,110,116,54,52,0,49,5,1,8,
+15,7,2,0,50,4,5,1,21,4,0,0,18,0,0,48,
+30,9,5,232,9,9,9,115,101,108,102,46,100,111,95,99,
+111,100,101,40,79,80,95,78,85,77,66,69,82,44,114,44,
+48,44,49,41,0,0,0,0,12,11,0,7,100,111,95,99,
+111,100,101,0,49,5,1,11,12,11,0,9,79,80,95,78,
+85,77,66,69,82,0,0,0,13,7,11,0,15,8,3,0,
+11,9,0,1,0,0,0,0,0,0,0,0,11,10,0,1,
+1,0,0,0,0,0,0,0,50,4,5,4,30,6,5,233,
+9,9,9,115,101,108,102,46,119,114,105,116,101,40,105,112,
+97,99,107,40,118,41,41,0,12,8,0,5,119,114,105,116,
+101,0,0,0,49,5,1,8,12,9,0,5,105,112,97,99,
+107,0,0,0,13,8,9,0,15,9,2,0,31,7,9,1,
+19,7,8,7,50,4,5,1,18,0,0,59,30,2,5,234,
+9,9,101,108,115,101,58,0,30,9,5,235,9,9,9,115,
+101,108,102,46,100,111,95,99,111,100,101,40,79,80,95,78,
+85,77,66,69,82,44,114,44,48,44,48,41,0,0,0,0,
+12,11,0,7,100,111,95,99,111,100,101,0,49,5,1,11,
+12,11,0,9,79,80,95,78,85,77,66,69,82,0,0,0,
+13,7,11,0,15,8,3,0,11,9,0,1,0,0,0,0,
+0,0,0,0,11,10,0,1,0,0,0,0,0,0,0,0,
+50,4,5,4,30,8,5,236,9,9,9,115,101,108,102,46,
+119,114,105,116,101,40,102,112,97,99,107,40,110,117,109,98,
+101,114,40,118,41,41,41,0,12,8,0,5,119,114,105,116,
+101,0,0,0,49,5,1,8,12,9,0,5,102,112,97,99,
+107,0,0,0,13,8,9,0,12,11,0,6,110,117,109,98,
+101,114,0,0,13,10,11,0,15,11,2,0,31,9,11,1,
+19,9,10,9,31,7,9,1,19,7,8,7,50,4,5,1,
+18,0,0,1,30,3,5,237,9,9,114,101,116,117,114,110,
+32,114,0,0,20,3,0,0,0,0,0,0,12,129,0,10,
+95,100,111,95,110,117,109,98,101,114,0,0,10,8,129,128,
+16,129,1,12,44,8,0,0,30,6,5,240,9,100,101,102,
+32,105,115,105,110,116,54,52,40,115,101,108,102,44,118,41,
+58,0,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
+121,0,0,0,33,1,0,0,12,1,0,7,105,115,105,110,
+116,54,52,0,34,1,0,0,28,2,0,0,9,1,0,2,
+28,3,0,0,9,2,0,3,30,6,5,241,9,9,100,105,
+103,105,116,115,32,61,32,39,48,49,50,51,52,53,54,55,
+56,57,39,0,12,4,0,10,48,49,50,51,52,53,54,55,
+56,57,0,0,15,3,4,0,30,6,5,242,9,9,105,102,
+32,118,91,48,58,50,93,32,61,61,32,39,48,120,39,58,
+0,0,0,0,11,6,0,1,0,0,0,0,0,0,0,0,
+11,7,0,1,2,0,0,0,0,0,0,0,27,5,6,2,
+9,4,2,5,12,5,0,2,48,120,0,0,23,4,4,5,
+21,4,0,0,18,0,0,86,30,4,5,243,9,9,9,118,
+32,61,32,118,91,50,58,93,0,0,0,0,11,6,0,1,
+2,0,0,0,0,0,0,0,28,7,0,0,27,5,6,2,
+9,4,2,5,15,2,4,0,30,8,5,244,9,9,9,100,
+105,103,105,116,115,32,61,32,39,48,49,50,51,52,53,54,
+55,56,57,97,98,99,100,101,102,39,0,0,12,4,0,16,
+48,49,50,51,52,53,54,55,56,57,97,98,99,100,101,102,
+0,0,0,0,15,3,4,0,30,17,5,245,9,9,9,105,
+102,32,108,101,110,40,118,41,32,62,32,49,54,32,111,114,
+32,40,108,101,110,40,118,41,32,61,61,32,49,54,32,97,
+110,100,32,118,91,48,93,32,62,32,39,55,39,41,58,32,
+114,101,116,117,114,110,32,70,97,108,115,101,0,0,0,0,
+11,4,0,1,16,0,0,0,0,0,0,0,12,7,0,3,
+108,101,110,0,13,6,7,0,15,7,2,0,31,5,7,1,
+19,5,6,5,25,4,4,5,46,4,0,0,18,0,0,20,
+12,6,0,3,108,101,110,0,13,5,6,0,15,6,2,0,
+31,4,6,1,19,4,5,4,11,5,0,1,16,0,0,0,
+0,0,0,0,23,4,4,5,21,4,0,0,18,0,0,8,
+12,4,0,1,55,0,0,0,11,6,0,1,0,0,0,0,
+0,0,0,0,9,5,2,6,25,4,4,5,21,4,0,0,
+18,0,0,6,11,4,0,1,0,0,0,0,0,0,0,0,
+20,4,0,0,18,0,0,1,18,0,0,61,30,21,5,246,
+9,9,101,108,105,102,32,108,101,110,40,118,41,32,62,32,
+49,57,32,111,114,32,40,108,101,110,40,118,41,32,61,61,
+32,49,57,32,97,110,100,32,118,32,62,32,39,57,50,50,
+51,51,55,50,48,51,54,56,53,52,55,55,53,56,48,55,
+39,41,58,32,114,101,116,117,114,110,32,70,97,108,115,101,
+0,0,0,0,11,4,0,1,19,0,0,0,0,0,0,0,
+12,7,0,3,108,101,110,0,13,6,7,0,15,7,2,0,
+31,5,7,1,19,5,6,5,25,4,4,5,46,4,0,0,
+18,0,0,20,12,6,0,3,108,101,110,0,13,5,6,0,
+15,6,2,0,31,4,6,1,19,4,5,4,11,5,0,1,
+19,0,0,0,0,0,0,0,23,4,4,5,21,4,0,0,
+18,0,0,8,12,4,0,19,57,50,50,51,51,55,50,48,
+51,54,56,53,52,55,55,53,56,48,55,0,25,4,4,2,
+21,4,0,0,18,0,0,6,11,4,0,1,0,0,0,0,
+0,0,0,0,20,4,0,0,18,0,0,1,30,8,5,247,
+9,9,105,102,32,108,101,110,40,118,41,32,61,61,32,48,
+58,32,114,101,116,117,114,110,32,70,97,108,115,101,0,0,
+12,6,0,3,108,101,110,0,13,5,6,0,15,6,2,0,
+31,4,6,1,19,4,5,4,11,5,0,1,0,0,0,0,
+0,0,0,0,23,4,4,5,21,4,0,0,18,0,0,6,
+11,4,0,1,0,0,0,0,0,0,0,0,20,4,0,0,
+18,0,0,1,30,4,5,248,9,9,102,111,114,32,99,32,
+105,110,32,118,58,0,0,0,11,5,0,1,0,0,0,0,
+0,0,0,0,42,4,2,5,18,0,0,24,30,9,5,249,
+9,9,9,105,102,32,99,32,110,111,116,32,105,110,32,100,
+105,103,105,116,115,58,32,114,101,116,117,114,110,32,70,97,
+108,115,101,0,36,6,3,4,11,7,0,1,0,0,0,0,
+0,0,0,0,23,6,6,7,21,6,0,0,18,0,0,6,
+11,6,0,1,0,0,0,0,0,0,0,0,20,6,0,0,
+18,0,0,1,18,0,255,232,30,4,5,250,9,9,114,101,
+116,117,114,110,32,84,114,117,101,0,0,0,11,5,0,1,
+1,0,0,0,0,0,0,0,20,5,0,0,0,0,0,0,
+12,130,0,7,105,115,105,110,116,54,52,0,10,8,130,129,
+16,130,0,50,44,10,0,0,30,8,5,253,9,100,101,102,
 32,100,111,95,110,117,109,98,101,114,40,115,101,108,102,44,
 116,44,114,61,78,111,110,101,41,58,0,0,12,1,0,9,
 116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
 12,1,0,9,100,111,95,110,117,109,98,101,114,0,0,0,
 34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
 9,2,0,3,28,3,0,0,28,4,0,0,32,3,0,4,
-30,9,5,210,9,9,114,101,116,117,114,110,32,115,101,108,
+30,9,5,254,9,9,114,101,116,117,114,110,32,115,101,108,
 102,46,95,100,111,95,110,117,109,98,101,114,40,116,46,118,
-97,108,44,114,41,0,0,0,12,6,0,10,95,100,111,95,
-110,117,109,98,101,114,0,0,9,5,1,6,12,8,0,3,
-118,97,108,0,9,6,2,8,15,7,3,0,31,4,6,2,
-19,4,5,4,20,4,0,0,0,0,0,0,12,128,0,9,
-100,111,95,110,117,109,98,101,114,0,0,0,10,7,128,127,
-16,128,0,67,44,7,0,0,30,5,5,213,9,100,101,102,
-32,103,101,116,95,116,97,103,40,115,101,108,102,41,58,0,
-12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
-33,1,0,0,12,1,0,7,103,101,116,95,116,97,103,0,
-34,1,0,0,28,2,0,0,9,1,0,2,30,5,5,214,
-9,9,107,32,61,32,115,116,114,40,68,46,95,116,97,103,
-105,41,0,0,12,5,0,3,115,116,114,0,13,4,5,0,
-12,6,0,1,68,0,0,0,13,5,6,0,12,6,0,5,
-95,116,97,103,105,0,0,0,9,5,5,6,31,3,5,1,
-19,3,4,3,15,2,3,0,30,4,5,215,9,9,68,46,
-95,116,97,103,105,32,43,61,32,49,0,0,12,4,0,1,
-68,0,0,0,13,3,4,0,12,5,0,1,68,0,0,0,
-13,4,5,0,12,5,0,5,95,116,97,103,105,0,0,0,
-9,4,4,5,11,5,0,0,0,0,0,0,0,0,240,63,
-1,4,4,5,12,5,0,5,95,116,97,103,105,0,0,0,
-10,3,5,4,30,3,5,216,9,9,114,101,116,117,114,110,
-32,107,0,0,20,2,0,0,0,0,0,0,12,129,0,7,
-103,101,116,95,116,97,103,0,10,7,129,128,16,129,0,62,
-44,6,0,0,30,6,5,219,9,100,101,102,32,115,116,97,
-99,107,95,116,97,103,40,115,101,108,102,41,58,0,0,0,
-12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
-33,1,0,0,12,1,0,9,115,116,97,99,107,95,116,97,
-103,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
-30,6,5,220,9,9,107,32,61,32,115,101,108,102,46,103,
-101,116,95,116,97,103,40,41,0,0,0,0,12,5,0,7,
-103,101,116,95,116,97,103,0,9,4,1,5,31,3,0,0,
-19,3,4,3,15,2,3,0,30,6,5,221,9,9,68,46,
-116,115,116,97,99,107,46,97,112,112,101,110,100,40,107,41,
-0,0,0,0,12,5,0,1,68,0,0,0,13,4,5,0,
-12,5,0,6,116,115,116,97,99,107,0,0,9,4,4,5,
-12,5,0,6,97,112,112,101,110,100,0,0,9,4,4,5,
-15,5,2,0,31,3,5,1,19,3,4,3,30,3,5,222,
-9,9,114,101,116,117,114,110,32,107,0,0,20,2,0,0,
-0,0,0,0,12,130,0,9,115,116,97,99,107,95,116,97,
-103,0,0,0,10,7,130,129,16,130,0,38,44,5,0,0,
-30,5,5,225,9,100,101,102,32,112,111,112,95,116,97,103,
-40,115,101,108,102,41,58,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,7,
-112,111,112,95,116,97,103,0,34,1,0,0,28,2,0,0,
-9,1,0,2,30,5,5,226,9,9,68,46,116,115,116,97,
-99,107,46,112,111,112,40,41,0,0,0,0,12,4,0,1,
-68,0,0,0,13,3,4,0,12,4,0,6,116,115,116,97,
-99,107,0,0,9,3,3,4,12,4,0,3,112,111,112,0,
-9,3,3,4,31,2,0,0,19,2,3,2,0,0,0,0,
-12,131,0,7,112,111,112,95,116,97,103,0,10,7,131,130,
-16,131,0,114,44,13,0,0,30,7,5,230,9,100,101,102,
+97,108,44,114,41,0,0,0,12,9,0,10,95,100,111,95,
+110,117,109,98,101,114,0,0,49,5,1,9,12,9,0,3,
+118,97,108,0,9,7,2,9,15,8,3,0,50,4,5,2,
+20,4,0,0,0,0,0,0,12,131,0,9,100,111,95,110,
+117,109,98,101,114,0,0,0,10,8,131,130,16,131,0,67,
+44,7,0,0,30,5,6,1,9,100,101,102,32,103,101,116,
+95,116,97,103,40,115,101,108,102,41,58,0,12,1,0,9,
+116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
+12,1,0,7,103,101,116,95,116,97,103,0,34,1,0,0,
+28,2,0,0,9,1,0,2,30,5,6,2,9,9,107,32,
+61,32,115,116,114,40,68,46,95,116,97,103,105,41,0,0,
+12,5,0,3,115,116,114,0,13,4,5,0,12,6,0,1,
+68,0,0,0,13,5,6,0,12,6,0,5,95,116,97,103,
+105,0,0,0,9,5,5,6,31,3,5,1,19,3,4,3,
+15,2,3,0,30,4,6,3,9,9,68,46,95,116,97,103,
+105,32,43,61,32,49,0,0,12,4,0,1,68,0,0,0,
+13,3,4,0,12,5,0,1,68,0,0,0,13,4,5,0,
+12,5,0,5,95,116,97,103,105,0,0,0,9,4,4,5,
+11,5,0,1,1,0,0,0,0,0,0,0,1,4,4,5,
+12,5,0,5,95,116,97,103,105,0,0,0,10,3,5,4,
+30,3,6,4,9,9,114,101,116,117,114,110,32,107,0,0,
+20,2,0,0,0,0,0,0,12,132,0,7,103,101,116,95,
+116,97,103,0,10,8,132,131,16,132,0,60,44,9,0,0,
+30,6,6,7,9,100,101,102,32,115,116,97,99,107,95,116,
+97,103,40,115,101,108,102,41,58,0,0,0,12,1,0,9,
+116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
+12,1,0,9,115,116,97,99,107,95,116,97,103,0,0,0,
+34,1,0,0,28,2,0,0,9,1,0,2,30,6,6,8,
+9,9,107,32,61,32,115,101,108,102,46,103,101,116,95,116,
+97,103,40,41,0,0,0,0,12,6,0,7,103,101,116,95,
+116,97,103,0,49,4,1,6,50,3,4,0,15,2,3,0,
+30,6,6,9,9,9,68,46,116,115,116,97,99,107,46,97,
+112,112,101,110,100,40,107,41,0,0,0,0,12,8,0,1,
+68,0,0,0,13,7,8,0,12,8,0,6,116,115,116,97,
+99,107,0,0,9,7,7,8,12,8,0,6,97,112,112,101,
+110,100,0,0,49,4,7,8,15,6,2,0,50,3,4,1,
+30,3,6,10,9,9,114,101,116,117,114,110,32,107,0,0,
+20,2,0,0,0,0,0,0,12,133,0,9,115,116,97,99,
+107,95,116,97,103,0,0,0,10,8,133,132,16,133,0,37,
+44,7,0,0,30,5,6,13,9,100,101,102,32,112,111,112,
+95,116,97,103,40,115,101,108,102,41,58,0,12,1,0,9,
+116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
+12,1,0,7,112,111,112,95,116,97,103,0,34,1,0,0,
+28,2,0,0,9,1,0,2,30,5,6,14,9,9,68,46,
+116,115,116,97,99,107,46,112,111,112,40,41,0,0,0,0,
+12,6,0,1,68,0,0,0,13,5,6,0,12,6,0,6,
+116,115,116,97,99,107,0,0,9,5,5,6,12,6,0,3,
+112,111,112,0,49,3,5,6,50,2,3,0,0,0,0,0,
+12,134,0,7,112,111,112,95,116,97,103,0,10,8,134,133,
+16,134,0,111,44,14,0,0,30,7,6,18,9,100,101,102,
 32,100,111,95,102,117,110,99,116,105,111,110,40,115,101,108,
 102,44,42,116,41,58,0,0,12,1,0,9,116,105,110,121,
 112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,11,
 100,111,95,102,117,110,99,116,105,111,110,0,34,1,0,0,
 28,2,0,0,9,1,0,2,12,3,0,1,42,0,0,0,
-9,2,0,3,30,12,5,231,9,9,116,32,61,32,68,46,
-115,110,117,109,43,39,58,39,43,39,58,39,46,106,111,105,
-110,40,91,115,116,114,40,118,41,32,102,111,114,32,118,32,
-105,110,32,116,93,41,0,0,12,4,0,1,68,0,0,0,
-13,3,4,0,12,4,0,4,115,110,117,109,0,0,0,0,
-9,3,3,4,12,4,0,1,58,0,0,0,1,3,3,4,
-12,5,0,1,58,0,0,0,12,6,0,4,106,111,105,110,
-0,0,0,0,9,5,5,6,27,7,0,0,11,9,0,0,
-0,0,0,0,0,0,0,0,42,8,2,9,18,0,0,10,
-12,12,0,3,115,116,114,0,13,11,12,0,15,12,8,0,
-31,10,12,1,19,10,11,10,28,11,0,0,10,7,11,10,
-18,0,255,246,15,6,7,0,31,4,6,1,19,4,5,4,
-1,3,3,4,15,2,3,0,30,6,5,232,9,9,114,32,
-61,32,115,101,108,102,46,103,101,116,95,114,101,103,40,116,
-41,0,0,0,12,6,0,7,103,101,116,95,114,101,103,0,
-9,5,1,6,15,6,2,0,31,4,6,1,19,4,5,4,
-15,3,4,0,30,7,5,233,9,9,115,101,108,102,46,105,
-110,115,101,114,116,40,40,39,102,110,99,39,44,114,44,116,
-41,41,0,0,12,6,0,6,105,110,115,101,114,116,0,0,
-9,5,1,6,12,9,0,3,102,110,99,0,15,10,3,0,
-15,11,2,0,27,6,9,3,31,4,6,1,19,4,5,4,
-30,3,5,234,9,9,114,101,116,117,114,110,32,114,0,0,
-20,3,0,0,0,0,0,0,12,132,0,11,100,111,95,102,
-117,110,99,116,105,111,110,0,10,7,132,131,16,132,0,89,
-44,13,0,0,30,5,5,237,9,100,101,102,32,116,97,103,
-40,115,101,108,102,44,42,116,41,58,0,0,12,1,0,9,
-116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,3,116,97,103,0,34,1,0,0,28,2,0,0,
-9,1,0,2,12,3,0,1,42,0,0,0,9,2,0,3,
-30,12,5,238,9,9,116,32,61,32,68,46,115,110,117,109,
-43,39,58,39,43,39,58,39,46,106,111,105,110,40,91,115,
-116,114,40,118,41,32,102,111,114,32,118,32,105,110,32,116,
-93,41,0,0,12,4,0,1,68,0,0,0,13,3,4,0,
-12,4,0,4,115,110,117,109,0,0,0,0,9,3,3,4,
-12,4,0,1,58,0,0,0,1,3,3,4,12,5,0,1,
-58,0,0,0,12,6,0,4,106,111,105,110,0,0,0,0,
-9,5,5,6,27,7,0,0,11,9,0,0,0,0,0,0,
-0,0,0,0,42,8,2,9,18,0,0,10,12,12,0,3,
-115,116,114,0,13,11,12,0,15,12,8,0,31,10,12,1,
-19,10,11,10,28,11,0,0,10,7,11,10,18,0,255,246,
-15,6,7,0,31,4,6,1,19,4,5,4,1,3,3,4,
-15,2,3,0,30,7,5,239,9,9,115,101,108,102,46,105,
-110,115,101,114,116,40,40,39,116,97,103,39,44,116,41,41,
-0,0,0,0,12,5,0,6,105,110,115,101,114,116,0,0,
-9,4,1,5,12,9,0,3,116,97,103,0,15,10,2,0,
-27,5,9,2,31,3,5,1,19,3,4,3,0,0,0,0,
-12,133,0,3,116,97,103,0,10,7,133,132,16,133,0,91,
-44,13,0,0,30,5,5,242,9,100,101,102,32,106,117,109,
-112,40,115,101,108,102,44,42,116,41,58,0,12,1,0,9,
-116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,4,106,117,109,112,0,0,0,0,34,1,0,0,
-28,2,0,0,9,1,0,2,12,3,0,1,42,0,0,0,
-9,2,0,3,30,12,5,243,9,9,116,32,61,32,68,46,
+9,2,0,3,30,12,6,19,9,9,116,32,61,32,68,46,
 115,110,117,109,43,39,58,39,43,39,58,39,46,106,111,105,
 110,40,91,115,116,114,40,118,41,32,102,111,114,32,118,32,
 105,110,32,116,93,41,0,0,12,4,0,1,68,0,0,0,
 13,3,4,0,12,4,0,4,115,110,117,109,0,0,0,0,
 9,3,3,4,12,4,0,1,58,0,0,0,1,3,3,4,
-12,5,0,1,58,0,0,0,12,6,0,4,106,111,105,110,
-0,0,0,0,9,5,5,6,27,7,0,0,11,9,0,0,
-0,0,0,0,0,0,0,0,42,8,2,9,18,0,0,10,
-12,12,0,3,115,116,114,0,13,11,12,0,15,12,8,0,
-31,10,12,1,19,10,11,10,28,11,0,0,10,7,11,10,
-18,0,255,246,15,6,7,0,31,4,6,1,19,4,5,4,
-1,3,3,4,15,2,3,0,30,7,5,244,9,9,115,101,
-108,102,46,105,110,115,101,114,116,40,40,39,106,117,109,112,
-39,44,116,41,41,0,0,0,12,5,0,6,105,110,115,101,
-114,116,0,0,9,4,1,5,12,9,0,4,106,117,109,112,
-0,0,0,0,15,10,2,0,27,5,9,2,31,3,5,1,
-19,3,4,3,0,0,0,0,12,134,0,4,106,117,109,112,
-0,0,0,0,10,7,134,133,16,134,0,92,44,13,0,0,
-30,6,5,247,9,100,101,102,32,115,101,116,106,109,112,40,
-115,101,108,102,44,42,116,41,58,0,0,0,12,1,0,9,
-116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,6,115,101,116,106,109,112,0,0,34,1,0,0,
+12,8,0,1,58,0,0,0,12,9,0,4,106,111,105,110,
+0,0,0,0,49,5,8,9,27,8,0,0,11,10,0,1,
+0,0,0,0,0,0,0,0,42,9,2,10,18,0,0,10,
+12,13,0,3,115,116,114,0,13,12,13,0,15,13,9,0,
+31,11,13,1,19,11,12,11,28,12,0,0,10,8,12,11,
+18,0,255,246,15,7,8,0,50,4,5,1,1,3,3,4,
+15,2,3,0,30,6,6,20,9,9,114,32,61,32,115,101,
+108,102,46,103,101,116,95,114,101,103,40,116,41,0,0,0,
+12,10,0,7,103,101,116,95,114,101,103,0,49,5,1,10,
+15,7,2,0,50,4,5,1,15,3,4,0,30,7,6,21,
+9,9,115,101,108,102,46,105,110,115,101,114,116,40,40,39,
+102,110,99,39,44,114,44,116,41,41,0,0,12,10,0,6,
+105,110,115,101,114,116,0,0,49,5,1,10,12,10,0,3,
+102,110,99,0,15,11,3,0,15,12,2,0,27,7,10,3,
+50,4,5,1,30,3,6,22,9,9,114,101,116,117,114,110,
+32,114,0,0,20,3,0,0,0,0,0,0,12,135,0,11,
+100,111,95,102,117,110,99,116,105,111,110,0,10,8,135,134,
+16,135,0,87,44,14,0,0,30,5,6,25,9,100,101,102,
+32,116,97,103,40,115,101,108,102,44,42,116,41,58,0,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,3,116,97,103,0,34,1,0,0,
 28,2,0,0,9,1,0,2,12,3,0,1,42,0,0,0,
-9,2,0,3,30,12,5,248,9,9,116,32,61,32,68,46,
+9,2,0,3,30,12,6,26,9,9,116,32,61,32,68,46,
 115,110,117,109,43,39,58,39,43,39,58,39,46,106,111,105,
 110,40,91,115,116,114,40,118,41,32,102,111,114,32,118,32,
 105,110,32,116,93,41,0,0,12,4,0,1,68,0,0,0,
 13,3,4,0,12,4,0,4,115,110,117,109,0,0,0,0,
 9,3,3,4,12,4,0,1,58,0,0,0,1,3,3,4,
-12,5,0,1,58,0,0,0,12,6,0,4,106,111,105,110,
-0,0,0,0,9,5,5,6,27,7,0,0,11,9,0,0,
-0,0,0,0,0,0,0,0,42,8,2,9,18,0,0,10,
-12,12,0,3,115,116,114,0,13,11,12,0,15,12,8,0,
-31,10,12,1,19,10,11,10,28,11,0,0,10,7,11,10,
-18,0,255,246,15,6,7,0,31,4,6,1,19,4,5,4,
-1,3,3,4,15,2,3,0,30,7,5,249,9,9,115,101,
+12,8,0,1,58,0,0,0,12,9,0,4,106,111,105,110,
+0,0,0,0,49,5,8,9,27,8,0,0,11,10,0,1,
+0,0,0,0,0,0,0,0,42,9,2,10,18,0,0,10,
+12,13,0,3,115,116,114,0,13,12,13,0,15,13,9,0,
+31,11,13,1,19,11,12,11,28,12,0,0,10,8,12,11,
+18,0,255,246,15,7,8,0,50,4,5,1,1,3,3,4,
+15,2,3,0,30,7,6,27,9,9,115,101,108,102,46,105,
+110,115,101,114,116,40,40,39,116,97,103,39,44,116,41,41,
+0,0,0,0,12,7,0,6,105,110,115,101,114,116,0,0,
+49,4,1,7,12,10,0,3,116,97,103,0,15,11,2,0,
+27,6,10,2,50,3,4,1,0,0,0,0,12,136,0,3,
+116,97,103,0,10,8,136,135,16,136,0,89,44,14,0,0,
+30,5,6,30,9,100,101,102,32,106,117,109,112,40,115,101,
+108,102,44,42,116,41,58,0,12,1,0,9,116,105,110,121,
+112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,4,
+106,117,109,112,0,0,0,0,34,1,0,0,28,2,0,0,
+9,1,0,2,12,3,0,1,42,0,0,0,9,2,0,3,
+30,12,6,31,9,9,116,32,61,32,68,46,115,110,117,109,
+43,39,58,39,43,39,58,39,46,106,111,105,110,40,91,115,
+116,114,40,118,41,32,102,111,114,32,118,32,105,110,32,116,
+93,41,0,0,12,4,0,1,68,0,0,0,13,3,4,0,
+12,4,0,4,115,110,117,109,0,0,0,0,9,3,3,4,
+12,4,0,1,58,0,0,0,1,3,3,4,12,8,0,1,
+58,0,0,0,12,9,0,4,106,111,105,110,0,0,0,0,
+49,5,8,9,27,8,0,0,11,10,0,1,0,0,0,0,
+0,0,0,0,42,9,2,10,18,0,0,10,12,13,0,3,
+115,116,114,0,13,12,13,0,15,13,9,0,31,11,13,1,
+19,11,12,11,28,12,0,0,10,8,12,11,18,0,255,246,
+15,7,8,0,50,4,5,1,1,3,3,4,15,2,3,0,
+30,7,6,32,9,9,115,101,108,102,46,105,110,115,101,114,
+116,40,40,39,106,117,109,112,39,44,116,41,41,0,0,0,
+12,7,0,6,105,110,115,101,114,116,0,0,49,4,1,7,
+12,10,0,4,106,117,109,112,0,0,0,0,15,11,2,0,
+27,6,10,2,50,3,4,1,0,0,0,0,12,137,0,4,
+106,117,109,112,0,0,0,0,10,8,137,136,16,137,0,90,
+44,14,0,0,30,6,6,35,9,100,101,102,32,115,101,116,
+106,109,112,40,115,101,108,102,44,42,116,41,58,0,0,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,6,115,101,116,106,109,112,0,0,
+34,1,0,0,28,2,0,0,9,1,0,2,12,3,0,1,
+42,0,0,0,9,2,0,3,30,12,6,36,9,9,116,32,
+61,32,68,46,115,110,117,109,43,39,58,39,43,39,58,39,
+46,106,111,105,110,40,91,115,116,114,40,118,41,32,102,111,
+114,32,118,32,105,110,32,116,93,41,0,0,12,4,0,1,
+68,0,0,0,13,3,4,0,12,4,0,4,115,110,117,109,
+0,0,0,0,9,3,3,4,12,4,0,1,58,0,0,0,
+1,3,3,4,12,8,0,1,58,0,0,0,12,9,0,4,
+106,111,105,110,0,0,0,0,49,5,8,9,27,8,0,0,
+11,10,0,1,0,0,0,0,0,0,0,0,42,9,2,10,
+18,0,0,10,12,13,0,3,115,116,114,0,13,12,13,0,
+15,13,9,0,31,11,13,1,19,11,12,11,28,12,0,0,
+10,8,12,11,18,0,255,246,15,7,8,0,50,4,5,1,
+1,3,3,4,15,2,3,0,30,7,6,37,9,9,115,101,
 108,102,46,105,110,115,101,114,116,40,40,39,115,101,116,106,
-109,112,39,44,116,41,41,0,12,5,0,6,105,110,115,101,
-114,116,0,0,9,4,1,5,12,9,0,6,115,101,116,106,
-109,112,0,0,15,10,2,0,27,5,9,2,31,3,5,1,
-19,3,4,3,0,0,0,0,12,135,0,6,115,101,116,106,
-109,112,0,0,10,7,135,134,16,135,0,195,44,10,0,0,
-30,6,5,252,9,100,101,102,32,100,111,40,115,101,108,102,
-44,116,44,114,61,78,111,110,101,41,58,0,12,1,0,9,
-116,105,110,121,112,121,46,112,121,0,0,0,33,1,0,0,
-12,1,0,2,100,111,0,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,28,3,0,0,
-28,4,0,0,32,3,0,4,30,8,5,253,9,9,105,102,
-32,116,46,112,111,115,58,32,115,101,108,102,46,115,101,116,
-112,111,115,40,116,46,112,111,115,41,0,0,12,5,0,3,
-112,111,115,0,9,4,2,5,21,4,0,0,18,0,0,11,
-12,6,0,6,115,101,116,112,111,115,0,0,9,5,1,6,
-12,7,0,3,112,111,115,0,9,6,2,7,31,4,6,1,
-19,4,5,4,18,0,0,1,30,2,5,254,9,9,116,114,
-121,58,0,0,38,0,0,69,30,7,5,255,9,9,9,105,
-102,32,116,46,116,121,112,101,32,105,110,32,115,101,108,102,
-46,114,109,97,112,58,0,0,12,5,0,4,114,109,97,112,
-0,0,0,0,9,4,1,5,12,6,0,4,116,121,112,101,
-0,0,0,0,9,5,2,6,36,4,4,5,21,4,0,0,
-18,0,0,26,30,9,6,0,9,9,9,9,114,101,116,117,
-114,110,32,115,101,108,102,46,114,109,97,112,91,116,46,116,
-121,112,101,93,40,116,44,114,41,0,0,0,12,6,0,4,
-114,109,97,112,0,0,0,0,9,5,1,6,12,7,0,4,
-116,121,112,101,0,0,0,0,9,6,2,7,9,5,5,6,
-15,6,2,0,15,7,3,0,31,4,6,2,19,4,5,4,
-20,4,0,0,18,0,0,1,30,8,6,1,9,9,9,114,
-101,116,117,114,110,32,115,101,108,102,46,102,109,97,112,91,
-116,46,116,121,112,101,93,40,116,41,0,0,12,6,0,4,
-102,109,97,112,0,0,0,0,9,5,1,6,12,7,0,4,
-116,121,112,101,0,0,0,0,9,6,2,7,9,5,5,6,
-15,6,2,0,31,4,6,1,19,4,5,4,20,4,0,0,
-38,0,0,0,18,0,0,75,30,3,6,2,9,9,101,120,
-99,101,112,116,58,0,0,0,30,6,6,3,9,9,9,105,
+109,112,39,44,116,41,41,0,12,7,0,6,105,110,115,101,
+114,116,0,0,49,4,1,7,12,10,0,6,115,101,116,106,
+109,112,0,0,15,11,2,0,27,6,10,2,50,3,4,1,
+0,0,0,0,12,138,0,6,115,101,116,106,109,112,0,0,
+10,8,138,137,16,138,0,192,44,12,0,0,30,6,6,40,
+9,100,101,102,32,100,111,40,115,101,108,102,44,116,44,114,
+61,78,111,110,101,41,58,0,12,1,0,9,116,105,110,121,
+112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,2,
+100,111,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
+28,3,0,0,9,2,0,3,28,3,0,0,28,4,0,0,
+32,3,0,4,30,8,6,41,9,9,105,102,32,116,46,112,
+111,115,58,32,115,101,108,102,46,115,101,116,112,111,115,40,
+116,46,112,111,115,41,0,0,12,5,0,3,112,111,115,0,
+9,4,2,5,21,4,0,0,18,0,0,10,12,8,0,6,
+115,101,116,112,111,115,0,0,49,5,1,8,12,8,0,3,
+112,111,115,0,9,7,2,8,50,4,5,1,18,0,0,1,
+30,2,6,42,9,9,116,114,121,58,0,0,38,0,0,67,
+30,7,6,43,9,9,9,105,102,32,116,46,116,121,112,101,
+32,105,110,32,115,101,108,102,46,114,109,97,112,58,0,0,
+12,5,0,4,114,109,97,112,0,0,0,0,9,4,1,5,
+12,6,0,4,116,121,112,101,0,0,0,0,9,5,2,6,
+36,4,4,5,21,4,0,0,18,0,0,25,30,9,6,44,
+9,9,9,9,114,101,116,117,114,110,32,115,101,108,102,46,
+114,109,97,112,91,116,46,116,121,112,101,93,40,116,44,114,
+41,0,0,0,12,10,0,4,114,109,97,112,0,0,0,0,
+9,9,1,10,12,11,0,4,116,121,112,101,0,0,0,0,
+9,10,2,11,49,5,9,10,15,7,2,0,15,8,3,0,
+50,4,5,2,20,4,0,0,18,0,0,1,30,8,6,45,
+9,9,9,114,101,116,117,114,110,32,115,101,108,102,46,102,
+109,97,112,91,116,46,116,121,112,101,93,40,116,41,0,0,
+12,9,0,4,102,109,97,112,0,0,0,0,9,8,1,9,
+12,10,0,4,116,121,112,101,0,0,0,0,9,9,2,10,
+49,5,8,9,15,7,2,0,50,4,5,1,20,4,0,0,
+38,0,0,0,18,0,0,75,30,3,6,46,9,9,101,120,
+99,101,112,116,58,0,0,0,30,6,6,47,9,9,9,105,
 102,32,68,46,101,114,114,111,114,58,32,114,97,105,115,101,
 0,0,0,0,12,5,0,1,68,0,0,0,13,4,5,0,
 12,5,0,5,101,114,114,111,114,0,0,0,9,4,4,5,
 21,4,0,0,18,0,0,4,28,4,0,0,37,4,0,0,
-18,0,0,1,30,5,6,4,9,9,9,68,46,101,114,114,
+18,0,0,1,30,5,6,48,9,9,9,68,46,101,114,114,
 111,114,32,61,32,84,114,117,101,0,0,0,12,5,0,1,
-68,0,0,0,13,4,5,0,11,5,0,0,0,0,0,0,
-0,0,240,63,12,6,0,5,101,114,114,111,114,0,0,0,
-10,4,6,5,30,12,6,5,9,9,9,114,97,105,115,101,
+68,0,0,0,13,4,5,0,11,5,0,1,1,0,0,0,
+0,0,0,0,12,6,0,5,101,114,114,111,114,0,0,0,
+10,4,6,5,30,12,6,49,9,9,9,114,97,105,115,101,
 69,114,114,111,114,40,39,69,110,99,111,100,101,114,46,100,
 111,39,44,68,46,115,111,117,114,99,101,95,99,111,100,101,
 44,116,46,112,111,115,41,0,12,6,0,10,114,97,105,115,
@@ -6379,252 +6465,248 @@ unsigned char py_tinypy[] = {
 68,0,0,0,13,7,9,0,12,9,0,11,115,111,117,114,
 99,101,95,99,111,100,101,0,9,7,7,9,12,9,0,3,
 112,111,115,0,9,8,2,9,31,4,6,3,19,4,5,4,
-0,0,0,0,12,136,0,2,100,111,0,0,10,7,136,135,
-16,136,1,127,44,14,0,0,30,9,6,9,9,100,101,102,
+0,0,0,0,12,139,0,2,100,111,0,0,10,8,139,138,
+16,139,1,120,44,14,0,0,30,9,6,53,9,100,101,102,
 32,100,111,69,110,99,111,100,101,40,115,101,108,102,44,102,
 105,108,101,110,97,109,101,44,115,44,116,41,58,0,0,0,
 12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
 33,1,0,0,12,1,0,8,100,111,69,110,99,111,100,101,
 0,0,0,0,34,1,0,0,28,2,0,0,9,1,0,2,
 28,3,0,0,9,2,0,3,28,4,0,0,9,3,0,4,
-28,5,0,0,9,4,0,5,30,11,6,10,9,9,116,32,
+28,5,0,0,9,4,0,5,30,11,6,54,9,9,116,32,
 61,32,84,111,107,101,110,40,40,49,44,49,41,44,39,109,
 111,100,117,108,101,39,44,39,109,111,100,117,108,101,39,44,
 91,116,93,41,0,0,0,0,12,7,0,5,84,111,107,101,
-110,0,0,0,13,6,7,0,11,11,0,0,0,0,0,0,
-0,0,240,63,11,12,0,0,0,0,0,0,0,0,240,63,
+110,0,0,0,13,6,7,0,11,11,0,1,1,0,0,0,
+0,0,0,0,11,12,0,1,1,0,0,0,0,0,0,0,
 27,7,11,2,12,8,0,6,109,111,100,117,108,101,0,0,
 12,9,0,6,109,111,100,117,108,101,0,0,15,11,4,0,
 27,10,11,1,31,5,7,4,19,5,6,5,15,4,5,0,
-30,3,6,11,9,9,103,108,111,98,97,108,32,68,0,0,
-30,6,6,12,9,9,116,111,107,101,110,105,122,101,114,61,
+30,3,6,55,9,9,103,108,111,98,97,108,32,68,0,0,
+30,6,6,56,9,9,116,111,107,101,110,105,122,101,114,61,
 84,111,107,101,110,105,122,101,114,40,41,0,12,8,0,9,
 84,111,107,101,110,105,122,101,114,0,0,0,13,7,8,0,
-31,6,0,0,19,6,7,6,15,5,6,0,30,7,6,13,
+31,6,0,0,19,6,7,6,15,5,6,0,30,7,6,57,
 9,9,115,32,61,32,116,111,107,101,110,105,122,101,114,46,
-99,108,101,97,110,40,115,41,0,0,0,0,12,8,0,5,
-99,108,101,97,110,0,0,0,9,7,5,8,15,8,3,0,
-31,6,8,1,19,6,7,6,15,3,6,0,30,4,6,15,
-9,9,99,108,97,115,115,32,83,116,97,116,117,115,58,0,
-26,6,0,0,12,7,0,6,83,116,97,116,117,115,0,0,
-14,7,6,0,12,9,0,7,115,101,116,109,101,116,97,0,
-13,8,9,0,15,9,6,0,12,11,0,6,111,98,106,101,
-99,116,0,0,13,10,11,0,31,7,9,2,19,7,8,7,
-30,4,6,18,9,9,68,32,61,32,83,116,97,116,117,115,
-40,41,0,0,12,6,0,1,68,0,0,0,12,9,0,6,
-83,116,97,116,117,115,0,0,13,8,9,0,31,7,0,0,
-19,7,8,7,14,6,7,0,30,5,6,19,9,9,68,46,
-115,111,117,114,99,101,95,99,111,100,101,32,61,32,115,0,
-12,7,0,1,68,0,0,0,13,6,7,0,12,7,0,11,
-115,111,117,114,99,101,95,99,111,100,101,0,10,6,7,3,
-30,6,6,20,9,9,68,46,102,105,108,101,110,97,109,101,
-32,61,32,102,105,108,101,110,97,109,101,0,12,7,0,1,
-68,0,0,0,13,6,7,0,12,7,0,8,102,105,108,101,
-110,97,109,101,0,0,0,0,10,6,7,2,30,10,6,21,
-9,9,68,46,108,105,110,101,115,32,61,32,68,46,115,111,
-117,114,99,101,95,99,111,100,101,46,115,112,108,105,116,40,
-39,92,110,39,41,0,0,0,12,7,0,1,68,0,0,0,
-13,6,7,0,12,9,0,1,68,0,0,0,13,8,9,0,
-12,9,0,11,115,111,117,114,99,101,95,99,111,100,101,0,
-9,8,8,9,12,9,0,5,115,112,108,105,116,0,0,0,
-9,8,8,9,12,9,0,1,10,0,0,0,31,7,9,1,
-19,7,8,7,12,8,0,5,108,105,110,101,115,0,0,0,
-10,6,8,7,30,21,6,22,9,9,68,46,115,116,97,99,
-107,44,68,46,111,117,116,44,68,46,95,115,99,111,112,101,
-105,44,68,46,116,115,116,97,99,107,44,68,46,95,116,97,
-103,105,44,68,46,100,97,116,97,32,61,32,91,93,44,91,
-40,39,116,97,103,39,44,39,79,80,95,69,79,70,39,41,
-93,44,48,44,91,93,44,48,44,123,125,0,27,7,0,0,
-15,6,7,0,12,10,0,3,116,97,103,0,12,11,0,6,
-79,80,95,69,79,70,0,0,27,9,10,2,27,8,9,1,
-15,7,8,0,11,9,0,0,0,0,0,0,0,0,0,0,
-15,8,9,0,27,10,0,0,15,9,10,0,11,11,0,0,
-0,0,0,0,0,0,0,0,15,10,11,0,26,12,0,0,
-15,11,12,0,12,13,0,1,68,0,0,0,13,12,13,0,
-12,13,0,5,115,116,97,99,107,0,0,0,10,12,13,6,
-12,12,0,1,68,0,0,0,13,6,12,0,12,12,0,3,
-111,117,116,0,10,6,12,7,12,7,0,1,68,0,0,0,
-13,6,7,0,12,7,0,7,95,115,99,111,112,101,105,0,
-10,6,7,8,12,7,0,1,68,0,0,0,13,6,7,0,
-12,7,0,6,116,115,116,97,99,107,0,0,10,6,7,9,
-12,7,0,1,68,0,0,0,13,6,7,0,12,7,0,5,
-95,116,97,103,105,0,0,0,10,6,7,10,12,7,0,1,
-68,0,0,0,13,6,7,0,12,7,0,4,100,97,116,97,
-0,0,0,0,10,6,7,11,30,5,6,23,9,9,68,46,
-101,114,114,111,114,32,61,32,70,97,108,115,101,9,0,0,
-12,7,0,1,68,0,0,0,13,6,7,0,11,7,0,0,
-0,0,0,0,0,0,0,0,12,8,0,5,101,114,114,111,
-114,0,0,0,10,6,8,7,30,5,6,25,9,9,115,101,
-108,102,46,98,101,103,105,110,40,84,114,117,101,41,0,0,
-12,8,0,5,98,101,103,105,110,0,0,0,9,7,1,8,
-11,8,0,0,0,0,0,0,0,0,240,63,31,6,8,1,
-19,6,7,6,30,4,6,26,9,9,115,101,108,102,46,100,
-111,40,116,41,0,0,0,0,12,8,0,2,100,111,0,0,
-9,7,1,8,15,8,4,0,31,6,8,1,19,6,7,6,
-30,4,6,27,9,9,115,101,108,102,46,101,110,100,40,41,
-0,0,0,0,12,8,0,3,101,110,100,0,9,7,1,8,
-31,6,0,0,19,6,7,6,30,5,6,28,9,9,115,101,
-108,102,46,109,97,112,95,116,97,103,115,40,41,0,0,0,
-12,8,0,8,109,97,112,95,116,97,103,115,0,0,0,0,
-9,7,1,8,31,6,0,0,19,6,7,6,30,6,6,29,
-9,9,111,117,116,32,61,32,68,46,111,117,116,59,32,68,
-32,61,32,78,111,110,101,0,12,8,0,1,68,0,0,0,
-13,7,8,0,12,8,0,3,111,117,116,0,9,7,7,8,
-15,6,7,0,12,7,0,1,68,0,0,0,28,8,0,0,
-14,7,8,0,30,6,6,30,9,9,114,101,116,117,114,110,
-32,39,39,46,106,111,105,110,40,111,117,116,41,0,0,0,
-12,8,0,0,0,0,0,0,12,9,0,4,106,111,105,110,
-0,0,0,0,9,8,8,9,15,9,6,0,31,7,9,1,
-19,7,8,7,20,7,0,0,0,0,0,0,12,137,0,8,
-100,111,69,110,99,111,100,101,0,0,0,0,10,7,137,136,
-30,10,6,33,100,101,102,32,99,111,109,112,105,108,101,70,
-105,108,101,40,115,111,117,114,99,101,95,99,111,100,101,44,
-102,105,108,101,110,97,109,101,41,58,0,0,16,7,0,126,
-44,10,0,0,30,10,6,33,100,101,102,32,99,111,109,112,
+99,108,101,97,110,40,115,41,0,0,0,0,12,10,0,5,
+99,108,101,97,110,0,0,0,49,7,5,10,15,9,3,0,
+50,6,7,1,15,3,6,0,30,4,6,59,9,9,99,108,
+97,115,115,32,83,116,97,116,117,115,58,0,26,6,0,0,
+12,7,0,6,83,116,97,116,117,115,0,0,14,7,6,0,
+12,9,0,7,115,101,116,109,101,116,97,0,13,8,9,0,
+15,9,6,0,12,11,0,6,111,98,106,101,99,116,0,0,
+13,10,11,0,31,7,9,2,19,7,8,7,30,4,6,62,
+9,9,68,32,61,32,83,116,97,116,117,115,40,41,0,0,
+12,6,0,1,68,0,0,0,12,9,0,6,83,116,97,116,
+117,115,0,0,13,8,9,0,31,7,0,0,19,7,8,7,
+14,6,7,0,30,5,6,63,9,9,68,46,115,111,117,114,
+99,101,95,99,111,100,101,32,61,32,115,0,12,7,0,1,
+68,0,0,0,13,6,7,0,12,7,0,11,115,111,117,114,
+99,101,95,99,111,100,101,0,10,6,7,3,30,6,6,64,
+9,9,68,46,102,105,108,101,110,97,109,101,32,61,32,102,
+105,108,101,110,97,109,101,0,12,7,0,1,68,0,0,0,
+13,6,7,0,12,7,0,8,102,105,108,101,110,97,109,101,
+0,0,0,0,10,6,7,2,30,10,6,65,9,9,68,46,
+108,105,110,101,115,32,61,32,68,46,115,111,117,114,99,101,
+95,99,111,100,101,46,115,112,108,105,116,40,39,92,110,39,
+41,0,0,0,12,7,0,1,68,0,0,0,13,6,7,0,
+12,12,0,1,68,0,0,0,13,11,12,0,12,12,0,11,
+115,111,117,114,99,101,95,99,111,100,101,0,9,11,11,12,
+12,12,0,5,115,112,108,105,116,0,0,0,49,8,11,12,
+12,10,0,1,10,0,0,0,50,7,8,1,12,8,0,5,
+108,105,110,101,115,0,0,0,10,6,8,7,30,21,6,66,
+9,9,68,46,115,116,97,99,107,44,68,46,111,117,116,44,
+68,46,95,115,99,111,112,101,105,44,68,46,116,115,116,97,
+99,107,44,68,46,95,116,97,103,105,44,68,46,100,97,116,
+97,32,61,32,91,93,44,91,40,39,116,97,103,39,44,39,
+79,80,95,69,79,70,39,41,93,44,48,44,91,93,44,48,
+44,123,125,0,27,7,0,0,15,6,7,0,12,10,0,3,
+116,97,103,0,12,11,0,6,79,80,95,69,79,70,0,0,
+27,9,10,2,27,8,9,1,15,7,8,0,11,9,0,1,
+0,0,0,0,0,0,0,0,15,8,9,0,27,10,0,0,
+15,9,10,0,11,11,0,1,0,0,0,0,0,0,0,0,
+15,10,11,0,26,12,0,0,15,11,12,0,12,13,0,1,
+68,0,0,0,13,12,13,0,12,13,0,5,115,116,97,99,
+107,0,0,0,10,12,13,6,12,12,0,1,68,0,0,0,
+13,6,12,0,12,12,0,3,111,117,116,0,10,6,12,7,
+12,7,0,1,68,0,0,0,13,6,7,0,12,7,0,7,
+95,115,99,111,112,101,105,0,10,6,7,8,12,7,0,1,
+68,0,0,0,13,6,7,0,12,7,0,6,116,115,116,97,
+99,107,0,0,10,6,7,9,12,7,0,1,68,0,0,0,
+13,6,7,0,12,7,0,5,95,116,97,103,105,0,0,0,
+10,6,7,10,12,7,0,1,68,0,0,0,13,6,7,0,
+12,7,0,4,100,97,116,97,0,0,0,0,10,6,7,11,
+30,5,6,67,9,9,68,46,101,114,114,111,114,32,61,32,
+70,97,108,115,101,9,0,0,12,7,0,1,68,0,0,0,
+13,6,7,0,11,7,0,1,0,0,0,0,0,0,0,0,
+12,8,0,5,101,114,114,111,114,0,0,0,10,6,8,7,
+30,5,6,69,9,9,115,101,108,102,46,98,101,103,105,110,
+40,84,114,117,101,41,0,0,12,10,0,5,98,101,103,105,
+110,0,0,0,49,7,1,10,11,9,0,1,1,0,0,0,
+0,0,0,0,50,6,7,1,30,4,6,70,9,9,115,101,
+108,102,46,100,111,40,116,41,0,0,0,0,12,10,0,2,
+100,111,0,0,49,7,1,10,15,9,4,0,50,6,7,1,
+30,4,6,71,9,9,115,101,108,102,46,101,110,100,40,41,
+0,0,0,0,12,9,0,3,101,110,100,0,49,7,1,9,
+50,6,7,0,30,5,6,72,9,9,115,101,108,102,46,109,
+97,112,95,116,97,103,115,40,41,0,0,0,12,9,0,8,
+109,97,112,95,116,97,103,115,0,0,0,0,49,7,1,9,
+50,6,7,0,30,6,6,73,9,9,111,117,116,32,61,32,
+68,46,111,117,116,59,32,68,32,61,32,78,111,110,101,0,
+12,8,0,1,68,0,0,0,13,7,8,0,12,8,0,3,
+111,117,116,0,9,7,7,8,15,6,7,0,12,7,0,1,
+68,0,0,0,28,8,0,0,14,7,8,0,30,6,6,74,
+9,9,114,101,116,117,114,110,32,39,39,46,106,111,105,110,
+40,111,117,116,41,0,0,0,12,11,0,0,0,0,0,0,
+12,12,0,4,106,111,105,110,0,0,0,0,49,8,11,12,
+15,10,6,0,50,7,8,1,20,7,0,0,0,0,0,0,
+12,140,0,8,100,111,69,110,99,111,100,101,0,0,0,0,
+10,8,140,139,30,10,6,77,100,101,102,32,99,111,109,112,
 105,108,101,70,105,108,101,40,115,111,117,114,99,101,95,99,
 111,100,101,44,102,105,108,101,110,97,109,101,41,58,0,0,
-12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
-33,1,0,0,12,1,0,11,99,111,109,112,105,108,101,70,
-105,108,101,0,34,1,0,0,28,2,0,0,9,1,0,2,
-28,3,0,0,9,2,0,3,30,12,6,34,9,116,111,107,
-101,110,115,32,32,32,61,32,84,111,107,101,110,105,122,101,
-114,40,41,46,100,111,84,111,107,101,110,105,122,101,40,115,
-111,117,114,99,101,95,99,111,100,101,41,0,12,7,0,9,
-84,111,107,101,110,105,122,101,114,0,0,0,13,6,7,0,
-31,5,0,0,19,5,6,5,12,6,0,10,100,111,84,111,
-107,101,110,105,122,101,0,0,9,5,5,6,15,6,1,0,
-31,4,6,1,19,4,5,4,15,3,4,0,30,13,6,35,
+16,8,0,123,44,14,0,0,30,10,6,77,100,101,102,32,
+99,111,109,112,105,108,101,70,105,108,101,40,115,111,117,114,
+99,101,95,99,111,100,101,44,102,105,108,101,110,97,109,101,
+41,58,0,0,12,1,0,9,116,105,110,121,112,121,46,112,
+121,0,0,0,33,1,0,0,12,1,0,11,99,111,109,112,
+105,108,101,70,105,108,101,0,34,1,0,0,28,2,0,0,
+9,1,0,2,28,3,0,0,9,2,0,3,30,12,6,78,
+9,116,111,107,101,110,115,32,32,32,61,32,84,111,107,101,
+110,105,122,101,114,40,41,46,100,111,84,111,107,101,110,105,
+122,101,40,115,111,117,114,99,101,95,99,111,100,101,41,0,
+12,10,0,9,84,111,107,101,110,105,122,101,114,0,0,0,
+13,9,10,0,31,8,0,0,19,8,9,8,12,9,0,10,
+100,111,84,111,107,101,110,105,122,101,0,0,49,5,8,9,
+15,7,1,0,50,4,5,1,15,3,4,0,30,13,6,79,
 9,116,111,107,101,110,115,32,32,32,61,32,80,97,114,115,
 101,114,40,41,46,100,111,80,97,114,115,101,40,115,111,117,
 114,99,101,95,99,111,100,101,44,116,111,107,101,110,115,41,
-0,0,0,0,12,7,0,6,80,97,114,115,101,114,0,0,
-13,6,7,0,31,5,0,0,19,5,6,5,12,6,0,7,
-100,111,80,97,114,115,101,0,9,5,5,6,15,6,1,0,
-15,7,3,0,31,4,6,2,19,4,5,4,15,3,4,0,
-30,15,6,36,9,98,121,116,101,99,111,100,101,32,61,32,
-69,110,99,111,100,101,114,40,41,46,100,111,69,110,99,111,
-100,101,40,102,105,108,101,110,97,109,101,44,115,111,117,114,
-99,101,95,99,111,100,101,44,116,111,107,101,110,115,41,0,
-12,8,0,7,69,110,99,111,100,101,114,0,13,7,8,0,
-31,6,0,0,19,6,7,6,12,7,0,8,100,111,69,110,
-99,111,100,101,0,0,0,0,9,6,6,7,15,7,2,0,
-15,8,1,0,15,9,3,0,31,5,7,3,19,5,6,5,
-15,4,5,0,30,5,6,37,9,114,101,116,117,114,110,32,
-98,121,116,101,99,111,100,101,0,0,0,0,20,4,0,0,
-0,0,0,0,12,137,0,11,99,111,109,112,105,108,101,70,
-105,108,101,0,14,137,7,0,30,8,6,41,100,101,102,32,
-105,109,112,111,114,116,77,111,100,117,108,101,40,109,111,100,
-117,108,101,110,97,109,101,41,58,0,0,0,16,137,0,195,
-44,10,0,0,30,8,6,41,100,101,102,32,105,109,112,111,
-114,116,77,111,100,117,108,101,40,109,111,100,117,108,101,110,
-97,109,101,41,58,0,0,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,12,
-105,109,112,111,114,116,77,111,100,117,108,101,0,0,0,0,
-34,1,0,0,28,2,0,0,9,1,0,2,30,7,6,43,
-9,105,102,32,109,111,100,117,108,101,110,97,109,101,32,105,
-110,32,77,79,68,85,76,69,83,58,0,0,12,3,0,7,
-77,79,68,85,76,69,83,0,13,2,3,0,36,2,2,1,
-21,2,0,0,18,0,0,17,30,8,6,44,9,9,114,101,
-116,117,114,110,32,77,79,68,85,76,69,83,91,109,111,100,
-117,108,101,110,97,109,101,93,0,0,0,0,12,3,0,7,
-77,79,68,85,76,69,83,0,13,2,3,0,9,2,2,1,
-20,2,0,0,18,0,0,1,30,7,6,46,9,102,105,108,
-101,110,97,109,101,61,109,111,100,117,108,101,110,97,109,101,
-43,39,46,112,121,39,0,0,12,4,0,3,46,112,121,0,
-1,3,1,4,15,2,3,0,30,9,6,47,9,115,111,117,
-114,99,101,95,99,111,100,101,32,61,32,108,111,97,100,70,
-105,108,101,40,102,105,108,101,110,97,109,101,41,0,0,0,
-12,6,0,8,108,111,97,100,70,105,108,101,0,0,0,0,
-13,5,6,0,15,6,2,0,31,4,6,1,19,4,5,4,
-15,3,4,0,30,12,6,48,9,98,121,116,101,99,111,100,
-101,32,61,32,99,111,109,112,105,108,101,70,105,108,101,40,
-115,111,117,114,99,101,95,99,111,100,101,44,102,105,108,101,
-110,97,109,101,41,0,0,0,12,7,0,11,99,111,109,112,
-105,108,101,70,105,108,101,0,13,6,7,0,15,7,3,0,
-15,8,2,0,31,5,7,2,19,5,6,5,15,4,5,0,
-30,4,6,50,9,109,111,100,117,108,101,32,61,32,123,125,
-0,0,0,0,26,6,0,0,15,5,6,0,30,9,6,51,
-9,109,111,100,117,108,101,91,39,95,95,110,97,109,101,95,
-95,39,93,32,61,32,109,111,100,117,108,101,110,97,109,101,
-0,0,0,0,12,6,0,8,95,95,110,97,109,101,95,95,
-0,0,0,0,10,5,6,1,30,8,6,52,9,109,111,100,
-117,108,101,91,39,95,95,99,111,100,101,95,95,39,93,32,
-61,32,98,121,116,101,99,111,100,101,0,0,12,6,0,8,
-95,95,99,111,100,101,95,95,0,0,0,0,10,5,6,4,
-30,8,6,53,9,109,111,100,117,108,101,91,39,95,95,100,
-105,99,116,95,95,39,93,32,61,32,109,111,100,117,108,101,
-0,0,0,0,12,6,0,8,95,95,100,105,99,116,95,95,
-0,0,0,0,10,5,6,5,30,8,6,55,9,77,79,68,
+0,0,0,0,12,11,0,6,80,97,114,115,101,114,0,0,
+13,10,11,0,31,9,0,0,19,9,10,9,12,10,0,7,
+100,111,80,97,114,115,101,0,49,5,9,10,15,7,1,0,
+15,8,3,0,50,4,5,2,15,3,4,0,30,15,6,80,
+9,98,121,116,101,99,111,100,101,32,61,32,69,110,99,111,
+100,101,114,40,41,46,100,111,69,110,99,111,100,101,40,102,
+105,108,101,110,97,109,101,44,115,111,117,114,99,101,95,99,
+111,100,101,44,116,111,107,101,110,115,41,0,12,13,0,7,
+69,110,99,111,100,101,114,0,13,12,13,0,31,11,0,0,
+19,11,12,11,12,12,0,8,100,111,69,110,99,111,100,101,
+0,0,0,0,49,6,11,12,15,8,2,0,15,9,1,0,
+15,10,3,0,50,5,6,3,15,4,5,0,30,5,6,81,
+9,114,101,116,117,114,110,32,98,121,116,101,99,111,100,101,
+0,0,0,0,20,4,0,0,0,0,0,0,12,140,0,11,
+99,111,109,112,105,108,101,70,105,108,101,0,14,140,8,0,
+30,8,6,85,100,101,102,32,105,109,112,111,114,116,77,111,
+100,117,108,101,40,109,111,100,117,108,101,110,97,109,101,41,
+58,0,0,0,16,140,0,195,44,10,0,0,30,8,6,85,
+100,101,102,32,105,109,112,111,114,116,77,111,100,117,108,101,
+40,109,111,100,117,108,101,110,97,109,101,41,58,0,0,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,12,105,109,112,111,114,116,77,111,
+100,117,108,101,0,0,0,0,34,1,0,0,28,2,0,0,
+9,1,0,2,30,7,6,87,9,105,102,32,109,111,100,117,
+108,101,110,97,109,101,32,105,110,32,77,79,68,85,76,69,
+83,58,0,0,12,3,0,7,77,79,68,85,76,69,83,0,
+13,2,3,0,36,2,2,1,21,2,0,0,18,0,0,17,
+30,8,6,88,9,9,114,101,116,117,114,110,32,77,79,68,
 85,76,69,83,91,109,111,100,117,108,101,110,97,109,101,93,
-32,61,32,109,111,100,117,108,101,0,0,0,12,7,0,7,
-77,79,68,85,76,69,83,0,13,6,7,0,10,6,1,5,
-30,6,6,57,9,101,120,101,99,40,98,121,116,101,99,111,
-100,101,44,109,111,100,117,108,101,41,0,0,12,8,0,4,
-101,120,101,99,0,0,0,0,13,7,8,0,15,8,4,0,
-15,9,5,0,31,6,8,2,19,6,7,6,30,4,6,58,
-9,114,101,116,117,114,110,32,109,111,100,117,108,101,0,0,
-20,5,0,0,0,0,0,0,12,138,0,12,105,109,112,111,
-114,116,77,111,100,117,108,101,0,0,0,0,14,138,137,0,
-30,11,6,62,100,101,102,32,104,101,120,68,117,109,112,40,
-100,97,116,97,44,98,117,102,102,101,114,95,110,97,109,101,
-44,99,111,108,115,32,61,32,49,54,41,32,58,0,0,0,
-16,138,0,207,44,22,0,0,30,11,6,62,100,101,102,32,
+0,0,0,0,12,3,0,7,77,79,68,85,76,69,83,0,
+13,2,3,0,9,2,2,1,20,2,0,0,18,0,0,1,
+30,7,6,90,9,102,105,108,101,110,97,109,101,61,109,111,
+100,117,108,101,110,97,109,101,43,39,46,112,121,39,0,0,
+12,4,0,3,46,112,121,0,1,3,1,4,15,2,3,0,
+30,9,6,91,9,115,111,117,114,99,101,95,99,111,100,101,
+32,61,32,108,111,97,100,70,105,108,101,40,102,105,108,101,
+110,97,109,101,41,0,0,0,12,6,0,8,108,111,97,100,
+70,105,108,101,0,0,0,0,13,5,6,0,15,6,2,0,
+31,4,6,1,19,4,5,4,15,3,4,0,30,12,6,92,
+9,98,121,116,101,99,111,100,101,32,61,32,99,111,109,112,
+105,108,101,70,105,108,101,40,115,111,117,114,99,101,95,99,
+111,100,101,44,102,105,108,101,110,97,109,101,41,0,0,0,
+12,7,0,11,99,111,109,112,105,108,101,70,105,108,101,0,
+13,6,7,0,15,7,3,0,15,8,2,0,31,5,7,2,
+19,5,6,5,15,4,5,0,30,4,6,94,9,109,111,100,
+117,108,101,32,61,32,123,125,0,0,0,0,26,6,0,0,
+15,5,6,0,30,9,6,95,9,109,111,100,117,108,101,91,
+39,95,95,110,97,109,101,95,95,39,93,32,61,32,109,111,
+100,117,108,101,110,97,109,101,0,0,0,0,12,6,0,8,
+95,95,110,97,109,101,95,95,0,0,0,0,10,5,6,1,
+30,8,6,96,9,109,111,100,117,108,101,91,39,95,95,99,
+111,100,101,95,95,39,93,32,61,32,98,121,116,101,99,111,
+100,101,0,0,12,6,0,8,95,95,99,111,100,101,95,95,
+0,0,0,0,10,5,6,4,30,8,6,97,9,109,111,100,
+117,108,101,91,39,95,95,100,105,99,116,95,95,39,93,32,
+61,32,109,111,100,117,108,101,0,0,0,0,12,6,0,8,
+95,95,100,105,99,116,95,95,0,0,0,0,10,5,6,5,
+30,8,6,99,9,77,79,68,85,76,69,83,91,109,111,100,
+117,108,101,110,97,109,101,93,32,61,32,109,111,100,117,108,
+101,0,0,0,12,7,0,7,77,79,68,85,76,69,83,0,
+13,6,7,0,10,6,1,5,30,6,6,101,9,101,120,101,
+99,40,98,121,116,101,99,111,100,101,44,109,111,100,117,108,
+101,41,0,0,12,8,0,4,101,120,101,99,0,0,0,0,
+13,7,8,0,15,8,4,0,15,9,5,0,31,6,8,2,
+19,6,7,6,30,4,6,102,9,114,101,116,117,114,110,32,
+109,111,100,117,108,101,0,0,20,5,0,0,0,0,0,0,
+12,141,0,12,105,109,112,111,114,116,77,111,100,117,108,101,
+0,0,0,0,14,141,140,0,30,11,6,106,100,101,102,32,
 104,101,120,68,117,109,112,40,100,97,116,97,44,98,117,102,
 102,101,114,95,110,97,109,101,44,99,111,108,115,32,61,32,
-49,54,41,32,58,0,0,0,12,1,0,9,116,105,110,121,
-112,121,46,112,121,0,0,0,33,1,0,0,12,1,0,7,
-104,101,120,68,117,109,112,0,34,1,0,0,28,2,0,0,
-9,1,0,2,28,3,0,0,9,2,0,3,11,3,0,0,
-0,0,0,0,0,0,48,64,28,4,0,0,32,3,0,4,
-30,3,6,63,9,111,117,116,32,61,32,91,93,0,0,0,
-27,5,0,0,15,4,5,0,30,14,6,64,9,111,117,116,
-46,97,112,112,101,110,100,40,34,117,110,115,105,103,110,101,
-100,32,99,104,97,114,32,34,32,43,32,98,117,102,102,101,
-114,95,110,97,109,101,32,43,34,91,93,32,61,32,123,34,
-41,0,0,0,12,7,0,6,97,112,112,101,110,100,0,0,
-9,6,4,7,12,7,0,14,117,110,115,105,103,110,101,100,
-32,99,104,97,114,32,0,0,1,7,7,2,12,8,0,6,
-91,93,32,61,32,123,0,0,1,7,7,8,31,5,7,1,
-19,5,6,5,30,9,6,65,9,102,111,114,32,110,32,105,
-110,32,114,97,110,103,101,40,48,44,108,101,110,40,100,97,
-116,97,41,44,99,111,108,115,41,58,0,0,12,8,0,5,
-114,97,110,103,101,0,0,0,13,7,8,0,11,8,0,0,
-0,0,0,0,0,0,0,0,12,12,0,3,108,101,110,0,
-13,11,12,0,15,12,1,0,31,9,12,1,19,9,11,9,
-15,10,3,0,31,6,8,3,19,6,7,6,11,7,0,0,
-0,0,0,0,0,0,0,0,42,5,6,7,18,0,0,62,
-30,17,6,66,9,9,111,117,116,46,97,112,112,101,110,100,
-40,34,44,34,46,106,111,105,110,40,91,115,116,114,40,111,
-114,100,40,118,41,41,32,102,111,114,32,118,32,105,110,32,
-100,97,116,97,91,110,58,110,43,99,111,108,115,93,93,41,
-43,39,44,39,41,0,0,0,12,10,0,6,97,112,112,101,
-110,100,0,0,9,9,4,10,12,11,0,1,44,0,0,0,
-12,12,0,4,106,111,105,110,0,0,0,0,9,11,11,12,
-27,13,0,0,15,17,5,0,1,18,5,3,27,16,17,2,
-9,15,1,16,11,16,0,0,0,0,0,0,0,0,0,0,
-42,14,15,16,18,0,0,15,12,19,0,3,115,116,114,0,
-13,18,19,0,12,21,0,3,111,114,100,0,13,20,21,0,
-15,21,14,0,31,19,21,1,19,19,20,19,31,17,19,1,
-19,17,18,17,28,18,0,0,10,13,18,17,18,0,255,241,
-15,12,13,0,31,10,12,1,19,10,11,10,12,11,0,1,
-44,0,0,0,1,10,10,11,31,8,10,1,19,8,9,8,
-18,0,255,194,30,6,6,67,9,111,117,116,46,97,112,112,
-101,110,100,40,34,34,34,125,59,34,34,34,41,0,0,0,
-12,8,0,6,97,112,112,101,110,100,0,0,9,7,4,8,
-12,8,0,2,125,59,0,0,31,6,8,1,19,6,7,6,
-30,4,6,68,9,111,117,116,46,97,112,112,101,110,100,40,
-34,34,41,0,12,8,0,6,97,112,112,101,110,100,0,0,
-9,7,4,8,12,8,0,0,0,0,0,0,31,6,8,1,
-19,6,7,6,30,6,6,69,9,114,101,116,117,114,110,32,
-39,92,110,39,46,106,111,105,110,40,111,117,116,41,0,0,
-12,7,0,1,10,0,0,0,12,8,0,4,106,111,105,110,
-0,0,0,0,9,7,7,8,15,8,4,0,31,6,8,1,
-19,6,7,6,20,6,0,0,0,0,0,0,12,139,0,7,
-104,101,120,68,117,109,112,0,14,139,138,0,30,13,6,72,
+49,54,41,32,58,0,0,0,16,141,0,201,44,24,0,0,
+30,11,6,106,100,101,102,32,104,101,120,68,117,109,112,40,
+100,97,116,97,44,98,117,102,102,101,114,95,110,97,109,101,
+44,99,111,108,115,32,61,32,49,54,41,32,58,0,0,0,
+12,1,0,9,116,105,110,121,112,121,46,112,121,0,0,0,
+33,1,0,0,12,1,0,7,104,101,120,68,117,109,112,0,
+34,1,0,0,28,2,0,0,9,1,0,2,28,3,0,0,
+9,2,0,3,11,3,0,1,16,0,0,0,0,0,0,0,
+28,4,0,0,32,3,0,4,30,3,6,107,9,111,117,116,
+32,61,32,91,93,0,0,0,27,5,0,0,15,4,5,0,
+30,14,6,108,9,111,117,116,46,97,112,112,101,110,100,40,
+34,117,110,115,105,103,110,101,100,32,99,104,97,114,32,34,
+32,43,32,98,117,102,102,101,114,95,110,97,109,101,32,43,
+34,91,93,32,61,32,123,34,41,0,0,0,12,9,0,6,
+97,112,112,101,110,100,0,0,49,6,4,9,12,8,0,14,
+117,110,115,105,103,110,101,100,32,99,104,97,114,32,0,0,
+1,8,8,2,12,9,0,6,91,93,32,61,32,123,0,0,
+1,8,8,9,50,5,6,1,30,9,6,109,9,102,111,114,
+32,110,32,105,110,32,114,97,110,103,101,40,48,44,108,101,
+110,40,100,97,116,97,41,44,99,111,108,115,41,58,0,0,
+12,8,0,5,114,97,110,103,101,0,0,0,13,7,8,0,
+11,8,0,1,0,0,0,0,0,0,0,0,12,12,0,3,
+108,101,110,0,13,11,12,0,15,12,1,0,31,9,12,1,
+19,9,11,9,15,10,3,0,31,6,8,3,19,6,7,6,
+11,7,0,1,0,0,0,0,0,0,0,0,42,5,6,7,
+18,0,0,60,30,17,6,110,9,9,111,117,116,46,97,112,
+112,101,110,100,40,34,44,34,46,106,111,105,110,40,91,115,
+116,114,40,111,114,100,40,118,41,41,32,102,111,114,32,118,
+32,105,110,32,100,97,116,97,91,110,58,110,43,99,111,108,
+115,93,93,41,43,39,44,39,41,0,0,0,12,12,0,6,
+97,112,112,101,110,100,0,0,49,9,4,12,12,15,0,1,
+44,0,0,0,12,16,0,4,106,111,105,110,0,0,0,0,
+49,12,15,16,27,15,0,0,15,19,5,0,1,20,5,3,
+27,18,19,2,9,17,1,18,11,18,0,1,0,0,0,0,
+0,0,0,0,42,16,17,18,18,0,0,15,12,21,0,3,
+115,116,114,0,13,20,21,0,12,23,0,3,111,114,100,0,
+13,22,23,0,15,23,16,0,31,21,23,1,19,21,22,21,
+31,19,21,1,19,19,20,19,28,20,0,0,10,15,20,19,
+18,0,255,241,15,14,15,0,50,11,12,1,12,12,0,1,
+44,0,0,0,1,11,11,12,50,8,9,1,18,0,255,196,
+30,6,6,111,9,111,117,116,46,97,112,112,101,110,100,40,
+34,34,34,125,59,34,34,34,41,0,0,0,12,10,0,6,
+97,112,112,101,110,100,0,0,49,7,4,10,12,9,0,2,
+125,59,0,0,50,6,7,1,30,4,6,112,9,111,117,116,
+46,97,112,112,101,110,100,40,34,34,41,0,12,10,0,6,
+97,112,112,101,110,100,0,0,49,7,4,10,12,9,0,0,
+0,0,0,0,50,6,7,1,30,6,6,113,9,114,101,116,
+117,114,110,32,39,92,110,39,46,106,111,105,110,40,111,117,
+116,41,0,0,12,10,0,1,10,0,0,0,12,11,0,4,
+106,111,105,110,0,0,0,0,49,7,10,11,15,9,4,0,
+50,6,7,1,20,6,0,0,0,0,0,0,12,142,0,7,
+104,101,120,68,117,109,112,0,14,142,141,0,30,13,6,116,
 100,101,102,32,103,101,110,101,114,97,116,101,66,121,116,101,
 67,111,100,101,40,102,105,108,101,110,97,109,101,61,39,116,
 105,110,121,112,121,46,98,121,116,101,99,111,100,101,46,104,
-39,41,58,0,16,139,0,225,44,15,0,0,30,13,6,72,
+39,41,58,0,16,142,0,222,44,16,0,0,30,13,6,116,
 100,101,102,32,103,101,110,101,114,97,116,101,66,121,116,101,
 67,111,100,101,40,102,105,108,101,110,97,109,101,61,39,116,
 105,110,121,112,121,46,98,121,116,101,99,111,100,101,46,104,
@@ -6633,75 +6715,74 @@ unsigned char py_tinypy[] = {
 114,97,116,101,66,121,116,101,67,111,100,101,0,0,0,0,
 34,1,0,0,12,1,0,17,116,105,110,121,112,121,46,98,
 121,116,101,99,111,100,101,46,104,0,0,0,28,2,0,0,
-32,1,0,2,30,9,6,73,9,102,32,61,32,111,112,101,
+32,1,0,2,30,9,6,117,9,102,32,61,32,111,112,101,
 110,40,39,116,105,110,121,112,121,46,98,121,116,101,99,111,
 100,101,46,104,39,44,39,119,98,39,41,0,12,5,0,4,
 111,112,101,110,0,0,0,0,13,4,5,0,12,5,0,17,
 116,105,110,121,112,121,46,98,121,116,101,99,111,100,101,46,
 104,0,0,0,12,6,0,2,119,98,0,0,31,3,5,2,
-19,3,4,3,15,2,3,0,30,18,6,74,9,102,46,119,
+19,3,4,3,15,2,3,0,30,18,6,118,9,102,46,119,
 114,105,116,101,40,34,47,42,84,104,105,115,32,102,105,108,
 101,32,105,115,32,97,117,116,111,103,101,110,101,114,97,116,
 101,100,32,98,121,32,103,101,110,101,114,97,116,101,95,98,
 121,116,101,99,111,100,101,46,112,121,42,47,92,110,92,110,
-34,41,0,0,12,5,0,5,119,114,105,116,101,0,0,0,
-9,4,2,5,12,5,0,56,47,42,84,104,105,115,32,102,
+34,41,0,0,12,7,0,5,119,114,105,116,101,0,0,0,
+49,4,2,7,12,6,0,56,47,42,84,104,105,115,32,102,
 105,108,101,32,105,115,32,97,117,116,111,103,101,110,101,114,
 97,116,101,100,32,98,121,32,103,101,110,101,114,97,116,101,
 95,98,121,116,101,99,111,100,101,46,112,121,42,47,10,10,
-0,0,0,0,31,3,5,1,19,3,4,3,30,9,6,75,
-9,102,111,114,32,109,111,100,117,108,101,102,105,108,101,110,
-97,109,101,32,105,110,32,91,39,116,105,110,121,112,121,39,
-93,58,0,0,12,5,0,6,116,105,110,121,112,121,0,0,
-27,4,5,1,11,5,0,0,0,0,0,0,0,0,0,0,
-42,3,4,5,18,0,0,94,30,9,6,76,9,9,115,114,
-99,95,102,105,108,101,110,97,109,101,61,109,111,100,117,108,
-101,102,105,108,101,110,97,109,101,43,39,46,112,121,39,0,
-12,8,0,3,46,112,121,0,1,7,3,8,15,6,7,0,
-30,10,6,77,9,9,115,111,117,114,99,101,95,99,111,100,
-101,32,61,32,108,111,97,100,70,105,108,101,40,115,114,99,
-95,102,105,108,101,110,97,109,101,41,0,0,12,10,0,8,
-108,111,97,100,70,105,108,101,0,0,0,0,13,9,10,0,
-15,10,6,0,31,8,10,1,19,8,9,8,15,7,8,0,
-30,13,6,78,9,9,98,121,116,101,99,111,100,101,32,61,
-32,99,111,109,112,105,108,101,70,105,108,101,40,115,111,117,
-114,99,101,95,99,111,100,101,44,115,114,99,95,102,105,108,
-101,110,97,109,101,41,0,0,12,11,0,11,99,111,109,112,
-105,108,101,70,105,108,101,0,13,10,11,0,15,11,7,0,
-15,12,6,0,31,9,11,2,19,9,10,9,15,8,9,0,
-30,14,6,79,9,9,102,46,119,114,105,116,101,40,104,101,
-120,68,117,109,112,40,98,121,116,101,99,111,100,101,44,39,
-112,121,95,39,43,109,111,100,117,108,101,102,105,108,101,110,
-97,109,101,41,43,34,92,110,34,41,0,0,12,11,0,5,
-119,114,105,116,101,0,0,0,9,10,2,11,12,13,0,7,
-104,101,120,68,117,109,112,0,13,12,13,0,15,13,8,0,
-12,14,0,3,112,121,95,0,1,14,14,3,31,11,13,2,
-19,11,12,11,12,12,0,1,10,0,0,0,1,11,11,12,
-31,9,11,1,19,9,10,9,18,0,255,162,30,3,6,80,
-9,102,46,99,108,111,115,101,40,41,0,0,12,9,0,5,
-99,108,111,115,101,0,0,0,9,5,2,9,31,4,0,0,
-19,4,5,4,0,0,0,0,12,140,0,16,103,101,110,101,
-114,97,116,101,66,121,116,101,67,111,100,101,0,0,0,0,
-14,140,139,0,30,15,6,83,105,102,32,95,95,110,97,109,
-101,95,95,32,61,61,32,39,95,95,109,97,105,110,95,95,
-39,32,97,110,100,32,110,111,116,32,34,116,105,110,121,112,
-121,34,32,105,110,32,115,121,115,46,118,101,114,115,105,111,
-110,58,0,0,12,141,0,8,95,95,110,97,109,101,95,95,
-0,0,0,0,13,140,141,0,12,141,0,8,95,95,109,97,
-105,110,95,95,0,0,0,0,23,140,140,141,21,140,0,0,
-18,0,0,13,12,142,0,3,115,121,115,0,13,141,142,0,
-12,142,0,7,118,101,114,115,105,111,110,0,9,141,141,142,
-12,142,0,6,116,105,110,121,112,121,0,0,36,141,141,142,
-47,140,141,0,21,140,0,0,18,0,0,39,30,8,6,84,
-9,112,114,105,110,116,40,34,71,101,110,101,114,97,116,105,
-110,103,32,98,121,116,101,99,111,100,101,33,34,41,0,0,
-12,142,0,5,112,114,105,110,116,0,0,0,13,141,142,0,
-12,142,0,20,71,101,110,101,114,97,116,105,110,103,32,98,
-121,116,101,99,111,100,101,33,0,0,0,0,31,140,142,1,
-19,140,141,140,30,5,6,85,9,103,101,110,101,114,97,116,
-101,66,121,116,101,67,111,100,101,40,41,0,12,142,0,16,
+0,0,0,0,50,3,4,1,30,9,6,119,9,102,111,114,
+32,109,111,100,117,108,101,102,105,108,101,110,97,109,101,32,
+105,110,32,91,39,116,105,110,121,112,121,39,93,58,0,0,
+12,5,0,6,116,105,110,121,112,121,0,0,27,4,5,1,
+11,5,0,1,0,0,0,0,0,0,0,0,42,3,4,5,
+18,0,0,93,30,9,6,120,9,9,115,114,99,95,102,105,
+108,101,110,97,109,101,61,109,111,100,117,108,101,102,105,108,
+101,110,97,109,101,43,39,46,112,121,39,0,12,8,0,3,
+46,112,121,0,1,7,3,8,15,6,7,0,30,10,6,121,
+9,9,115,111,117,114,99,101,95,99,111,100,101,32,61,32,
+108,111,97,100,70,105,108,101,40,115,114,99,95,102,105,108,
+101,110,97,109,101,41,0,0,12,10,0,8,108,111,97,100,
+70,105,108,101,0,0,0,0,13,9,10,0,15,10,6,0,
+31,8,10,1,19,8,9,8,15,7,8,0,30,13,6,122,
+9,9,98,121,116,101,99,111,100,101,32,61,32,99,111,109,
+112,105,108,101,70,105,108,101,40,115,111,117,114,99,101,95,
+99,111,100,101,44,115,114,99,95,102,105,108,101,110,97,109,
+101,41,0,0,12,11,0,11,99,111,109,112,105,108,101,70,
+105,108,101,0,13,10,11,0,15,11,7,0,15,12,6,0,
+31,9,11,2,19,9,10,9,15,8,9,0,30,14,6,123,
+9,9,102,46,119,114,105,116,101,40,104,101,120,68,117,109,
+112,40,98,121,116,101,99,111,100,101,44,39,112,121,95,39,
+43,109,111,100,117,108,101,102,105,108,101,110,97,109,101,41,
+43,34,92,110,34,41,0,0,12,13,0,5,119,114,105,116,
+101,0,0,0,49,10,2,13,12,14,0,7,104,101,120,68,
+117,109,112,0,13,13,14,0,15,14,8,0,12,15,0,3,
+112,121,95,0,1,15,15,3,31,12,14,2,19,12,13,12,
+12,13,0,1,10,0,0,0,1,12,12,13,50,9,10,1,
+18,0,255,163,30,3,6,124,9,102,46,99,108,111,115,101,
+40,41,0,0,12,5,0,5,99,108,111,115,101,0,0,0,
+49,9,2,5,50,4,9,0,0,0,0,0,12,143,0,16,
 103,101,110,101,114,97,116,101,66,121,116,101,67,111,100,101,
-0,0,0,0,13,141,142,0,31,140,0,0,19,140,141,140,
-18,0,0,1,0,0,0,0,
+0,0,0,0,14,143,142,0,30,15,6,127,105,102,32,95,
+95,110,97,109,101,95,95,32,61,61,32,39,95,95,109,97,
+105,110,95,95,39,32,97,110,100,32,110,111,116,32,34,116,
+105,110,121,112,121,34,32,105,110,32,115,121,115,46,118,101,
+114,115,105,111,110,58,0,0,12,144,0,8,95,95,110,97,
+109,101,95,95,0,0,0,0,13,143,144,0,12,144,0,8,
+95,95,109,97,105,110,95,95,0,0,0,0,23,143,143,144,
+21,143,0,0,18,0,0,13,12,145,0,3,115,121,115,0,
+13,144,145,0,12,145,0,7,118,101,114,115,105,111,110,0,
+9,144,144,145,12,145,0,6,116,105,110,121,112,121,0,0,
+36,144,144,145,47,143,144,0,21,143,0,0,18,0,0,39,
+30,8,6,128,9,112,114,105,110,116,40,34,71,101,110,101,
+114,97,116,105,110,103,32,98,121,116,101,99,111,100,101,33,
+34,41,0,0,12,145,0,5,112,114,105,110,116,0,0,0,
+13,144,145,0,12,145,0,20,71,101,110,101,114,97,116,105,
+110,103,32,98,121,116,101,99,111,100,101,33,0,0,0,0,
+31,143,145,1,19,143,144,143,30,5,6,129,9,103,101,110,
+101,114,97,116,101,66,121,116,101,67,111,100,101,40,41,0,
+12,145,0,16,103,101,110,101,114,97,116,101,66,121,116,101,
+67,111,100,101,0,0,0,0,13,144,145,0,31,143,0,0,
+19,143,144,143,18,0,0,1,0,0,0,0,
 };
 
@@ -7,6 +7,7 @@
 #include <stdarg.h>
 #include <math.h>
 #include <time.h>
+#include <string.h>
 #include <string>
 #include <algorithm>
 #include <sstream>
@@ -14,15 +15,31 @@
 
 #include <math.h>
 #include <errno.h>
+#include <chrono>
+
+#if TINYPY_HUGE_PAGES && defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
 
 #include "tinypy.bytecode.h"
 
+//threaded dispatch in runStep (labels as values), define TINYPY_COMPUTED_GOTO=0 to force the portable switch
+#ifndef TINYPY_COMPUTED_GOTO
+#if defined(__GNUC__) || defined(__clang__)
+#define TINYPY_COMPUTED_GOTO 1
+#else
+#define TINYPY_COMPUTED_GOTO 0
+#endif
+#endif
+
 #ifdef _WIN32
 #pragma warning(disable:4267 4244 4996)
 #endif
 
-SharedPtr<Object> NoneObject = std::make_shared<Object>(nullptr, Object::NoneType);
-
 
 enum {
   OP_EOF,
@@ -74,180 +91,356 @@ enum {
   OP_IFN,
   OP_NOT,
   OP_BITNOT,
+  OP_LOADMETHOD,
+  OP_CALLMETHOD,
+  OP_CONSTANT, //produced by decodeCode, never emitted by the compiler
   OP_TOTAL
 };
 
 
 
 ////////////////////////////////////////////////////////////////////////
-int Object::compare(SharedPtr<Object> a, SharedPtr<Object> b)
+ObjectPool::~ObjectPool()
 {
-  if (a->type != b->type)
-    return a->type - b->type;
-
-  switch (a->type) {
-
-  case Object::NoneType:
-    return 0;
-
-  case Object::NumberType:
+  for (auto it : slabs)
   {
-    auto na = a->castToNumber()->val;
-    auto nb = b->castToNumber()->val;
-    auto v = na  - nb;
-    return (v < 0 ? -1 : (v > 0 ? 1 : 0));
+#if TINYPY_HUGE_PAGES && defined(__linux__)
+    munmap(it.first, it.second);
+#else
+    free(it.first);
+#endif
   }
+}
 
-  case Object::StringType:
+////////////////////////////////////////////////////////////////////////
+void ObjectPool::newSlab(int size_class)
+{
+#if TINYPY_HUGE_PAGES && defined(__linux__)
+  const size_t slab_size = 2 * 1024 * 1024;
+  void* slab = mmap(nullptr, slab_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  if (slab == MAP_FAILED)
   {
-    auto sa = a->castToString()->val;
-    auto sb = b->castToString()->val;
-    int len = std::min(sa.length(), sb.length());
-    int v = memcmp(sa.c_str(), sb.c_str(), len);
-    return v? v : (sa.length() - sb.length());
+    //no reserved huge pages, ask for transparent ones
+    slab = mmap(nullptr, slab_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (slab == MAP_FAILED)
+      throw std::bad_alloc();
+    madvise(slab, slab_size, MADV_HUGEPAGE);
   }
+#else
+  const size_t slab_size = 64 * 1024;
+  void* slab = malloc(slab_size);
+  if (!slab)
+    throw std::bad_alloc();
+#endif
 
-  case Object::ListType:
-  {
-    auto la = a->castToList();
-    auto lb = b->castToList();
+  slabs.push_back(std::make_pair(slab, slab_size));
 
-    int len = std::min(la->size(), lb->size());
-    for (int n = 0; n < len ; n++)
-    {
-      auto aa = la->getAt(n);
-      auto bb = lb->getAt(n);
+  //the tail of the previous slab is lost, at most one block
+  bump_cur[size_class] = (char*)slab;
+  bump_end[size_class] = (char*)slab + slab_size;
+}
 
-      int v;
-      if (aa->type == Object::ListType && bb->type == Object::ListType)
-        v = aa->castToList().get() - bb->castToList().get();
-      else
-        v = compare(aa, bb);
-      if (v)
-        return v;
-    }
-    return la->size() - lb->size();
-  }
+////////////////////////////////////////////////////////////////////////
+//per-type operations, indexed by Object::type of the left operand
+struct TypeOps
+{
+  //both operands have the same type
+  int   (*compare)(const Value& a, const Value& b);
+
+  //both operands have the same type
+  Value (*add)(PyEngine* py, const Value& a, const Value& b);
+
+  //the right operand can have any type
+  Value (*mul)(PyEngine* py, const Value& a, const Value& b);
+};
+
+//compareNone
+static int compareNone(const Value& a, const Value& b) {
+  return 0;
+}
 
-  case Object::DictType: {
-    return a.get() - b.get();
+//compareNumber
+static int compareNumber(const Value& a, const Value& b) 
+{
+  if (a.isInt() && b.isInt()) {
+    auto ia = a.getInt(), ib = b.getInt();
+    return ia < ib ? -1 : (ia > ib ? 1 : 0);
   }
+  auto v = a.getNumber() - b.getNumber();
+  return (v < 0 ? -1 : (v > 0 ? 1 : 0));
+}
+
+//addInt (false on overflow, the caller promotes to double)
+static bool addInt(int64_t a, int64_t b, int64_t& ret) {
+  if ((b > 0 && a > INT64_MAX - b) || (b < 0 && a < INT64_MIN - b))
+    return false;
+  ret = a + b;
+  return true;
+}
+
+//subInt
+static bool subInt(int64_t a, int64_t b, int64_t& ret) {
+  if ((b < 0 && a > INT64_MAX + b) || (b > 0 && a < INT64_MIN + b))
+    return false;
+  ret = a - b;
+  return true;
+}
+
+//mulInt
+static bool mulInt(int64_t a, int64_t b, int64_t& ret) {
+#if defined(__GNUC__) || defined(__clang__)
+  return !__builtin_mul_overflow(a, b, &ret);
+#else
+  //rounding is monotonic and 2^63 is exact, so an exact product out of range never passes
+  double d = (double)a * (double)b;
+  if (fabs(d) >= 9223372036854775808.0)
+    return false;
+  ret = a * b;
+  return true;
+#endif
+}
+
+//modInt (INT64_MIN % -1 overflows in C++, the result is 0)
+static int64_t modInt(int64_t a, int64_t b) {
+  return b == -1 ? 0 : a % b;
+}
+
+//shiftInt (negative counts raise, counts of 64 or more shift everything out)
+static int64_t shiftInt(int64_t a, int64_t b, bool bLeft) {
+  if (b < 0)
+    raiseException("ValueError: negative shift count");
+  if (b >= 64)
+    return bLeft ? 0 : (a < 0 ? -1 : 0);
+  return bLeft ? (int64_t)((uint64_t)a << b) : (a >> b);
+}
+
+//compareString
+static int compareString(const Value& a, const Value& b) {
+  auto sa = a.asString();
+  auto sb = b.asString();
+  int len = std::min(sa->len(), sb->len());
+  int v = memcmp(sa->data(), sb->data(), len);
+  return v ? v : (sa->len() - sb->len());
+}
+
+//compareList
+static int compareList(const Value& a, const Value& b)
+{
+  auto la = a.asList();
+  auto lb = b.asList();
 
-  case Object::FunctionType:
-    return a.get() - b.get();
+  int len = std::min(la->size(), lb->size());
+  for (int n = 0; n < len; n++)
+  {
+    const auto& aa = la->getAt(n);
+    const auto& bb = lb->getAt(n);
 
+    int v;
+    if (aa.type() == Object::ListType && bb.type() == Object::ListType)
+      v = (const char*)aa.identity() - (const char*)bb.identity();
+    else
+      v = Object::compare(aa, bb);
+    if (v)
+      return v;
   }
+  return la->size() - lb->size();
+}
 
-  raiseException("(py_cmp) TypeError: ?");
-  return 0;
+//compareIdentity
+static int compareIdentity(const Value& a, const Value& b) {
+  return (const char*)a.identity() - (const char*)b.identity();
+}
+
+//addNumber
+static Value addNumber(PyEngine* py, const Value& a, const Value& b) {
+  int64_t ret;
+  if (a.isInt() && b.isInt() && addInt(a.getInt(), b.getInt(), ret))
+    return py->createInt(ret);
+  return py->createNumber(a.getNumber() + b.getNumber());
+}
+
+//addString
+static Value addString(PyEngine* py, const Value& a, const Value& b) {
+  return a.asString()->concat(*b.asString());
+}
+
+//addList
+static Value addList(PyEngine* py, const Value& a, const Value& b) {
+  auto ret = py->createList();
+  ret->append(*a.asList());
+  ret->append(*b.asList());
+  return ret;
+}
+
+//repeatString
+static Value repeatString(PyEngine* py, const String& s, int n) {
+  std::ostringstream out;
+  for (int I = 0; I < n; I++)
+    out << s;
+  return py->createString(out.str());
+}
+
+//mulNumber
+static Value mulNumber(PyEngine* py, const Value& a, const Value& b) 
+{
+  int64_t ret;
+  if (a.isInt() && b.isInt() && mulInt(a.getInt(), b.getInt(), ret))
+    return py->createInt(ret);
+
+  if (b.isNumber())
+    return py->createNumber(a.getNumber() * b.getNumber());
+
+  if (b.type() == Object::StringType)
+    return repeatString(py, b.asString()->str(), (int)a.getNumber());
+
+  raiseException("(pyMul) TypeError: ?");
+  return Value();
+}
+
+//mulString
+static Value mulString(PyEngine* py, const Value& a, const Value& b) 
+{
+  if (b.isNumber())
+    return repeatString(py, a.asString()->str(), (int)b.getNumber());
+
+  raiseException("(pyMul) TypeError: ?");
+  return Value();
+}
+
+static const TypeOps type_ops[Object::TotalTypes] =
+{
+  /*NoneType    */ { compareNone    , nullptr  , nullptr   },
+  /*NumberType  */ { compareNumber  , addNumber, mulNumber },
+  /*StringType  */ { compareString  , addString, mulString },
+  /*DictType    */ { compareIdentity, nullptr  , nullptr   },
+  /*ListType    */ { compareList    , addList  , nullptr   },
+  /*FunctionType*/ { compareIdentity, nullptr  , nullptr   },
+};
+
+////////////////////////////////////////////////////////////////////////
+int Object::compare(const Value& a, const Value& b)
+{
+  //fast path for the comparison opcodes in numeric loops
+  if (a.isNumber() && b.isNumber())
+    return compareNumber(a, b);
+
+  int atype = a.type();
+  int btype = b.type();
+
+  if (atype != btype)
+    return atype - btype;
+
+  return type_ops[atype].compare(a, b);
 }
 
 
 ///////////////////////////////////////////////////////////////////////////////////
-SharedPtr<Object> StringObject::getAttr(SharedPtr<Object> k)
+void StringObject::flatten() const
 {
-  auto s = this->val;
+  //the only string on the buffer takes it over
+  if (buffer->useCount() == 1) 
+  {
+    val.swap(buffer->data);
+    val.resize(offset + length);
+    val.erase(0, offset);
+  }
+  else 
+  {
+    val.assign(buffer->data, offset, length);
+  }
+  buffer.reset();
+  offset = 0;
+}
 
-  if (k->type == Object::NumberType)
+///////////////////////////////////////////////////////////////////////////////////
+SharedPtr<StringObject> StringObject::concat(const StringObject& other) const
+{
+  int total = length + other.length;
+
+  //short strings are not worth a buffer
+  if (total < 64)
   {
-    int n = k->castToNumber()->val;
-    int l = s.length();
-    n = (n < 0 ? l + n : n);
-    if (n >= 0 && n < l) {
-      return py->createString(String(&s[n], 1));
-    }
+    String ret;
+    ret.reserve(total);
+    appendTo(ret);
+    other.appendTo(ret);
+    return py->createString(ret);
   }
-  else if (k->type == Object::StringType)
+
+  //another string already appended to the buffer, or slices share it: start a new one
+  auto dst = buffer;
+  if (!dst || dst->frozen || offset || (int)dst->data.length() != length)
   {
-    auto ks = k->castToString()->val;
+    dst = makeShared<StringBuffer>();
+    dst->data.reserve(2 * total);
+    appendTo(dst->data);
+  }
 
-    //join
-    if (ks == "join")
-    {
-      return py->createMethod(self(), [](PyEngine *py, SharedPtr<ListObject> args)
-      {
-        auto delim = args->getStringAt(0);
-        auto list = args->getListAt(1);
-
-        std::ostringstream out;
-        for (int i = 0; i < list->size(); i++)
-        {
-          if (i) out << delim;
-          out << list->getAt(i)->toString();
-        }
-
-        return py->createString(out.str());
-      });
-    }
+  if (other.buffer.get() == dst.get())
+    dst->data.append(String(dst->data, other.offset, other.length));
+  else
+    other.appendTo(dst->data);
 
-    //split
-    if (ks == "split")
-    {
-      return py->createMethod(self(), [](PyEngine *py, SharedPtr<ListObject> args)
-      {
-        String v = args->getStringAt(0);
-        String d = args->getStringAt(1);
-        auto ret = py->createList();
-        for (auto it : StringUtils::split(v, d))
-          ret->pushBack(py->createString(it.c_str()));
-        return ret;
-      });
-    }
+  return makeObject<StringObject>(py, dst, 0, total);
+}
 
-    //index
-    if (ks == "index")
-    {
-      return py->createMethod(self(), [](PyEngine *py, SharedPtr<ListObject> args)
-      {
-        auto s = args->getStringAt(0);
-        auto v = args->getStringAt(1);
-        int n = (int)s.find(v);
-        if (n<0)
-          raiseException("(index) ValueError: substring not found");
-        return py->createNumber(n);
-      });
-    }
+///////////////////////////////////////////////////////////////////////////////////
+SharedPtr<StringObject> StringObject::slice(int a, int b) const
+{
+  int n = b - a;
+  if (n <= 0)
+    return py->createString();
 
-    //strip
-    if (ks == "strip")
-    {
-      return py->createMethod(self(), [](PyEngine *py, SharedPtr<ListObject> args)
-      {
-        auto s = args->getStringAt(0);
-        s = StringUtils::trim(s);
-        return py->createString(s);
-      });
-    }
+  int storage = buffer ? (int)buffer->data.length() : length;
+  if (n < 64 || 4 * n < storage)
+    return py->createString(String(data() + a, n));
 
-    //replace
-    if (ks == "replace")
-    {
-      return py->createMethod(self(), [](PyEngine *py, SharedPtr<ListObject> args)
-      {
-        auto s = args->getStringAt(0);
-        auto k = args->getStringAt(1);
-        auto v = args->getStringAt(2);
-        return py->createString(StringUtils::replaceAll(s, k, v));
-      });
+  //move a flat string to a buffer, it reads it in place from now on
+  if (!buffer)
+  {
+    buffer = makeShared<StringBuffer>();
+    buffer->data.swap(val);
+    offset = 0;
+  }
+  buffer->frozen = true;
+
+  return makeObject<StringObject>(py, buffer, offset + a, n);
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+Value StringObject::getAttr(const Value& k)
+{
+  if (k.type() == Object::NumberType)
+  {
+    int n = (int)k.getInt();
+    int l = length;
+    n = (n < 0 ? l + n : n);
+    if (n >= 0 && n < l) {
+      return py->createChar(data()[n]);
     }
   }
+  else if (k.type() == Object::StringType)
+  {
+    if (auto method = py->findMethod(StringType, k))
+      return py->bindFunction(method, self());
+  }
 
   //extract substring
-  if (k->type == Object::ListType)
+  if (k.type() == Object::ListType)
   {
-    auto extractNumber = [](SharedPtr<Object> value, int default_value) {
+    auto extractNumber = [](const Value& value, int default_value) {
 
-      if (value->type == Object::NumberType)
-        return (int)value->castToNumber()->val;
+      if (value.type() == Object::NumberType)
+        return (int)value.getNumber();
 
-      if (value->type == Object::NoneType)
+      if (value.type() == Object::NoneType)
         return default_value;
 
       raiseException("(pyGet) TypeError: indices must be numbers");
       return 0;
     };
 
-    auto klist = k->castToList();
+    auto klist = k.castToList();
 
     int l = this->len();
     int a = extractNumber(klist->getAt(0), 0);
@@ -256,7 +449,7 @@ SharedPtr<Object> StringObject::getAttr(SharedPtr<Object> k)
     a = std::max(0, (a < 0 ? l + a : a));
     b = std::min(l, (b < 0 ? l + b : b));
 
-    return py->createString(StringUtils::substring(this->val, a, b));
+    return slice(a, b);
   }
 
   return Object::getAttr(k);
@@ -264,11 +457,11 @@ SharedPtr<Object> StringObject::getAttr(SharedPtr<Object> k)
 
 
 ///////////////////////////////////////////////////////////////////////////////////
-SharedPtr<Object> ListObject::getAttr(SharedPtr<Object> k)
+Value ListObject::getAttr(const Value& k)
 {
-  if (k->type == Object::NumberType)
+  if (k.type() == Object::NumberType)
   {
-    int n = k->castToNumber()->val;
+    int n = (int)k.getInt();
     int len = this->size();
     if (n<0) n = len + n;
 
@@ -278,63 +471,12 @@ SharedPtr<Object> ListObject::getAttr(SharedPtr<Object> k)
     return this->getAt(n);
   }
 
-  if (k->type == Object::StringType)
+  if (k.type() == Object::StringType)
   {
-    auto s = k->castToString()->val;
-
-    if (s == "append")
-    {
-      return py->createMethod(self(), [](PyEngine *py, SharedPtr<ListObject> args) {
-        auto list = args->getListAt(0);
-        auto obj = args->getAt(1);
-        list->pushBack(obj);
-        return NoneObject;
-      });
-    }
+    if (auto method = py->findMethod(ListType, k))
+      return py->bindFunction(method, self());
 
-    if (s == "pop")
-    {
-      return py->createMethod(self(), [](PyEngine *py, SharedPtr<ListObject> args) {
-        return args->getListAt(0)->popBack();
-      });
-    }
-
-    if (s == "index")
-    {
-      return py->createMethod(self(), [](PyEngine *py, SharedPtr<ListObject> args)
-      {
-        auto list = args->getListAt(0);
-        auto what = args->getAt(1);
-
-        int i = list->find(what);
-        if (i < 0) {
-          raiseException(StringUtils::format() 
-            << "List " << list->toString() << " does not contain index " << what->toString());
-        }
-
-        return py->createNumber(i);
-      });
-    }
-
-    if (s == "sort")
-    {
-      return py->createMethod(self(), [](PyEngine *py, SharedPtr<ListObject> args) {
-        auto list = args->getListAt(0);
-        list->sort();
-        return NoneObject;
-      });
-    }
-
-    if (s == "extend")
-    {
-      return py->createMethod(self(), [](PyEngine *py, SharedPtr<ListObject> args)
-      {
-        auto l1 = args->getListAt(0);
-        auto l2 = args->getListAt(1);
-        l1->append(*l2);
-        return NoneObject;
-      });
-    }
+    const auto& s = k.castToString()->str();
 
     if (s == "*")
     {
@@ -344,26 +486,26 @@ SharedPtr<Object> ListObject::getAttr(SharedPtr<Object> k)
     }
   }
 
-  else if (k->type == Object::NoneType) {
+  else if (k.type() == Object::NoneType) {
     return this->popFront();
   }
 
   //___________________________________________________
-  if (k->type == Object::ListType)
+  if (k.type() == Object::ListType)
   {
-    auto extractNumber = [](SharedPtr<Object> value, int default_value) {
+    auto extractNumber = [](const Value& value, int default_value) {
 
-      if (value->type == Object::NumberType)
-        return (int)value->castToNumber()->val;
+      if (value.type() == Object::NumberType)
+        return (int)value.getNumber();
 
-      if (value->type == Object::NoneType)
+      if (value.type() == Object::NoneType)
         return default_value;
 
       raiseException("(pyGet) TypeError: indices must be numbers");
       return 0;
     };
 
-    auto klist = k->castToList();
+    auto klist = k.castToList();
 
     int l = this->len();
     int a = extractNumber(klist->getAt(0),0);
@@ -372,10 +514,10 @@ SharedPtr<Object> ListObject::getAttr(SharedPtr<Object> k)
     a = std::max(0, (a < 0 ? l + a : a));
     b = std::min(l, (b < 0 ? l + b : b));
 
-    auto ret = py->createList();
-    for (int i = 0; i < b - a; i++)
-      ret->pushBack(this->getAt(a + i));
-    return ret;
+    if (b <= a)
+      return py->createList();
+
+    return py->createList(Vector(this->begin() + a, this->begin() + b));
   }
 
   return Object::getAttr(k);
@@ -384,11 +526,11 @@ SharedPtr<Object> ListObject::getAttr(SharedPtr<Object> k)
 
 
 /////////////////////////////////////////////////////////////////////////////////////////
-void ListObject::setAttr(SharedPtr<Object> k, SharedPtr<Object> v)
+void ListObject::setAttr(const Value& k, const Value& v)
 {
-  if (k->type == Object::NumberType)
+  if (k.type() == Object::NumberType)
   {
-    int index = k->castToNumber()->val;
+    int index = k.getNumber();
 
     if (index >= this->size())
       raiseException("(py_list_set) KeyError");
@@ -397,18 +539,18 @@ void ListObject::setAttr(SharedPtr<Object> k, SharedPtr<Object> v)
     return;
   }
 
-  if (k->type == Object::NoneType)
+  if (k.type() == Object::NoneType)
   {
     this->pushBack(v);
     return;
   }
 
-  if (k->type == Object::StringType)
+  if (k.type() == Object::StringType)
   {
-    auto ks = k->castToString()->val;
+    const auto& ks = k.castToString()->str();
     if (ks == "*")
     {
-      if (auto other = v->castToList())
+      if (auto other = v.castToList())
         this->append(*other);
       return;
     }
@@ -418,579 +560,1276 @@ void ListObject::setAttr(SharedPtr<Object> k, SharedPtr<Object> v)
 }
 
 ///////////////////////////////////////////////////////////////////////////////////
-SharedPtr<Object> DictObject::getAttr(SharedPtr<Object> k)
+Value DictObject::getAttr(const Value& k)
 {
   if (this->isObject())
   {
-    if (auto get_function = this->lookup(py->createString("__get__")))
-      return get_function->call(py->createList({ k }));
+    Value get_function;
+    if (this->lookup(py->keyGet, get_function))
+      return get_function.call(py->createList({ k }));
   }
 
-  if (auto ret = this->lookup(k))
+  Value ret;
+  if (this->lookup(k, ret))
     return ret;
 
-  auto it = this->map.find(k);
-  if (it == this->end())
+  //iterating *this would move an instance off its shape
+  std::vector<String> keys;
+  if (shape)
   {
-    std::vector<String> keys;
-    for (auto jt : *this)
-      keys.push_back(jt.first->toString());
-
-    auto skey = k->toString();
-    raiseException(StringUtils::format() << "(py_dict_get) KeyError: " << skey << " not in " << StringUtils::join(keys, ",", "{", "}"));
+    for (const auto& it : shape->keys)
+      keys.push_back(it->str());
+  }
+  else
+  {
+    for (const auto& it : static_cast<const Map&>(map))
+      keys.push_back(it.first.toString());
   }
 
-  return it->second;
+  auto skey = k.toString();
+  raiseException(StringUtils::format() << "(py_dict_get) KeyError: " << skey << " not in " << StringUtils::join(keys, ",", "{", "}"));
+  return Value();
 }
 
 
 /////////////////////////////////////////////////////////////////////////////////////////
-void DictObject::setAttr(SharedPtr<Object> k, SharedPtr<Object> v)
+void DictObject::setAttr(const Value& k, const Value& v)
 {
   if (this->isObject())
   {
-    if (auto set_function = this->lookup(py->createString("__set__"))) 
+    Value set_function;
+    if (this->lookup(py->keySet, set_function)) 
     {
-      set_function->call(py->createList({ k, v }));
+      set_function.call(py->createList({ k, v }));
       return;
     }
   }
 
+  this->setItem(k, v);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+void DictObject::setItem(const Value& k, const Value& v)
+{
+  if (shape)
+  {
+    //only names already interned, the transitions live as long as the engine
+    auto s = k.asString();
+    if (auto key = !s ? nullptr : s->interned ? s : py->findInterned(s->data(), s->len(), s->computeHash()))
+    {
+      int slot = shape->find(key);
+      if (slot >= 0) {
+        slots[slot] = v;
+        return;
+      }
+
+      auto next = (int)slots.size() < Shape::MaxSlots ? shape->addKey(SharedPtr<StringObject>(key)) : nullptr;
+      if (next) {
+        shape = SharedPtr<Shape>(next);
+        slots.push_back(v);
+        touch();
+        return;
+      }
+    }
+
+    ensureMap();
+  }
+
+  auto mutations = map.mutations();
   this->map[k] = v;
+  if (map.mutations() != mutations)
+    touch();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+Value& HashMap::operator[](const Value& k)
+{
+  int hash = k.computeHash();
+  int index = findEntry(k, hash);
+  if (index >= 0)
+    return entries[index].second;
+
+  //keep the index at most 2/3 full, deleted entries included
+  if ((size_t)(num_filled + 1) * 3 > indices.size() * 2)
+    rehash();
+
+  size_t mask = indices.size() - 1;
+  size_t perturb = (unsigned)hash;
+  size_t I = perturb & mask;
+  while (indices[I] >= 0)
+    I = (I * 5 + 1 + (perturb >>= 5)) & mask;
+
+  if (indices[I] == Empty)
+    num_filled++;
+
+  indices[I] = (int)entries.size();
+  entries.push_back(Entry());
+  num_mutations++;
+  auto& entry = entries.back();
+  entry.first = k;
+  entry.hash  = hash;
+  entry.used  = true;
+  num_used++;
+  return entry.second;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+size_t HashMap::findIndex(int hash, int index) const
+{
+  size_t mask = indices.size() - 1;
+  size_t perturb = (unsigned)hash;
+  size_t I = perturb & mask;
+  while (indices[I] != index)
+    I = (I * 5 + 1 + (perturb >>= 5)) & mask;
+  return I;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+void HashMap::erase(iterator it)
+{
+  int index = it.position();
+  auto& entry = entries[index];
+  indices[findIndex(entry.hash, index)] = Deleted;
+  entry = Entry();
+  num_used--;
+  num_mutations++;
+
+  //trailing holes are free
+  while (!entries.empty() && !entries.back().used)
+    entries.pop_back();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+void HashMap::rehash()
+{
+  size_t size = MinSize;
+  while (size < (size_t)num_used * 3)
+    size <<= 1;
+
+  if ((int)entries.size() != num_used)
+  {
+    std::vector<Entry> compacted;
+    compacted.reserve(num_used);
+    for (auto& it : entries)
+      if (it.used) compacted.push_back(std::move(it));
+    entries.swap(compacted);
+  }
+
+  indices.assign(size, Empty);
+  size_t mask = size - 1;
+  for (int index = 0; index < (int)entries.size(); index++)
+  {
+    size_t perturb = (unsigned)entries[index].hash;
+    size_t I = perturb & mask;
+    while (indices[I] != Empty)
+      I = (I * 5 + 1 + (perturb >>= 5)) & mask;
+    indices[I] = index;
+  }
+  num_filled = (int)entries.size();
+  num_mutations++;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+int DictObject::findSlot(const Value& k) const
+{
+  auto s = k.asString();
+  if (!s)
+    return -1;
+
+  //all the names in a shape are interned
+  const StringObject* key = s->interned ? s : py->findInterned(s->data(), s->len(), s->computeHash());
+  return key ? shape->find(key) : -1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+void DictObject::ensureMap()
+{
+  if (!shape)
+    return;
+
+  for (int I = 0; I < (int)slots.size(); I++)
+    map[Value(shape->keys[I])] = slots[I];
+
+  slots.clear();
+  shape.reset();
+  touch();
 }
 
 
 //////////////////////////////////////////////////////////////////////
-SharedPtr<Object> DictObject::lookup(SharedPtr<Object> k, int depth)
+bool DictObject::lookup(const Value& k, Value& ret, int depth)
 {
-  auto it = this->map.find(k);
-  if (it != this->end())
-    return it->second;
+  if (shape)
+  {
+    int slot = findSlot(k);
+    if (slot >= 0) 
+    {
+      ret = slots[slot];
+      return true;
+    }
+  }
+  else
+  {
+    auto it = this->map.find(k);
+    if (it != this->map.end())
+    {
+      ret = it->second;
+      return true;
+    }
+  }
 
   if (!--depth)
     raiseException("(pyLookUp) RuntimeError: maximum lookup depth exceeded");
 
   if (this->meta)
   {
-    if (auto ret = this->meta->lookup(k, depth))
+    if (this->meta->lookup(k, ret, depth))
     {
-      if (this->isObject() && ret->type == Object::FunctionType) 
+      if (this->isObject() && ret.type() == Object::FunctionType) 
       {
-        auto fn = ret->castToFunction();
-        ret = py->createFunction(fn->function, self(), fn->bytecode, fn->globals);
+        ret = py->bindFunction(ret.asFunction(), self());
       }
-      return ret;
+      return true;
     }
   }
 
-  return SharedPtr<Object>();
+  return false;
 }
 
 //////////////////////////////////////////////////////////////////////
-SharedPtr<Object> DictObject::call(SharedPtr<ListObject> args)
+Value DictObject::call(SharedPtr<ListObject> args)
 {
   if (this->isDict())
   {
-    if (auto new_function = this->lookup(py->createString("__new__")))
+    Value new_function;
+    if (this->lookup(py->keyNew, new_function))
     {
       args->pushFront(self());
-      return new_function->call(args);
+      return new_function.call(args);
     }
   }
   else
   {
     assert(this->isObject());
 
-    if (auto call_function = this->lookup(py->createString("__call__")))
-      return call_function->call(args);
+    Value call_function;
+    if (this->lookup(py->keyCall, call_function))
+      return call_function.call(args);
   }
 
   return Object::call(args);
 }
 
 //////////////////////////////////////////////////////////////////////
-SharedPtr<Object> FunctionObject::call(SharedPtr<ListObject> args)
+Value FunctionObject::call(SharedPtr<ListObject> args)
 {
-  if (this->function)
-  {
-    //if is method I need to insert the obj as first 
-    if (this->instance)
-      args->pushFront(this->instance);
+  //the frame pops its parameters, the caller's list must survive
+  if (!this->function)
+    args = py->createList(args->items);
 
-    return this->function(py, args);
-  }
-  else
-  {
-    auto list = py->createList(args->items);
+  //if is method I need to insert the obj as first 
+  if (this->isMethod())
+    args->pushFront(this->instance);
 
-    //if is method I need to insert the obj as first 
-    if (this->instance)
-      list->pushFront(this->instance);
+  return invoke(args);
+}
 
-    return py->runFrame(this->bytecode, { list }, this->globals);
-  }
-
-  return Object::call(args);
+////////////////////////////////////////////////////////////////////////////////
+Value FunctionObject::invoke(SharedPtr<ListObject> args)
+{
+  if (this->function)
+    return this->function(py, args);
+
+  return py->runFrame(this->code, { args }, this->globals);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 PyEngine::PyEngine(int argc, char *argv[])
 {
+  gc_young.gc_prev = gc_young.gc_next = &gc_young;
+  gc_old  .gc_prev = gc_old  .gc_next = &gc_old;
+
+  //native stack left to nested runs, 1MB (or a quarter of a small stack) kept for the work of the innermost one
+  size_t stack_size = 8 << 20;
+#ifdef _WIN32
+  stack_size = 1 << 20;
+#else
+  struct rlimit limit;
+  if (getrlimit(RLIMIT_STACK, &limit) == 0 && limit.rlim_cur != RLIM_INFINITY)
+    stack_size = (size_t)limit.rlim_cur;
+#endif
+  stack_budget = stack_size - std::min(stack_size / 4, (size_t)(1 << 20));
+
+  this->keyGet  = this->internString("__get__");
+  this->keySet  = this->internString("__set__");
+  this->keyNew  = this->internString("__new__");
+  this->keyCall = this->internString("__call__");
+  this->keyInit = this->internString("__init__");
+
+  for (int I = 0; I < 256; I++) {
+    char ch = (char)I;
+    chars[I] = this->internString(&ch, 1);
+  }
+
   this->builtins = this->createDict();
   this->modules  = this->createDict();
 
-  this->builtins->setAttr(this->createString("MODULES" ), this->modules);
-  this->modules ->setAttr(this->createString("BUILTINS"), this->builtins);
-  this->builtins->setAttr(this->createString("BUILTINS"), this->builtins);
+  this->builtins.setAttr(this->internString("MODULES" ), this->modules);
+  this->modules .setAttr(this->internString("BUILTINS"), this->builtins);
+  this->builtins.setAttr(this->internString("BUILTINS"), this->builtins);
 
   auto sys = this->createDict();
-  sys->setAttr(this->createString("version"), this->createString("tinypy"));
-  modules->setAttr(this->createString("sys"), sys);
+  sys->setAttr(this->internString("version"), this->createString("tinypy"));
+  modules.setAttr(this->internString("sys"), sys);
 
   addBuiltIns();
+  addMethods();
 
   auto bytecode = String((char*)py_tinypy, sizeof(py_tinypy));
   auto module = this->createDict();
-  module->setAttr(createString("__name__"), this->createString("tinypy"));
-  module->setAttr(createString("__code__"), this->createString(bytecode));
-  module->setAttr(createString("__dict__"), module);
+  module->setAttr(internString("__name__"), this->createString("tinypy"));
+  module->setAttr(internString("__code__"), this->createString(bytecode));
+  module->setAttr(internString("__dict__"), module);
   
-  modules->setAttr(createString("tinypy"), module);
+  modules.setAttr(internString("tinypy"), module);
 
-  runFrame(bytecode, {}, module);
+  runFrame(decodeCode(bytecode), {}, module);
 }
 
 ////////////////////////////////////////////////////////////////////
 PyEngine::~PyEngine()
 {
+  //modules and builtins reference themselves
+  builtins = Value();
+  modules  = Value();
+  collectGarbage();
+
+  //survivors are referenced from the outside and must not unlink from the lists later
+  for (auto head : { &gc_young, &gc_old })
+  {
+    while (head->gc_next != head)
+      head->gc_next->gcUnlink();
+  }
+
+  //objects still referenced from the outside keep the pool alive
+  pool->releaseOwner();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int PyEngine::collectGeneration(GcNode* head, int generation, int& num_alive)
+{
+  //containers of older generations are not scanned, their references count as external
+  auto inGeneration = [generation](Object* obj) {
+    return obj->isTracked() && obj->gc_generation <= generation;
+  };
+
+  //count references from outside the scanned containers (trial deletion)
+  for (auto node = head->gc_next; node != head; node = node->gc_next)
+    node->gc_refs = static_cast<Object*>(node)->useCount();
+
+  for (auto node = head->gc_next; node != head; node = node->gc_next)
+  {
+    static_cast<Object*>(node)->visitRefs([&inGeneration](Object* obj) {
+      if (inGeneration(obj))
+        obj->gc_refs--;
+    });
+  }
+
+  //everything reachable from an externally referenced container survives (marked with -1)
+  std::vector<Object*> stack;
+  for (auto node = head->gc_next; node != head; node = node->gc_next)
+  {
+    if (node->gc_refs > 0) 
+    {
+      node->gc_refs = -1;
+      stack.push_back(static_cast<Object*>(node));
+    }
+  }
+
+  num_alive = 0;
+  while (!stack.empty())
+  {
+    auto obj = stack.back();
+    stack.pop_back();
+    num_alive++;
+    obj->visitRefs([&stack, &inGeneration](Object* child) {
+      if (inGeneration(child) && child->gc_refs >= 0) {
+        child->gc_refs = -1;
+        stack.push_back(child);
+      }
+    });
+  }
+
+  //keep the garbage alive while breaking its cycles, then let refcounting free it
+  std::vector< SharedPtr<Object> > garbage;
+  for (auto node = head->gc_next; node != head; node = node->gc_next)
+  {
+    if (node->gc_refs == 0)
+      garbage.push_back(SharedPtr<Object>(static_cast<Object*>(node)));
+  }
+
+  for (auto it : garbage)
+    it->clearRefs();
+
+  return (int)garbage.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void PyEngine::promoteYoung()
+{
+  for (auto node = gc_young.gc_next; node != &gc_young; node = node->gc_next)
+    node->gc_generation = 1;
+  GcNode::gcSplice(&gc_young, &gc_old);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int PyEngine::collectGarbage(bool bFull)
+{
+  auto t1 = std::chrono::steady_clock::now();
+
+  gc_allocations = 0;
+
+  int ret, num_alive;
+  if (bFull)
+  {
+    //the young containers are collected with the old ones, the survivors stay old
+    promoteYoung();
+    ret = collectGeneration(&gc_old, 1, num_alive);
+    gc_promoted  = 0;
+    gc_old_alive = num_alive;
+    gc_stats.full_collections++;
+  }
+  else
+  {
+    ret = collectGeneration(&gc_young, 0, num_alive);
+    promoteYoung();
+    gc_promoted += num_alive;
+    gc_stats.young_collections++;
+  }
+
+  auto t2 = std::chrono::steady_clock::now();
+  double pause = std::chrono::duration<double>(t2 - t1).count();
+  gc_stats.freed      += ret;
+  gc_stats.last_pause  = pause;
+  gc_stats.max_pause   = std::max(gc_stats.max_pause, pause);
+  gc_stats.total_pause += pause;
+
+  return ret;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AttrCache::Entry* AttrCache::find(const DictObject* dict, const StringObject* key)
+{
+  for (int I = 0; I < num_entries; I++)
+  {
+    auto& entry = entries[I];
+    if (entry.shape != dict->shape.get() || entry.key != key)
+      continue;
+
+    //the whole meta chain must be unchanged
+    auto meta = dict->meta.get();
+    int N = 0;
+    for (; N < entry.num_chain && meta == entry.chain[N] && meta->version == entry.versions[N]; N++)
+      meta = meta->meta.get();
+
+    if (N == entry.num_chain && !meta)
+      return &entry;
+  }
+  return nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool PyEngine::fillAttrCache(AttrCache::Entry& entry, DictObject* dict, StringObject* key, bool bSet)
+{
+  const auto& hook = bSet ? keySet : keyGet;
+
+  //the receiver must not have the hook itself
+  if (dict->shape->find(hook.get()) >= 0)
+    return false;
+
+  entry.shape = dict->shape.get();
+  entry.key   = key;
+  entry.slot  = dict->shape->find(key);
+  entry.value = nullptr;
+  entry.new_shape = nullptr;
+  entry.num_chain = 0;
+
+  bool bFound = entry.slot >= 0;
+  for (auto meta = dict->meta.get(); meta; meta = meta->meta.get())
+  {
+    if (entry.num_chain == AttrCache::MaxChain)
+      return false;
+
+    entry.chain   [entry.num_chain] = meta;
+    entry.versions[entry.num_chain] = meta->version;
+    entry.num_chain++;
+
+    //lookup() of a meta that is not an instance
+    if (meta->shape)
+    {
+      if (meta->shape->find(hook.get()) >= 0)
+        return false;
+
+      if (!bFound && !bSet && meta->shape->find(key) >= 0) {
+        entry.value = &meta->slots[meta->shape->find(key)];
+        bFound = true;
+      }
+    }
+    else
+    {
+      if (meta->map.find(Value(hook)) != meta->map.end())
+        return false;
+
+      if (!bFound && !bSet) {
+        auto it = meta->map.find(Value(SharedPtr<StringObject>(key)));
+        if (it != meta->map.end()) {
+          entry.value = &it->second;
+          bFound = true;
+        }
+      }
+    }
+  }
+
+  if (bSet)
+  {
+    if (entry.slot < 0)
+    {
+      if ((int)dict->slots.size() >= Shape::MaxSlots)
+        return false;
+      //no transition left, setItem moves the instance to its map
+      entry.new_shape = dict->shape->addKey(SharedPtr<StringObject>(key));
+      if (!entry.new_shape)
+        return false;
+    }
+    return true;
+  }
+
+  return bFound;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Value PyEngine::cachedGetAttr(Frame* frame, int word, const Value& obj, const Value& k, Value* receiver)
+{
+  auto dict = obj.asDict();
+  auto key  = k.asString();
+  if (!dict || !dict->shape || !key || !key->interned)
+    return obj.getAttr(k);
+
+  auto& cache = frame->code->caches.attr(word, (int)frame->code->bytecode.size() / 4);
+
+  auto entry = cache.find(dict, key);
+  if (!entry)
+  {
+    AttrCache::Entry tmp;
+    if (!fillAttrCache(tmp, dict, key, false))
+      return obj.getAttr(k);
+    entry = &(cache.add() = tmp);
+  }
+
+  if (entry->slot >= 0)
+    return dict->slots[entry->slot];
+
+  //methods are bound to the receiver, as in DictObject::lookup
+  //only an unbound one can be returned with the receiver apart, a bound one would get both
+  if (auto fn = entry->value->asFunction()) 
+  {
+    if (!receiver || fn->isMethod())
+      return this->bindFunction(fn, obj);
+    *receiver = obj;
+  }
+
+  return *entry->value;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void PyEngine::cachedSetAttr(Frame* frame, int word, const Value& obj, const Value& k, const Value& v)
+{
+  auto dict = obj.asDict();
+  auto key  = k.asString();
+  if (!dict || !dict->shape || !key || !key->interned)
+    return obj.setAttr(k, v);
+
+  auto& cache = frame->code->caches.attr(word, (int)frame->code->bytecode.size() / 4);
+
+  auto entry = cache.find(dict, key);
+  if (!entry)
+  {
+    AttrCache::Entry tmp;
+    if (!fillAttrCache(tmp, dict, key, true))
+      return obj.setAttr(k, v);
+    entry = &(cache.add() = tmp);
+  }
+
+  if (entry->slot >= 0) 
+  {
+    dict->slots[entry->slot] = v;
+  }
+  else 
+  {
+    dict->shape = SharedPtr<Shape>(entry->new_shape);
+    dict->slots.push_back(v);
+    dict->touch();
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Value PyEngine::cachedGetGlobal(Frame* frame, int word, const Value& k)
+{
+  auto globals  = frame->globals.get();
+  auto builtins = this->builtins.asDict();
+  auto key      = k.asString();
+
+  auto& cache = frame->code->caches.global(word, (int)frame->code->bytecode.size() / 4);
+
+  if (cache.value && cache.key == key && cache.globals == globals &&
+    cache.globals_version == globals->version && cache.builtins_version == builtins->version)
+    return *cache.value;
+
+  auto it = globals->map.find(k);
+  if (it != globals->map.end())
+  {
+    cache.value = &it->second;
+  }
+  else
+  {
+    //anything else (e.g. a KeyError) goes through getAttr and is not cached
+    auto jt = builtins->map.find(k);
+    if (jt == builtins->map.end())
+      return this->builtins.getAttr(k);
+    cache.value = &jt->second;
+  }
+
+  cache.key              = key;
+  cache.globals          = globals;
+  cache.globals_version  = globals->version;
+  cache.builtins_version = builtins->version;
+  return *cache.value;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+FunctionObject* PyEngine::findMethod(int type, const Value& k)
+{
+  const auto& table = methods[type];
+  auto key = k.asString();
+  if (table.empty() || !key)
+    return nullptr;
+
+  //method names are interned, a name that never was cannot match
+  const StringObject* name = key->interned ? key : findInterned(key->data(), key->len(), key->computeHash());
+  for (const auto& it : table)
+  {
+    if (it.first.get() == name)
+      return it.second.get();
+  }
+  return nullptr;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 int PyEngine::runStep()
 {
-  auto bitwise_builtin_op=[&](String name, SharedPtr<Object> a, SharedPtr<Object> b, std::function<double(double, double)> fn)
+  auto number_builtin_op=[&](const char* name, const Value& a, const Value& b, double (*fn)(double, double))
   {
-    if (a->type == Object::NumberType && b->type == Object::NumberType)
-    {
-      auto na = a->castToNumber()->val;
-      auto nb = b->castToNumber()->val;
-      return this->createNumber(fn(na, nb));
-    }
+    if (a.isNumber() && b.isNumber())
+      return this->createNumber(fn(a.getNumber(), b.getNumber()));
+
+    raiseException(StringUtils::format() << name << " TypeError: unsupported operand type(s)");
+    return Value();
+  };
+
+  //exact on int64, doubles are truncated
+  auto bitwise_builtin_op=[&](const char* name, const Value& a, const Value& b, int64_t (*fn)(int64_t, int64_t))
+  {
+    if (a.isNumber() && b.isNumber())
+      return this->createInt(fn(a.getInt(), b.getInt()));
 
     raiseException(StringUtils::format() << name << " TypeError: unsupported operand type(s)");
-    return SharedPtr<NumberObject>();
+    return Value();
   };
 
 
-  while (1)
-  {
-    auto frame = frames.top();
-
-    auto& regs = frame->regs;
-
-    auto ptr = (unsigned char*)&frame->bytecode[frame->cursor];
+  //calls and returns between bytecode functions switch the frame in place, the cursor lives in ip meanwhile
+  Frame*               frame;
+  Value*               regs;
+  const unsigned char* code;
+  const unsigned char* ip;
+  const Value*         constants;
+
+  int op, A, B, C;
+  short Number;
+
+  //instructions that can run other frames publish the cursor before and read it back after
+#define SAVE_CURSOR() frame->cursor = (int)(ip - code)
+#define LOAD_CURSOR() ip = code + frame->cursor
+#define CURRENT_WORD() ((int)(ip - code) / 4 - 1)
+#define LOAD_FRAME() frame = frames.current(); regs = frame->regs; code = (const unsigned char*)frame->code->bytecode.data(); constants = frame->code->constants.data(); LOAD_CURSOR()
+#define FETCH() op = ip[0]; A = ip[1]; B = ip[2]; C = ip[3]; Number = short((B << 8) + C); ip += 4
+
+#if TINYPY_COMPUTED_GOTO
+  static void* const dispatch_table[OP_TOTAL + 1] = {
+    &&L_OP_EOF, &&L_OP_ADD, &&L_OP_SUB, &&L_OP_MUL, &&L_OP_DIV, &&L_OP_POW, &&L_OP_BITAND, &&L_OP_BITOR,
+    &&L_OP_CMP, &&L_OP_GET, &&L_OP_SET, &&L_OP_NUMBER, &&L_OP_STRING, &&L_OP_GGET, &&L_OP_GSET, &&L_OP_MOVE,
+    &&L_OP_DEF, &&L_OP_PASS, &&L_OP_JUMP, &&L_OP_CALL, &&L_OP_RETURN, &&L_OP_IF, &&L_OP_DEBUG, &&L_OP_EQ,
+    &&L_OP_LE, &&L_OP_LT, &&L_OP_DICT, &&L_OP_LIST, &&L_OP_NONE, &&L_OP_LEN, &&L_OP_LINE, &&L_OP_PARAMS,
+    &&L_OP_IGET, &&L_OP_FILE, &&L_OP_NAME, &&L_OP_NE, &&L_OP_HAS, &&L_OP_RAISE, &&L_OP_SETJMP, &&L_OP_MOD,
+    &&L_OP_LSH, &&L_OP_RSH, &&L_OP_ITER, &&L_OP_DEL, &&L_OP_REGS, &&L_OP_BITXOR, &&L_OP_IFN, &&L_OP_NOT,
+    &&L_OP_BITNOT, &&L_OP_LOADMETHOD, &&L_OP_CALLMETHOD, &&L_OP_CONSTANT,
+    &&L_default
+  };
+  //the computed goto does not run destructors, DISPATCH must not be reached with a live object in scope
+#define TARGET(name) case name: L_##name:
+#define TARGET_DEFAULT default: L_default:
+#define DISPATCH() do { FETCH(); goto *dispatch_table[op < OP_TOTAL ? op : OP_TOTAL]; } while (0)
+#else
+#define TARGET(name) case name:
+#define TARGET_DEFAULT default:
+#define DISPATCH() continue
+#endif
 
-    int op = ptr[0];
-    int A = (int)ptr[1]; 
-    int B = (int)ptr[2]; 
-    int C = (int)ptr[3]; 
+  LOAD_FRAME();
 
-    frame->cursor += 4;
-    auto Number = short((B<<8)+C);
+  while (1)
+  {
+    FETCH();
 
     switch (op)
     {
-    case OP_EOF:
-      popFrame(NoneObject);
-      return 0;
+    TARGET(OP_EOF) {
+      bool bNative = frame->native_caller;
+      popFrame(Value());
+      if (bNative)
+        return 0;
+    }
+    LOAD_FRAME();
+    collectIfDue();
+    DISPATCH();
 
-    case OP_ADD: {
+    TARGET(OP_ADD) {
 
-      auto add=[&](SharedPtr<Object> a, SharedPtr<Object> b)->SharedPtr<Object>
+      auto add=[&](const Value& a, const Value& b)->Value
       {
-        if (a->type == Object::NumberType && a->type == b->type)
-        {
-          auto na = a->castToNumber()->val;
-          auto nb = b->castToNumber()->val;
-          return this->createNumber(na + nb);
-        }
-
-        if (a->type == Object::StringType && a->type == b->type)
-        {
-          auto as = a->castToString()->val;
-          auto bs = b->castToString()->val;
-          return this->createString(as + bs);
-        }
-
-        if (a->type == Object::ListType && a->type == b->type)
-        {
-          auto la = a->castToList();
-          auto lb = b->castToList();
-          auto ret = this->createList();
-          ret->append(*la);
-          ret->append(*lb);
-          return ret;
-        }
-        raiseException("(pyAdd) TypeError: ?");
-        return NoneObject;
+        int64_t ret;
+        if (a.isInt() && b.isInt() && addInt(a.getInt(), b.getInt(), ret))
+          return this->createInt(ret);
+
+        if (a.isNumber() && b.isNumber())
+          return this->createNumber(a.getNumber() + b.getNumber());
+
+        auto fn = a.type() == b.type() ? type_ops[a.type()].add : nullptr;
+        if (!fn)
+          raiseException("(pyAdd) TypeError: ?");
+
+        return fn(this, a, b);
       };
 
       regs[A] = add(regs[B], regs[C]);
-      continue;
+      DISPATCH();
     }
 
-    case OP_SUB: {
+    TARGET(OP_SUB) {
+
+      auto sub=[&](const Value& a, const Value& b) 
+      {
+        int64_t ret;
+        if (a.isInt() && b.isInt() && subInt(a.getInt(), b.getInt(), ret))
+          return this->createInt(ret);
 
-      auto sub=[&](SharedPtr<Object> a, SharedPtr<Object> b) {
-        return bitwise_builtin_op("bitwise_sub", a, b, [](double a, double b) {return a - b; });
+        return number_builtin_op("bitwise_sub", a, b, [](double a, double b) {return a - b; });
       };
 
       regs[A] = sub(regs[B], regs[C]);
-      continue;
+      DISPATCH();
     }
 
-    case OP_MUL: {
+    TARGET(OP_MUL) {
 
-      auto mul=[&](SharedPtr<Object> a, SharedPtr<Object> b)->SharedPtr<Object>
+      auto mul=[&](const Value& a, const Value& b)->Value
       {
-        if (a->type == Object::NumberType && a->type == b->type) {
-          auto na = a->castToNumber()->val;
-          auto nb = b->castToNumber()->val;
-          return this->createNumber(na * nb);
-        }
-
-        if ((a->type == Object::StringType && b->type == Object::NumberType) ||
-          (a->type == Object::NumberType && b->type == Object::StringType))
-        {
-          if (a->type == Object::NumberType)
-            std::swap(a, b);
-
-          auto as = a->castToString()->val;
-          int  n = b->castToNumber()->val;
-
-          std::ostringstream out;
-          for (int I = 0; I < n; I++)
-            out << as;
-          return this->createString(out.str());
-        }
-
-        raiseException("(pyMul) TypeError: ?");
-        return NoneObject;
+        int64_t ret;
+        if (a.isInt() && b.isInt() && mulInt(a.getInt(), b.getInt(), ret))
+          return this->createInt(ret);
+
+        if (a.isNumber() && b.isNumber())
+          return this->createNumber(a.getNumber() * b.getNumber());
+
+        auto fn = type_ops[a.type()].mul;
+        if (!fn)
+          raiseException("(pyMul) TypeError: ?");
+
+        return fn(this, a, b);
       };
 
       regs[A] = mul(regs[B], regs[C]);
-      continue;
+      DISPATCH();
     }
 
-    case OP_DIV: {
+    TARGET(OP_DIV) {
 
-      auto div=[&](SharedPtr<Object> a, SharedPtr<Object> b) {
-        return bitwise_builtin_op("bitwise_div", a, b, [](double a, double b) {return a / b; });
+      auto div=[&](const Value& a, const Value& b) {
+        return number_builtin_op("bitwise_div", a, b, [](double a, double b) {return a / b; });
       };
 
       regs[A] = div(regs[B], regs[C]);
-      continue;
+      DISPATCH();
     }
 
-    case OP_POW: {
+    TARGET(OP_POW) {
 
-      auto pow=[&](SharedPtr<Object> a, SharedPtr<Object> b) {
-        return bitwise_builtin_op("bitwise_pow", a, b, [](double a, double b) {return ::pow(a, b); });
+      auto pow=[&](const Value& a, const Value& b) {
+        return number_builtin_op("bitwise_pow", a, b, [](double a, double b) {return ::pow(a, b); });
       };
 
       regs[A] = pow(regs[B], regs[C]);
-      continue;
+      DISPATCH();
     }
 
-    case OP_BITAND: {
+    TARGET(OP_BITAND) {
 
-      auto bitwiseAnd=[&](SharedPtr<Object> a, SharedPtr<Object> b) {
-        return bitwise_builtin_op("bitwise_and", a, b, [](double a, double b) {return ((long)a) &  ((long)b); });
+      auto bitwiseAnd=[&](const Value& a, const Value& b) {
+        return bitwise_builtin_op("bitwise_and", a, b, [](int64_t a, int64_t b) {return a & b; });
       };
 
       regs[A] = bitwiseAnd(regs[B], regs[C]);
-      continue;
+      DISPATCH();
     }
 
-    case OP_BITOR: {
+    TARGET(OP_BITOR) {
 
-      auto bitwiseOr=[&](SharedPtr<Object> a, SharedPtr<Object> b) {
-        return bitwise_builtin_op("bitwise_or", a, b, [](double a, double b) {return ((long)a) | ((long)b); });
+      auto bitwiseOr=[&](const Value& a, const Value& b) {
+        return bitwise_builtin_op("bitwise_or", a, b, [](int64_t a, int64_t b) {return a | b; });
       };
 
       regs[A] = bitwiseOr(regs[B], regs[C]);
-      continue;
+      DISPATCH();
     }
 
-    case OP_BITXOR: {
+    TARGET(OP_BITXOR) {
 
-      auto bitwiseXor=[&](SharedPtr<Object> a, SharedPtr<Object> b) {
-        return bitwise_builtin_op("bitwise_xor", a, b, [](double a, double b) {return ((long)a) ^ ((long)b); });
+      auto bitwiseXor=[&](const Value& a, const Value& b) {
+        return bitwise_builtin_op("bitwise_xor", a, b, [](int64_t a, int64_t b) {return a ^ b; });
       };
 
       regs[A] = bitwiseXor(regs[B], regs[C]);
-      continue;
+      DISPATCH();
     }
 
-    case OP_MOD: {
+    TARGET(OP_MOD) {
+
+      auto mod=[&](const Value& a, const Value& b) 
+      {
+        if (a.isNumber() && b.isNumber() && b.getInt() == 0)
+          raiseException("(bitwise_mod) ZeroDivisionError: integer division or modulo by zero");
 
-      auto mod=[&](SharedPtr<Object> a, SharedPtr<Object> b) {
-        return bitwise_builtin_op("bitwise_mod", a, b, [](double a, double b) {return ((long)a) % ((long)b); });
+        return bitwise_builtin_op("bitwise_mod", a, b, [](int64_t a, int64_t b) {return modInt(a, b); });
       };
 
       regs[A] = mod(regs[B], regs[C]);
-      continue;
+      DISPATCH();
     }
 
-    case OP_LSH: {
+    TARGET(OP_LSH) {
 
-      auto lsh=[&](SharedPtr<Object> a, SharedPtr<Object> b) {
-        return bitwise_builtin_op("bitwise_lsh", a, b, [](double a, double b) {return ((long)a) << ((long)b); });
+      auto lsh=[&](const Value& a, const Value& b) {
+        return bitwise_builtin_op("bitwise_lsh", a, b, [](int64_t a, int64_t b) {return shiftInt(a, b, true); });
       };
 
       regs[A] = lsh(regs[B], regs[C]);
-      continue;
+      DISPATCH();
     }
 
-    case OP_RSH: {
+    TARGET(OP_RSH) {
 
-      auto rsh=[&](SharedPtr<Object> a, SharedPtr<Object> b) {
-        return bitwise_builtin_op("bitwise_rsh", a, b, [](double a, double b) {return ((long)a) >> ((long)b); });
+      auto rsh=[&](const Value& a, const Value& b) {
+        return bitwise_builtin_op("bitwise_rsh", a, b, [](int64_t a, int64_t b) {return shiftInt(a, b, false); });
       };
 
       regs[A] = rsh(regs[B], regs[C]);
-      continue;
+      DISPATCH();
     }
 
-    case OP_CMP:
-      regs[A] = this->createNumber(Object::compare(regs[B], regs[C])); 
-      continue;
+    TARGET(OP_CMP)
+      regs[A] = this->createInt(Object::compare(regs[B], regs[C])); 
+      DISPATCH();
 
-    case OP_NE:
-      regs[A] = this->createNumber(Object::compare(regs[B], regs[C]) != 0);
-      continue;
+    TARGET(OP_NE)
+      regs[A] = this->createBool(Object::compare(regs[B], regs[C]) != 0);
+      DISPATCH();
 
-    case OP_EQ:
-      regs[A] = this->createNumber(Object::compare(regs[B], regs[C]) == 0);
-      continue;
+    TARGET(OP_EQ)
+      regs[A] = this->createBool(Object::compare(regs[B], regs[C]) == 0);
+      DISPATCH();
 
-    case OP_LE:
-      regs[A] = this->createNumber(Object::compare(regs[B], regs[C]) <= 0);
-      continue;
+    TARGET(OP_LE)
+      regs[A] = this->createBool(Object::compare(regs[B], regs[C]) <= 0);
+      DISPATCH();
 
-    case OP_LT:
-      regs[A] = this->createNumber(Object::compare(regs[B], regs[C]) < 0);
-      continue;
+    TARGET(OP_LT)
+      regs[A] = this->createBool(Object::compare(regs[B], regs[C]) < 0);
+      DISPATCH();
 
-    case OP_BITNOT: {
+    TARGET(OP_BITNOT) {
 
-      auto bitwiseNot = [&](SharedPtr<Object> a)
+      auto bitwiseNot = [&](const Value& a)
       {
-        if (a->type != Object::NumberType)
+        if (!a.isNumber())
           raiseException("(py_bitwise_not) TypeError: unsupported operand type");
-        return this->createNumber(~(long)a->castToNumber()->val);
+        return this->createInt(~a.getInt());
       };
 
       regs[A] = bitwiseNot(regs[B]);
-      continue;
+      DISPATCH();
     }
 
-    case OP_NOT:
-      regs[A] = this->createNumber(regs[B]->toBool()?0:1);
-      continue;
+    TARGET(OP_NOT)
+      regs[A] = this->createBool(!regs[B].toBool());
+      DISPATCH();
 
-    case OP_PASS:
-      continue;
+    TARGET(OP_PASS)
+      DISPATCH();
 
-    case OP_IF: 
-      if (regs[A]->toBool())
-        frame->cursor += 4;
-      continue;
+    TARGET(OP_IF)
+      if (regs[A].toBool())
+        ip += 4;
+      DISPATCH();
 
-    case OP_IFN:
-      if (!regs[A]->toBool())
-        frame->cursor += 4;
-      continue;
+    TARGET(OP_IFN)
+      if (!regs[A].toBool())
+        ip += 4;
+      DISPATCH();
 
-    case OP_GET:
-      regs[A] = regs[B]->getAttr(regs[C]);
-      continue;
+    TARGET(OP_GET)
+      SAVE_CURSOR();
+      regs[A] = cachedGetAttr(frame, CURRENT_WORD(), regs[B], regs[C]);
+      LOAD_CURSOR();
+      DISPATCH();
 
-    case OP_ITER:
+    TARGET(OP_ITER)
     {
-      assert(regs[C]->type==Object::NumberType);
-      auto& index = regs[C]->castToNumber()->val;
+      assert(regs[C].isNumber());
+      auto index = regs[C].getInt();
 
-      if (index < regs[B]->len())
+      //lists hold their items inline, no key object and no virtual getAttr
+      if (auto list = regs[B].asList())
       {
-        //regs[A]=regs[B][regs[C]]
-        if (regs[B]->type == Object::ListType || regs[B]->type == Object::StringType)
+        if (index < list->size())
+        {
+          Value item = list->getAt((int)index);
+          regs[A] = std::move(item);
+          regs[C] = this->createInt(index + 1);
+          ip += 4;
+        }
+        DISPATCH();
+      }
+
+      //the counter of a dict is a cursor: entry position in the low 32 bits, 1+mutations at the first step in the high ones
+      if (auto dict = regs[B].asDict())
+      {
+        dict->ensureMap();
+
+        //built unsigned; a 30-bit stamp keeps the cursor a positive int64
+        uint64_t cursor = (uint64_t)index;
+        uint64_t stamp  = (dict->map.mutations() & 0x3fffffff) + 1;
+        if (!(cursor >> 32))
+          cursor = stamp << 32;
+        else if ((cursor >> 32) != stamp)
+          raiseException("(py_iter) RuntimeError: dictionary changed during iteration");
+
+        auto it = dict->map.seek((int)(cursor & 0xffffffff));
+        if (it != dict->map.end())
         {
-          regs[A] = regs[B]->getAttr(regs[C]);
+          regs[A] = it->first;
+          regs[C] = this->createInt((int64_t)((stamp << 32) | (uint64_t)(it.position() + 1)));
+          ip += 4;
         }
-        else  if (regs[B]->type == Object::DictType && regs[C]->type == Object::NumberType) 
+        DISPATCH();
+      }
+
+      //characters come from the preallocated table
+      if (auto str = regs[B].asString())
+      {
+        if (index < str->len())
         {
-          auto dictB = regs[B]->castToDict();
-          int  offset = (int)regs[C]->castToNumber()->val;
-          auto itB = dictB->begin();
-          std::advance(itB, offset);
-          regs[A] = itB->first;
+          regs[A] = this->createChar(str->data()[index]);
+          regs[C] = this->createInt(index + 1);
+          ip += 4;
         }
+        DISPATCH();
+      }
 
+      if (index < regs[B].len())
+      {
+        //regs[A]=regs[B][regs[C]]
+        if (regs[B].type() == Object::ListType || regs[B].type() == Object::StringType)
+        {
+          regs[A] = regs[B].getAttr(regs[C]);
+        }
         else
           raiseException("(py_iter) TypeError: iteration over non-sequence");
 
-        index += 1;
-        frame->cursor += 4;
+        regs[C] = this->createInt(index + 1);
+        ip += 4;
       }
-      continue;
+      DISPATCH();
     }
 
-    case OP_HAS:
-      regs[A] = this->createNumber(regs[B]->hasAttr(regs[C])?1:0);
-      continue;
+    TARGET(OP_HAS)
+      regs[A] = this->createBool(regs[B].hasAttr(regs[C]));
+      DISPATCH();
 
-    case OP_IGET: {
+    TARGET(OP_IGET) {
 
-      auto igetAttr=[&](SharedPtr<Object> obj, SharedPtr<Object> k)
+      auto igetAttr=[&](const Value& obj, const Value& k, Value& ret)
       {
-        if (obj->type == Object::DictType)
+        if (obj.type() == Object::DictType)
         {
-          auto dict = obj->castToDict();
-          auto it = dict->map.find(k);
-          if (it == dict->end())
-            return SharedPtr<Object>();
+          if (!obj.asDict()->hasAttr(k))
+            return false;
         }
 
-        if (obj->type == Object::ListType)
+        if (obj.type() == Object::ListType)
         {
-          auto list = obj->castToList();
+          auto list = obj.castToList();
           if (!list->size())
-            return SharedPtr<Object>();
+            return false;
         }
 
-        auto ret = obj->getAttr(k);
-        assert(ret);
-        return ret;
+        ret = obj.getAttr(k);
+        return true;
       };
 
-      if (auto found = igetAttr(regs[B], regs[C]))
+      Value found;
+      if (igetAttr(regs[B], regs[C], found))
         regs[A] = found;
-      continue;
     }
+    DISPATCH();
 
-    case OP_SET:
-      regs[A]->setAttr(regs[B], regs[C]);
-      continue;
+    TARGET(OP_SET)
+      SAVE_CURSOR();
+      cachedSetAttr(frame, CURRENT_WORD(), regs[A], regs[B], regs[C]);
+      LOAD_CURSOR();
+      DISPATCH();
 
-    case OP_DEL:
-      regs[A]->delAttr(regs[B]);
-      continue;
+    TARGET(OP_DEL)
+      regs[A].delAttr(regs[B]);
+      DISPATCH();
 
-    case OP_MOVE:
+    TARGET(OP_MOVE)
       regs[A] = regs[B]; 
-      continue;
+      DISPATCH();
 
-    case OP_NUMBER:
-      regs[A] = this->createNumber(*(double*)&frame->bytecode[frame->cursor]);
-      frame->cursor += sizeof(double);
-      continue;
+    TARGET(OP_NUMBER) {
+      regs[A] = decodeNumber(ip, Number);
+      ip += sizeof(double);
+      DISPATCH();
+    }
 
-    case OP_STRING:
-      regs[A] = this->createString(String((char*)&frame->bytecode[frame->cursor], Number));
-      frame->cursor += ((Number / 4)+1)*4;
-      continue;
+    TARGET(OP_CONSTANT) {
+      //Number is the index in the pool, the next word how many words to skip
+      uint32_t skip;
+      memcpy(&skip, ip, sizeof(skip));
+      regs[A] = constants[Number];
+      ip += skip * 4;
+      DISPATCH();
+    }
 
-    case OP_DICT:
+    TARGET(OP_STRING)
+      regs[A] = this->internString((const char*)ip, Number);
+      ip += ((Number / 4)+1)*4;
+      DISPATCH();
+
+    TARGET(OP_DICT)
       regs[A] = this->createDict();
       for (int i = 0; i < C; i+=2) 
-        regs[A]->setAttr(regs[B+i+0], regs[B+i+1]);
-      continue;
+        regs[A].setAttr(regs[B+i+0], regs[B+i+1]);
+      DISPATCH();
 
-    case OP_LIST: 
-    case OP_PARAMS: {
+    TARGET(OP_LIST)
+    TARGET(OP_PARAMS) {
       auto listA = this->createList();
       regs[A] = listA;
       for (int i = 0; i < C; i++)
         listA->pushBack(regs[B + i]);
-      continue;
     }
+    DISPATCH();
 
-    case OP_LEN: 
-      regs[A] = this->createNumber(regs[B]->len());
-      continue;
+    TARGET(OP_LEN)
+      regs[A] = this->createInt(regs[B].len());
+      DISPATCH();
 
-    case OP_JUMP: 
-      frame->cursor += (Number -1)*4;
-      continue;
+    TARGET(OP_JUMP)
+      ip += (Number -1)*4;
+      DISPATCH();
 
-    case OP_SETJMP: 
-      frame->jump_to = Number ? (frame->cursor + (Number -1)*4) : (-1);
-      continue;
+    TARGET(OP_SETJMP)
+      frame->jump_to = Number ? ((int)(ip - code) + (Number -1)*4) : (-1);
+      DISPATCH();
 
-    case OP_CALL:
-      regs[A] = regs[B]->call(regs[C]->castToList());
-      return 0;
+    TARGET(OP_CALL) {
+      SAVE_CURSOR();
+      auto fn = regs[B].asFunction();
+      if (fn && !fn->function)
+      {
+        //the frame pops its parameters, the caller's list must survive
+        pushCall(fn, this->createList(regs[C].castToList()->items), &regs[A]);
+      }
+      else
+      {
+        regs[A] = regs[B].call(regs[C].castToList());
+      }
+    }
+    LOAD_FRAME();
+    collectIfDue();
+    DISPATCH();
 
-    case OP_GGET: {
-      auto it=frame->globals->map.find(regs[B]);
-      regs[A] = (it != frame->globals->map.end())? (it->second) : (builtins->getAttr(regs[B]));
-      continue;
+    TARGET(OP_LOADMETHOD)
+    {
+      //regs[A] the function, regs[A+1] the receiver or None when regs[A] is called as it is
+      Value fn, receiver;
+      auto method = regs[C].type() == Object::StringType ? findMethod(regs[B].type(), regs[C]) : nullptr;
+      if (method) 
+      {
+        fn = SharedPtr<FunctionObject>(method);
+        receiver = regs[B];
+      }
+      else
+      {
+        SAVE_CURSOR();
+        fn = cachedGetAttr(frame, CURRENT_WORD(), regs[B], regs[C], &receiver);
+        LOAD_CURSOR();
+      }
+      regs[A] = std::move(fn);
+      regs[A + 1] = std::move(receiver);
     }
+    DISPATCH();
 
-    case OP_GSET:
-      frame->globals->setAttr(regs[A], regs[B]);
-      continue;
+    TARGET(OP_CALLMETHOD)
+    {
+      //regs[B] the function, regs[B+1] the receiver (see OP_LOADMETHOD), C arguments after them
+      SAVE_CURSOR();
+      if (regs[B + 1].isNone())
+      {
+        {
+          auto args = this->createList();
+          for (int I = 0; I < C; I++)
+            args->pushBack(regs[B + 2 + I]);
+
+          auto fn = regs[B].asFunction();
+          if (fn && !fn->function)
+            pushCall(fn, args, &regs[A]);
+          else
+            regs[A] = regs[B].call(args);
+        }
+        LOAD_FRAME();
+        collectIfDue();
+        DISPATCH();
+      }
 
-    case OP_DEF: {
-      auto bytecode = String(&frame->bytecode[frame->cursor], (Number - 1) * 4);
-      regs[A] = this->createFunction(nullptr, SharedPtr<Object>(), bytecode , frame->globals);
-      frame->cursor += (Number - 1) * 4;
-      continue;
+      //kept alive by regs[B] during the call
+      auto fn = regs[B].asFunction();
+      assert(fn);
+
+      //builtin methods read the arguments in place
+      const int MaxNativeArgs = 8;
+      if (fn->native && C < MaxNativeArgs)
+      {
+        {
+          Value argv[MaxNativeArgs];
+          for (int I = 0; I <= C; I++)
+            argv[I] = regs[B + 1 + I];
+          regs[A] = fn->native(this, argv, C + 1);
+        }
+        LOAD_CURSOR();
+        DISPATCH();
+      }
+
+      {
+        ListObject::Vector items;
+        items.reserve(C + 1);
+        for (int I = 0; I <= C; I++)
+          items.push_back(regs[B + 1 + I]);
+
+        if (!fn->function)
+          pushCall(fn, this->createList(std::move(items)), &regs[A]);
+        else
+          regs[A] = fn->invoke(this->createList(std::move(items)));
+      }
+      LOAD_FRAME();
+      collectIfDue();
+      DISPATCH();
     }
 
-    case OP_RETURN: 
-      frame->cursor -= 4;
-      popFrame(regs[A]); 
-      return 0;
+    TARGET(OP_GGET)
+      regs[A] = cachedGetGlobal(frame, CURRENT_WORD(), regs[B]);
+      DISPATCH();
+
+    TARGET(OP_GSET)
+      frame->globals->setAttr(regs[A], regs[B]);
+      DISPATCH();
+
+    TARGET(OP_DEF) {
+      //decodeCode replaced the first word of the body by the index of its code
+      uint32_t index;
+      memcpy(&index, ip, sizeof(index));
+      regs[A] = this->createFunction(nullptr, Value(), frame->code->functions[index], frame->globals);
+      ip += (Number - 1) * 4;
+    }
+    DISPATCH();
+
+    TARGET(OP_RETURN) {
+      bool bNative = frame->native_caller;
+      popFrame(regs[A]);
+      if (bNative)
+        return 0;
+    }
+    LOAD_FRAME();
+    collectIfDue();
+    DISPATCH();
 
-    case OP_RAISE: 
-      frame->cursor -= 4;
+    TARGET(OP_RAISE)
+      frame->cursor = (int)(ip - code) - 4;
       raiseException(regs[A]); 
       return 0;
 
-    case OP_DEBUG: 
-      std::cout << "DEBUG: " << A << " " << regs[A]->toString();
-      continue;
+    TARGET(OP_DEBUG)
+      std::cout << "DEBUG: " << A << " " << regs[A].toString();
+      DISPATCH();
 
-    case OP_NONE: 
-      regs[A] = NoneObject; 
-      continue;
+    TARGET(OP_NONE)
+      regs[A] = Value(); 
+      DISPATCH();
 
-    case OP_LINE:
-      frame->line = String((char*)&frame->bytecode[frame->cursor], A * 4 - 1);;
-      frame->lineno = Number;
-      frame->cursor += A*4;
-      continue;
+    TARGET(OP_LINE)
+      //Number is the index in the line table
+      frame->line = (unsigned short)Number;
+      ip += A*4;
+      DISPATCH();
 
-    case OP_FILE: 
-      frame->filename = regs[A]->toString();
-      continue;
+    TARGET(OP_FILE)
+      //already in the code object
+      DISPATCH();
 
-    case OP_NAME: 
-      frame->name = regs[A]->toString();
-      continue;
+    TARGET(OP_NAME)
+      //already in the code object
+      DISPATCH();
 
-    case OP_REGS:  
-      //don't care
-      continue;
+    TARGET(OP_REGS)
+      //already used by decodeCode to size the register window
+      DISPATCH();
 
-    default:
+    TARGET_DEFAULT
       raiseException("(py_step) RuntimeError: invalid instruction");
       return 0;
-      continue;
     }
   }
+
+#undef SAVE_CURSOR
+#undef LOAD_CURSOR
+#undef CURRENT_WORD
+#undef LOAD_FRAME
+#undef FETCH
+#undef TARGET
+#undef TARGET_DEFAULT
+#undef DISPATCH
+
   return 0;
 }
 
@@ -999,64 +1838,206 @@ void PyEngine::run()
 {
   this->is_running++;
 
-  bool bCatched = false;
-  SharedPtr<Object> ex;
-  try
+  //runs until the frame pushed by the caller pops, bytecode calls stay in runStep
+  int upto = this->frames.size();
+  while (frames.size() >= upto)
   {
-    int upto = this->frames.size();
-    while (frames.size() >= upto)
+    Value ex;
+    try
     {
-      //error happened?
-      if (this->runStep() == -1)
-        break;
+      while (frames.size() >= upto)
+      {
+        this->runStep();
+        collectIfDue();
+      }
+      break;
+    }
+    catch (String s) {
+      ex = this->createString(s);
+    }
+    catch (Value ex_) {
+      ex = ex_;
     }
-  }
-  catch (String s) {
-    ex = this->createString(s);
-    bCatched = true;
-  }
-  catch (SharedPtr<Object> ex_) {
-    ex = ex_;
-    bCatched = true;
-  }
 
-  this->is_running--;
+    if (unwindFrames(upto))
+      continue;
+
+    this->is_running--;
 
-  if (!bCatched)
-    return;
+    //to the native caller, the run() below it goes on unwinding its own frames
+    if (!frames.empty())
+      throw ex;
 
+    std::cout << std::endl << "Exception:" << std::endl << traceback << ex.toString()<<std::endl;;
+    assert(false);
+    exit(-1);
+  }
+
+  this->is_running--;
+}
 
+//////////////////////////////////////////////////////////
+bool PyEngine::unwindFrames(int upto)
+{
   std::ostringstream out;
-  while (!frames.empty())
+  while (frames.size() >= upto)
   {
-    auto frame = frames.top();
+    auto frame = frames.current();
     if (frame->jump_to >= 0)
     {
       frame->cursor = frame->jump_to;
       frame->jump_to = -1;
-      return;
+      traceback.clear();
+      return true;
     }
 
-    out<< "filename(" << frame->filename << ") line(" << frame->lineno << ") name(" << frame->name << ") "<<std::endl<< frame->line << std::endl;
+    auto code     = frame->code.get();
+    auto filename = code->filename.isNone() ? String("?") : code->filename.toString();
+    auto name     = code->name.isNone()     ? String("?") : code->name.toString();
+    auto lineno   = frame->line >= 0 ? code->lines[frame->line].lineno : 0;
+    out<< "filename(" << filename << ") line(" << lineno << ") name(" << name << ") "<<std::endl<< code->getLine(frame->line) << std::endl;
     frames.pop();
   }
 
-  std::cout << std::endl << "Exception:" << std::endl << out.str() << ex->toString()<<std::endl;;
-  assert(false);
-  exit(-1);
+  traceback += out.str();
+  return false;
 }
 
-////////////////////////////////////////////////////////////////////////////////
+//////////////argument helpers of the native methods, same errors as ListObject::get*At
+static const Value& nativeArg(const Value* argv, int argc, int index) {
+  if (index >= argc)
+    raiseException("out of index");
+  return argv[index];
+}
+
+static String nativeStringArg(const Value* argv, int argc, int index) {
+  auto ret = nativeArg(argv, argc, index).asString();
+  if (!ret)
+    raiseException("(popWithType) TypeError: unexpected type");
+  return ret->str();
+}
+
+static ListObject* nativeListArg(const Value* argv, int argc, int index) {
+  auto ret = nativeArg(argv, argc, index).asList();
+  if (!ret)
+    raiseException("(popWithType) TypeError: unexpected type");
+  return ret;
+}
+
+////////////////////////////////////////////////////////////////////
+void PyEngine::addMethods()
+{
+  //addMethod
+  auto addMethod = [&](int type, String name, NativeMethod native) 
+  {
+    auto fn = this->createFunction([native](PyEngine* py, SharedPtr<ListObject> args) {
+      return native(py, args->items.data(), args->size());
+    });
+    fn->native = native;
+    methods[type].push_back(std::make_pair(this->internString(name), fn));
+  };
+
+  //string
+  addMethod(Object::StringType, "join", [](PyEngine* py, const Value* argv, int argc)
+  {
+    auto delim = nativeStringArg(argv, argc, 0);
+    auto list  = nativeListArg  (argv, argc, 1);
+
+    std::ostringstream out;
+    for (int i = 0; i < list->size(); i++)
+    {
+      if (i) out << delim;
+      out << list->getAt(i).toString();
+    }
+
+    return Value(py->createString(out.str()));
+  });
+
+  addMethod(Object::StringType, "split", [](PyEngine* py, const Value* argv, int argc)
+  {
+    String v = nativeStringArg(argv, argc, 0);
+    String d = nativeStringArg(argv, argc, 1);
+    auto ret = py->createList();
+    for (auto it : StringUtils::split(v, d))
+      ret->pushBack(py->createString(it.c_str()));
+    return Value(ret);
+  });
+
+  addMethod(Object::StringType, "index", [](PyEngine* py, const Value* argv, int argc)
+  {
+    auto s = nativeStringArg(argv, argc, 0);
+    auto v = nativeStringArg(argv, argc, 1);
+    int n = (int)s.find(v);
+    if (n<0)
+      raiseException("(index) ValueError: substring not found");
+    return py->createNumber(n);
+  });
+
+  addMethod(Object::StringType, "strip", [](PyEngine* py, const Value* argv, int argc)
+  {
+    auto s = nativeStringArg(argv, argc, 0);
+    s = StringUtils::trim(s);
+    return Value(py->createString(s));
+  });
+
+  addMethod(Object::StringType, "replace", [](PyEngine* py, const Value* argv, int argc)
+  {
+    auto s = nativeStringArg(argv, argc, 0);
+    auto k = nativeStringArg(argv, argc, 1);
+    auto v = nativeStringArg(argv, argc, 2);
+    return Value(py->createString(StringUtils::replaceAll(s, k, v)));
+  });
+
+  //list
+  addMethod(Object::ListType, "append", [](PyEngine* py, const Value* argv, int argc) {
+    auto list = nativeListArg(argv, argc, 0);
+    list->pushBack(nativeArg(argv, argc, 1));
+    return Value();
+  });
+
+  addMethod(Object::ListType, "pop", [](PyEngine* py, const Value* argv, int argc) {
+    return nativeListArg(argv, argc, 0)->popBack();
+  });
+
+  addMethod(Object::ListType, "index", [](PyEngine* py, const Value* argv, int argc)
+  {
+    auto list = nativeListArg(argv, argc, 0);
+    const auto& what = nativeArg(argv, argc, 1);
+
+    int i = list->find(what);
+    if (i < 0) {
+      raiseException(StringUtils::format() 
+        << "List " << list->toString() << " does not contain index " << what.toString());
+    }
+
+    return py->createNumber(i);
+  });
+
+  addMethod(Object::ListType, "sort", [](PyEngine* py, const Value* argv, int argc) {
+    nativeListArg(argv, argc, 0)->sort();
+    return Value();
+  });
+
+  addMethod(Object::ListType, "extend", [](PyEngine* py, const Value* argv, int argc)
+  {
+    auto l1 = nativeListArg(argv, argc, 0);
+    auto l2 = nativeListArg(argv, argc, 1);
+    l1->append(*l2);
+    return Value();
+  });
+}
+
+////////////////////////////////////////////////////////////////////
 void PyEngine::addBuiltIns()
 {
   //addBuiltIn
   auto addBuiltIn = [&](String name, Function fn) {
-    builtins->setAttr(this->createString(name), this->createFunction(fn));
+    builtins.setAttr(this->internString(name), this->createFunction(fn));
   };
 
   addBuiltIn("print", [](PyEngine* py,SharedPtr<ListObject> args) {
     args->print();
-    return NoneObject;
+    return Value();
   });
 
   addBuiltIn("range", [](PyEngine* py, SharedPtr<ListObject> args)
@@ -1083,16 +2064,20 @@ void PyEngine::addBuiltIns()
       raiseException("wrong arguments for range");
     }
 
+    if (!c)
+      raiseException("(range) ValueError: step must not be zero");
+
     auto ret = py->createList();
+    ret->items.reserve(std::max(0, (b - a + c + (c > 0 ? -1 : 1)) / c));
     for (int I = a; (c > 0) ? I<b : I>b; I += c)
-      ret->pushBack(py->createNumber(I));
-    return ret;
+      ret->pushBack(py->createInt(I));
+    return Value(ret);
   });
 
   addBuiltIn("min",[](PyEngine *py, SharedPtr<ListObject> args)
   {
     auto ret = args->getAt(0);
-    for (auto arg : *args) {
+    for (const auto& arg : *args) {
       if (Object::compare(ret, arg) > 0)
         ret = arg;
     }
@@ -1102,7 +2087,7 @@ void PyEngine::addBuiltIns()
   addBuiltIn("max",[](PyEngine *py, SharedPtr<ListObject> args)
   {
     auto ret = args->getAt(0);
-    for (auto arg : *args) {
+    for (const auto& arg : *args) {
       if (Object::compare(ret, arg) < 0)
         ret = arg;
     }
@@ -1112,52 +2097,52 @@ void PyEngine::addBuiltIns()
   addBuiltIn("bind",[](PyEngine *py, SharedPtr<ListObject> args) {
     auto ret  = args->getFunctionAt(0);
     auto obj  = args->getAt(1);
-    return py->createFunction(ret->function, obj, ret->bytecode,ret->globals);
+    return Value(py->bindFunction(ret.get(), obj));
   });
   
   addBuiltIn("copy", [](PyEngine* py, SharedPtr<ListObject> args) {
     auto obj = args->getAt(0);
-    return obj->clone();
+    return obj.clone();
   });
 
   addBuiltIn("import",[](PyEngine *py, SharedPtr<ListObject> args) {
     String modulename = args->getStringAt(0);
 
-    if (py->modules->hasAttr(py->createString(modulename)))
-      return py->modules->getAttr(py->createString(modulename));
+    if (py->modules.hasAttr(py->internString(modulename)))
+      return py->modules.getAttr(py->internString(modulename));
 
     return py->callFunctionInModule("tinypy", "importModule", py->createList({py->createString(modulename) }));
   });
 
   addBuiltIn("len",[](PyEngine *py, SharedPtr<ListObject> args) {
     auto obj = args->getAt(0);
-    return py->createNumber(obj->len());
+    return py->createInt(obj.len());
   });
 
   addBuiltIn("assert",[](PyEngine *py, SharedPtr<ListObject> args) {
     int a = args->getNumberAt(0);
-    if (a) { return NoneObject; }
+    if (a) { return Value(); }
     raiseException("(py_assert) AssertionError");
-    return NoneObject;
+    return Value();
   });
 
   addBuiltIn("str",[](PyEngine *py, SharedPtr<ListObject> args) {
     auto obj = args->getAt(0);
-    return py->createString(obj->toString());
+    return Value(py->createString(obj.toString()));
   });
 
   auto pyCreateFloat= [](PyEngine* py, SharedPtr<ListObject> args) {
 
     auto obj = args->getAt(0);
 
-    if (obj->type == Object::NumberType)
-      return obj->castToNumber();
+    if (obj.isNumber())
+      return py->createNumber(obj.getNumber());
 
-    if (obj->type == Object::StringType)
-      return py->createNumber(std::stod(obj->castToString()->val));
+    if (obj.type() == Object::StringType)
+      return py->createNumber(std::stod(obj.castToString()->str()));
 
     raiseException("(pyCreateFloat) TypeError: ?");
-    return SharedPtr<NumberObject>();
+    return Value();
   };
 
   addBuiltIn("float", pyCreateFloat);
@@ -1168,7 +2153,7 @@ void PyEngine::addBuiltIns()
   {
     auto s = args->getStringAt(0);
     int ret = system(s.c_str());
-    return NumberObject::New(ret);
+    return py->createNumber(ret);
   });
 #endif
 
@@ -1176,20 +2161,20 @@ void PyEngine::addBuiltIns()
     auto v = args->getAt(0);
     auto t = args->getStringAt(1);
 
-    if (t == "string") return py->createNumber(v->type == Object::StringType);
-    if (t == "list"  ) return py->createNumber(v->type == Object::ListType);
-    if (t == "dict"  ) return py->createNumber(v->type == Object::DictType);
-    if (t == "number") return py->createNumber(v->type == Object::NumberType);
-    if (t == "fnc"   ) return py->createNumber(v->type == Object::FunctionType && !v->castToFunction()->instance);
-    if (t == "method") return py->createNumber(v->type == Object::FunctionType &&  v->castToFunction()->instance);
+    if (t == "string") return py->createBool(v.type() == Object::StringType);
+    if (t == "list"  ) return py->createBool(v.type() == Object::ListType);
+    if (t == "dict"  ) return py->createBool(v.type() == Object::DictType);
+    if (t == "number") return py->createBool(v.type() == Object::NumberType);
+    if (t == "fnc"   ) return py->createBool(v.type() == Object::FunctionType && !v.castToFunction()->isMethod());
+    if (t == "method") return py->createBool(v.type() == Object::FunctionType &&  v.castToFunction()->isMethod());
 
     raiseException("(is_type) TypeError: ?");
-    return SharedPtr<NumberObject>();
+    return Value();
   });
 
   addBuiltIn("chr",[](PyEngine *py, SharedPtr<ListObject> args) {
     auto v = (unsigned char)args->getNumberAt(0);
-    return py->createString(String((const char*)&v, 1));
+    return Value(py->createChar(v));
   });
 
   addBuiltIn("saveFile",[](PyEngine *py, SharedPtr<ListObject> args)
@@ -1201,44 +2186,56 @@ void PyEngine::addBuiltIns()
     if (!file) raiseException("(py_save) IOError: ?");
     fwrite(content.c_str(), content.length(), 1, file);
     fclose(file);
-    return NoneObject;
+    return Value();
   });
 
   addBuiltIn("loadFile", [](PyEngine* py, SharedPtr<ListObject> args) {
     auto filename = args->getStringAt(0);
     auto content = py->loadFile(filename);
-    return py->createString(content);
+    return Value(py->createString(content));
   });
 
   addBuiltIn("fpack",[](PyEngine *py, SharedPtr<ListObject> args)
   {
     double v = args->getNumberAt(0);
-    auto ret = py->createString(String(sizeof(double), 0));
-    *((double*)ret->val.c_str()) = v;
-    return ret;
+    String packed(sizeof(double), 0);
+    memcpy(&packed[0], &v, sizeof(double));
+    return Value(py->createString(packed));
+  });
+
+  //ipack (integer literal of the compiler, already checked to fit by isint64)
+  addBuiltIn("ipack",[](PyEngine *py, SharedPtr<ListObject> args)
+  {
+    auto s = args->getStringAt(0);
+    int64_t v = s.substr(0, 2) == "0x" ? (int64_t)strtoull(s.c_str() + 2, nullptr, 16) : strtoll(s.c_str(), nullptr, 10);
+    String packed(sizeof(int64_t), 0);
+    memcpy(&packed[0], &v, sizeof(int64_t));
+    return Value(py->createString(packed));
   });
 
   addBuiltIn("abs",[pyCreateFloat](PyEngine *py, SharedPtr<ListObject> args) {
-    auto value = fabs(pyCreateFloat(py, args)->castToNumber()->val);
+    auto value = fabs(pyCreateFloat(py, args).getNumber());
     return py->createNumber(value);
   });
   
   addBuiltIn("int", [pyCreateFloat](PyEngine *py, SharedPtr<ListObject> args) {
-    auto value = (long)pyCreateFloat(py, args)->castToNumber()->val;
-    return py->createNumber(value);
+    auto obj = args->getAt(0);
+    if (obj.isInt())
+      return obj;
+    return py->createInt(pyCreateFloat(py, args).getInt());
   });
 
   addBuiltIn("exec",[](PyEngine *py, SharedPtr<ListObject> args) {
     auto bytecode = args->getStringAt(0);
     auto globals  = args->getDictAt(1);
-    return py->runFrame(bytecode, {}, globals);
+    return py->runFrame(py->decodeCode(bytecode), {}, globals);
   });
 
   addBuiltIn("exists",[](PyEngine *py, SharedPtr<ListObject> args) {
     auto filename = args->getStringAt(0);
     struct stat stbuf;
     auto ret = !stat(filename.c_str(), &stbuf);
-    return py->createNumber(ret);
+    return py->createBool(ret);
   });
   
   addBuiltIn("mtime",[](PyEngine *py, SharedPtr<ListObject> args) {
@@ -1254,7 +2251,7 @@ void PyEngine::addBuiltIns()
 
   addBuiltIn("round",[pyCreateFloat](PyEngine *py, SharedPtr<ListObject> args)
   {
-    auto num = pyCreateFloat(py,args)->castToNumber()->val;
+    auto num = pyCreateFloat(py,args).getNumber();
     double av = fabs(num);
     double iv = (long)av;
     av = (av - iv < 0.5 ? iv : iv + 1);
@@ -1266,7 +2263,7 @@ void PyEngine::addBuiltIns()
     if (s.length() != 1) 
       raiseException("(py_ord) TypeError: ord() expected a character");
 
-    return py->createNumber((unsigned char)s.c_str()[0]);
+    return py->createInt((unsigned char)s.c_str()[0]);
   });
 
   addBuiltIn("merge",[](PyEngine *py, SharedPtr<ListObject> args)
@@ -1274,9 +2271,9 @@ void PyEngine::addBuiltIns()
     auto d1 = args->getDictAt(0);
     auto d2 = args->getDictAt(1);
     for (auto it2 : *d2)
-      d1->map[it2.first]=it2.second;
+      d1->setItem(it2.first, it2.second);
 
-    return NoneObject;
+    return Value();
   });
 
 
@@ -1285,22 +2282,22 @@ void PyEngine::addBuiltIns()
     auto dict = args->getDictAt(0);
     auto meta = args->getDictAt(1);
     dict->meta = meta;
-    return NoneObject;
+    return Value();
   });
 
   addBuiltIn("getmeta",[](PyEngine *py, SharedPtr<ListObject> args) {
     auto dict = args->getDictAt(0);
-    return dict->meta;
+    return Value(dict->meta);
   });
 
   addBuiltIn("bool", [](PyEngine *py, SharedPtr<ListObject> args) {
     auto obj = args->getAt(0);
-    return py->createNumber(obj->toBool());
+    return py->createBool(obj.toBool());
   });
 
   auto o = this->createDict( true);
 
-  o->setAttr(this->createString("__call__"), this->createFunction([](PyEngine *py, SharedPtr<ListObject> args)
+  o->setAttr(this->keyCall, this->createFunction([](PyEngine *py, SharedPtr<ListObject> args)
   {
     auto ret = py->createDict(true);
 
@@ -1310,28 +2307,84 @@ void PyEngine::addBuiltIns()
         ret->setAttr(it.first, it.second);
     }
 
-    return ret;
+    return Value(ret);
   }));
 
-  o->setAttr(this->createString("__new__" ), this->createFunction([](PyEngine *py, SharedPtr<ListObject> args)
+  o->setAttr(this->keyNew, this->createFunction([](PyEngine *py, SharedPtr<ListObject> args)
   {
     auto klass = args->getDictAt(0); args->popFront();
     auto obj   = py->createDict(true);
     obj->meta = klass;
 
-    if (auto init_function = obj->lookup(py->createString("__init__")))
-      init_function->call(args);
+    Value init_function;
+    if (obj->lookup(py->keyInit, init_function))
+      init_function.call(args);
 
-    return obj;
+    return Value(obj);
   }));
 
-  builtins->setAttr(createString("object"), o);
+  builtins.setAttr(internString("object"), o);
+}
+
+/////////////////////////////////////////////////////////////////
+StringObject* PyEngine::findInterned(const char* s, int len, int hash)
+{
+  if (interned.empty())
+    return nullptr;
+
+  int mask = (int)interned.size() - 1;
+  for (int slot = hash & mask; interned[slot]; slot = (slot + 1) & mask)
+  {
+    auto it = interned[slot].get();
+    if (it->hash == hash && it->len() == len && !memcmp(it->data(), s, len))
+      return it;
+  }
+  return nullptr;
+}
+
+/////////////////////////////////////////////////////////////////
+SharedPtr<StringObject> PyEngine::internString(const char* s, int len)
+{
+  int hash = Object::computeHash(s, len);
+
+  //keep the table at most half full
+  if ((num_interned + 1) * 2 > (int)interned.size())
+  {
+    std::vector< SharedPtr<StringObject> > old;
+    old.swap(interned);
+    interned.resize(std::max(256, (int)old.size() * 2));
+    num_interned = 0;
+    for (auto& it : old)
+    {
+      if (!it) continue;
+      int mask = (int)interned.size() - 1;
+      int slot = it->hash & mask;
+      while (interned[slot]) slot = (slot + 1) & mask;
+      interned[slot] = it;
+      num_interned++;
+    }
+  }
+
+  int mask = (int)interned.size() - 1;
+  int slot = hash & mask;
+  for (; interned[slot]; slot = (slot + 1) & mask)
+  {
+    auto& it = interned[slot];
+    if (it->hash == hash && it->len() == len && !memcmp(it->str().c_str(), s, len))
+      return it;
+  }
+
+  auto ret = this->createString(String(s, len));
+  ret->interned = true;
+  interned[slot] = ret;
+  num_interned++;
+  return ret;
 }
 
 /////////////////////////////////////////////////////////////////
 String PyEngine::compileFile(String sourcecode, String filename)
 {
-  return callFunctionInModule("tinypy", "compileFile", this->createList( { this->createString(sourcecode), this->createString(filename) }))->toString();
+  return callFunctionInModule("tinypy", "compileFile", this->createList( { this->createString(sourcecode), this->createString(filename) })).toString();
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -1350,32 +2403,180 @@ String PyEngine::loadFile(String filename) {
 
 
 ////////////////////////////////////////////////////////
-SharedPtr<Object> PyEngine::runCode(String sourcecode, SharedPtr<DictObject> globals, String filename) 
+Value PyEngine::runCode(String sourcecode, SharedPtr<DictObject> globals, String filename) 
 {
   auto bytecode = compileFile(sourcecode, filename);
-  return runFrame(bytecode, {}, globals);
+  return runFrame(decodeCode(bytecode), {}, globals);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+Value PyEngine::decodeNumber(const unsigned char* data, int flags)
+{
+  //integer literals are stored as int64 (flags 1)
+  if (flags == 1)
+  {
+    int64_t value;
+    memcpy(&value, data, sizeof(int64_t));
+    return this->createInt(value);
+  }
+
+  //the others as doubles, integral ones become exact ints
+  double value;
+  memcpy(&value, data, sizeof(double));
+  if (value == floor(value) && fabs(value) < 9.2e18)
+    return this->createInt((int64_t)value);
+  return this->createNumber(value);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+SharedPtr<CodeObject> PyEngine::decodeCode(const String& bytecode)
+{
+  auto ret = makeShared<CodeObject>();
+  ret->bytecode = bytecode;
+
+  //walk the instructions as runStep does, skipping their inline data
+  auto words = (unsigned char*)&ret->bytecode[0];
+  int num_words = (int)bytecode.size() / 4;
+
+  //register and constant of the previous instruction, OP_FILE and OP_NAME come right after the load of their string
+  int prev_reg = -1, prev_constant = -1;
+
+  for (int W = 0; W < num_words; )
+  {
+    auto ptr = words + W * 4;
+    int op = ptr[0];
+    int A  = ptr[1];
+    auto Number = short((ptr[2] << 8) + ptr[3]);
+
+    int size = 1;
+    Value constant;
+    bool bConstant = false;
+
+    switch (op)
+    {
+    case OP_NUMBER: {
+      constant  = decodeNumber(ptr + 4, Number);
+      bConstant = true;
+      size = 1 + (int)sizeof(double) / 4;
+      break;
+    }
+
+    case OP_STRING:
+      constant  = this->internString((const char*)ptr + 4, Number);
+      bConstant = true;
+      size = 1 + (Number / 4) + 1;
+      break;
+
+    case OP_DEF: {
+      //decoded once with the enclosing code, the body copy is left unused
+      auto index = (uint32_t)ret->functions.size();
+      ret->functions.push_back(decodeCode(bytecode.substr((W + 1) * 4, (Number - 1) * 4)));
+      memcpy(ptr + 4, &index, sizeof(index));
+      size = Number;
+      break;
+    }
+
+    case OP_LINE: {
+      CodeObject::Line line;
+      line.lineno = Number;
+      line.cursor = (W + 1) * 4;
+      line.size   = A * 4 - 1;
+
+      //Number holds up to 64K lines, the last one stands for the rest
+      if (ret->lines.size() < 0x10000)
+        ret->lines.push_back(line);
+      auto index = (int)ret->lines.size() - 1;
+      ptr[2] = (unsigned char)(index >> 8);
+      ptr[3] = (unsigned char)(index & 0xff);
+      size = 1 + A;
+      break;
+    }
+
+    case OP_FILE:
+    case OP_NAME:
+      if (A == prev_reg && prev_constant >= 0)
+        (op == OP_FILE ? ret->filename : ret->name) = ret->constants[prev_constant];
+      break;
+
+    case OP_REGS:
+      //the compiler starts every code block with it, 256 registers wrap to 0
+      if (W == 0 && A > 0)
+        ret->num_regs = A;
+      break;
+    }
+
+    prev_reg = A;
+    prev_constant = -1;
+
+    //the index must fit in Number, the first data word keeps how many words to skip
+    if (bConstant && ret->constants.size() < 0x8000)
+    {
+      int index = (int)ret->constants.size();
+      ret->constants.push_back(constant);
+      prev_constant = index;
+
+      uint32_t skip = size - 1;
+      ptr[0] = OP_CONSTANT;
+      ptr[2] = (unsigned char)(index >> 8);
+      ptr[3] = (unsigned char)(index & 0xff);
+      memcpy(ptr + 4, &skip, sizeof(skip));
+    }
+
+    W += size;
+  }
+
+  return ret;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////
-SharedPtr<Object> PyEngine::runFrame(String bytecode, std::vector< SharedPtr<Object> > regs, SharedPtr<DictObject> globals)
+PyEngine::Frame* PyEngine::pushFrame(SharedPtr<CodeObject> code, SharedPtr<DictObject> globals, int num_regs, Value* ret)
 {
-  auto ret = NoneObject;
+  if (frames.size() >= FrameStack::MaxFrames)
+    raiseException("(py_call) RuntimeError: maximum recursion depth exceeded");
+
+  //OP_GGET reads the map, an instance used as globals (e.g. by exec) leaves its shape
+  globals->ensureMap();
 
-  auto frame=std::make_shared<Frame>();
-  frame->globals = globals;
-  frame->bytecode = bytecode;
+  auto frame = this->frames.push(std::max(code->num_regs, num_regs));
+  frame->globals = std::move(globals);
+  frame->code = std::move(code);
   frame->cursor = 0;
   frame->jump_to = -1;
-  frame->lineno = 0;
-  frame->line = "";
-  frame->name = "?";
-  frame->filename = "?";
-  frame->on_pop = [&](SharedPtr<Object> obj) {ret = obj; };
+  frame->line = -1;
+  frame->ret = ret;
+  frame->native_caller = false;
+  return frame;
+}
 
-  int R = 0; for (auto it : regs)
-    frame->regs[R++] = it;
+///////////////////////////////////////////////////////////////////////////////////////////
+void PyEngine::pushCall(FunctionObject* fn, SharedPtr<ListObject> args, Value* ret)
+{
+  //same arguments as FunctionObject::call
+  if (fn->isMethod())
+    args->pushFront(fn->instance);
 
-  this->frames.push(frame);
+  auto frame = pushFrame(fn->code, fn->globals, 1, ret);
+  frame->regs[0] = std::move(args);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+Value PyEngine::runFrame(SharedPtr<CodeObject> code, std::vector<Value> regs, SharedPtr<DictObject> globals)
+{
+  //native callers (constructors, __call__, __get__...) nest run() on the C++ stack, bounded by what it has used so far
+  char here;
+  auto address = (uintptr_t)&here;
+  if (!is_running)
+    stack_base = address;
+  else if (stack_base > address && stack_base - address > stack_budget)
+    raiseException("(py_call) RuntimeError: maximum recursion depth exceeded");
+
+  Value ret;
+
+  auto frame = pushFrame(code, globals, (int)regs.size(), &ret);
+  frame->native_caller = true;
+
+  int R = 0; for (auto& it : regs)
+    frame->regs[R++] = it;
 
   this->run();
 
@@ -1383,14 +2584,14 @@ SharedPtr<Object> PyEngine::runFrame(String bytecode, std::vector< SharedPtr<Obj
 }
 
 /////////////////////////////////////////////////////////////////
-void PyEngine::popFrame(SharedPtr<Object> return_value)
+void PyEngine::popFrame(Value return_value)
 {
-  auto frame = frames.top();
+  auto ret = frames.current()->ret;
 
   frames.pop();
 
-  if (auto fn = frame->on_pop)
-    fn(return_value);
+  if (ret)
+    *ret = return_value;
 }
 
 #include "math_module.h"
@@ -1408,11 +2609,13 @@ int main(int argc, char *argv[])
   auto filename = argv[1];
 
   auto globals = py->createDict();
-  globals->setAttr(py->createString("__name__"), py->createString("__main__"));
+  globals->setAttr(py->internString("__name__"), py->createString("__main__"));
 
   auto sourcecode = py->loadFile(filename);
   py->runCode(sourcecode,globals,filename);
 
+  //release it before the engine, so that its cycles are collected too
+  globals.reset();
   delete py;
 
 #ifdef  _DEBUG
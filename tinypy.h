@@ -10,22 +10,320 @@
 #include <assert.h>
 #include <iostream>
 #include <sstream>
-#include <memory>
 #include <stack>
+#include <deque>
+#include <stdint.h>
+#include <stdlib.h>
+#include <new>
 
-typedef std::string String;
+#if TINYPY_ATOMIC_REFCOUNT
+#include <atomic>
+#include <mutex>
+#endif
 
-template <typename T> using SharedPtr= std::shared_ptr<T>;
+typedef std::string String;
 
 class Object;
-class NumberObject;
 class StringObject;
 class ListObject;
 class DictObject;
 class FunctionObject;
 class PyEngine;
 
-extern SharedPtr<Object> NoneObject;
+class Value;
+
+//////////////////////////////////////////////////////////////////
+//intrusive reference count, non-atomic unless TINYPY_ATOMIC_REFCOUNT is defined
+class RefCounted
+{
+public:
+
+  //constructor
+  RefCounted() {
+  }
+
+  //destructor
+  virtual ~RefCounted() {
+  }
+
+  //incRef
+  void incRef() const {
+    ++refcount;
+  }
+
+  //decRef
+  void decRef() const {
+    if (--refcount == 0)
+      delete this;
+  }
+
+  //useCount
+  int useCount() const {
+    return refcount;
+  }
+
+private:
+
+#if TINYPY_ATOMIC_REFCOUNT
+  mutable std::atomic<int> refcount{ 0 };
+#else
+  mutable int refcount = 0;
+#endif
+
+  //non copyable
+  RefCounted(const RefCounted&) = delete;
+  const RefCounted& operator=(const RefCounted&) = delete;
+
+};
+
+//////////////////////////////////////////////////////////////////
+template <typename T>
+class SharedPtr
+{
+public:
+
+  //constructor
+  SharedPtr() {
+  }
+
+  //constructor
+  explicit SharedPtr(T* ptr_) : ptr(ptr_) {
+    if (ptr) ptr->incRef();
+  }
+
+  //constructor
+  SharedPtr(const SharedPtr& other) : ptr(other.ptr) {
+    if (ptr) ptr->incRef();
+  }
+
+  //constructor
+  SharedPtr(SharedPtr&& other) : ptr(other.ptr) {
+    other.ptr = nullptr;
+  }
+
+  //constructor
+  template <typename U>
+  SharedPtr(const SharedPtr<U>& other) : ptr(other.get()) {
+    if (ptr) ptr->incRef();
+  }
+
+  //destructor
+  ~SharedPtr() {
+    if (ptr) ptr->decRef();
+  }
+
+  //operator=
+  SharedPtr& operator=(SharedPtr other) {
+    std::swap(ptr, other.ptr);
+    return *this;
+  }
+
+  //get
+  T* get() const {
+    return ptr;
+  }
+
+  //operator->
+  T* operator->() const {
+    return ptr;
+  }
+
+  //operator*
+  T& operator*() const {
+    return *ptr;
+  }
+
+  //operator bool
+  explicit operator bool() const {
+    return ptr != nullptr;
+  }
+
+  //reset
+  void reset() {
+    SharedPtr().swap(*this);
+  }
+
+  //swap
+  void swap(SharedPtr& other) {
+    std::swap(ptr, other.ptr);
+  }
+
+private:
+
+  T* ptr = nullptr;
+
+};
+
+//makeShared
+template <typename T, typename... Args>
+inline SharedPtr<T> makeShared(Args&&... args) {
+  return SharedPtr<T>(new T(std::forward<Args>(args)...));
+}
+
+//makeObject (objects are allocated from the pool of the engine, see Object::operator new)
+template <typename T, typename... Args>
+inline SharedPtr<T> makeObject(PyEngine* py, Args&&... args) {
+  return SharedPtr<T>(new (py) T(py, std::forward<Args>(args)...));
+}
+
+//////////////////////////////////////////////////////////////////
+//size-class allocator for objects, owned by one engine
+//every block starts with a Header so that a block can find its pool on free
+//the pool outlives the engine until its last block is freed
+//define TINYPY_HUGE_PAGES to back slabs with huge pages (Linux only)
+class ObjectPool
+{
+public:
+
+  struct Header
+  {
+    ObjectPool* pool;
+    int         size_class;
+    int         pad;
+  };
+
+  enum
+  {
+    Granularity    = 16,
+    NumSizeClasses = 16,
+    MaxBlockSize   = Granularity * NumSizeClasses
+  };
+
+  //constructor
+  ObjectPool() {
+  }
+
+  //allocate (return the memory after the header)
+  void* allocate(size_t size)
+  {
+    size += sizeof(Header);
+    if (size > MaxBlockSize)
+      return allocateLarge(size);
+
+    int size_class = (int)((size - 1) / Granularity);
+
+#if TINYPY_ATOMIC_REFCOUNT
+    std::lock_guard<std::mutex> lock(mutex);
+#endif
+
+    auto& free_list = free_lists[size_class];
+    Block* block = free_list;
+    if (block)
+      free_list = block->next;
+    else
+      block = refill(size_class);
+
+    num_alive++;
+    auto header = (Header*)block;
+    header->pool = this;
+    header->size_class = size_class;
+    return header + 1;
+  }
+
+  //allocateLarge (blocks over MaxBlockSize go to malloc, with an empty header)
+  static void* allocateLarge(size_t size)
+  {
+    auto header = (Header*)malloc(size);
+    if (!header)
+      throw std::bad_alloc();
+    header->pool = nullptr;
+    header->size_class = -1;
+    return header + 1;
+  }
+
+  //deallocate
+  static void deallocate(void* p)
+  {
+    if (!p)
+      return;
+
+    auto header = (Header*)p - 1;
+    auto pool   = header->pool;
+
+    if (!pool) {
+      free(header);
+      return;
+    }
+
+    pool->release(header);
+  }
+
+  //releaseOwner (called by the engine: the pool is deleted when its last block is freed)
+  void releaseOwner()
+  {
+    bool bDelete;
+    {
+#if TINYPY_ATOMIC_REFCOUNT
+      std::lock_guard<std::mutex> lock(mutex);
+#endif
+      bOwned = false;
+      bDelete = num_alive == 0;
+    }
+    if (bDelete)
+      delete this;
+  }
+
+private:
+
+  struct Block {
+    Block* next;
+  };
+
+  //one free list and one bump region for each size class
+  Block* free_lists[NumSizeClasses] = {};
+  char*  bump_cur  [NumSizeClasses] = {};
+  char*  bump_end  [NumSizeClasses] = {};
+
+  std::vector<std::pair<void*, size_t> > slabs;
+
+  int  num_alive = 0;
+  bool bOwned    = true;
+
+#if TINYPY_ATOMIC_REFCOUNT
+  std::mutex mutex;
+#endif
+
+  //destructor
+  ~ObjectPool();
+
+  //refill (bump allocate from the current slab of the size class)
+  Block* refill(int size_class)
+  {
+    size_t block_size = (size_class + 1) * Granularity;
+    if (bump_cur[size_class] + block_size > bump_end[size_class])
+      newSlab(size_class);
+
+    auto ret = (Block*)bump_cur[size_class];
+    bump_cur[size_class] += block_size;
+    return ret;
+  }
+
+  //release
+  void release(Header* header)
+  {
+    bool bDelete;
+    {
+#if TINYPY_ATOMIC_REFCOUNT
+      std::lock_guard<std::mutex> lock(mutex);
+#endif
+      auto block = (Block*)header;
+      auto& free_list = free_lists[header->size_class];
+      block->next = free_list;
+      free_list = block;
+      bDelete = --num_alive == 0 && !bOwned;
+    }
+    if (bDelete)
+      delete this;
+  }
+
+  //newSlab
+  void newSlab(int size_class);
+
+  //non copyable
+  ObjectPool(const ObjectPool&) = delete;
+  const ObjectPool& operator=(const ObjectPool&) = delete;
+
+};
 
 
 //raiseException
@@ -33,10 +331,6 @@ inline void raiseException(String s) {
   throw s;
 }
 
-//raiseException
-inline void raiseException(SharedPtr<Object> ex) {
-  throw ex;
-}
 
 //////////////////////////////////////////////////////////////////
 class StringUtils
@@ -148,240 +442,524 @@ public:
 
 };
 
+
 //////////////////////////////////////////////////////////////
-class Object : public std::enable_shared_from_this<Object>
+//Value is what registers, containers and native functions pass around:
+//None and numbers (exact int64 or double, both of NumberType) are stored inline, everything else points to a heap Object
+class Value
 {
 public:
 
-  enum
-  {
-    NoneType,
-    NumberType,
-    StringType,
-    DictType,
-    ListType,
-    FunctionType
-  };
+  //constructor
+  Value() {
+  }
 
-  PyEngine* py;
+  //constructor
+  Value(double num_) : tag(NumberTag), num(num_) {
+  }
 
-  int type=NoneType;
+  //constructor
+  template <typename T>
+  Value(const SharedPtr<T>& obj_) {
+    setObject(obj_.get());
+  }
 
-  //todo: optimize!
+  //constructor
+  Value(const Value& other);
 
   //constructor
-  Object(PyEngine* py_, int type_) : py(py_), type(type_) {
+  Value(Value&& other) : tag(other.tag), bits(other.bits) {
+    other.tag = NoneTag;
   }
 
   //destructor
-  virtual ~Object() {
-  }
+  ~Value();
 
-  //self
-  SharedPtr<Object> self() const {
-    return const_cast<Object*>(this)->shared_from_this();
-  }
+  //operator=
+  Value& operator=(const Value& other);
 
-  //clone
-  virtual SharedPtr<Object> clone() {
-    assert(type == NoneType);
-    return self();
-  }
+  //operator=
+  Value& operator=(Value&& other);
 
-  //computeHash
-  virtual int computeHash() {
-    return (type==NoneType)? 0 : computeHash((void*)this, sizeof(void*));
-  }
+  //type
+  int type() const;
 
-  //compare
-  static int compare(SharedPtr<Object> a, SharedPtr<Object> b);
-
-  //toString
-  virtual String toString()  const
-  {
-    assert(type == NoneType);
-    return "None";
+  //isNone
+  bool isNone() const {
+    return tag == NoneTag;
   }
 
-  //toBool
-  virtual bool toBool() const {
-    assert(type == NoneType);
-    return false;
+  //isNumber (int or double)
+  bool isNumber() const {
+    return tag == NumberTag || tag == IntTag;
   }
 
-  //len
-  virtual int len() const {
-    raiseException("(pyLen) TypeError: len() of unsized object");
-    return 0;
+  //isInt
+  bool isInt() const {
+    return tag == IntTag;
   }
 
-public:
-
-  //hasAttr
-  virtual bool hasAttr(SharedPtr<Object> k) {
-    raiseException("(pyHas) TypeError: iterable argument required");
-    return false;
+  //isObject
+  bool isObject() const {
+    return tag == ObjectTag;
   }
 
-  //getAttr
-  virtual SharedPtr<Object> getAttr(SharedPtr<Object> k) {
-    raiseException("(pyGet) TypeError: ?");
-    return NoneObject;
+  //getNumber
+  double getNumber() const {
+    assert(isNumber());
+    return tag == IntTag ? (double)ival : num;
   }
 
-  //setAttr
-  virtual void setAttr(SharedPtr<Object> k, SharedPtr<Object> v) {
-    raiseException("(pySet) TypeError: object does not support item assignment");
-    return;
+  //doubleToInt (truncates, out of range values saturate and NaN gives 0 instead of the undefined cast)
+  static int64_t doubleToInt(double value) {
+    if (value != value) return 0;
+    if (value >=  9223372036854775807.0) return INT64_MAX;
+    if (value <= -9223372036854775808.0) return INT64_MIN;
+    return (int64_t)value;
   }
 
-  //delAttr
-  virtual void delAttr(SharedPtr<Object> k) {
-    raiseException("(pyDelete) TypeError: object does not support item deletion");
+  //getInt
+  int64_t getInt() const {
+    assert(isNumber());
+    return tag == IntTag ? ival : doubleToInt(num);
   }
 
-  //call
-  virtual SharedPtr<Object> call(SharedPtr<ListObject> args) {
-    raiseException("(pyCall) TypeError: object is not callable" + this->toString());
-    return NoneObject;
+  //fromInt
+  static Value fromInt(int64_t value) {
+    Value ret;
+    ret.tag  = IntTag;
+    ret.ival = value;
+    return ret;
   }
 
-public:
-
-  //castToNumber
-  SharedPtr<NumberObject> castToNumber()const {
-    return std::dynamic_pointer_cast<NumberObject>(self());
+  //getObject
+  Object* getObject() const {
+    return tag == ObjectTag ? obj : nullptr;
   }
 
   //castToString
-  SharedPtr<StringObject> castToString() const{
-    return std::dynamic_pointer_cast<StringObject>(self());
+  SharedPtr<StringObject> castToString() const {
+    return SharedPtr<StringObject>(asString());
   }
 
   //castToList
   SharedPtr<ListObject> castToList() const {
-    return std::dynamic_pointer_cast<ListObject>(self());
+    return SharedPtr<ListObject>(asList());
   }
 
   //castToDict
   SharedPtr<DictObject> castToDict() const {
-    return std::dynamic_pointer_cast<DictObject>(self());
+    return SharedPtr<DictObject>(asDict());
   }
 
   //castToFunction
   SharedPtr<FunctionObject> castToFunction() const {
-    return std::dynamic_pointer_cast<FunctionObject>(self());
+    return SharedPtr<FunctionObject>(asFunction());
   }
 
-protected:
+  //asString (borrowed pointer, nullptr if the type does not match)
+  StringObject* asString() const;
 
-  //computeHash
-  static int computeHash(void* v, int l) {
-    int ret = l + (l >= 4 ? *(int*)v : 0);
-    for (int i = l, step = (l >> 5) + 1; i >= step; i -= step)
-      ret = ret ^ ((ret << 5) + (ret >> 2) + ((unsigned char *)v)[i - 1]);
-    return ret;
+  //asList
+  ListObject* asList() const;
+
+  //asDict
+  DictObject* asDict() const;
+
+  //asFunction
+  FunctionObject* asFunction() const;
+
+  //identity
+  const void* identity() const {
+    return getObject();
   }
 
+public:
+
+  //clone
+  Value clone() const;
+
+  //computeHash
+  int computeHash() const;
+
+  //toString
+  String toString() const;
+
+  //toBool
+  bool toBool() const;
+
+  //len
+  int len() const;
+
+  //hasAttr
+  bool hasAttr(const Value& k) const;
+
+  //getAttr
+  Value getAttr(const Value& k) const;
+
+  //setAttr
+  void setAttr(const Value& k, const Value& v) const;
+
+  //delAttr
+  void delAttr(const Value& k) const;
+
+  //call
+  Value call(SharedPtr<ListObject> args) const;
+
 private:
 
-  //non copyable
-  Object(const Object&) = delete;
-  const Object& operator=(const Object&) = delete;
+  enum
+  {
+    NoneTag,
+    NumberTag,
+    IntTag,
+    ObjectTag
+  };
 
-};
+  int tag = NoneTag;
 
+  union
+  {
+    double   num = 0;
+    int64_t  ival;
+    Object*  obj;
+    uint64_t bits;
+  };
 
-typedef std::function<SharedPtr<Object>(PyEngine*, SharedPtr<ListObject>)> Function;
+  //setObject
+  void setObject(Object* value);
 
-///////////////////////////////////////////////////////////
-class NumberObject : public Object
+  //as (checked by type tag instead of RTTI, _DEBUG verifies the tag against dynamic_cast)
+  template <typename T>
+  T* as(int object_type) const;
+
+};
+
+//raiseException
+inline void raiseException(Value ex) {
+  throw ex;
+}
+
+/////////////////////////////////////////////////////////////////////
+//links of the container objects tracked by the generational cycle collector (see PyEngine::collectGarbage)
+class GcNode
 {
 public:
 
-  double val;
-
-  //constructor
-  NumberObject(PyEngine* py,double val_) : Object(py,NumberType), val(val_) {
-  }
+  GcNode* gc_prev = nullptr;
+  GcNode* gc_next = nullptr;
 
-  //destructor
-  virtual ~NumberObject() {
-  }
+  //scratch count used during a collection
+  int gc_refs = 0;
 
+  //0 for containers created since the last collection, 1 for survivors
+  int gc_generation = 0;
 
-  //toString
-  virtual String toString()  const override {
-    return StringUtils::format()<<val;
+  //isTracked
+  bool isTracked() const {
+    return gc_prev != nullptr;
   }
 
-  //toBool
-  virtual bool toBool() const override{
-    return val!=0;
+  //gcLink
+  void gcLink(GcNode* head)
+  {
+    gc_prev = head;
+    gc_next = head->gc_next;
+    head->gc_next->gc_prev = this;
+    head->gc_next = this;
   }
 
-  //clone
-  virtual SharedPtr<Object> clone() override {
-    return std::make_shared<NumberObject>(py, val);
+  //gcUnlink
+  void gcUnlink()
+  {
+    if (!gc_prev)
+      return;
+    gc_prev->gc_next = gc_next;
+    gc_next->gc_prev = gc_prev;
+    gc_prev = gc_next = nullptr;
   }
 
-  //computeHash
-  virtual int computeHash() override {
-    return Object::computeHash((void*)&val, sizeof(double));
+  //gcSplice (move all the nodes of the list 'from' to the list 'to')
+  static void gcSplice(GcNode* from, GcNode* to)
+  {
+    if (from->gc_next == from)
+      return;
+    from->gc_next->gc_prev = to;
+    from->gc_prev->gc_next = to->gc_next;
+    to->gc_next->gc_prev = from->gc_prev;
+    to->gc_next = from->gc_next;
+    from->gc_prev = from->gc_next = from;
   }
 
 };
 
+//gcTrack
+void gcTrack(PyEngine* py, Object* obj);
+
 ///////////////////////////////////////////////////////////
-class StringObject : public Object
+class Object : public RefCounted, public GcNode
 {
 public:
 
-  String val;
+  enum
+  {
+    NoneType,
+    NumberType,
+    StringType,
+    DictType,
+    ListType,
+    FunctionType,
+    TotalTypes
+  };
+
+  PyEngine* py;
+
+  int type=NoneType;
+
+  //constructor
+  Object(PyEngine* py_, int type_) : py(py_), type(type_) 
+  {
+    //only containers can be part of a reference cycle
+    if (py && (type == DictType || type == ListType || type == FunctionType))
+      gcTrack(py, this);
+  }
+
+  //destructor
+  virtual ~Object() {
+    gcUnlink();
+  }
+
+  //operator new (from the pool of the engine)
+  static void* operator new(size_t size, PyEngine* py);
+
+  //operator new (no engine, goes to malloc)
+  static void* operator new(size_t size) {
+    return ObjectPool::allocateLarge(size + sizeof(ObjectPool::Header));
+  }
+
+  //operator delete
+  static void operator delete(void* p) {
+    ObjectPool::deallocate(p);
+  }
+
+  //operator delete (if a constructor throws)
+  static void operator delete(void* p, PyEngine* py) {
+    ObjectPool::deallocate(p);
+  }
+
+  //self
+  SharedPtr<Object> self() const {
+    return SharedPtr<Object>(const_cast<Object*>(this));
+  }
+
+  //clone
+  virtual SharedPtr<Object> clone() {
+    return self();
+  }
+
+  //visitRefs (objects directly referenced by this one, for the cycle collector)
+  virtual void visitRefs(const std::function<void(Object*)>& fn) {
+  }
+
+  //clearRefs (drop all references, called on unreachable cycles)
+  virtual void clearRefs() {
+  }
+
+  //computeHash
+  virtual int computeHash() {
+    return computeHash((void*)this, sizeof(void*));
+  }
+
+  //compare
+  static int compare(const Value& a, const Value& b);
+
+  //toString
+  virtual String toString() const = 0;
+
+  //toBool
+  virtual bool toBool() const {
+    return true;
+  }
+
+  //len
+  virtual int len() const {
+    raiseException("(pyLen) TypeError: len() of unsized object");
+    return 0;
+  }
+
+public:
+
+  //hasAttr
+  virtual bool hasAttr(const Value& k) {
+    raiseException("(pyHas) TypeError: iterable argument required");
+    return false;
+  }
+
+  //getAttr
+  virtual Value getAttr(const Value& k) {
+    raiseException("(pyGet) TypeError: ?");
+    return Value();
+  }
+
+  //setAttr
+  virtual void setAttr(const Value& k, const Value& v) {
+    raiseException("(pySet) TypeError: object does not support item assignment");
+    return;
+  }
+
+  //delAttr
+  virtual void delAttr(const Value& k) {
+    raiseException("(pyDelete) TypeError: object does not support item deletion");
+  }
+
+  //call
+  virtual Value call(SharedPtr<ListObject> args) {
+    raiseException("(pyCall) TypeError: object is not callable" + this->toString());
+    return Value();
+  }
+
+public:
+
+  //computeHash
+  static int computeHash(const void* v, int l) {
+    int ret = l + (l >= 4 ? *(int*)v : 0);
+    for (int i = l, step = (l >> 5) + 1; i >= step; i -= step)
+      ret = ret ^ ((ret << 5) + (ret >> 2) + ((unsigned char *)v)[i - 1]);
+    return ret;
+  }
+
+};
+
+
+typedef std::function<Value(PyEngine*, SharedPtr<ListObject>)> Function;
+
+//builtin method of lists and strings, the receiver is argv[0]; OP_CALLMETHOD calls it without building an argument list
+typedef Value (*NativeMethod)(PyEngine* py, const Value* argv, int argc);
+
+///////////////////////////////////////////////////////////
+//storage shared by the strings built by repeated concatenation and by long slices
+class StringBuffer : public RefCounted
+{
+public:
+
+  String data;
+
+  //set once slices share the buffer: it is never appended to again
+  bool frozen = false;
+
+};
+
+///////////////////////////////////////////////////////////
+class StringObject : public Object
+{
+public:
+
+  //strings are immutable once created, so the hash is computed once (lazily for concatenations)
+  int  hash = 0;
+
+  //set by PyEngine::internString: the string is unique in the engine
+  bool interned = false;
 
   //constructor
-  StringObject(PyEngine* py,String val_ = "") : Object(py,StringType), val(val_) {
+  StringObject(PyEngine* py,String val_ = "") : Object(py,StringType), val(val_), length((int)val.length()) {
+    hash = Object::computeHash((void*)val.c_str(), length);
+    bHashValid = true;
+  }
+
+  //constructor (length_ characters at offset_ in a shared buffer)
+  StringObject(PyEngine* py, SharedPtr<StringBuffer> buffer_, int offset_, int length_) : Object(py, StringType), length(length_), buffer(buffer_), offset(offset_) {
   }
 
   //destructor
   virtual ~StringObject() {
   }
 
+  //str (a concatenation or a slice is flattened on first read)
+  const String& str() const 
+  {
+    if (buffer) 
+    {
+      //a frozen buffer never changes, a string covering all of it is read in place
+      if (buffer->frozen && offset == 0 && length == (int)buffer->data.length())
+        return buffer->data;
+      flatten();
+    }
+    return val;
+  }
+
+  //data (the characters, without flattening)
+  const char* data() const {
+    return buffer ? buffer->data.data() + offset : val.data();
+  }
+
   //toString
   virtual String toString()  const override {
-    return val;
+    return str();
   }
 
   //toBool
   virtual bool toBool() const override {
-    return !val.empty();
+    return length > 0;
   }
 
   //len
   virtual int len() const  override{
-    return (int)val.length();
+    return length;
   }
 
   //hasAttr
-  virtual bool hasAttr(SharedPtr<Object> k) override {
+  virtual bool hasAttr(const Value& k) override {
 
-    if (k->type == Object::StringType) 
-      return val.find(k->castToString()->val) != String::npos;
+    if (k.type() == Object::StringType) 
+      return str().find(k.castToString()->str()) != String::npos;
     else
       return false;
   }
 
   //getAttr
-  virtual SharedPtr<Object> getAttr(SharedPtr<Object> k) override;
+  virtual Value getAttr(const Value& k) override;
 
   //clone
   virtual SharedPtr<Object> clone() override {
-    return std::make_shared<StringObject>(py, val);
+    return makeObject<StringObject>(py, str());
   }
 
   //computeHash
   virtual int computeHash() override {
-    return Object::computeHash((void*)val.c_str(), (int)val.length());
+    if (!bHashValid) {
+      hash = Object::computeHash((void*)data(), length);
+      bHashValid = true;
+    }
+    return hash;
+  }
+
+  //concat (s = s + piece appends in place when s is the longest string on its buffer)
+  SharedPtr<StringObject> concat(const StringObject& other) const;
+
+  //slice (long slices share the storage, short or disproportionately small ones are copied)
+  SharedPtr<StringObject> slice(int a, int b) const;
+
+private:
+
+  //flat representation, empty until flatten() for concatenations
+  mutable String val;
+
+  int length = 0;
+
+  bool bHashValid = false;
+
+  //not null for a concatenation or a slice not flattened yet
+  mutable SharedPtr<StringBuffer> buffer;
+
+  //position in the buffer
+  mutable int offset = 0;
+
+  //flatten
+  void flatten() const;
+
+  //appendTo
+  void appendTo(String& dst) const {
+    dst.append(data(), length);
   }
 
 };
@@ -391,14 +969,14 @@ class ListObject : public Object
 {
 public:
 
-  typedef std::vector<SharedPtr<Object>> Vector;
+  typedef std::vector<Value> Vector;
   typedef typename Vector::iterator             iterator;
   typedef typename Vector::const_iterator const_iterator;
 
   Vector items;
 
   //constructor
-  ListObject(PyEngine* py,Vector items_= Vector()) : Object(py,ListType),items(items_) {
+  ListObject(PyEngine* py,Vector items_= Vector()) : Object(py,ListType),items(std::move(items_)) {
   }
 
   //destructor
@@ -409,8 +987,8 @@ public:
   virtual String toString()  const override {
     std::ostringstream out;
     out << "[";
-    int I=0;for (auto it : *this)
-      out << (I++ ? "," : "") << it->toString();
+    int I=0;for (const auto& it : *this)
+      out << (I++ ? "," : "") << it.toString();
     out << "]";
     return out.str();
   }
@@ -426,39 +1004,64 @@ public:
   }
 
   //hasAttr
-  virtual bool hasAttr(SharedPtr<Object> k) override {
+  virtual bool hasAttr(const Value& k) override {
     return find(k) != -1;
   }
 
   //getAttr
-  virtual SharedPtr<Object> getAttr(SharedPtr<Object> k) override;
+  virtual Value getAttr(const Value& k) override;
 
   //setAttr
-  virtual void setAttr(SharedPtr<Object> k, SharedPtr<Object> v) override;
+  virtual void setAttr(const Value& k, const Value& v) override;
 
   //clone
   virtual SharedPtr<Object> clone() override {
-    return std::make_shared<ListObject>(py, items);
+    return makeObject<ListObject>(py, items);
+  }
+
+  //visitRefs
+  virtual void visitRefs(const std::function<void(Object*)>& fn) override {
+    for (const auto& it : items)
+      if (auto obj = it.getObject()) fn(obj);
+  }
+
+  //clearRefs
+  virtual void clearRefs() override {
+    Vector tmp;
+    tmp.swap(items);
+    bHashValid = false;
   }
 
   //computeHash
   virtual int computeHash() override {
+
+    if (bHashValid)
+      return hash;
+
     int ret = 0;
-    for (auto it : *this)
-        ret += it->computeHash();
+    bool bNested = false;
+    for (const auto& it : *this)
+    {
+      ret += it.computeHash();
+      bNested = bNested || it.type() == ListType;
+    }
+
+    //nested lists can change behind our back, don't cache
+    hash = ret;
+    bHashValid = !bNested;
     return ret;
   }
 
   //append
   void append(ListObject& other) {
-    for (auto it : other)
+    for (const auto& it : other)
       pushBack(it);
   }
 
   //find
-  int find(SharedPtr<Object> what) {
+  int find(const Value& what) {
     int n = 0; 
-    for (auto it : *this)
+    for (const auto& it : *this)
     {
       if (Object::compare(what, it) == 0)
         return n;
@@ -475,6 +1078,7 @@ public:
   //clear
   void clear() {
     this->items.clear();
+    bHashValid = false;
   }
 
   //begin
@@ -498,7 +1102,7 @@ public:
   }
 
   //getAt
-  SharedPtr<Object> getAt(int index) const {
+  const Value& getAt(int index) const {
 
     if (index < 0 || index >= size())
       raiseException("out of index");
@@ -507,133 +1111,383 @@ public:
 
   //getNumberAt
   double getNumberAt(int index) const {
-    auto ret = this->getAt(index);
-    if (ret->type != NumberType)
+    const auto& ret = this->getAt(index);
+    if (ret.type() != NumberType)
       raiseException("(popWithType) TypeError: unexpected type");
-    return ret->castToNumber()->val;
+    return ret.getNumber();
   }
 
   //getStringAt
   String getStringAt(int index) const {
-    auto ret = this->getAt(index);
-    if (ret->type != StringType)
+    const auto& ret = this->getAt(index);
+    if (ret.type() != StringType)
       raiseException("(popWithType) TypeError: unexpected type");
-    return ret->castToString()->val;
+    return ret.castToString()->str();
   }
 
   //getListAt
   SharedPtr<ListObject> getListAt(int index) const {
-    auto ret = this->getAt(index);
-    if (ret->type != ListType)
+    const auto& ret = this->getAt(index);
+    if (ret.type() != ListType)
       raiseException("(popWithType) TypeError: unexpected type");
-    return ret->castToList();
+    return ret.castToList();
   }
 
   //getDictAt
   SharedPtr<DictObject> getDictAt(int index) const {
-    auto ret = this->getAt(index);
-    if (ret->type != DictType)
+    const auto& ret = this->getAt(index);
+    if (ret.type() != DictType)
       raiseException("(popWithType) TypeError: unexpected type");
-    return ret->castToDict();
+    return ret.castToDict();
   }
 
   //popFunction
   SharedPtr<FunctionObject> getFunctionAt(int index) const {
-    auto ret = this->getAt(index);
-    if (ret->type != FunctionType)
+    const auto& ret = this->getAt(index);
+    if (ret.type() != FunctionType)
       raiseException("(popWithType) TypeError: unexpected type");
-    return ret->castToFunction();
+    return ret.castToFunction();
   }
 
   //setAt
-  void setAt(int index, SharedPtr<Object> value) {
+  void setAt(int index, const Value& value) {
     items[index] = value;
+    bHashValid = false;
   }
 
   //eraseAt
   void eraseAt(iterator it) {
     items.erase(it);
+    bHashValid = false;
   }
 
   //insertAt
-  void insertAt(int index, SharedPtr<Object> value)
+  void insertAt(int index, const Value& value)
   {
     if (index >= this->size())
       items.push_back(value);
     else
       items.insert(items.begin() + index, value);
+    bHashValid = false;
   }
 
   //pushBack
-  void pushBack(SharedPtr<Object> value) {
+  void pushBack(const Value& value) {
     items.push_back(value);
+    bHashValid = false;
   }
 
 
   //pushFront
-  void pushFront(SharedPtr<Object> value) {
+  void pushFront(const Value& value) {
     insertAt(0,value);
   }
 
   //sort
-  void sort() {
-    std::sort(items.begin(), items.end(), [](const SharedPtr<Object>& a, const SharedPtr<Object>& b) {
-      return Object::compare(a, b);
-    });
+  void sort() 
+  {
+    //numbers are stored inline, all-number lists are sorted without going through Object::compare
+    bool bInts = true, bNumbers = true;
+    for (const auto& it : items) {
+      bInts    = bInts    && it.isInt();
+      bNumbers = bNumbers && it.isNumber();
+    }
+
+    if (bInts)
+      std::sort(items.begin(), items.end(), [](const Value& a, const Value& b) { return a.getInt() < b.getInt(); });
+    else if (bNumbers)
+      std::sort(items.begin(), items.end(), [](const Value& a, const Value& b) { return a.getNumber() < b.getNumber(); });
+    else
+      std::sort(items.begin(), items.end(), [](const Value& a, const Value& b) { return Object::compare(a, b) < 0; });
+
+    bHashValid = false;
   }
 
   //popAt
-  SharedPtr<Object> popAt(int n) {
+  Value popAt(int n) {
     auto ret = getAt(n);
     eraseAt(begin() + n);
     return ret;
   }
 
   //popBack
-  SharedPtr<Object> popBack() {
+  Value popBack() {
     return popAt(size() - 1);
   }
 
   //popFront
-  SharedPtr<Object> popFront() {
+  Value popFront() {
     return popAt(0);
   }
 
   //print
   void print() const
   {
-    int n = 0;  for (auto it : *const_cast<ListObject*>(this)) {
-      std::cout << (n ? " " : "") << it->toString();
+    int n = 0;  for (const auto& it : *this) {
+      std::cout << (n ? " " : "") << it.toString();
       n++;
     }
     std::cout << std::endl;
   }
 
+private:
+
+  //cached content hash, dropped on every mutation
+  int  hash = 0;
+  bool bHashValid = false;
+
 };
 
 
 ///////////////////////////////////////////////////////////
-class DictObject : public Object
+//hidden class of instance objects: the attribute names in slot order, shared by all the
+//objects that got the same attributes in the same order. Shapes form a transition tree owned by the engine
+class Shape : public RefCounted
 {
 public:
 
-  struct Less
-  {
-    bool operator() (const SharedPtr<Object>& lhs, const SharedPtr<Object>& rhs) const {
-      return lhs->computeHash() < rhs->computeHash();
-    }
+  enum {
+    MaxSlots       = 64,
+    MaxTransitions = 32
+  };
+
+  //interned attribute names
+  std::vector< SharedPtr<StringObject> > keys;
+
+  //constructor
+  Shape() {
+  }
+
+  //find (slot index or -1)
+  int find(const StringObject* key) const 
+  {
+    for (int I = 0, N = (int)keys.size(); I < N; I++)
+      if (keys[I].get() == key) return I;
+    return -1;
+  }
+
+  //addKey (the shape with one more slot, nullptr once a non-empty shape has too many successors)
+  Shape* addKey(const SharedPtr<StringObject>& key)
+  {
+    for (const auto& it : transitions)
+      if (it.first == key.get()) return it.second.get();
+
+    //the empty shape is shared by every instance of every class, only its successors are capped
+    if (!keys.empty() && (int)transitions.size() >= MaxTransitions)
+      return nullptr;
+
+    auto ret = makeShared<Shape>();
+    ret->keys = keys;
+    ret->keys.push_back(key);
+    transitions.push_back(std::make_pair(key.get(), ret));
+    return ret.get();
+  }
+
+private:
+
+  std::vector< std::pair<const StringObject*, SharedPtr<Shape> > > transitions;
+
+};
+
+///////////////////////////////////////////////////////////
+//insertion-ordered hash table: dense entries plus a sparse open-addressing index into them
+class HashMap
+{
+public:
+
+  struct Entry
+  {
+    Value first;
+    Value second;
+    int   hash = 0;
+    bool  used = false;
+  };
+
+  template <typename Map, typename EntryType>
+  class Iterator
+  {
+  public:
+
+    //constructor (skips deleted entries)
+    Iterator(Map* map_, int index_) : map(map_), index(index_) {
+      skip();
+    }
+
+    EntryType& operator*() const {
+      return map->entries[index];
+    }
+
+    EntryType* operator->() const {
+      return &map->entries[index];
+    }
+
+    Iterator& operator++() {
+      ++index;
+      skip();
+      return *this;
+    }
+
+    bool operator==(const Iterator& other) const {
+      return index == other.index;
+    }
+
+    bool operator!=(const Iterator& other) const {
+      return index != other.index;
+    }
+
+    //position (in the entries, stays valid until the table is compacted)
+    int position() const {
+      return index;
+    }
+
+  private:
+
+    Map* map;
+    int  index;
+
+    //skip
+    void skip() {
+      while (index < (int)map->entries.size() && !map->entries[index].used)
+        ++index;
+    }
+
+  };
+
+  typedef Iterator<HashMap, Entry> iterator;
+  typedef Iterator<const HashMap, const Entry> const_iterator;
+
+  //constructor
+  HashMap() {
+  }
+
+  iterator       begin()       { return iterator(this, 0); }
+  iterator       end()         { return iterator(this, (int)entries.size()); }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end()   const { return const_iterator(this, (int)entries.size()); }
+
+  //size
+  int size() const {
+    return num_used;
+  }
+
+  //empty
+  bool empty() const {
+    return num_used == 0;
+  }
+
+  //mutations (changes on every insertion, erase and rehash, positions are stable while it does not)
+  uint32_t mutations() const {
+    return num_mutations;
+  }
+
+  //find
+  iterator find(const Value& k) {
+    int index = findEntry(k, k.computeHash());
+    return index >= 0 ? iterator(this, index) : end();
+  }
+
+  //operator[] (inserts None if missing)
+  Value& operator[](const Value& k);
+
+  //erase
+  void erase(iterator it);
+
+  //clear
+  void clear() {
+    HashMap tmp;
+    swap(tmp);
+  }
+
+  //swap
+  void swap(HashMap& other) {
+    entries.swap(other.entries);
+    indices.swap(other.indices);
+    std::swap(num_used, other.num_used);
+    std::swap(num_filled, other.num_filled);
+    num_mutations = other.num_mutations = std::max(num_mutations, other.num_mutations) + 1;
+  }
+
+  //seek (first entry at or after position, end() if none)
+  iterator seek(int position) {
+    return iterator(this, std::min(std::max(position, 0), (int)entries.size()));
+  }
+
+  //entryAt (nullptr if deleted or out of range)
+  Entry* entryAt(int position) {
+    return position >= 0 && position < (int)entries.size() && entries[position].used ? &entries[position] : nullptr;
+  }
+
+private:
+
+  template <typename, typename> friend class Iterator;
+
+  enum {
+    Empty   = -1,
+    Deleted = -2,
+    MinSize = 8
   };
 
-  typedef std::map<SharedPtr<Object>, SharedPtr<Object>, Less> Map;
-  typedef typename Map::iterator iterator;
+  std::vector<Entry> entries;
+  std::vector<int>   indices;
+  int                num_used = 0;
+
+  //index slots that are not Empty, the probing must always find one that is
+  int                num_filled = 0;
+
+  uint32_t           num_mutations = 0;
+
+  //findEntry (position in the entries or -1)
+  int findEntry(const Value& k, int hash) const
+  {
+    if (indices.empty())
+      return -1;
+
+    size_t mask = indices.size() - 1;
+    size_t perturb = (unsigned)hash;
+    for (size_t I = perturb & mask;; I = (I * 5 + 1 + (perturb >>= 5)) & mask)
+    {
+      int index = indices[I];
+      if (index == Empty)
+        return -1;
+
+      if (index >= 0)
+      {
+        const auto& entry = entries[index];
+        if (entry.hash == hash && (
+          (k.identity() && k.identity() == entry.first.identity()) || Object::compare(k, entry.first) == 0))
+          return index;
+      }
+    }
+  }
+
+  //findIndex (the index slot pointing to the entry)
+  size_t findIndex(int hash, int index) const;
+
+  //rehash (compacts the entries and resizes the index)
+  void rehash();
+
+};
+
+///////////////////////////////////////////////////////////
+class DictObject : public Object
+{
+public:
+
+  typedef HashMap Map;
+  typedef Map::iterator iterator;
 
   Map map;
 
   SharedPtr<DictObject> meta;
   
+  //engine-wide unique stamp of the layout, changes when a key is added or removed but not when
+  //a value is overwritten: the caches borrow pointers to the values (see AttrCache)
+  uint64_t version = 0;
+
   //constructor
   DictObject(PyEngine* py, bool bObject_ = false,Map map_=Map(),SharedPtr<DictObject> meta_= SharedPtr<DictObject>())
-    : Object(py,DictType),bObject(bObject_),map(map_),meta(meta_) {
+    : Object(py,DictType),map(std::move(map_)),meta(meta_),bObject(bObject_) {
+    touch();
   }
 
   //destructor
@@ -656,30 +1510,64 @@ public:
   }
 
   //hasAttr
-  virtual bool hasAttr(SharedPtr<Object> k) override {
-    return map.find(k) != end();
+  virtual bool hasAttr(const Value& k) override {
+    if (shape)
+      return findSlot(k) >= 0;
+    return map.find(k) != map.end();
   }
 
   //getAttr
-  virtual SharedPtr<Object> getAttr(SharedPtr<Object> k) override;
+  virtual Value getAttr(const Value& k) override;
 
   //setAttr
-  virtual void setAttr(SharedPtr<Object> k, SharedPtr<Object> v) override;
+  virtual void setAttr(const Value& k, const Value& v) override;
 
   //delAttr
-  virtual void delAttr(SharedPtr<Object> k) override {
+  virtual void delAttr(const Value& k) override {
+    ensureMap();
     auto it = map.find(k);
     if (it == map.end())
-      raiseException(StringUtils::format() << "(py_dict_del) KeyError: " << k->toString());
+      raiseException(StringUtils::format() << "(py_dict_del) KeyError: " << k.toString());
     map.erase(it);
+    touch();
   }
 
-  //lookup
-  SharedPtr<Object> lookup(SharedPtr<Object> k, int depth = 8);
+  //lookup (walks the meta chain, returns false if not found)
+  bool lookup(const Value& k, Value& ret, int depth = 8);
+
+  //setItem (store without going through __set__)
+  void setItem(const Value& k, const Value& v);
 
   //clone
   virtual SharedPtr<Object> clone() override {
-    return std::make_shared<DictObject>(py, bObject,map,meta? std::dynamic_pointer_cast<DictObject>(meta->clone()) : SharedPtr<DictObject>());
+    auto ret = makeObject<DictObject>(py, bObject,map,meta? Value(meta->clone()).castToDict() : SharedPtr<DictObject>());
+    ret->shape = shape;
+    ret->slots = slots;
+    return ret;
+  }
+
+  //visitRefs
+  virtual void visitRefs(const std::function<void(Object*)>& fn) override 
+  {
+    for (const auto& it : static_cast<const Map&>(map))
+    {
+      if (auto obj = it.first .getObject()) fn(obj);
+      if (auto obj = it.second.getObject()) fn(obj);
+    }
+    for (const auto& it : slots)
+      if (auto obj = it.getObject()) fn(obj);
+    if (meta) fn(meta.get());
+  }
+
+  //clearRefs
+  virtual void clearRefs() override {
+    Map tmp;
+    tmp.swap(map);
+    Slots tmp_slots;
+    tmp_slots.swap(slots);
+    shape.reset();
+    meta.reset();
+    touch();
   }
 
   //isDict
@@ -693,35 +1581,211 @@ public:
   }
 
   //call
-  virtual SharedPtr<Object> call(SharedPtr<ListObject> args) override;
+  virtual Value call(SharedPtr<ListObject> args) override;
 
 
-  //begin
+  //begin (iterating an instance turns it into a dictionary)
   iterator begin() {
+    ensureMap();
     return map.begin();
   }
 
   //end
   iterator end() {
+    ensureMap();
     return map.end();
   }
 
   //empty
   bool empty() const {
-    return map.empty();
+    return size() == 0;
   }
 
   //size
   int size() const {
-    return (int)map.size();
+    return shape ? (int)slots.size() : (int)map.size();
+  }
+
+  //setShape (instances start from the empty shape of the engine)
+  void setShape(const SharedPtr<Shape>& value) {
+    assert(bObject && map.empty() && slots.empty());
+    shape = value;
   }
 
+  //touch (new version)
+  void touch();
+
 private:
 
+  friend class PyEngine;
+  friend class AttrCache;
+
+  typedef std::vector<Value> Slots;
+
   bool bObject = false;
+
+  //instances keep their attributes in slots described by the shape, null for dictionaries
+  //and for pathological instances (too many attributes, non-string keys, deletions)
+  SharedPtr<Shape> shape;
+  Slots            slots;
+
+  //findSlot
+  int findSlot(const Value& k) const;
+
+  //ensureMap (move the slots to the map)
+  void ensureMap();
 
-  //computeHash
-  static size_t computeHash(SharedPtr<Object> value);
+};
+
+///////////////////////////////////////////////////////////
+//inline cache of one OP_GET/OP_SET instruction on instances: valid while the receiver has the same
+//shape and every dict of its meta chain has the same version (so no __get__/__set__ appeared either)
+class AttrCache
+{
+public:
+
+  enum {
+    MaxEntries = 4,
+    MaxChain   = 4
+  };
+
+  struct Entry
+  {
+    const Shape*        shape = nullptr;
+    const StringObject* key   = nullptr;
+
+    //meta chain of the receiver
+    int               num_chain = 0;
+    const DictObject* chain   [MaxChain];
+    uint64_t          versions[MaxChain];
+
+    //own slot of the receiver, or -1
+    int slot = -1;
+
+    //found in the meta chain (OP_GET), borrowed: the storage cannot move while the versions hold
+    const Value* value = nullptr;
+
+    //shape after adding the key (OP_SET)
+    Shape* new_shape = nullptr;
+  };
+
+  Entry entries[MaxEntries];
+  int   num_entries = 0;
+
+  //replaced in turn once the site is polymorphic beyond MaxEntries
+  int   next = 0;
+
+  //find
+  Entry* find(const DictObject* dict, const StringObject* key);
+
+  //add
+  Entry& add() 
+  {
+    if (num_entries < MaxEntries)
+      return entries[num_entries++];
+    auto& ret = entries[next];
+    next = (next + 1) % MaxEntries;
+    ret = Entry();
+    return ret;
+  }
+
+};
+
+//cache of one OP_GGET: valid while the globals and builtins keep their versions
+class GlobalCache
+{
+public:
+  const DictObject*   globals = nullptr;
+  uint64_t            globals_version = 0;
+  uint64_t            builtins_version = 0;
+  const StringObject* key = nullptr;
+
+  //borrowed from the globals or the builtins, as for AttrCache::Entry::value
+  const Value*        value = nullptr;
+};
+
+//caches of all the instructions of some bytecode, indexed by instruction word
+class InlineCaches
+{
+public:
+
+  std::vector<int>         sites;
+  std::vector<AttrCache>   attrs;
+  std::vector<GlobalCache> globals;
+
+  //attr (OP_GET, OP_SET)
+  AttrCache& attr(int word, int num_words) {
+    return site(attrs, word, num_words);
+  }
+
+  //global (OP_GGET)
+  GlobalCache& global(int word, int num_words) {
+    return site(globals, word, num_words);
+  }
+
+private:
+
+  //site (an instruction word always has the same opcode, so one index serves all the kinds)
+  template <typename Cache>
+  Cache& site(std::vector<Cache>& caches, int word, int num_words)
+  {
+    if (sites.empty())
+      sites.resize(num_words, -1);
+    int& index = sites[word];
+    if (index < 0) {
+      index = (int)caches.size();
+      caches.push_back(Cache());
+    }
+    return caches[index];
+  }
+
+};
+
+///////////////////////////////////////////////////////////
+//bytecode decoded once before it runs: OP_NUMBER and OP_STRING become OP_CONSTANT loads of prebuilt values
+//immutable once decoded (except the caches), shared by all the functions of a def and all their frames
+class CodeObject : public RefCounted
+{
+public:
+
+  //Line
+  struct Line
+  {
+    int lineno;
+    int cursor; //source text, stored in the bytecode after the OP_LINE
+    int size;
+  };
+
+  //same layout as the source (jumps unchanged), nested OP_DEF bodies are left as they are
+  String             bytecode;
+
+  //constants, indexed by OP_CONSTANT
+  std::vector<Value> constants;
+
+  //registers used, from the leading OP_REGS (256 when unknown)
+  int                num_regs = 256;
+
+  //from OP_FILE and OP_NAME (None if they were not constants)
+  Value              filename;
+  Value              name;
+
+  //line table, indexed by OP_LINE
+  std::vector<Line>  lines;
+
+  //code of the nested OP_DEF, indexed by the first word of their body
+  std::vector< SharedPtr<CodeObject> > functions;
+
+  //attribute and global caches of the instructions
+  InlineCaches       caches;
+
+  //constructor
+  CodeObject() {
+  }
+
+  //getLine
+  String getLine(int line) const {
+    return line >= 0 ? bytecode.substr(lines[line].cursor, lines[line].size) : String();
+  }
 
 };
 
@@ -729,10 +1793,11 @@ private:
 class FunctionObject : public Object
 {
 public:
-  SharedPtr<Object>     instance;
+  Value                 instance;
   SharedPtr<DictObject> globals;
-  String                bytecode;
+  SharedPtr<CodeObject> code;
   Function              function;
+  NativeMethod          native = nullptr;
 
   //constructor
   FunctionObject(PyEngine* py) : Object(py,FunctionType) {
@@ -752,19 +1817,41 @@ public:
     return true;
   }
 
+  //isMethod
+  bool isMethod() const {
+    return !instance.isNone();
+  }
+
   //call
-  virtual SharedPtr<Object> call(SharedPtr<ListObject> args) override;
+  virtual Value call(SharedPtr<ListObject> args) override;
+
+  //invoke (args already start with the receiver if any, and are consumed by the call)
+  Value invoke(SharedPtr<ListObject> args);
 
   //clone
   virtual SharedPtr<Object> clone() override {
-    auto ret = std::make_shared<FunctionObject>(py);
+    auto ret = makeObject<FunctionObject>(py);
     ret->instance = instance;
     ret->globals  = globals;
-    ret->bytecode = bytecode;
+    ret->code     = code;
     ret->function = function;
+    ret->native   = native;
     return ret;
   }
 
+  //visitRefs (native closures are opaque, what they capture is treated as an external reference)
+  virtual void visitRefs(const std::function<void(Object*)>& fn) override {
+    if (auto obj = instance.getObject()) fn(obj);
+    if (globals) fn(globals.get());
+  }
+
+  //clearRefs
+  virtual void clearRefs() override {
+    instance = Value();
+    globals.reset();
+    function = nullptr;
+  }
+
   //computeHash
   virtual int computeHash() override {
     return Object::computeHash((void*)this,sizeof(void*));
@@ -772,6 +1859,168 @@ public:
 
 };
 
+//////////////////////////////////////////////////////////////
+inline Value::Value(const Value& other) : tag(other.tag), bits(other.bits) {
+  if (tag == ObjectTag) obj->incRef();
+}
+
+//////////////////////////////////////////////////////////////
+inline Value::~Value() {
+  if (tag == ObjectTag) obj->decRef();
+}
+
+//////////////////////////////////////////////////////////////
+inline Value& Value::operator=(const Value& other)
+{
+  if (other.tag == ObjectTag) other.obj->incRef();
+  if (tag == ObjectTag) obj->decRef();
+  tag = other.tag;
+  bits = other.bits;
+  return *this;
+}
+
+//////////////////////////////////////////////////////////////
+inline Value& Value::operator=(Value&& other)
+{
+  if (this != &other)
+  {
+    if (tag == ObjectTag) obj->decRef();
+    tag = other.tag;
+    bits = other.bits;
+    other.tag = NoneTag;
+  }
+  return *this;
+}
+
+//////////////////////////////////////////////////////////////
+inline void Value::setObject(Object* value)
+{
+  tag = value ? ObjectTag : NoneTag;
+  obj = value;
+  if (value) value->incRef();
+}
+
+//////////////////////////////////////////////////////////////
+template <typename T>
+inline T* Value::as(int object_type) const
+{
+  if (tag != ObjectTag || obj->type != object_type)
+    return nullptr;
+  auto ret = static_cast<T*>(obj);
+#ifdef _DEBUG
+  assert(dynamic_cast<T*>(obj) == ret);
+#endif
+  return ret;
+}
+
+//////////////////////////////////////////////////////////////
+inline StringObject* Value::asString() const {
+  return as<StringObject>(Object::StringType);
+}
+
+//////////////////////////////////////////////////////////////
+inline ListObject* Value::asList() const {
+  return as<ListObject>(Object::ListType);
+}
+
+//////////////////////////////////////////////////////////////
+inline DictObject* Value::asDict() const {
+  return as<DictObject>(Object::DictType);
+}
+
+//////////////////////////////////////////////////////////////
+inline FunctionObject* Value::asFunction() const {
+  return as<FunctionObject>(Object::FunctionType);
+}
+
+//////////////////////////////////////////////////////////////
+inline int Value::type() const {
+  return tag == ObjectTag ? obj->type : (tag == NoneTag ? Object::NoneType : Object::NumberType);
+}
+
+//////////////////////////////////////////////////////////////
+inline Value Value::clone() const {
+  return tag == ObjectTag ? Value(obj->clone()) : *this;
+}
+
+//////////////////////////////////////////////////////////////
+inline int Value::computeHash() const
+{
+  if (tag == ObjectTag) return obj->computeHash();
+  if (tag == NumberTag) return Object::computeHash((void*)&num, sizeof(double));
+
+  //equal ints and doubles must have the same hash
+  if (tag == IntTag) {
+    double d = (double)ival;
+    return Object::computeHash((void*)&d, sizeof(double));
+  }
+  return 0;
+}
+
+//////////////////////////////////////////////////////////////
+inline String Value::toString() const
+{
+  if (tag == ObjectTag) return obj->toString();
+  if (tag == NumberTag) return StringUtils::format() << num;
+  if (tag == IntTag) return StringUtils::format() << (long long)ival;
+  return "None";
+}
+
+//////////////////////////////////////////////////////////////
+inline bool Value::toBool() const
+{
+  if (tag == ObjectTag) return obj->toBool();
+  if (tag == NumberTag) return num != 0;
+  if (tag == IntTag) return ival != 0;
+  return false;
+}
+
+//////////////////////////////////////////////////////////////
+inline int Value::len() const 
+{
+  if (tag == ObjectTag) return obj->len();
+  raiseException("(pyLen) TypeError: len() of unsized object");
+  return 0;
+}
+
+//////////////////////////////////////////////////////////////
+inline bool Value::hasAttr(const Value& k) const
+{
+  if (tag == ObjectTag) return obj->hasAttr(k);
+  raiseException("(pyHas) TypeError: iterable argument required");
+  return false;
+}
+
+//////////////////////////////////////////////////////////////
+inline Value Value::getAttr(const Value& k) const
+{
+  if (tag == ObjectTag) return obj->getAttr(k);
+  raiseException("(pyGet) TypeError: ?");
+  return Value();
+}
+
+//////////////////////////////////////////////////////////////
+inline void Value::setAttr(const Value& k, const Value& v) const
+{
+  if (tag == ObjectTag) return obj->setAttr(k, v);
+  raiseException("(pySet) TypeError: object does not support item assignment");
+}
+
+//////////////////////////////////////////////////////////////
+inline void Value::delAttr(const Value& k) const
+{
+  if (tag == ObjectTag) return obj->delAttr(k);
+  raiseException("(pyDelete) TypeError: object does not support item deletion");
+}
+
+//////////////////////////////////////////////////////////////
+inline Value Value::call(SharedPtr<ListObject> args) const
+{
+  if (tag == ObjectTag) return obj->call(args);
+  raiseException("(pyCall) TypeError: object is not callable" + toString());
+  return Value();
+}
+
 ////////////////////////////////////////////////////////////////
 class PyEngine 
 {
@@ -785,7 +2034,7 @@ public:
 
   //addModule
   void addModule(String name, SharedPtr<DictObject> mod) {
-    modules->setAttr(this->createString(name), mod);
+    modules.setAttr(this->internString(name), mod);
   }
 
   //load
@@ -795,42 +2044,71 @@ public:
   String compileFile(String sourcode, String filename);
 
   //callFunctionInModule
-  SharedPtr<Object> callFunctionInModule(String modulename, String functionname, SharedPtr<ListObject> args) {
-    auto module   = modules->getAttr(this->createString(modulename));
-    auto function =  module->getAttr(this->createString(functionname));
-    return function->call(args);
+  Value callFunctionInModule(String modulename, String functionname, SharedPtr<ListObject> args) {
+    auto module   = modules.getAttr(this->internString(modulename));
+    auto function =  module.getAttr(this->internString(functionname));
+    return function.call(args);
   }
 
   //runCode
-  SharedPtr<Object> runCode(String sourcecode, SharedPtr<DictObject> globals, String filename = "<eval>");
+  Value runCode(String sourcecode, SharedPtr<DictObject> globals, String filename = "<eval>");
 
 public:
 
   //createNumber
-  SharedPtr<NumberObject> createNumber(double val = 0) {
-    return std::make_shared<NumberObject>(this, val);
+  Value createNumber(double val = 0) {
+    return Value(val);
+  }
+
+  //createInt
+  Value createInt(int64_t val) {
+    return Value::fromInt(val);
+  }
+
+  //createBool (there is no bool type: True and False are the numbers 1 and 0)
+  Value createBool(bool val) {
+    return Value::fromInt(val ? 1 : 0);
   }
 
   //createString
   SharedPtr<StringObject> createString(String val = "") {
-    return std::make_shared<StringObject>(this, val);
+    return makeObject<StringObject>(this, val);
+  }
+
+  //internString (identifiers and constants, one object per distinct value)
+  SharedPtr<StringObject> internString(const char* s, int len);
+
+  //internString
+  SharedPtr<StringObject> internString(const String& s) {
+    return internString(s.c_str(), (int)s.length());
+  }
+
+  //createChar (one-character strings are preallocated and interned)
+  const SharedPtr<StringObject>& createChar(unsigned char c) {
+    return chars[c];
   }
 
   //createList
   SharedPtr<ListObject> createList(ListObject::Vector items = ListObject::Vector()) {
-    return std::make_shared<ListObject>(this, items);
+    return makeObject<ListObject>(this, std::move(items));
   }
 
   //createDict
   SharedPtr<DictObject> createDict(bool bObject = false, DictObject::Map map = DictObject::Map(), SharedPtr<DictObject> meta = SharedPtr<DictObject>()) {
-    return std::make_shared<DictObject>(this, bObject, map, meta);
+    auto ret = makeObject<DictObject>(this, bObject, std::move(map), meta);
+    if (bObject && ret->map.empty())
+      ret->setShape(empty_shape);
+    return ret;
   }
 
+  //findInterned (nullptr if the string was never interned)
+  StringObject* findInterned(const char* s, int len, int hash);
+
   //createFunction
-  SharedPtr<FunctionObject> createFunction(Function function, SharedPtr<Object> instance = SharedPtr<Object>(), String bytecode = "", SharedPtr<DictObject> globals = SharedPtr<DictObject>())
+  SharedPtr<FunctionObject> createFunction(Function function, Value instance = Value(), SharedPtr<CodeObject> code = SharedPtr<CodeObject>(), SharedPtr<DictObject> globals = SharedPtr<DictObject>())
   {
-    auto ret = std::make_shared<FunctionObject>(this);
-    ret->bytecode = bytecode;
+    auto ret = makeObject<FunctionObject>(this);
+    ret->code     = code;
     ret->instance = instance;
     ret->globals  = globals;
     ret->function = function;
@@ -838,71 +2116,256 @@ public:
   }
 
   //createMethod
-  SharedPtr<FunctionObject> createMethod(SharedPtr<Object> instance, Function function) {
+  SharedPtr<FunctionObject> createMethod(Value instance, Function function) {
     return createFunction(function, instance);
   }
 
+  //bindFunction (same code, bound to instance)
+  SharedPtr<FunctionObject> bindFunction(FunctionObject* fn, Value instance)
+  {
+    auto ret = createFunction(fn->function, instance, fn->code, fn->globals);
+    ret->native = fn->native;
+    return ret;
+  }
+
+  //findMethod (builtin method of the type, nullptr if none)
+  FunctionObject* findMethod(int type, const Value& k);
+
+  //interned names the runtime looks up by itself
+  SharedPtr<StringObject> keyGet, keySet, keyNew, keyCall, keyInit;
+
+  //GcStats
+  struct GcStats
+  {
+    int    young_collections = 0;
+    int    full_collections  = 0;
+    int    freed             = 0;
+
+    //pauses in seconds
+    double total_pause = 0;
+    double max_pause   = 0;
+    double last_pause  = 0;
+  };
+
+  //collectGarbage (free unreachable reference cycles, only in the young generation unless bFull, return the number of containers freed)
+  int collectGarbage(bool bFull = true);
+
+  //setGcThreshold (young collection after this many new containers, 0 disables automatic collection)
+  void setGcThreshold(int value) {
+    gc_threshold = value;
+  }
+
+  //getGcStats
+  const GcStats& getGcStats() const {
+    return gc_stats;
+  }
+
+  //pool for all objects of this engine
+  ObjectPool* pool = new ObjectPool();
+
+  //last DictObject version
+  uint64_t dict_version = 0;
+
 private:
 
+  friend void gcTrack(PyEngine* py, Object* obj);
+
+  //one-character strings
+  SharedPtr<StringObject> chars[256];
+
+  //root of the shape tree of instances
+  SharedPtr<Shape> empty_shape = makeShared<Shape>();
+
+  //tracked containers, circular lists: created since the last collection and survivors
+  GcNode gc_young, gc_old;
+
+  //containers created since the last collection
+  int gc_allocations = 0;
+
+  //automatic young collection
+  int gc_threshold = 2000;
+
+  //survivors promoted since the last full collection, survivors of the last full collection
+  int gc_promoted = 0, gc_old_alive = 0;
+
+  //gc_stats
+  GcStats gc_stats;
+
+  //collectGeneration
+  int collectGeneration(GcNode* head, int generation, int& num_alive);
+
+  //promoteYoung (move the young containers to the old generation)
+  void promoteYoung();
+
   friend class FunctionObject;
 
-  //___________________________________________
-  class Regs
+  //__________________________________________
+  class Frame
   {
   public:
 
-    std::vector< SharedPtr<SharedPtr<Object> > > v;
+    SharedPtr<CodeObject> code;
+    int                   cursor = 0;
+    int                   jump_to = 0;
+    Value*                regs = nullptr;
+    int                   num_regs = 0;
+    int                   line = -1;
+    SharedPtr<DictObject> globals;
+    Value*                ret = nullptr;
 
-    //operator[]
-    SharedPtr<Object>& operator[](int index) 
-    {
-      if (index >= v.size())
-        v.resize(index + 1);
-      if (!v[index])
-        v[index] = std::make_shared<SharedPtr<Object>>();
-      return *v[index];
-    }
+    //pushed by runFrame, its return goes back to C++
+    bool                  native_caller = false;
+
+    //top of the value stack before the frame was pushed
+    int                   stack_chunk = 0;
+    int                   stack_top = 0;
   };
 
   //__________________________________________
-  class Frame
+  //frames and their register windows, reused from one call to the next
+  class FrameStack
   {
   public:
 
-    typedef std::function<void(SharedPtr<Object>)> OnPop;
+    //register windows are carved at the top of a chunk and never move, runStep keeps a raw pointer across nested calls
+    static const int ChunkSize = 16384;
 
-    String                bytecode;
-    int                   cursor = 0;
-    int                   jump_to = 0;
-    Regs                  regs;
-    String                filename;
-    String                name;
-    String                line;
-    SharedPtr<DictObject> globals;
-    int                   lineno = 0;
-    OnPop                 on_pop;
+    //calls do not use the native stack, this is the only bound on the recursion
+    static const int MaxFrames = 250000;
+
+    std::vector< std::vector<Value> > chunks;
+    int chunk = -1;
+    int top   = ChunkSize;
+
+    //deque: growing at the end never moves the existing frames
+    std::deque<Frame> frames;
+    int num_frames = 0;
+
+    //push (registers are None)
+    Frame* push(int num_regs)
+    {
+      if (num_frames == (int)frames.size())
+        frames.emplace_back();
+
+      auto frame = &frames[num_frames++];
+      frame->stack_chunk = chunk;
+      frame->stack_top   = top;
+
+      if (top + num_regs > ChunkSize)
+      {
+        if (++chunk == (int)chunks.size())
+          chunks.emplace_back(std::max(num_regs, (int)ChunkSize));
+        top = 0;
+      }
+
+      frame->regs     = chunks[chunk].data() + top;
+      frame->num_regs = num_regs;
+      top += num_regs;
+      return frame;
+    }
+
+    //pop (releases what the frame references)
+    void pop()
+    {
+      auto frame = &frames[--num_frames];
+      for (int R = 0; R < frame->num_regs; R++)
+        frame->regs[R] = Value();
+
+      chunk = frame->stack_chunk;
+      top   = frame->stack_top;
+
+      frame->code.reset();
+      frame->globals.reset();
+      frame->ret = nullptr;
+    }
+
+    //current
+    Frame* current() {
+      return &frames[num_frames - 1];
+    }
+
+    //size
+    int size() const {
+      return num_frames;
+    }
+
+    //empty
+    bool empty() const {
+      return num_frames == 0;
+    }
   };
 
+  //All interned strings, open addressing on the string hash.
+  std::vector< SharedPtr<StringObject> > interned;
+  int num_interned = 0;
+
   //A dictionary containing all builtin objects.
-  SharedPtr<Object> builtins;
+  Value builtins;
 
   //A dictionary with all loaded modules.
-  SharedPtr<Object> modules;
+  Value modules;
 
   //A list of all call frames.
-  std::stack< SharedPtr<Frame> > frames;
+  FrameStack frames;
 
   //is_running
   int is_running = 0;
 
+  //native stack address of the outermost runFrame, and how much the nested ones may use below it
+  uintptr_t stack_base = 0;
+  size_t    stack_budget = 0;
+
+  //builtin methods of each type, by interned name
+  std::vector< std::pair< SharedPtr<StringObject>, SharedPtr<FunctionObject> > > methods[Object::TotalTypes];
+
   //addBuiltIns
   void addBuiltIns();
 
-  //pushFrame
-  SharedPtr<Object> runFrame(String bytecode, std::vector< SharedPtr<Object> > regs, SharedPtr<DictObject> globals);
+  //addMethods
+  void addMethods();
+
+  //decodeNumber (inline data of OP_NUMBER, flags in its Number)
+  Value decodeNumber(const unsigned char* data, int flags);
+
+  //decodeCode
+  SharedPtr<CodeObject> decodeCode(const String& bytecode);
+
+  //pushFrame (registers are None, the result is stored in ret when the frame pops)
+  Frame* pushFrame(SharedPtr<CodeObject> code, SharedPtr<DictObject> globals, int num_regs, Value* ret);
+
+  //pushCall (call of a bytecode function from the dispatch loop, args are consumed)
+  void pushCall(FunctionObject* fn, SharedPtr<ListObject> args, Value* ret);
+
+  //runFrame
+  Value runFrame(SharedPtr<CodeObject> code, std::vector<Value> regs, SharedPtr<DictObject> globals);
+
+  //fillAttrCache (false if the access cannot be cached)
+  bool fillAttrCache(AttrCache::Entry& entry, DictObject* dict, StringObject* key, bool bSet);
+
+  //cachedGetAttr (with a receiver, a method found in the class is returned unbound and the receiver set to obj)
+  Value cachedGetAttr(Frame* frame, int word, const Value& obj, const Value& k, Value* receiver = nullptr);
+
+  //cachedSetAttr
+  void cachedSetAttr(Frame* frame, int word, const Value& obj, const Value& k, const Value& v);
+
+  //cachedGetGlobal (globals first, then builtins)
+  Value cachedGetGlobal(Frame* frame, int word, const Value& k);
 
   //popFrame
-  void popFrame(SharedPtr<Object> obj);
+  void popFrame(Value obj);
+
+  //traceback of the exception being unwound
+  String traceback;
+
+  //unwindFrames (false if no frame above upto handles the exception)
+  bool unwindFrames(int upto);
+
+  //collectIfDue (only where everything alive is referenced by a frame or by a native caller)
+  void collectIfDue() {
+    //a full collection once the promoted survivors outnumber the old ones, to keep its cost amortized
+    if (gc_threshold && gc_allocations >= gc_threshold)
+      collectGarbage(gc_promoted >= std::max(10 * gc_threshold, gc_old_alive));
+  }
 
   //run
   void run();
@@ -912,5 +2375,21 @@ private:
 
 };
 
+//////////////////////////////////////////////////////////////
+inline void gcTrack(PyEngine* py, Object* obj) {
+  obj->gcLink(&py->gc_young);
+  py->gc_allocations++;
+}
+
+//////////////////////////////////////////////////////////////
+inline void DictObject::touch() {
+  version = ++py->dict_version;
+}
+
+//////////////////////////////////////////////////////////////
+inline void* Object::operator new(size_t size, PyEngine* py) {
+  return py->pool->allocate(size);
+}
+
 
 #endif //TINYPY_H__
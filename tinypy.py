@@ -29,6 +29,12 @@ if not "tinypy" in sys.version:
 		import struct
 		return struct.pack('d',v)
 
+	# ipack (integer literal, see isint64)
+	def ipack(v):
+		import struct
+		if v[0:2] == '0x': return struct.pack('q',int(v[2:],16))
+		return struct.pack('q',int(v))
+
 	# loadFile
 	def loadFile(filename):
 		f = open(filename,'rb')
@@ -92,6 +98,8 @@ OP_BITXOR=45
 OP_IFN=46
 OP_NOT=47
 OP_BITNOT = 48
+OP_LOADMETHOD=49
+OP_CALLMETHOD=50
 
 # /////////////////////////////////////////////////////
 def raiseError(explanation,s,i):
@@ -929,8 +937,10 @@ class Encoder:
 	def do_call(self,t,r=None):
 		r = self.get_tmp(r)
 		items = t.items
-		fnc = self.do(items[0])
 		a,b,c,d = self.p_filter(t.items[1:])
+		if items[0].type == 'get' and len(b) == 0 and c == None and d == None:
+			return self.do_method_call(items[0],a,r)
+		fnc = self.do(items[0])
 		e = None
 		if len(b) != 0 or d != None:
 			e = self.do(Token(t.pos,'dict',None,[])); self.un_tmp(e);
@@ -953,6 +963,23 @@ class Encoder:
 		self.free_tmp(fnc) #REG
 		return r
 
+	# do_method_call (obj.name(...): the receiver goes in a register, no bound method is created)
+	def do_method_call(self,t,a,r):
+		tmps = self.get_tmps(2+len(a))
+		b,c = self.do(t.items[0]),self.do(t.items[1])
+		self.do_code(OP_LOADMETHOD,tmps[0],b,c)
+		self.free_tmp(b); self.free_tmp(c) #REG
+		n = 2
+		for tt in a:
+			v = self.do(tt,tmps[n])
+			if v != tmps[n]:
+				self.do_code(OP_MOVE,tmps[n],v)
+				self.free_tmp(v) #REG
+			n += 1
+		self.do_code(OP_CALLMETHOD,r,tmps[0],len(a))
+		self.free_tmps(tmps)
+		return r
+
 	# do_name
 	def do_name(self,t,r=None):
 		if t.val in D.vars:
@@ -1481,10 +1508,27 @@ class Encoder:
 	# _do_number
 	def _do_number(self,v,r=None):
 		r = self.get_tmp(r)
-		self.do_code(OP_NUMBER,r,0,0)
-		self.write(fpack(number(v)))
+		if self.isint64(v):
+			self.do_code(OP_NUMBER,r,0,1)
+			self.write(ipack(v))
+		else:
+			self.do_code(OP_NUMBER,r,0,0)
+			self.write(fpack(number(v)))
 		return r
 
+	# isint64 (integer literal that an int64 holds exactly, the others go as doubles)
+	def isint64(self,v):
+		digits = '0123456789'
+		if v[0:2] == '0x':
+			v = v[2:]
+			digits = '0123456789abcdef'
+			if len(v) > 16 or (len(v) == 16 and v[0] > '7'): return False
+		elif len(v) > 19 or (len(v) == 19 and v > '9223372036854775807'): return False
+		if len(v) == 0: return False
+		for c in v:
+			if c not in digits: return False
+		return True
+
 	# do_number
 	def do_number(self,t,r=None):
 		return self._do_number(t.val,r)